@@ -29,9 +29,16 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
 
 namespace mongo {
 /**
@@ -77,6 +84,91 @@ private:
     AtomicWord<long long> _counter;
 };
 
+/**
+ * A 64bit counter that spreads increments over several cache-line-exclusive
+ * stripes, summing them lazily on read. Unlike Counter64, incrementing from
+ * many threads at once does not bounce a single cache line between cores.
+ * On Linux a thread writes the stripe for the CPU it is currently running
+ * on, so a stripe's cache line stays resident on one core (and, on
+ * multi-socket hosts, one NUMA node) no matter how threads migrate.
+ * Elsewhere each thread is assigned one stripe, round-robin, the first time
+ * it touches any StripedCounter64.
+ *
+ * The trade-offs are memory (kNumStripes cache lines per counter rather than
+ * one) and a get() that reads every stripe. Use this type for counters that
+ * hot paths increment from many threads and that are read rarely (e.g. only
+ * by serverStatus), and plain Counter64 otherwise.
+ *
+ * get() sums the stripes one at a time and so is not a point-in-time
+ * snapshot, but that is no weaker than what a single relaxed counter
+ * provides.
+ */
+class StripedCounter64 {
+public:
+    /**
+     * Fixed rather than sized to the host: enough stripes that concurrent
+     * writers rarely collide even on large machines, while keeping the
+     * memory footprint and the cost of get() bounded.
+     */
+    static constexpr size_t kNumStripes = 32;
+
+    /** Atomically increment. */
+    void increment(uint64_t n = 1) {
+        _myStripe().fetchAndAdd(n);
+    }
+
+    /** Atomically increment with a relaxed memory order. */
+    void incrementRelaxed(uint64_t n = 1) {
+        _myStripe().fetchAndAddRelaxed(n);
+    }
+
+    /**
+     * Atomically increment with a relaxed memory order, returning the
+     * previous value of the calling thread's stripe. Callers that reset on
+     * overflow (see OpCounters) can bound the summed value by comparing
+     * against a per-stripe limit of their overall limit / kNumStripes.
+     */
+    long long fetchAndAddRelaxed(long long n) {
+        return _myStripe().fetchAndAddRelaxed(n);
+    }
+
+    /**
+     * Store the exact value 0 into each stripe. The stripes are zeroed one
+     * at a time, so increments racing with this may survive it.
+     */
+    void setToZero() {
+        for (auto& stripe : _stripes) {
+            stripe->store(0);
+        }
+    }
+
+    /** Return the sum of all stripes. */
+    long long get() const {
+        long long total = 0;
+        for (auto& stripe : _stripes) {
+            total += stripe->loadRelaxed();
+        }
+        return total;
+    }
+
+private:
+    AtomicWord<long long>& _myStripe() {
+#ifdef __linux__
+        // sched_getcpu() is vDSO-backed, far cheaper than pulling a contended cache line across
+        // sockets. Keying the stripe on the current CPU rather than on the thread keeps each
+        // stripe's line local to one core even as threads migrate.
+        if (int cpu = sched_getcpu(); cpu >= 0) {
+            return *_stripes[static_cast<uint32_t>(cpu) % kNumStripes];
+        }
+#endif
+        static AtomicWord<uint32_t> nextSlot;
+        thread_local const uint32_t slot = nextSlot.fetchAndAdd(1) % kNumStripes;
+        return *_stripes[slot];
+    }
+
+    std::array<CacheExclusive<AtomicWord<long long>>, kNumStripes> _stripes;
+};
+
 /**
  * Atomic wrapper for Metrics. This is for values which are set rather than just
  * incremented or decremented; if you want a counter, use Counter64 above.
@@ -28,8 +28,11 @@
  */
 
 
+#include <vector>
+
 #include "mongo/base/counter.h"
 #include "mongo/base/string_data.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 
@@ -65,5 +68,43 @@ TEST(CounterTest, IncrementDecrementRelaxed) {
     ASSERT_EQUALS(c.get(), -1);
 }
 
+TEST(StripedCounterTest, IncrementAndSum) {
+    StripedCounter64 c;
+    ASSERT_EQUALS(c.get(), 0);
+    c.increment();
+    ASSERT_EQUALS(c.get(), 1);
+    c.incrementRelaxed(3);
+    ASSERT_EQUALS(c.get(), 4);
+    c.setToZero();
+    ASSERT_EQUALS(c.get(), 0);
+}
+
+TEST(StripedCounterTest, FetchAndAddReturnsStripeValue) {
+    StripedCounter64 c;
+    // A single thread always lands on the same stripe, so it sees its own
+    // previous value back.
+    ASSERT_EQUALS(c.fetchAndAddRelaxed(5), 0);
+    ASSERT_EQUALS(c.fetchAndAddRelaxed(2), 5);
+    ASSERT_EQUALS(c.get(), 7);
+}
+
+TEST(StripedCounterTest, SumsAcrossThreads) {
+    static constexpr size_t kThreads = 8;
+    static constexpr long long kIncrementsPerThread = 10'000;
+    StripedCounter64 c;
+    std::vector<stdx::thread> threads;
+    for (size_t i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&c] {
+            for (long long j = 0; j < kIncrementsPerThread; ++j) {
+                c.incrementRelaxed();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    ASSERT_EQUALS(c.get(), kThreads * kIncrementsPerThread);
+}
+
 }  // namespace
 }  // namespace mongo
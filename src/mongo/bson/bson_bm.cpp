@@ -259,7 +259,50 @@ BENCHMARK(BM_arrayStlIterate)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_arrayStlIterateWithSize)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BSONnFields)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_bsonIteratorSortedConstruction)->Ranges({{{1}, {100'000}}});
+void BM_woCompareEqualObjects(benchmark::State& state) {
+    BSONArrayBuilder builder;
+    auto len = state.range(0);
+    for (auto j = 0; j < len; j++)
+        builder.append(buildSampleObj(1));  // All elements are identical.
+    BSONObj array = builder.done();
+    BSONObj copy = array.copy();
+
+    size_t totalSize = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(array.woCompare(copy));
+        totalSize += array.objsize();
+    }
+    state.SetBytesProcessed(totalSize);
+}
+
+void BM_validateLongFieldNames(benchmark::State& state) {
+    // Stresses the chunked field name and UTF-8 scans in the validator: wide documents with
+    // field names and string payloads long enough to hit the vectorized path.
+    BSONArrayBuilder builder;
+    auto len = state.range(0);
+    size_t totalSize = 0;
+    const std::string payload(64, 'x');
+    for (auto j = 0; j < len; j++) {
+        BSONObjBuilder subObj(builder.subobjStart());
+        for (int f = 0; f < 16; f++)
+            subObj.append("a_rather_long_field_name_" + std::to_string(f), payload);
+    }
+    BSONObj array = builder.done();
+    invariant(validateBSON(array.objdata(), array.objsize()));
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(
+            validateBSON(array.objdata(), array.objsize(), BSONValidateModeEnum::kFull));
+        totalSize += array.objsize();
+    }
+    state.SetBytesProcessed(totalSize);
+}
+
 BENCHMARK(BM_validate)->Ranges({{{1}, {1'000}}});
 BENCHMARK(BM_validate_contents)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_validateLongFieldNames)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_woCompareEqualObjects)->Ranges({{{1}, {1'000}}});
 
 }  // namespace mongo
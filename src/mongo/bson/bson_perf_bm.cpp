@@ -0,0 +1,171 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+/**
+ * Consolidated BSON-layer performance benchmarks covering iteration, dotted-path extraction,
+ * builder append patterns, and validation across several representative document shapes. Intended
+ * to be run as a single target so build gating can track BSON regressions in one place:
+ *
+ *   bazel run //src/mongo/bson:bson_perf_bm -- --benchmark_format=json
+ *
+ * The JSON output is machine-readable for regression baselines. Shapes are chosen to stress
+ * different code paths: flat scalar documents, deeply nested documents, wide documents with many
+ * fields, and string-heavy documents.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bson_validate.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+
+namespace mongo {
+namespace {
+
+BSONObj buildFlatDoc(int numFields) {
+    BSONObjBuilder bob;
+    for (int i = 0; i < numFields; ++i)
+        bob.append("field" + std::to_string(i), i);
+    return bob.obj();
+}
+
+BSONObj buildNestedDoc(int depth) {
+    BSONObj obj = BSON("leaf" << 1);
+    for (int i = 0; i < depth; ++i)
+        obj = BSON("nested" << obj << "sibling" << i);
+    return obj;
+}
+
+BSONObj buildStringDoc(int numFields) {
+    BSONObjBuilder bob;
+    const std::string payload(128, 'x');
+    for (int i = 0; i < numFields; ++i)
+        bob.append("str" + std::to_string(i), payload);
+    return bob.obj();
+}
+
+void BM_perfIterateFlat(benchmark::State& state) {
+    BSONObj doc = buildFlatDoc(state.range(0));
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        int count = 0;
+        for (auto&& elem : doc) {
+            benchmark::DoNotOptimize(elem.fieldNameStringData());
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+        totalBytes += doc.objsize();
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_perfDottedPathExtraction(benchmark::State& state) {
+    BSONObj doc = buildNestedDoc(state.range(0));
+    std::string path = "leaf";
+    for (int i = 0; i < state.range(0); ++i)
+        path = "nested." + path;
+
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(doc.getFieldDotted(path));
+        totalBytes += doc.objsize();
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_perfBuilderAppendScalars(benchmark::State& state) {
+    auto numFields = state.range(0);
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        BSONObjBuilder bob;
+        for (int i = 0; i < numFields; ++i)
+            bob.append("field" + std::to_string(i), i);
+        BSONObj doc = bob.obj();
+        benchmark::DoNotOptimize(doc);
+        totalBytes += doc.objsize();
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_perfBuilderAppendSubobjects(benchmark::State& state) {
+    auto numSubObjs = state.range(0);
+    BSONObj sub = buildFlatDoc(8);
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        BSONObjBuilder bob;
+        for (int i = 0; i < numSubObjs; ++i)
+            bob.append("sub" + std::to_string(i), sub);
+        BSONObj doc = bob.obj();
+        benchmark::DoNotOptimize(doc);
+        totalBytes += doc.objsize();
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void validateShape(benchmark::State& state, const BSONObj& doc, BSONValidateModeEnum mode) {
+    invariant(validateBSON(doc.objdata(), doc.objsize(), mode));
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        benchmark::DoNotOptimize(validateBSON(doc.objdata(), doc.objsize(), mode));
+        totalBytes += doc.objsize();
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_perfValidateFlat(benchmark::State& state) {
+    validateShape(state, buildFlatDoc(state.range(0)), BSONValidateModeEnum::kDefault);
+}
+
+void BM_perfValidateNested(benchmark::State& state) {
+    validateShape(state, buildNestedDoc(state.range(0)), BSONValidateModeEnum::kDefault);
+}
+
+void BM_perfValidateStringsFull(benchmark::State& state) {
+    validateShape(state, buildStringDoc(state.range(0)), BSONValidateModeEnum::kFull);
+}
+
+BENCHMARK(BM_perfIterateFlat)->Ranges({{{8}, {1'024}}});
+BENCHMARK(BM_perfDottedPathExtraction)->Ranges({{{1}, {16}}});
+BENCHMARK(BM_perfBuilderAppendScalars)->Ranges({{{8}, {1'024}}});
+BENCHMARK(BM_perfBuilderAppendSubobjects)->Ranges({{{8}, {256}}});
+BENCHMARK(BM_perfValidateFlat)->Ranges({{{8}, {1'024}}});
+BENCHMARK(BM_perfValidateNested)->Ranges({{{1}, {16}}});
+BENCHMARK(BM_perfValidateStringsFull)->Ranges({{{8}, {1'024}}});
+
+}  // namespace
+}  // namespace mongo
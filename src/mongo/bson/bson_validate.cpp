@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <array>
+#include <boost/predef/hardware/simd.h>
 #include <cstring>
 #include <fmt/format.h>
 #include <memory>
@@ -39,6 +40,14 @@
 #include <utility>
 #include <vector>
 
+#if defined(BOOST_HW_SIMD_X86_AVAILABLE) && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
+#include <emmintrin.h>
+#define MONGO_BSON_VALIDATE_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define MONGO_BSON_VALIDATE_NEON 1
+#endif
+
 
 #include "mongo/base/data_type_endian.h"
 #include "mongo/base/data_view.h"
@@ -55,6 +64,7 @@
 #include "mongo/bson/column/bsoncolumn_util.h"
 #include "mongo/crypto/encryption_fields_util.h"
 #include "mongo/crypto/fle_field_schema_gen.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decimal_counter.h"
@@ -108,6 +118,68 @@ MONGO_STATIC_ASSERT(sizeof(kTypeInfoTable) == 32);
 constexpr ErrorCodes::Error InvalidBSON = ErrorCodes::InvalidBSON;
 constexpr ErrorCodes::Error NonConformantBSON = ErrorCodes::NonConformantBSON;
 
+/**
+ * Scans [ptr, end) in 16-byte chunks and returns the number of bytes before the first NUL, or
+ * the distance scanned vectorized if no NUL was found in any full chunk. The caller finishes the
+ * tail with a scalar loop, so this never reads past 'end'. Field names and UTF-8 payloads in bulk
+ * insert workloads are long enough that chunked classification beats the per-byte loop.
+ */
+MONGO_COMPILER_ALWAYS_INLINE size_t scanForNul(const char* ptr, const char* end, bool* found) {
+    size_t len = 0;
+#if defined(MONGO_BSON_VALIDATE_SSE2)
+    while (ptr + len + 16 <= end) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + len));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_setzero_si128()));
+        if (mask) {
+            *found = true;
+            return len + countTrailingZerosNonZero32(mask);
+        }
+        len += 16;
+    }
+#elif defined(MONGO_BSON_VALIDATE_NEON)
+    while (ptr + len + 16 <= end) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(ptr + len));
+        uint8x16_t isZero = vceqzq_u8(chunk);
+        // Narrow each pair of bytes to 4 bits so the 64-bit extract yields a nibble per byte.
+        uint64_t mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(isZero), 4)), 0);
+        if (mask) {
+            *found = true;
+            return len + (countTrailingZerosNonZero64(mask) >> 2);
+        }
+        len += 16;
+    }
+#endif
+    *found = false;
+    return len;
+}
+
+/**
+ * Returns true if [ptr, ptr + len) is pure ASCII, checking 16 bytes per iteration. Strings with
+ * multi-byte sequences bail out to the full UTF-8 state machine.
+ */
+MONGO_COMPILER_ALWAYS_INLINE bool isAllAscii(const char* ptr, size_t len) {
+    size_t i = 0;
+#if defined(MONGO_BSON_VALIDATE_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + i));
+        if (_mm_movemask_epi8(chunk))
+            return false;
+    }
+#elif defined(MONGO_BSON_VALIDATE_NEON)
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(ptr + i));
+        if (vmaxvq_u8(chunk) >= 0x80)
+            return false;
+    }
+#endif
+    for (; i < len; ++i) {
+        if (static_cast<uint8_t>(ptr[i]) >= 0x80)
+            return false;
+    }
+    return true;
+}
+
 class DefaultValidator {
 public:
     void checkNonConformantElem(const char* ptr, uint32_t offsetToValue, uint8_t type) {}
@@ -402,6 +474,10 @@ private:
     }
 
     void checkUTF8Char(StringData str) {
+        // Pure ASCII strings are trivially valid UTF-8 and cover the vast majority of field
+        // names and payloads; only run the full state machine on multi-byte input.
+        if (MONGO_likely(isAllAscii(str.data(), str.size())))
+            return;
         uassert(NonConformantBSON,
                 "Found string that doesn't follow UTF-8 encoding.",
                 str::validUTF8(str));
@@ -534,9 +610,13 @@ private:
         }
 
         size_t strlen() const {
-            // This is actually by far the hottest code in all of BSON validation.
+            // This is actually by far the hottest code in all of BSON validation. Scan whole
+            // chunks where the buffer permits; the trailing EOO bounds the scalar tail loop.
             dassert(ptr < end);
-            size_t len = 0;
+            bool found = false;
+            size_t len = scanForNul(ptr, end, &found);
+            if (found)
+                return len;
             while (ptr[len])
                 ++len;
             return len;
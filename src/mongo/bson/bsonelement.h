@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <array>
+#include <boost/optional.hpp>
 #include <cmath>
 #include <cstdint>
 #include <cstring>  // strlen
@@ -522,6 +523,63 @@ public:
      */
     StatusWith<int> parseIntegerElementToInt() const;
 
+    /**
+     * No-throw, allocation-free typed extraction for hot parse paths (e.g. generated command
+     * parsers). Returns boost::none if the element is missing (EOO) or its BSON type does not
+     * exactly match the requested C++ type; no numeric coercion is performed. Unlike the
+     * throwing accessors, failure builds no error context strings, so callers can probe for
+     * optional fields without paying for the miss.
+     *
+     * Supported types: bool, int, long long, double, Decimal128, StringData, BSONObj, Date_t,
+     * Timestamp and OID.
+     */
+    template <typename T>
+    boost::optional<T> tryGetValue() const noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (type() != mongo::Bool)
+                return boost::none;
+            return boolean();
+        } else if constexpr (std::is_same_v<T, int>) {
+            if (type() != mongo::NumberInt)
+                return boost::none;
+            return _numberInt();
+        } else if constexpr (std::is_same_v<T, long long>) {
+            if (type() != mongo::NumberLong)
+                return boost::none;
+            return _numberLong();
+        } else if constexpr (std::is_same_v<T, double>) {
+            if (type() != mongo::NumberDouble)
+                return boost::none;
+            return _numberDouble();
+        } else if constexpr (std::is_same_v<T, Decimal128>) {
+            if (type() != mongo::NumberDecimal)
+                return boost::none;
+            return _numberDecimal();
+        } else if constexpr (std::is_same_v<T, StringData>) {
+            if (type() != mongo::String)
+                return boost::none;
+            return valueStringData();
+        } else if constexpr (std::is_same_v<T, BSONObj>) {
+            if (type() != mongo::Object)
+                return boost::none;
+            return embeddedObject();
+        } else if constexpr (std::is_same_v<T, Date_t>) {
+            if (type() != mongo::Date)
+                return boost::none;
+            return date();
+        } else if constexpr (std::is_same_v<T, Timestamp>) {
+            if (type() != mongo::bsonTimestamp)
+                return boost::none;
+            return timestamp();
+        } else if constexpr (std::is_same_v<T, OID>) {
+            if (type() != mongo::jstOID)
+                return boost::none;
+            return __oid();
+        } else {
+            static_assert(!sizeof(T), "unsupported type for BSONElement::tryGetValue()");
+        }
+    }
+
     /**
      * Retrieve decimal value for the element safely.
      */
@@ -450,5 +450,36 @@ TEST(BSONElementTryCoeceToLongLongTest, CoerceFails) {
         ASSERT_NOT_OK(result) << " for input document " << testCase.toString();
     }
 }
+
+TEST(BSONElementTryGetValue, ExactTypeMatchSucceeds) {
+    auto obj = BSON("i" << 42 << "l" << 42LL << "d" << 1.5 << "s"
+                        << "str"
+                        << "b" << true << "o" << BSON("x" << 1) << "date" << Date_t::fromMillisSinceEpoch(100)
+                        << "ts" << Timestamp(1, 2));
+
+    ASSERT_EQ(*obj["i"].tryGetValue<int>(), 42);
+    ASSERT_EQ(*obj["l"].tryGetValue<long long>(), 42LL);
+    ASSERT_EQ(*obj["d"].tryGetValue<double>(), 1.5);
+    ASSERT_EQ(*obj["s"].tryGetValue<StringData>(), "str");
+    ASSERT_EQ(*obj["b"].tryGetValue<bool>(), true);
+    ASSERT_BSONOBJ_EQ(*obj["o"].tryGetValue<BSONObj>(), BSON("x" << 1));
+    ASSERT_EQ(*obj["date"].tryGetValue<Date_t>(), Date_t::fromMillisSinceEpoch(100));
+    ASSERT_EQ(*obj["ts"].tryGetValue<Timestamp>(), Timestamp(1, 2));
+}
+
+TEST(BSONElementTryGetValue, TypeMismatchAndMissingReturnNone) {
+    auto obj = BSON("i" << 42 << "s"
+                        << "str");
+
+    // No numeric coercion: an int32 does not extract as long long or double.
+    ASSERT_FALSE(obj["i"].tryGetValue<long long>());
+    ASSERT_FALSE(obj["i"].tryGetValue<double>());
+    ASSERT_FALSE(obj["i"].tryGetValue<StringData>());
+    ASSERT_FALSE(obj["s"].tryGetValue<int>());
+
+    // Missing field (EOO element).
+    ASSERT_FALSE(obj["missing"].tryGetValue<int>());
+    ASSERT_FALSE(obj["missing"].tryGetValue<BSONObj>());
+}
 }  // namespace
 }  // namespace mongo
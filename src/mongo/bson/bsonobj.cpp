@@ -427,6 +427,15 @@ int BSONObj::woCompare(const BSONObj& r,
                        const BSONObj& idxKey,
                        ComparisonRulesSet rules,
                        const StringDataComparator* comparator) const {
+    // Identical buffers compare equal under any rules when there is no collation: element order,
+    // field names, and values are all byte-for-byte the same. memcmp compares a word at a time
+    // and bails at the first difference, so this costs little for distinct objects (sort inputs
+    // typically diverge early in the buffer) while letting the sorter and in-memory SORT stages
+    // skip the per-element type dispatch entirely for equal keys.
+    if (comparator == nullptr && objsize() == r.objsize() &&
+        memcmp(objdata(), r.objdata(), objsize()) == 0)
+        return 0;
+
     return (rules & ComparisonRules::kIgnoreFieldOrder)
         ? compareObjects<BSONObjIteratorSorted>(*this, r, idxKey, rules, comparator)
         : compareObjects<BSONObjIterator>(*this, r, idxKey, rules, comparator);
@@ -0,0 +1,93 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+/**
+ * A lazily-built field-name-to-offset index over a BSONObj, for callers that extract many fields
+ * from the same (typically wide) document. BSONObj::getField() is a linear scan from the start of
+ * the object; a consumer touching k fields of an n-field document pays O(k*n). This class keeps
+ * the linear scan for small objects and switches to a one-time indexing pass plus O(1) hash
+ * lookups once the object is large enough for the index build to pay for itself.
+ *
+ * The index stores offsets into the BSONObj's buffer, so the BSONObj must remain valid (and
+ * unchanged) for the lifetime of this object. For duplicate field names the first occurrence is
+ * returned, matching BSONObj::getField().
+ */
+class BSONObjFieldIndex {
+public:
+    // Documents below this size are cheaper to re-scan than to index. Chosen from the same ingest
+    // profiles that motivated FieldNameBloomFilter: wide documents start winning around 100
+    // fields, which is roughly 2KB at typical field sizes.
+    static constexpr int kIndexThresholdBytes = 2048;
+
+    explicit BSONObjFieldIndex(const BSONObj& obj) : _obj(obj) {}
+
+    /**
+     * Equivalent to _obj.getField(name), but O(1) after the first lookup on large objects.
+     */
+    BSONElement getField(StringData name) {
+        if (MONGO_likely(_obj.objsize() < kIndexThresholdBytes))
+            return _obj.getField(name);
+        if (!_built)
+            _build();
+        auto it = _offsets.find(name);
+        if (it == _offsets.end())
+            return BSONElement();
+        return BSONElement(_obj.objdata() + it->second);
+    }
+
+    BSONElement operator[](StringData name) {
+        return getField(name);
+    }
+
+private:
+    void _build() {
+        for (auto&& elem : _obj) {
+            // try_emplace keeps the first occurrence of duplicate field names.
+            _offsets.try_emplace(elem.fieldNameStringData(),
+                                 static_cast<uint32_t>(elem.rawdata() - _obj.objdata()));
+        }
+        _built = true;
+    }
+
+    BSONObj _obj;
+    StringMap<uint32_t> _offsets;
+    bool _built = false;
+};
+
+}  // namespace mongo
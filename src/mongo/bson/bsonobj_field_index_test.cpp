@@ -0,0 +1,81 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/bson/bsonobj_field_index.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(BSONObjFieldIndex, SmallObjectUsesLinearScan) {
+    BSONObj obj = BSON("a" << 1 << "b" << "two" << "c" << 3.0);
+    ASSERT_LT(obj.objsize(), BSONObjFieldIndex::kIndexThresholdBytes);
+    BSONObjFieldIndex index(obj);
+    ASSERT_EQ(index.getField("a").numberInt(), 1);
+    ASSERT_EQ(index.getField("b").String(), "two");
+    ASSERT_EQ(index.getField("c").numberDouble(), 3.0);
+    ASSERT_TRUE(index.getField("missing").eoo());
+}
+
+TEST(BSONObjFieldIndex, WideObjectMatchesGetField) {
+    BSONObjBuilder bob;
+    for (int i = 0; i < 200; ++i)
+        bob.append("field" + std::to_string(i), i);
+    BSONObj obj = bob.obj();
+    ASSERT_GTE(obj.objsize(), BSONObjFieldIndex::kIndexThresholdBytes);
+
+    BSONObjFieldIndex index(obj);
+    for (int i = 0; i < 200; ++i) {
+        auto name = "field" + std::to_string(i);
+        ASSERT_EQ(index.getField(name).numberInt(), obj.getField(name).numberInt());
+    }
+    ASSERT_TRUE(index.getField("field200").eoo());
+    ASSERT_TRUE(index.getField("").eoo());
+}
+
+TEST(BSONObjFieldIndex, DuplicateFieldsReturnFirstOccurrence) {
+    BSONObjBuilder bob;
+    const std::string payload(32, 'x');
+    for (int i = 0; i < 100; ++i)
+        bob.append("pad" + std::to_string(i), payload);
+    bob.append("dup", 1);
+    bob.append("dup", 2);
+    BSONObj obj = bob.obj();
+    ASSERT_GTE(obj.objsize(), BSONObjFieldIndex::kIndexThresholdBytes);
+
+    BSONObjFieldIndex index(obj);
+    ASSERT_EQ(index.getField("dup").numberInt(), 1);
+    ASSERT_EQ(index.getField("dup").numberInt(), obj.getField("dup").numberInt());
+}
+
+}  // namespace
+}  // namespace mongo
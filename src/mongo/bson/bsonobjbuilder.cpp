@@ -235,6 +235,7 @@ bool BSONObjBuilderBase<Derived, B>::hasField(StringData name) const {
 // Explicit instantiations
 template class BSONObjBuilderBase<BSONObjBuilder, BufBuilder>;
 template class BSONObjBuilderBase<UniqueBSONObjBuilder, UniqueBufBuilder>;
+template class BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder>;
 template class BSONObjBuilderBase<allocator_aware::BSONObjBuilder<std::allocator<void>>,
                                   allocator_aware::BufBuilder<std::allocator<void>>>;
 template class BSONObjBuilderBase<allocator_aware::BSONObjBuilder<tracking::Allocator<void>>,
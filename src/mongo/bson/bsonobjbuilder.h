@@ -962,6 +962,63 @@ private:
     }
 };
 
+// The following forward declaration exists to enable the extern declaration, which must come
+// before the use of the matching instantiation of the base class of PooledBSONObjBuilder. Do not
+// remove or re-order these lines w.r.t BSONObjBuilderBase or PooledBSONObjBuilder without being
+// sure that you are not undoing the advantages of the extern template declaration.
+class PooledBSONObjBuilder;
+extern template class BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder>;
+
+/**
+ * Alternative to BSONObjBuilder which carves its buffer out of a SharedBufferFragmentBuilder
+ * arena rather than allocating per document. Intended for hot paths that build many documents in
+ * a row (e.g. the write path or reply building), where the arena is owned by the surrounding
+ * operation and released wholesale when the operation completes.
+ *
+ * Only one top-level PooledBSONObjBuilder may be building into a given fragment builder at a
+ * time; sub-object and sub-array builders share the parent's buffer as usual. The BSONObj
+ * returned by done() points into the arena, so it must not outlive the fragment builder.
+ */
+class PooledBSONObjBuilder : public BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder> {
+private:
+    using Super = BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder>;
+    friend Super;
+
+public:
+    explicit PooledBSONObjBuilder(SharedBufferFragmentBuilder& fragmentBuilder)
+        : Super(Super::kDefaultSize, fragmentBuilder) {}
+
+    PooledBSONObjBuilder(int initsize, SharedBufferFragmentBuilder& fragmentBuilder)
+        : Super(initsize, fragmentBuilder) {}
+
+    PooledBSONObjBuilder(PooledBSONObjBuilder&&) = default;
+    PooledBSONObjBuilder(const PooledBSONObjBuilder&) = delete;
+    PooledBSONObjBuilder& operator=(const PooledBSONObjBuilder&) = delete;
+
+    ~PooledBSONObjBuilder() {
+        Super::_destruct();
+    }
+
+    /**
+     * Finishes building and returns the completed fragment. The fragment keeps the underlying
+     * arena block alive, so the contained BSONObj remains valid as long as the fragment does.
+     */
+    SharedBufferFragment finish() {
+        _done();
+        return _buf.done();
+    }
+
+private:
+    // Compile-time "virtual" which must be provided to satisfy the base class.
+    void doDone() {
+        // Intentionally left empty.
+    }
+
+    void doResetToEmpty() {
+        // Intentionally left empty.
+    }
+};
+
 /**
  * Base class for building BSON arrays. Similar to BSONObjBuilderBase.
  */
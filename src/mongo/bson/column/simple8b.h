@@ -37,6 +37,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <vector>
 
 #include "mongo/base/data_type_endian.h"
 #include "mongo/base/data_view.h"
@@ -399,6 +400,21 @@ T sum(const char* buffer, size_t size, uint64_t& prevNonRLE);
  */
 template <typename T>
 T prefixSum(const char* buffer, size_t size, T& prefix, uint64_t& prevNonRLE);
+
+/**
+ * Decodes multiple Simple8b blocks into contiguous output arrays in a single pass, for block
+ * processing consumers that want typed batches rather than per-element iteration. One entry is
+ * appended to 'values' per position (0 for missing positions) and one flag is appended to
+ * 'present' per position (1 if a value is present, 0 if missing), keeping the two arrays
+ * parallel. 'prevNonRLE' should be initialized to 'kSingleSkip' for the first buffer and passed
+ * along between calls spanning multiple buffers. Returns the number of positions decoded.
+ */
+template <typename T>
+size_t decodeAll(const char* buffer,
+                 size_t size,
+                 uint64_t& prevNonRLE,
+                 std::vector<T>& values,
+                 std::vector<char>& present);
 }  // namespace simple8b
 
 }  // namespace mongo
@@ -1247,4 +1247,33 @@ T prefixSum(const char* buffer, size_t size, T& prefix, uint64_t& prevNonRLE) {
     return sum;
 }
 
+template <typename T>
+size_t decodeAll(const char* buffer,
+                 size_t size,
+                 uint64_t& prevNonRLE,
+                 std::vector<T>& values,
+                 std::vector<char>& present) {
+    invariant(size % 8 == 0);
+    // Reserve for the common case of one full batch; count() is a cheap header-only scan.
+    auto numElements = count(buffer, size);
+    values.reserve(values.size() + numElements);
+    present.reserve(present.size() + numElements);
+    return visitAll<T>(
+        buffer,
+        size,
+        prevNonRLE,
+        [&](T v) {
+            values.push_back(v);
+            present.push_back(1);
+        },
+        [&]() {
+            values.push_back(0);
+            present.push_back(1);
+        },
+        [&]() {
+            values.push_back(0);
+            present.push_back(0);
+        });
+}
+
 }  // namespace mongo::simple8b
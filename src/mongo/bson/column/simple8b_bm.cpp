@@ -191,6 +191,28 @@ void BM_decode(benchmark::State& state) {
     state.SetBytesProcessed(totalBytes);
 }
 
+void BM_decodeAll(benchmark::State& state) {
+    BufBuilder buffer = generateIntegers();
+    auto size = buffer.len();
+    auto buf = buffer.release();
+
+    size_t totalBytes = 0;
+    std::vector<int64_t> values;
+    std::vector<char> present;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        values.clear();
+        present.clear();
+        uint64_t prev = simple8b::kSingleSkip;
+        benchmark::DoNotOptimize(
+            simple8b::decodeAll<int64_t>(buf.get(), size, prev, values, present));
+        totalBytes += size;
+    }
+
+    state.SetBytesProcessed(totalBytes);
+}
+
 void BM_sum(benchmark::State& state) {
     BufBuilder buffer = generateIntegers();
     auto size = buffer.len();
@@ -288,6 +310,7 @@ BENCHMARK(BM_changingSmallValues)->Arg(100);
 BENCHMARK(BM_changingLargeValues)->Arg(100);
 BENCHMARK(BM_selectorSeven)->Arg(100);
 BENCHMARK(BM_decode);
+BENCHMARK(BM_decodeAll);
 BENCHMARK(BM_sum);
 BENCHMARK(BM_sumUnoptimized);
 BENCHMARK(BM_prefixSum);
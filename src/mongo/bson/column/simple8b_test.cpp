@@ -176,6 +176,29 @@ void testSimple8b(const std::vector<boost::optional<T>>& expectedValues,
         else
             ASSERT_EQ(boost::none, decodedValues[i]);
     }
+
+    // Test decodeAll
+    std::vector<make_signed_t<T>> blockValues;
+    std::vector<char> blockPresent;
+
+    prev = 0xE;
+    size_t decodeCount =
+        simple8b::decodeAll<make_signed_t<T>>(reinterpret_cast<const char*>(expectedBinary.data()),
+                                              expectedBinary.size(),
+                                              prev,
+                                              blockValues,
+                                              blockPresent);
+    ASSERT_EQ(expectedValues.size(), decodeCount);
+    ASSERT_EQ(expectedValues.size(), blockValues.size());
+    ASSERT_EQ(expectedValues.size(), blockPresent.size());
+    for (size_t i = 0; i < expectedValues.size(); ++i) {
+        if (expectedValues[i]) {
+            ASSERT_EQ(1, blockPresent[i]);
+            ASSERT_EQ(Simple8bTypeUtil::decodeInt(*(expectedValues[i])), blockValues[i]);
+        } else {
+            ASSERT_EQ(0, blockPresent[i]);
+        }
+    }
 }
 
 template <typename T>
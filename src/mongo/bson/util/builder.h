@@ -680,6 +680,9 @@ public:
     PooledFragmentBuilder(SharedBufferFragmentBuilder& fragmentBuilder)
         : BasicBufBuilder(fragmentBuilder.start(0)) {}
 
+    PooledFragmentBuilder(int initsize, SharedBufferFragmentBuilder& fragmentBuilder)
+        : BasicBufBuilder(fragmentBuilder.start(initsize)) {}
+
     SharedBufferFragment done() {
         return _buf.finish(len());
     }
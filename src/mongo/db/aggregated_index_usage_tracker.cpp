@@ -145,7 +145,7 @@ AggregatedIndexUsageTracker* AggregatedIndexUsageTracker::get(ServiceContext* sv
 void AggregatedIndexUsageTracker::onAccess(const IndexFeatures& features) const {
     if (!features.internal) {
         _updateStatsForEachFeature(features, _indexTypeStats, _featureStats, [](auto& stats) {
-            stats.accesses.fetchAndAdd(1);
+            stats.accesses.incrementRelaxed();
         });
     }
 }
@@ -194,7 +194,7 @@ long long AggregatedIndexUsageTracker::getCount() const {
 void AggregatedIndexUsageTracker::resetToZero() {
     forEachFeature([](auto feature, const auto& constStats) {
         auto& stats = const_cast<IndexFeatureStats&>(constStats);
-        stats.accesses.store(0);
+        stats.accesses.setToZero();
         stats.count.store(0);
     });
     _count.store(0);
@@ -222,7 +222,7 @@ public:
             [&featuresBuilder](const std::string& feature, const IndexFeatureStats& stats) {
                 BSONObjBuilder featureBuilder = featuresBuilder.subobjStart(feature);
                 featureBuilder.append("count", stats.count.loadRelaxed());
-                featureBuilder.append("accesses", stats.accesses.loadRelaxed());
+                featureBuilder.append("accesses", stats.accesses.get());
                 featureBuilder.done();
             });
         featuresBuilder.done();
@@ -33,6 +33,7 @@
 #include <map>
 #include <string>
 
+#include "mongo/base/counter.h"
 #include "mongo/db/index_names.h"
 #include "mongo/platform/atomic_word.h"
 
@@ -69,10 +70,13 @@ struct IndexFeatures {
  * atomics to allow itself to be used in a const map safely.
  */
 struct IndexFeatureStats {
-    // Number of indexes that have this feature.
+    // Number of indexes that have this feature. Only updated on index creation and removal, so a
+    // plain atomic suffices.
     mutable AtomicWord<long long> count{0};
-    // Number of operations that have used indexes with this feature.
-    mutable AtomicWord<long long> accesses{0};
+    // Number of operations that have used indexes with this feature. Bumped by every query that
+    // uses an index, so the counter is striped to avoid cache-line contention across query
+    // threads.
+    mutable StripedCounter64 accesses;
 };
 
 enum class FeatureStatType {
@@ -889,10 +889,28 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
                        (user->getName().tenantId() != rp.tenantId()))) {
         return unmetRequirements.empty();
     }
-    return std::any_of(search.cbegin(), search.cend(), [&](const auto& pattern) {
-        unmetRequirements.removeAllActionsFromSet(user->getActionsForResource(pattern));
+
+    if (auto it = _resolvedUserActions.find(rp); it != _resolvedUserActions.end()) {
+        unmetRequirements.removeAllActionsFromSet(it->second);
         return unmetRequirements.empty();
+    }
+
+    // Resolve the union of the user's actions across the pattern's search list once and memoize
+    // it, so that repeat checks against the same pattern cost a single lookup rather than one per
+    // matching pattern. The memo is discarded whenever the user state changes.
+    ActionSet userActions;
+    std::for_each(search.cbegin(), search.cend(), [&](const auto& pattern) {
+        userActions.addAllActionsFromSet(user->getActionsForResource(pattern));
     });
+
+    constexpr std::size_t kMaxResolvedUserActions = 512;
+    if (MONGO_unlikely(_resolvedUserActions.size() >= kMaxResolvedUserActions)) {
+        _resolvedUserActions.clear();
+    }
+    _resolvedUserActions.emplace(rp, userActions);
+
+    unmetRequirements.removeAllActionsFromSet(userActions);
+    return unmetRequirements.empty();
 }
 
 void AuthorizationSessionImpl::setImpersonatedUserData(const UserName& username,
@@ -1074,6 +1092,9 @@ void AuthorizationSessionImpl::verifyContract(const AuthorizationContract* contr
 }
 
 void AuthorizationSessionImpl::_updateInternalAuthorizationState() {
+    // The effective privileges may have changed, so resolved action sets must be recomputed.
+    _resolvedUserActions.clear();
+
     // Update the authenticated role names vector to reflect current state.
     _authenticatedRoleNames.clear();
     if (_authenticatedUser == boost::none) {
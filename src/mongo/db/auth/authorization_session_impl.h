@@ -56,6 +56,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/session/logical_session_id_gen.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/time_support.h"
 
@@ -183,7 +184,7 @@ protected:
     friend class AuthorizationSessionImplTestHelper;
 
     // Updates internal cached authorization state, i.e.:
-    // - _nonTenantClusterActions, see below.
+    // - _nonTenantClusterActions and _resolvedUserActions, see below.
     // - _authenticatedRoleNames, which stores all roles held by users who are authenticated on this
     // connection.
     // - _authenticationMode -- we just update this to None if there are no users on the connection.
@@ -242,6 +243,12 @@ private:
     // It is a union of ClusterResource and AnyResource permissions.
     ActionSet _nonTenantClusterActions;
 
+    // Memo of the authenticated user's effective actions for resource patterns this session has
+    // checked, unioned across each pattern's ResourcePatternSearchList. The user's privilege
+    // document is immutable once acquired, so entries remain valid until the user state changes
+    // and _updateInternalAuthorizationState() discards them.
+    stdx::unordered_map<ResourcePattern, ActionSet> _resolvedUserActions;
+
     // The expiration time for this session, expressed as a Unix timestamp. After this time passes,
     // the session will be expired and requests will fail until the expiration time is refreshed.
     // If boost::none, then the session never expires (default behavior).
@@ -31,6 +31,7 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/iterator/iterator_traits.hpp>
 #include <boost/none.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -56,15 +57,18 @@
 #include "mongo/db/auth/sasl_mechanism_registry.h"
 #include "mongo/db/auth/sasl_options.h"
 #include "mongo/db/auth/sasl_scram_server_conversation.h"
+#include "mongo/db/auth/user.h"
 #include "mongo/db/auth/user_name.h"
 #include "mongo/db/connection_health_metrics_parameter_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/random.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/base64.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/lru_cache.h"
 #include "mongo/util/read_through_cache.h"
 #include "mongo/util/sequence_util.h"
 #include "mongo/util/str.h"
@@ -73,6 +77,53 @@
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kAccessControl
 
 namespace mongo {
+namespace {
+
+/**
+ * Bounded LRU cache of server-side scram::Secrets decoded from stored user credentials.
+ *
+ * Every SCRAM conversation needs the user's stored and server keys base64-decoded into hash
+ * blocks. A reconnecting driver fleet replays handshakes for the same few users, so decode each
+ * credential set once and share the result between conversations (Secrets holds its key material
+ * behind a shared_ptr, so copies are cheap). Entries are keyed by the encoded key material
+ * itself: rotated credentials produce a different key and miss naturally, and stale entries for
+ * deleted users age out of the LRU. The cached material is the same server verification data
+ * the user cache already holds, so this introduces no new exposure.
+ */
+template <typename HashBlock>
+class ServerSecretsCache {
+public:
+    using SecretsType = scram::Secrets<HashBlock, scram::UnlockedSecretsPolicy>;
+
+    SecretsType acquire(const User::SCRAMCredentials<HashBlock>& creds) {
+        std::string key = creds.storedKey + creds.serverKey;
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            if (auto it = _cache.find(key); it != _cache.end()) {
+                return it->second;
+            }
+        }
+
+        SecretsType secrets("", base64::decode(creds.storedKey), base64::decode(creds.serverKey));
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _cache.add(std::move(key), secrets);
+        return secrets;
+    }
+
+private:
+    static constexpr std::size_t kMaxEntries = 256;
+
+    stdx::mutex _mutex;
+    LRUCache<std::string, SecretsType> _cache{kMaxEntries};
+};
+
+template <typename HashBlock>
+ServerSecretsCache<HashBlock>& serverSecretsCache() {
+    static auto& cache = *new ServerSecretsCache<HashBlock>();
+    return cache;
+}
+
+}  // namespace
 
 template <typename Policy>
 StatusWith<std::tuple<bool, std::string>> SaslSCRAMServerMechanism<Policy>::stepImpl(
@@ -269,18 +320,12 @@ StatusWith<std::tuple<bool, std::string>> SaslSCRAMServerMechanism<Policy>::_fir
         }
     }
 
-    _secrets.push_back(scram::Secrets<HashBlock, scram::UnlockedSecretsPolicy>(
-        "",
-        base64::decode(scramCredentials.storedKey),
-        base64::decode(scramCredentials.serverKey)));
+    _secrets.push_back(serverSecretsCache<HashBlock>().acquire(scramCredentials));
 
     if (userName == (*internalSecurity.getUser())->getName() &&
         internalSecurity.alternateCredentials) {
         auto altCredentials = internalSecurity.alternateCredentials->scram<HashBlock>();
-        _secrets.push_back(scram::Secrets<HashBlock, scram::UnlockedSecretsPolicy>(
-            "",
-            base64::decode(altCredentials.storedKey),
-            base64::decode(altCredentials.serverKey)));
+        _secrets.push_back(serverSecretsCache<HashBlock>().acquire(altCredentials));
     }
 
     // Generate server-first-message
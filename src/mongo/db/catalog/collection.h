@@ -217,6 +217,17 @@ public:
          * Note: this is shared state across cloned Collection instances
          */
         StatusWith<std::shared_ptr<MatchExpression>> filter = {nullptr};
+
+        /**
+         * A normalized copy of 'filter' used to match documents on the write path, where it is
+         * cheaper to walk. 'filter' retains its error annotations so that doc_validation_error
+         * can generate a detailed response when a document fails validation. Null whenever
+         * 'filter' is null or not OK, or if the normalized copy could not be produced; callers
+         * must fall back to 'filter' in that case.
+         *
+         * Note: this is shared state across cloned Collection instances
+         */
+        std::shared_ptr<MatchExpression> optimizedFilter;
     };
 
     Collection() = default;
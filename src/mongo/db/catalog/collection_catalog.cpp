@@ -1555,9 +1555,11 @@ void CollectionCatalog::onCloseCatalog() {
         return;
     }
 
-    _shadowCatalog.emplace();
+    immutable::unordered_map<UUID, NamespaceString, UUID::Hash> shadowCatalog;
+    auto writer = shadowCatalog.transient();
     for (auto& entry : _catalog)
-        _shadowCatalog->insert({entry.first, entry.second->ns()});
+        writer.set(entry.first, entry.second->ns());
+    _shadowCatalog.emplace(writer.persistent());
 }
 
 void CollectionCatalog::onOpenCatalog() {
@@ -1816,9 +1818,8 @@ boost::optional<NamespaceString> CollectionCatalog::_lookupNSSByUUID(OperationCo
     // using the pre-close state. This ensures that any tasks reloading the catalog can see their
     // own updates.
     if (_shadowCatalog) {
-        auto shadowIt = _shadowCatalog->find(uuid);
-        if (shadowIt != _shadowCatalog->end())
-            return shadowIt->second;
+        if (const NamespaceString* shadowNss = _shadowCatalog->find(uuid))
+            return *shadowNss;
     }
     return boost::none;
 }
@@ -2180,6 +2181,12 @@ boost::optional<ViewsForDatabase::Stats> CollectionCatalog::getViewStatsForDatab
     return viewsForDb ? boost::make_optional(viewsForDb->stats()) : boost::none;
 }
 
+std::shared_ptr<ViewsForDatabase::ResolvedViewsCache> CollectionCatalog::getResolvedViewsCache(
+    OperationContext* opCtx, const DatabaseName& dbName) const {
+    auto viewsForDb = _getViewsForDatabase(opCtx, dbName);
+    return viewsForDb ? viewsForDb->resolvedViewsCache() : nullptr;
+}
+
 CollectionCatalog::ViewCatalogSet CollectionCatalog::getViewCatalogDbNames(
     OperationContext* opCtx) const {
     ViewCatalogSet results;
@@ -610,6 +610,14 @@ public:
     boost::optional<ViewsForDatabase::Stats> getViewStatsForDatabase(
         OperationContext* opCtx, const DatabaseName& dbName) const;
 
+    /**
+     * Returns the resolved views cache for the specified database, or nullptr if the database has
+     * no view catalog. The cache belongs to the ViewsForDatabase instance visible to this
+     * operation and is replaced whenever the views of the database change.
+     */
+    std::shared_ptr<ViewsForDatabase::ResolvedViewsCache> getResolvedViewsCache(
+        OperationContext* opCtx, const DatabaseName& dbName) const;
+
     /**
      * Returns a set of databases, by name, that have view catalogs.
      */
@@ -858,7 +866,7 @@ private:
      * When present, indicates that the catalog is in closed state, and contains a map from UUID
      * to pre-close NSS. See also onCloseCatalog.
      */
-    boost::optional<mongo::stdx::unordered_map<UUID, NamespaceString, UUID::Hash>> _shadowCatalog;
+    boost::optional<immutable::unordered_map<UUID, NamespaceString, UUID::Hash>> _shadowCatalog;
 
     using CollectionCatalogMap =
         immutable::unordered_map<UUID, std::shared_ptr<Collection>, UUID::Hash>;
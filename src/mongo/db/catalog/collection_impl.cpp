@@ -646,8 +646,12 @@ std::pair<Collection::SchemaValidationResult, Status> CollectionImpl::checkValid
         return {SchemaValidationResult::kError, status};
     }
 
+    // Prefer the normalized copy of the validator expression for the match itself; the annotated
+    // original is only consulted to generate a detailed error when the document does not match.
+    const auto* const matchExprForCheck =
+        _validator.optimizedFilter ? _validator.optimizedFilter.get() : validatorMatchExpr;
     try {
-        if (exec::matcher::matchesBSON(validatorMatchExpr, document))
+        if (exec::matcher::matchesBSON(matchExprForCheck, document))
             return {SchemaValidationResult::kPass, Status::OK()};
     } catch (DBException&) {
     };
@@ -798,7 +802,21 @@ Collection::Validator CollectionImpl::parseValidator(
                 "Combined match expression",
                 "expression"_attr = combinedMatchExpr->serialize());
 
-    return Collection::Validator{validator, std::move(expCtx), std::move(combinedMatchExpr)};
+    // Match documents against a normalized copy of the expression, which is cheaper to walk, and
+    // keep the annotated original for error generation. This is best-effort: if the copy cannot
+    // be optimized, documents are matched against the annotated expression instead.
+    std::shared_ptr<MatchExpression> optimizedMatchExpr;
+    try {
+        optimizedMatchExpr = MatchExpression::optimize(combinedMatchExpr->clone(),
+                                                       /* enableSimplification */ false);
+    } catch (const DBException&) {
+        optimizedMatchExpr = nullptr;
+    }
+
+    return Collection::Validator{validator,
+                                 std::move(expCtx),
+                                 std::move(combinedMatchExpr),
+                                 std::move(optimizedMatchExpr)};
 }
 
 bool CollectionImpl::needsCappedLock() const {
@@ -1115,7 +1133,9 @@ std::vector<RecordId> CollectionImpl::reserveCappedRecordIds(OperationContext* o
     // in the process of committing uncommitted records.
     auto cappedObserver = getCappedVisibilityObserver();
     cappedObserver->registerWriter(shard_role_details::getRecoveryUnit(opCtx), [this]() {
-        _shared->_recordStore->capped()->notifyWaitersIfNeeded();
+        // The capped visibility system does not know the commit timestamp of the records that
+        // just became visible, so all waiters must wake.
+        _shared->_recordStore->capped()->notifyWaitersIfNeeded(boost::none);
     });
 
     std::vector<RecordId> ids;
@@ -188,6 +188,62 @@ TEST_F(CollectionTest, CappedNotifierWaitUntilAsynchronousNotifyAll) {
     ASSERT_EQ(notifier->getVersion(), thisVersion);
 }
 
+TEST_F(CollectionTest, CappedNotifierCollapsesNotificationsForSameCommit) {
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
+    makeCapped(nss);
+
+    AutoGetCollectionForRead acfr(operationContext(), nss);
+    const CollectionPtr& col = acfr.getCollection();
+    auto notifier = col->getRecordStore()->capped()->getInsertNotifier();
+    ASSERT_EQ(notifier->getVersion(), 0u);
+
+    // A commit may notify once per insert batch; repeats with the same commit timestamp collapse.
+    notifier->notifyAll(Timestamp(10, 1));
+    notifier->notifyAll(Timestamp(10, 1));
+    ASSERT_EQ(notifier->getVersion(), 1u);
+
+    // A different commit timestamp, or no timestamp at all, is a new notification.
+    notifier->notifyAll(Timestamp(10, 2));
+    ASSERT_EQ(notifier->getVersion(), 2u);
+    notifier->notifyAll();
+    notifier->notifyAll();
+    ASSERT_EQ(notifier->getVersion(), 4u);
+}
+
+TEST_F(CollectionTest, CappedNotifierWaitUntilSkipsAlreadyVisibleNotifications) {
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
+    makeCapped(nss);
+
+    AutoGetCollectionForRead acfr(operationContext(), nss);
+    const CollectionPtr& col = acfr.getCollection();
+    auto notifier = col->getRecordStore()->capped()->getInsertNotifier();
+    auto prevVersion = notifier->getVersion();
+
+    // The notified data was already visible at the waiter's read timestamp, so the wait should
+    // run to its deadline.
+    notifier->notifyAll(Timestamp(10, 1));
+    auto before = Date_t::now();
+    notifier->waitUntil(
+        operationContext(), prevVersion, before + Milliseconds(25), Timestamp(10, 1));
+    auto after = Date_t::now();
+    ASSERT_GTE(after - before, Milliseconds(25));
+
+    // Data committed beyond the waiter's read timestamp ends the wait immediately.
+    notifier->notifyAll(Timestamp(10, 2));
+    before = Date_t::now();
+    notifier->waitUntil(operationContext(), prevVersion, before + Seconds(25), Timestamp(10, 1));
+    after = Date_t::now();
+    ASSERT_LT(after - before, Seconds(25));
+
+    // An untimestamped notification must wake waiters regardless of their read timestamp.
+    notifier->notifyAll();
+    prevVersion = notifier->getVersion() - 1;
+    before = Date_t::now();
+    notifier->waitUntil(operationContext(), prevVersion, before + Seconds(25), Timestamp(10, 2));
+    after = Date_t::now();
+    ASSERT_LT(after - before, Seconds(25));
+}
+
 TEST_F(CollectionTest, CappedNotifierWaitUntilAsynchronousKill) {
     NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
     makeCapped(nss);
@@ -266,11 +322,11 @@ TEST_F(CollectionTest, NotifyCappedWaitersIfNeeded) {
 
     AutoGetCollectionForRead acfr(operationContext(), nss);
     const CollectionPtr& col = acfr.getCollection();
-    col->getRecordStore()->capped()->notifyWaitersIfNeeded();
+    col->getRecordStore()->capped()->notifyWaitersIfNeeded(boost::none);
     {
         auto notifier = col->getRecordStore()->capped()->getInsertNotifier();
         ASSERT_EQ(notifier->getVersion(), 0u);
-        col->getRecordStore()->capped()->notifyWaitersIfNeeded();
+        col->getRecordStore()->capped()->notifyWaitersIfNeeded(boost::none);
         ASSERT_EQ(notifier->getVersion(), 1u);
     }
 }
@@ -808,7 +864,7 @@ TEST_F(CatalogTestFixture, CappedDeleteRecord) {
     }
 
     ASSERT_EQUALS(1, coll->numRecords(operationContext()));
-    auto globalDeletesInitial = serviceOpCounters(ClusterRole::ShardServer).getDelete()->load();
+    auto globalDeletesInitial = serviceOpCounters(ClusterRole::ShardServer).getDelete();
 
     // Inserting the second document will remove the first one.
     {
@@ -817,7 +873,7 @@ TEST_F(CatalogTestFixture, CappedDeleteRecord) {
             operationContext(), coll, InsertStatement(secondDoc), &opDebug));
         wuow.commit();
     }
-    auto globalDeletesAfterInsert = serviceOpCounters(ClusterRole::ShardServer).getDelete()->load();
+    auto globalDeletesAfterInsert = serviceOpCounters(ClusterRole::ShardServer).getDelete();
     ASSERT_EQUALS(globalDeletesAfterInsert, globalDeletesInitial + 1);
 
     ASSERT_EQUALS(1, opDebug.additiveMetrics.keysDeleted.get_value_or(-1));
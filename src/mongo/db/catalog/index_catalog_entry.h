@@ -52,6 +52,7 @@ class IndexBuildInterceptor;
 class IndexDescriptor;
 class MatchExpression;
 class OperationContext;
+class PartialFilterProgram;
 class UpdateIndexData;
 
 class IndexCatalogEntry : public std::enable_shared_from_this<IndexCatalogEntry> {
@@ -81,6 +82,15 @@ public:
 
     virtual const MatchExpression* getFilterExpression() const = 0;
 
+    /**
+     * Returns the precompiled form of getFilterExpression() used on the write path, or nullptr
+     * when the filter is absent or falls outside the class of filters that can be compiled, in
+     * which case callers evaluate getFilterExpression() with the general matcher.
+     */
+    virtual const PartialFilterProgram* getCompiledFilter() const {
+        return nullptr;
+    }
+
     virtual const CollatorInterface* getCollator() const = 0;
 
     /**
@@ -136,6 +136,8 @@ IndexCatalogEntryImpl::IndexCatalogEntryImpl(OperationContext* const opCtx,
                                                      _shared->_expCtxForFilter,
                                                      ExtensionsCallbackNoop(),
                                                      MatchExpressionParser::kBanAllSpecialFeatures);
+        _shared->_compiledFilter =
+            PartialFilterProgram::tryCompile(_shared->_filterExpression.get());
         LOGV2_DEBUG(20350,
                     2,
                     "have filter expression for {namespace} {indexName} {filter}",
@@ -475,6 +477,10 @@ public:
         return _original->getFilterExpression();
     }
 
+    const PartialFilterProgram* getCompiledFilter() const final {
+        return _original->getCompiledFilter();
+    }
+
     const CollatorInterface* getCollator() const final {
         return _collator ? _collator.get() : _original->getCollator();
     }
@@ -601,6 +607,10 @@ public:
         return _original->getFilterExpression();
     }
 
+    const PartialFilterProgram* getCompiledFilter() const final {
+        return _original->getCompiledFilter();
+    }
+
     const CollatorInterface* getCollator() const final {
         return _original->getCollator();
     }
@@ -41,6 +41,7 @@
 #include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index/multikey_paths.h"
+#include "mongo/db/matcher/partial_filter_program.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/record_id.h"
@@ -106,6 +107,10 @@ public:
         return _shared->_filterExpression.get();
     }
 
+    const PartialFilterProgram* getCompiledFilter() const final {
+        return _shared->_compiledFilter.get();
+    }
+
     const CollatorInterface* getCollator() const final {
         return _shared->_collator.get();
     }
@@ -222,6 +227,10 @@ private:
         std::unique_ptr<CollatorInterface> _collator;
         std::unique_ptr<MatchExpression> _filterExpression;
 
+        // Flattened form of '_filterExpression' for fast evaluation on the write path; nullptr
+        // when the filter cannot be compiled.
+        std::unique_ptr<PartialFilterProgram> _compiledFilter;
+
         // Special ExpressionContext used to evaluate the partial filter expression.
         boost::intrusive_ptr<ExpressionContext> _expCtxForFilter;
 
@@ -71,6 +71,7 @@
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
+#include "mongo/db/matcher/partial_filter_program.h"
 #include "mongo/db/multi_key_path_tracker.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/expression_context.h"
@@ -1748,9 +1749,12 @@ Status IndexCatalogImpl::_indexRecords(OperationContext* opCtx,
     if (!filter)
         return _indexFilteredRecords(opCtx, coll, index, bsonRecords, keysInsertedOut);
 
+    const PartialFilterProgram* program = index->getCompiledFilter();
     std::vector<BsonRecord> filteredBsonRecords;
     for (const auto& bsonRecord : bsonRecords) {
-        if (exec::matcher::matchesBSON(filter, *(bsonRecord.docPtr)))
+        const bool matches = program ? program->matches(*(bsonRecord.docPtr))
+                                     : exec::matcher::matchesBSON(filter, *(bsonRecord.docPtr));
+        if (matches)
             filteredBsonRecords.push_back(bsonRecord);
     }
 
@@ -271,6 +271,13 @@ public:
             return *this->_partitioned->_partitions[_id];
         }
 
+        /**
+         * Returns the id of the locked partition.
+         */
+        PartitionId id() const {
+            return _id;
+        }
+
     private:
         friend class Partitioned;
 
@@ -85,7 +85,6 @@
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
-#include "mongo/util/shared_buffer_fragment.h"
 #include "mongo/util/str.h"
 #include "mongo/util/string_map.h"
 #include "mongo/util/time_support.h"
@@ -757,8 +756,6 @@ Status ValidateAdaptor::validateRecord(OperationContext* opCtx,
                                              results);
     }
 
-    SharedBufferFragmentBuilder pool(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
-
     for (const auto& indexIdent : _validateState->getIndexIdents()) {
         const IndexDescriptor* descriptor =
             coll->getIndexCatalog()->findIndexByIdent(opCtx, indexIdent);
@@ -796,6 +793,10 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
 
     RecordId prevRecordId;
 
+    // The progress meter is updated in batches: taking the Client lock once per record is
+    // measurable overhead on large collections, and the meter is only an approximation anyway.
+    int recordsSinceLastProgressUpdate = 0;
+
     // In case validation occurs twice and the progress meter persists after index traversal
     if (_progress.get(WithLock::withoutLock()) &&
         _progress.get(WithLock::withoutLock())->isActive()) {
@@ -825,10 +826,7 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
              traverseRecordStoreCursor->seekExact(opCtx, _validateState->getFirstRecordId());
          record;
          record = traverseRecordStoreCursor->next(opCtx)) {
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            _progress.get(lk)->hit();
-        }
+        ++recordsSinceLastProgressUpdate;
         ++_numRecords;
         auto dataSize = record->data.size();
         interruptIntervalNumBytes += dataSize;
@@ -969,6 +967,12 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
 
         if (_numRecords % IndexConsistency::kInterruptIntervalNumRecords == 0 ||
             interruptIntervalNumBytes >= kInterruptIntervalNumBytes) {
+            {
+                stdx::unique_lock<Client> lk(*opCtx->getClient());
+                _progress.get(lk)->hit(recordsSinceLastProgressUpdate);
+            }
+            recordsSinceLastProgressUpdate = 0;
+
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
             _validateState->yieldCursors(opCtx);
@@ -979,6 +983,11 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
         }
     }
 
+    if (recordsSinceLastProgressUpdate > 0) {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        _progress.get(lk)->hit(recordsSinceLastProgressUpdate);
+    }
+
     if (results->getNumRemovedCorruptRecords() > 0) {
         results->addWarning(str::stream() << "Removed " << results->getNumRemovedCorruptRecords()
                                           << " invalid documents.");
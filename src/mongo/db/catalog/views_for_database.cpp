@@ -97,6 +97,25 @@ StatusWith<std::unique_ptr<CollatorInterface>> parseCollator(OperationContext* o
 }
 }  // namespace
 
+boost::optional<ViewsForDatabase::CachedResolvedView> ViewsForDatabase::ResolvedViewsCache::lookup(
+    const NamespaceString& nss) const {
+    stdx::lock_guard lock(_mutex);
+    auto it = _map.find(nss);
+    if (it == _map.end()) {
+        return boost::none;
+    }
+    return it->second;
+}
+
+void ViewsForDatabase::ResolvedViewsCache::insert(const NamespaceString& nss,
+                                                  CachedResolvedView entry) {
+    stdx::lock_guard lock(_mutex);
+    if (_map.size() >= kMaxEntries && !_map.contains(nss)) {
+        return;
+    }
+    _map.insert_or_assign(nss, std::move(entry));
+}
+
 std::shared_ptr<const ViewDefinition> ViewsForDatabase::lookup(const NamespaceString& ns) const {
     auto it = _viewMap.find(ns.coll());
     return it != _viewMap.end() ? it->second : nullptr;
@@ -112,6 +131,7 @@ void ViewsForDatabase::iterate(
 }
 
 Status ViewsForDatabase::reload(OperationContext* opCtx, const CollectionPtr& systemViews) {
+    _invalidateResolvedViewsCache();
     _viewMap.clear();
     _valid = false;
     _viewGraphNeedsRefresh = true;
@@ -178,6 +198,7 @@ Status ViewsForDatabase::insert(OperationContext* opCtx,
                                 const PipelineValidatorFn& validatePipeline,
                                 const BSONObj& collator,
                                 Durability durability) {
+    _invalidateResolvedViewsCache();
     _valid = false;
 
     auto parsedCollator = parseCollator(opCtx, collator);
@@ -220,6 +241,7 @@ Status ViewsForDatabase::update(OperationContext* opCtx,
                                 const BSONArray& pipeline,
                                 const PipelineValidatorFn& validatePipeline,
                                 std::unique_ptr<CollatorInterface> collator) {
+    _invalidateResolvedViewsCache();
     _valid = false;
 
     auto view = std::make_shared<ViewDefinition>(
@@ -376,6 +398,7 @@ void ViewsForDatabase::remove(OperationContext* opCtx,
     dassert(
         shard_role_details::getLocker(opCtx)->isCollectionLockedForMode(systemViews->ns(), MODE_X));
 
+    _invalidateResolvedViewsCache();
     _viewGraph.remove(ns);
     _viewMap.erase(ns.coll());
     _stats = {};
@@ -401,6 +424,7 @@ void ViewsForDatabase::clear(OperationContext* opCtx) {
             opCtx->getClient(), view->name(), view->viewOn(), view->pipeline(), ErrorCodes::OK);
     }
 
+    _invalidateResolvedViewsCache();
     _viewMap.clear();
     _viewGraph.clear();
     _valid = true;
@@ -408,6 +432,10 @@ void ViewsForDatabase::clear(OperationContext* opCtx) {
     _stats = {};
 }
 
+void ViewsForDatabase::_invalidateResolvedViewsCache() {
+    _resolvedViewsCache = std::make_shared<ResolvedViewsCache>();
+}
+
 Status ViewsForDatabase::_validateCollation(OperationContext* opCtx,
                                             const ViewDefinition& view,
                                             const std::vector<NamespaceString>& refs) const {
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
+
 #include <functional>
 #include <memory>
 #include <vector>
@@ -43,6 +45,7 @@
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/views/view.h"
 #include "mongo/db/views/view_graph.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/string_map.h"
@@ -75,6 +78,36 @@ public:
         kAlreadyDurable,
     };
 
+    /**
+     * A fully resolved view pipeline, stored as the plain BSON building blocks of a ResolvedView
+     * so this header does not depend on the aggregation layer.
+     */
+    struct CachedResolvedView {
+        NamespaceString resolvedNss;
+        std::vector<BSONObj> pipeline;
+        BSONObj collation;
+        std::vector<NamespaceString> dependencyChain;
+    };
+
+    /**
+     * Thread-safe cache of resolved view pipelines, keyed by the queried view namespace. The cache
+     * is shared by all catalog snapshots holding the same ViewsForDatabase instance and is replaced
+     * with an empty one whenever the views of the database change, so entries can never outlive
+     * the view definitions they were resolved from. Bounded in size; inserts beyond the bound are
+     * discarded.
+     */
+    class ResolvedViewsCache {
+    public:
+        boost::optional<CachedResolvedView> lookup(const NamespaceString& nss) const;
+        void insert(const NamespaceString& nss, CachedResolvedView entry);
+
+    private:
+        static constexpr size_t kMaxEntries = 1000;
+
+        mutable stdx::mutex _mutex;
+        stdx::unordered_map<NamespaceString, CachedResolvedView> _map;
+    };
+
     bool valid() const {
         return _valid;
     }
@@ -85,6 +118,10 @@ public:
 
     std::shared_ptr<const ViewDefinition> lookup(const NamespaceString& ns) const;
 
+    const std::shared_ptr<ResolvedViewsCache>& resolvedViewsCache() const {
+        return _resolvedViewsCache;
+    }
+
     void iterate(const std::function<bool(const ViewDefinition& view)>& callback) const;
 
     /**
@@ -147,9 +184,19 @@ private:
                               const ViewDefinition& view,
                               const std::vector<NamespaceString>& refs) const;
 
+    /**
+     * Replaces the resolved views cache with an empty one. Must be called by every mutation so
+     * that catalog snapshots sharing the previous cache instance keep serving their own,
+     * still-consistent entries.
+     */
+    void _invalidateResolvedViewsCache();
+
     StringMap<std::shared_ptr<ViewDefinition>> _viewMap;
     ViewGraph _viewGraph;
 
+    std::shared_ptr<ResolvedViewsCache> _resolvedViewsCache =
+        std::make_shared<ResolvedViewsCache>();
+
     bool _valid = false;
     bool _viewGraphNeedsRefresh = true;
 
@@ -31,12 +31,15 @@
 #include "mongo/db/admission/execution_admission_context.h"
 #include "mongo/db/change_stream_pre_image_util.h"
 #include "mongo/db/change_stream_pre_images_truncate_markers_per_nsUUID.h"
+#include "mongo/db/client.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/shard_role.h"
 #include "mongo/db/storage/collection_truncate_markers.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/concurrent_shared_values_map.h"
 #include "mongo/util/time_support.h"
 
@@ -66,6 +69,57 @@ auto acquirePreImagesCollectionForWrite(OperationContext* opCtx, NamespaceString
         MODE_IX);
 }
 
+// Runs 'workerFn(opCtx, preImagesCollection, workerId)' for each worker id in [0, 'numWorkers')
+// across a pool of worker threads. Each worker runs with its own operation context and its own
+// acquisition of the pre-images collection, so each worker reads from its own snapshot. Throws the
+// first error encountered by any worker, if any.
+void runMarkerInitializationWorkers(
+    const NamespaceString& preImagesCollectionNss,
+    const UUID& preImagesCollectionUUID,
+    size_t numWorkers,
+    std::function<void(OperationContext*, const CollectionAcquisition&, size_t)> workerFn) {
+    ThreadPool::Options options;
+    options.poolName = "PreImagesTruncateMarkersInitializer";
+    options.minThreads = 0;
+    options.maxThreads = numWorkers;
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName, getGlobalServiceContext()->getService());
+    };
+    ThreadPool pool(options);
+    pool.startup();
+
+    stdx::mutex firstErrorMutex;
+    Status firstError = Status::OK();
+    for (size_t workerId = 0; workerId < numWorkers; workerId++) {
+        pool.schedule([&, workerId](Status scheduleStatus) {
+            try {
+                uassertStatusOK(scheduleStatus);
+                auto opCtx = cc().makeOperationContext();
+
+                // Match the relaxed constraints of the thread driving the initialization (see
+                // PreImagesTruncateManager::_getInitializedMarkersForPreImagesCollection).
+                opCtx->setEnforceConstraints(false);
+
+                // Acquiring by UUID throws NamespaceNotFound if the pre-images collection was
+                // dropped concurrently, which surfaces as the initialization's error.
+                const auto preImagesCollection = acquirePreImagesCollectionForRead(
+                    opCtx.get(),
+                    NamespaceStringOrUUID{preImagesCollectionNss.dbName(),
+                                          preImagesCollectionUUID});
+                workerFn(opCtx.get(), preImagesCollection, workerId);
+            } catch (const DBException& ex) {
+                stdx::lock_guard<stdx::mutex> lk(firstErrorMutex);
+                if (firstError.isOK()) {
+                    firstError = ex.toStatus();
+                }
+            }
+        });
+    }
+    pool.shutdown();
+    pool.join();
+    uassertStatusOK(firstError);
+}
+
 // Truncate ranges must be consistent data - no record within a truncate range should be written
 // after the truncate. Otherwise, the data viewed by an open change stream could be corrupted,
 // only seeing part of the range post truncate. The node can either be a secondary or primary at
@@ -253,31 +307,22 @@ stdx::unordered_map<UUID, RecordIdAndWallTime, UUID::Hash> sampleLastRecordPerNs
     return lastRecords;
 }
 
-stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash> collectPreImageSamples(
+namespace {
+// Draws 'numRandomSamples' random samples from the pre-images collection and appends them to
+// 'samples'. 'targetNumSamples' is the overall sampling target, used only for progress reporting.
+void collectRandomSamples(
     OperationContext* opCtx,
     const CollectionAcquisition& preImagesCollection,
-    int64_t targetNumSamples) {
-    const auto nsUUIDLastRecords = sampleLastRecordPerNsUUID(opCtx, preImagesCollection);
-
-    stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash> samples;
-    for (const auto& [uuid, ridAndWall] : nsUUIDLastRecords) {
-        // Ensure 'samples' capture the last record of each nsUUID.
-        samples.emplace(uuid, std::vector<RecordIdAndWallTime>{ridAndWall});
-    }
-
-    const int64_t numLastRecords = nsUUIDLastRecords.size();
-    const int64_t numRandomSamples = targetNumSamples - numLastRecords;
-    if (numRandomSamples <= 0) {
-        return samples;
-    }
-
+    int64_t numRandomSamples,
+    int64_t targetNumSamples,
+    stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash>& samples) {
     auto exec = InternalPlanner::sampleCollection(
         opCtx, preImagesCollection, PlanYieldPolicy::YieldPolicy::YIELD_AUTO);
     Timer lastProgressTimer;
     const auto samplingLogIntervalSeconds = gCollectionSamplingLogIntervalSeconds.load();
     BSONObj preImageObj;
     RecordId rId;
-    for (int i = 0; i < numRandomSamples; i++) {
+    for (int64_t i = 0; i < numRandomSamples; i++) {
         if (exec->getNext(&preImageObj, &rId) == PlanExecutor::IS_EOF) {
             // This really shouldn't happen unless the collection is empty and the size storer was
             // really off on its collection size estimate.
@@ -296,6 +341,62 @@ stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash> collectP
             lastProgressTimer.reset();
         }
     }
+}
+}  // namespace
+
+stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash> collectPreImageSamples(
+    OperationContext* opCtx,
+    const CollectionAcquisition& preImagesCollection,
+    int64_t targetNumSamples) {
+    const auto nsUUIDLastRecords = sampleLastRecordPerNsUUID(opCtx, preImagesCollection);
+
+    stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash> samples;
+    for (const auto& [uuid, ridAndWall] : nsUUIDLastRecords) {
+        // Ensure 'samples' capture the last record of each nsUUID.
+        samples.emplace(uuid, std::vector<RecordIdAndWallTime>{ridAndWall});
+    }
+
+    const int64_t numLastRecords = nsUUIDLastRecords.size();
+    const int64_t numRandomSamples = targetNumSamples - numLastRecords;
+    if (numRandomSamples <= 0) {
+        return samples;
+    }
+
+    const auto numWorkers = std::min<int64_t>(gPreImagesTruncateMarkersInitializationMaxThreads,
+                                              numRandomSamples);
+    if (numWorkers <= 1) {
+        collectRandomSamples(
+            opCtx, preImagesCollection, numRandomSamples, targetNumSamples, samples);
+    } else {
+        // Split the random samples across workers, each drawing from its own sample executor and
+        // snapshot, and merge the per-worker results afterwards. Random samples are independent
+        // of each other, so the merged result is equivalent to a serial pass.
+        std::vector<stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash>>
+            workerSamples(numWorkers);
+        runMarkerInitializationWorkers(
+            preImagesCollection.nss(),
+            preImagesCollection.uuid(),
+            numWorkers,
+            [&](OperationContext* workerOpCtx,
+                const CollectionAcquisition& workerPreImagesCollection,
+                size_t workerId) {
+                const auto numWorkerSamples = numRandomSamples / numWorkers +
+                    (static_cast<int64_t>(workerId) < numRandomSamples % numWorkers ? 1 : 0);
+                collectRandomSamples(workerOpCtx,
+                                     workerPreImagesCollection,
+                                     numWorkerSamples,
+                                     targetNumSamples,
+                                     workerSamples[workerId]);
+            });
+        for (auto& workerMap : workerSamples) {
+            for (auto& [uuid, nsUUIDSamples] : workerMap) {
+                auto& mergedNsUUIDSamples = samples[uuid];
+                mergedNsUUIDSamples.insert(mergedNsUUIDSamples.end(),
+                                           std::make_move_iterator(nsUUIDSamples.begin()),
+                                           std::make_move_iterator(nsUUIDSamples.end()));
+            }
+        }
+    }
 
     // Order each sample.
     for (auto& [_, samplesPerNsUUID] : samples) {
@@ -315,13 +416,46 @@ void populateByScanning(
     int32_t minBytesPerMarker,
     ConcurrentSharedValuesMap<UUID, PreImagesTruncateMarkersPerNsUUID, UUID::Hash>& markersMap) {
     const auto nsUUIDs = change_stream_pre_image_util::getNsUUIDs(opCtx, preImagesCollection);
-    for (const auto& nsUUID : nsUUIDs) {
-        auto initialSetOfMarkers = PreImagesTruncateMarkersPerNsUUID::createInitialMarkersScanning(
-            opCtx, preImagesCollection, nsUUID, minBytesPerMarker);
 
-        markersMap.getOrEmplace(
-            nsUUID, tenantId, nsUUID, std::move(initialSetOfMarkers), minBytesPerMarker);
+    const auto numWorkers = std::min(
+        static_cast<size_t>(gPreImagesTruncateMarkersInitializationMaxThreads), nsUUIDs.size());
+    if (numWorkers <= 1) {
+        for (const auto& nsUUID : nsUUIDs) {
+            auto initialSetOfMarkers =
+                PreImagesTruncateMarkersPerNsUUID::createInitialMarkersScanning(
+                    opCtx, preImagesCollection, nsUUID, minBytesPerMarker);
+
+            markersMap.getOrEmplace(
+                nsUUID, tenantId, nsUUID, std::move(initialSetOfMarkers), minBytesPerMarker);
+        }
+        return;
     }
+
+    // Distribute the nsUUID ranges across workers, each scanning its ranges with its own snapshot.
+    // As with the serial scan, only pre-images visible in the scanning thread's snapshot are
+    // guaranteed to be covered; a later refresh accounts for records inserted while the markers
+    // were built.
+    std::vector<std::vector<UUID>> nsUUIDsPerWorker(numWorkers);
+    size_t nextWorker = 0;
+    for (const auto& nsUUID : nsUUIDs) {
+        nsUUIDsPerWorker[nextWorker++ % numWorkers].push_back(nsUUID);
+    }
+    runMarkerInitializationWorkers(
+        preImagesCollection.nss(),
+        preImagesCollection.uuid(),
+        numWorkers,
+        [&](OperationContext* workerOpCtx,
+            const CollectionAcquisition& workerPreImagesCollection,
+            size_t workerId) {
+            for (const auto& nsUUID : nsUUIDsPerWorker[workerId]) {
+                auto initialSetOfMarkers =
+                    PreImagesTruncateMarkersPerNsUUID::createInitialMarkersScanning(
+                        workerOpCtx, workerPreImagesCollection, nsUUID, minBytesPerMarker);
+
+                markersMap.getOrEmplace(
+                    nsUUID, tenantId, nsUUID, std::move(initialSetOfMarkers), minBytesPerMarker);
+            }
+        });
 }
 
 void populateBySampling(
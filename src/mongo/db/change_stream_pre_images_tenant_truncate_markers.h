@@ -65,6 +65,9 @@ stdx::unordered_map<UUID, RecordIdAndWallTime, UUID::Hash> sampleLastRecordPerNs
  * Returns 'targetNumSamples', sorted by RecordId and mapped by 'nsUUID', with 2 exceptions
  * - (a) The collection is empty: No samples are returned.
  * - (b) There are more 'nsUUID's than 'targetNumSamples': 1 sample per nsUUID is returned.
+ *
+ * Random samples may be gathered in parallel, bounded by
+ * 'preImagesTruncateMarkersInitializationMaxThreads'.
  */
 stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash> collectPreImageSamples(
     OperationContext* opCtx,
@@ -72,7 +75,8 @@ stdx::unordered_map<UUID, std::vector<RecordIdAndWallTime>, UUID::Hash> collectP
     int64_t targetNumSamples);
 
 /**
- * Populates the 'markersMap' by scanning the pre-images collection.
+ * Populates the 'markersMap' by scanning the pre-images collection. Distinct nsUUID ranges may be
+ * scanned in parallel, bounded by 'preImagesTruncateMarkersInitializationMaxThreads'.
  */
 void populateByScanning(
     OperationContext* opCtx,
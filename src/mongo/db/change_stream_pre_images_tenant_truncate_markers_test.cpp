@@ -317,5 +317,36 @@ TEST_F(PreImageMarkerInitializationTest, PopulateMapWithSinglePreImage) {
     }
 }
 
+// Populating by scanning distributes the nsUUID ranges across parallel workers when the collection
+// captures pre-images for more than 1 nsUUID.
+TEST_F(PreImageMarkerInitializationTest, PopulateByScanningMultipleNsUUIDs) {
+    auto opCtx = operationContext();
+    createPreImagesCollection(opCtx, kTenantId);
+
+    // 2 pre-images for 'kNsUUID', 2 pre-images for 'kNsUUIDOther'.
+    insertDirectlyToPreImagesCollection(opCtx, kTenantId, kPreImage1);
+    insertDirectlyToPreImagesCollection(opCtx, kTenantId, kPreImage2);
+    insertDirectlyToPreImagesCollection(opCtx, kTenantId, kPreImageOtherMin);
+    insertDirectlyToPreImagesCollection(opCtx, kTenantId, kPreImageOther);
+
+    ConcurrentSharedValuesMap<UUID, PreImagesTruncateMarkersPerNsUUID, UUID::Hash> mapByScan;
+    auto preImagesCollection = acquirePreImagesCollectionForRead(opCtx, kTenantId);
+    pre_image_marker_initialization_internal::populateByScanning(
+        opCtx, kTenantId, preImagesCollection, 1 /* minBytesPerMarker */, mapByScan);
+
+    const auto mapSnapshot = mapByScan.getUnderlyingSnapshot();
+    ASSERT_EQ(2, mapSnapshot->size());
+
+    const std::vector<std::pair<UUID, ChangeStreamPreImage>> expectedTrackedPreImages{
+        {kNsUUID, kPreImage2}, {kNsUUIDOther, kPreImageOther}};
+    for (const auto& [nsUUID, expectedPreImage] : expectedTrackedPreImages) {
+        auto it = mapSnapshot->find(nsUUID);
+        ASSERT(it != mapSnapshot->end());
+        auto perNsUUIDMarkers = it->second;
+        ASSERT_FALSE(perNsUUIDMarkers->isEmpty());
+        ASSERT_TRUE(activelyTrackingPreImage(*perNsUUIDMarkers, expectedPreImage));
+    }
+}
+
 }  // namespace
 }  // namespace mongo
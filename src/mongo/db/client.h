@@ -158,14 +158,16 @@ public:
      * Overwrites the Service for this client. To be used by the replica set endpoint only.
      */
     Service* setService(Service* service) {
-        return _service = service;
+        _service.store(service);
+        return service;
     }
 
     /**
-     * Returns the Service that owns this client.
+     * Returns the Service that owns this client. May be read without holding the client lock,
+     * e.g. to filter clients during enumeration without blocking their operation threads.
      */
     Service* getService() const {
-        return _service;
+        return _service.loadRelaxed();
     }
 
     /**
@@ -397,7 +399,9 @@ private:
      */
     void _setOperationContext(OperationContext* opCtx);
 
-    Service* _service;
+    // Atomic so that client enumeration can filter on service membership without taking the
+    // client lock. Only rebound by the owning thread (see setService).
+    AtomicWord<Service*> _service;
 
     const std::shared_ptr<transport::Session> _session;
 
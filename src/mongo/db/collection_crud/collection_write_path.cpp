@@ -490,9 +490,9 @@ Status insertDocumentForBulkLoader(OperationContext* opCtx,
     // CollectionPtr is just a front to the collection and its lifetime is shorter
     shard_role_details::getRecoveryUnit(opCtx)->onCommit(
         [capped = collection->getRecordStore()->capped()](OperationContext*,
-                                                          boost::optional<Timestamp>) {
+                                                          boost::optional<Timestamp> commitTime) {
             if (capped) {
-                capped->notifyWaitersIfNeeded();
+                capped->notifyWaitersIfNeeded(commitTime);
             }
         });
 
@@ -554,9 +554,9 @@ Status insertDocuments(OperationContext* opCtx,
     // CollectionPtr is just a front to the collection and its lifetime is shorter
     shard_role_details::getRecoveryUnit(opCtx)->onCommit(
         [capped = collection->getRecordStore()->capped()](OperationContext*,
-                                                          boost::optional<Timestamp>) {
+                                                          boost::optional<Timestamp> commitTime) {
             if (capped) {
-                capped->notifyWaitersIfNeeded();
+                capped->notifyWaitersIfNeeded(commitTime);
             }
         });
 
@@ -69,17 +69,17 @@ void CollectionIndexUsageTracker::recordIndexAccess(StringData indexName) const
     _aggregatedIndexUsageTracker->onAccess(it->second->features);
 
     // Increment the index usage atomic counter.
-    it->second->accesses.fetchAndAdd(1);
+    it->second->accesses.incrementRelaxed();
 }
 
 void CollectionIndexUsageTracker::recordCollectionScans(unsigned long long collectionScans) const {
-    _sharedStats->_collectionScans.fetchAndAdd(collectionScans);
+    _sharedStats->_collectionScans.incrementRelaxed(collectionScans);
     collectionScansCounter.increment(collectionScans);
 }
 
 void CollectionIndexUsageTracker::recordCollectionScansNonTailable(
     unsigned long long collectionScansNonTailable) const {
-    _sharedStats->_collectionScansNonTailable.fetchAndAdd(collectionScansNonTailable);
+    _sharedStats->_collectionScansNonTailable.incrementRelaxed(collectionScansNonTailable);
     collectionScansNonTailableCounter.increment(collectionScansNonTailable);
 }
 
@@ -132,7 +132,7 @@ CollectionIndexUsageTracker::getUsageStats() const {
 
 CollectionIndexUsageTracker::CollectionScanStats
 CollectionIndexUsageTracker::getCollectionScanStats() const {
-    return {_sharedStats->_collectionScans.load(),
-            _sharedStats->_collectionScansNonTailable.load()};
+    return {static_cast<unsigned long long>(_sharedStats->_collectionScans.get()),
+            static_cast<unsigned long long>(_sharedStats->_collectionScansNonTailable.get())};
 }
 }  // namespace mongo
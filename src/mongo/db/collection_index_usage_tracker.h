@@ -33,6 +33,7 @@
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <memory>
 
+#include "mongo/base/counter.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/aggregated_index_usage_tracker.h"
@@ -62,10 +63,12 @@ class CollectionIndexUsageTracker
     // intrusive_ref_counter is copyable while RefCountable is move-only.
     : public boost::intrusive_ref_counter<CollectionIndexUsageTracker> {
 
-    // Statistics that are shared among versions of the same logical collection.
+    // Statistics that are shared among versions of the same logical collection. Bumped by every
+    // operation that scans the collection, so the counters are striped to avoid cache-line
+    // contention across query threads on hot collections.
     struct CollectionScanStatsStorage : public RefCountable {
-        AtomicWord<unsigned long long> _collectionScans{0};
-        AtomicWord<unsigned long long> _collectionScansNonTailable{0};
+        StripedCounter64 _collectionScans;
+        StripedCounter64 _collectionScansNonTailable;
     };
 
 public:
@@ -79,22 +82,11 @@ public:
         explicit IndexUsageStats(Date_t now, const BSONObj& key, const IndexFeatures& idxFeatures)
             : trackerStartTime(now), indexKey(key.getOwned()), features(idxFeatures) {}
 
-        IndexUsageStats(const IndexUsageStats& other)
-            : accesses(other.accesses.load()),
-              trackerStartTime(other.trackerStartTime),
-              indexKey(other.indexKey),
-              features(other.features) {}
-
-        IndexUsageStats& operator=(const IndexUsageStats& other) {
-            accesses.store(other.accesses.load());
-            trackerStartTime = other.trackerStartTime;
-            indexKey = other.indexKey;
-            features = other.features;
-            return *this;
-        }
-
-        // Number of operations that have used this index.
-        AtomicWord<long long> accesses;
+        // Number of operations that have used this index. Bumped by every query whose winning
+        // plan uses the index, so the counter is striped to avoid cache-line contention across
+        // query threads. Entries are shared by pointer (see CollectionIndexUsageMap) and never
+        // copied.
+        StripedCounter64 accesses;
 
         // Date/Time that we started tracking index usage.
         Date_t trackerStartTime;
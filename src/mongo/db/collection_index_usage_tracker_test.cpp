@@ -89,7 +89,7 @@ TEST_F(CollectionIndexUsageTrackerTest, SingleHit) {
     getTracker()->recordIndexAccess("foo");
     const auto& statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.get());
 }
 
 // Test that recording of multiple index hits are reflected in stats map.
@@ -99,7 +99,7 @@ TEST_F(CollectionIndexUsageTrackerTest, MultipleHit) {
     getTracker()->recordIndexAccess("foo");
     const auto& statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.get());
 }
 
 // Test that an index is registered correctly with indexKey.
@@ -136,7 +136,7 @@ TEST_F(CollectionIndexUsageTrackerTest, HitAfterDeregister) {
     getTracker()->recordIndexAccess("foo");
     const auto& statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.get());
 
     getTracker()->unregisterIndex("foo");
     ASSERT(statsMap.find("foo") == statsMap.end());
@@ -144,7 +144,7 @@ TEST_F(CollectionIndexUsageTrackerTest, HitAfterDeregister) {
     getTracker()->registerIndex("foo", BSON("foo" << 1), {});
     getTracker()->recordIndexAccess("foo");
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.get());
 }
 
 // Test that index tracker start date/time is reset on index deregistration/registration.
@@ -257,9 +257,9 @@ TEST_F(CollectionIndexUsageTrackerTest, ExhaustiveFeatures) {
         getTracker()->recordIndexAccess(name);
         getAggregatedIndexUsage()->forEachFeature([&](auto f, auto& stats) {
             if (std::find(features.begin(), features.end(), f) != features.end()) {
-                ASSERT_EQ(1, stats.accesses.load()) << f << " in " << spec;
+                ASSERT_EQ(1, stats.accesses.get()) << f << " in " << spec;
             } else {
-                ASSERT_EQ(0, stats.accesses.load()) << f << " in " << spec;
+                ASSERT_EQ(0, stats.accesses.get()) << f << " in " << spec;
             }
         });
 
@@ -276,9 +276,9 @@ TEST_F(CollectionIndexUsageTrackerTest, ExhaustiveFeatures) {
 
         getAggregatedIndexUsage()->forEachFeature([&](auto f, auto& stats) {
             if (std::find(features.begin(), features.end(), f) != features.end()) {
-                ASSERT_EQ(1, stats.accesses.load()) << f << " in " << spec;
+                ASSERT_EQ(1, stats.accesses.get()) << f << " in " << spec;
             } else {
-                ASSERT_EQ(0, stats.accesses.load()) << f << " in " << spec;
+                ASSERT_EQ(0, stats.accesses.get()) << f << " in " << spec;
             }
         });
     }
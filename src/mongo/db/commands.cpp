@@ -35,6 +35,7 @@
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr.hpp>
 #include <fmt/format.h>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -1156,8 +1157,12 @@ void CommandRegistry::registerCommand(Command* command) {
     for (StringData key : aliases) {
         if (key.empty())
             continue;
-        auto [nIt, nOk] = _commandNames.try_emplace(key, command);
-        invariant(nOk, "Command name collision: {}"_format(key));
+        auto& bucket = _commandNames[static_cast<unsigned char>(key.front())];
+        invariant(std::none_of(bucket.begin(),
+                               bucket.end(),
+                               [&](const NameEntry& e) { return StringData{e.name} == key; }),
+                  "Command name collision: {}"_format(key));
+        bucket.push_back({std::string{key}, command});
     }
 }
 
@@ -1171,16 +1176,19 @@ boost::optional<ClusterRole> getRegistryRole(const CommandRegistry* reg) {
 }
 }  // namespace
 Command* CommandRegistry::findCommand(StringData name) const {
-    auto it = _commandNames.find(name);
-    if (it == _commandNames.end()) {
-        LOGV2_DEBUG(8097101,
-                    kFailedFindCommandDebugLevel,
-                    "Failed findCommand",
-                    "name"_attr = name,
-                    "registryRole"_attr = getRegistryRole(this));
-        return nullptr;
+    if (MONGO_likely(!name.empty())) {
+        const auto& bucket = _commandNames[static_cast<unsigned char>(name.front())];
+        for (const auto& entry : bucket) {
+            if (StringData{entry.name} == name)
+                return entry.command;
+        }
     }
-    return it->second;
+    LOGV2_DEBUG(8097101,
+                kFailedFindCommandDebugLevel,
+                "Failed findCommand",
+                "name"_attr = name,
+                "registryRole"_attr = getRegistryRole(this));
+    return nullptr;
 }
 
 CommandConstructionPlan& globalCommandConstructionPlan() {
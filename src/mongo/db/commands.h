@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <array>
 #include <cstddef>
 #include <fmt/format.h>
 #include <functional>
@@ -85,7 +86,6 @@
 #include "mongo/util/serialization_context.h"
 #include "mongo/util/static_immortal.h"
 #include "mongo/util/str.h"
-#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -1550,8 +1550,18 @@ private:
         Command* command;
     };
 
+    struct NameEntry {
+        std::string name;
+        Command* command;
+    };
+
     stdx::unordered_map<Command*, std::unique_ptr<Entry>> _commands;
-    StringMap<Command*> _commandNames;
+
+    // Command names are looked up on every request, so `findCommand` avoids string hashing
+    // entirely: names are dispatched on their first byte into small per-byte buckets that are
+    // scanned linearly. The registered command set is small enough that each bucket holds at most
+    // a handful of entries, and a length mismatch rejects a candidate without touching its bytes.
+    std::array<std::vector<NameEntry>, 256> _commandNames;
     std::function<void()> _onUnknown;
 };
 
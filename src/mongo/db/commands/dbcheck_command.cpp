@@ -100,6 +100,7 @@
 #include "mongo/util/fail_point.h"
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kCommand
 MONGO_FAIL_POINT_DEFINE(hangBeforeExtraIndexKeysCheck);
@@ -1749,6 +1750,9 @@ bool DbChecker::_shouldRetryDataConsistencyCheck(OperationContext* opCtx,
 // The initial amount of time to sleep between retries.
 const int64_t initialSleepMillis = 100;
 
+// The floor for the lag-adaptive batch size used by the data consistency check.
+const int64_t minAdaptiveDocsPerBatch = 64;
+
 void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
     const std::string curOpMessage = "Scanning namespace " +
         NamespaceStringUtil::serialize(_info.nss, SerializationContext::stateDefault());
@@ -1802,8 +1806,16 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
     numRetries = 0;
     sleepMillis = initialSleepMillis;
 
+    // The batch size starts at the configured maximum and adapts to the observed replication lag:
+    // when the secondaries take longer to acknowledge a batch than the batch took to produce, the
+    // next batch is halved, and once the write concern wait becomes negligible again the size
+    // creeps back up. This keeps pacing tied to what the replica set can currently absorb rather
+    // than to a fixed setting.
+    int64_t docsPerBatch = _info.maxDocsPerBatch;
+
     do {
-        auto result = _runBatch(opCtx, start);
+        Timer batchTimer;
+        auto result = _runBatch(opCtx, start, docsPerBatch);
         if (!result.isOK()) {
             if (!_shouldRetryDataConsistencyCheck(opCtx, result.getStatus(), numRetries)) {
                 // We should not retry. Return immediately
@@ -1824,6 +1836,7 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
         }
 
         const auto stats = result.getValue();
+        const auto batchMillis = batchTimer.millis();
         auto batchEnd = key_string::rehydrateKey(BSON("_id" << 1), stats.lastKey);
         auto entry = dbCheckBatchHealthLogEntry(_info.secondaryIndexCheckParameters,
                                                 stats.batchId,
@@ -1846,6 +1859,7 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
         }
 
         WriteConcernResult unused;
+        Timer writeConcernTimer;
         auto status = waitForWriteConcern(opCtx, stats.time, _info.writeConcern, &unused);
         if (!status.isOK()) {
             BSONObjBuilder context;
@@ -1865,6 +1879,15 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
             return;
         }
 
+        const auto writeConcernMillis = writeConcernTimer.millis();
+        if (writeConcernMillis > batchMillis) {
+            // The secondaries are falling behind; give them smaller batches to digest.
+            docsPerBatch = std::max(docsPerBatch / 2, minAdaptiveDocsPerBatch);
+        } else if (writeConcernMillis * 10 < batchMillis) {
+            // Replication is keeping up comfortably; work back toward the configured maximum.
+            docsPerBatch = std::min(docsPerBatch * 2, _info.maxDocsPerBatch);
+        }
+
         start = stats.lastKey;
 
         // Update our running totals.
@@ -1893,7 +1916,8 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
 }
 
 StatusWith<DbCheckCollectionBatchStats> DbChecker::_runBatch(OperationContext* opCtx,
-                                                             const BSONObj& first) {
+                                                             const BSONObj& first,
+                                                             int64_t docsPerBatch) {
     DbCheckCollectionBatchStats result;
     DbCheckOplogBatch batch;
     {
@@ -1930,7 +1954,7 @@ StatusWith<DbCheckCollectionBatchStats> DbChecker::_runBatch(OperationContext* o
                            _info.secondaryIndexCheckParameters,
                            &_info.dataThrottle,
                            boost::none,
-                           std::min(_info.maxDocsPerBatch, _info.maxCount),
+                           std::min(docsPerBatch, _info.maxCount),
                            _info.maxSize);
 
             const auto batchDeadline = Date_t::now() + Milliseconds(_info.maxBatchTimeMillis);
@@ -294,8 +294,13 @@ private:
      */
     void _dataConsistencyCheck(OperationContext* opCtx);
 
+    /**
+     * Hashes a single batch of up to 'docsPerBatch' documents starting at 'first'. The caller
+     * adapts 'docsPerBatch' between batches based on how well replication is keeping up.
+     */
     StatusWith<DbCheckCollectionBatchStats> _runBatch(OperationContext* opCtx,
-                                                      const BSONObj& first);
+                                                      const BSONObj& first,
+                                                      int64_t docsPerBatch);
 
     /**
      * Acquire the required locks for dbcheck to run on the given namespace.
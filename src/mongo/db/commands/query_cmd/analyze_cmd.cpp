@@ -58,6 +58,7 @@
 #include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/query/allowed_contexts.h"
 #include "mongo/db/query/analyze_command_gen.h"
+#include "mongo/db/query/cost_based_ranker/selectivity_estimate_cache.h"
 #include "mongo/db/query/query_feature_flags_gen.h"
 #include "mongo/db/query/stats/scalar_histogram.h"
 #include "mongo/db/query/stats/stats_catalog.h"
@@ -77,13 +78,15 @@ StatusWith<BSONObj> analyzeCommandAsAggregationCommand(OperationContext* opCtx,
                                                        StringData collection,
                                                        StringData keyPath,
                                                        boost::optional<double> sampleRate,
+                                                       boost::optional<int> sampleSize,
                                                        boost::optional<int> numBuckets) {
     // Build a pipeline that accomplishes the analyze request. The building code constructs a
     // pipeline that looks like this, assuming the analyze is on the key "a.b.c"
     //
     //      [
-    //          { $match: { $expr: {$lt: [{$rand: {}, sampleRate]} } }, // If sampleRate is
-    //          specified, otherwise this stage is omitted
+    //          { $sample: { size: sampleSize } }, // If sampleSize is specified; a $match on
+    //          $rand is used instead when sampleRate is specified, and both stages are omitted
+    //          when neither is
     //          { $project: { val : "$a.b.c" } },
     //          { $group: {
     //              _id: "a.b.c",
@@ -106,7 +109,12 @@ StatusWith<BSONObj> analyzeCommandAsAggregationCommand(OperationContext* opCtx,
 
     BSONArrayBuilder pipelineBuilder;
 
-    if (sampleRate) {
+    if (sampleSize) {
+        // Draw the sample with $sample, which can use a storage engine random cursor, instead of
+        // filtering a full collection scan on $rand. This makes the cost of the analyze
+        // proportional to the sample size rather than to the collection size.
+        pipelineBuilder << BSON("$sample" << BSON("size" << *sampleSize));
+    } else if (sampleRate) {
         pipelineBuilder << BSON(
             "$match" << BSON(
                 "$expr" << BSON("$lt" << BSON_ARRAY(BSON("$rand" << BSONObj()) << *sampleRate))));
@@ -197,11 +205,16 @@ public:
                         isNormalColl || isClusteredColl);
 
                 if (sampleSize) {
-                    auto numRecords = collection->numRecords(opCtx);
+                    const auto numRecords = collection->numRecords(opCtx);
                     if (numRecords == 0 || *sampleSize > numRecords) {
-                        sampleRate = 1.0;
+                        // The requested sample covers the whole collection; scan it in full.
+                        sampleSize = boost::none;
+                        sampleRate = boost::none;
                     } else {
-                        sampleRate = double(*sampleSize) / collection->numRecords(opCtx);
+                        // The documents themselves are drawn by a $sample stage; the rate is used
+                        // by the stats accumulator to scale the sampled frequencies back up to
+                        // collection-level estimates.
+                        sampleRate = double(*sampleSize) / numRecords;
                     }
                 }
             }
@@ -235,12 +248,15 @@ public:
 
                 // Run Aggregate
                 BSONObj analyzeResult;
-                client.runCommand(
-                    nss.dbName(),
-                    analyzeCommandAsAggregationCommand(
-                        opCtx, nss.coll(), key->toString(), sampleRate, cmd.getNumberBuckets())
-                        .getValue(),
-                    analyzeResult);
+                client.runCommand(nss.dbName(),
+                                  analyzeCommandAsAggregationCommand(opCtx,
+                                                                     nss.coll(),
+                                                                     key->toString(),
+                                                                     sampleRate,
+                                                                     sampleSize,
+                                                                     cmd.getNumberBuckets())
+                                      .getValue(),
+                                  analyzeResult);
 
                 // We must reset the internal flag.
                 if (!wasInternalClient) {
@@ -253,7 +269,13 @@ public:
                 stats::StatsCatalog& statsCatalog = stats::StatsCatalog::get(opCtx);
                 uassertStatusOK(statsCatalog.invalidatePath(nss, key->toString()));
 
-            } else if (sampleSize || sampleRate) {
+                // Selectivities derived from the replaced histograms are no longer valid either.
+                if (auto* estimateCache =
+                        cost_based_ranker::SelectivityEstimateCache::getIfEnabled()) {
+                    estimateCache->clear();
+                }
+
+            } else if (cmd.getSampleSize() || cmd.getSampleRate()) {
                 uassert(
                     6799706, "It is illegal to pass sampleRate or sampleSize without a key", key);
             }
@@ -175,9 +175,10 @@ public:
     }
 
     void addInsertReplies(OperationContext* opCtx,
-                          size_t firstOpIdx,
+                          const std::vector<size_t>& opIdxs,
                           write_ops_exec::WriteResult& writes) {
         invariant(!writes.results.empty());
+        invariant(writes.results.size() <= opIdxs.size());
 
         // Copy over retriedStmtIds.
         for (auto& stmtId : writes.retriedStmtIds) {
@@ -185,7 +186,7 @@ public:
         }
 
         for (size_t i = 0; i < writes.results.size(); ++i) {
-            auto idx = firstOpIdx + i;
+            auto idx = opIdxs[i];
             if (auto error = write_ops_exec::generateError(
                     opCtx, writes.results[i].getStatus(), idx, _summaryFields.nErrors)) {
                 auto replyItem = BulkWriteReplyItem(idx, error.get().getStatus());
@@ -371,16 +372,30 @@ bool aboveBulkWriteRepliesMaxSize(OperationContext* opCtx,
 }
 
 /*
- * InsertGrouper is a helper class to group consecutive insert operations for the same namespace in
- * a bulkWrite command.
+ * InsertGrouper is a helper class to group insert operations by namespace in a bulkWrite command.
+ *
+ * An ordered request may only group consecutive insert operations to the same namespace, so every
+ * namespace transition requires a flush. An unordered request makes no guarantee about the order
+ * in which its operations execute, so inserts to different namespaces are grouped across
+ * transitions and each namespace's group is flushed as a single batch. This amortizes collection
+ * acquisition and batch setup over a whole run of interleaved inserts instead of paying for them
+ * on every transition.
  */
 class InsertGrouper {
 public:
+    /*
+     * The operation indexes of grouped inserts targeting one namespace, in request order.
+     */
+    struct Group {
+        std::vector<size_t> opIdxs;
+    };
+
     InsertGrouper() = delete;
-    InsertGrouper(const BulkWriteCommandRequest& request) : _req(request) {}
+    InsertGrouper(const BulkWriteCommandRequest& request)
+        : _req(request), _groupAcrossNamespaces(!request.getOrdered()) {}
 
     bool isEmpty() const {
-        return !_firstOpIdx.has_value();
+        return _groups.empty();
     }
 
     /*
@@ -388,51 +403,59 @@ public:
      */
     bool group(const BulkWriteInsertOp* op, size_t currentOpIdx) {
         const auto& nsInfo = _req.getNsInfo();
-        auto nsIdx = op->getInsert();
-
-        if (!_firstOpIdx.has_value()) {
-            // First op in this group.
-            invariant(_numOps == 0);
-            _firstOpIdx = currentOpIdx;
-            _currentNs = nsInfo[nsIdx];
-            _numOps = 1;
-            return true;
+        const auto& nsEntry = nsInfo[op->getInsert()];
+
+        for (auto& group : _groups) {
+            const auto& groupNsEntry = _nsEntryForGroup(group);
+            if (!_isDifferentNamespace(groupNsEntry, nsEntry)) {
+                group.opIdxs.push_back(currentOpIdx);
+                return true;
+            }
         }
 
-        if (_isDifferentFromSavedNamespace(nsInfo[nsIdx])) {
-            // This should be in a new group after flush.
+        if (!_groups.empty() && !_groupAcrossNamespaces) {
+            // An ordered request must flush the current group before starting a new one.
             return false;
         }
 
-        _numOps += 1;
+        _groups.push_back(Group{{currentOpIdx}});
         return true;
     }
 
     /*
-     * Return (firstOpIdx, numOps) for the current insert group.
+     * Return the oldest insert group and remove it from the grouper.
      * This function should only be called when the InsertGrouper is not empty.
      */
-    std::pair<size_t, size_t> getGroupedInsertsAndReset() {
-        invariant(_firstOpIdx.has_value());
-        size_t firstOpIdx = _firstOpIdx.value();
-        size_t numOps = _numOps;
-
-        _currentNs = NamespaceInfoEntry();
-        _numOps = 0;
-        _firstOpIdx = boost::none;
+    Group popGroup() {
+        invariant(!_groups.empty());
+        Group group = std::move(_groups.front());
+        _groups.erase(_groups.begin());
+        return group;
+    }
 
-        return std::make_pair(firstOpIdx, numOps);
+    /*
+     * Drop any remaining groups without executing them, e.g. after a fatal error.
+     */
+    void clear() {
+        _groups.clear();
     }
 
 private:
     const BulkWriteCommandRequest& _req;
-    NamespaceInfoEntry _currentNs;
-    boost::optional<size_t> _firstOpIdx = boost::none;
-    size_t _numOps = 0;
+    std::vector<Group> _groups;
+    bool _groupAcrossNamespaces;
+
+    const NamespaceInfoEntry& _nsEntryForGroup(const Group& group) const {
+        auto op = BulkWriteCRUDOp(_req.getOps()[group.opIdxs.front()]);
+        auto insertOp = op.getInsert();
+        invariant(insertOp);
+        return _req.getNsInfo()[insertOp->getInsert()];
+    }
 
-    bool _isDifferentFromSavedNamespace(const NamespaceInfoEntry& newNs) const {
-        if (newNs.getNs() == _currentNs.getNs()) {
-            return newNs.getCollectionUUID() != _currentNs.getCollectionUUID();
+    static bool _isDifferentNamespace(const NamespaceInfoEntry& lhs,
+                                      const NamespaceInfoEntry& rhs) {
+        if (lhs.getNs() == rhs.getNs()) {
+            return lhs.getCollectionUUID() != rhs.getCollectionUUID();
         }
         return true;
     }
@@ -543,15 +566,13 @@ getRetryResultForUpdate(OperationContext* opCtx,
     return std::make_tuple(writeResult.getN(), writeResult.getNModified(), upserted);
 }
 
-std::vector<BSONObj> getConsecutiveInsertDocuments(const BulkWriteCommandRequest& req,
-                                                   size_t firstOpIdx,
-                                                   size_t numOps) {
+std::vector<BSONObj> getGroupedInsertDocuments(const BulkWriteCommandRequest& req,
+                                               const std::vector<size_t>& opIdxs) {
     std::vector<BSONObj> documents;
-    documents.reserve(numOps);
+    documents.reserve(opIdxs.size());
     const auto& ops = req.getOps();
 
-    for (size_t i = 0; i < numOps; i++) {
-        auto idx = firstOpIdx + i;
+    for (auto idx : opIdxs) {
         auto op = BulkWriteCRUDOp(ops[idx]);
         auto insertOp = op.getInsert();
         invariant(insertOp);
@@ -562,19 +583,16 @@ std::vector<BSONObj> getConsecutiveInsertDocuments(const BulkWriteCommandRequest
 }
 
 /*
- * Helper function to build an InsertCommandRequest for 'numOps' consecutive insert operations
- * starting from the 'firstOpIdx'-th operation in the bulkWrite request.
+ * Helper function to build an InsertCommandRequest for the grouped insert operations at the
+ * 'opIdxs' positions in the bulkWrite request.
  */
-write_ops::InsertCommandRequest getConsecutiveInsertRequest(const BulkWriteCommandRequest& req,
-                                                            size_t firstOpIdx,
-                                                            const std::vector<BSONObj>& docs,
-                                                            const NamespaceInfoEntry& nsInfoEntry) {
-    size_t numOps = docs.size();
-
+write_ops::InsertCommandRequest getGroupedInsertRequest(const BulkWriteCommandRequest& req,
+                                                        const std::vector<size_t>& opIdxs,
+                                                        const std::vector<BSONObj>& docs,
+                                                        const NamespaceInfoEntry& nsInfoEntry) {
     std::vector<std::int32_t> stmtIds;
-    stmtIds.reserve(numOps);
-    for (size_t i = 0; i < numOps; i++) {
-        auto idx = firstOpIdx + i;
+    stmtIds.reserve(opIdxs.size());
+    for (auto idx : opIdxs) {
         stmtIds.push_back(bulk_write_common::getStatementId(req, idx));
     }
 
@@ -629,7 +647,7 @@ void populateWriteResultWithInsertReply(size_t nDocsToInsert,
  */
 bool attemptGroupedFLEInserts(OperationContext* opCtx,
                               const BulkWriteCommandRequest& req,
-                              size_t firstOpIdx,
+                              const std::vector<size_t>& opIdxs,
                               const std::vector<BSONObj>& docs,
                               const NamespaceInfoEntry& nsInfoEntry,
                               write_ops_exec::WriteResult& out) {
@@ -638,7 +656,7 @@ bool attemptGroupedFLEInserts(OperationContext* opCtx,
     // For BulkWrite, re-entry is un-expected.
     invariant(!nsInfoEntry.getEncryptionInformation()->getCrudProcessed().value_or(false));
 
-    auto request = getConsecutiveInsertRequest(req, firstOpIdx, docs, nsInfoEntry);
+    auto request = getGroupedInsertRequest(req, opIdxs, docs, nsInfoEntry);
     write_ops::InsertCommandReply insertReply;
 
     FLEBatchResult batchResult = processFLEInsert(opCtx, request, &insertReply);
@@ -675,35 +693,32 @@ private:
  */
 void handleGroupedTimeseriesInserts(OperationContext* opCtx,
                                     const BulkWriteCommandRequest& req,
-                                    size_t firstOpIdx,
+                                    const std::vector<size_t>& opIdxs,
                                     const std::vector<BSONObj>& docs,
                                     const NamespaceInfoEntry& nsInfoEntry,
                                     CurOp* curOp,
                                     write_ops_exec::WriteResult& out) {
     size_t numOps = docs.size();
-    auto request = getConsecutiveInsertRequest(req, firstOpIdx, docs, nsInfoEntry);
+    auto request = getGroupedInsertRequest(req, opIdxs, docs, nsInfoEntry);
     auto insertReply = timeseries::write_ops::performTimeseriesWrites(opCtx, request, curOp);
     populateWriteResultWithInsertReply(numOps, req.getOrdered(), insertReply, out);
 }
 
 /*
- * Helper function to flush insert ops grouped by the insertGrouper.
+ * Helper function to flush one insert group produced by the insertGrouper.
  * Return true if we can continue with the rest of operations in the bulkWrite request.
  */
-bool handleGroupedInserts(OperationContext* opCtx,
-                          const BulkWriteCommandRequest& req,
-                          InsertGrouper& insertGrouper,
-                          write_ops_exec::LastOpFixer& lastOpFixer,
-                          BulkWriteReplies& responses) {
-    if (insertGrouper.isEmpty()) {
-        return true;
-    }
-    auto [firstOpIdx, numOps] = insertGrouper.getGroupedInsertsAndReset();
+bool handleInsertGroup(OperationContext* opCtx,
+                       const BulkWriteCommandRequest& req,
+                       const std::vector<size_t>& opIdxs,
+                       write_ops_exec::LastOpFixer& lastOpFixer,
+                       BulkWriteReplies& responses) {
+    const size_t numOps = opIdxs.size();
 
     const auto& nsInfo = req.getNsInfo();
     const auto& ops = req.getOps();
 
-    auto firstInsert = BulkWriteCRUDOp(ops[firstOpIdx]).getInsert();
+    auto firstInsert = BulkWriteCRUDOp(ops[opIdxs.front()]).getInsert();
     invariant(firstInsert);
 
     const auto nsIdx = firstInsert->getInsert();
@@ -713,7 +728,7 @@ bool handleGroupedInserts(OperationContext* opCtx,
     write_ops_exec::WriteResult out;
     out.results.reserve(numOps);
 
-    auto insertDocs = getConsecutiveInsertDocuments(req, firstOpIdx, numOps);
+    auto insertDocs = getGroupedInsertDocuments(req, opIdxs);
     invariant(insertDocs.size() == numOps);
 
     // Handle FLE inserts.
@@ -724,9 +739,9 @@ bool handleGroupedInserts(OperationContext* opCtx,
             CurOp::get(opCtx)->setShouldOmitDiagnosticInformation(lk, true);
         }
 
-        auto processed = attemptGroupedFLEInserts(opCtx, req, firstOpIdx, insertDocs, nsEntry, out);
+        auto processed = attemptGroupedFLEInserts(opCtx, req, opIdxs, insertDocs, nsEntry, out);
         if (processed) {
-            responses.addInsertReplies(opCtx, firstOpIdx, out);
+            responses.addInsertReplies(opCtx, opIdxs, out);
             return out.canContinue;
         }
         // Fallthrough to standard inserts.
@@ -756,9 +771,8 @@ bool handleGroupedInserts(OperationContext* opCtx,
     if (auto [isTimeseriesViewRequest, _] = timeseries::isTimeseriesViewRequest(opCtx, tsNs);
         isTimeseriesViewRequest) {
         try {
-            handleGroupedTimeseriesInserts(
-                opCtx, req, firstOpIdx, insertDocs, nsEntry, &curOp, out);
-            responses.addInsertReplies(opCtx, firstOpIdx, out);
+            handleGroupedTimeseriesInserts(opCtx, req, opIdxs, insertDocs, nsEntry, &curOp, out);
+            responses.addInsertReplies(opCtx, opIdxs, out);
             return out.canContinue;
         } catch (DBException& ex) {
             // Re-throw timeseries insert exceptions to be consistent with the insert command.
@@ -783,7 +797,7 @@ bool handleGroupedInserts(OperationContext* opCtx,
     for (size_t i = 0; i < numOps; i++) {
         const bool isLastDoc = (i == numOps - 1);
 
-        auto idx = firstOpIdx + i;
+        auto idx = opIdxs[i];
         auto& doc = insertDocs[i];
         bool containsDotsAndDollarsField = false;
 
@@ -861,10 +875,31 @@ bool handleGroupedInserts(OperationContext* opCtx,
     }
 
     invariant(batch.empty() && bytesInBatch == 0);
-    responses.addInsertReplies(opCtx, firstOpIdx, out);
+    responses.addInsertReplies(opCtx, opIdxs, out);
     return out.canContinue;
 }
 
+/*
+ * Helper function to flush all insert groups accumulated by the insertGrouper.
+ * Return true if we can continue with the rest of operations in the bulkWrite request.
+ */
+bool handleGroupedInserts(OperationContext* opCtx,
+                          const BulkWriteCommandRequest& req,
+                          InsertGrouper& insertGrouper,
+                          write_ops_exec::LastOpFixer& lastOpFixer,
+                          BulkWriteReplies& responses) {
+    while (!insertGrouper.isEmpty()) {
+        auto group = insertGrouper.popGroup();
+        if (!handleInsertGroup(opCtx, req, group.opIdxs, lastOpFixer, responses)) {
+            // A fatal error stops the whole request. Any groups that are still pending report no
+            // results, just like operations past the point of failure.
+            insertGrouper.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
 bool handleInsertOp(OperationContext* opCtx,
                     const BulkWriteInsertOp* op,
                     const BulkWriteCommandRequest& req,
@@ -1780,7 +1815,8 @@ BulkWriteReply performWrites(OperationContext* opCtx, const BulkWriteCommandRequ
     std::vector<int> validatedNamespaces = std::vector<int>();
     validatedNamespaces.assign(req.getNsInfo().size(), 0);
 
-    // Create an insertGrouper to group consecutive inserts to the same namespace.
+    // Create an insertGrouper to group inserts to the same namespace. Unordered requests group
+    // inserts by namespace across transitions; ordered requests only group consecutive inserts.
     auto insertGrouper = InsertGrouper(req);
 
     size_t idx = 0;
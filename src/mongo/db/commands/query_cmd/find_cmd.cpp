@@ -529,7 +529,8 @@ public:
                                                   &firstBatch,
                                                   &docUnitsReturned,
                                                   pbrt,
-                                                  failedToAppend});
+                                                  failedToAppend,
+                                                  batchSize});
 
             // Use the resume token generated by the last execution of the plan that didn't stash a
             // document, or the latest resume token if we hit EOF/the end of the batch.
@@ -81,6 +81,7 @@
 #include "mongo/db/query/find.h"
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/query/find_common.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/query/plan_explainer.h"
@@ -451,6 +452,76 @@ public:
             return false;
         }
 
+        /**
+         * Drains documents staged by the previous getMore on this cursor into 'nextBatch'. Returns
+         * whether the cursor should be saved, or boost::none if the caller should continue running
+         * the executor to fill the rest of the batch.
+         */
+        boost::optional<bool> drainPreFetchedBatch(
+            ClientCursor* cursor,
+            const size_t batchSize,
+            CursorResponseBuilder* nextBatch,
+            uint64_t* numResults,
+            ResourceConsumption::DocumentUnitCounter* docUnitsReturned) {
+            auto& staged = cursor->preFetchedBatch();
+
+            while (!staged.docs.empty() && *numResults < batchSize) {
+                auto& obj = staged.docs.front();
+                if (*numResults > 0 &&
+                    !FindCommon::haveSpaceForNext(obj, *numResults, nextBatch->bytesUsed())) {
+                    // The response is full; keep the remainder staged for the next getMore.
+                    return true;
+                }
+                nextBatch->append(obj);
+                docUnitsReturned->observeOne(obj.objsize());
+                staged.bytesBuffered -= obj.objsize();
+                staged.docs.pop_front();
+                ++*numResults;
+            }
+
+            if (!staged.docs.empty()) {
+                return true;
+            }
+
+            const bool exhausted = staged.exhausted;
+            cursor->clearPreFetchedBatch();
+            if (exhausted) {
+                // The executor hit EOF while staging; the cursor is done without running it again.
+                return false;
+            }
+            // The staged documents did not fill the batch; fall through to the executor.
+            return *numResults < batchSize ? boost::none : boost::make_optional(true);
+        }
+
+        /**
+         * Runs 'exec' past the end of the current response to stage up to 'batchSize' documents
+         * (bounded by the usual response byte budget) on the cursor for the next getMore. Staging
+         * happens while the executor is already restored and the storage snapshot is open, so the
+         * next getMore can be answered without continuing the query.
+         */
+        void stagePreFetchedBatch(ClientCursor* cursor, PlanExecutor* exec, size_t batchSize) {
+            ClientCursor::PreFetchedBatch staged;
+            BSONObj obj;
+
+            while (staged.docs.size() < batchSize) {
+                if (PlanExecutor::IS_EOF == exec->getNext(&obj, nullptr)) {
+                    staged.exhausted = true;
+                    break;
+                }
+                if (!staged.docs.empty() &&
+                    !FindCommon::haveSpaceForNext(obj, staged.docs.size(), staged.bytesBuffered)) {
+                    exec->stashResult(obj);
+                    break;
+                }
+                staged.bytesBuffered += obj.objsize();
+                staged.docs.push_back(obj.getOwned());
+            }
+
+            if (!staged.docs.empty() || staged.exhausted) {
+                cursor->stashPreFetchedBatch(std::move(staged));
+            }
+        }
+
         /**
          * Implements populating 'nextBatch' with up to 'batchSize' documents from the plan executor
          * 'exec'. Outputs the number of documents and relevant size statistics in 'numResults' and
@@ -468,22 +539,40 @@ public:
             size_t objSize;
             bool failedToAppend = false;
 
+            // Serve any documents staged by the previous getMore before running the executor.
+            if (cursor->hasPreFetchedBatch()) {
+                if (auto shouldSaveCursor = drainPreFetchedBatch(
+                        cursor, batchSize, nextBatch, numResults, docUnitsReturned)) {
+                    return *shouldSaveCursor;
+                }
+            }
+
             // Note that unlike in find, a batch size of 0 means there is no limit on the number of
             // documents, and we may choose to pre-allocate space for the batch after the first
             // object.
             if (PlanExecutor::ADVANCED == exec->getNext(&obj, nullptr)) {
-                // Reserve space based on the size of the first object. Note that we always
-                // allow the first object to be appended to the batch so we can make
-                // progress.
                 objSize = obj.objsize();
-                auto bytesToReserve =
-                    FindCommon::getBytesToReserveForGetMoreReply(isTailable, objSize, batchSize);
-                nextBatch->reserveReplyBuffer(bytesToReserve);
+                if (*numResults == 0) {
+                    // Reserve space based on the size of the first object. Note that we always
+                    // allow the first object to be appended to the batch so we can make
+                    // progress.
+                    auto bytesToReserve = FindCommon::getBytesToReserveForGetMoreReply(
+                        isTailable, objSize, batchSize);
+                    nextBatch->reserveReplyBuffer(bytesToReserve);
+                } else if (!FindCommon::haveSpaceForNext(
+                               obj, *numResults, nextBatch->bytesUsed())) {
+                    // Staged documents already consumed the response's byte budget. Stash the
+                    // document for the next getMore and report the resume token from before it
+                    // was produced.
+                    exec->stashResult(obj);
+                    nextBatch->setPostBatchResumeToken(pbrt);
+                    return shouldSaveCursorGetMore(exec, isTailable);
+                }
                 // Don't check document size here before appending, since we always want to make
                 // progress.
                 nextBatch->append(obj);
                 docUnitsReturned->observeOne(objSize);
-                *numResults = 1;
+                ++*numResults;
 
                 // As soon as we get a result, this operation no longer waits.
                 awaitDataState(opCtx).shouldWaitForInserts = false;
@@ -492,10 +581,10 @@ public:
                 // to the response.
                 pbrt = exec->getPostBatchResumeToken();
 
-                // We decrease the batch size by 1 to account for the document we just emitted via
-                // the first call to getNext() above.
+                // We decrease the batch size to account for the documents already emitted, i.e.
+                // the one from the first call to getNext() above and any pre-fetched documents.
                 *numResults += exec->getNextBatch(
-                    batchSize - 1,
+                    batchSize - *numResults,
                     FindCommon::BSONObjCursorAppender{false /* alwaysAcceptFirstDoc */,
                                                       exec,
                                                       nextBatch,
@@ -508,7 +597,22 @@ public:
             // document, or the latest resume token if we hit EOF/the end of the batch.
             nextBatch->setPostBatchResumeToken(failedToAppend ? pbrt
                                                               : exec->getPostBatchResumeToken());
-            return shouldSaveCursorGetMore(exec, isTailable);
+
+            const bool shouldSaveCursor = shouldSaveCursorGetMore(exec, isTailable);
+
+            // If enabled, continue the executor past the end of this response to stage the next
+            // batch on the cursor while the storage snapshot is still open, so that the next
+            // getMore can be answered from the staged buffer. Tailable and exhaust cursors are
+            // excluded (the former may wait for data, the latter are already pipelined), as are
+            // executors which report a resume token, since a token taken past the staged documents
+            // would not match the response.
+            if (shouldSaveCursor && !isTailable && !failedToAppend &&
+                internalQueryGetMorePrefetchNextBatch.load() && !opCtx->isExhaust() &&
+                !opCtx->inMultiDocumentTransaction() && !cursor->hasPreFetchedBatch() &&
+                exec->getPostBatchResumeToken().isEmpty()) {
+                stagePreFetchedBatch(cursor, exec, batchSize);
+            }
+            return shouldSaveCursor;
         }
 
         /**
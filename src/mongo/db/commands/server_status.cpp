@@ -28,18 +28,67 @@
  */
 #include "mongo/db/commands/server_status.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
 #include "mongo/base/string_data.h"
+#include "mongo/db/service_context.h"
+#include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
 
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kCommand
+
 namespace mongo {
 
 namespace {
 constexpr auto kTimingSection = "timing"_sd;
+
+// How often the periodic job wakes up to look for expired section caches.
+constexpr auto kCacheRefreshInterval = Seconds(1);
 }  // namespace
 
+void ServerStatusSection::refreshCache(OperationContext* opCtx) const {
+    const auto period = cachePeriod();
+    if (period <= Milliseconds{0})
+        return;
+    const auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+    stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
+    if (_cacheGeneratedAt != Date_t{} && now - _cacheGeneratedAt < period)
+        return;
+    _regenerateCache(lk, opCtx, BSONElement(), now);
+}
+
+void ServerStatusSection::_appendCached(OperationContext* opCtx,
+                                        const BSONElement& configElement,
+                                        BSONObjBuilder* result) const {
+    const auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+    stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
+    if (_cacheGeneratedAt == Date_t{} || now - _cacheGeneratedAt >= cachePeriod()) {
+        _regenerateCache(lk, opCtx, configElement, now);
+    }
+    if (!_cachedSection.isEmpty()) {
+        result->append(getSectionName(), _cachedSection);
+    }
+}
+
+void ServerStatusSection::_regenerateCache(WithLock,
+                                           OperationContext* opCtx,
+                                           const BSONElement& configElement,
+                                           Date_t now) const {
+    auto generated = generateSection(opCtx, configElement);
+    if (generated.isEmpty()) {
+        _cachedSection = BSONObj();
+    } else {
+        BSONObjBuilder bob;
+        bob.appendElements(generated);
+        bob.appendDate("asOf", now);
+        _cachedSection = bob.obj();
+    }
+    _cacheGeneratedAt = now;
+}
+
 ServerStatusSectionRegistry* ServerStatusSectionRegistry::instance() {
     static ServerStatusSectionRegistry instance;
     return &instance;
@@ -84,6 +133,46 @@ void ServerStatusSectionRegistry::addSection(std::unique_ptr<ServerStatusSection
         "Duplicate ServerStatusSection Registration with name {} and role {}"_format(name, role));
 }
 
+void ServerStatusSectionRegistry::startPeriodicRefresh(ServiceContext* serviceContext) {
+    stdx::lock_guard<stdx::mutex> lk(_refreshMutex);
+    if (_refreshJob)
+        return;
+
+    bool anyCached = std::any_of(_sections.begin(), _sections.end(), [](const auto& entry) {
+        return entry.second->cachePeriod() > Milliseconds{0};
+    });
+    if (!anyCached)
+        return;
+
+    auto periodicRunner = serviceContext->getPeriodicRunner();
+    if (!periodicRunner)
+        return;
+
+    PeriodicRunner::PeriodicJob job(
+        "refreshServerStatusSections",
+        [this](Client* client) {
+            auto opCtx = client->makeOperationContext();
+            for (auto&& [key, section] : _sections) {
+                if (section->cachePeriod() <= Milliseconds{0})
+                    continue;
+                try {
+                    section->refreshCache(opCtx.get());
+                } catch (const DBException& ex) {
+                    LOGV2_DEBUG(9876508,
+                                2,
+                                "Failed to refresh serverStatus section",
+                                "section"_attr = section->getSectionName(),
+                                "error"_attr = ex.toStatus());
+                }
+            }
+        },
+        kCacheRefreshInterval,
+        true /*isKillableByStepdown*/);
+
+    _refreshJob = periodicRunner->makeJob(std::move(job));
+    _refreshJob.start();
+}
+
 ServerStatusSectionRegistry::SectionMap::const_iterator ServerStatusSectionRegistry::begin() {
     _runCalled.store(true);
     return _sections.begin();
@@ -41,6 +41,11 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/periodic_runner.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -108,6 +113,19 @@ public:
         return Status::OK();
     }
 
+    /**
+     * Sections that are expensive to generate can override this to return a non-zero period.
+     * The output of generateSection is then cached for that long and reused across calls, with
+     * an explicit "asOf" timestamp appended so readers can tell the age of the data. A periodic
+     * job (see ServerStatusSectionRegistry::startPeriodicRefresh) regenerates expired caches
+     * off-thread, so steady-state serverStatus calls only pay for a snapshot copy. Requests
+     * that pass section-specific options (an object value for the section in the command)
+     * bypass the cache since the options may change the output.
+     */
+    virtual Milliseconds cachePeriod() const {
+        return Milliseconds{0};
+    }
+
     /**
      * actually generate the result
      *
@@ -130,20 +148,45 @@ public:
      * implement this.
      *
      * If you are doing something a bit more complicated, you can implement this and have
-     * full control over what gets included in the command result.
+     * full control over what gets included in the command result. Note that sections that
+     * override this forgo the caching provided by cachePeriod().
      */
     virtual void appendSection(OperationContext* opCtx,
                                const BSONElement& configElement,
                                BSONObjBuilder* result) const {
+        if (cachePeriod() > Milliseconds{0} && configElement.type() != BSONType::Object) {
+            _appendCached(opCtx, configElement, result);
+            return;
+        }
         const auto ret = generateSection(opCtx, configElement);
         if (ret.isEmpty())
             return;
         result->append(getSectionName(), ret);
     }
 
+    /**
+     * Regenerate the cached output if it has expired. Called on a schedule by the registry's
+     * periodic refresh job; a no-op for sections with a zero cachePeriod().
+     */
+    void refreshCache(OperationContext* opCtx) const;
+
 private:
+    void _appendCached(OperationContext* opCtx,
+                       const BSONElement& configElement,
+                       BSONObjBuilder* result) const;
+
+    void _regenerateCache(WithLock,
+                          OperationContext* opCtx,
+                          const BSONElement& configElement,
+                          Date_t now) const;
+
     const std::string _sectionName;
     const ClusterRole _role;
+
+    // Cache state for sections with a non-zero cachePeriod().
+    mutable stdx::mutex _cacheMutex;
+    mutable BSONObj _cachedSection;
+    mutable Date_t _cacheGeneratedAt;
 };
 
 /**
@@ -167,11 +210,22 @@ public:
 
     SectionMap::const_iterator end();
 
+    /**
+     * Starts a periodic job that regenerates the cache of any section with a non-zero
+     * cachePeriod() once it expires, so that steady-state serverStatus calls only copy a
+     * snapshot. Only the first call has any effect; a no-op when no section opts into caching
+     * or when `serviceContext` has no periodic runner (e.g. in unit tests).
+     */
+    void startPeriodicRefresh(ServiceContext* serviceContext);
+
 private:
     RoleTag getTagForRole(ClusterRole);
 
     Atomic<bool> _runCalled{false};
     SectionMap _sections;
+
+    stdx::mutex _refreshMutex;
+    PeriodicJobAnchor _refreshJob;
 };
 
 /**
@@ -153,6 +153,11 @@ public:
 
         // --- all sections
         auto registry = ServerStatusSectionRegistry::instance();
+
+        // Kick off the scheduled refresh of cacheable sections the first time serverStatus runs;
+        // subsequent calls are a cheap no-op.
+        registry->startPeriodicRefresh(service);
+
         for (auto i = registry->begin(); i != registry->end(); ++i) {
             auto& section = i->second;
 
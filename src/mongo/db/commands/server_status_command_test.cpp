@@ -33,8 +33,10 @@
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/service_context_test_fixture.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/clock_source_mock.h"
 
 
 namespace mongo {
@@ -111,5 +113,69 @@ DEATH_TEST(ServerStatusSectionRegistryTest,
     trySections({bothRoles, ClusterRole::RouterServer});
 }
 
+class CachedSection : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+    bool includeByDefault() const override {
+        return true;
+    }
+    Milliseconds cachePeriod() const override {
+        return Seconds(10);
+    }
+    BSONObj generateSection(OperationContext*, const BSONElement&) const final {
+        return BSON("generations" << ++_generations);
+    }
+
+private:
+    mutable long long _generations = 0;
+};
+
+class ServerStatusSectionCacheTest : public ClockSourceMockServiceContextTest {};
+
+TEST_F(ServerStatusSectionCacheTest, CachedSectionReusedUntilExpiry) {
+    auto opCtx = makeOperationContext();
+    CachedSection section("mock", ClusterRole::ShardServer);
+
+    auto append = [&] {
+        BSONObjBuilder bob;
+        section.appendSection(opCtx.get(), BSONElement(), &bob);
+        return bob.obj();
+    };
+
+    auto first = append();
+    ASSERT_EQ(first["mock"]["generations"].numberLong(), 1);
+    ASSERT_TRUE(first["mock"]["asOf"].ok());
+
+    // A second call within the period serves the cached copy.
+    ASSERT_EQ(append()["mock"]["generations"].numberLong(), 1);
+
+    // Passing section-specific options bypasses the cache.
+    auto config = BSON("mock" << BSON("verbose" << true));
+    BSONObjBuilder bob;
+    section.appendSection(opCtx.get(), config["mock"], &bob);
+    ASSERT_EQ(bob.obj()["mock"]["generations"].numberLong(), 2);
+
+    // Once the period elapses the cache is regenerated.
+    auto clock = dynamic_cast<ClockSourceMock*>(getServiceContext()->getFastClockSource());
+    clock->advance(Seconds(11));
+    ASSERT_EQ(append()["mock"]["generations"].numberLong(), 3);
+}
+
+TEST_F(ServerStatusSectionCacheTest, RefreshCacheOnlyRegeneratesWhenExpired) {
+    auto opCtx = makeOperationContext();
+    CachedSection section("mock", ClusterRole::ShardServer);
+
+    section.refreshCache(opCtx.get());
+    BSONObjBuilder bob;
+    section.appendSection(opCtx.get(), BSONElement(), &bob);
+    ASSERT_EQ(bob.obj()["mock"]["generations"].numberLong(), 1);
+
+    // Still fresh: a refresh is a no-op.
+    section.refreshCache(opCtx.get());
+    BSONObjBuilder bob2;
+    section.appendSection(opCtx.get(), BSONElement(), &bob2);
+    ASSERT_EQ(bob2.obj()["mock"]["generations"].numberLong(), 1);
+}
+
 }  // namespace
 }  // namespace mongo
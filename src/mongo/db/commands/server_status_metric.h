@@ -371,4 +371,9 @@ struct ServerStatusMetricPolicySelection<Atomic64Metric> {
     using type = CounterMetricPolicy<Atomic64Metric>;
 };
 
+template <>
+struct ServerStatusMetricPolicySelection<StripedCounter64> {
+    using type = CounterMetricPolicy<StripedCounter64>;
+};
+
 }  // namespace mongo
@@ -35,6 +35,8 @@
 #include <fmt/format.h>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/base/status.h"
+#include "mongo/base/status_with.h"
 #include "mongo/base/string_data.h"
 #include "mongo/db/client.h"
 #include "mongo/db/curop.h"
@@ -93,6 +95,15 @@ template <ErrorCodes::Error ec>
 [[noreturn]] void throwExceptionFor(std::string reason) {
     throw ExceptionFor<ec>({ec, std::move(reason)});
 }
+
+/** Extracts the `Status` from either a `Status` or a `StatusWith<T>`. */
+inline const Status& statusOf(const Status& status) {
+    return status;
+}
+template <typename T>
+const Status& statusOf(const StatusWith<T>& sw) {
+    return sw.getStatus();
+}
 }  // namespace error_details
 
 /**
@@ -127,6 +138,21 @@ template <ErrorCodes::Error ec>
     error_details::throwExceptionFor<ErrorCodes::TransactionTooLargeForCache>(std::move(context));
 }
 
+/**
+ * Returns true if 'status' carries one of the storage conflict codes that are represented by
+ * `StorageUnavailableException` when thrown.
+ */
+inline bool isStorageUnavailableStatus(const Status& status) {
+    switch (status.code()) {
+        case ErrorCodes::WriteConflict:
+        case ErrorCodes::TemporarilyUnavailable:
+        case ErrorCodes::TransactionTooLargeForCache:
+            return true;
+        default:
+            return false;
+    }
+}
+
 /** Stateful object for executing the `writeConflictRetry` function below. */
 class WriteConflictRetryAlgorithm {
 public:
@@ -168,6 +194,40 @@ public:
         }
     }
 
+    /**
+     * Status-based variant of `operator()`. `f` must return a `Status` or a `StatusWith<T>`.
+     * Storage conflicts reported through the returned status are retried in place, without the
+     * cost of throwing and unwinding an exception per conflict; conflicts thrown as exceptions
+     * by layers that have not been converted are caught and retried as well. Logging, backoff,
+     * and retry accounting are shared with the exception-based path. Any other non-OK status is
+     * returned to the caller untouched. Terminal conditions (e.g. a user operation exhausting
+     * its TemporarilyUnavailable retries) still escape as exceptions, exactly as they do from
+     * `operator()`.
+     */
+    decltype(auto) runStatusBased(auto&& f) {
+        // Always run without retries in a WuoW because the entire WuoW needs to be retried.
+        if (shard_role_details::getLocker(_opCtx)->inAWriteUnitOfWork())
+            return _runStatusBasedWithoutRetries(f);
+
+        // See the comment on the corresponding failpoint check in `operator()`.
+        if (auto sfp = skipWriteConflictRetries.scopedIf(
+                [&](auto&&) { return _opCtx->getClient()->isFromUserConnection(); });
+            MONGO_unlikely(sfp.isActive()))
+            return _runStatusBasedWithoutRetries(f);
+
+        while (true) {
+            try {
+                decltype(auto) result = f();
+                const Status& status = error_details::statusOf(result);
+                if (MONGO_likely(!isStorageUnavailableStatus(status)))
+                    return result;
+                _handleStorageUnavailable(status);
+            } catch (const StorageUnavailableException& e) {
+                _handleStorageUnavailable(e.toStatus());
+            }
+        }
+    }
+
 private:
     decltype(auto) _runWithoutRetries(auto&& f) {
         try {
@@ -183,6 +243,17 @@ private:
         }
     }
 
+    decltype(auto) _runStatusBasedWithoutRetries(auto&& f) {
+        return _runWithoutRetries([&] {
+            decltype(auto) result = f();
+            // A conflict here must unwind to the retry loop enclosing the unit of work, which
+            // is exception-based, so rethrow it in its exception form.
+            if (MONGO_unlikely(isStorageUnavailableStatus(error_details::statusOf(result))))
+                iasserted(error_details::statusOf(result));
+            return result;
+        });
+    }
+
     void _emitLog(StringData reason);
     void _assertRetryLimit() const;
     void _handleStorageUnavailable(const Status& e);
@@ -225,6 +296,24 @@ auto writeConflictRetry(OperationContext* opCtx,
     return WriteConflictRetryAlgorithm{opCtx, opStr, nssOrUUID, retryLimit}(std::forward<F>(f));
 }
 
+/**
+ * Status-based counterpart to `writeConflictRetry`, for hot paths where per-conflict exception
+ * unwinding is measurable. `f` must return a `Status` or a `StatusWith<T>`; storage conflicts
+ * (WriteConflict, TemporarilyUnavailable, TransactionTooLargeForCache) reported through the
+ * return value are retried in place with the same logging, backoff, and metrics as
+ * `writeConflictRetry`, and conflicts thrown as exceptions by not-yet-converted layers are still
+ * caught and retried. Any other non-OK status is returned to the caller.
+ */
+template <typename F>
+auto writeConflictRetryWithStatus(OperationContext* opCtx,
+                                  StringData opStr,
+                                  const NamespaceStringOrUUID& nssOrUUID,
+                                  F&& f,
+                                  boost::optional<size_t> retryLimit = boost::none) {
+    return WriteConflictRetryAlgorithm{opCtx, opStr, nssOrUUID, retryLimit}.runStatusBased(
+        std::forward<F>(f));
+}
+
 }  // namespace mongo
 
 #undef MONGO_LOGV2_DEFAULT_COMPONENT
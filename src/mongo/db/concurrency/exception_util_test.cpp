@@ -235,6 +235,61 @@ TEST_F(ExceptionUtilTest, WriteConflictRetryTransactionTooLargeForCacheException
     }
 }
 
+TEST_F(ExceptionUtilTest, WriteConflictRetryWithStatusRetriesConflictStatus) {
+    // A conflict reported through the returned status is retried without an exception being
+    // thrown, and still counts towards the write conflict metrics.
+    auto opCtx = makeOperationContext();
+    auto&& opDebug = CurOp::get(opCtx.get())->debug();
+    ASSERT_EQUALS(0, opDebug.additiveMetrics.writeConflicts.load());
+    auto swResult = writeConflictRetryWithStatus(
+        opCtx.get(), "", NamespaceString::kEmpty, [&opDebug]() -> StatusWith<int> {
+            if (0 == opDebug.additiveMetrics.writeConflicts.load()) {
+                return Status(ErrorCodes::WriteConflict, "status-based conflict");
+            }
+            return 100;
+        });
+    ASSERT_OK(swResult);
+    ASSERT_EQUALS(100, swResult.getValue());
+    ASSERT_EQUALS(1LL, opDebug.additiveMetrics.writeConflicts.load());
+}
+
+TEST_F(ExceptionUtilTest, WriteConflictRetryWithStatusRetriesThrownConflict) {
+    // Conflicts thrown as exceptions by layers that have not been converted are still retried.
+    auto opCtx = makeOperationContext();
+    auto&& opDebug = CurOp::get(opCtx.get())->debug();
+    auto status =
+        writeConflictRetryWithStatus(opCtx.get(), "", NamespaceString::kEmpty, [&opDebug] {
+            if (0 == opDebug.additiveMetrics.writeConflicts.load()) {
+                throwWriteConflictException("thrown conflict");
+            }
+            return Status::OK();
+        });
+    ASSERT_OK(status);
+    ASSERT_EQUALS(1LL, opDebug.additiveMetrics.writeConflicts.load());
+}
+
+TEST_F(ExceptionUtilTest, WriteConflictRetryWithStatusReturnsNonConflictError) {
+    auto opCtx = makeOperationContext();
+    auto status = writeConflictRetryWithStatus(opCtx.get(), "", NamespaceString::kEmpty, [] {
+        return Status(ErrorCodes::OperationFailed, "not a conflict");
+    });
+    ASSERT_EQUALS(ErrorCodes::OperationFailed, status);
+}
+
+TEST_F(ExceptionUtilTest, WriteConflictRetryWithStatusThrowsInWriteUnitOfWork) {
+    // If already in a WriteUnitOfWork, a conflict status is rethrown as an exception so that it
+    // unwinds to the retry loop enclosing the unit of work.
+    auto opCtx = makeOperationContext();
+    Lock::GlobalWrite globalWrite(opCtx.get());
+    WriteUnitOfWork wuow(opCtx.get());
+    ASSERT_THROWS(writeConflictRetryWithStatus(
+                      opCtx.get(),
+                      "",
+                      NamespaceString::kEmpty,
+                      [] { return Status(ErrorCodes::WriteConflict, "status-based conflict"); }),
+                  WriteConflictException);
+}
+
 TEST_F(ExceptionUtilTest, WriteConflictRetryPropagatesNonWriteConflictException) {
     auto opCtx = makeOperationContext();
     ASSERT_THROWS_CODE(writeConflictRetry(opCtx.get(),
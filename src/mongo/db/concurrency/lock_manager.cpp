@@ -393,6 +393,9 @@ void LockHead::migratePartitionedLockHeads() {
                 invariant(res == LOCK_OK);  // Lock must still be granted
             }
             partition->data.erase(it);
+            if (partition->cachedLock == partitionedLock) {
+                partition->cachedLock = nullptr;
+            }
             delete partitionedLock;
         }
         // Don't pop-back to early as otherwise the lock will be considered not partitioned in
@@ -752,8 +755,18 @@ LockHead* LockManager::LockBucket::findOrInsert(ResourceId resId) {
 //
 
 PartitionedLockHead* LockManager::Partition::find(ResourceId resId) {
+    if (cachedLock && cachedResId == resId) {
+        return cachedLock;
+    }
+
     Map::iterator it = data.find(resId);
-    return it == data.end() ? nullptr : it->second;
+    if (it == data.end()) {
+        return nullptr;
+    }
+
+    cachedResId = resId;
+    cachedLock = it->second;
+    return it->second;
 }
 
 PartitionedLockHead* LockManager::Partition::findOrInsert(ResourceId resId) {
@@ -767,6 +780,9 @@ PartitionedLockHead* LockManager::Partition::findOrInsert(ResourceId resId) {
     } else {
         lock = it->second;
     }
+
+    cachedResId = resId;
+    cachedLock = lock;
     return lock;
 }
 
@@ -160,6 +160,12 @@ private:
         stdx::mutex mutex;
         using Map = stdx::unordered_map<ResourceId, PartitionedLockHead*>;
         Map data;
+
+        // One-entry cache of the most recent lookup in 'data'. Intent locks are typically taken
+        // on the same few resources over and over, so this skips the hash table on the hot path.
+        // Protected by 'mutex' and invalidated when the cached entry migrates to the LockHead.
+        ResourceId cachedResId;
+        PartitionedLockHead* cachedLock{nullptr};
     };
 
     /**
@@ -421,6 +421,41 @@ TEST_F(LockManagerTest, ValidateConflictMatrix) {
     checkConflict(getServiceContext(), MODE_X, MODE_X, true);
 }
 
+TEST_F(LockManagerTest, PartitionedLockHeadCacheInvalidatedOnMigration) {
+    LockManager lockMgr;
+    const ResourceId resId(
+        RESOURCE_COLLECTION,
+        NamespaceString::createNamespaceString_forTest(boost::none, "TestDB.collection"));
+
+    Locker lockerIX(getServiceContext());
+
+    // The first intent lock creates the PartitionedLockHead; releasing it leaves the entry (and
+    // the partition's one-entry lookup cache) in place for reuse.
+    LockRequestCombo requestIX1(&lockerIX);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIX1, MODE_IX));
+    ASSERT(lockMgr.unlock(&requestIX1));
+
+    // Reacquire through the partition fast path.
+    LockRequestCombo requestIX2(&lockerIX);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIX2, MODE_IX));
+
+    // A conflicting mode migrates the partitioned requests to the LockHead and deletes the
+    // PartitionedLockHead, which must also drop it from the partition's cache.
+    Locker lockerS(getServiceContext());
+    LockRequestCombo requestS(&lockerS);
+    ASSERT(LOCK_WAITING == lockMgr.lock(resId, &requestS, MODE_S));
+
+    ASSERT(lockMgr.unlock(&requestIX2));
+    ASSERT(requestS.lastResult == LOCK_OK);
+    ASSERT(lockMgr.unlock(&requestS));
+
+    // A new intent lock must miss the cache and recreate the partitioned state rather than see a
+    // stale pointer to the deleted PartitionedLockHead.
+    LockRequestCombo requestIX3(&lockerIX);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIX3, MODE_IX));
+    ASSERT(lockMgr.unlock(&requestIX3));
+}
+
 TEST_F(LockManagerTest, EnqueueAtFront) {
     LockManager lockMgr;
     const ResourceId resId(
@@ -66,6 +66,7 @@
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/session/logical_session_id_gen.h"
+#include "mongo/db/stats/operation_sampler.h"
 #include "mongo/db/stats/timer_stats.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/transaction_resources.h"
@@ -615,6 +616,50 @@ Microseconds CurOp::computeElapsedTimeTotal(TickSource::Tick startTime,
     return _tickSource->ticksTo<Microseconds>(endTime - startTime);
 }
 
+BSONObj CurOp::_makeOperationSampleDocument() {
+    auto opCtx = this->opCtx();
+    auto locker = shard_role_details::getLocker(opCtx);
+
+    auto cumulativeLockWaitTime = Microseconds(locker->stats().getCumulativeWaitTimeMicros());
+    auto timeQueuedForTickets = ExecutionAdmissionContext::get(opCtx).totalTimeQueuedMicros();
+    auto timeQueuedForFlowControl = Microseconds(locker->getFlowControlStats().timeAcquiringMicros);
+
+    if (_resourceStatsBase) {
+        cumulativeLockWaitTime -= _resourceStatsBase->cumulativeLockWaitTime;
+        timeQueuedForTickets -= _resourceStatsBase->timeQueuedForTickets;
+        timeQueuedForFlowControl -= _resourceStatsBase->timeQueuedForFlowControl;
+    }
+
+    BSONObjBuilder bob;
+    bob.appendDate("ts", Date_t::now());
+    bob.append("op", logicalOpToString(_logicalOp));
+    bob.append("ns", getNS());
+    if (_debug.additiveMetrics.executionTime) {
+        bob.appendNumber("durationMicros",
+                         durationCount<Microseconds>(*_debug.additiveMetrics.executionTime));
+    }
+    bob.appendNumber("workingMillis", _debug.workingTimeMillis.count());
+    bob.appendNumber("lockWaitMicros", durationCount<Microseconds>(cumulativeLockWaitTime));
+    bob.appendNumber("timeQueuedForTicketsMicros",
+                     durationCount<Microseconds>(timeQueuedForTickets));
+    bob.appendNumber("timeQueuedForFlowControlMicros",
+                     durationCount<Microseconds>(timeQueuedForFlowControl));
+    bob.appendNumber(
+        "prepareConflictMicros",
+        durationCount<Microseconds>(
+            PrepareConflictTracker::get(opCtx).getThisOpPrepareConflictDuration()));
+    if (_debug.additiveMetrics.keysExamined) {
+        bob.appendNumber("keysExamined", *_debug.additiveMetrics.keysExamined);
+    }
+    if (_debug.additiveMetrics.docsExamined) {
+        bob.appendNumber("docsExamined", *_debug.additiveMetrics.docsExamined);
+    }
+    if (_debug.additiveMetrics.nreturned) {
+        bob.appendNumber("nreturned", *_debug.additiveMetrics.nreturned);
+    }
+    return bob.obj();
+}
+
 Milliseconds CurOp::_sumBlockedTimeTotal() {
     auto locker = shard_role_details::getLocker(opCtx());
     auto prepareConflictDurationMicros =
@@ -710,6 +755,13 @@ bool CurOp::completeAndLogOperation(const logv2::LogOptions& logOptions,
     // control ticketholder.
     _debug.workingTimeMillis = (workingMillis < Milliseconds(0) ? Milliseconds(0) : workingMillis);
 
+    // Record a summary of a sampled fraction of all operations, including the ones that finish
+    // well under the slowms threshold, for the $operationSamples aggregation stage.
+    if (auto& sampler = OperationSampler::get();
+        MONGO_unlikely(sampler.shouldSample(opCtx->getClient()))) {
+        sampler.record(_makeOperationSampleDocument());
+    }
+
     bool shouldLogSlowOp, shouldProfileAtLevel1;
 
     if (filter) {
@@ -1209,6 +1209,12 @@ private:
      */
     Milliseconds _sumBlockedTimeTotal();
 
+    /**
+     * Builds the compact summary document that the operation sampling profiler records for a
+     * sampled operation (see OperationSampler).
+     */
+    BSONObj _makeOperationSampleDocument();
+
     /**
      * Handles failpoints that check whether a command has completed or not.
      * Used for testing purposes instead of the getLog command.
@@ -39,6 +39,7 @@
 #include <fmt/format.h>
 #include <iosfwd>
 #include <mutex>
+#include <new>
 #include <string>
 #include <utility>
 
@@ -49,6 +50,7 @@
 #include "mongo/bson/util/builder_fwd.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/logv2/log_attr.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/static_immortal.h"
 #include "mongo/util/str.h"
@@ -467,10 +469,7 @@ protected:
         constexpr ~Storage() {
             if (!std::is_constant_evaluated()) {
                 if (isDynamicAlloc() && _data != nullptr) {
-                    MONGO_COMPILER_DIAGNOSTIC_PUSH
-                    MONGO_COMPILER_DIAGNOSTIC_IGNORED_TRANSITIONAL("-Wfree-nonheap-object")
-                    delete[] _data;
-                    MONGO_COMPILER_DIAGNOSTIC_POP
+                    releaseShared();
                 }
             }
         }
@@ -479,22 +478,17 @@ protected:
          * Constructs a copy of other and, possibly, truncate the data.
          *
          * newSize must be smaller of equal than other.size(). It might be smaller if other contains
-         * a collection and we are only trying to copy the database part from it.
+         * a collection and we are only trying to copy the database part from it. Static and
+         * dynamic allocations share the source buffer as-is in that case; this may keep bytes past
+         * newSize reachable, which is fine since all logical sizes are derived from the
+         * discriminator byte.
          */
         Storage(const Storage& other, const size_t newSize)
             : _data(other._data), _length(other._length), _footer(other._footer) {
-            if (other.isStaticAlloc() && other.size() == newSize) {
-                return;
-            } else if (other.isSmallString()) {
+            if (other.isSmallString()) {
                 updateFooter(database_name::kSmallStringFlag, newSize);
-            } else if (newSize < kSmallStringSize) {
-                setFooter(database_name::kSmallStringFlag, newSize);
-                memcpy(mutableDataptr(), other._data, newSize);
             } else if (other.isDynamicAlloc()) {
-                char* dataptr = new char[newSize];
-                _data = dataptr;
-                _length = newSize;
-                memcpy(dataptr, other._data, newSize);
+                retainShared();
             }
         }
 
@@ -521,9 +515,7 @@ protected:
             deallocate();
             copy(other);
             if (other.isDynamicAlloc()) {
-                char* dataptr = new char[other.size()];
-                _data = dataptr;
-                memcpy(dataptr, other._data, other.size());
+                retainShared();
             }
             return *this;
         }
@@ -625,7 +617,7 @@ protected:
 
             char* dataptr;
             if (length > kSmallStringSize) {
-                dataptr = new char[length];
+                dataptr = allocShared(length);
                 data._data = dataptr;
                 data._length = length;
                 data._footer = 0;
@@ -712,11 +704,40 @@ protected:
 
         void deallocate() {
             if (isDynamicAlloc() && _data != nullptr) {
+                releaseShared();
+                reset();
+            }
+        }
+
+        /**
+         * Dynamic allocations are shared between copies and prefixed by an atomic reference
+         * count, so that copying a namespace that does not fit the small string optimisation is a
+         * pointer copy plus an increment rather than an allocation. The count lives in a header
+         * ahead of the character data; _data points past it.
+         */
+        using SharedCount = AtomicWord<uint32_t>;
+        static constexpr size_t kSharedCountSize = sizeof(SharedCount);
+
+        static char* allocShared(size_t length) {
+            char* raw = new char[kSharedCountSize + length];
+            new (raw) SharedCount(1);
+            return raw + kSharedCountSize;
+        }
+
+        SharedCount& sharedCount() const {
+            return *reinterpret_cast<SharedCount*>(const_cast<char*>(_data) - kSharedCountSize);
+        }
+
+        void retainShared() {
+            sharedCount().fetchAndAdd(1);
+        }
+
+        void releaseShared() {
+            if (sharedCount().subtractAndFetch(1) == 0) {
                 MONGO_COMPILER_DIAGNOSTIC_PUSH
                 MONGO_COMPILER_DIAGNOSTIC_IGNORED_TRANSITIONAL("-Wfree-nonheap-object")
-                delete[] _data;
+                delete[] (const_cast<char*>(_data) - kSharedCountSize);
                 MONGO_COMPILER_DIAGNOSTIC_POP
-                reset();
             }
         }
 
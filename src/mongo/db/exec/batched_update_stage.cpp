@@ -0,0 +1,530 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/move/utility_core.hpp>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/exec/batched_update_stage.h"
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/working_set.h"
+#include "mongo/db/exec/write_stage_common.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/plan_executor.h"
+#include "mongo/db/query/plan_executor_impl.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/snapshot.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/db/transaction_resources.h"
+#include "mongo/platform/compiler.h"
+#include "mongo/s/shard_version.h"
+#include "mongo/s/stale_exception.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/fail_point.h"
+#include "mongo/util/future.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/str.h"
+#include "mongo/util/timer.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kWrite
+
+
+namespace mongo {
+
+MONGO_FAIL_POINT_DEFINE(throwWriteConflictExceptionInBatchedUpdateStage);
+
+namespace {
+
+/**
+ * Constants that (conservatively) estimate the size of the oplog entry that would result from
+ * committing a batch, so as to ensure that a batch fits within a 16MB oplog entry. Unlike a
+ * delete, whose oplog entry size is determined by the _id alone, the size of an update oplog entry
+ * depends on the mods and cannot be known before applying them - the pre-image size is used as an
+ * approximation. A replacement update can produce an entry larger than its pre-image, but it is
+ * bounded by the maximum user document size; a batch that ends up with a single oversized entry
+ * carries the same risk as an unbatched update.
+ */
+// Size of an array member of an applyOps entry, excluding the document. Accounts for the maximum
+// size of the internal fields.
+static size_t kApplyOpsNonArrayEntryPaddingBytes = 256;
+// Size of an applyOps entry, excluding its array.
+static size_t kApplyOpsArrayEntryPaddingBytes = 256;
+
+void incrementSSSMetricNoOverflow(AtomicWord<long long>& metric, long long value) {
+    const int64_t MAX = 1ULL << 60;
+
+    if (metric.loadRelaxed() > MAX) {
+        metric.store(value);
+    } else {
+        metric.fetchAndAdd(value);
+    }
+}
+}  // namespace
+
+/**
+ * Reports globally-aggregated batch stats.
+ */
+struct BatchedUpdatesSSS : ServerStatusSection {
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder bob;
+        bob.appendNumber("batches", batches.loadRelaxed());
+        bob.appendNumber("docs", docs.loadRelaxed());
+        bob.appendNumber("stagedSizeBytes", stagedSizeBytes.loadRelaxed());
+        bob.appendNumber("timeInBatchMillis", timeInBatchMillis.loadRelaxed());
+        bob.appendNumber("refetchesDueToYield", refetchesDueToYield.loadRelaxed());
+
+        return bob.obj();
+    }
+
+    AtomicWord<long long> batches{0};
+    AtomicWord<long long> docs{0};
+    AtomicWord<long long> stagedSizeBytes{0};
+    AtomicWord<long long> timeInBatchMillis{0};
+    AtomicWord<long long> refetchesDueToYield{0};
+};
+auto& batchedUpdatesSSS =
+    *ServerStatusSectionBuilder<BatchedUpdatesSSS>("batchedUpdates").forShard();
+
+namespace {
+// Wrapper for write_stage_common::ensureStillMatches() which also updates the
+// 'refetchesDueToYield' serverStatus metric. As with ensureStillMatches, if false is returned, the
+// WorkingSetMember referenced by 'id' is no longer valid, and must not be used except for freeing
+// the WSM.
+bool ensureStillMatchesAndUpdateStats(const CollectionPtr& collection,
+                                      OperationContext* opCtx,
+                                      WorkingSet* ws,
+                                      WorkingSetID id,
+                                      const CanonicalQuery* cq) {
+    WorkingSetMember* member = ws->get(id);
+    if (shard_role_details::getRecoveryUnit(opCtx)->getSnapshotId() != member->doc.snapshotId()) {
+        incrementSSSMetricNoOverflow(batchedUpdatesSSS.refetchesDueToYield, 1);
+    }
+    return write_stage_common::ensureStillMatches(collection, opCtx, ws, id, cq);
+}
+}  // namespace
+
+BatchedUpdateStage::BatchedUpdateStage(
+    ExpressionContext* expCtx,
+    const UpdateStageParams& params,
+    std::unique_ptr<BatchedUpdateStageParams> batchedUpdateParams,
+    WorkingSet* ws,
+    CollectionAcquisition collection,
+    PlanStage* child)
+    : UpdateStage(expCtx, params, ws, collection),
+      _batchedUpdateParams(std::move(batchedUpdateParams)),
+      _stagedUpdatesBuffer(ws),
+      _stagedUpdatesWatermarkBytes(0),
+      _commitStagedUpdates(false),
+      _stagingComplete(false) {
+    // We should never reach here if the request is an upsert.
+    invariant(!_params.request->isUpsert());
+    _children.emplace_back(child);
+    tassert(9876511,
+            "batched updates only support multi-document updates (multi: true)",
+            _params.request->isMulti());
+    tassert(9876512,
+            "batched updates do not support returning the pre- or post-image",
+            !_params.request->shouldReturnAnyDocs());
+    tassert(9876513,
+            "batched updates do not support the 'sort' parameter",
+            _params.request->getSort().isEmpty());
+    tassert(9876514,
+            "batched updates do not support the 'numStatsForDoc' parameter",
+            !_params.numStatsForDoc);
+    tassert(9876515,
+            "batch size parameters must be greater than or equal to zero",
+            _batchedUpdateParams->targetStagedDocBytes >= 0 &&
+                _batchedUpdateParams->targetBatchDocs >= 0 &&
+                _batchedUpdateParams->targetBatchTimeMS >= Milliseconds(0));
+}
+
+BatchedUpdateStage::~BatchedUpdateStage() {}
+
+bool BatchedUpdateStage::isEOF() const {
+    return _stagedUpdatesBuffer.empty() && _stagingComplete;
+}
+
+std::unique_ptr<PlanStageStats> BatchedUpdateStage::getStats() {
+    _commonStats.isEOF = isEOF();
+    std::unique_ptr<PlanStageStats> stats =
+        std::make_unique<PlanStageStats>(_commonStats, stageType());
+    stats->specific = std::make_unique<UpdateStats>(_specificStats);
+    stats->children.emplace_back(child()->getStats());
+    return stats;
+}
+
+PlanStage::StageState BatchedUpdateStage::doWork(WorkingSetID* out) {
+    WorkingSetID idToReturn = WorkingSet::INVALID_ID;
+    PlanStage::StageState planStageState = PlanStage::NEED_TIME;
+
+    if (!_commitStagedUpdates && !_stagingComplete) {
+        // It's okay to stage more documents.
+        planStageState = _doStaging(&idToReturn);
+
+        _stagingComplete = planStageState == PlanStage::IS_EOF;
+        _commitStagedUpdates = _stagingComplete || _batchTargetMet();
+    }
+
+    if (!_params.request->explain() && _commitStagedUpdates) {
+        // Overwriting 'planStageState' potentially means throwing away the result produced from
+        // staging. We expect to commit updates after a new document is staged and the batch
+        // targets are met (planStageState = PlanStage::NEED_TIME), after there are no more
+        // documents to stage (planStageState = PlanStage::IS_EOF), or when resuming to commit
+        // updates in the buffer before more can be staged (planStageState = PlanStage::NEED_TIME
+        // by default).
+        //
+        // Enforce that if staging occurred, the resulting 'planStageState' is only overwritten
+        // when we should be committing updates.
+        tassert(9876516,
+                "Fetched unexpected plan stage state before committing updates",
+                planStageState == PlanStage::NEED_TIME || planStageState == PlanStage::IS_EOF);
+
+        _stagedUpdatesWatermarkBytes = 0;
+        planStageState = _updateBatch(&idToReturn);
+
+        _commitStagedUpdates = _stagingComplete || !_stagedUpdatesBuffer.empty();
+    }
+
+    // We need to check if 'planStageState' is 'NEED_YIELD' earlier than we check 'isEOF()'.
+    // The reason is that 'isEOF()' returns true if we have completed staging and have an empty
+    // buffer of staged updates. However, even if 'isEOF()' returns true, the 'planStageState' can
+    // be 'NEED_YIELD' here if inside 'restoreState()' in '_updateBatch()' a
+    // 'StorageEngineException' was thrown and caught. In this case, the 'planStageState' is
+    // 'NEED_YIELD' and 'isEOF()' already returns true.
+    if (planStageState == PlanStage::NEED_YIELD) {
+        *out = idToReturn;
+        return PlanStage::NEED_YIELD;
+    }
+
+    if (isEOF()) {
+        invariant(planStageState != PlanStage::NEED_YIELD);
+        return PlanStage::IS_EOF;
+    }
+
+    return planStageState;
+}
+
+PlanStage::StageState BatchedUpdateStage::_updateBatch(WorkingSetID* out) {
+    if (!_stagedUpdatesBuffer.size()) {
+        return PlanStage::NEED_TIME;
+    }
+
+    const auto saveRet = handlePlanStageYield(
+        expCtx(),
+        "BatchedUpdateStage saveState",
+        [&] {
+            child()->saveState();
+            return PlanStage::NEED_TIME;
+        },
+        [&] {
+            // yieldHandler
+            _prepareToRetryDrainAfterYield(out, {}, {});
+        });
+    if (saveRet != PlanStage::NEED_TIME) {
+        return saveRet;
+    }
+
+    std::set<WorkingSetID> recordsToSkip;
+    std::vector<RecordId> appliedRecordIds;
+    unsigned int docsUpdated = 0;
+    unsigned int bufferOffset = 0;
+    long long timeInBatch = 0;
+
+    try {
+        const auto ret = handlePlanStageYield(
+            expCtx(),
+            "BatchedUpdateStage::_updateBatch",
+            [&] {
+                timeInBatch = _commitBatch(
+                    out, &recordsToSkip, &appliedRecordIds, &docsUpdated, &bufferOffset);
+                return PlanStage::NEED_TIME;
+            },
+            [&] {
+                // yieldHandler
+                _prepareToRetryDrainAfterYield(out, recordsToSkip, appliedRecordIds);
+            });
+
+        if (ret != PlanStage::NEED_TIME) {
+            return ret;
+        }
+    } catch (const ExceptionFor<ErrorCodes::StaleConfig>& ex) {
+        if (ShardVersion::isPlacementVersionIgnored(ex->getVersionReceived()) &&
+            ex->getCriticalSectionSignal()) {
+            // If the placement version is IGNORED and we encountered a critical section, then
+            // yield, wait for critical section to finish and then we'll resume the write from the
+            // point we had left. We do this to prevent large multi-writes from repeatedly failing
+            // due to StaleConfig and exhausting the mongos retry attempts.
+            planExecutorShardingState(opCtx()).criticalSectionFuture =
+                ex->getCriticalSectionSignal();
+            _prepareToRetryDrainAfterYield(out, recordsToSkip, appliedRecordIds);
+            return PlanStage::NEED_YIELD;
+        }
+        throw;
+    }
+
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.docs, docsUpdated);
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.batches, 1);
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.timeInBatchMillis, timeInBatch);
+
+    if (bufferOffset < _stagedUpdatesBuffer.size()) {
+        // targetBatchTimeMS was met. Remove staged updates that have been evaluated
+        // (executed or skipped because they no longer match the query) from the buffer. If any
+        // staged updates remain in the buffer, they will be retried in a subsequent batch.
+        _stagedUpdatesBuffer.eraseUpToOffsetInclusive(bufferOffset);
+    } else {
+        // The individual updates staged in the buffer are preserved until the batch is committed
+        // so they can be retried in case of a write conflict.
+        // No write conflict occurred, all staged updates were successfully evaluated/executed, it
+        // is safe to clear the buffer.
+        _stagedUpdatesBuffer.clear();
+    }
+
+    return _tryRestoreState(out);
+}
+
+long long BatchedUpdateStage::_commitBatch(WorkingSetID* out,
+                                           std::set<WorkingSetID>* recordsToSkip,
+                                           std::vector<RecordId>* appliedRecordIds,
+                                           unsigned int* docsUpdated,
+                                           unsigned int* bufferOffset) {
+    // Estimate the size of the oplog entry that would result from committing the batch,
+    // to ensure we emit an oplog entry that's within the 16MB BSON limit.
+    size_t applyOpsBytes = kApplyOpsNonArrayEntryPaddingBytes;
+
+    Timer batchTimer(opCtx()->getServiceContext()->getTickSource());
+
+    // Start a WUOW with 'groupOplogEntries' which groups an update batch into a single timestamp
+    // and oplog entry. The per-document WriteUnitOfWork opened inside transformAndUpdate() nests
+    // within this one; its commit is deferred until the batch commits.
+    WriteUnitOfWork wuow(opCtx(),
+                         _stagedUpdatesBuffer.size() > 1U ? WriteUnitOfWork::kGroupForTransaction
+                                                          : WriteUnitOfWork::kDontGroup);
+    for (; *bufferOffset < _stagedUpdatesBuffer.size(); ++*bufferOffset) {
+        if (MONGO_unlikely(throwWriteConflictExceptionInBatchedUpdateStage.shouldFail())) {
+            throwWriteConflictException(
+                str::stream() << "Hit failpoint '"
+                              << throwWriteConflictExceptionInBatchedUpdateStage.getName() << "'.");
+        }
+
+        auto workingSetMemberID = _stagedUpdatesBuffer.at(*bufferOffset);
+        WorkingSetMember* member = _ws->get(workingSetMemberID);
+
+        // A document staged before the batch commits may be re-surfaced by the child after a
+        // previous batch moved it (the Halloween problem). Skip documents this operation already
+        // updated.
+        if (_updatedRecordIds && _updatedRecordIds->count(member->recordId) > 0) {
+            recordsToSkip->insert(workingSetMemberID);
+            continue;
+        }
+
+        using write_stage_common::PreWriteFilter;
+        const PreWriteFilter::Action action = [&]() {
+            // The PlanExecutor YieldPolicy may change snapshots between calls to 'doWork()'.
+            // Different documents may have different snapshots.
+            const bool docStillMatches = ensureStillMatchesAndUpdateStats(
+                collectionPtr(), opCtx(), _ws, workingSetMemberID, _params.canonicalQuery);
+
+            // Warning: if docStillMatches is false, the WSM's underlying Document/BSONObj is no
+            // longer valid.
+            if (!docStillMatches) {
+                return PreWriteFilter::Action::kSkip;
+            }
+
+            if (!_isUserInitiatedWrite) {
+                return PreWriteFilter::Action::kWrite;
+            }
+
+            // Determine whether the document being updated is owned by this shard, and the action
+            // to undertake if it isn't.
+            return _preWriteFilter.computeActionAndLogSpecialCases(
+                member->doc.value(), "batched update"_sd, collectionPtr()->ns());
+        }();
+
+        // Skip the document, as it either no longer exists, no longer matches, or has been
+        // filtered by the PreWriteFilter.
+        if (action == PreWriteFilter::Action::kSkip) {
+            recordsToSkip->insert(workingSetMemberID);
+            continue;
+        }
+
+        const bool writeToOrphan = action == PreWriteFilter::Action::kWriteAsFromMigrate;
+
+        Snapshotted<Document> memberDoc = member->doc;
+        BSONObj bsonObjDoc = memberDoc.value().toBson();
+        applyOpsBytes += kApplyOpsArrayEntryPaddingBytes;
+        applyOpsBytes += bsonObjDoc.objsize();
+        if (applyOpsBytes > BSONObjMaxUserSize && *bufferOffset > 0) {
+            // There's likely no room to fit this update in the current batch, as doing so risks
+            // exceeding 16MB of oplog entry: put this update back into the staging buffer and
+            // commit the batch.
+            (*bufferOffset)--;
+            break;
+        }
+
+        RecordId recordId = member->recordId;
+        transformAndUpdate(Snapshotted(memberDoc.snapshotId(), bsonObjDoc), recordId, writeToOrphan);
+
+        // transformAndUpdate() records the document in '_updatedRecordIds' believing its inner
+        // WriteUnitOfWork committed, but under the outer grouped WUOW the commit is deferred until
+        // the batch commits. Track the RecordIds applied in this batch so a batch rollback can
+        // remove them again - otherwise a retry would wrongly skip those documents.
+        if (_updatedRecordIds) {
+            appliedRecordIds->push_back(recordId);
+        }
+
+        _specificStats.nMatched += 1;
+        (*docsUpdated)++;
+
+        const Milliseconds elapsedMillis(batchTimer.millis());
+        if (_batchedUpdateParams->targetBatchTimeMS != Milliseconds(0) &&
+            elapsedMillis >= _batchedUpdateParams->targetBatchTimeMS) {
+            // Met 'targetBatchTimeMS' after evaluating the staged update at '*bufferOffset'.
+            break;
+        }
+    }
+    wuow.commit();
+    return batchTimer.millis();
+}
+
+PlanStage::StageState BatchedUpdateStage::_doStaging(WorkingSetID* idToReturn) {
+    auto status = child()->work(idToReturn);
+
+    switch (status) {
+        case PlanStage::ADVANCED: {
+            _stageNewUpdate(idToReturn);
+            return PlanStage::NEED_TIME;
+        }
+        default:
+            return status;
+    }
+}
+
+void BatchedUpdateStage::_stageNewUpdate(WorkingSetID* workingSetMemberID) {
+
+    WorkingSetMember* member = _ws->get(*workingSetMemberID);
+
+    ScopeGuard memberFreer([&] { _ws->free(*workingSetMemberID); });
+    invariant(member->hasRecordId());
+
+    // Updates can't have projections. This means that covering analysis will always add
+    // a fetch. We should always get fetched data, and never just key data.
+    invariant(member->hasObj());
+
+    if (_params.request->explain()) {
+        // Apply the mods in memory (without writing) to populate 'nMatched' and 'nModified' for
+        // 'executionStats'.
+        RecordId recordId = member->recordId;
+        Snapshotted<Document> memberDoc = member->doc;
+        BSONObj bsonObjDoc = memberDoc.value().toBson();
+        transformAndUpdate(
+            Snapshotted(memberDoc.snapshotId(), bsonObjDoc), recordId, false /* writeToOrphan */);
+        _specificStats.nMatched += 1;
+        return;
+    }
+
+    // Preserve the member until the update is committed. Once an update is staged in the
+    // buffer, its resources are freed when it is removed from the buffer.
+    memberFreer.dismiss();
+
+    // Ensure that the BSONObj underlying the WSM associated with 'id' is owned because
+    // saveState() is allowed to free the memory the BSONObj points to. The BSONObj will be
+    // needed later as the pre-image passed to transformAndUpdate(). Note that the call to
+    // makeObjOwnedIfNeeded() will leave the WSM in the RID_AND_OBJ state in case we need to
+    // retry updating it.
+    member->makeObjOwnedIfNeeded();
+
+    _stagedUpdatesBuffer.append(*workingSetMemberID);
+    const auto memberMemFootprintBytes = member->getMemUsage();
+    _stagedUpdatesWatermarkBytes += memberMemFootprintBytes;
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.stagedSizeBytes, memberMemFootprintBytes);
+}
+
+PlanStage::StageState BatchedUpdateStage::_tryRestoreState(WorkingSetID* out) {
+    return handlePlanStageYield(
+        expCtx(),
+        "BatchedUpdateStage::_tryRestoreState",
+        [&] {
+            child()->restoreState(&collectionPtr());
+            return PlanStage::NEED_TIME;
+        },
+        [&] {
+            // yieldHandler
+            *out = WorkingSet::INVALID_ID;
+        });
+}
+
+void BatchedUpdateStage::_prepareToRetryDrainAfterYield(
+    WorkingSetID* out,
+    const std::set<WorkingSetID>& recordsThatNoLongerMatch,
+    const std::vector<RecordId>& appliedRecordIds) {
+    if (_updatedRecordIds) {
+        // The batch was rolled back, so the updates applied within it never happened. Remove
+        // their RecordIds from the Halloween protection set so the retry does not skip them.
+        // RecordIds already present in the set before the batch are never in 'appliedRecordIds'
+        // because they are skipped before being applied.
+        for (const auto& recordId : appliedRecordIds) {
+            _updatedRecordIds->erase(recordId);
+        }
+    }
+    _stagedUpdatesBuffer.erase(recordsThatNoLongerMatch);
+    *out = WorkingSet::INVALID_ID;
+}
+
+bool BatchedUpdateStage::_batchTargetMet() {
+    return (_batchedUpdateParams->targetBatchDocs &&
+            _stagedUpdatesBuffer.size() >=
+                static_cast<size_t>(_batchedUpdateParams->targetBatchDocs)) ||
+        (_batchedUpdateParams->targetStagedDocBytes &&
+         _stagedUpdatesWatermarkBytes >=
+             static_cast<unsigned long long>(_batchedUpdateParams->targetStagedDocBytes));
+}
+
+}  // namespace mongo
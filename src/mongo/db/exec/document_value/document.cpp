@@ -30,6 +30,8 @@
 #include "mongo/db/exec/document_value/document.h"
 
 #include <absl/container/node_hash_map.h>
+#include <array>
+#include <bit>
 #include <boost/container_hash/extensions.hpp>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
@@ -308,6 +310,75 @@ void DocumentStorage::addFieldToHashTable(T field, Position pos) {
     *posPtr = Position(pos.index);
 }
 
+namespace {
+/**
+ * Recycles DocumentStorage cache buffers on the freeing thread instead of returning them to the
+ * global allocator. Transformation-heavy pipelines materialize and discard one intermediate
+ * document per input document, and since alloc() hands out power-of-two capacities, the freed
+ * buffer is almost always exactly the size the next document asks for. Odd-sized buffers (from
+ * reserveFields()) and outsized ones go straight back to the allocator.
+ */
+class CacheBufferRecycler {
+public:
+    static constexpr size_t kMinRecycledSize = 128;  // the smallest capacity alloc() hands out
+    static constexpr size_t kMaxRecycledSize = 16 * 1024;
+    static constexpr size_t kMaxPerSizeClass = 4;
+
+    ~CacheBufferRecycler() {
+        for (size_t classIdx = 0; classIdx < _freeLists.size(); classIdx++) {
+            auto& freeList = _freeLists[classIdx];
+            for (size_t i = 0; i < freeList.size; i++) {
+                ::operator delete(freeList.buffers[i], kMinRecycledSize << classIdx);
+            }
+        }
+    }
+
+    char* allocate(size_t capacity) {
+        if (auto classIdx = _sizeClass(capacity)) {
+            auto& freeList = _freeLists[*classIdx];
+            if (freeList.size > 0) {
+                return freeList.buffers[--freeList.size];
+            }
+        }
+        return static_cast<char*>(::operator new(capacity));
+    }
+
+    void deallocate(char* buffer, size_t capacity) {
+        if (auto classIdx = _sizeClass(capacity)) {
+            auto& freeList = _freeLists[*classIdx];
+            if (freeList.size < kMaxPerSizeClass) {
+                freeList.buffers[freeList.size++] = buffer;
+                return;
+            }
+        }
+        ::operator delete(buffer, capacity);
+    }
+
+private:
+    static constexpr size_t kNumSizeClasses =
+        std::countr_zero(kMaxRecycledSize) - std::countr_zero(kMinRecycledSize) + 1;
+
+    struct FreeList {
+        std::array<char*, kMaxPerSizeClass> buffers;
+        size_t size = 0;
+    };
+
+    // Buffers can only be recycled for an allocation of the exact same capacity, so restrict the
+    // free lists to the power-of-two sizes that alloc() produces.
+    static boost::optional<size_t> _sizeClass(size_t capacity) {
+        if (capacity < kMinRecycledSize || capacity > kMaxRecycledSize ||
+            !std::has_single_bit(capacity)) {
+            return boost::none;
+        }
+        return std::countr_zero(capacity) - std::countr_zero(kMinRecycledSize);
+    }
+
+    std::array<FreeList, kNumSizeClasses> _freeLists;
+};
+
+thread_local CacheBufferRecycler cacheBufferRecycler;
+}  // namespace
+
 void DocumentStorage::alloc(unsigned newSize) {
     const auto oldCapacity = allocatedBytes();
     const bool firstAlloc = !_cache;
@@ -328,10 +399,10 @@ void DocumentStorage::alloc(unsigned newSize) {
     auto oldCache = _cache;
     ScopeGuard deleteOldCache([oldCache, oldCapacity] {
         if (oldCache) {
-            ::operator delete(oldCache, oldCapacity);
+            cacheBufferRecycler.deallocate(oldCache, oldCapacity);
         }
     });
-    _cache = static_cast<char*>(::operator new(capacity));
+    _cache = cacheBufferRecycler.allocate(capacity);
     _cacheEnd = _cache + capacity - hashTabBytes();
 
     if (!firstAlloc) {
@@ -363,7 +434,7 @@ void DocumentStorage::reserveFields(size_t expectedFields) {
 
     uassert(16491, "Tried to make oversized document", newSize <= size_t(BufferMaxSize));
 
-    _cache = static_cast<char*>(::operator new(newSize + hashTabBytes()));
+    _cache = cacheBufferRecycler.allocate(newSize + hashTabBytes());
     _cacheEnd = _cache + newSize;
 }
 
@@ -375,7 +446,7 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
         // Make a copy of the buffer with the fields.
         // It is very important that the positions of each field are the same after cloning.
         const size_t bufferBytes = allocatedBytes();
-        out->_cache = static_cast<char*>(::operator new(bufferBytes));
+        out->_cache = cacheBufferRecycler.allocate(bufferBytes);
         out->_cacheEnd = out->_cache + (_cacheEnd - _cache);
         memcpy(out->_cache, _cache, bufferBytes);
 
@@ -412,7 +483,7 @@ DocumentStorage::~DocumentStorage() {
         it->val.~Value();  // explicit destructor call
     }
     if (_cache) {
-        ::operator delete(_cache, allocatedBytes());
+        cacheBufferRecycler.deallocate(_cache, allocatedBytes());
     }
 }
 
@@ -429,7 +500,7 @@ void DocumentStorage::reset(const BSONObj& bson, bool bsonHasMetadata) {
     }
 
     if (_cache) {
-        ::operator delete(_cache, allocatedBytes());
+        cacheBufferRecycler.deallocate(_cache, allocatedBytes());
     }
     _cacheEnd = _cache = nullptr;
     _usedBytes = 0;
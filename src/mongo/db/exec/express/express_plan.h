@@ -640,14 +640,22 @@ class LookupViaUserIndex {
 public:
     using CollectionTypeChoice = CollectionType;
 
+    /**
+     * When 'coveredProjection' is true, the projection applied downstream only needs fields that
+     * are stored in the index key, so the iterator rehydrates the key into a document instead of
+     * fetching the full document from the collection. The caller is responsible for verifying
+     * coverage (non-multikey index, no index collation, all projected fields in the key pattern).
+     */
     LookupViaUserIndex(const BSONElement& filterValue,
                        std::string indexIdent,
                        std::string indexName,
-                       const CollatorInterface* collator)
+                       const CollatorInterface* collator,
+                       bool coveredProjection = false)
         : _filterValue(filterValue),
           _indexIdent(std::move(indexIdent)),
           _indexName(std::move(indexName)),
-          _collator(collator) {}
+          _collator(collator),
+          _coveredProjection(coveredProjection) {}
 
     void open(OperationContext* opCtx, CollectionType collection, IteratorStats* stats) {
         _indexCatalogEntry = LookupViaUserIndex::getIndexCatalogEntryForUserIndex(
@@ -712,6 +720,28 @@ public:
         auto rid = keyEntry.getRecordId();
         tassert(8884402, "Index entry with null record id", rid && !rid->isNull());
 
+        if (_coveredProjection) {
+            // The index key contains every field the projection needs, so rehydrate it into a
+            // document and skip fetching from the collection.
+            const auto& keyPattern = _indexCatalogEntry->descriptor()->keyPattern();
+            auto dehydratedKp = key_string::toBson(keyEntry.getKeyStringWithoutRecordIdView(),
+                                                   Ordering::make(keyPattern),
+                                                   keyEntry.getTypeBitsView(),
+                                                   keyEntry.getVersion());
+            auto keyObj = IndexKeyEntry::rehydrateKey(keyPattern, dehydratedKp).getOwned();
+
+            auto progress = continuation(
+                collection,
+                *rid,
+                Snapshotted<BSONObj>(shard_role_details::getRecoveryUnit(opCtx)->getSnapshotId(),
+                                     std::move(keyObj)));
+            if (isSuccessfulResult(progress)) {
+                _exhausted = true;
+                return Exhausted{};
+            }
+            return progress;
+        }
+
         Snapshotted<BSONObj> obj;
         bool found = accessCollection(collection).findDoc(opCtx, *rid, &obj);
         if (!found) {
@@ -802,6 +832,9 @@ private:
 
     const CollatorInterface* _collator;  // Owned by the query's ExpressionContext.
 
+    // When set, the iterator returns rehydrated index keys instead of fetched documents.
+    const bool _coveredProjection{false};
+
     bool _exhausted{false};
 
     IteratorStats* _stats{nullptr};
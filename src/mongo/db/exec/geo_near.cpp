@@ -94,6 +94,35 @@ static const double kCircOfEarthInMeters = 2 * M_PI * kRadiusOfEarthInMeters;
 static const double kMaxEarthDistanceInMeters = kCircOfEarthInMeters / 2;
 static const double kMetersPerDegreeAtEquator = kCircOfEarthInMeters / 360;
 
+// The annulus growth policy targets this many returned results per search interval - enough to
+// amortize the cost of setting up each interval's index scan, but small enough that queries with
+// small limits don't buffer and sort far more results than they return.
+static const long long kTargetIntervalResults = 450;
+
+// Bounds on how much the annulus width may change between consecutive intervals, so a single
+// outlier interval adjusts the growth rate rather than whipsawing it.
+static const double kMaxBoundsIncrementGrowth = 8.0;
+static const double kMaxBoundsIncrementDecay = 0.25;
+
+/**
+ * Returns the width of the next search annulus, given the width of the last one and the stats it
+ * produced.
+ *
+ * The number of results in an annulus is roughly proportional to its width times the local point
+ * density, so the last interval's result count is a density observation: scale the next width by
+ * the ratio of the target result count to the observed one. In particular, empty intervals grow
+ * the width by the maximum factor, escaping sparse regions in far fewer intervals (and therefore
+ * index scans and coverings) than a fixed doubling would.
+ */
+static double adaptiveBoundsIncrement(const IntervalStats& lastIntervalStats,
+                                      double boundsIncrement) {
+    const double observed =
+        static_cast<double>(std::max(lastIntervalStats.numResultsReturned, 1LL));
+    const double scale = std::clamp(
+        kTargetIntervalResults / observed, kMaxBoundsIncrementDecay, kMaxBoundsIncrementGrowth);
+    return boundsIncrement * scale;
+}
+
 static double computeGeoNearDistance(const GeoNearParams& nearParams, WorkingSetMember* member) {
     //
     // Generic GeoNear distance computation
@@ -492,13 +521,8 @@ std::unique_ptr<NearStage::CoveredInterval> GeoNear2DStage::nextInterval(Operati
     //
 
     if (!_specificStats.intervalStats.empty()) {
-        const IntervalStats& lastIntervalStats = _specificStats.intervalStats.back();
-
-        // TODO: Generally we want small numbers of results fast, then larger numbers later
-        if (lastIntervalStats.numResultsReturned < 300)
-            _boundsIncrement *= 2;
-        else if (lastIntervalStats.numResultsReturned > 600)
-            _boundsIncrement /= 2;
+        _boundsIncrement =
+            adaptiveBoundsIncrement(_specificStats.intervalStats.back(), _boundsIncrement);
     }
 
     _boundsIncrement =
@@ -908,13 +932,8 @@ std::unique_ptr<NearStage::CoveredInterval> GeoNear2DSphereStage::nextInterval(
     //
 
     if (!_specificStats.intervalStats.empty()) {
-        const IntervalStats& lastIntervalStats = _specificStats.intervalStats.back();
-
-        // TODO: Generally we want small numbers of results fast, then larger numbers later
-        if (lastIntervalStats.numResultsReturned < 300)
-            _boundsIncrement *= 2;
-        else if (lastIntervalStats.numResultsReturned > 600)
-            _boundsIncrement /= 2;
+        _boundsIncrement =
+            adaptiveBoundsIncrement(_specificStats.intervalStats.back(), _boundsIncrement);
     }
 
     invariant(_boundsIncrement > 0.0);
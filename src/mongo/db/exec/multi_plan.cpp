@@ -117,6 +117,14 @@ auto& classicWorksHistogram =
     *MetricBuilder<HistogramServerStatusMetric>{"query.multiPlanner.histograms.classicWorks"}.bind(
         HistogramServerStatusMetric::pow(9, 128, 2));
 
+/**
+ * Aggregation of the total number of candidate plans pruned mid-trial by the classic multiplanner
+ * because they fell too far behind the most productive candidate. Only incremented when
+ * progressive pruning is enabled.
+ */
+auto& classicCandidatesPruned =
+    *MetricBuilder<Counter64>{"query.multiPlanner.classicCandidatesPruned"};
+
 /**
  * An element in this histogram is the number of plans in the candidate set of an invocation (of the
  * classic multiplanner).
@@ -244,16 +252,27 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
                                              internalQueryPlanEvaluationCollFraction.load());
     size_t numResults = trial_period::getTrialPeriodNumToReturn(*_query);
 
+    const bool progressivePruning = internalQueryPlanEvaluationProgressivePruning.load();
+    const double pruningRatio = internalQueryPlanEvaluationPruningRatio.load();
+    // Give every candidate a fraction of the trial period to get past its startup costs before any
+    // of them may be pruned.
+    const size_t pruningWarmupWorks = numWorks / 4;
+    _prunedDuringTrial.assign(_candidates.size(), false);
+
     try {
         // Work the plans, stopping when a plan hits EOF or returns some fixed number of results.
-        size_t ix = 0;
-        for (; ix < numWorks; ++ix) {
+        size_t totalWorks = 0;
+        size_t activeCandidates = _candidates.size();
+        for (size_t ix = 0; ix < numWorks; ++ix) {
+            totalWorks += activeCandidates;
             bool moreToDo = workAllPlans(numResults, yieldPolicy);
             if (!moreToDo) {
                 break;
             }
+            if (progressivePruning && ix >= pruningWarmupWorks) {
+                activeCandidates -= pruneUnproductiveCandidates(pruningRatio);
+            }
         }
-        auto totalWorks = ix * _candidates.size();
         classicWorksHistogram.increment(totalWorks);
         classicWorksTotal.increment(totalWorks);
     } catch (DBException& e) {
@@ -317,12 +336,14 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
 
 bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy) {
     bool doneWorking = false;
+    bool workedAnyPlan = false;
 
     for (size_t ix = 0; ix < _candidates.size(); ++ix) {
         auto& candidate = _candidates[ix];
-        if (!candidate.status.isOK()) {
+        if (!candidate.status.isOK() || _prunedDuringTrial[ix]) {
             continue;
         }
+        workedAnyPlan = true;
 
         // Might need to yield between calls to work due to the timer elapsing.
         tryYield(yieldPolicy);
@@ -383,7 +404,49 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
         }
     }
 
-    return !doneWorking;
+    // If every candidate has either failed or been pruned, there is nothing left to trial.
+    return workedAnyPlan && !doneWorking;
+}
+
+size_t MultiPlanStage::pruneUnproductiveCandidates(double pruningRatio) {
+    // Find the most productive candidate still in the running.
+    size_t leaderResults = 0;
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        if (_candidates[ix].status.isOK() && !_prunedDuringTrial[ix]) {
+            leaderResults = std::max(leaderResults, _candidates[ix].results.size());
+        }
+    }
+
+    // A productivity gap measured over a handful of results is mostly noise. Wait until the leader
+    // has produced enough results for the comparison to be meaningful.
+    static constexpr size_t kMinLeaderResults = 16;
+    if (leaderResults < kMinLeaderResults) {
+        return 0;
+    }
+
+    size_t numPruned = 0;
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        auto& candidate = _candidates[ix];
+        if (!candidate.status.isOK() || _prunedDuringTrial[ix]) {
+            continue;
+        }
+        // The '+ 1' avoids pruning solely because a candidate has produced nothing yet and biases
+        // slightly towards keeping candidates alive. The leader itself can never satisfy this
+        // condition since 'pruningRatio' is strictly greater than one.
+        if (static_cast<double>(candidate.results.size() + 1) * pruningRatio <=
+            static_cast<double>(leaderResults)) {
+            _prunedDuringTrial[ix] = true;
+            ++numPruned;
+            classicCandidatesPruned.increment();
+            LOGV2_DEBUG(9437310,
+                        2,
+                        "Pruning unproductive candidate plan during the trial period",
+                        "planIndex"_attr = ix,
+                        "candidateResults"_attr = candidate.results.size(),
+                        "leaderResults"_attr = leaderResults);
+        }
+    }
+    return numPruned;
 }
 
 void MultiPlanStage::removeRejectedPlans() {
@@ -181,12 +181,24 @@ private:
 
     /**
      * Calls work on each child plan in a round-robin fashion. We stop when any plan hits EOF
-     * or returns 'numResults' results.
+     * or returns 'numResults' results. Candidate plans which have failed or have been pruned
+     * from the trial period are skipped.
      *
      * Returns true if we need to keep working the plans and false otherwise.
      */
     bool workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy);
 
+    /**
+     * Stops working candidate plans which have produced 'pruningRatio' times fewer results than
+     * the most productive candidate still in the running. Pruned candidates keep the stats and
+     * results they accumulated so far and still participate in plan ranking; they just receive
+     * no further works during the trial period. Only called when progressive pruning is enabled
+     * via the 'internalQueryPlanEvaluationProgressivePruning' knob.
+     *
+     * Returns the number of candidates pruned by this call.
+     */
+    size_t pruneUnproductiveCandidates(double pruningRatio);
+
     /**
      * Checks whether we need to perform either a timing-based yield or a yield for a document
      * fetch. If so, then uses 'yieldPolicy' to actually perform the yield.
@@ -247,6 +259,11 @@ private:
     // is safe for the query to continue executing.
     size_t _failureCount = 0u;
 
+    // Parallel to '_candidates'. An entry is set to true when the corresponding candidate has been
+    // pruned from the trial period by pruneUnproductiveCandidates(). Only populated while
+    // pickBestPlan() is running; pruning state is meaningless once a winner has been chosen.
+    std::vector<bool> _prunedDuringTrial;
+
     // Stats
     MultiPlanStats _specificStats;
 };
@@ -48,6 +48,7 @@ struct HashLookupStats;
 struct WindowStats;
 struct SearchStats;
 struct TsBucketToBlockStats;
+struct BsonToCellBlockStats;
 }  // namespace sbe
 
 struct AndHashStats;
@@ -118,6 +119,7 @@ public:
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::WindowStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::SearchStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::TsBucketToBlockStats> stats) = 0;
+    virtual void visit(tree_walker::MaybeConstPtr<IsConst, sbe::BsonToCellBlockStats> stats) = 0;
 
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, AndHashStats> stats) = 0;
     virtual void visit(tree_walker::MaybeConstPtr<IsConst, AndSortedStats> stats) = 0;
@@ -183,6 +185,7 @@ struct PlanStatsVisitorBase : public PlanStatsVisitor<IsConst> {
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::WindowStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::SearchStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, sbe::TsBucketToBlockStats> stats) override {}
+    void visit(tree_walker::MaybeConstPtr<IsConst, sbe::BsonToCellBlockStats> stats) override {}
 
     void visit(tree_walker::MaybeConstPtr<IsConst, AndHashStats> stats) override {}
     void visit(tree_walker::MaybeConstPtr<IsConst, AndSortedStats> stats) override {}
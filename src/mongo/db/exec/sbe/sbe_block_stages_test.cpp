@@ -28,7 +28,8 @@
  */
 
 /**
- * This file contains tests for sbe::TsBlockToCellBlockStage and sbe::BlockToRowStage.
+ * This file contains tests for sbe::TsBlockToCellBlockStage, sbe::BsonToCellBlockStage and
+ * sbe::BlockToRowStage.
  */
 
 #include <cstdint>
@@ -42,6 +43,7 @@
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
 #include "mongo/db/exec/sbe/sbe_unittest.h"
 #include "mongo/db/exec/sbe/stages/block_to_row.h"
+#include "mongo/db/exec/sbe/stages/bson_to_cell_block.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
 #include "mongo/db/exec/sbe/stages/ts_bucket_to_cell_block.h"
 #include "mongo/db/exec/sbe/values/slot.h"
@@ -108,6 +110,35 @@ protected:
         return {std::move(tsBucketStage), std::move(blockSlots), bitmapSlot, metaSlot};
     }
 
+    std::tuple<std::unique_ptr<PlanStage>,
+               value::SlotVector /*blockSlots*/,
+               value::SlotId /*bitmapSlot*/>
+    makeBsonToCellBlock(std::unique_ptr<PlanStage> input,
+                        value::SlotId inSlot,
+                        size_t batchSize,
+                        const std::vector<std::string>& cellPaths) {
+        // Builds a BsonToCellBlockStage on top of the input stage.
+        auto blockSlots = generateMultipleSlotIds(cellPaths.size());
+        auto bitmapSlot = generateSlotId();
+
+        std::vector<value::CellBlock::PathRequest> pathRequests;
+        for (const auto& cellPath : cellPaths) {
+            pathRequests.emplace_back(value::CellBlock::PathRequest(
+                value::CellBlock::PathRequestType::kFilter,
+                {value::CellBlock::Get{cellPath}, value::CellBlock::Id{}}));
+        }
+
+        auto bsonToCellBlockStage = makeS<BsonToCellBlockStage>(std::move(input),
+                                                                inSlot,
+                                                                batchSize,
+                                                                std::move(pathRequests),
+                                                                blockSlots,
+                                                                bitmapSlot,
+                                                                1 /*nodeId*/);
+
+        return {std::move(bsonToCellBlockStage), std::move(blockSlots), bitmapSlot};
+    }
+
     std::tuple<std::unique_ptr<PlanStage>,
                value::SlotVector,
                value::SlotId,
@@ -739,6 +770,97 @@ TEST_F(BlockStagesTest, Unpack_Compressed_BucketWithObjectField_Yield) {
                         /*yieldAfter*/ 1);
 }
 
+const auto docsForBsonToCellBlock = BSON_ARRAY(fromjson(R"({"a" : 1, "b" : "x"})")
+                                               << fromjson(R"({"a" : 2, "b" : "y"})")
+                                               << fromjson(R"({"a" : 3, "b" : "z"})")
+                                               << fromjson(R"({"a" : 4, "b" : "u"})")
+                                               << fromjson(R"({"a" : 5, "b" : "v"})"));
+const auto cellPathsForBsonToCellBlock = std::vector<std::string>{{"a"}, {"b"}};
+
+// Verifies that the BsonToCellBlockStage batches plain documents into 'CellBlock's, emitting a
+// final partial batch when the child hits EOF.
+TEST_F(BlockStagesTest, BsonToCellBlockStageTest) {
+    auto [scanSlot, scanStage] = generateVirtualScan(docsForBsonToCellBlock);
+    auto [bsonToCellBlockStage, blockSlots, bitmapSlot] = makeBsonToCellBlock(
+        std::move(scanStage), scanSlot, 2 /*batchSize*/, cellPathsForBsonToCellBlock);
+
+    // Prepares the execution tree.
+    auto ctx = makeCompileCtx();
+    prepareTree(ctx.get(), bsonToCellBlockStage.get());
+
+    // Sets up accessors for results from the BsonToCellBlock stage.
+    auto bitmapAccessor = bsonToCellBlockStage->getAccessor(*ctx, bitmapSlot);
+    std::vector<value::SlotAccessor*> blockAccessors(blockSlots.size(), nullptr);
+    for (size_t i = 0; i < blockSlots.size(); ++i) {
+        blockAccessors[i] = bsonToCellBlockStage->getAccessor(*ctx, blockSlots[i]);
+    }
+
+    // Five documents with a batch size of two should produce two full batches and one partial one.
+    const std::vector<size_t> expectedBatchSizes{2, 2, 1};
+
+    size_t i = 0;
+    for (auto st = bsonToCellBlockStage->getNext(); st == PlanState::ADVANCED;
+         st = bsonToCellBlockStage->getNext(), ++i) {
+        ASSERT_LT(i, expectedBatchSizes.size());
+
+        // Verifies that the bitmap is all 1s and sized to the batch.
+        auto [bitmapTag, bitmapVal] = bitmapAccessor->getViewOfValue();
+        ASSERT_EQ(value::TypeTags::valueBlock, bitmapTag);
+        ASSERT_EQ(expectedBatchSizes[i], value::getValueBlock(bitmapVal)->count());
+
+        // Verifies that cell blocks sized to the batch are produced for requested 'cellPaths'.
+        for (size_t j = 0; j < cellPathsForBsonToCellBlock.size(); ++j) {
+            auto [tag, val] = blockAccessors[j]->getViewOfValue();
+            ASSERT_EQ(value::TypeTags::cellBlock, tag);
+            ASSERT_EQ(expectedBatchSizes[i], value::getCellBlock(val)->getValueBlock().count());
+        }
+    }
+    ASSERT_EQ(expectedBatchSizes.size(), i);
+}
+
+// Verifies that stacking a BlockToRowStage on top of the BsonToCellBlockStage reproduces the
+// original documents, path by path.
+TEST_F(BlockStagesTest, BsonToCellBlockRoundTripsDocuments) {
+    auto [scanSlot, scanStage] = generateVirtualScan(docsForBsonToCellBlock);
+    auto [bsonToCellBlockStage, blockSlots, bitmapSlot] = makeBsonToCellBlock(
+        std::move(scanStage), scanSlot, 2 /*batchSize*/, cellPathsForBsonToCellBlock);
+    auto [blockToRow, outSlots] =
+        makeBlockToRow(std::move(bsonToCellBlockStage), std::move(blockSlots), bitmapSlot);
+
+    std::vector<BSONObj> expectedData;
+    for (auto&& elem : docsForBsonToCellBlock) {
+        expectedData.push_back(elem.Obj());
+    }
+
+    verifyUnpackBucket(std::move(blockToRow),
+                       cellPathsForBsonToCellBlock,
+                       outSlots,
+                       boost::none /*metaSlot*/,
+                       expectedData,
+                       /*yieldAfter*/ std::numeric_limits<size_t>::max());
+}
+
+TEST_F(BlockStagesTest, BsonToCellBlockRoundTripsDocuments_Yield) {
+    auto [scanSlot, scanStage] = generateVirtualScan(docsForBsonToCellBlock);
+    auto [bsonToCellBlockStage, blockSlots, bitmapSlot] = makeBsonToCellBlock(
+        std::move(scanStage), scanSlot, 2 /*batchSize*/, cellPathsForBsonToCellBlock);
+    auto [blockToRow, outSlots] =
+        makeBlockToRow(std::move(bsonToCellBlockStage), std::move(blockSlots), bitmapSlot);
+
+    std::vector<BSONObj> expectedData;
+    for (auto&& elem : docsForBsonToCellBlock) {
+        expectedData.push_back(elem.Obj());
+    }
+
+    // The 'yieldAfter' == 2 means that the execution plan will yield in the middle of a batch.
+    verifyUnpackBucket(std::move(blockToRow),
+                       cellPathsForBsonToCellBlock,
+                       outSlots,
+                       boost::none /*metaSlot*/,
+                       expectedData,
+                       /*yieldAfter*/ 2);
+}
+
 /*
  * Test that the 'bitmap' argument to the BlockToRow stage is used. This bitmap indicates which
  * indexes in the input blocks should be propagated upwards and which should not.
@@ -949,6 +949,82 @@ TEST_F(SBECodeFragmentTest, LabelJumpNothing) {
 }
 
 
+TEST_F(SBECodeFragmentTest, LabelJumpNothingFusedWithJumpTrue) {
+    vm::LabelId endLabel = 100;
+    vm::LabelId resultLabel = 200;
+
+    // Mirrors the code shape of a short-circuiting logicOr clause, where appending 'jmpTrue'
+    // directly after 'jmpNothing' fuses the pair into a single 'jmpNothingTrue' instruction.
+    auto runVariation = [&](std::string name, value::TypeTags clauseTag, value::Value clauseVal) {
+        printVariation(name);
+
+        vm::CodeFragment clause;
+        clause.appendConstVal(clauseTag, clauseVal);
+        clause.appendLabelJumpNothing(endLabel);
+        clause.appendLabelJumpTrue(resultLabel);
+
+        vm::CodeFragment finalClause;
+        finalClause.appendConstVal(value::TypeTags::Boolean, value::bitcastFrom<bool>(false));
+        finalClause.appendLabelJump(endLabel);
+
+        vm::CodeFragment resultBranch;
+        resultBranch.appendLabel(resultLabel);
+        resultBranch.appendConstVal(value::TypeTags::Boolean, value::bitcastFrom<bool>(true));
+
+        vm::CodeFragment code;
+        code.append(std::move(clause));
+        code.append(std::move(finalClause), std::move(resultBranch));
+        code.appendLabel(endLabel);
+
+        code.removeLabel(endLabel);
+        code.removeLabel(resultLabel);
+
+        runTest(code);
+    };
+
+    runVariation("clause true", value::TypeTags::Boolean, value::bitcastFrom<bool>(true));
+    runVariation("clause false", value::TypeTags::Boolean, value::bitcastFrom<bool>(false));
+    runVariation("clause Nothing", value::TypeTags::Nothing, 0);
+}
+
+TEST_F(SBECodeFragmentTest, LabelJumpNothingFusedWithJumpFalse) {
+    vm::LabelId endLabel = 100;
+    vm::LabelId resultLabel = 200;
+
+    // Mirrors the code shape of a short-circuiting logicAnd clause, where appending 'jmpFalse'
+    // directly after 'jmpNothing' fuses the pair into a single 'jmpNothingFalse' instruction.
+    auto runVariation = [&](std::string name, value::TypeTags clauseTag, value::Value clauseVal) {
+        printVariation(name);
+
+        vm::CodeFragment clause;
+        clause.appendConstVal(clauseTag, clauseVal);
+        clause.appendLabelJumpNothing(endLabel);
+        clause.appendLabelJumpFalse(resultLabel);
+
+        vm::CodeFragment finalClause;
+        finalClause.appendConstVal(value::TypeTags::Boolean, value::bitcastFrom<bool>(true));
+        finalClause.appendLabelJump(endLabel);
+
+        vm::CodeFragment resultBranch;
+        resultBranch.appendLabel(resultLabel);
+        resultBranch.appendConstVal(value::TypeTags::Boolean, value::bitcastFrom<bool>(false));
+
+        vm::CodeFragment code;
+        code.append(std::move(clause));
+        code.append(std::move(finalClause), std::move(resultBranch));
+        code.appendLabel(endLabel);
+
+        code.removeLabel(endLabel);
+        code.removeLabel(resultLabel);
+
+        runTest(code);
+    };
+
+    runVariation("clause true", value::TypeTags::Boolean, value::bitcastFrom<bool>(true));
+    runVariation("clause false", value::TypeTags::Boolean, value::bitcastFrom<bool>(false));
+    runVariation("clause Nothing", value::TypeTags::Nothing, 0);
+}
+
 TEST_F(SBECodeFragmentTest, LabelJumpNotNothing) {
     auto value1 = makeInt32(10);
     auto value2 = makeInt32(20);
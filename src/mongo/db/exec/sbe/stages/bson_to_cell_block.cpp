@@ -0,0 +1,234 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/sbe/stages/bson_to_cell_block.h"
+
+#include <cstddef>
+#include <string>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/exec/sbe/size_estimator.h"
+#include "mongo/db/exec/sbe/values/block_interface.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo::sbe {
+BsonToCellBlockStage::BsonToCellBlockStage(std::unique_ptr<PlanStage> input,
+                                           value::SlotId docSlotId,
+                                           size_t batchSize,
+                                           std::vector<value::CellBlock::PathRequest> pathReqs,
+                                           value::SlotVector blocksOut,
+                                           value::SlotId bitmapOutSlotId,
+                                           PlanNodeId nodeId,
+                                           bool participateInTrialRunTracking)
+    : PlanStage("bson_to_cellblock"_sd,
+                nullptr /* yieldPolicy */,
+                nodeId,
+                participateInTrialRunTracking),
+      _docSlotId(docSlotId),
+      _batchSize(batchSize),
+      _pathReqs(std::move(pathReqs)),
+      _blocksOutSlotId(std::move(blocksOut)),
+      _bitmapOutSlotId(bitmapOutSlotId),
+      _extractor(value::BSONCellExtractor::make(_pathReqs)) {
+    invariant(_batchSize > 0);
+    _children.emplace_back(std::move(input));
+}
+
+std::unique_ptr<PlanStage> BsonToCellBlockStage::clone() const {
+    return std::make_unique<BsonToCellBlockStage>(_children[0]->clone(),
+                                                  _docSlotId,
+                                                  _batchSize,
+                                                  _pathReqs,
+                                                  _blocksOutSlotId,
+                                                  _bitmapOutSlotId,
+                                                  _commonStats.nodeId,
+                                                  participateInTrialRunTracking());
+}
+
+void BsonToCellBlockStage::prepare(CompileCtx& ctx) {
+    _children[0]->prepare(ctx);
+
+    // Gets the incoming accessor for documents.
+    _docAccessor = _children[0]->getAccessor(ctx, _docSlotId);
+
+    _blocksOutAccessor.resize(_pathReqs.size());
+}
+
+value::SlotAccessor* BsonToCellBlockStage::getAccessor(CompileCtx& ctx, value::SlotId slot) {
+    if (slot == _bitmapOutSlotId) {
+        return &_bitmapOutAccessor;
+    }
+
+    for (size_t i = 0; i < _pathReqs.size(); ++i) {
+        if (slot == _blocksOutSlotId[i]) {
+            return &_blocksOutAccessor[i];
+        }
+    }
+
+    return _children[0]->getAccessor(ctx, slot);
+}
+
+void BsonToCellBlockStage::open(bool reOpen) {
+    auto optTimer(getOptTimer(_opCtx));
+
+    _commonStats.opens++;
+    _children[0]->open(reOpen);
+    _childEof = false;
+
+    // Until we have valid data, we disable access to slots.
+    disableSlotAccess();
+}
+
+PlanState BsonToCellBlockStage::getNext() {
+    auto optTimer(getOptTimer(_opCtx));
+
+    // We are about to call getNext() on our child so do not bother saving our internal state in
+    // case it yields as the state will be completely overwritten after the getNext() call.
+    disableSlotAccess();
+
+    for (auto& acc : _blocksOutAccessor) {
+        acc.reset();
+    }
+    _batch.clear();
+
+    if (_childEof) {
+        return trackPlanState(PlanState::IS_EOF);
+    }
+
+    while (_batch.size() < _batchSize) {
+        auto state = _children[0]->getNext();
+        if (state == PlanState::IS_EOF) {
+            _childEof = true;
+            break;
+        }
+
+        auto [docTag, docVal] = _docAccessor->getViewOfValue();
+        invariant(docTag == value::TypeTags::bsonObject);
+
+        // The child's data may be unowned by SBE (e.g. it may point into the storage engine's
+        // cache), so take an owned copy for the lifetime of the batch.
+        _batch.push_back(BSONObj(value::getRawPointerView(docVal)).getOwned());
+    }
+
+    if (_batch.empty()) {
+        return trackPlanState(PlanState::IS_EOF);
+    }
+    auto state = trackPlanState(PlanState::ADVANCED);
+
+    initCellBlocks();
+
+    _specificStats.numDocsBatched += _batch.size();
+    _specificStats.numCellBlocksProduced += _blocksOutAccessor.size();
+
+    return state;
+}
+
+void BsonToCellBlockStage::close() {
+    auto optTimer(getOptTimer(_opCtx));
+
+    trackClose();
+    _children[0]->close();
+    _batch.clear();
+}
+
+std::unique_ptr<PlanStageStats> BsonToCellBlockStage::getStats(bool includeDebugInfo) const {
+    auto ret = std::make_unique<PlanStageStats>(_commonStats);
+
+    ret->children.emplace_back(_children[0]->getStats(includeDebugInfo));
+    if (includeDebugInfo) {
+        BSONObjBuilder bob;
+        bob.appendNumber("numDocsBatched", static_cast<long long>(_specificStats.numDocsBatched));
+        bob.appendNumber("numCellBlocksProduced",
+                         static_cast<long long>(_specificStats.numCellBlocksProduced));
+
+        ret->debugInfo = bob.obj();
+    }
+    return ret;
+}
+
+const SpecificStats* BsonToCellBlockStage::getSpecificStats() const {
+    return &_specificStats;
+}
+
+std::vector<DebugPrinter::Block> BsonToCellBlockStage::debugPrint() const {
+    auto ret = PlanStage::debugPrint();
+
+    DebugPrinter::addIdentifier(ret, _docSlotId);
+
+    ret.emplace_back(std::to_string(_batchSize));
+
+    ret.emplace_back(DebugPrinter::Block("pathReqs[`"));
+    for (size_t idx = 0; idx < _pathReqs.size(); ++idx) {
+        if (idx) {
+            ret.emplace_back(DebugPrinter::Block("`,"));
+        }
+        DebugPrinter::addIdentifier(ret, _blocksOutSlotId[idx]);
+        ret.emplace_back("=");
+
+        ret.emplace_back(_pathReqs[idx].toString());
+    }
+    ret.emplace_back(DebugPrinter::Block("`]"));
+
+    ret.emplace_back("bitmap =");
+    DebugPrinter::addIdentifier(ret, _bitmapOutSlotId);
+
+    DebugPrinter::addNewLine(ret);
+    DebugPrinter::addBlocks(ret, _children[0]->debugPrint());
+
+    return ret;
+}
+
+size_t BsonToCellBlockStage::estimateCompileTimeSize() const {
+    size_t size = sizeof(*this);
+    size += size_estimator::estimate(_children);
+    return size;
+}
+
+void BsonToCellBlockStage::initCellBlocks() {
+    auto cellBlocks = _extractor->extractFromBsons(_batch);
+    invariant(cellBlocks.size() == _blocksOutAccessor.size());
+    for (size_t i = 0; i < cellBlocks.size(); ++i) {
+        _blocksOutAccessor[i].reset(true,
+                                    value::TypeTags::cellBlock,
+                                    value::bitcastFrom<value::CellBlock*>(cellBlocks[i].release()));
+    }
+
+    // Initialize an all-1s bitset with one entry per document in the batch.
+    _bitmapOutAccessor.reset(true,
+                             value::TypeTags::valueBlock,
+                             value::bitcastFrom<value::ValueBlock*>(
+                                 std::make_unique<value::MonoBlock>(_batch.size(),
+                                                                    value::TypeTags::Boolean,
+                                                                    value::bitcastFrom<bool>(true))
+                                     .release()));
+}
+}  // namespace mongo::sbe
@@ -0,0 +1,102 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/exec/sbe/stages/stages.h"
+#include "mongo/db/exec/sbe/values/bson_block.h"
+
+namespace mongo::sbe {
+/**
+ * Batches up to 'batchSize' BSON documents from the input slot 'docSlotId' and produces a CellBlock
+ * for each path in 'pathReqs' into the output slots 'blocksOut'. This allows plans over regular
+ * (non time-series) collections to feed the block-based section of a plan: each batch of documents
+ * becomes one set of column-shaped CellBlocks, which can be filtered in a vectorized fashion and
+ * converted back to rows with BlockToRowStage.
+ *
+ * Debug string representation:
+ *
+ *  bson_to_cellblock docSlot batchSize pathReqs[blocksOut[0] = paths[0], ...,
+ *      blocksOut[N] = paths[N]] bitmap = bitmapSlotId
+ *
+ * The 'bitmapSlotId' slot contains an all 1s bitmap with one entry per document in the batch. A
+ * batch may be smaller than 'batchSize' when the child reaches EOF.
+ */
+class BsonToCellBlockStage final : public PlanStage {
+public:
+    BsonToCellBlockStage(std::unique_ptr<PlanStage> input,
+                         value::SlotId docSlotId,
+                         size_t batchSize,
+                         std::vector<value::CellBlock::PathRequest> pathReqs,
+                         value::SlotVector blocksOut,
+                         value::SlotId bitmapOutSlotId,
+                         PlanNodeId nodeId,
+                         bool participateInTrialRunTracking = true);
+
+    std::unique_ptr<PlanStage> clone() const final;
+
+    void prepare(CompileCtx& ctx) final;
+    value::SlotAccessor* getAccessor(CompileCtx& ctx, value::SlotId slot) final;
+    void open(bool reOpen) final;
+    PlanState getNext() final;
+    void close() final;
+
+    std::unique_ptr<PlanStageStats> getStats(bool includeDebugInfo) const final;
+    const SpecificStats* getSpecificStats() const final;
+    std::vector<DebugPrinter::Block> debugPrint() const final;
+    size_t estimateCompileTimeSize() const final;
+
+private:
+    void initCellBlocks();
+
+    const value::SlotId _docSlotId;
+    const size_t _batchSize;
+    const std::vector<value::CellBlock::PathRequest> _pathReqs;
+    const value::SlotVector _blocksOutSlotId;
+    const value::SlotId _bitmapOutSlotId;
+
+    std::unique_ptr<value::BSONCellExtractor> _extractor;
+
+    value::SlotAccessor* _docAccessor = nullptr;
+    std::vector<value::OwnedValueAccessor> _blocksOutAccessor;
+    value::OwnedValueAccessor _bitmapOutAccessor;
+
+    // Owned copies of the documents in the current batch. The CellBlocks handed out via
+    // '_blocksOutAccessor' fully own their data, so unlike TsBucketToCellBlockStage we do not need
+    // to copy anything on save/restore.
+    std::vector<BSONObj> _batch;
+
+    // Set once the child returns EOF so that we never call getNext() on it again while draining
+    // the final (possibly partial) batch.
+    bool _childEof = false;
+
+    BsonToCellBlockStats _specificStats;
+};
+}  // namespace mongo::sbe
@@ -205,6 +205,10 @@ void HashLookupStage::open(bool reOpen) {
         }
     }
     innerChild()->close();
+
+    // Flush any hash table entries that were staged in memory while spilling the inner side.
+    _hashTable.flushSpillStaging();
+
     outerChild()->open(reOpen);
 }  // HashLookupStage::open
 
@@ -183,6 +183,10 @@ void HashLookupUnwindStage::open(bool reOpen) {
         }
     }
     innerChild()->close();
+
+    // Flush any hash table entries that were staged in memory while spilling the inner side.
+    _hashTable.flushSpillStaging();
+
     outerChild()->open(reOpen);
 }  // HashLookupUnwindStage::open
 
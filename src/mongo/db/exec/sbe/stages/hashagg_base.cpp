@@ -138,8 +138,11 @@ void HashAggBaseStage<Derived>::makeTemporaryRecordStore() {
 }
 
 template <class Derived>
-int64_t HashAggBaseStage<Derived>::spillRowToDisk(const value::MaterializedRow& key,
-                                                  const value::MaterializedRow& val) {
+int64_t HashAggBaseStage<Derived>::serializeRowToSpillBatch(
+    const value::MaterializedRow& key,
+    const value::MaterializedRow& val,
+    std::vector<Record>& records,
+    std::vector<SharedBuffer>& recordBuffers) {
     CollatorInterface* collator = nullptr;
     if (_collatorAccessor) {
         auto [colTag, colVal] = _collatorAccessor->getViewOfValue();
@@ -158,18 +161,26 @@ int64_t HashAggBaseStage<Derived>::spillRowToDisk(const value::MaterializedRow&
     kb.appendNumberLong(_ridSuffixCounter++);
     auto rid = RecordId(kb.getView());
 
-    int spilledBytes = 0;
+    BufBuilder buf;
     if (collator) {
         // The keystring cannot always be deserialized back to the original keys when a collation is
         // in use, so we also store the unmodified key in the data part of the spilled record.
-        spilledBytes = _recordStore->upsertToRecordStore(_opCtx, rid, key, val, false /*update*/);
+        key.serializeForSorter(buf);
+        val.serializeForSorter(buf);
     } else {
+        val.serializeForSorter(buf);
+        // Append the 'typeBits' to the end of the val's buffer so the 'key' can be reconstructed
+        // when draining the spilled data.
         auto typeBits = kb.getTypeBits();
-        spilledBytes =
-            _recordStore->upsertToRecordStore(_opCtx, rid, val, typeBits, false /*update*/);
+        buf.appendBuf(typeBits.getBuffer(), typeBits.getSize());
     }
 
-    return spilledBytes;
+    const int bufferSize = buf.len();
+    auto buffer = buf.release();
+    recordBuffers.push_back(buffer);
+    records.push_back(Record{std::move(rid), RecordData(buffer.get(), bufferSize)});
+
+    return bufferSize;
 }
 
 template <class Derived>
@@ -191,11 +202,31 @@ void HashAggBaseStage<Derived>::spill(MemoryCheckData& mcd) {
         makeTemporaryRecordStore();
     }
 
+    // Serialize the hash table into batches of records and stream each batch to the record store
+    // in a single write, rather than paying the transaction overhead once per row.
+    std::vector<Record> records;
+    std::vector<SharedBuffer> recordBuffers;
+    records.reserve(kSpillBatchSize);
+    recordBuffers.reserve(kSpillBatchSize);
+
+    auto writeBatch = [&]() {
+        auto status = _recordStore->insertRecords(_opCtx, &records, std::vector<Timestamp>{});
+        tassert(10470500, "Failed to spill records in the hash agg stage", status.isOK());
+        records.clear();
+        recordBuffers.clear();
+    };
+
     int64_t spilledBytes = 0;
     int64_t spilledRecords = 0;
     for (auto&& it : *_ht) {
-        spilledBytes += spillRowToDisk(it.first, it.second);
+        spilledBytes += serializeRowToSpillBatch(it.first, it.second, records, recordBuffers);
         spilledRecords++;
+        if (records.size() == kSpillBatchSize) {
+            writeBatch();
+        }
+    }
+    if (!records.empty()) {
+        writeBatch();
     }
 
     _ht->clear();
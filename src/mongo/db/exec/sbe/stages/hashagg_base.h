@@ -128,14 +128,19 @@ protected:
     void makeTemporaryRecordStore();
 
     /**
-     * Inserts a key and value pair to the '_recordStore'. They key is serialized to a
-     * 'key_string::Value' which becomes the 'RecordId'.
+     * Serializes a key and value pair into a Record appended to 'records'. The key is serialized
+     * to a 'key_string::Value' which becomes the 'RecordId'. The record's buffer is appended to
+     * 'recordBuffers', which must outlive the batch write. Returns the size of the serialized
+     * value portion in bytes.
      *
      * Note that the 'typeBits' are needed to reconstruct the spilled 'key' to a 'MaterializedRow',
      * but are not necessary for comparison purposes. Therefore, we carry the type bits separately
      * from the record id, instead appending them to the end of the serialized 'val' buffer.
      */
-    int64_t spillRowToDisk(const value::MaterializedRow& key, const value::MaterializedRow& val);
+    int64_t serializeRowToSpillBatch(const value::MaterializedRow& key,
+                                     const value::MaterializedRow& val,
+                                     std::vector<Record>& records,
+                                     std::vector<SharedBuffer>& recordBuffers);
     void spill(MemoryCheckData& mcd);
     void checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd);
 
@@ -159,6 +164,9 @@ protected:
     std::unique_ptr<SpillingStore> _recordStore;
     std::unique_ptr<SeekableRecordCursor> _rsCursor;
 
+    // Number of records written to the '_recordStore' per batch when spilling the hash table.
+    static constexpr size_t kSpillBatchSize = 1000;
+
     // A monotically increasing counter used to ensure uniqueness of 'RecordId' values. When
     // spilling, the key is encoding into the 'RecordId' of the '_recordStore'. Record ids must be
     // unique by definition, but we might end up spilling multiple partial aggregates for the same
@@ -218,9 +218,8 @@ void LookupHashTable::addHashTableEntry(value::SlotAccessor* keyAccessor, size_t
                 makeTemporaryRecordStore();
             }
 
-            auto val = std::vector<size_t>{valueIndex};
             auto [tagKey, valKey] = keyAccessor->getViewOfValue();
-            spillIndicesToRecordStore(_recordStoreHt.get(), tagKey, valKey, val);
+            stageSpilledIndices(tagKey, valKey, std::vector<size_t>{valueIndex});
         }
     } else {
         // The key is already present in '_memoryHt' so the memory will only grow by one size_t. If
@@ -243,7 +242,7 @@ void LookupHashTable::addHashTableEntry(value::SlotAccessor* keyAccessor, size_t
             // Evict the hash table value.
             _computedTotalMemUsage -= htIt->second.size() * sizeof(size_t);
             htIt->second.push_back(valueIndex);
-            spillIndicesToRecordStore(_recordStoreHt.get(), tagKeyView, valKeyView, htIt->second);
+            stageSpilledIndices(tagKeyView, valKeyView, std::move(htIt->second));
             _memoryHt->erase(htIt);
         }
     }
@@ -363,6 +362,53 @@ void LookupHashTable::spillIndicesToRecordStore(SpillingStore* rs,
         1 /*spills*/, spillToDiskBytes, update ? 0 : 1, _recordStoreHt->storageSize(_opCtx));
 }
 
+void LookupHashTable::stageSpilledIndices(value::TypeTags tagKey,
+                                          value::Value valKey,
+                                          std::vector<size_t> indices) {
+    if (!_spillStaging) {
+        if (_collator) {
+            const value::MaterializedRowHasher hasher(_collator);
+            const value::MaterializedRowEq equator(_collator);
+            _spillStaging.emplace(0, hasher, equator);
+        } else {
+            _spillStaging.emplace();
+        }
+    }
+
+    _htProbeKey.reset(0, false, tagKey, valKey);
+    auto it = _spillStaging->find(_htProbeKey);
+    if (it == _spillStaging->end()) {
+        auto [tagKeyCopy, valKeyCopy] = value::copyValue(tagKey, valKey);
+        value::MaterializedRow key{1};
+        key.reset(0, true, tagKeyCopy, valKeyCopy);
+        _spillStagingMemUsage += size_estimator::estimate(tagKey, valKey);
+        it = _spillStaging->try_emplace(std::move(key)).first;
+    }
+
+    _spillStagingMemUsage += indices.size() * sizeof(size_t);
+    if (it->second.empty()) {
+        it->second = std::move(indices);
+    } else {
+        it->second.insert(it->second.end(), indices.begin(), indices.end());
+    }
+
+    if (_spillStagingMemUsage > kMaxSpillStagingMemoryBytes) {
+        flushSpillStaging();
+    }
+}
+
+void LookupHashTable::flushSpillStaging() {
+    if (!_spillStaging) {
+        return;
+    }
+    for (auto& [key, indices] : *_spillStaging) {
+        auto [tagKey, valKey] = key.getViewOfValue(0);
+        spillIndicesToRecordStore(_recordStoreHt.get(), tagKey, valKey, indices);
+    }
+    _spillStaging = boost::none;
+    _spillStagingMemUsage = 0;
+}
+
 void LookupHashTable::makeTemporaryRecordStore() {
     tassert(8229808,
             "HashLookupUnwindStage attempted to write to disk in an environment which is not "
@@ -411,6 +457,8 @@ boost::optional<std::pair<value::TypeTags, value::Value>> LookupHashTable::getVa
 void LookupHashTable::reset(bool fromClose) {
     _memoryUseInBytesBeforeSpill = internalQuerySBELookupApproxMemoryUseInBytesBeforeSpill.load();
     _memoryHt = boost::none;
+    _spillStaging = boost::none;
+    _spillStagingMemUsage = 0;
 
     if (_recordStoreHt) {
         _hashLookupStats.spillingHtStats.updateSpilledDataStorageSize(
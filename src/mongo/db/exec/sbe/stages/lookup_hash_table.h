@@ -188,6 +188,13 @@ public:
      */
     size_t bufferValueOrSpill(value::MaterializedRow& value);
 
+    /**
+     * Flushes any hash table entries staged by stageSpilledIndices() to '_recordStoreHt'. Must be
+     * called once the build side has been fully consumed, before the first probe, as staged
+     * entries are not visible to the hash table iterator.
+     */
+    void flushSpillStaging();
+
     void doSaveState(bool relinquishCursor);
     void doRestoreState(bool relinquishCursor);
 
@@ -291,6 +298,16 @@ private:
                                    value::Value valKey,
                                    const std::vector<size_t>& value);
 
+    /**
+     * Batches 'indices' for a key that has spilled to '_recordStoreHt'. Appending to a spilled key
+     * rewrites that key's entire index vector on disk, so staging the appends in memory and
+     * flushing each key at most once per 'kMaxSpillStagingMemoryBytes' of staged data avoids
+     * quadratic write amplification for keys with many matches.
+     */
+    void stageSpilledIndices(value::TypeTags tagKey,
+                             value::Value valKey,
+                             std::vector<size_t> indices);
+
     int64_t writeIndicesToRecordStore(SpillingStore* rs,
                                       value::TypeTags tagKey,
                                       value::Value valKey,
@@ -319,6 +336,12 @@ private:
     long long _memoryUseInBytesBeforeSpill =
         internalQuerySBELookupApproxMemoryUseInBytesBeforeSpill.load();
 
+    // In-memory staging area for index appends to keys that have spilled to '_recordStoreHt'. See
+    // stageSpilledIndices().
+    boost::optional<HashTableType> _spillStaging;
+    // Approximate memory used by '_spillStaging'.
+    long long _spillStagingMemUsage{0};
+
     // The portion of the inner collection hash table that has spilled to disk.
     std::unique_ptr<SpillingStore> _recordStoreHt;
     // Documents of the inner collection that have spilled to disk.
@@ -342,6 +365,7 @@ private:
     long long _totalSpilledBytes{0};
 
     static constexpr long long kMaxSpilledBytesForDiskSpaceCheck = 100ll * 1024 * 1024;
+    static constexpr long long kMaxSpillStagingMemoryBytes = 4ll * 1024 * 1024;
 
     friend class LookupHashTableIter;
 };  // class LookupHashTable
@@ -142,6 +142,10 @@ void CodeFragment::removeLabel(LabelId labelId) {
 }
 
 void CodeFragment::appendLabel(LabelId labelId) {
+    // The label is a potential jump target at the current code position, so a following
+    // 'jmpTrue'/'jmpFalse' must not be fused into the instruction preceding the label.
+    _lastJmpNothingOffset = boost::none;
+
     auto& label = getOrDeclareLabel(labelId);
     tassert(7134602,
             str::stream() << "Label definitionOffset is already defined. labelId: " << labelId,
@@ -190,6 +194,10 @@ void CodeFragment::validate() {
 }
 
 void CodeFragment::copyCodeAndFixup(CodeFragment&& from) {
+    // Be conservative and never fuse across a fragment boundary; the appended code may start with
+    // a label definition or otherwise be a jump target.
+    _lastJmpNothingOffset = boost::none;
+
     auto instrsSize = _instrs.size();
 
     if (_instrs.empty()) {
@@ -852,11 +860,22 @@ void CodeFragment::appendLabelJumpNotNothing(LabelId labelId) {
 void CodeFragment::appendLabelJumpInstruction(LabelId labelId, Instruction::Tags tag) {
     auto& label = getOrDeclareLabel(labelId);
 
+    // Peephole: a 'jmpTrue'/'jmpFalse' directly after a 'jmpNothing' is fused into a single
+    // instruction with two jump operands, halving the dispatch cost of the pair. This sequence is
+    // emitted for every non-final clause of a short-circuiting logicAnd/logicOr, so it is hot in
+    // filter-heavy code. The 'jmpNothing' operand already written stays in place and each operand
+    // remains relative to the end of its own encoding, so outstanding label fixups, which point at
+    // the operand bytes, stay valid.
+    const bool fuseWithJmpNothing = (tag == Instruction::jmpTrue || tag == Instruction::jmpFalse) &&
+        _lastJmpNothingOffset.has_value();
+    const auto fuseAt = _lastJmpNothingOffset;
+
     Instruction i;
     i.tag = tag;
 
     int jumpOffset;
-    auto offset = allocateSpace(sizeof(Instruction) + sizeof(jumpOffset));
+    auto offset =
+        allocateSpace(sizeof(jumpOffset) + (fuseWithJmpNothing ? 0 : sizeof(Instruction)));
 
     if (label.definitionOffset != LabelInfo::kOffsetNotSet) {
         jumpOffset = label.definitionOffset - _instrs.size();
@@ -865,12 +884,25 @@ void CodeFragment::appendLabelJumpInstruction(LabelId labelId, Instruction::Tags
         // so initialize jumpOffset with the difference between jump offset and the end of
         // instruction.
         jumpOffset = -static_cast<int>(sizeof(jumpOffset));
-        label.fixupOffsets.push_back(offset + sizeof(Instruction) - _instrs.data());
+        label.fixupOffsets.push_back(_instrs.size() - sizeof(jumpOffset));
     }
 
-    offset += writeToMemory(offset, i);
-    offset += writeToMemory(offset, jumpOffset);
+    if (fuseWithJmpNothing) {
+        Instruction fused;
+        fused.tag = tag == Instruction::jmpTrue ? Instruction::jmpNothingTrue
+                                                : Instruction::jmpNothingFalse;
+        writeToMemory(_instrs.data() + *fuseAt, fused);
+        writeToMemory(offset, jumpOffset);
+    } else {
+        offset += writeToMemory(offset, i);
+        offset += writeToMemory(offset, jumpOffset);
+        if (tag == Instruction::jmpNothing) {
+            _lastJmpNothingOffset = _instrs.size() - sizeof(Instruction) - sizeof(jumpOffset);
+        }
+    }
 
+    // In the fused case this accounts for the stack effect of the 'jmpTrue'/'jmpFalse' half; the
+    // 'jmpNothing' half was accounted for when it was appended.
     adjustStackSimple(i);
 }
 
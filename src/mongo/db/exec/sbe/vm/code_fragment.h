@@ -236,6 +236,9 @@ private:
     void appendLabelJumpInstruction(LabelId labelId, Instruction::Tags tag);
 
     auto allocateSpace(size_t size) {
+        // Appending any instruction invalidates the peephole state: the fragment no longer ends
+        // with a fusable 'jmpNothing'.
+        _lastJmpNothingOffset = boost::none;
         auto oldSize = _instrs.size();
         _instrs.resize(oldSize + size);
         return _instrs.data() + oldSize;
@@ -284,6 +287,13 @@ private:
     // when label definition offset becomes known all fixups are resolved.
     absl::flat_hash_map<LabelId, LabelInfo> _labels;
 
+    // Offset of the tag byte of a trailing 'jmpNothing' instruction, used by the peephole in
+    // appendLabelJumpInstruction() to fuse it with an immediately following 'jmpTrue'/'jmpFalse'.
+    // Disengaged whenever the fragment does not end with such an instruction, or when a label or
+    // another fragment was appended after it (a jump could then target the boundary between the
+    // two instructions, which must not end up inside a fused instruction).
+    boost::optional<size_t> _lastJmpNothingOffset;
+
     // Delta number of '_argStack' entries effect of this CodeFragment; may be negative.
     int64_t _stackSize{0};
 
@@ -513,6 +513,10 @@ private:
     void aggDoubleDoubleSumImpl(value::Array* accumulator,
                                 value::TypeTags rhsTag,
                                 value::Value rhsValue);
+    void aggDoubleDoubleSumBlockImpl(value::Array* accumulator,
+                                     std::span<const value::TypeTags> tags,
+                                     std::span<const value::Value> vals,
+                                     std::span<const value::Value> bitset);
     void aggMergeDoubleDoubleSumsImpl(value::Array* accumulator,
                                       value::TypeTags rhsTag,
                                       value::Value rhsValue);
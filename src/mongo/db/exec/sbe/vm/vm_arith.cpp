@@ -30,6 +30,7 @@
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <utility>
 
 #include <boost/cstdint.hpp>
@@ -453,6 +454,81 @@ void ByteCode::aggDoubleDoubleSumImpl(value::Array* accumulator,
     }
 }  // aggDoubleDoubleSumImpl
 
+void ByteCode::aggDoubleDoubleSumBlockImpl(value::Array* accumulator,
+                                           std::span<const value::TypeTags> tags,
+                                           std::span<const value::Value> vals,
+                                           std::span<const value::Value> bitset) {
+    tassert(10470501,
+            "Expected block and bitset to be the same size",
+            tags.size() == vals.size() && tags.size() == bitset.size());
+    tassert(10470502,
+            str::stream() << "The result slot must have at least "
+                          << AggSumValueElems::kMaxSizeOfArray - 1
+                          << " elements but got: " << accumulator->size(),
+            accumulator->size() >= AggSumValueElems::kMaxSizeOfArray - 1);
+
+    // Load the accumulator state once up front rather than once per value, then write it back once
+    // after the whole block has been folded in. Per-value calls to aggDoubleDoubleSumImpl() would
+    // rebuild the DoubleDoubleSummation from the accumulator array for every element, which
+    // dominates the cost on numeric streams.
+    auto [nonDecimalTotalTag, _] = accumulator->getAt(AggSumValueElems::kNonDecimalTotalTag);
+    tassert(10470503,
+            "The nonDecimalTag can't be NumberDecimal",
+            nonDecimalTotalTag != TypeTags::NumberDecimal);
+    auto [sumTag, sum] = accumulator->getAt(AggSumValueElems::kNonDecimalTotalSum);
+    auto [addendTag, addend] = accumulator->getAt(AggSumValueElems::kNonDecimalTotalAddend);
+    tassert(10470504,
+            "The sum and addend must be NumberDouble",
+            sumTag == addendTag && sumTag == TypeTags::NumberDouble);
+
+    auto nonDecimalTotal = DoubleDoubleSummation::create(value::bitcastTo<double>(sum),
+                                                         value::bitcastTo<double>(addend));
+
+    bool haveDecimal = accumulator->size() == AggSumValueElems::kMaxSizeOfArray;
+    Decimal128 decimalTotal;
+    if (haveDecimal) {
+        auto [decimalTotalTag, decimalTotalVal] =
+            accumulator->getAt(AggSumValueElems::kDecimalTotal);
+        tassert(10470505,
+                "The decimalTotal must be NumberDecimal",
+                decimalTotalTag == TypeTags::NumberDecimal);
+        decimalTotal = value::bitcastTo<Decimal128>(decimalTotalVal);
+    }
+
+    for (size_t i = 0; i < tags.size(); ++i) {
+        if (!value::bitcastTo<bool>(bitset[i])) {
+            continue;
+        }
+        switch (tags[i]) {
+            case TypeTags::NumberInt32:
+                nonDecimalTotal.addInt(value::bitcastTo<int32_t>(vals[i]));
+                nonDecimalTotalTag = getWidestNumericalType(nonDecimalTotalTag, tags[i]);
+                break;
+            case TypeTags::NumberInt64:
+                nonDecimalTotal.addLong(value::bitcastTo<int64_t>(vals[i]));
+                nonDecimalTotalTag = getWidestNumericalType(nonDecimalTotalTag, tags[i]);
+                break;
+            case TypeTags::NumberDouble:
+                nonDecimalTotal.addDouble(value::bitcastTo<double>(vals[i]));
+                nonDecimalTotalTag = getWidestNumericalType(nonDecimalTotalTag, tags[i]);
+                break;
+            case TypeTags::NumberDecimal:
+                decimalTotal = decimalTotal.add(value::bitcastTo<Decimal128>(vals[i]));
+                haveDecimal = true;
+                break;
+            default:
+                // Ignore non-numeric values, mirroring aggDoubleDoubleSumImpl().
+                break;
+        }
+    }
+
+    if (haveDecimal) {
+        setDecimalTotal(nonDecimalTotalTag, nonDecimalTotal, decimalTotal, accumulator);
+    } else {
+        setNonDecimalTotal(nonDecimalTotalTag, nonDecimalTotal, accumulator);
+    }
+}  // aggDoubleDoubleSumBlockImpl
+
 void ByteCode::aggMergeDoubleDoubleSumsImpl(value::Array* accumulator,
                                             value::TypeTags rhsTag,
                                             value::Value rhsValue) {
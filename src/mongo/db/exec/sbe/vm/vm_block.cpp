@@ -623,11 +623,7 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockAggDou
     tassert(
         8695110, "Expected block and bitset to be the same size", block.count() == bitset.count());
 
-    for (size_t i = 0; i < block.count(); ++i) {
-        if (value::bitcastTo<bool>(bitset[i].second)) {
-            aggDoubleDoubleSumImpl(accumulator, block.tags()[i], block.vals()[i]);
-        }
-    }
+    aggDoubleDoubleSumBlockImpl(accumulator, block.tagsSpan(), block.valsSpan(), bitset.valsSpan());
 
     guard.reset();
     return {true, accTag, accValue};
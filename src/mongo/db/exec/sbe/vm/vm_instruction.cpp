@@ -168,6 +168,8 @@ int Instruction::stackOffset[Instruction::Tags::lastInstruction] = {
     -1,  // jmpFalse
     0,   // jmpNothing
     0,   // jmpNotNothing
+    -1,  // jmpNothingTrue
+    -1,  // jmpNothingFalse
     0,   // ret
     0,   // allocStack does not affect the top of stack
 
@@ -1354,6 +1356,56 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                 }
                 break;
             }
+            case Instruction::jmpNothingTrue: {
+                // Each jump offset is relative to the end of its own operand.
+                auto jumpNothingOffset = readFromMemory<int>(pcPointer);
+                pcPointer += sizeof(jumpNothingOffset);
+
+                auto [owned, tag, val] = getFromStack(0);
+                if (tag == value::TypeTags::Nothing) {
+                    // As with 'jmpNothing', the value stays on the stack.
+                    pcPointer += jumpNothingOffset;
+                    break;
+                }
+
+                auto jumpOffset = readFromMemory<int>(pcPointer);
+                pcPointer += sizeof(jumpOffset);
+
+                popStack();
+                if (tag == value::TypeTags::Boolean && value::bitcastTo<bool>(val)) {
+                    pcPointer += jumpOffset;
+                }
+
+                if (owned) {
+                    value::releaseValue(tag, val);
+                }
+                break;
+            }
+            case Instruction::jmpNothingFalse: {
+                // Each jump offset is relative to the end of its own operand.
+                auto jumpNothingOffset = readFromMemory<int>(pcPointer);
+                pcPointer += sizeof(jumpNothingOffset);
+
+                auto [owned, tag, val] = getFromStack(0);
+                if (tag == value::TypeTags::Nothing) {
+                    // As with 'jmpNothing', the value stays on the stack.
+                    pcPointer += jumpNothingOffset;
+                    break;
+                }
+
+                auto jumpOffset = readFromMemory<int>(pcPointer);
+                pcPointer += sizeof(jumpOffset);
+
+                popStack();
+                if (tag == value::TypeTags::Boolean && !value::bitcastTo<bool>(val)) {
+                    pcPointer += jumpOffset;
+                }
+
+                if (owned) {
+                    value::releaseValue(tag, val);
+                }
+                break;
+            }
             case Instruction::ret: {
                 pcPointer = pcEnd;
                 break;
@@ -1617,6 +1669,10 @@ const char* Instruction::toString() const {
             return "jmpNothing";
         case jmpNotNothing:
             return "jmpNotNothing";
+        case jmpNothingTrue:
+            return "jmpNothingTrue";
+        case jmpNothingFalse:
+            return "jmpNothingFalse";
         case ret:
             return "ret";
         case allocStack:
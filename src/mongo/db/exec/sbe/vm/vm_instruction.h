@@ -145,6 +145,12 @@ struct Instruction {
         jmpFalse,
         jmpNothing,
         jmpNotNothing,
+        // Fused 'jmpNothing' followed by 'jmpTrue'/'jmpFalse' with two independent targets.
+        // Produced by the CodeFragment peephole in appendLabelJumpInstruction(), never emitted
+        // directly by the expression compiler. Each jump offset is calculated from the end of its
+        // own operand, so label fixups work the same as for the unfused pair.
+        jmpNothingTrue,
+        jmpNothingFalse,
         ret,  // used only by simple local lambdas
         allocStack,
 
@@ -276,6 +276,17 @@ public:
                     os << "target: " << _formatter.pcPointer(pcPointer + offset);
                     break;
                 }
+                case Instruction::jmpNothingTrue:
+                case Instruction::jmpNothingFalse: {
+                    // Each jump offset is relative to the end of its own operand.
+                    auto nothingOffset = readFromMemory<int>(pcPointer);
+                    pcPointer += sizeof(nothingOffset);
+                    os << "nothingTarget: " << _formatter.pcPointer(pcPointer + nothingOffset);
+                    auto offset = readFromMemory<int>(pcPointer);
+                    pcPointer += sizeof(offset);
+                    os << ", target: " << _formatter.pcPointer(pcPointer + offset);
+                    break;
+                }
                 // Instructions with other kinds of arguments.
                 case Instruction::traversePImm:
                 case Instruction::traverseFImm: {
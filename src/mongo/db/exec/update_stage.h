@@ -183,11 +183,11 @@ public:
     bool isEOF() const override;
     StageState doWork(WorkingSetID* out) override;
 
-    StageType stageType() const final {
+    StageType stageType() const override {
         return STAGE_UPDATE;
     }
 
-    std::unique_ptr<PlanStageStats> getStats() final;
+    std::unique_ptr<PlanStageStats> getStats() override;
 
     const SpecificStats* getSpecificStats() const final;
 
@@ -226,7 +226,6 @@ protected:
     mutablebson::Document& _doc;
     DamageVector _damages;
 
-private:
     /**
      * Stores 'idToRetry' in '_idRetrying' so the update can be retried during the next call to
      * doWork(). Sets 'out' to WorkingSet::INVALID_ID.
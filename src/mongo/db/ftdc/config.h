@@ -46,6 +46,8 @@ struct FTDCConfig {
           maxDirectorySizeBytes(kMaxDirectorySizeBytesDefault),
           maxFileSizeBytes(kMaxFileSizeBytesDefault),
           period(kPeriodMillisDefault),
+          highFrequencyEnabled(kHighFrequencyEnabledDefault),
+          highFrequencyPeriod(kHighFrequencyPeriodMillisDefault),
           metadataCaptureFrequency(kMetadataCaptureFrequencyDefault),
           maxSamplesPerArchiveMetricChunk(kMaxSamplesPerArchiveMetricChunkDefault),
           maxSamplesPerInterimMetricChunk(kMaxSamplesPerInterimMetricChunkDefault) {}
@@ -74,6 +76,20 @@ struct FTDCConfig {
      */
     Milliseconds period;
 
+    /**
+     * True if the opt-in high-frequency collectors are run in addition to the periodic collectors.
+     * False otherwise.
+     */
+    bool highFrequencyEnabled;
+
+    /**
+     * Period at which to collect the high-frequency metric subset when enabled.
+     *
+     * Only useful when shorter than 'period'; high-frequency samples are written to the archive
+     * file in their own metric chunk stream alongside the periodic samples.
+     */
+    Milliseconds highFrequencyPeriod;
+
     /**
      * Period at which to collect configuration Metadata.
      *
@@ -97,6 +113,8 @@ struct FTDCConfig {
     static const bool kEnabledDefault = true;
 
     static const std::int64_t kPeriodMillisDefault;
+    static const bool kHighFrequencyEnabledDefault = false;
+    static const std::int64_t kHighFrequencyPeriodMillisDefault;
     static const std::uint64_t kMetadataCaptureFrequencyDefault;
     static const std::uint64_t kMaxDirectorySizeBytesDefault = 200 * 1024 * 1024;
     static const std::uint64_t kMaxFileSizeBytesDefault = 10 * 1024 * 1024;
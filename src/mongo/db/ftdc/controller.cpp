@@ -28,6 +28,7 @@
  */
 
 
+#include <algorithm>
 #include <boost/filesystem/path.hpp>
 #include <boost/move/utility_core.hpp>
 // IWYU pragma: no_include "cxxabi.h"
@@ -85,6 +86,18 @@ void FTDCController::setPeriod(Milliseconds millis) {
     _condvar.notify_one();
 }
 
+void FTDCController::setHighFrequencyEnabled(bool enabled) {
+    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    _configTemp.highFrequencyEnabled = enabled;
+    _condvar.notify_one();
+}
+
+void FTDCController::setHighFrequencyPeriod(Milliseconds millis) {
+    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    _configTemp.highFrequencyPeriod = millis;
+    _condvar.notify_one();
+}
+
 void FTDCController::setMaxDirectorySizeBytes(std::uint64_t size) {
     stdx::lock_guard<stdx::mutex> lock(_mutex);
     _configTemp.maxDirectorySizeBytes = size;
@@ -142,6 +155,15 @@ void FTDCController::addPeriodicCollector(std::unique_ptr<FTDCCollectorInterface
     _periodicCollectors.add(std::move(collector), role);
 }
 
+void FTDCController::addHighFrequencyCollector(std::unique_ptr<FTDCCollectorInterface> collector,
+                                               ClusterRole role) {
+    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    invariant(_state == State::kNotStarted);
+
+    _highFrequencyCollectors.add(std::move(collector), role);
+    _hasHighFrequencyCollectors = true;
+}
+
 void FTDCController::addOnRotateCollector(std::unique_ptr<FTDCCollectorInterface> collector,
                                           ClusterRole role) {
     stdx::lock_guard<stdx::mutex> lock(_mutex);
@@ -242,13 +264,23 @@ void FTDCController::doLoop(Service* service) try {
         // Get next time to run at
         auto next_time = FTDCUtil::roundTime(now, _config.period);
 
+        // When the high-frequency stream is active, also wake at the next sub-second boundary.
+        // Both boundaries coincide whenever the period is a multiple of the high-frequency period
+        // so the high-frequency series stays regular across full collections.
+        const bool highFrequencyActive = _config.highFrequencyEnabled &&
+            _hasHighFrequencyCollectors && _config.highFrequencyPeriod < _config.period;
+
+        auto wake_time = highFrequencyActive
+            ? std::min(next_time, FTDCUtil::roundTime(now, _config.highFrequencyPeriod))
+            : next_time;
+
         // Wait for the next run or signal to shutdown
         {
             stdx::unique_lock<stdx::mutex> lock(_mutex);
             MONGO_IDLE_THREAD_BLOCK;
 
             // We ignore spurious wakeups by just doing an iteration of the loop
-            auto status = _condvar.wait_until(lock, next_time.toSystemTimePoint());
+            auto status = _condvar.wait_until(lock, wake_time.toSystemTimePoint());
 
             // Are we done running?
             if (_state == State::kStopRequested) {
@@ -288,6 +320,19 @@ void FTDCController::doLoop(Service* service) try {
             iassert(_mgr->rotate(client));
         }
 
+        if (highFrequencyActive) {
+            auto hfSample = _highFrequencyCollectors.collect(client, _multiServiceSchema);
+
+            uassertStatusOK(_mgr->writeHighFrequencySampleAndRotateIfNeeded(
+                client, std::get<0>(hfSample), std::get<1>(hfSample)));
+
+            // If this wakeup was only a high-frequency boundary, the full collection is not due
+            // yet.
+            if (wake_time < next_time) {
+                continue;
+            }
+        }
+
         auto collectSample = _periodicCollectors.collect(client, _multiServiceSchema);
 
         Status s = _mgr->writeSampleAndRotateIfNeeded(
@@ -98,6 +98,16 @@ public:
      */
     void setPeriod(Milliseconds millis);
 
+    /**
+     * Set whether the high-frequency collectors run in addition to the periodic collectors.
+     */
+    void setHighFrequencyEnabled(bool enabled);
+
+    /**
+     * Set the period for high-frequency data collection.
+     */
+    void setHighFrequencyPeriod(Milliseconds millis);
+
     /**
      * Set the maximum directory size in bytes.
      */
@@ -147,6 +157,17 @@ public:
      */
     void addPeriodicCollector(std::unique_ptr<FTDCCollectorInterface> collector, ClusterRole role);
 
+    /**
+     * Add a metric collector to collect at the high-frequency period. These collectors only run
+     * when high-frequency collection is enabled, and must be cheap enough to run at sub-second
+     * intervals, i.e. they should read in-process counters instead of running commands.
+     *
+     * `role` is used to disambiguate role-specific collectors with colliding names.
+     * It must be `ClusterRole::ShardServer`, `ClusterRole::RouterServer`, or `ClusterRole::None`.
+     */
+    void addHighFrequencyCollector(std::unique_ptr<FTDCCollectorInterface> collector,
+                                   ClusterRole role);
+
     /**
      * Add a collector that gathers machine or process configuration settings (not metrics).
      * These are emitted at the top of every log file the server produces, which is
@@ -257,6 +278,12 @@ private:
     // Set of periodic collectors
     FTDCCollectorCollection _periodicCollectors;
 
+    // Set of high-frequency collectors, only collected when high-frequency collection is enabled
+    FTDCCollectorCollection _highFrequencyCollectors;
+
+    // True if any high-frequency collectors have been registered. Only written before start().
+    bool _hasHighFrequencyCollectors = false;
+
     // Last seen sample document from periodic collectors
     // Owned
     BSONObj _mostRecentPeriodicDocument;
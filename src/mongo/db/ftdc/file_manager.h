@@ -92,6 +92,15 @@ public:
      */
     Status writeSampleAndRotateIfNeeded(Client* client, const BSONObj& sample, Date_t date);
 
+    /**
+     * Writes a high-frequency sample to disk via FTDCFileWriter.
+     *
+     * Rotates files as needed.
+     */
+    Status writeHighFrequencySampleAndRotateIfNeeded(Client* client,
+                                                     const BSONObj& sample,
+                                                     Date_t date);
+
     Status writePeriodicMetadataSampleAndRotateIfNeeded(Client* client,
                                                         const BSONObj& sample,
                                                         Date_t date);
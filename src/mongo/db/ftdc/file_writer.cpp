@@ -77,6 +77,7 @@ Status FTDCFileWriter::open(const boost::filesystem::path& file) {
     _interimTempFile = FTDCUtil::getInterimTempFile(file);
 
     _compressor.reset();
+    _highFrequencyCompressor.reset();
     _metadataCompressor.reset();
 
     return Status::OK();
@@ -180,6 +181,24 @@ Status FTDCFileWriter::writeSample(const BSONObj& sample, Date_t date) {
     return Status::OK();
 }
 
+Status FTDCFileWriter::writeHighFrequencySample(const BSONObj& sample, Date_t date) {
+    auto ret = _highFrequencyCompressor.addSample(sample, date);
+
+    if (!ret.isOK()) {
+        return ret.getStatus();
+    }
+
+    // High-frequency chunks only go to the archive stream. Skipping the interim file bounds the
+    // I/O cost of sub-second collection.
+    if (ret.getValue().has_value()) {
+        BSONObj o = FTDCBSONUtil::createBSONMetricChunkDocument(
+            std::get<0>(ret.getValue().value()), std::get<2>(ret.getValue().value()));
+        return writeArchiveFileBuffer({o.objdata(), static_cast<size_t>(o.objsize())});
+    }
+
+    return Status::OK();
+}
+
 Status FTDCFileWriter::writePeriodicMetadataSample(const BSONObj& sample, Date_t date) {
     auto ret = _metadataCompressor.addSample(sample);
     if (!ret.has_value()) {
@@ -228,10 +247,30 @@ Status FTDCFileWriter::flush(const boost::optional<ConstDataRange>& range, Date_
     return Status::OK();
 }
 
+Status FTDCFileWriter::flushHighFrequency() {
+    if (!_highFrequencyCompressor.hasDataToFlush()) {
+        return Status::OK();
+    }
+
+    auto swBuf = _highFrequencyCompressor.getCompressedSamples();
+
+    if (!swBuf.isOK()) {
+        return swBuf.getStatus();
+    }
+
+    BSONObj o = FTDCBSONUtil::createBSONMetricChunkDocument(std::get<0>(swBuf.getValue()),
+                                                            std::get<1>(swBuf.getValue()));
+    return writeArchiveFileBuffer({o.objdata(), static_cast<size_t>(o.objsize())});
+}
+
 Status FTDCFileWriter::close() {
     if (_archiveStream.is_open()) {
         Status s = flush(boost::none, Date_t());
 
+        if (s.isOK()) {
+            s = flushHighFrequency();
+        }
+
         _archiveStream.close();
 
         return s;
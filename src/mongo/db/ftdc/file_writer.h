@@ -70,7 +70,10 @@ class FTDCFileWriter {
 
 public:
     FTDCFileWriter(const FTDCConfig* config, UseMultiServiceSchema multiservice)
-        : _config(config), _compressor(_config), _metadataCompressor(multiservice) {}
+        : _config(config),
+          _compressor(_config),
+          _highFrequencyCompressor(_config),
+          _metadataCompressor(multiservice) {}
     ~FTDCFileWriter();
 
     /**
@@ -88,6 +91,16 @@ public:
      */
     Status writeSample(const BSONObj& sample, Date_t date);
 
+    /**
+     * Write a high-frequency sample to the archive log as needed.
+     *
+     * High-frequency samples are compressed in their own metric chunk stream so that their
+     * smaller schema does not force the periodic sample stream to flush. Unlike writeSample,
+     * these chunks are never staged in the interim file; at most one partial chunk of
+     * high-frequency samples is lost on unclean shutdown.
+     */
+    Status writeHighFrequencySample(const BSONObj& sample, Date_t date);
+
     /**
      * Write a periodic metadata sample to the archive log as needed.
      */
@@ -118,6 +131,11 @@ private:
      */
     Status flush(const boost::optional<ConstDataRange>&, Date_t date);
 
+    /**
+     * Flush any samples pending in the high-frequency compressor to the archive file.
+     */
+    Status flushHighFrequency();
+
     /**
      * Write a buffer to the beginning of the interim file.
      */
@@ -146,6 +164,9 @@ private:
     // FTDC compressor
     FTDCCompressor _compressor;
 
+    // FTDC compressor for the high-frequency sample stream
+    FTDCCompressor _highFrequencyCompressor;
+
     // FTDC periodic metadata compressor
     FTDCMetadataCompressor _metadataCompressor;
 
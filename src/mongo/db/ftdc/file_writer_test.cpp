@@ -146,6 +146,52 @@ TEST_F(FTDCFileTest, TestFileBasicCompress) {
     ASSERT_EQUALS(sw.getValue(), false);
 }
 
+// High-frequency samples are compressed in their own chunk stream, and interleave with regular
+// samples in the same archive file without forcing schema change flushes in either stream.
+TEST_F(FTDCFileTest, TestFileHighFrequencySamples) {
+    unittest::TempDir tempdir("metrics_testpath");
+    boost::filesystem::path p(tempdir.path());
+    p /= kTestFile;
+
+    deleteFileIfNeeded(p);
+
+    BSONObj doc1 = BSON("name"
+                        << "joe"
+                        << "key1" << 34 << "key2" << 45);
+    BSONObj doc2 = BSON("name"
+                        << "joe"
+                        << "key1" << 34 << "key2" << 46);
+    BSONObj hfDoc1 = BSON("counters" << BSON("ops" << 1));
+    BSONObj hfDoc2 = BSON("counters" << BSON("ops" << 3));
+    BSONObj hfDoc3 = BSON("counters" << BSON("ops" << 6));
+
+    FTDCConfig config;
+    FTDCFileWriter writer(&config, UseMultiServiceSchema{false});
+
+    ASSERT_OK(writer.open(p));
+
+    ASSERT_OK(writer.writeSample(doc1, Date_t()));
+    ASSERT_OK(writer.writeHighFrequencySample(hfDoc1, Date_t()));
+    ASSERT_OK(writer.writeHighFrequencySample(hfDoc2, Date_t()));
+    ASSERT_OK(writer.writeSample(doc2, Date_t()));
+    ASSERT_OK(writer.writeHighFrequencySample(hfDoc3, Date_t()));
+
+    writer.close().transitional_ignore();
+
+    FTDCFileReader reader;
+    ASSERT_OK(reader.open(p));
+
+    // The regular chunk is flushed first on close, followed by the high-frequency chunk.
+    for (const auto& expected : {doc1, doc2, hfDoc1, hfDoc2, hfDoc3}) {
+        ASSERT_OK(reader.hasNext());
+        ASSERT_BSONOBJ_EQ(expected, std::get<1>(reader.next()));
+    }
+
+    auto sw = reader.hasNext();
+    ASSERT_OK(sw);
+    ASSERT_EQUALS(sw.getValue(), false);
+}
+
 TEST_F(FTDCFileTest, TestFileBasicPeriodicMetadata) {
 #define TEST_BEGIN auto runTest = [this](bool multiservice) { \
     std::cout << "Running " << _testInfo.testName() <<" with multiservice=" << \
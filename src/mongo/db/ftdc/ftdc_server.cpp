@@ -49,6 +49,7 @@
 #include "mongo/db/mirror_maestro.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/stats/counters.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/sharding_feature_flags_gen.h"
@@ -135,6 +136,24 @@ Status onUpdateFTDCPeriod(const std::int32_t potentialNewValue) {
     return Status::OK();
 }
 
+Status onUpdateFTDCHighFrequencyEnabled(const bool value) {
+    if (FTDCController * controller;
+        hasGlobalServiceContext() && (controller = getFTDCController(getGlobalServiceContext()))) {
+        controller->setHighFrequencyEnabled(value);
+    }
+
+    return Status::OK();
+}
+
+Status onUpdateFTDCHighFrequencyPeriod(const std::int32_t potentialNewValue) {
+    if (FTDCController * controller;
+        hasGlobalServiceContext() && (controller = getFTDCController(getGlobalServiceContext()))) {
+        controller->setHighFrequencyPeriod(Milliseconds(potentialNewValue));
+    }
+
+    return Status::OK();
+}
+
 Status onUpdateFTDCDirectorySize(const std::int32_t potentialNewValue) {
     if (potentialNewValue < ftdcStartupParams.maxFileSizeMB.load()) {
         return Status(
@@ -300,6 +319,35 @@ private:
     bool _serverShuttingDown;
 };
 
+/**
+ * A FTDC Collector for the high-frequency sample stream.
+ *
+ * Reads process-wide counters directly instead of running a command so that sub-second collection
+ * costs microseconds, and keeps the metric subset small so that the delta/varint/zlib encoding
+ * keeps the extra file volume within budget.
+ */
+class FTDCHighFrequencyCollector : public FTDCCollectorInterface {
+private:
+    constexpr static StringData kName = "counters"_sd;
+
+public:
+    explicit FTDCHighFrequencyCollector(ClusterRole role) : _role(role) {}
+
+    void collect(OperationContext* opCtx, BSONObjBuilder& builder) final {
+        builder.append("opcounters", serviceOpCounters(_role).getObj());
+
+        BSONObjBuilder networkBuilder(builder.subobjStart("network"));
+        networkCounter.append(networkBuilder);
+    }
+
+    std::string name() const final {
+        return kName.toString();
+    }
+
+private:
+    const ClusterRole _role;
+};
+
 void registerServerCollectorsForRole(FTDCController* controller, ClusterRole clusterRole) {
     // TODO (SERVER-88268): Add ServerStatus collector as a router collector for every MongoD part
     // of a sharded cluster.
@@ -311,6 +359,15 @@ void registerServerCollectorsForRole(FTDCController* controller, ClusterRole clu
         clusterRole.hasExclusively(ClusterRole::ShardServer)) {
         controller->addPeriodicCollector(std::make_unique<FTDCServerStatusCommandCollector>(),
                                          ClusterRole::None);
+
+        // The high-frequency stream only collects when
+        // 'diagnosticDataCollectionHighFrequencyEnabled' is turned on.
+        const auto opCounterRole =
+            serverGlobalParams.clusterRole.hasExclusively(ClusterRole::RouterServer)
+            ? ClusterRole::RouterServer
+            : ClusterRole::ShardServer;
+        controller->addHighFrequencyCollector(
+            std::make_unique<FTDCHighFrequencyCollector>(opCounterRole), ClusterRole::None);
     }
 }
 
@@ -325,6 +382,8 @@ void startFTDC(ServiceContext* serviceContext,
                UseMultiServiceSchema multiServiceSchema) {
     FTDCConfig config;
     config.period = Milliseconds(ftdcStartupParams.periodMillis.load());
+    config.highFrequencyEnabled = ftdcStartupParams.highFrequencyEnabled.load();
+    config.highFrequencyPeriod = Milliseconds(ftdcStartupParams.highFrequencyPeriodMillis.load());
     config.metadataCaptureFrequency = ftdcStartupParams.metadataCaptureFrequency.load();
     // Only enable FTDC if our caller says to enable FTDC, MongoS may not have a valid path to write
     // files to so update the diagnosticDataCollectionEnabled set parameter to reflect that.
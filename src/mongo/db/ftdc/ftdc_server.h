@@ -120,6 +120,8 @@ private:
 struct FTDCStartupParams {
     AtomicWord<bool> enabled;
     AtomicWord<int> periodMillis;
+    AtomicWord<bool> highFrequencyEnabled;
+    AtomicWord<int> highFrequencyPeriodMillis;
     AtomicWord<int> metadataCaptureFrequency;
 
     AtomicWord<int> maxDirectorySizeMB;
@@ -130,6 +132,8 @@ struct FTDCStartupParams {
     FTDCStartupParams()
         : enabled(FTDCConfig::kEnabledDefault),
           periodMillis(FTDCConfig::kPeriodMillisDefault),
+          highFrequencyEnabled(FTDCConfig::kHighFrequencyEnabledDefault),
+          highFrequencyPeriodMillis(FTDCConfig::kHighFrequencyPeriodMillisDefault),
           metadataCaptureFrequency(FTDCConfig::kMetadataCaptureFrequencyDefault),
           // Scale the values down since are defaults are in bytes, but the user interface is MB
           maxDirectorySizeMB(FTDCConfig::kMaxDirectorySizeBytesDefault / (1024 * 1024)),
@@ -145,6 +149,8 @@ extern FTDCStartupParams ftdcStartupParams;
  */
 Status onUpdateFTDCEnabled(bool value);
 Status onUpdateFTDCPeriod(std::int32_t value);
+Status onUpdateFTDCHighFrequencyEnabled(bool value);
+Status onUpdateFTDCHighFrequencyPeriod(std::int32_t value);
 Status onUpdateFTDCMetadataCaptureFrequency(std::int32_t value);
 Status onUpdateFTDCDirectorySize(std::int32_t value);
 Status onUpdateFTDCFileSize(std::int32_t value);
@@ -86,22 +86,46 @@ void String::setData(const StringData utf8_src) {
     // plus a null character if there isn't one.
     _data.resize(utf8_src.size() + 1);
 
+    const auto* input = reinterpret_cast<const unsigned char*>(utf8_src.rawData());
+    size_t inputIdx = 0;
+    size_t outputIdx = 0;
+
+#ifdef MONGO_HAVE_FAST_BYTE_VECTOR
+    // An ASCII byte decodes to exactly one codepoint with the same value, so an ASCII prefix can
+    // be widened directly, a vector's worth of bytes at a time. Only the remainder, starting at
+    // the first non-ASCII byte, is handed to the general-purpose UTF-8 decoder below.
+    while (inputIdx + ByteVector::size <= utf8_src.size()) {
+        auto word = ByteVector::load(&input[inputIdx]);
+
+        // Count the bytes of ASCII, stopping at a NUL byte since one terminates the conversion in
+        // copyString8to32 below.
+        uint32_t usableBytes = ByteVector::countInitialZeros(word.maskHigh());
+        ByteVector::Mask nulMask = word.compareEQ('\0').maskAny();
+        if (nulMask) {
+            usableBytes = std::min(usableBytes, ByteVector::countInitialZeros(nulMask));
+        }
+        for (uint32_t i = 0; i < usableBytes; i++) {
+            _data[outputIdx++] = input[inputIdx + i];
+        }
+        inputIdx += usableBytes;
+        if (usableBytes != ByteVector::size)
+            break;
+    }
+#endif
+
     int result = 0;
     size_t resultSize = 0;
 
     // Although utf8_src.rawData() is not guaranteed to be null-terminated, copyString8to32 won't
     // access bad memory because it is limited by the size of its output buffer, which is set to the
-    // size of utf8_src.
-    copyString8to32(&_data[0],
-                    reinterpret_cast<const unsigned char*>(&utf8_src.rawData()[0]),
-                    _data.size(),
-                    resultSize,
-                    result);
+    // size of the remaining input.
+    copyString8to32(
+        &_data[outputIdx], &input[inputIdx], _data.size() - outputIdx, resultSize, result);
 
     uassert(28755, "text contains invalid UTF-8", result == 0);
 
     // Resize _data so it is only as big as what it contains.
-    _data.resize(resultSize);
+    _data.resize(outputIdx + resultSize);
     _needsOutputConversion = true;
 }
 
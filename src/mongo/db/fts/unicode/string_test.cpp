@@ -90,6 +90,24 @@ TEST(UnicodeString, SubstrTest) {
     ASSERT_EQ("", indexes.substrToBuf(&buf, 1, 0));   // len == 0.
 }
 
+TEST(UnicodeString, VectorSizedConversions) {
+    // Exercise the vectored ASCII fast path in the UTF-8 to UTF-32 conversion: inputs longer than
+    // one vector, inputs whose ASCII prefix ends mid-vector, and inputs that are a whole number of
+    // vectors long.
+    const std::string ascii(100, 'a');
+    ASSERT_EQ(ascii, String(ascii).toString());
+    ASSERT_EQ(std::string(32, 'b'), String(std::string(32, 'b')).toString());
+
+    const std::string mixed = filler + UTF8("café") + filler;
+    ASSERT_EQ(mixed, String(mixed).toString());
+
+    // A NUL byte terminates the conversion wherever it falls in the input.
+    std::string embeddedNul = filler;
+    embeddedNul.push_back('\0');
+    embeddedNul += filler;
+    ASSERT_EQ(filler, String(embeddedNul).toString());
+}
+
 TEST(UnicodeString, RemoveDiacritics) {
     // Test all ascii chars.
     for (unsigned char ch = 0; ch <= 0x7F; ch++) {
@@ -61,6 +61,7 @@
 #include "mongo/db/index_builds/index_build_interceptor.h"
 #include "mongo/db/index_names.h"
 #include "mongo/db/matcher/expression.h"
+#include "mongo/db/matcher/partial_filter_program.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/sorter/sorter.h"
@@ -219,9 +220,28 @@ MultikeyPaths createMultikeyPaths(const std::vector<MultikeyPath>& multikeyPaths
     return multikeyPaths;
 }
 
+/**
+ * Evaluates the partial index filter of 'entry' against 'obj', preferring the precompiled form of
+ * the filter when one is available. Returns true if the entry has no filter.
+ */
+bool matchesIndexFilter(const IndexCatalogEntry* entry, const BSONObj& obj) {
+    const MatchExpression* filter = entry->getFilterExpression();
+    if (!filter) {
+        return true;
+    }
+    if (auto program = entry->getCompiledFilter()) {
+        return program->matches(obj);
+    }
+    return exec::matcher::matchesBSON(filter, obj);
+}
+
 }  // namespace
 
 struct BtreeExternalSortComparison {
+    // KeyString comparison is a memcmp of the key bytes, so the sorter may use its radix-sort
+    // fast path.
+    static constexpr bool kByteComparable = true;
+
     int operator()(const key_string::Value& l, const key_string::Value& r) const {
         return l.compare(r);
     }
@@ -627,8 +647,7 @@ void SortedDataIndexAccessMethod::prepareUpdate(OperationContext* opCtx,
                                                 const InsertDeleteOptions& options,
                                                 UpdateTicket* ticket) const {
     SharedBufferFragmentBuilder pooledBuilder(key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
-    const MatchExpression* indexFilter = entry->getFilterExpression();
-    if (!indexFilter || exec::matcher::matchesBSON(indexFilter, from)) {
+    if (matchesIndexFilter(entry, from)) {
         // Override key constraints when generating keys for removal. This only applies to keys
         // that do not apply to a partial filter expression.
         const auto getKeysMode = entry->isHybridBuilding()
@@ -651,7 +670,7 @@ void SortedDataIndexAccessMethod::prepareUpdate(OperationContext* opCtx,
                 record);
     }
 
-    if (!indexFilter || exec::matcher::matchesBSON(indexFilter, to)) {
+    if (matchesIndexFilter(entry, to)) {
         getKeys(opCtx,
                 collection,
                 entry,
@@ -894,6 +913,8 @@ public:
                   const OnSuppressedErrorFn& onSuppressedError = nullptr,
                   const ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr) final;
 
+    void mergeFrom(BulkBuilder& other) final;
+
     const MultikeyPaths& getMultikeyPaths() const final;
 
     bool isMultikey() const final;
@@ -1045,6 +1066,44 @@ Status SortedDataIndexAccessMethod::BulkBuilderImpl::insert(
     return Status::OK();
 }
 
+void SortedDataIndexAccessMethod::BulkBuilderImpl::mergeFrom(BulkBuilder& other) {
+    // MultiIndexBlock only ever merges builders initiated by the same IndexAccessMethod, so the
+    // other builder is guaranteed to be a BulkBuilderImpl over the same key format.
+    auto& otherImpl = static_cast<BulkBuilderImpl&>(other);
+    invariant(otherImpl._iam == _iam);
+
+    // Multikey metadata keys are unioned rather than drained through the sorter so that they are
+    // inserted exactly once, just before the merged builder commits.
+    _multikeyMetadataKeys.insert(otherImpl._multikeyMetadataKeys.begin(),
+                                 otherImpl._multikeyMetadataKeys.end());
+    otherImpl._multikeyMetadataKeys.clear();
+
+    if (!otherImpl._indexMultikeyPaths.empty()) {
+        if (_indexMultikeyPaths.empty()) {
+            _indexMultikeyPaths = std::move(otherImpl._indexMultikeyPaths);
+        } else {
+            invariant(_indexMultikeyPaths.size() == otherImpl._indexMultikeyPaths.size());
+            for (size_t i = 0; i < otherImpl._indexMultikeyPaths.size(); ++i) {
+                _indexMultikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
+                                              otherImpl._indexMultikeyPaths[i].begin(),
+                                              otherImpl._indexMultikeyPaths[i].end());
+            }
+        }
+        otherImpl._indexMultikeyPaths.clear();
+    }
+    _isMultiKey = _isMultiKey || otherImpl._isMultiKey;
+
+    // Drain the other builder's sorted output into this builder's sorter. The keys arrive in
+    // sorted order, so each spill produces a sorted run for the final external merge.
+    auto it = otherImpl._sorter->done();
+    while (it->more()) {
+        auto data = it->next();
+        _sorter->add(data.first, data.second);
+        ++_keysInserted;
+    }
+    otherImpl._keysInserted = 0;
+}
+
 const MultikeyPaths& SortedDataIndexAccessMethod::BulkBuilderImpl::getMultikeyPaths() const {
     return _indexMultikeyPaths;
 }
@@ -1384,10 +1443,8 @@ Status SortedDataIndexAccessMethod::_indexKeysOrWriteToSideTable(
         // The side table interface accepts only records that meet the criteria for this partial
         // index.
         // See SERVER-28975 and SERVER-39705 for details.
-        if (auto filter = entry->getFilterExpression()) {
-            if (!exec::matcher::matchesBSON(filter, obj)) {
-                return Status::OK();
-            }
+        if (!matchesIndexFilter(entry, obj)) {
+            return Status::OK();
         }
 
         int64_t inserted = 0;
@@ -1436,10 +1493,8 @@ void SortedDataIndexAccessMethod::_unindexKeysOrWriteToSideTable(
         // The side table interface accepts only records that meet the criteria for this partial
         // index.
         // See SERVER-28975 and SERVER-39705 for details.
-        if (auto filter = entry->getFilterExpression()) {
-            if (!exec::matcher::matchesBSON(filter, obj)) {
-                return;
-            }
+        if (!matchesIndexFilter(entry, obj)) {
+            return;
         }
 
         int64_t removed = 0;
@@ -260,6 +260,15 @@ public:
                               const KeyHandlerFn& onDuplicateKeyInserted,
                               const RecordIdHandlerFn& onDuplicateRecord) = 0;
 
+        /**
+         * Moves all keys and multikey state out of 'other' and into this builder, leaving 'other'
+         * empty. 'other' must have been created by the same IndexAccessMethod. The absorbed keys
+         * arrive in sorted order, so they spill into this builder's sorter as pre-sorted runs that
+         * the final external merge consumes like any other. Used by parallel collection scans to
+         * fold per-partition sorter runs into the main builder.
+         */
+        virtual void mergeFrom(BulkBuilder& other) = 0;
+
         virtual const MultikeyPaths& getMultikeyPaths() const = 0;
 
         virtual bool isMultikey() const = 0;
@@ -46,7 +46,6 @@
 #include "mongo/db/exec/projection_executor.h"
 #include "mongo/db/exec/projection_executor_builder.h"
 #include "mongo/db/feature_flag.h"
-#include "mongo/db/field_ref.h"
 #include "mongo/db/index/wildcard_key_generator.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/pipeline/expression_context.h"
@@ -65,24 +64,6 @@ namespace {
 // to prevent the _id field from being indexed, since it already has its own dedicated index.
 static const BSONObj kDefaultProjection = BSON("_id"_sd << 0);
 
-// If the enclosing object is an array, then the current element's fieldname is the array index, so
-// we omit this when computing the full path. Otherwise, the full path is the pathPrefix plus the
-// element's fieldname.
-void pushPathComponent(BSONElement elem, bool enclosingObjIsArray, FieldRef* pathPrefix) {
-    if (!enclosingObjIsArray) {
-        pathPrefix->appendPart(elem.fieldNameStringData());
-    }
-}
-
-// If the enclosing object is not an array, then the final path component should be its field name.
-// Verify that this is the case and then pop it off the FieldRef.
-void popPathComponent(BSONElement elem, bool enclosingObjIsArray, FieldRef* pathToElem) {
-    if (!enclosingObjIsArray) {
-        invariant(pathToElem->getPart(pathToElem->numParts() - 1) == elem.fieldNameStringData());
-        pathToElem->removeLastPart();
-    }
-}
-
 // Append pre-extracted elements to 'keyString'. This function is used for compound wildcard index
 // keys generation.
 void appendToKeyString(const std::vector<BSONElement>& elems,
@@ -134,23 +115,48 @@ public:
           _keys(keys),
           _multikeyPaths(multikeyPaths),
           _preElems(preElems),
-          _postElems(postElems) {}
+          _postElems(postElems) {
+        _pathBuffer.reserve(64);
+        _pathEnds.reserve(8);
+    }
 
     // Traverses every path of the post-projection document, adding keys to the set as it goes.
-    void traverseWildcard(BSONObj obj, bool objIsArray, FieldRef* path);
+    // 'skipTopLevelField', when non-empty, names a single top-level field to bypass without
+    // generating keys; it lets the caller honor the default {_id: 0} projection without rewriting
+    // the document through the projection executor.
+    void traverseWildcard(BSONObj obj, bool objIsArray, StringData skipTopLevelField = StringData());
 
 private:
     // Helper functions to format the entry appropriately before adding it to the key/path tracker.
-    void _addMultiKey(const FieldRef& fullPath);
+    void _addMultiKey(StringData fullPath);
 
-    void _addKey(BSONElement elem, const FieldRef& fullPath);
+    void _addKey(BSONElement elem, StringData fullPath);
 
     // Helper to check whether the element is a nested array, and conditionally add it to 'keys'.
-    bool _addKeyForNestedArray(BSONElement elem,
-                               const FieldRef& fullPath,
-                               bool enclosingObjIsArray);
+    bool _addKeyForNestedArray(BSONElement elem, StringData fullPath, bool enclosingObjIsArray);
+
+    bool _addKeyForEmptyLeaf(BSONElement elem, StringData fullPath);
+
+    // The dotted path to the current element is maintained as a single reusable buffer plus a
+    // stack of component start offsets. Pushing a component appends bytes in place and popping
+    // truncates, avoiding the per-component string allocations and full-path reserialization that
+    // FieldRef performs on every push and key emission.
+    void _pushPathComponent(StringData part) {
+        _pathEnds.push_back(_pathBuffer.size());
+        if (!_pathBuffer.empty()) {
+            _pathBuffer.push_back('.');
+        }
+        _pathBuffer.append(part.data(), part.size());
+    }
 
-    bool _addKeyForEmptyLeaf(BSONElement elem, const FieldRef& fullPath);
+    void _popPathComponent() {
+        _pathBuffer.resize(_pathEnds.back());
+        _pathEnds.pop_back();
+    }
+
+    StringData _currentPath() const {
+        return _pathBuffer;
+    }
 
     const key_string::Version& _keyStringVersion;
     const Ordering& _ordering;
@@ -162,46 +168,58 @@ private:
     KeyStringSet::sequence_type* _multikeyPaths;
     const std::vector<BSONElement>& _preElems;
     const std::vector<BSONElement>& _postElems;
+    std::string _pathBuffer;
+    std::vector<size_t> _pathEnds;
 };
 
-void SingleDocumentKeyEncoder::traverseWildcard(BSONObj obj, bool objIsArray, FieldRef* path) {
+void SingleDocumentKeyEncoder::traverseWildcard(BSONObj obj,
+                                                bool objIsArray,
+                                                StringData skipTopLevelField) {
     for (const auto& elem : obj) {
+        const auto fieldName = elem.fieldNameStringData();
+
         // If the element's fieldName contains a ".", fast-path skip it because it's not queryable.
-        if (elem.fieldNameStringData().find('.', 0) != std::string::npos)
+        if (fieldName.find('.', 0) != std::string::npos)
             continue;
 
-        // Append the element's fieldname to the path, if the enclosing object is not an array.
-        pushPathComponent(elem, objIsArray, path);
+        if (!skipTopLevelField.empty() && fieldName == skipTopLevelField)
+            continue;
+
+        // Append the element's fieldname to the path, unless the enclosing object is an array, in
+        // which case the fieldname is the array index and is omitted from the path.
+        if (!objIsArray)
+            _pushPathComponent(fieldName);
 
         switch (elem.type()) {
             case BSONType::Array:
                 // If this is a nested array, we don't descend it but instead index it as a value.
-                if (_addKeyForNestedArray(elem, *path, objIsArray)) {
+                if (_addKeyForNestedArray(elem, _currentPath(), objIsArray)) {
                     break;
                 }
 
                 // Add an entry for the multi-key path, and then fall through to BSONType::Object.
-                _addMultiKey(*path);
+                _addMultiKey(_currentPath());
                 [[fallthrough]];
 
             case BSONType::Object:
-                if (_addKeyForEmptyLeaf(elem, *path)) {
+                if (_addKeyForEmptyLeaf(elem, _currentPath())) {
                     break;
                 }
 
-                traverseWildcard(elem.Obj(), elem.type() == BSONType::Array, path);
+                traverseWildcard(elem.Obj(), elem.type() == BSONType::Array);
                 break;
 
             default:
-                _addKey(elem, *path);
+                _addKey(elem, _currentPath());
         }
 
         // Remove the element's fieldname from the path, if it was pushed onto it earlier.
-        popPathComponent(elem, objIsArray, path);
+        if (!objIsArray)
+            _popPathComponent();
     }
 }
 
-void SingleDocumentKeyEncoder::_addKey(BSONElement elem, const FieldRef& fullPath) {
+void SingleDocumentKeyEncoder::_addKey(BSONElement elem, StringData fullPath) {
     // Wildcard keys are of the form { "": "path.to.field", "": <collation-aware value> }.
     key_string::PooledBuilder keyString(_pooledBufferBuilder, _keyStringVersion, _ordering);
 
@@ -209,7 +227,7 @@ void SingleDocumentKeyEncoder::_addKey(BSONElement elem, const FieldRef& fullPat
         appendToKeyString(_preElems, _collator, &keyString);
     }
 
-    keyString.appendString(fullPath.dottedField());
+    keyString.appendString(fullPath);
     if (_collator && elem) {
         keyString.appendBSONElement(elem, [&](StringData stringData) {
             return _collator->getComparisonString(stringData);
@@ -230,7 +248,7 @@ void SingleDocumentKeyEncoder::_addKey(BSONElement elem, const FieldRef& fullPat
     _keys->push_back(keyString.release());
 }
 
-void SingleDocumentKeyEncoder::_addMultiKey(const FieldRef& fullPath) {
+void SingleDocumentKeyEncoder::_addMultiKey(StringData fullPath) {
     // Multikey paths are denoted by a key of the form { "": 1, "": "path.to.array" }. The argument
     // 'multikeyPaths' may be nullptr if the access method is being used in an operation which does
     // not require multikey path generation.
@@ -240,9 +258,11 @@ void SingleDocumentKeyEncoder::_addMultiKey(const FieldRef& fullPath) {
         if (!_preElems.empty()) {
             appendToMultiKeyString(_preElems, &keyString);
         }
-        for (auto elem : BSON("" << 1 << "" << fullPath.dottedField())) {
-            keyString.appendBSONElement(elem);
-        }
+        // Append the { "": 1, "": "path.to.array" } pair directly instead of materializing a
+        // temporary BSONObj for every array encountered. The typed appends produce the same
+        // encoding as appending the equivalent BSONElements.
+        keyString.appendNumberInt(1);
+        keyString.appendString(fullPath);
         if (!_postElems.empty()) {
             appendToMultiKeyString(_postElems, &keyString);
         }
@@ -255,7 +275,7 @@ void SingleDocumentKeyEncoder::_addMultiKey(const FieldRef& fullPath) {
 }
 
 bool SingleDocumentKeyEncoder::_addKeyForNestedArray(BSONElement elem,
-                                                     const FieldRef& fullPath,
+                                                     StringData fullPath,
                                                      bool enclosingObjIsArray) {
     // If this element is an array whose parent is also an array, index it as a value.
     if (enclosingObjIsArray && elem.type() == BSONType::Array) {
@@ -265,7 +285,7 @@ bool SingleDocumentKeyEncoder::_addKeyForNestedArray(BSONElement elem,
     return false;
 }
 
-bool SingleDocumentKeyEncoder::_addKeyForEmptyLeaf(BSONElement elem, const FieldRef& fullPath) {
+bool SingleDocumentKeyEncoder::_addKeyForEmptyLeaf(BSONElement elem, StringData fullPath) {
     invariant(elem.isABSONObj());
     if (elem.embeddedObject().isEmpty()) {
         // In keeping with the behaviour of regular indexes, an empty object is indexed as-is while
@@ -334,6 +354,10 @@ WildcardKeyGenerator::WildcardKeyGenerator(BSONObj keyPattern,
     bool iteratorIsBeforeWildcard = true;
     for (auto elem : keyPattern) {
         if (WildcardNames::isWildcardFieldName(elem.fieldNameStringData())) {
+            // A root "$**" field with no user projection implies the default {_id: 0} projection,
+            // which generateKeys() can honor without running the projection executor.
+            _indexesAllPaths = elem.fieldNameStringData() == WildcardNames::WILDCARD_FIELD_NAME &&
+                pathProjection.isEmpty();
             iteratorIsBeforeWildcard = false;
         } else if (iteratorIsBeforeWildcard) {
             preElems.push_back(BSONElement());
@@ -384,7 +408,6 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
         postElemsExist = _postBtreeGenerator->extractElements(inputDoc, &postElems);
     }
 
-    FieldRef rootPath;
     auto keysSequence = keys->extract_sequence();
     auto sequenceSize = keysSequence.size();
     // multikeyPaths is allowed to be nullptr
@@ -403,8 +426,15 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
                                         preElems,
                                         postElems};
 
-    keyEncoder.traverseWildcard(
-        _proj.exec()->applyTransformation(Document{inputDoc}).toBson(), false, &rootPath);
+    if (_indexesAllPaths) {
+        // The projection would only strip the top-level _id field, so traverse the input document
+        // directly and skip _id, rather than rewriting the whole document through the projection
+        // executor.
+        keyEncoder.traverseWildcard(inputDoc, false, "_id"_sd);
+    } else {
+        keyEncoder.traverseWildcard(
+            _proj.exec()->applyTransformation(Document{inputDoc}).toBson(), false);
+    }
 
     // If no key is generated for this index at this point, that means the document doesn't have any
     // field that is indexed by the wildcard field. We should still add index keys for this
@@ -106,5 +106,9 @@ private:
     const boost::optional<KeyFormat> _rsKeyFormat;
     boost::optional<BtreeKeyGenerator> _preBtreeGenerator = boost::none;
     boost::optional<BtreeKeyGenerator> _postBtreeGenerator = boost::none;
+
+    // True when the index covers all paths with the default {_id: 0} projection, in which case
+    // generateKeys() traverses the input document directly instead of applying the projection.
+    bool _indexesAllPaths = false;
 };
 }  // namespace mongo
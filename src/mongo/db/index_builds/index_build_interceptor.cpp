@@ -39,8 +39,10 @@
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 
+#include "mongo/base/data_type_endian.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status_with.h"
+#include "mongo/base/string_data.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
@@ -72,6 +74,7 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/bufreader.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/namespace_string_util.h"
 #include "mongo/util/progress_meter.h"
@@ -88,6 +91,21 @@ MONGO_FAIL_POINT_DEFINE(hangDuringIndexBuildDrainYieldSecond);
 MONGO_FAIL_POINT_DEFINE(hangIndexBuildDuringDrainWritesPhase);
 MONGO_FAIL_POINT_DEFINE(hangIndexBuildDuringDrainWritesPhaseSecond);
 
+namespace {
+/**
+ * Returns the keystring portion of a serialized side-write 'key' field. The serialized format is
+ * [keystring size][keystring encoding][typebits encoding], and only the keystring bytes are
+ * byte-comparable. The returned view points into the operation document.
+ */
+StringData extractKeyStringBytes(const BSONObj& operation) {
+    int binLen;
+    const char* binData = operation["key"].binData(binLen);
+    BufReader reader(binData, binLen);
+    const int32_t ksSize = reader.read<LittleEndian<int32_t>>();
+    return reader.readBytes(ksSize);
+}
+}  // namespace
+
 IndexBuildInterceptor::IndexBuildInterceptor(OperationContext* opCtx,
                                              const IndexCatalogEntry* entry)
     : _sideWritesTable(opCtx->getServiceContext()->getStorageEngine()->makeTemporaryRecordStore(
@@ -203,7 +221,7 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
     const int32_t kBatchMaxBytes = kBatchMaxMB * kMB;
 
     // In a single WriteUnitOfWork, scan the side table up to the batch or memory limit, apply the
-    // keys to the index, and delete the side table records.
+    // keys to the index in key order, and delete the side table records.
     // Returns true if the cursor has reached the end of the table, false if there are more records,
     // and an error Status otherwise.
     auto applySingleBatch = [&]() -> StatusWith<bool> {
@@ -223,15 +241,20 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
 
         auto cursor = _sideWritesTable->rs()->getCursor(opCtx);
 
-        // We use an ordered container because the order of deletion for the records in the side
-        // table matters.
-        std::vector<RecordId> recordsAddedToIndex;
+        // The batch is read and deleted in table order, which matters for the records in the side
+        // table, but applied to the index in key order below.
+        struct BatchedSideWrite {
+            RecordId recordId;
+            BSONObj operation;
+            // Points into 'operation', which shares its buffer across moves.
+            StringData keyBytes;
+        };
+        std::vector<BatchedSideWrite> batch;
 
         auto record = cursor->next();
         while (record) {
             opCtx->checkForInterrupt();
 
-            auto& currentRecordId = record->id;
             BSONObj unownedDoc = record->data.toBson();
 
             // Don't apply this record if the total batch size in bytes would be too large.
@@ -240,19 +263,55 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
                 break;
             }
 
-            const long long iteration = _numApplied + batchSize;
+            batchSize += 1;
+            batchSizeBytes += objSize;
+
+            // The cursor advances before the batch is applied, so the document must own its
+            // storage.
+            auto ownedDoc = unownedDoc.getOwned();
+            auto keyBytes = extractKeyStringBytes(ownedDoc);
+            batch.push_back({std::move(record->id), std::move(ownedDoc), keyBytes});
+
+            // Don't continue if the batch is full. Allow the transaction to commit.
+            if (batchSize == kBatchMaxSize) {
+                break;
+            }
+
+            record = cursor->next();
+        }
+
+        if (batch.empty()) {
+            invariant(!record);
+            return true;
+        }
+
+        // Apply the batch in key order so that the index cursor descends the tree in one
+        // direction, visiting each leaf page once per batch rather than once per key. The sort
+        // must be stable: multiple operations on the same key have to be applied in the order they
+        // were recorded for insert/delete sequences on that key to resolve correctly.
+        std::vector<const BatchedSideWrite*> applyOrder;
+        applyOrder.reserve(batch.size());
+        for (const auto& entry : batch) {
+            applyOrder.push_back(&entry);
+        }
+        std::stable_sort(applyOrder.begin(),
+                         applyOrder.end(),
+                         [](const BatchedSideWrite* lhs, const BatchedSideWrite* rhs) {
+                             return lhs->keyBytes < rhs->keyBytes;
+                         });
+
+        long long iteration = _numApplied;
+        for (const auto* entry : applyOrder) {
             _checkDrainPhaseFailPoint(
                 opCtx, indexCatalogEntry, &hangIndexBuildDuringDrainWritesPhase, iteration);
             _checkDrainPhaseFailPoint(
                 opCtx, indexCatalogEntry, &hangIndexBuildDuringDrainWritesPhaseSecond, iteration);
-
-            batchSize += 1;
-            batchSizeBytes += objSize;
+            iteration++;
 
             if (auto status = _applyWrite(opCtx,
                                           coll,
                                           indexCatalogEntry,
-                                          unownedDoc,
+                                          entry->operation,
                                           options,
                                           trackDuplicates,
                                           &totalInserted,
@@ -260,28 +319,14 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
                 !status.isOK()) {
                 return status;
             }
-
-            // Save the record ids of the documents inserted into the index for deletion later.
-            // We can't delete records while holding a positioned cursor.
-            recordsAddedToIndex.emplace_back(std::move(currentRecordId));
-
-            // Don't continue if the batch is full. Allow the transaction to commit.
-            if (batchSize == kBatchMaxSize) {
-                break;
-            }
-
-            record = cursor->next();
         }
 
         // Delete documents from the side table as soon as they have been inserted into the index.
-        // This ensures that no key is ever inserted twice and no keys are skipped.
-        for (const auto& recordId : recordsAddedToIndex) {
-            _sideWritesTable->rs()->deleteRecord(opCtx, recordId);
-        }
-
-        if (batchSize == 0) {
-            invariant(!record);
-            return true;
+        // This ensures that no key is ever inserted twice and no keys are skipped. We can't delete
+        // records while holding a positioned cursor, and deletion happens in the order the records
+        // were read.
+        for (const auto& entry : batch) {
+            _sideWritesTable->rs()->deleteRecord(opCtx, entry.recordId);
         }
 
         wuow.commit();
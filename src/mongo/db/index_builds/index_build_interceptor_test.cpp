@@ -42,8 +42,10 @@
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index_builds/index_build_interceptor.h"
+#include "mongo/db/record_id.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/unittest/assert.h"
@@ -105,6 +107,10 @@ protected:
                                                                           indexName);
     }
 
+    const CollectionPtr& collection() const {
+        return _coll->getCollection();
+    }
+
     void setUp() override {
         CatalogTestFixture::setUp();
         ASSERT_OK(storageInterface()->createCollection(operationContext(), _nss, {}));
@@ -152,5 +158,46 @@ TEST_F(IndexBuilderInterceptorTest, SingleInsertIsSavedToSideWritesTable) {
                            << "key" << serializedKeyString),
                       sideWrites[0]);
 }
+
+TEST_F(IndexBuilderInterceptorTest, DrainAppliesSideWritesAndEmptiesTable) {
+    auto interceptor = createIndexBuildInterceptor(fromjson("{v: 2, name: 'a_1', key: {a: 1}}"));
+    const IndexDescriptor* desc = getIndexDescriptor("a_1");
+
+    // Record side writes in descending key order. The drain sorts each batch and applies it in
+    // ascending key order, so this exercises the reordering.
+    constexpr int kNumKeys = 10;
+    {
+        WriteUnitOfWork wuow(operationContext());
+        for (int i = kNumKeys - 1; i >= 0; i--) {
+            key_string::HeapBuilder ksBuilder(key_string::Version::kLatestVersion);
+            ksBuilder.appendNumberLong(i);
+            ksBuilder.appendRecordId(RecordId(i + 1));
+            key_string::Value keyString(ksBuilder.release());
+
+            int64_t numKeys = 0;
+            ASSERT_OK(interceptor->sideWrite(operationContext(),
+                                             desc->getEntry(),
+                                             {keyString},
+                                             {},
+                                             {},
+                                             IndexBuildInterceptor::Op::kInsert,
+                                             &numKeys));
+            ASSERT_EQ(1, numKeys);
+        }
+        wuow.commit();
+    }
+
+    ASSERT_FALSE(interceptor->areAllWritesApplied(operationContext()));
+
+    InsertDeleteOptions options;
+    options.dupsAllowed = true;
+    ASSERT_OK(interceptor->drainWritesIntoIndex(operationContext(),
+                                                collection(),
+                                                desc->getEntry(),
+                                                options,
+                                                IndexBuildInterceptor::TrackDuplicates::kNoTrack,
+                                                IndexBuildInterceptor::DrainYieldPolicy::kNoYield));
+    ASSERT_TRUE(interceptor->areAllWritesApplied(operationContext()));
+}
 }  // namespace
 }  // namespace mongo
@@ -49,6 +49,7 @@
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/collection_yield_restore.h"
+#include "mongo/db/catalog_raii.h"
 #include "mongo/db/client.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/exception_util.h"
@@ -90,7 +91,9 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/duration.h"
@@ -603,12 +606,28 @@ Status MultiIndexBlock::insertAllDocumentsInCollection(
         timer.reset();
 
         try {
+            // Parallel scans are restricted to fresh hybrid builds: resumed builds carry a scan
+            // position that only the serial scan honors, time-series mixed-schema detection is
+            // only wired into the serial insert path, and capped collections can reposition
+            // cursors mid-scan.
+            const int numScanThreads = maxIndexBuildCollectionScanThreads.load();
+            const bool parallelScanEligible = numScanThreads > 1 && isBackgroundBuilding() &&
+                numScanRestarts == 0 && !resumeAfterRecordId &&
+                _phase == IndexBuildPhaseEnum::kInitialized &&
+                !_containsIndexBuildOnTimeseriesMeasurement && !collection->isCapped() &&
+                !shard_role_details::getLocker(opCtx)->isCollectionLockedForMode(collection->ns(),
+                                                                                 MODE_X);
+
             // Resumable index builds can only be resumed prior to the oplog recovery phase of
             // startup. When restarting the collection scan, any saved index build progress is lost.
-            _doCollectionScan(opCtx,
-                              collection,
-                              numScanRestarts == 0 ? resumeAfterRecordId : boost::none,
-                              &progress);
+            if (parallelScanEligible) {
+                _doParallelCollectionScan(opCtx, collection, &progress, numScanThreads);
+            } else {
+                _doCollectionScan(opCtx,
+                                  collection,
+                                  numScanRestarts == 0 ? resumeAfterRecordId : boost::none,
+                                  &progress);
+            }
 
             LOGV2(20391,
                   "Index build: collection scan done",
@@ -771,6 +790,292 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
     }
 }
 
+void MultiIndexBlock::_doParallelCollectionScan(OperationContext* opCtx,
+                                                const CollectionPtr& collection,
+                                                ProgressMeterHolder* progress,
+                                                int numScanThreads) {
+    invariant(_phase == IndexBuildPhaseEnum::kInitialized,
+              IndexBuildPhase_serializer(_phase).toString());
+
+    auto bounds = _samplePartitionBounds(opCtx, collection, numScanThreads - 1);
+    if (bounds.empty()) {
+        // The collection is too small to partition; a serial scan will be just as fast.
+        _doCollectionScan(opCtx, collection, boost::none, progress);
+        return;
+    }
+    _phase = IndexBuildPhaseEnum::kCollectionScan;
+
+    const size_t numPartitions = bounds.size() + 1;
+
+    LOGV2(9876509,
+          "Index build: starting parallel collection scan",
+          "buildUUID"_attr = _buildUUID,
+          "collectionUUID"_attr = _collectionUUID,
+          logAttrs(collection->ns()),
+          "numPartitions"_attr = numPartitions);
+
+    // Each partition generates keys into its own set of bulk builders so that its sorter runs are
+    // produced without synchronization. The runs are only merged into the main builders once every
+    // partition has completed, so an interrupted scan leaves the main builders empty and a build
+    // resumed after shutdown restarts the scan from the beginning.
+    const auto perPartitionMaxMemoryBytes =
+        getEachIndexBuildMaxMemoryUsageBytes(_indexes.size()) / numPartitions;
+    std::vector<std::vector<std::unique_ptr<IndexAccessMethod::BulkBuilder>>> partitionBuilders(
+        numPartitions);
+    for (auto& builders : partitionBuilders) {
+        for (auto& index : _indexes) {
+            builders.push_back(index.real->initiateBulk(index.block->getEntry(opCtx, collection),
+                                                        perPartitionMaxMemoryBytes,
+                                                        boost::none,
+                                                        collection->ns().dbName()));
+        }
+    }
+
+    AtomicWord<bool> scanFailed{false};
+    // Each slot is written by exactly one thread and read only after the pool has been joined.
+    std::vector<Status> partitionResults(numPartitions, Status::OK());
+
+    // Live worker operation contexts, so that a failed or interrupted scan can kill workers that
+    // are still blocked acquiring locks or reading. Workers deregister themselves before their
+    // operation context is destroyed.
+    stdx::mutex workerOpCtxsMutex;
+    std::vector<OperationContext*> workerOpCtxs;
+
+    auto killWorkers = [&] {
+        stdx::lock_guard<stdx::mutex> lg(workerOpCtxsMutex);
+        for (auto* workerOpCtx : workerOpCtxs) {
+            ClientLock lk(workerOpCtx->getClient());
+            getGlobalServiceContext()->killOperation(lk, workerOpCtx, ErrorCodes::Interrupted);
+        }
+    };
+
+    ThreadPool::Options options;
+    options.poolName = "IndexBuildCollectionScan";
+    options.minThreads = 0;
+    options.maxThreads = numPartitions - 1;
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName,
+                           getGlobalServiceContext()->getService(ClusterRole::ShardServer),
+                           Client::noSession(),
+                           ClientOperationKillableByStepdown{false});
+    };
+    ThreadPool pool(options);
+    pool.startup();
+
+    const NamespaceStringOrUUID nssOrUUID(collection->ns().dbName(), _collectionUUID.value());
+    Client* progressClient = opCtx->getClient();
+    for (size_t partition = 1; partition < numPartitions; partition++) {
+        pool.schedule([&, partition](Status status) {
+            if (!status.isOK()) {
+                partitionResults[partition] = status;
+                scanFailed.store(true);
+                return;
+            }
+            try {
+                auto workerOpCtx = cc().makeOperationContext();
+                {
+                    stdx::lock_guard<stdx::mutex> lg(workerOpCtxsMutex);
+                    workerOpCtxs.push_back(workerOpCtx.get());
+                }
+                ScopeGuard deregister([&] {
+                    stdx::lock_guard<stdx::mutex> lg(workerOpCtxsMutex);
+                    workerOpCtxs.erase(std::find(
+                        workerOpCtxs.begin(), workerOpCtxs.end(), workerOpCtx.get()));
+                });
+
+                // Check for failure only after registering: any failure observed after this point
+                // kills the registered operation context, so a blocked lock acquisition below
+                // remains interruptible.
+                if (scanFailed.load()) {
+                    return;
+                }
+
+                // The collection cannot be dropped out from under us; the index builder thread
+                // holds it in at least MODE_IX for the duration of the scan.
+                AutoGetCollection workerColl(workerOpCtx.get(), nssOrUUID, MODE_IS);
+                invariant(workerColl.getCollection());
+                _scanPartition(workerOpCtx.get(),
+                               workerColl.getCollection(),
+                               bounds[partition - 1],
+                               partition < bounds.size()
+                                   ? boost::optional<RecordId>(bounds[partition])
+                                   : boost::none,
+                               partitionBuilders[partition],
+                               progress,
+                               progressClient,
+                               &scanFailed);
+            } catch (...) {
+                partitionResults[partition] = exceptionToStatus();
+                scanFailed.store(true);
+            }
+        });
+    }
+
+    // Scan the first partition on this thread so that the index build remains responsive to
+    // interrupts while the pool drains.
+    try {
+        _scanPartition(opCtx,
+                       collection,
+                       boost::none,
+                       bounds[0],
+                       partitionBuilders[0],
+                       progress,
+                       progressClient,
+                       &scanFailed);
+    } catch (...) {
+        partitionResults[0] = exceptionToStatus();
+        scanFailed.store(true);
+    }
+
+    if (scanFailed.load()) {
+        killWorkers();
+    }
+    pool.shutdown();
+    pool.join();
+
+    for (const auto& result : partitionResults) {
+        uassertStatusOK(result);
+    }
+
+    // All partitions completed, so fold each partition's sorted runs into the main builders for
+    // the external merge in the bulk load phase to consume.
+    for (auto& builders : partitionBuilders) {
+        for (size_t i = 0; i < _indexes.size(); i++) {
+            _indexes[i].bulk->mergeFrom(*builders[i]);
+        }
+    }
+}
+
+std::vector<RecordId> MultiIndexBlock::_samplePartitionBounds(OperationContext* opCtx,
+                                                              const CollectionPtr& collection,
+                                                              int numSplitPoints) {
+    // Estimate partition boundaries from a uniform random sample of the record store so that each
+    // partition covers a roughly equal number of records.
+    static constexpr int kSamplesPerPartition = 16;
+
+    auto randomCursor = collection->getRecordStore()->getRandomCursor(opCtx);
+    if (!randomCursor) {
+        return {};
+    }
+
+    const auto numSamples = static_cast<size_t>(numSplitPoints + 1) * kSamplesPerPartition;
+    std::vector<RecordId> samples;
+    samples.reserve(numSamples);
+    while (samples.size() < numSamples) {
+        auto record = randomCursor->next();
+        if (!record) {
+            break;
+        }
+        samples.push_back(std::move(record->id));
+    }
+    std::sort(samples.begin(), samples.end());
+    samples.erase(std::unique(samples.begin(), samples.end()), samples.end());
+    if (samples.size() < static_cast<size_t>(kSamplesPerPartition)) {
+        return {};
+    }
+
+    // Take evenly spaced quantiles of the sample as the split points. Removing duplicate samples
+    // may leave fewer distinct split points, and with them fewer partitions, than requested.
+    std::vector<RecordId> bounds;
+    for (int i = 1; i <= numSplitPoints; i++) {
+        const auto& candidate = samples[i * samples.size() / (numSplitPoints + 1)];
+        if (bounds.empty() || candidate > bounds.back()) {
+            bounds.push_back(candidate);
+        }
+    }
+    return bounds;
+}
+
+void MultiIndexBlock::_scanPartition(
+    OperationContext* opCtx,
+    const CollectionPtr& collection,
+    const boost::optional<RecordId>& min,
+    const boost::optional<RecordId>& max,
+    const std::vector<std::unique_ptr<IndexAccessMethod::BulkBuilder>>& builders,
+    ProgressMeterHolder* progress,
+    Client* progressClient,
+    AtomicWord<bool>* scanFailed) {
+    // The number of records scanned between progress updates and snapshot changes.
+    static constexpr int kScanBatchSize = 1000;
+
+    invariant(builders.size() == _indexes.size());
+
+    std::vector<const IndexCatalogEntry*> entries;
+    std::vector<InsertDeleteOptions> options;
+    entries.reserve(_indexes.size());
+    options.reserve(_indexes.size());
+    for (auto& index : _indexes) {
+        entries.push_back(index.block->getEntry(opCtx, collection));
+
+        // Relax constraints unconditionally: the callback-based enforcement mode asserts locks
+        // that partition scan threads do not hold. Suppressed errors are recorded as skipped and
+        // retried before the build commits, so they still fail the build on primaries.
+        auto indexOptions = index.options;
+        indexOptions.getKeysMode =
+            InsertDeleteOptions::ConstraintEnforcementMode::kRelaxConstraints;
+        options.push_back(indexOptions);
+    }
+
+    // Hint to the storage engine that this collection scan should not keep data in the cache.
+    shard_role_details::getRecoveryUnit(opCtx)->setReadOnce(
+        useReadOnceCursorsForIndexBuilds.load());
+
+    auto cursor = collection->getRecordStore()->getCursor(opCtx);
+
+    BSONObj objToIndex;
+    std::function<void()> saveCursorBeforeWrite = [&cursor, &objToIndex] {
+        // Update objToIndex so that it continues to point to valid data when the cursor is closed.
+        objToIndex = objToIndex.getOwned();
+        cursor->save();
+    };
+    std::function<void()> restoreCursorAfterWrite = [&cursor] {
+        invariant(cursor->restore());
+    };
+    const auto onSuppressedError =
+        makeOnSuppressedErrorFn(saveCursorBeforeWrite, restoreCursorAfterWrite);
+
+    int recordsSinceLastBatch = 0;
+    auto record = min ? cursor->seek(*min, SeekableRecordCursor::BoundInclusion::kInclude)
+                      : cursor->next();
+    while (record && !(max && record->id >= *max)) {
+        opCtx->checkForInterrupt();
+        if (scanFailed->load()) {
+            break;
+        }
+
+        objToIndex = record->data.toBson();
+        for (size_t i = 0; i < _indexes.size(); i++) {
+            if (_indexes[i].filterExpression &&
+                !exec::matcher::matchesBSON(_indexes[i].filterExpression, objToIndex)) {
+                continue;
+            }
+            uassertStatusOK(builders[i]->insert(
+                opCtx, collection, entries[i], objToIndex, record->id, options[i],
+                onSuppressedError));
+        }
+
+        if (++recordsSinceLastBatch >= kScanBatchSize) {
+            {
+                stdx::unique_lock<Client> lk(*progressClient);
+                progress->get(lk)->hit(recordsSinceLastBatch);
+            }
+            recordsSinceLastBatch = 0;
+
+            // Change snapshots periodically so that the scan does not pin storage engine history
+            // for its entire duration.
+            cursor->save();
+            shard_role_details::getRecoveryUnit(opCtx)->abandonSnapshot();
+            invariant(cursor->restore());
+        }
+        record = cursor->next();
+    }
+
+    if (recordsSinceLastBatch > 0) {
+        stdx::unique_lock<Client> lk(*progressClient);
+        progress->get(lk)->hit(recordsSinceLastBatch);
+    }
+}
+
 Status MultiIndexBlock::insertSingleDocumentForInitialSyncOrRecovery(
     OperationContext* opCtx,
     const CollectionPtr& collection,
@@ -57,11 +57,13 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/uuid.h"
 
 namespace mongo {
 
+class Client;
 class Collection;
 class CollectionPtr;
 class MatchExpression;
@@ -357,6 +359,41 @@ private:
                            const boost::optional<RecordId>& resumeAfterRecordId,
                            ProgressMeterHolder* progress);
 
+    /**
+     * Scans the collection on multiple threads, partitioned by RecordId range, generating keys
+     * into per-partition bulk builders whose sorted runs are merged into the main builders once
+     * every partition has completed. Falls back to the serial collection scan when partition
+     * boundaries cannot be sampled.
+     */
+    void _doParallelCollectionScan(OperationContext* opCtx,
+                                   const CollectionPtr& collection,
+                                   ProgressMeterHolder* progress,
+                                   int numScanThreads);
+
+    /**
+     * Samples the collection and returns up to 'numSplitPoints' distinct RecordIds, in ascending
+     * order, to use as partition boundaries for a parallel collection scan. Returns an empty
+     * vector when the collection is too small to partition.
+     */
+    std::vector<RecordId> _samplePartitionBounds(OperationContext* opCtx,
+                                                 const CollectionPtr& collection,
+                                                 int numSplitPoints);
+
+    /**
+     * Scans all records in ['min', 'max') on the calling thread, unbounded on either end when not
+     * set, and generates keys for each index into the corresponding builder in 'builders'.
+     * 'progressClient' owns the progress meter and may belong to another thread. Stops early when
+     * 'scanFailed' has been set by a failed sibling partition.
+     */
+    void _scanPartition(OperationContext* opCtx,
+                        const CollectionPtr& collection,
+                        const boost::optional<RecordId>& min,
+                        const boost::optional<RecordId>& max,
+                        const std::vector<std::unique_ptr<IndexAccessMethod::BulkBuilder>>& builders,
+                        ProgressMeterHolder* progress,
+                        Client* progressClient,
+                        AtomicWord<bool>* scanFailed);
+
     // Is set during init() and ensures subsequent function calls act on the same Collection.
     boost::optional<UUID> _collectionUUID;
 
@@ -383,6 +383,7 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
 
         lv2Config.consoleEnabled = false;
         lv2Config.fileEnabled = true;
+        lv2Config.fileAsyncEnabled = serverGlobalParams.logAsync;
         lv2Config.filePath = absoluteLogpath;
         lv2Config.fileRotationMode = serverGlobalParams.logRenameOnRotate
             ? logv2::LogDomainGlobal::ConfigurationOptions::RotationMode::kRename
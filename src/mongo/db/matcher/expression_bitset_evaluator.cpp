@@ -0,0 +1,102 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/matcher/expression_bitset_evaluator.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "mongo/db/exec/matcher/matcher.h"
+#include "mongo/db/matcher/matchable.h"
+
+namespace mongo {
+using boolean_simplification::Bitset;
+using boolean_simplification::BitsetTreeNode;
+
+boost::optional<BitsetMatchExpressionEvaluator> BitsetMatchExpressionEvaluator::compile(
+    const MatchExpression* root, size_t maximumNumberOfUniquePredicates) {
+    auto transformResult = transformToBitsetTree(root, maximumNumberOfUniquePredicates);
+    if (!transformResult) {
+        return boost::none;
+    }
+    return BitsetMatchExpressionEvaluator{std::move(*transformResult)};
+}
+
+BitsetMatchExpressionEvaluator::BitsetMatchExpressionEvaluator(BitsetTreeTransformResult result)
+    : _tree(std::move(result.bitsetTree)), _leaves(std::move(result.expressions)) {
+    // Give every node's bitsets the same size as the result bitset so that the evaluation can
+    // compare raw blocks without bounds checks.
+    _tree.ensureBitsetSize(_leaves.size());
+}
+
+bool BitsetMatchExpressionEvaluator::matchesBSON(const BSONObj& doc) const {
+    BSONMatchableDocument matchableDoc{doc};
+    Bitset results{_leaves.size()};
+    for (size_t bit = 0; bit < _leaves.size(); ++bit) {
+        results.set(bit, exec::matcher::matches(_leaves[bit].expression, &matchableDoc));
+    }
+    return evaluateNode(_tree, results);
+}
+
+bool BitsetMatchExpressionEvaluator::evaluateNode(const BitsetTreeNode& node,
+                                                  const Bitset& results) {
+    const auto& predicates = node.leafChildren.predicates;
+    const auto& mask = node.leafChildren.mask;
+
+    bool result = false;
+    switch (node.type) {
+        case BitsetTreeNode::And:
+            // Within the mask every result bit has to coincide with the expected predicate value.
+            result = allOf([](auto r, auto p, auto m) { return ((r ^ p) & m) == 0; },
+                           results,
+                           predicates,
+                           mask) &&
+                std::all_of(node.internalChildren.begin(),
+                            node.internalChildren.end(),
+                            [&](const BitsetTreeNode& child) {
+                                return evaluateNode(child, results);
+                            });
+            break;
+        case BitsetTreeNode::Or:
+            // At least one result bit within the mask has to coincide with its expected value.
+            result = anyOf([](auto r, auto p, auto m) { return ~(r ^ p) & m; },
+                           results,
+                           predicates,
+                           mask) ||
+                std::any_of(node.internalChildren.begin(),
+                            node.internalChildren.end(),
+                            [&](const BitsetTreeNode& child) {
+                                return evaluateNode(child, results);
+                            });
+            break;
+    }
+
+    return node.isNegated ? !result : result;
+}
+}  // namespace mongo
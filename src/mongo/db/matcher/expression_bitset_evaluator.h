@@ -0,0 +1,85 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/matcher/expression.h"
+#include "mongo/db/matcher/expression_bitset_tree_converter.h"
+#include "mongo/db/query/boolean_simplification/bitset_algebra.h"
+#include "mongo/db/query/boolean_simplification/bitset_tree.h"
+
+namespace mongo {
+/**
+ * Evaluates a MatchExpression compiled into a bitset tree. The unique leaf predicates of the
+ * expression are evaluated into a bitset of per-predicate results, after which the boolean
+ * structure of the tree is decided with a few masked block compares instead of a recursive
+ * dispatch through every tree node. Wide, flat predicates (e.g. a $or of dozens of equalities)
+ * benefit the most: every leaf is evaluated exactly once per document even if the original tree
+ * mentions it several times, and the per-document boolean work is branchless bit arithmetic.
+ *
+ * The evaluator stores pointers into the MatchExpression it was compiled from, so the expression
+ * must outlive the evaluator.
+ */
+class BitsetMatchExpressionEvaluator {
+public:
+    /**
+     * Compiles 'root' into an evaluator. Returns boost::none if the tree cannot be represented as
+     * a bitset tree (e.g. it contains schema expressions) or contains more than
+     * 'maximumNumberOfUniquePredicates' unique leaf predicates.
+     */
+    static boost::optional<BitsetMatchExpressionEvaluator> compile(
+        const MatchExpression* root, size_t maximumNumberOfUniquePredicates);
+
+    /**
+     * Returns true if 'doc' satisfies the compiled expression.
+     */
+    bool matchesBSON(const BSONObj& doc) const;
+
+    /**
+     * The number of unique leaf predicates evaluated per document.
+     */
+    size_t numPredicates() const {
+        return _leaves.size();
+    }
+
+private:
+    explicit BitsetMatchExpressionEvaluator(BitsetTreeTransformResult result);
+
+    static bool evaluateNode(const boolean_simplification::BitsetTreeNode& node,
+                             const boolean_simplification::Bitset& results);
+
+    boolean_simplification::BitsetTreeNode _tree;
+    BitsetTreeTransformResult::ExpressionList _leaves;
+};
+}  // namespace mongo
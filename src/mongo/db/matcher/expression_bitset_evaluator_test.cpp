@@ -0,0 +1,134 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/matcher/expression_bitset_evaluator.h"
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "mongo/bson/json.h"
+#include "mongo/db/exec/matcher/matcher.h"
+#include "mongo/db/matcher/expression.h"
+#include "mongo/db/matcher/extensions_callback_noop.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+std::unique_ptr<MatchExpression> parse(BSONObj bsonExpr) {
+    QueryTestServiceContext serviceContext{};
+    auto opCtx = serviceContext.makeOperationContext();
+    auto expCtx = make_intrusive<ExpressionContextForTest>(opCtx.get());
+
+    auto expr = MatchExpressionParser::parse(bsonExpr,
+                                             expCtx,
+                                             ExtensionsCallbackNoop(),
+                                             MatchExpressionParser::kAllowAllSpecialFeatures);
+
+    ASSERT_OK(expr);
+    return std::move(expr.getValue());
+}
+
+/**
+ * Compiles 'bsonExpr' and asserts that the evaluator agrees with the tree-walking matcher on every
+ * document in 'docs'.
+ */
+void assertAgreesWithMatcher(BSONObj bsonExpr, const std::vector<BSONObj>& docs) {
+    auto expr = parse(bsonExpr);
+    auto evaluator = BitsetMatchExpressionEvaluator::compile(expr.get(),
+                                                             std::numeric_limits<size_t>::max());
+    ASSERT_TRUE(evaluator.has_value());
+    for (const auto& doc : docs) {
+        ASSERT_EQ(exec::matcher::matchesBSON(expr.get(), doc), evaluator->matchesBSON(doc))
+            << "filter: " << bsonExpr << " document: " << doc;
+    }
+}
+
+TEST(BitsetMatchExpressionEvaluatorTest, SimpleConjunction) {
+    assertAgreesWithMatcher(fromjson("{a: 1, b: 2}"),
+                            {fromjson("{a: 1, b: 2}"),
+                             fromjson("{a: 1, b: 3}"),
+                             fromjson("{a: 2, b: 2}"),
+                             fromjson("{b: 2}"),
+                             fromjson("{}")});
+}
+
+TEST(BitsetMatchExpressionEvaluatorTest, WideDisjunction) {
+    BSONArrayBuilder clauses;
+    for (int i = 0; i < 40; ++i) {
+        clauses.append(BSON("a" << i));
+    }
+    auto filter = BSON("$or" << clauses.arr());
+
+    std::vector<BSONObj> docs;
+    for (int i = -1; i < 41; ++i) {
+        docs.push_back(BSON("a" << i));
+    }
+    docs.push_back(fromjson("{b: 1}"));
+    assertAgreesWithMatcher(filter, docs);
+}
+
+TEST(BitsetMatchExpressionEvaluatorTest, NestedTreeWithNegations) {
+    assertAgreesWithMatcher(
+        fromjson("{$and: [{a: {$ne: 5}}, {$or: [{b: {$gt: 10}}, {$nor: [{c: 1}, {d: 1}]}]}]}"),
+        {fromjson("{a: 1, b: 20}"),
+         fromjson("{a: 5, b: 20}"),
+         fromjson("{a: 1, b: 1, c: 1}"),
+         fromjson("{a: 1, b: 1, d: 1}"),
+         fromjson("{a: 1, b: 1}"),
+         fromjson("{}")});
+}
+
+TEST(BitsetMatchExpressionEvaluatorTest, EvaluatesDuplicatedPredicateOnce) {
+    auto expr = parse(fromjson("{$or: [{a: 1}, {$and: [{a: 1}, {b: 2}]}]}"));
+    auto evaluator = BitsetMatchExpressionEvaluator::compile(expr.get(),
+                                                             std::numeric_limits<size_t>::max());
+    ASSERT_TRUE(evaluator.has_value());
+    // {a: 1} appears twice in the tree but is a single compiled predicate.
+    ASSERT_EQ(2UL, evaluator->numPredicates());
+    ASSERT_TRUE(evaluator->matchesBSON(fromjson("{a: 1}")));
+    ASSERT_FALSE(evaluator->matchesBSON(fromjson("{a: 2, b: 2}")));
+}
+
+TEST(BitsetMatchExpressionEvaluatorTest, AlwaysBooleanExpressions) {
+    assertAgreesWithMatcher(fromjson("{$alwaysTrue: 1}"), {fromjson("{}"), fromjson("{a: 1}")});
+    assertAgreesWithMatcher(fromjson("{$alwaysFalse: 1}"), {fromjson("{}"), fromjson("{a: 1}")});
+}
+
+TEST(BitsetMatchExpressionEvaluatorTest, FailsToCompileOverPredicateLimit) {
+    auto expr = parse(fromjson("{$or: [{a: 1}, {b: 1}, {c: 1}]}"));
+    auto evaluator = BitsetMatchExpressionEvaluator::compile(expr.get(), 2);
+    ASSERT_FALSE(evaluator.has_value());
+}
+
+}  // namespace
+}  // namespace mongo
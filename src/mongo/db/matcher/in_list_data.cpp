@@ -57,7 +57,9 @@ InListData::InListData(CloneCtorTag, const InListData& other)
       _oldBackingArr(other._oldBackingArr),
       _originalElements(other._originalElements),
       _sortedElements(boost::in_place_init, cloneSortedElements(other._sortedElements)),
-      _firstOfEachTypeElements(other._firstOfEachTypeElements) {}
+      _firstOfEachTypeElements(other._firstOfEachTypeElements),
+      _hasIntegerFastPath(other._hasIntegerFastPath),
+      _sortedIntegers(other._sortedIntegers) {}
 
 void InListData::appendElements(BSONArrayBuilder& bab, bool getSortedAndDeduped) {
     for (const auto& elem : getElements(getSortedAndDeduped)) {
@@ -109,6 +111,7 @@ Status InListData::setElementsImpl(boost::optional<BSONObj> arr,
     bool hasNonEmptyArray = false;
     bool hasNonEmptyObject = false;
     bool hasLargeStrings = false;
+    bool allIntegers = true;
 
     std::vector<BSONElement> elements;
 
@@ -172,6 +175,8 @@ Status InListData::setElementsImpl(boost::optional<BSONObj> arr,
                 typeMask |= bsonTypeMask;
             }
 
+            allIntegers &= (type == BSONType::NumberInt || type == BSONType::NumberLong);
+
             if (type == BSONType::String || type == BSONType::Symbol) {
                 uint32_t len = e.valuestrsize() - 1;
                 bool isLargeString = len > kLargeStringThreshold;
@@ -277,6 +282,20 @@ Status InListData::setElementsImpl(boost::optional<BSONObj> arr,
     _wasPreSortedAndDeduped = elemsAreSorted && elemsAreUnique;
     _hasSingleUniqueElement = !_originalElements.empty() && !hasMultipleUniqueElements;
 
+    // If all the elements are 32/64-bit integers, eagerly build a sorted and deduped contiguous
+    // array of their values so that contains() can probe it directly.
+    _sortedIntegers.clear();
+    _hasIntegerFastPath = allIntegers && !_originalElements.empty();
+    if (_hasIntegerFastPath) {
+        _sortedIntegers.reserve(_originalElements.size());
+        for (const auto& e : _originalElements) {
+            _sortedIntegers.push_back(e.numberLong());
+        }
+        std::sort(_sortedIntegers.begin(), _sortedIntegers.end());
+        _sortedIntegers.erase(std::unique(_sortedIntegers.begin(), _sortedIntegers.end()),
+                              _sortedIntegers.end());
+    }
+
     return Status::OK();
 }
 
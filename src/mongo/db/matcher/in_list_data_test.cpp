@@ -28,10 +28,12 @@
  */
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/matcher/in_list_data.h"
+#include "mongo/platform/decimal128.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 
@@ -161,5 +163,45 @@ TEST(InListData, GetFirstOfEachTypeSortedAndDeduped) {
     ASSERT_OK(inListElements.setElementsArray(objWithSortedElements["attr"].Obj()));
     assertFirstOfEachTypeReturnsReferredElements(inListElements, {0}, kGetSortedAndDeduped);
 }
+
+TEST(InListData, IntegerFastPathMatchesAcrossNumericTypes) {
+    InListData inList;
+    auto elementArrayObj =
+        BSON("attr" << BSON_ARRAY(5 << 3 << 3 << 100LL << std::numeric_limits<long long>::max()));
+    ASSERT_OK(inList.setElementsArray(elementArrayObj["attr"].Obj()));
+    ASSERT_TRUE(inList.hasIntegerFastPath());
+
+    auto probeObj = BSON("int" << 3 << "long" << 100LL << "longMax"
+                               << std::numeric_limits<long long>::max() << "intAsDouble" << 5.0
+                               << "fractionalDouble" << 5.5 << "nan"
+                               << std::numeric_limits<double>::quiet_NaN() << "intAsDecimal"
+                               << Decimal128(5) << "missingInt" << 4 << "negZero" << -0.0);
+    ASSERT_TRUE(inList.contains(probeObj["int"]));
+    ASSERT_TRUE(inList.contains(probeObj["long"]));
+    ASSERT_TRUE(inList.contains(probeObj["longMax"]));
+    ASSERT_TRUE(inList.contains(probeObj["intAsDouble"]));
+    ASSERT_FALSE(inList.contains(probeObj["fractionalDouble"]));
+    ASSERT_FALSE(inList.contains(probeObj["nan"]));
+    // Decimal probes take the general comparison path but must still match.
+    ASSERT_TRUE(inList.contains(probeObj["intAsDecimal"]));
+    ASSERT_FALSE(inList.contains(probeObj["missingInt"]));
+    ASSERT_FALSE(inList.contains(probeObj["negZero"]));
+
+    // Clones preserve the fast path.
+    ASSERT_TRUE(inList.clone()->hasIntegerFastPath());
+    ASSERT_TRUE(inList.clone()->contains(probeObj["int"]));
+}
+
+TEST(InListData, IntegerFastPathDisabledForMixedTypeLists) {
+    InListData inList;
+    auto elementArrayObj = BSON("attr" << BSON_ARRAY(1 << 2.5 << 3));
+    ASSERT_OK(inList.setElementsArray(elementArrayObj["attr"].Obj()));
+    ASSERT_FALSE(inList.hasIntegerFastPath());
+
+    auto probeObj = BSON("a" << 1 << "b" << 2.5 << "c" << 4);
+    ASSERT_TRUE(inList.contains(probeObj["a"]));
+    ASSERT_TRUE(inList.contains(probeObj["b"]));
+    ASSERT_FALSE(inList.contains(probeObj["c"]));
+}
 }  // namespace
 }  // namespace mongo
@@ -0,0 +1,173 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <string>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsontypes.h"
+#include "mongo/db/matcher/expression_leaf.h"
+#include "mongo/db/matcher/partial_filter_program.h"
+
+namespace mongo {
+namespace {
+
+// The number of conjuncts is capped so that evaluation can track predicate state in single 64-bit
+// masks. Partial filters beyond this size fall back to the general matcher.
+constexpr size_t kMaxPredicates = 64;
+
+// Only single-component paths are supported: dotted paths traverse arrays of subdocuments, whose
+// semantics are left to the general matcher.
+bool isSupportedPath(StringData path) {
+    return !path.empty() && path.find('.') == std::string::npos;
+}
+
+// Comparisons against these operands involve more than the value of the examined element: null and
+// undefined equality also match missing fields, and MinKey/MaxKey comparisons cross type brackets.
+bool operandRequiresGenericMatch(BSONType type) {
+    return type == BSONType::jstNULL || type == BSONType::Undefined || type == BSONType::MinKey ||
+        type == BSONType::MaxKey;
+}
+
+bool isSupportedLeaf(const MatchExpression* expr) {
+    switch (expr->matchType()) {
+        case MatchExpression::EXISTS:
+        case MatchExpression::TYPE_OPERATOR:
+            return true;
+        case MatchExpression::EQ:
+        case MatchExpression::LT:
+        case MatchExpression::LTE:
+        case MatchExpression::GT:
+        case MatchExpression::GTE:
+            return !operandRequiresGenericMatch(
+                static_cast<const ComparisonMatchExpression*>(expr)->getData().type());
+        default:
+            return false;
+    }
+}
+
+// Mirrors the general matcher's leaf-array traversal for a top-level path: a predicate matches if
+// the element itself matches or, when the element is an array, if any of its elements does.
+bool leafMatches(const MatchExpression* leaf, const BSONElement& elem) {
+    if (leaf->matchesSingleElement(elem)) {
+        return true;
+    }
+    if (elem.type() == BSONType::Array) {
+        for (auto&& arrayElem : elem.Obj()) {
+            if (leaf->matchesSingleElement(arrayElem)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+std::unique_ptr<PartialFilterProgram> PartialFilterProgram::tryCompile(
+    const MatchExpression* filter) {
+    if (!filter) {
+        return nullptr;
+    }
+
+    auto addPredicate = [](const MatchExpression* expr, std::vector<Predicate>* predicates) {
+        // {$exists: false} parses to NOT over EXISTS.
+        if (expr->matchType() == MatchExpression::NOT &&
+            expr->getChild(0)->matchType() == MatchExpression::EXISTS) {
+            auto path = expr->getChild(0)->path();
+            if (!isSupportedPath(path)) {
+                return false;
+            }
+            predicates->push_back({path, nullptr, Mode::kNotExists});
+            return true;
+        }
+        if (!isSupportedLeaf(expr) || !isSupportedPath(expr->path())) {
+            return false;
+        }
+        predicates->push_back({expr->path(), expr, Mode::kMatchLeaf});
+        return true;
+    };
+
+    std::vector<Predicate> predicates;
+    if (filter->matchType() == MatchExpression::AND) {
+        for (size_t i = 0; i < filter->numChildren(); i++) {
+            if (!addPredicate(filter->getChild(i), &predicates)) {
+                return nullptr;
+            }
+        }
+    } else if (!addPredicate(filter, &predicates)) {
+        return nullptr;
+    }
+
+    if (predicates.empty() || predicates.size() > kMaxPredicates) {
+        return nullptr;
+    }
+    return std::unique_ptr<PartialFilterProgram>(new PartialFilterProgram(std::move(predicates)));
+}
+
+PartialFilterProgram::PartialFilterProgram(std::vector<Predicate> predicates)
+    : _predicates(std::move(predicates)) {
+    for (size_t i = 0; i < _predicates.size(); i++) {
+        if (_predicates[i].mode == Mode::kMatchLeaf) {
+            _requiredMask |= uint64_t(1) << i;
+        }
+    }
+}
+
+bool PartialFilterProgram::matches(const BSONObj& doc) const {
+    const uint64_t allMask = _predicates.size() == kMaxPredicates
+        ? ~uint64_t(0)
+        : (uint64_t(1) << _predicates.size()) - 1;
+    uint64_t seen = 0;
+    uint64_t satisfied = 0;
+    for (auto&& elem : doc) {
+        const auto fieldName = elem.fieldNameStringData();
+        for (size_t i = 0; i < _predicates.size(); i++) {
+            const uint64_t bit = uint64_t(1) << i;
+            // Only the first occurrence of a field decides each predicate, matching the general
+            // matcher's behavior on documents with duplicate field names.
+            if ((seen & bit) || _predicates[i].path != fieldName) {
+                continue;
+            }
+            seen |= bit;
+            if (_predicates[i].mode == Mode::kNotExists) {
+                return false;
+            }
+            if (!leafMatches(_predicates[i].leaf, elem)) {
+                return false;
+            }
+            satisfied |= bit;
+        }
+        if (seen == allMask) {
+            break;
+        }
+    }
+    return (satisfied & _requiredMask) == _requiredMask;
+}
+
+}  // namespace mongo
@@ -0,0 +1,92 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/matcher/expression.h"
+
+namespace mongo {
+
+/**
+ * A flattened, precompiled form of a partial index filter for evaluation on the write path.
+ *
+ * Index maintenance evaluates every partial index's filter once per document, and the general
+ * MatchExpression walk re-interprets the tree each time. Most partial filters are a conjunction of
+ * simple predicates on top-level fields; for those this class flattens the tree into a list of
+ * (field, predicate) pairs evaluated in a single pass over the document's top-level elements, with
+ * no per-document allocation or tree traversal.
+ *
+ * Compilation is best-effort: tryCompile() returns nullptr for filters outside the supported class
+ * (dotted paths, disjunctions, predicates whose semantics involve missing fields such as null
+ * equality), and callers fall back to the general matcher.
+ */
+class PartialFilterProgram {
+public:
+    /**
+     * Attempts to compile 'filter', which must already be normalized. Returns nullptr if the
+     * filter is not supported. The program holds pointers into 'filter', which must outlive it and
+     * must not be mutated afterwards.
+     */
+    static std::unique_ptr<PartialFilterProgram> tryCompile(const MatchExpression* filter);
+
+    /**
+     * Returns whether 'doc' matches the compiled filter. Produces the same result as evaluating
+     * the original expression with the general matcher.
+     */
+    bool matches(const BSONObj& doc) const;
+
+private:
+    enum class Mode {
+        // The field's first occurrence must satisfy the leaf predicate.
+        kMatchLeaf,
+        // The field must be absent; compiled from {$exists: false}.
+        kNotExists,
+    };
+
+    struct Predicate {
+        StringData path;
+        const MatchExpression* leaf;
+        Mode mode;
+    };
+
+    explicit PartialFilterProgram(std::vector<Predicate> predicates);
+
+    std::vector<Predicate> _predicates;
+
+    // Bits for the kMatchLeaf predicates; all must be satisfied for a document to match.
+    uint64_t _requiredMask = 0;
+};
+
+}  // namespace mongo
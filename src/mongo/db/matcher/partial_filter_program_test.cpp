@@ -0,0 +1,171 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <memory>
+#include <string>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
+#include "mongo/db/exec/matcher/matcher.h"
+#include "mongo/db/matcher/expression.h"
+#include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/matcher/partial_filter_program.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Parses and normalizes 'json' the way the index catalog does for partial filter expressions, and
+ * attempts to compile the result. Keeps the backing BSONObj and expression alive for the lifetime
+ * of the program.
+ */
+class CompiledFilterForTest {
+public:
+    explicit CompiledFilterForTest(const std::string& json) : _obj(fromjson(json)) {
+        _expr = MatchExpressionParser::parseAndNormalize(
+            _obj, make_intrusive<ExpressionContextForTest>());
+        _program = PartialFilterProgram::tryCompile(_expr.get());
+    }
+
+    const PartialFilterProgram* program() const {
+        return _program.get();
+    }
+
+    /**
+     * Asserts that the program and the general matcher agree on 'doc'.
+     */
+    void assertParity(const BSONObj& doc) const {
+        ASSERT(_program);
+        ASSERT_EQ(_program->matches(doc), exec::matcher::matchesBSON(_expr.get(), doc))
+            << "filter: " << _obj << " doc: " << doc;
+    }
+
+private:
+    const BSONObj _obj;
+    std::unique_ptr<MatchExpression> _expr;
+    std::unique_ptr<PartialFilterProgram> _program;
+};
+
+TEST(PartialFilterProgramTest, CompilesSupportedFilters) {
+    ASSERT(CompiledFilterForTest("{a: {$exists: true}}").program());
+    ASSERT(CompiledFilterForTest("{a: {$exists: false}}").program());
+    ASSERT(CompiledFilterForTest("{a: 1}").program());
+    ASSERT(CompiledFilterForTest("{a: 1, b: {$gt: 5}}").program());
+    ASSERT(CompiledFilterForTest("{a: {$gt: 5, $lt: 10}}").program());
+    ASSERT(CompiledFilterForTest("{a: {$type: 'array'}}").program());
+    ASSERT(CompiledFilterForTest("{a: {$gte: 'x'}, b: {$lte: 3}}").program());
+}
+
+TEST(PartialFilterProgramTest, RejectsUnsupportedFilters) {
+    // Dotted paths traverse arrays of subdocuments.
+    ASSERT_FALSE(CompiledFilterForTest("{'a.b': 1}").program());
+    // Disjunctions are not flattened.
+    ASSERT_FALSE(CompiledFilterForTest("{$or: [{a: 1}, {b: 1}]}").program());
+    // Null equality also matches missing fields.
+    ASSERT_FALSE(CompiledFilterForTest("{a: null}").program());
+    ASSERT_FALSE(CompiledFilterForTest("{a: 1, b: null}").program());
+    // $in is outside the supported leaf set.
+    ASSERT_FALSE(CompiledFilterForTest("{a: {$in: [1, 2]}}").program());
+    // {} normalizes to an empty conjunction.
+    ASSERT_FALSE(CompiledFilterForTest("{}").program());
+}
+
+TEST(PartialFilterProgramTest, ComparisonParity) {
+    CompiledFilterForTest filter("{a: {$gt: 5}}");
+    filter.assertParity(fromjson("{a: 6}"));
+    filter.assertParity(fromjson("{a: 5}"));
+    filter.assertParity(fromjson("{a: 'string'}"));
+    filter.assertParity(fromjson("{b: 6}"));
+    filter.assertParity(fromjson("{}"));
+    // Array traversal: matches if any element matches.
+    filter.assertParity(fromjson("{a: [1, 10]}"));
+    filter.assertParity(fromjson("{a: [1, 2]}"));
+    filter.assertParity(fromjson("{a: []}"));
+    // Nested arrays are not traversed recursively.
+    filter.assertParity(fromjson("{a: [[10]]}"));
+}
+
+TEST(PartialFilterProgramTest, ConjunctionParity) {
+    CompiledFilterForTest filter("{a: 1, b: {$lt: 10}}");
+    filter.assertParity(fromjson("{a: 1, b: 5}"));
+    filter.assertParity(fromjson("{b: 5, a: 1}"));
+    filter.assertParity(fromjson("{a: 1, b: 15}"));
+    filter.assertParity(fromjson("{a: 2, b: 5}"));
+    filter.assertParity(fromjson("{a: 1}"));
+    filter.assertParity(fromjson("{b: 5}"));
+    filter.assertParity(fromjson("{a: [0, 1], b: [9, 20]}"));
+}
+
+TEST(PartialFilterProgramTest, RangeOnOnePathParity) {
+    CompiledFilterForTest filter("{a: {$gt: 5, $lt: 10}}");
+    filter.assertParity(fromjson("{a: 7}"));
+    filter.assertParity(fromjson("{a: 5}"));
+    filter.assertParity(fromjson("{a: 10}"));
+    filter.assertParity(fromjson("{}"));
+    // Different array elements may satisfy different bounds.
+    filter.assertParity(fromjson("{a: [1, 20]}"));
+    filter.assertParity(fromjson("{a: [7]}"));
+}
+
+TEST(PartialFilterProgramTest, ExistsParity) {
+    CompiledFilterForTest exists("{a: {$exists: true}}");
+    exists.assertParity(fromjson("{a: 1}"));
+    exists.assertParity(fromjson("{a: null}"));
+    exists.assertParity(fromjson("{b: 1}"));
+    exists.assertParity(fromjson("{}"));
+
+    CompiledFilterForTest notExists("{a: {$exists: false}}");
+    notExists.assertParity(fromjson("{a: 1}"));
+    notExists.assertParity(fromjson("{a: null}"));
+    notExists.assertParity(fromjson("{b: 1}"));
+    notExists.assertParity(fromjson("{}"));
+}
+
+TEST(PartialFilterProgramTest, TypeParity) {
+    CompiledFilterForTest filter("{a: {$type: 'array'}}");
+    filter.assertParity(fromjson("{a: []}"));
+    filter.assertParity(fromjson("{a: [1]}"));
+    filter.assertParity(fromjson("{a: 1}"));
+    filter.assertParity(fromjson("{}"));
+}
+
+TEST(PartialFilterProgramTest, FirstOccurrenceDecidesEachPredicate) {
+    CompiledFilterForTest filter("{a: {$gt: 5}}");
+    BSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("a", 10);
+    filter.assertParity(bob.obj());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -27,9 +27,12 @@
  *    it in the license file.
  */
 
+#include <memory>
+
 #include "mongo/db/memory_tracking/op_memory_use.h"
 #include "mongo/db/memory_tracking/operation_memory_usage_tracker.h"
 #include "mongo/db/service_context_test_fixture.h"
+#include "mongo/util/thread_allocation_tracking.h"
 
 namespace mongo {
 namespace {
@@ -58,5 +61,32 @@ TEST_F(MemoryTrackingTest, OpMemoryUseCanAttachToOpCtx) {
     ASSERT_EQ(memoryTracker->currentMemoryBytes(), 10);
     ASSERT_EQ(memoryTracker->maxUsedMemoryBytes(), 15);
 }
+
+TEST_F(MemoryTrackingTest, AllocatorThreadSliceAccounting) {
+    OperationMemoryUsageTracker tracker;
+
+    if (!installThreadAllocationTracking()) {
+        // The active allocator cannot report per-thread totals; the slice API must degrade to a
+        // no-op rather than report garbage.
+        tracker.beginThreadSlice();
+        tracker.endThreadSlice();
+        ASSERT_EQ(tracker.allocatorNetMemoryBytes(), 0);
+        ASSERT_EQ(tracker.maxAllocatorNetMemoryBytes(), 0);
+        return;
+    }
+
+    static constexpr int64_t kBigAllocation = 1 << 20;
+
+    tracker.beginThreadSlice();
+    auto buf = std::make_unique<char[]>(kBigAllocation);
+    tracker.endThreadSlice();
+    ASSERT_GTE(tracker.allocatorNetMemoryBytes(), kBigAllocation);
+
+    tracker.beginThreadSlice();
+    buf.reset();
+    tracker.endThreadSlice();
+    ASSERT_LT(tracker.allocatorNetMemoryBytes(), kBigAllocation);
+    ASSERT_GTE(tracker.maxAllocatorNetMemoryBytes(), kBigAllocation);
+}
 }  // namespace
 }  // namespace mongo
@@ -27,8 +27,11 @@
  *    it in the license file.
  */
 #pragma once
+#include <algorithm>
 #include <cstdint>
 
+#include "mongo/util/thread_allocation_tracking.h"
+
 namespace mongo {
 // TODO SERVER-98972 Replace this.
 class OperationMemoryUsageTracker {
@@ -44,11 +47,66 @@ public:
         return _maxUsedMemoryBytes;
     }
 
+    /**
+     * Marks the start of a stretch of this operation running on the calling thread. While
+     * allocator-level tracking is available (see thread_allocation_tracking.h), everything the
+     * thread allocates until the matching `endThreadSlice()` is attributed to this operation,
+     * whether or not the allocating code self-reports to a MemoryUsageTracker. No-op when the
+     * allocator cannot report per-thread totals.
+     */
+    void beginThreadSlice() {
+        if (threadAllocationTrackingAvailable()) {
+            _sliceStart = threadAllocationStats();
+            _inSlice = true;
+        }
+    }
+
+    /**
+     * Marks the end of a stretch begun with `beginThreadSlice()`, folding the thread's allocator
+     * deltas into this operation's totals. Must run on the same thread as the begin call.
+     */
+    void endThreadSlice() {
+        if (!_inSlice) {
+            return;
+        }
+        _inSlice = false;
+        auto now = threadAllocationStats();
+        _allocatorAllocatedBytes +=
+            static_cast<int64_t>(now.allocatedBytes - _sliceStart.allocatedBytes);
+        _allocatorDeallocatedBytes +=
+            static_cast<int64_t>(now.deallocatedBytes - _sliceStart.deallocatedBytes);
+        _maxAllocatorNetBytes = std::max(_maxAllocatorNetBytes, allocatorNetMemoryBytes());
+    }
+
+    /**
+     * Net allocator-observed bytes this operation holds: everything it allocated minus everything
+     * it freed across all completed thread slices. Zero when allocator-level tracking is
+     * unavailable; callers should then fall back to `currentMemoryBytes()`.
+     */
+    int64_t allocatorNetMemoryBytes() const {
+        return _allocatorAllocatedBytes - _allocatorDeallocatedBytes;
+    }
+
+    /**
+     * High-water mark of `allocatorNetMemoryBytes()`, observed at slice boundaries.
+     */
+    int64_t maxAllocatorNetMemoryBytes() const {
+        return _maxAllocatorNetBytes;
+    }
+
 private:
     // Current amount of memory in use by all blocking stages.
     int64_t _currentMemoryBytes = 0;
 
     // High-water mark: the highest amount of memory that has been allocated at one time so far.
     int64_t _maxUsedMemoryBytes = 0;
+
+    // Allocator-observed totals accumulated over completed thread slices, and the thread counters
+    // captured when the current slice began.
+    int64_t _allocatorAllocatedBytes = 0;
+    int64_t _allocatorDeallocatedBytes = 0;
+    int64_t _maxAllocatorNetBytes = 0;
+    ThreadAllocationStats _sliceStart;
+    bool _inSlice = false;
 };
 }  // namespace mongo
@@ -99,6 +99,7 @@ constexpr auto kMirroredReadsParamName = "mirrorReads"_sd;
 
 constexpr auto kMirroredReadsSeenKey = "seen"_sd;
 constexpr auto kMirroredReadsSentKey = "sent"_sd;
+constexpr auto kMirroredReadsSkippedDueToPerHostLimitKey = "skippedDueToPerHostLimit"_sd;
 constexpr auto kMirroredReadsErroredDuringSendKey = "erroredDuringSend"_sd;
 constexpr auto kMirroredReadsProcessedAsSecondaryKey = "processedAsSecondary"_sd;
 constexpr auto kMirroredReadsResolvedKey = "resolved"_sd;
@@ -169,6 +170,41 @@ private:
                  const MirroredReadsParameters& params,
                  double mirrorCount);
 
+    /**
+     * Tracks the number of mirrored requests per host that have been handed to the executor but
+     * have not yet resolved. Mirroring backs off from hosts that accumulate too many outstanding
+     * requests, so a secondary that has stopped keeping up is not pushed over by mirroring bursts.
+     */
+    class OutstandingMirrors {
+    public:
+        /**
+         * Attempts to reserve a slot for 'host'. Returns false without reserving if 'host' already
+         * has 'max' outstanding mirrored requests.
+         */
+        bool tryAcquire(const HostAndPort& host, int32_t max) {
+            stdx::lock_guard lk(_mutex);
+            auto& count = _counts[host];
+            if (count >= max) {
+                return false;
+            }
+            count++;
+            return true;
+        }
+
+        void release(const HostAndPort& host) {
+            stdx::lock_guard lk(_mutex);
+            auto it = _counts.find(host);
+            invariant(it != _counts.end());
+            if (--it->second == 0) {
+                _counts.erase(it);
+            }
+        }
+
+    private:
+        stdx::mutex _mutex;
+        stdx::unordered_map<HostAndPort, int32_t> _counts;
+    };
+
     /**
      * An enum detailing the liveness of the Maestro
      *
@@ -200,6 +236,7 @@ private:
     std::shared_ptr<executor::TaskExecutor> _executor;
     repl::TopologyVersionObserver _topologyVersionObserver;
     synchronized_value<PseudoRandom> _random{PseudoRandom(SecureRandom{}.nextInt64())};
+    OutstandingMirrors _outstandingMirrors;
 };
 
 const auto getMirrorMaestroImpl = ServiceContext::declareDecoration<MirrorMaestroImpl>();
@@ -219,6 +256,8 @@ public:
         BSONObjBuilder section;
         section.append(kMirroredReadsSeenKey, seen.loadRelaxed());
         section.append(kMirroredReadsSentKey, sent.loadRelaxed());
+        section.append(kMirroredReadsSkippedDueToPerHostLimitKey,
+                       skippedDueToPerHostLimit.loadRelaxed());
         section.append(kMirroredReadsErroredDuringSendKey, erroredDuringSend.loadRelaxed());
         section.append(kMirroredReadsProcessedAsSecondaryKey, processedAsSecondary.loadRelaxed());
 
@@ -274,6 +313,9 @@ public:
     // Counts the number of remote requests (for mirroring as primary) that have ever been
     // scheduled to be sent over the network.
     AtomicWord<CounterT> sent;
+    // Counts the number of remote requests (as primary) that were not sent because the target
+    // host already had the maximum number of outstanding mirrored requests.
+    AtomicWord<CounterT> skippedDueToPerHostLimit;
     // Counts the number of remote requests (as primary) that failed with some error when sending.
     AtomicWord<CounterT> erroredDuringSend;
     // Counts the number of responses (as primary) from secondaries after mirrored operations.
@@ -459,8 +501,21 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
 
     for (auto i = 0; i < mirrorCount; i++) {
         auto& host = hosts[(startIndex + i) % hosts.size()];
+
+        if (!_outstandingMirrors.tryAcquire(host, params.getMaxOutstandingPerHost())) {
+            // The host is not keeping up with the mirrors already sent to it; skip this one
+            // rather than piling on.
+            gMirroredReadsSection.skippedDueToPerHostLimit.fetchAndAdd(1);
+            if (MONGO_unlikely(mirrorMaestroTracksPending.shouldFail())) {
+                gMirroredReadsSection.pending.fetchAndSubtract(1);
+            }
+            continue;
+        }
+
         std::weak_ptr<executor::TaskExecutor> wExec(_executor);
-        auto mirrorResponseCallback = [host, wExec = std::move(wExec)](auto& args) {
+        auto mirrorResponseCallback = [this, host, wExec = std::move(wExec)](auto& args) {
+            _outstandingMirrors.release(host);
+
             if (!args.response.status.isOK()) {
                 gMirroredReadsSection.erroredDuringSend.fetchAndAdd(1);
             }
@@ -524,6 +579,11 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
             _executor->scheduleRemoteCommand(newRequest, std::move(mirrorResponseCallback))
                 .getStatus();
 
+        if (!status.isOK()) {
+            // The callback will never run, so give the host its slot back here.
+            _outstandingMirrors.release(host);
+        }
+
         if (ErrorCodes::isShutdownError(status.code())) {
             LOGV2_DEBUG(5723501, 1, "Aborted mirroring due to shutdown", "reason"_attr = status);
             return;
@@ -137,6 +137,7 @@
 #include "mongo/db/pipeline/process_interface/replica_set_node_process_interface.h"
 #include "mongo/db/profile_filter_impl.h"
 #include "mongo/db/query/client_cursor/clientcursor.h"
+#include "mongo/db/query/plan_cache/plan_cache_persistence.h"
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_settings/query_settings_manager.h"
 #include "mongo/db/query/query_settings/query_settings_utils.h"
@@ -1118,6 +1119,14 @@ ExitCode _initAndListen(ServiceContext* serviceContext) {
         }
     }
 
+    if (internalQueryPersistPlanCacheShapes) {
+        // Replay query shapes persisted by the previous incarnation through the planner, then
+        // start the periodic job which keeps the on-disk shapes file up to date.
+        plan_cache_persistence::warmUpFromPersistedShapes(
+            startupOpCtx.get(), boost::filesystem::path(storageGlobalParams.dbpath));
+        plan_cache_persistence::startPeriodicShapeDump(serviceContext);
+    }
+
     if (computeModeEnabled) {
         if (!isStandalone || !serverGlobalParams.clusterRole.has(ClusterRole::None)) {
             LOGV2_ERROR(6968200, "'enableComputeMode' can be used only in standalone server");
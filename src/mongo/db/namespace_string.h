@@ -732,6 +732,11 @@ public:
     }
 
     friend bool operator==(const NamespaceString& lhs, const NamespaceString& rhs) {
+        // Copies of statically allocated and of long (shared) namespaces alias the same buffer,
+        // so pointer identity decides without inspecting the characters.
+        if (lhs._data.data() == rhs._data.data()) {
+            return lhs._data.size() == rhs._data.size();
+        }
         return StringData{lhs._data.data(), lhs._data.size()} ==
             StringData{rhs._data.data(), rhs._data.size()};
     }
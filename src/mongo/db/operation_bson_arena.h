@@ -0,0 +1,86 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/util/shared_buffer_fragment.h"
+
+namespace mongo {
+
+/**
+ * Per-operation arena for building BSON objects without per-document heap allocation. Buffers are
+ * carved out of a shared block via SharedBufferFragmentBuilder and the whole arena is released
+ * when the OperationContext is destroyed, so hot paths that build many documents (applying a
+ * write batch, assembling a reply) pay a single allocation per block instead of one per document.
+ *
+ * Only one top-level builder may be active on the arena at a time; finish or abandon it before
+ * starting the next one.
+ */
+class OperationBSONArena {
+public:
+    static const OperationContext::Decoration<OperationBSONArena> get;
+
+    OperationBSONArena() = default;
+
+    // No copy and no move
+    OperationBSONArena(const OperationBSONArena&) = delete;
+    OperationBSONArena(OperationBSONArena&&) = delete;
+    OperationBSONArena& operator=(const OperationBSONArena&) = delete;
+    OperationBSONArena& operator=(OperationBSONArena&&) = delete;
+
+    SharedBufferFragmentBuilder& fragmentBuilder() {
+        return _fragmentBuilder;
+    }
+
+    /**
+     * Returns a builder allocating from this arena. The resulting BSONObj (or the fragment
+     * returned by finish()) must not outlive the OperationContext.
+     */
+    PooledBSONObjBuilder makeObjBuilder() {
+        return PooledBSONObjBuilder(_fragmentBuilder);
+    }
+
+    /**
+     * Releases memory not referenced by outstanding fragments. Call between batches when fragments
+     * from earlier batches are known to be dead.
+     */
+    void freeUnused() {
+        _fragmentBuilder.freeUnused();
+    }
+
+private:
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    SharedBufferFragmentBuilder _fragmentBuilder{kBlockSize};
+};
+
+}  // namespace mongo
@@ -126,7 +126,30 @@ Document copyDocExceptFields(const Document& source, std::initializer_list<Strin
 repl::OpTypeEnum getOplogOpType(const Document& oplog) {
     auto opTypeField = oplog[repl::OplogEntry::kOpTypeFieldName];
     checkValueType(opTypeField, repl::OplogEntry::kOpTypeFieldName, BSONType::String);
-    return repl::OpType_parse(IDLParserContext("ChangeStreamEntry.op"), opTypeField.getString());
+    auto opTypeStr = opTypeField.getStringData();
+
+    // All known op types are single characters. Dispatch on the first character directly rather
+    // than going through the generated IDL parser, which would construct a parser context per
+    // event; this function runs once for every event in the stream.
+    if (opTypeStr.size() == 1) {
+        switch (opTypeStr[0]) {
+            case 'i':
+                return repl::OpTypeEnum::kInsert;
+            case 'u':
+                return repl::OpTypeEnum::kUpdate;
+            case 'd':
+                return repl::OpTypeEnum::kDelete;
+            case 'c':
+                return repl::OpTypeEnum::kCommand;
+            case 'n':
+                return repl::OpTypeEnum::kNoop;
+            default:
+                break;
+        }
+    }
+
+    // Fall back to the IDL parser for its error reporting on unknown op types.
+    return repl::OpType_parse(IDLParserContext("ChangeStreamEntry.op"), opTypeStr);
 }
 
 Value makeChangeStreamNsField(const NamespaceString& nss) {
@@ -233,7 +256,10 @@ std::set<std::string> ChangeStreamDefaultEventTransformation::getFieldNameDepend
 }
 
 Document ChangeStreamDefaultEventTransformation::applyTransformation(const Document& input) const {
-    MutableDocument doc;
+    // Reserve space for the fields an expanded CRUD event carries, so building the event does not
+    // have to grow (and memcpy) the output document's buffer as fields are appended.
+    constexpr size_t kExpectedEventFields = 12;
+    MutableDocument doc(kExpectedEventFields);
 
     // Extract the fields we need.
     Value ts = input[repl::OplogEntry::kTimestampFieldName];
@@ -668,7 +694,8 @@ Document ChangeStreamViewDefinitionEventTransformation::applyTransformation(
                                            Value(),
                                            operationDescription);
 
-    MutableDocument doc;
+    constexpr size_t kExpectedEventFields = 8;
+    MutableDocument doc(kExpectedEventFields);
     setResumeTokenForEvent(resumeTokenData, &doc);
     doc.addField(DocumentSourceChangeStream::kOperationTypeField, Value(operationType));
     doc.addField(DocumentSourceChangeStream::kClusterTimeField, Value(resumeTokenData.clusterTime));
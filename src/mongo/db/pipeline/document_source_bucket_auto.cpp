@@ -172,15 +172,27 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::populateSorter() {
     for (; next.isAdvanced(); next = pSource->getNext()) {
         auto nextDoc = next.releaseDocument();
         auto key = extractKey(nextDoc);
-
-        auto doc = Document{{AccumulatorN::kFieldNameOutput, Value(std::move(nextDoc))},
-                            {AccumulatorN::kFieldNameGeneratedSortKey, Value(_nDocPositions++)}};
-        _sorter->add(std::move(key), std::move(doc));
+        _sorter->add(std::move(key), makeSortEntry(nextDoc));
         ++_nDocuments;
     }
     return next;
 }
 
+Document DocumentSourceBucketAuto::makeSortEntry(const Document& doc) {
+    // Evaluate each accumulated field's argument now, so that only the arguments (rather than the
+    // whole input document) need to be held by the sorter and written out when it spills. The
+    // bucket boundaries are not known until every document has been consumed, but the accumulator
+    // arguments do not depend on them, so nothing else from the document is needed on the second
+    // pass over the sorted stream.
+    std::vector<Value> args;
+    args.reserve(_accumulatedFields.size());
+    for (auto&& accumulatedField : _accumulatedFields) {
+        args.push_back(accumulatedField.expr.argument->evaluate(doc, &pExpCtx->variables));
+    }
+    return Document{{AccumulatorN::kFieldNameOutput, Value(std::move(args))},
+                    {AccumulatorN::kFieldNameGeneratedSortKey, Value(_nDocPositions++)}};
+}
+
 Value DocumentSourceBucketAuto::extractKey(const Document& doc) {
     if (!_groupByExpression) {
         return Value(BSONNULL);
@@ -218,12 +230,11 @@ void DocumentSourceBucketAuto::addDocumentToBucket(const pair<Value, Document>&
     bucket._max = entry.first;
 
     const size_t numAccumulators = _accumulatedFields.size();
+    const Value args = entry.second.getField(AccumulatorN::kFieldNameOutput);
     for (size_t k = 0; k < numAccumulators; k++) {
         if (bucket._accums[k]->needsInput()) {
             bool isPositionalAccum = isPositionalAccumulator(bucket._accums[k]->getOpName());
-            auto value = entry.second.getField(AccumulatorN::kFieldNameOutput);
-            auto evaluated = _accumulatedFields[k].expr.argument->evaluate(value.getDocument(),
-                                                                           &pExpCtx->variables);
+            auto evaluated = args[k];
             if (isPositionalAccum) {
                 auto wrapped = Value(Document{
                     {AccumulatorN::kFieldNameGeneratedSortKey,
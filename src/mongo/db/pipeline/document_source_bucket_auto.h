@@ -184,6 +184,13 @@ private:
      */
     Value extractKey(const Document& doc);
 
+    /**
+     * Builds the value stored in the sorter for 'doc': the document's position in the input
+     * stream and the evaluated argument of each accumulated field, so the sorter never has to
+     * hold or spill whole input documents.
+     */
+    Document makeSortEntry(const Document& doc);
+
     /**
      * Returns the next bucket if exists. boost::none if none exist.
      */
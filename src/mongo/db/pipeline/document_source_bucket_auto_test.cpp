@@ -47,6 +47,7 @@
 #include "mongo/db/exec/document_value/document_metadata_fields.h"
 #include "mongo/db/exec/document_value/document_value_test_util.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/aggregation_context_fixture.h"
 #include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/pipeline/document_source_bucket_auto.h"
@@ -391,9 +392,14 @@ TEST_F(BucketAutoTests, ShouldBeAbleToCorrectlySpillToDisk) {
     VariablesParseState vps = expCtx->variablesParseState;
     auto groupByExpression = ExpressionFieldPath::parse(expCtx.get(), "$a", vps);
 
+    // Only accumulator arguments are buffered by the sorter, so accumulate the large string itself
+    // to force a spill.
+    auto pushLargeStr = AccumulationStatement::parseAccumulationStatement(
+        expCtx.get(), fromjson("{strs : {$push : '$largeStr'}}").firstElement(), vps);
+
     const int numBuckets = 2;
     auto bucketAutoStage = DocumentSourceBucketAuto::create(
-        expCtx, groupByExpression, numBuckets, {}, nullptr, maxMemoryUsageBytes);
+        expCtx, groupByExpression, numBuckets, {pushLargeStr}, nullptr, maxMemoryUsageBytes);
 
     string largeStr(maxMemoryUsageBytes, 'x');
     auto mock = DocumentSourceMock::createForTest({Document{{"a", 0}, {"largeStr", largeStr}},
@@ -403,15 +409,18 @@ TEST_F(BucketAutoTests, ShouldBeAbleToCorrectlySpillToDisk) {
                                                   expCtx);
     bucketAutoStage->setSource(mock.get());
 
+    const Value expectedStrs{std::vector<Value>{Value(largeStr), Value(largeStr)}};
     auto next = bucketAutoStage->getNext();
     ASSERT_TRUE(next.isAdvanced());
-    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
-                       (Document{{"_id", Document{{"min", 0}, {"max", 2}}}, {"count", 2}}));
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"_id", Document{{"min", 0}, {"max", 2}}}, {"strs", expectedStrs}}));
 
     next = bucketAutoStage->getNext();
     ASSERT_TRUE(next.isAdvanced());
-    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
-                       (Document{{"_id", Document{{"min", 2}, {"max", 3}}}, {"count", 2}}));
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"_id", Document{{"min", 2}, {"max", 3}}}, {"strs", expectedStrs}}));
 
     ASSERT_TRUE(bucketAutoStage->getNext().isEOF());
 }
@@ -428,9 +437,14 @@ TEST_F(BucketAutoTests, ShouldBeAbleToPauseLoadingWhileSpilled) {
     VariablesParseState vps = expCtx->variablesParseState;
     auto groupByExpression = ExpressionFieldPath::parse(expCtx.get(), "$a", vps);
 
+    // Only accumulator arguments are buffered by the sorter, so accumulate the large string itself
+    // to force a spill.
+    auto pushLargeStr = AccumulationStatement::parseAccumulationStatement(
+        expCtx.get(), fromjson("{strs : {$push : '$largeStr'}}").firstElement(), vps);
+
     const int numBuckets = 2;
     auto bucketAutoStage = DocumentSourceBucketAuto::create(
-        expCtx, groupByExpression, numBuckets, {}, nullptr, maxMemoryUsageBytes);
+        expCtx, groupByExpression, numBuckets, {pushLargeStr}, nullptr, maxMemoryUsageBytes);
     auto sort =
         DocumentSourceSort::create(expCtx,
                                    {BSON("_id" << -1), expCtx},
@@ -453,15 +467,18 @@ TEST_F(BucketAutoTests, ShouldBeAbleToPauseLoadingWhileSpilled) {
     ASSERT_TRUE(bucketAutoStage->getNext().isPaused());
 
     // Now we expect to get the results back.
+    const Value expectedStrs{std::vector<Value>{Value(largeStr), Value(largeStr)}};
     auto next = bucketAutoStage->getNext();
     ASSERT_TRUE(next.isAdvanced());
-    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
-                       (Document{{"_id", Document{{"min", 0}, {"max", 2}}}, {"count", 2}}));
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"_id", Document{{"min", 0}, {"max", 2}}}, {"strs", expectedStrs}}));
 
     next = bucketAutoStage->getNext();
     ASSERT_TRUE(next.isAdvanced());
-    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
-                       (Document{{"_id", Document{{"min", 2}, {"max", 3}}}, {"count", 2}}));
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"_id", Document{{"min", 2}, {"max", 3}}}, {"strs", expectedStrs}}));
 
     ASSERT_TRUE(bucketAutoStage->getNext().isEOF());
 }
@@ -688,9 +705,14 @@ void assertCannotSpillToDisk(const boost::intrusive_ptr<ExpressionContext>& expC
     VariablesParseState vps = expCtx->variablesParseState;
     auto groupByExpression = ExpressionFieldPath::parse(expCtx.get(), "$a", vps);
 
+    // Only accumulator arguments are buffered by the sorter, so accumulate the large string itself
+    // to exceed the memory limit.
+    auto pushLargeStr = AccumulationStatement::parseAccumulationStatement(
+        expCtx.get(), fromjson("{strs : {$push : '$largeStr'}}").firstElement(), vps);
+
     const int numBuckets = 2;
     auto bucketAutoStage = DocumentSourceBucketAuto::create(
-        expCtx, groupByExpression, numBuckets, {}, nullptr, maxMemoryUsageBytes);
+        expCtx, groupByExpression, numBuckets, {pushLargeStr}, nullptr, maxMemoryUsageBytes);
 
     string largeStr(maxMemoryUsageBytes, 'x');
     auto mock = DocumentSourceMock::createForTest(
@@ -727,9 +749,14 @@ TEST_F(BucketAutoTests, ShouldCorrectlyTrackMemoryUsageBetweenPauses) {
     VariablesParseState vps = expCtx->variablesParseState;
     auto groupByExpression = ExpressionFieldPath::parse(expCtx.get(), "$a", vps);
 
+    // Only accumulator arguments are buffered by the sorter, so accumulate the large string itself
+    // to exceed the memory limit.
+    auto pushLargeStr = AccumulationStatement::parseAccumulationStatement(
+        expCtx.get(), fromjson("{strs : {$push : '$largeStr'}}").firstElement(), vps);
+
     const int numBuckets = 2;
     auto bucketAutoStage = DocumentSourceBucketAuto::create(
-        expCtx, groupByExpression, numBuckets, {}, nullptr, maxMemoryUsageBytes);
+        expCtx, groupByExpression, numBuckets, {pushLargeStr}, nullptr, maxMemoryUsageBytes);
 
     string largeStr(maxMemoryUsageBytes / 5, 'x');
     auto mock =
@@ -29,6 +29,8 @@
 
 #include <boost/move/utility_core.hpp>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
@@ -84,46 +86,93 @@ DocumentSourceChangeStreamAddPreImage::createFromBson(
 }
 
 DocumentSource::GetNextResult DocumentSourceChangeStreamAddPreImage::doGetNext() {
-    auto input = pSource->getNext();
-    if (!input.isAdvanced()) {
-        return input;
+    if (_queuedResults.empty()) {
+        auto lastResult = _prefetchBatch();
+        if (_queuedResults.empty()) {
+            return lastResult;
+        }
     }
 
-    // If this is not an update, replace or delete, then just pass along the result.
-    const auto kOpTypeField = DocumentSourceChangeStream::kOperationTypeField;
-    const auto opType = input.getDocument()[kOpTypeField];
-    DocumentSourceChangeStream::checkValueType(opType, kOpTypeField, BSONType::String);
-    if (opType.getStringData() != DocumentSourceChangeStream::kUpdateOpType &&
-        opType.getStringData() != DocumentSourceChangeStream::kReplaceOpType &&
-        opType.getStringData() != DocumentSourceChangeStream::kDeleteOpType) {
-        return input;
+    auto result = std::move(_queuedResults.front());
+    _queuedResults.pop_front();
+    return result;
+}
+
+DocumentSource::GetNextResult DocumentSourceChangeStreamAddPreImage::_prefetchBatch() {
+    std::vector<GetNextResult> batch;
+    std::vector<size_t> lookupPositions;
+    std::vector<Document> preImageIds;
+    boost::optional<GetNextResult> lastResult;
+
+    // Gather the events the source has ready, noting which of them need a pre-image. Gathering
+    // stops at the first non-advanced result, so this never waits for more events than the source
+    // can supply immediately.
+    while (batch.size() < kPreImageLookupBatchSize) {
+        auto input = pSource->getNext();
+        if (!input.isAdvanced()) {
+            lastResult = std::move(input);
+            break;
+        }
+
+        // Only update, replace and delete events can carry a pre-image.
+        const auto kOpTypeField = DocumentSourceChangeStream::kOperationTypeField;
+        const auto opType = input.getDocument()[kOpTypeField];
+        DocumentSourceChangeStream::checkValueType(opType, kOpTypeField, BSONType::String);
+        if (opType.getStringData() == DocumentSourceChangeStream::kUpdateOpType ||
+            opType.getStringData() == DocumentSourceChangeStream::kReplaceOpType ||
+            opType.getStringData() == DocumentSourceChangeStream::kDeleteOpType) {
+            auto preImageId = input.getDocument()[kPreImageIdFieldName];
+            tassert(6091900, "Pre-image id field is missing", !preImageId.missing());
+            tassert(5868900,
+                    "Expected pre-image id field to be a document",
+                    preImageId.getType() == BSONType::Object);
+            lookupPositions.push_back(batch.size());
+            preImageIds.push_back(preImageId.getDocument());
+        }
+        batch.push_back(std::move(input));
+    }
+
+    if (batch.empty()) {
+        return std::move(*lastResult);
     }
 
-    auto preImageId = input.getDocument()[kPreImageIdFieldName];
-    tassert(6091900, "Pre-image id field is missing", !preImageId.missing());
-    tassert(5868900,
-            "Expected pre-image id field to be a document",
-            preImageId.getType() == BSONType::Object);
-
-    // Obtain the pre-image document, if available, given the specified preImageId.
-    auto preImageDoc = lookupPreImage(pExpCtx, preImageId.getDocument());
-    uassert(
-        ErrorCodes::NoMatchingDocument,
-        str::stream() << "Change stream was configured to require a pre-image for all update, "
-                         "delete and replace events, but the pre-image was not found for event: "
-                      << makePreImageNotFoundErrorMsg(input.getDocument()),
-        preImageDoc ||
-            _fullDocumentBeforeChangeMode != FullDocumentBeforeChangeModeEnum::kRequired);
-
-    // Even if no pre-image was found, we have to populate the 'fullDocumentBeforeChange' field.
-    MutableDocument outputDoc(input.releaseDocument());
-    outputDoc[kFullDocumentBeforeChangeFieldName] =
-        (preImageDoc ? Value(*preImageDoc) : Value(BSONNULL));
-
-    // Do not propagate preImageId field further through the pipeline.
-    outputDoc.remove(kPreImageIdFieldName);
-
-    return outputDoc.freeze();
+    // Resolve all the pre-images for the batch with a single sorted multi-get, amortizing the
+    // collection acquisition and exploiting the clustered layout of the pre-images collection.
+    auto preImageDocs = lookupPreImages(pExpCtx, preImageIds);
+
+    size_t lookupIdx = 0;
+    for (size_t pos = 0; pos < batch.size(); ++pos) {
+        if (lookupIdx >= lookupPositions.size() || lookupPositions[lookupIdx] != pos) {
+            // This event doesn't carry a pre-image, so just pass it along.
+            _queuedResults.push_back(std::move(batch[pos]));
+            continue;
+        }
+
+        auto& preImageDoc = preImageDocs[lookupIdx++];
+        uassert(ErrorCodes::NoMatchingDocument,
+                str::stream()
+                    << "Change stream was configured to require a pre-image for all update, "
+                       "delete and replace events, but the pre-image was not found for event: "
+                    << makePreImageNotFoundErrorMsg(batch[pos].getDocument()),
+                preImageDoc ||
+                    _fullDocumentBeforeChangeMode != FullDocumentBeforeChangeModeEnum::kRequired);
+
+        // Even if no pre-image was found, we have to populate the 'fullDocumentBeforeChange'
+        // field.
+        MutableDocument outputDoc(batch[pos].releaseDocument());
+        outputDoc[kFullDocumentBeforeChangeFieldName] =
+            (preImageDoc ? Value(*preImageDoc) : Value(BSONNULL));
+
+        // Do not propagate preImageId field further through the pipeline.
+        outputDoc.remove(kPreImageIdFieldName);
+
+        _queuedResults.push_back(outputDoc.freeze());
+    }
+
+    // When events were queued, the terminating non-advanced result (if any) is deliberately
+    // dropped rather than stashed: once the queue drains, the next batch polls the source again
+    // and EOF or a pause will surface then.
+    return lastResult ? std::move(*lastResult) : GetNextResult::makeEOF();
 }
 
 boost::optional<Document> DocumentSourceChangeStreamAddPreImage::lookupPreImage(
@@ -148,6 +197,40 @@ boost::optional<Document> DocumentSourceChangeStreamAddPreImage::lookupPreImage(
     return preImageField.getDocument().getOwned();
 }
 
+std::vector<boost::optional<Document>> DocumentSourceChangeStreamAddPreImage::lookupPreImages(
+    boost::intrusive_ptr<ExpressionContext> pExpCtx, const std::vector<Document>& preImageIds) {
+    const auto tenantId =
+        change_stream_serverless_helpers::resolveTenantId(pExpCtx->getNamespaceString().tenantId());
+
+    std::vector<Document> documentKeys;
+    documentKeys.reserve(preImageIds.size());
+    for (const auto& preImageId : preImageIds) {
+        documentKeys.push_back(Document{{ChangeStreamPreImage::kIdFieldName, preImageId}});
+    }
+
+    // Look up all the pre-image documents on the local node in one batch.
+    auto lookedUpDocs = pExpCtx->getMongoProcessInterface()->lookupDocumentsLocally(
+        pExpCtx, NamespaceString::makePreImageCollectionNSS(tenantId), documentKeys);
+
+    std::vector<boost::optional<Document>> preImages;
+    preImages.reserve(lookedUpDocs.size());
+    for (auto&& lookedUpDoc : lookedUpDocs) {
+        // A missing entry signifies that the pre-image was not found.
+        if (!lookedUpDoc) {
+            preImages.push_back(boost::none);
+            continue;
+        }
+
+        // Return "preImage" field value from the document.
+        auto preImageField = lookedUpDoc->getField(ChangeStreamPreImage::kPreImageFieldName);
+        tassert(9876527,
+                "Pre-image document must contain the 'preImage' field",
+                !preImageField.nullish());
+        preImages.push_back(preImageField.getDocument().getOwned());
+    }
+    return preImages;
+}
+
 Value DocumentSourceChangeStreamAddPreImage::doSerialize(const SerializationOptions& opts) const {
     return opts.verbosity
         ? Value(Document{
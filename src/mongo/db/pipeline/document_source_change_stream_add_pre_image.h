@@ -29,8 +29,10 @@
 
 #pragma once
 
+#include <deque>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
@@ -81,6 +83,17 @@ public:
     static boost::optional<Document> lookupPreImage(boost::intrusive_ptr<ExpressionContext> pExpCtx,
                                                     const Document& preImageId);
 
+    // Batched form of 'lookupPreImage': retrieves the pre-images for all the given ids with a
+    // single sorted multi-get against the pre-images collection, returning one entry per id in the
+    // same order, with boost::none for pre-images that are not available.
+    static std::vector<boost::optional<Document>> lookupPreImages(
+        boost::intrusive_ptr<ExpressionContext> pExpCtx, const std::vector<Document>& preImageIds);
+
+    // Upper bound on how many input events are gathered into one batched pre-image lookup. A batch
+    // never waits on the source: gathering stops as soon as the source has no event ready, so a
+    // sparse stream still sees each event the moment it arrives.
+    static constexpr size_t kPreImageLookupBatchSize = 32;
+
     // Removes the internal fields from the event and returns the string representation of it.
     static std::string makePreImageNotFoundErrorMsg(const Document& event);
 
@@ -141,6 +154,17 @@ private:
      */
     GetNextResult doGetNext() final;
 
+    /**
+     * Gathers the events the source has ready (up to 'kPreImageLookupBatchSize'), resolves their
+     * pre-images with one batched lookup and queues the finished events onto '_queuedResults'.
+     * Returns the non-advanced result that terminated the gathering, which the caller propagates
+     * only if nothing was queued.
+     */
+    GetNextResult _prefetchBatch();
+
+    // Events that have already had their pre-image attached and await being returned.
+    std::deque<GetNextResult> _queuedResults;
+
     // Determines whether pre-images are strictly required or may be included only when available.
     FullDocumentBeforeChangeModeEnum _fullDocumentBeforeChangeMode =
         FullDocumentBeforeChangeModeEnum::kOff;
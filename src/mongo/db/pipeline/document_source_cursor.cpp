@@ -28,6 +28,7 @@
  */
 
 
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <map>
 #include <type_traits>
@@ -53,6 +54,7 @@
 #include "mongo/db/query/query_settings/query_settings_gen.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
@@ -172,6 +174,20 @@ void DocumentSourceCursor::loadBatch() {
         },
         _exec->nss());
 
+    auto* tickSource = pExpCtx->getOperationContext()->getServiceContext()->getTickSource();
+    boost::optional<Microseconds> drainTime;
+    if (_adaptiveBatchSizing && _lastBatchLoadedAt) {
+        drainTime = tickSource->ticksTo<Microseconds>(tickSource->getTicks() - *_lastBatchLoadedAt);
+    }
+    const auto fillStart = tickSource->getTicks();
+    ScopeGuard adaptBatchSizeGuard([&] {
+        if (_adaptiveBatchSizing) {
+            auto now = tickSource->getTicks();
+            adaptBatchSizeBytes(tickSource->ticksTo<Microseconds>(now - fillStart), drainTime);
+            _lastBatchLoadedAt = now;
+        }
+    });
+
     PlanExecutor::ExecState state;
     Document resultObj;
 
@@ -241,6 +257,25 @@ void DocumentSourceCursor::loadBatch() {
     cleanupExecutor();
 }
 
+void DocumentSourceCursor::adaptBatchSizeBytes(Microseconds fillTime,
+                                               boost::optional<Microseconds> drainTime) {
+    if (!drainTime) {
+        // First batch; nothing has been measured yet.
+        return;
+    }
+    const auto upperBound = static_cast<size_t>(internalDocumentSourceCursorBatchSizeBytes.load());
+    if (fillTime >= *drainTime && _batchSizeBytes < upperBound) {
+        // The executor produces documents more slowly than the pipeline consumes them, so
+        // refilling, with its save/restore and yield overhead, is the bottleneck. Cache more per
+        // refill.
+        _batchSizeBytes = std::min(_batchSizeBytes * 2, upperBound);
+    } else if (*drainTime > fillTime * 4 && _batchSizeBytes > kMinAdaptiveBatchSizeBytes) {
+        // The pipeline dominates, so a large cache only consumes memory while the downstream
+        // stages chew through it. The asymmetric threshold keeps the limit from oscillating.
+        _batchSizeBytes = std::max(_batchSizeBytes / 2, kMinAdaptiveBatchSizeBytes);
+    }
+}
+
 void DocumentSourceCursor::_updateOplogTimestamp() {
     // If we are about to return a result, set our oplog timestamp to the optime of that result.
     if (!_currentBatch.isEmpty()) {
@@ -433,6 +468,12 @@ DocumentSourceCursor::DocumentSourceCursor(
 
     initializeBatchSizeCounts();
     _batchSizeBytes = static_cast<size_t>(internalDocumentSourceCursorBatchSizeBytes.load());
+    // Adaptive sizing is pointless when the configured maximum is already at or below the floor.
+    _adaptiveBatchSizing = internalDocumentSourceCursorAdaptiveBatchSizing.load() &&
+        _batchSizeBytes > kMinAdaptiveBatchSizeBytes;
+    if (_adaptiveBatchSizing) {
+        _batchSizeBytes = kMinAdaptiveBatchSizeBytes;
+    }
 }
 
 void DocumentSourceCursor::initializeBatchSizeCounts() {
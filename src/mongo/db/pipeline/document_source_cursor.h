@@ -64,6 +64,8 @@
 #include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/query/query_shape/serialization_options.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/tick_source.h"
 
 namespace mongo {
 
@@ -320,6 +322,16 @@ private:
      */
     void initializeBatchSizeCounts();
 
+    /**
+     * Adjusts the byte limit for the next batch based on how long the previous batch took to fill
+     * ('fillTime') relative to how long the rest of the pipeline took to drain it ('drainTime').
+     * The batch grows while the underlying executor is the bottleneck, to amortize the
+     * save/restore and yield overhead of each refill, and shrinks while the pipeline is, since a
+     * large cache then only consumes memory. Only called when adaptive batch sizing is enabled.
+     * 'drainTime' is not engaged for the first batch, when there is nothing measured yet.
+     */
+    void adaptBatchSizeBytes(Microseconds fillTime, boost::optional<Microseconds> drainTime);
+
     // Batches results returned from the underlying PlanExecutor.
     Batch _currentBatch;
 
@@ -358,8 +370,20 @@ private:
 
     // The size of each batch, grows exponentially. 0 means unlimited.
     size_t _batchSizeCount = 0;
-    // The size limit in bytes of each batch.
+    // The size limit in bytes of each batch. Fixed unless adaptive batch sizing is enabled, in
+    // which case it floats between 'kMinAdaptiveBatchSizeBytes' and the value of the
+    // 'internalDocumentSourceCursorBatchSizeBytes' knob.
     size_t _batchSizeBytes = 0;
+
+    // The lower bound for the byte limit when adaptive batch sizing is enabled. Also the starting
+    // point, so that the first results reach the rest of the pipeline quickly.
+    static constexpr size_t kMinAdaptiveBatchSizeBytes = 64 * 1024;
+
+    // Whether the byte limit of each batch adapts to the observed fill and drain rates.
+    bool _adaptiveBatchSizing = false;
+    // Tick source reading taken when the previous batch finished loading. Measures how long the
+    // rest of the pipeline takes to drain a batch.
+    boost::optional<TickSource::Tick> _lastBatchLoadedAt;
 };
 
 }  // namespace mongo
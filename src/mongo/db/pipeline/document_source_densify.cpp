@@ -40,6 +40,7 @@
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <fmt/format.h>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <tuple>
 
@@ -54,6 +55,7 @@
 #include "mongo/db/query/allowed_contexts.h"
 #include "mongo/db/query/sort_pattern.h"
 #include "mongo/idl/idl_parser.h"
+#include "mongo/platform/overflow_arithmetic.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/overloaded_visitor.h"  // IWYU pragma: keep
 
@@ -339,6 +341,48 @@ DocumentSourceInternalDensify::DocGenerator::DocGenerator(DensifyValue min,
     }
 
     tassert(5733303, "DocGenerator min must be lower or equal to max", _min <= bounds.second);
+
+    if (_min.isDate()) {
+        // Time units of a week or smaller have a constant length in UTC (the only timezone used
+        // for densification), so the series can be generated with plain millisecond arithmetic
+        // instead of a full 'dateAdd' per value.
+        switch (*_range.getUnit()) {
+            case TimeUnit::week:
+            case TimeUnit::day:
+            case TimeUnit::hour:
+            case TimeUnit::minute:
+            case TimeUnit::second:
+            case TimeUnit::millisecond: {
+                long long strideMs = 0;
+                if (!overflow::mul(timeUnitTypicalMilliseconds(*_range.getUnit()),
+                                   _range.getStep().coerceToLong(),
+                                   &strideMs) &&
+                    bounds.second.getDate().toMillisSinceEpoch() <=
+                        std::numeric_limits<long long>::max() - strideMs) {
+                    _dateStride = Milliseconds(strideMs);
+                }
+                break;
+            }
+            default:
+                // Months, quarters and years vary in length; each step must go through 'dateAdd'.
+                break;
+        }
+    }
+}
+
+void DocumentSourceInternalDensify::DocGenerator::fillValueBlock() {
+    _valueBlock.clear();
+    _valueBlockIdx = 0;
+    ExplicitBounds bounds = get<ExplicitBounds>(_range.getBounds());
+    while (!_seriesExhausted && _valueBlock.size() < kValueBlockSize) {
+        _valueBlock.push_back(_min.toValue());
+        DensifyValue nextValue = _dateStride ? DensifyValue(_min.getDate() + *_dateStride)
+                                             : _min.increment(_range);
+        if (bounds.second < nextValue || (!_maxInclusive && bounds.second <= nextValue)) {
+            _seriesExhausted = true;
+        }
+        _min = nextValue;
+    }
 }
 
 Document DocumentSourceInternalDensify::DocGenerator::getNextDocument() {
@@ -351,18 +395,19 @@ Document DocumentSourceInternalDensify::DocGenerator::getNextDocument() {
         tassert(5832800, "DocGenerator expected _finalDoc, found boost::none", _finalDoc);
         return _finalDoc.value();
     }
-    // Assume all types have been checked at this point and we are in a valid state.
-    DensifyValue valueToAdd = _min;
-    DensifyValue nextValue = _min.increment(_range);
-    ExplicitBounds bounds = get<ExplicitBounds>(_range.getBounds());
-
-    if (bounds.second < nextValue || (!_maxInclusive && bounds.second <= nextValue)) {
+    // Assume all types have been checked at this point and we are in a valid state. The series is
+    // precomputed in blocks; each call only patches the next value into the template of preserved
+    // fields.
+    if (_valueBlockIdx == _valueBlock.size()) {
+        fillValueBlock();
+    }
+    Value valueToAdd = _valueBlock[_valueBlockIdx++];
+    if (_valueBlockIdx == _valueBlock.size() && _seriesExhausted) {
         _state = _finalDoc ? GeneratorState::kReturningFinalDocument : GeneratorState::kDone;
     }
-    _min = nextValue;
 
     MutableDocument retDoc(_includeFields);
-    retDoc.setNestedField(_path, valueToAdd.toValue());
+    retDoc.setNestedField(_path, valueToAdd);
     ++(*_counter);
     return retDoc.freeze();
 }
@@ -362,6 +362,16 @@ public:
 
 
     private:
+        /**
+         * Computes the next block of up to 'kValueBlockSize' series values into '_valueBlock',
+         * advancing '_min' past them and setting '_seriesExhausted' once the bounds are reached.
+         * Precomputing the series in blocks keeps the per-document work down to patching the
+         * densify field into the template of preserved fields.
+         */
+        void fillValueBlock();
+
+        static constexpr size_t kValueBlockSize = 1024;
+
         ValueComparator _comp;
         RangeStatement _range;
         // The field to add to 'includeFields' to generate a document.
@@ -378,6 +388,17 @@ public:
         DensifyValue _min;
         bool _maxInclusive = false;
 
+        // The current block of precomputed series values, handed out through '_valueBlockIdx'.
+        std::vector<Value> _valueBlock;
+        size_t _valueBlockIdx = 0;
+        // Fixed millisecond stride for date series whose unit has a constant length in UTC (week
+        // and smaller). Lets 'fillValueBlock' advance the series with plain millisecond arithmetic
+        // instead of a full 'dateAdd' per generated value.
+        boost::optional<Milliseconds> _dateStride;
+        // Set once the series has been computed up to the bounds; any values not yet handed out
+        // are in '_valueBlock'.
+        bool _seriesExhausted = false;
+
         enum class GeneratorState {
             // Generating documents between '_min' and the upper bound.
             kGeneratingDocuments,
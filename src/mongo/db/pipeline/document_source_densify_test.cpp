@@ -322,6 +322,31 @@ TEST(DensifyGeneratorTest, GeneratesNumberOfNumericDocumentsCorrectly) {
     ASSERT_TRUE(generator.done());
 }
 
+TEST(DensifyGeneratorTest, GeneratesSeriesLongerThanOneValueBlockCorrectly) {
+    Document doc{{"a", 5000}};
+    size_t counter = 0;
+    // A series of 2500 values spans several of the generator's precomputed value blocks.
+    auto generator =
+        GenClass(Value(0),
+                 RangeStatement(Value(1), ExplicitBounds(Value(0), Value(2500)), boost::none),
+                 "a",
+                 Document(),
+                 doc,
+                 boost::none,
+                 ValueComparator(),
+                 &counter,
+                 false);
+    for (int curVal = 0; curVal < 2500; ++curVal) {
+        ASSERT_FALSE(generator.done());
+        Document nextDoc{{"a", curVal}};
+        ASSERT_DOCUMENT_EQ(nextDoc, generator.getNextDocument());
+    }
+    ASSERT_FALSE(generator.done());
+    ASSERT_DOCUMENT_EQ(doc, generator.getNextDocument());
+    ASSERT_TRUE(generator.done());
+    ASSERT_EQ(counter, 2500UL);
+}
+
 TEST(DensifyGeneratorTest, WorksWithNonIntegerStepAndPreserveFields) {
     Document doc{{"a", 2}, {"b", 2}, {"c", 2}};
     Document preserveFields{{"b", 1}, {"c", 1}};
@@ -34,7 +34,9 @@
 // IWYU pragma: no_include "cxxabi.h"
 #include <algorithm>
 #include <compare>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <mutex>
 #include <set>
 #include <utility>
@@ -46,6 +48,8 @@
 #include "mongo/bson/bsontypes.h"
 #include "mongo/db/hasher.h"
 #include "mongo/db/pipeline/document_source_exchange.h"
+#include "mongo/db/pipeline/document_source_group.h"
+#include "mongo/db/pipeline/expression.h"
 #include "mongo/db/storage/key_string/key_string.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
@@ -277,6 +281,77 @@ std::vector<FieldPath> Exchange::extractKeyPaths(const BSONObj& keyPattern) {
     return paths;
 }
 
+boost::optional<ExchangeSpec> Exchange::makeGroupKeyPartitionSpec(const Pipeline& pipeline,
+                                                                  size_t nConsumers) {
+    if (nConsumers < 2 || nConsumers > kMaxNumberConsumers) {
+        return boost::none;
+    }
+
+    if (pipeline.getSources().empty()) {
+        return boost::none;
+    }
+
+    auto groupStage = dynamic_cast<DocumentSourceGroup*>(pipeline.getSources().front().get());
+    if (!groupStage || groupStage->doingMerge()) {
+        // A merging $group receives partial groups whose keys have already been computed into
+        // '_id'; partitioning it would need the renamed paths, which the caller can set up by
+        // splitting the pipeline first.
+        return boost::none;
+    }
+
+    // The partitioning function can only route on fields of the input document, so every id
+    // expression must be a plain field path.
+    BSONObjBuilder keyPattern;
+    for (auto&& idExpression : groupStage->getIdExpressions()) {
+        auto fieldPathExpr = dynamic_cast<ExpressionFieldPath*>(idExpression.get());
+        if (!fieldPathExpr || fieldPathExpr->isVariableReference() || fieldPathExpr->isROOT()) {
+            return boost::none;
+        }
+        keyPattern.append(fieldPathExpr->getFieldPathWithoutCurrentPrefix().fullPath(), "hashed"_sd);
+    }
+    const auto key = keyPattern.obj();
+    const auto nKeyFields = key.nFields();
+
+    // Partition the hash space of the first key field into 'nConsumers' equal ranges. The
+    // remaining key fields only break ties within a range, so the interior boundary values for
+    // them are MinKey. The overall lower and upper bounds must be MinKey/MaxKey in every field.
+    auto makeUniformBoundary = [&](auto&& appendField) {
+        BSONObjBuilder bob;
+        for (int idx = 0; idx < nKeyFields; ++idx) {
+            appendField(bob);
+        }
+        return bob.obj();
+    };
+
+    std::vector<BSONObj> boundaries;
+    boundaries.push_back(makeUniformBoundary([](BSONObjBuilder& bob) { bob.appendMinKey(""); }));
+    const uint64_t step = std::numeric_limits<uint64_t>::max() / nConsumers;
+    for (size_t idx = 1; idx < nConsumers; ++idx) {
+        BSONObjBuilder bob;
+        bob.append("",
+                   static_cast<long long>(
+                       static_cast<uint64_t>(std::numeric_limits<long long>::min()) + idx * step));
+        for (int fieldIdx = 1; fieldIdx < nKeyFields; ++fieldIdx) {
+            bob.appendMinKey("");
+        }
+        boundaries.push_back(bob.obj());
+    }
+    boundaries.push_back(makeUniformBoundary([](BSONObjBuilder& bob) { bob.appendMaxKey(""); }));
+
+    std::vector<std::int32_t> consumerIds;
+    for (size_t idx = 0; idx < nConsumers; ++idx) {
+        consumerIds.push_back(static_cast<std::int32_t>(idx));
+    }
+
+    ExchangeSpec spec;
+    spec.setPolicy(ExchangePolicyEnum::kKeyRange);
+    spec.setKey(key);
+    spec.setBoundaries(std::move(boundaries));
+    spec.setConsumers(static_cast<std::int32_t>(nConsumers));
+    spec.setConsumerIds(std::move(consumerIds));
+    return spec;
+}
+
 void Exchange::unblockLoading(size_t consumerId) {
     // See if the loading is blocked on this consumer and if so unblock it.
     if (_loadingThreadId == consumerId) {
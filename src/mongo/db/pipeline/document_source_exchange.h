@@ -101,6 +101,18 @@ public:
      **/
     Exchange(ExchangeSpec spec, std::unique_ptr<Pipeline, PipelineDeleter> pipeline);
 
+    /**
+     * If the first stage of 'pipeline' is a $group whose _id consists entirely of field paths,
+     * returns a specification that hash-partitions input documents among 'nConsumers' consumers on
+     * those fields. All documents with the same group key hash to the same consumer, so each
+     * consumer computes complete groups for its partition and the consumers' outputs only need to
+     * be concatenated. Returns boost::none if the pipeline cannot be partitioned this way or if
+     * 'nConsumers' is not a meaningful degree of parallelism (fewer than 2, or more than the
+     * exchange supports).
+     */
+    static boost::optional<ExchangeSpec> makeGroupKeyPartitionSpec(const Pipeline& pipeline,
+                                                                   size_t nConsumers);
+
     /**
      * Interface for retrieving the next document. 'resourceYielder' is optional, and if provided,
      * will be used to give up resources while waiting for other threads to empty their buffers.
@@ -31,6 +31,7 @@
 #include <boost/move/utility_core.hpp>
 #include <cstdint>
 #include <mutex>
+#include <set>
 #include <utility>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -38,6 +39,7 @@
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
 #include "mongo/db/hasher.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/pipeline/aggregation_context_fixture.h"
@@ -58,6 +60,7 @@
 #include "mongo/platform/random.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/unittest/assert.h"
+#include "mongo/unittest/bson_test_util.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/time_support.h"
@@ -654,6 +657,106 @@ TEST_F(DocumentSourceExchangeTest, RangeRandomHashExchangeNConsumer) {
     ASSERT_EQ(nDocs, processedDocs.load());
 }
 
+TEST_F(DocumentSourceExchangeTest, GroupKeyPartitionSpecForLeadingGroup) {
+    auto pipeline = Pipeline::parse(
+        {fromjson("{$group: {_id: '$a', count: {$sum: 1}}}")}, getExpCtx());
+
+    const size_t nConsumers = 4;
+    auto spec = Exchange::makeGroupKeyPartitionSpec(*pipeline, nConsumers);
+    ASSERT_TRUE(spec);
+    ASSERT(spec->getPolicy() == ExchangePolicyEnum::kKeyRange);
+    ASSERT_BSONOBJ_EQ(spec->getKey(),
+                      BSON("a"
+                           << "hashed"));
+    ASSERT_EQ(spec->getConsumers(), static_cast<int>(nConsumers));
+    ASSERT_EQ(spec->getBoundaries()->size(), nConsumers + 1);
+    ASSERT_EQ(spec->getConsumerIds()->size(), nConsumers);
+
+    // The generated boundaries must pass the Exchange constructor's validation.
+    const size_t nDocs = 500;
+    auto source = getRandomMockSource(nDocs, getNewSeed());
+    boost::intrusive_ptr<Exchange> ex =
+        new Exchange(std::move(*spec), Pipeline::create({source}, getExpCtx()));
+
+    // Each distinct group key must be routed to exactly one consumer, so that per-consumer
+    // $group results only need concatenating.
+    std::vector<ThreadInfo> threads = createNProducers(nConsumers, ex);
+    std::vector<executor::TaskExecutor::CallbackHandle> handles;
+    std::vector<std::set<int>> keysPerConsumer(nConsumers);
+    AtomicWord<size_t> processedDocs{0};
+
+    for (size_t id = 0; id < nConsumers; ++id) {
+        auto docSourceExchange = threads[id].documentSourceExchange.get();
+        auto keys = &keysPerConsumer[id];
+        auto handle = _executor->scheduleWork(
+            [docSourceExchange, keys, &processedDocs](
+                const executor::TaskExecutor::CallbackArgs& cb) {
+                auto input = docSourceExchange->getNext();
+                size_t docs = 0;
+                for (; input.isAdvanced(); input = docSourceExchange->getNext()) {
+                    keys->insert(input.getDocument()["a"].getInt());
+                    ++docs;
+                }
+                processedDocs.fetchAndAdd(docs);
+            });
+
+        handles.emplace_back(std::move(handle.getValue()));
+    }
+
+    for (auto& h : handles)
+        _executor->wait(h);
+
+    ASSERT_EQ(nDocs, processedDocs.load());
+
+    std::set<int> allKeys;
+    size_t totalKeys = 0;
+    for (auto&& keys : keysPerConsumer) {
+        totalKeys += keys.size();
+        allKeys.insert(keys.begin(), keys.end());
+    }
+    ASSERT_EQ(totalKeys, allKeys.size());
+}
+
+TEST_F(DocumentSourceExchangeTest, GroupKeyPartitionSpecForCompoundGroupKey) {
+    auto pipeline =
+        Pipeline::parse({fromjson("{$group: {_id: {x: '$a', y: '$b.c'}}}")}, getExpCtx());
+
+    auto spec = Exchange::makeGroupKeyPartitionSpec(*pipeline, 3);
+    ASSERT_TRUE(spec);
+    ASSERT_BSONOBJ_EQ(spec->getKey(),
+                      BSON("a"
+                           << "hashed"
+                           << "b.c"
+                           << "hashed"));
+
+    // The compound-key boundaries must pass the Exchange constructor's validation.
+    boost::intrusive_ptr<Exchange> ex =
+        new Exchange(std::move(*spec), Pipeline::create({}, getExpCtx()));
+    ASSERT_EQ(ex->getConsumers(), 3u);
+}
+
+TEST_F(DocumentSourceExchangeTest, NoGroupKeyPartitionSpecWithoutLeadingGroup) {
+    auto pipeline = Pipeline::parse({fromjson("{$match: {a: 1}}")}, getExpCtx());
+    ASSERT_FALSE(Exchange::makeGroupKeyPartitionSpec(*pipeline, 4));
+}
+
+TEST_F(DocumentSourceExchangeTest, NoGroupKeyPartitionSpecForComputedGroupKey) {
+    auto pipeline =
+        Pipeline::parse({fromjson("{$group: {_id: {$add: ['$a', 1]}}}")}, getExpCtx());
+    ASSERT_FALSE(Exchange::makeGroupKeyPartitionSpec(*pipeline, 4));
+
+    pipeline = Pipeline::parse({fromjson("{$group: {_id: null}}")}, getExpCtx());
+    ASSERT_FALSE(Exchange::makeGroupKeyPartitionSpec(*pipeline, 4));
+
+    pipeline = Pipeline::parse({fromjson("{$group: {_id: '$$ROOT'}}")}, getExpCtx());
+    ASSERT_FALSE(Exchange::makeGroupKeyPartitionSpec(*pipeline, 4));
+}
+
+TEST_F(DocumentSourceExchangeTest, NoGroupKeyPartitionSpecForSingleConsumer) {
+    auto pipeline = Pipeline::parse({fromjson("{$group: {_id: '$a'}}")}, getExpCtx());
+    ASSERT_FALSE(Exchange::makeGroupKeyPartitionSpec(*pipeline, 1));
+}
+
 TEST_F(DocumentSourceExchangeTest, RejectNoConsumers) {
     BSONObj spec = BSON("policy"
                         << "broadcast"
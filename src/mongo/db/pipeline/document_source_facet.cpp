@@ -205,8 +205,9 @@ DocumentSource::GetNextResult DocumentSourceFacet::doGetNext() {
         allPipelinesEOF = true;  // Set this to false if any pipeline isn't EOF.
         for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
             const auto& pipeline = _facets[facetId].pipeline;
-            auto next = pipeline->getSources().back()->getNext();
-            for (; next.isAdvanced(); next = pipeline->getSources().back()->getNext()) {
+            auto* lastStage = pipeline->getSources().back().get();
+            auto next = lastStage->getNext();
+            for (; next.isAdvanced(); next = lastStage->getNext()) {
                 ensureUnderMemoryLimit(next.getDocument().getApproximateSize());
                 results[facetId].emplace_back(next.releaseDocument());
             }
@@ -492,6 +492,16 @@ auto DocumentSourceGraphLookUp::makeQueryFromQueue() -> Query {
                                 _queue.popFront();
                                 continue;
                             }
+
+                            // Distinct documents often share a 'connectFromField' value, so the
+                            // same value may appear in the queue multiple times at this depth.
+                            // Querying for it once is enough; duplicate $in entries only widen
+                            // the query and its index bounds.
+                            if (result.queried.find(value) != result.queried.end()) {
+                                _queue.popFront();
+                                continue;
+                            }
+
                             if (match.len() + value.getApproximateSize() > BSONObjMaxUserSize) {
                                 uassert(
                                     2398001,
@@ -54,6 +54,7 @@
 #include "mongo/db/query/timeseries/bucket_spec.h"
 #include "mongo/db/query/util/make_data_structure.h"
 #include "mongo/db/timeseries/timeseries_options.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/bson_test_util.h"
 #include "mongo/unittest/framework.h"
@@ -177,6 +178,36 @@ TEST_F(InternalUnpackBucketPredicateMappingOptimizationTest,
     ASSERT_FALSE(predicate.tightPredicate);
 }
 
+TEST_F(InternalUnpackBucketPredicateMappingOptimizationTest,
+       OptimizeMapsEQPredicatesToDistinctSummaryWhenEnabled) {
+    RAIIServerParameterControllerForTest controller("timeseriesBucketMaxDistinctSummaryValues", 8);
+
+    auto pipeline =
+        Pipeline::parse(makeVector(fromjson("{$_internalUnpackBucket: {exclude: [], timeField: "
+                                            "'time', bucketMaxSpanSeconds: 3600}}"),
+                                   fromjson("{$match: {a: {$eq: 1}}}")),
+                        getExpCtx());
+    auto& container = pipeline->getSources();
+
+    ASSERT_EQ(pipeline->getSources().size(), 2U);
+
+    auto original = dynamic_cast<DocumentSourceMatch*>(container.back().get());
+    auto predicate = dynamic_cast<DocumentSourceInternalUnpackBucket*>(container.front().get())
+                         ->createPredicatesOnBucketLevelField(original->getMatchExpression());
+
+    // In addition to the min/max range check, buckets carrying a 'control.distinct' summary for
+    // the field can be excluded when the summary does not contain the queried value.
+    ASSERT_BSONOBJ_EQ(predicate.loosePredicate->serialize(),
+                      fromjson("{$and: ["
+                               "{$or: [ {$and:[{'control.min.a': {$_internalExprLte: 1}},"
+                               "{'control.max.a': {$_internalExprGte: 1}}]},"
+                               "{$expr: {$ne: [ {$type: [ \"$control.min.a\" ]},"
+                               "{$type: [ \"$control.max.a\" ]} ]}} ]},"
+                               "{$or: [ {'control.distinct.a': {$not: {$exists: true}}},"
+                               "{'control.distinct.a': {$eq: 1}} ]} ]}"));
+    ASSERT_FALSE(predicate.tightPredicate);
+}
+
 TEST_F(InternalUnpackBucketPredicateMappingOptimizationTest,
        OptimizeMapsINPredicatesOnControlField) {
     auto pipeline =
@@ -0,0 +1,101 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/bsontypes.h"
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/pipeline/document_source_operation_samples.h"
+#include "mongo/db/query/allowed_contexts.h"
+#include "mongo/db/stats/operation_sampler.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/intrusive_counter.h"
+
+namespace mongo {
+
+using boost::intrusive_ptr;
+
+REGISTER_DOCUMENT_SOURCE(operationSamples,
+                         DocumentSourceOperationSamples::LiteParsed::parse,
+                         DocumentSourceOperationSamples::createFromBson,
+                         AllowedWithApiStrict::kNeverInVersion1);
+ALLOCATE_DOCUMENT_SOURCE_ID(operationSamples, DocumentSourceOperationSamples::id)
+
+const char* DocumentSourceOperationSamples::getSourceName() const {
+    return kStageName.rawData();
+}
+
+namespace {
+static constexpr StringData kClearSamples = "clearSamples"_sd;
+}  // namespace
+
+DocumentSource::GetNextResult DocumentSourceOperationSamples::doGetNext() {
+    if (!_fetched) {
+        _samples = OperationSampler::get().getSamples(_clearSamples);
+        _samplesIter = _samples.begin();
+        _fetched = true;
+    }
+
+    if (_samplesIter != _samples.end()) {
+        auto doc = Document(*_samplesIter);
+        _samplesIter++;
+        return doc;
+    }
+
+    return GetNextResult::makeEOF();
+}
+
+intrusive_ptr<DocumentSource> DocumentSourceOperationSamples::createFromBson(
+    BSONElement elem, const intrusive_ptr<ExpressionContext>& pExpCtx) {
+    const NamespaceString& nss = pExpCtx->getNamespaceString();
+    uassert(ErrorCodes::InvalidNamespace,
+            "$operationSamples must be run against the 'admin' database with {aggregate: 1}",
+            nss.isAdminDB() && nss.isCollectionlessAggregateNS());
+
+    uassert(ErrorCodes::BadValue,
+            "The $operationSamples stage specification must be an object",
+            elem.type() == Object);
+
+    auto stageObj = elem.Obj();
+    bool clearSamples = false;
+    if (auto clearElem = stageObj.getField(kClearSamples); !clearElem.eoo()) {
+        clearSamples = clearElem.trueValue();
+    } else if (!stageObj.isEmpty()) {
+        uasserted(
+            ErrorCodes::BadValue,
+            "The $operationSamples stage specification must be empty or contain valid options");
+    }
+    return new DocumentSourceOperationSamples(pExpCtx, clearSamples);
+}
+
+Value DocumentSourceOperationSamples::serialize(const SerializationOptions& opts) const {
+    return Value(DOC(getSourceName() << Document()));
+}
+}  // namespace mongo
@@ -82,6 +82,10 @@ REGISTER_DOCUMENT_SOURCE(out,
 ALLOCATE_DOCUMENT_SOURCE_ID(out, DocumentSourceOut::id)
 
 DocumentSourceOut::~DocumentSourceOut() {
+    // Stop the background writer before tearing anything down. Any error it hit is irrelevant at
+    // this point: either 'finalize' already surfaced it, or the query is being destroyed early.
+    joinBackgroundWriter();
+
     if (_tmpCleanUpState == OutCleanUpProgress::kComplete) {
         return;
     }
@@ -403,7 +407,111 @@ void DocumentSourceOut::createTimeseriesView() {
         pExpCtx->getOperationContext(), getOutputNs(), cmd.done(), _timeseries.value());
 }
 
+void DocumentSourceOut::flush(BatchedCommandRequest bcr, BatchedObjects batch) {
+    auto insertCommand = bcr.extractInsertRequest();
+    insertCommand->setDocuments(std::move(batch));
+
+    if (_timeseries) {
+        // Time-series inserts re-bucket the measurements on the way in; keep them on the pipeline
+        // thread so that errors surface with the batch that caused them.
+        DocumentSourceWriteBlock writeBlock(pExpCtx->getOperationContext());
+        uassertStatusOK(pExpCtx->getMongoProcessInterface()->insertTimeseries(
+            pExpCtx, _tempNs, std::move(insertCommand), _writeConcern, boost::none));
+        return;
+    }
+
+    enqueueBatch(std::move(insertCommand));
+}
+
+void DocumentSourceOut::enqueueBatch(
+    std::unique_ptr<write_ops::InsertCommandRequest> insertCommand) {
+    if (!_writerThread.joinable()) {
+        auto* service = pExpCtx->getOperationContext()->getService();
+        auto mongoProcessInterface = pExpCtx->getMongoProcessInterface();
+        _writerThread = stdx::thread([this, service, mongoProcessInterface] {
+            backgroundWriterLoop(service, std::move(mongoProcessInterface));
+        });
+    }
+
+    auto* opCtx = pExpCtx->getOperationContext();
+    stdx::unique_lock<stdx::mutex> lk(_writerMutex);
+    opCtx->waitForConditionOrInterrupt(_writerHasSpace, lk, [&] {
+        return !_writerError.isOK() || _pendingBatches.size() < kMaxPendingBatches;
+    });
+    uassertStatusOK(_writerError);
+    _pendingBatches.push_back(std::move(insertCommand));
+    lk.unlock();
+    _writerHasWork.notify_one();
+}
+
+void DocumentSourceOut::backgroundWriterLoop(
+    Service* service, std::shared_ptr<MongoProcessInterface> mongoProcessInterface) {
+    Client::initThread("$out_background_writer", service);
+    auto opCtxOwned = cc().makeOperationContext();
+    auto* opCtx = opCtxOwned.get();
+
+    // The writer's expression context only carries its operation context into the insert path;
+    // the write target is the stage-private temporary collection.
+    auto writerExpCtx = ExpressionContextBuilder{}
+                            .opCtx(opCtx)
+                            .ns(_tempNs)
+                            .mongoProcessInterface(mongoProcessInterface)
+                            .build();
+
+    for (;;) {
+        std::unique_ptr<write_ops::InsertCommandRequest> insertCommand;
+        bool discard;
+        {
+            stdx::unique_lock<stdx::mutex> lk(_writerMutex);
+            _writerHasWork.wait(lk, [&] { return _writerShutdown || !_pendingBatches.empty(); });
+            if (_pendingBatches.empty()) {
+                break;
+            }
+            insertCommand = std::move(_pendingBatches.front());
+            _pendingBatches.pop_front();
+            // After a write has failed, keep draining the queue (discarding the batches) so that
+            // the pipeline thread is never left blocked on a full queue.
+            discard = !_writerError.isOK();
+        }
+
+        Status status = Status::OK();
+        if (!discard) {
+            try {
+                DocumentSourceWriteBlock writeBlock(opCtx);
+                status = mongoProcessInterface->insert(
+                    writerExpCtx, _tempNs, std::move(insertCommand), _writeConcern, boost::none);
+            } catch (const DBException& ex) {
+                status = ex.toStatus();
+            }
+        }
+
+        {
+            stdx::lock_guard<stdx::mutex> lk(_writerMutex);
+            if (!status.isOK() && _writerError.isOK()) {
+                _writerError = status.withContext("$out background write failed");
+            }
+        }
+        _writerHasSpace.notify_one();
+    }
+}
+
+void DocumentSourceOut::joinBackgroundWriter() {
+    if (!_writerThread.joinable()) {
+        return;
+    }
+    {
+        stdx::lock_guard<stdx::mutex> lk(_writerMutex);
+        _writerShutdown = true;
+    }
+    _writerHasWork.notify_one();
+    _writerThread.join();
+}
+
 void DocumentSourceOut::finalize() {
+    // All batches must be on disk before the temporary collection is renamed into place.
+    joinBackgroundWriter();
+    uassertStatusOK(_writerError);
+
     DocumentSourceWriteBlock writeBlock(pExpCtx->getOperationContext());
     uassert(7406101,
             "$out to time-series collections is only supported on FCV greater than or equal to 7.1",
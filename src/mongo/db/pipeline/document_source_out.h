@@ -33,6 +33,7 @@
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <deque>
 #include <fmt/format.h>
 #include <list>
 #include <memory>
@@ -69,6 +70,9 @@
 #include "mongo/db/repl/read_concern_level.h"
 #include "mongo/db/timeseries/timeseries_gen.h"
 #include "mongo/s/write_ops/batched_command_request.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/intrusive_counter.h"
 
@@ -183,21 +187,7 @@ private:
 
     void finalize() override;
 
-    void flush(BatchedCommandRequest bcr, BatchedObjects batch) override {
-        DocumentSourceWriteBlock writeBlock(pExpCtx->getOperationContext());
-
-        auto insertCommand = bcr.extractInsertRequest();
-        insertCommand->setDocuments(std::move(batch));
-        auto targetEpoch = boost::none;
-
-        if (_timeseries) {
-            uassertStatusOK(pExpCtx->getMongoProcessInterface()->insertTimeseries(
-                pExpCtx, _tempNs, std::move(insertCommand), _writeConcern, targetEpoch));
-        } else {
-            uassertStatusOK(pExpCtx->getMongoProcessInterface()->insert(
-                pExpCtx, _tempNs, std::move(insertCommand), _writeConcern, targetEpoch));
-        }
-    }
+    void flush(BatchedCommandRequest bcr, BatchedObjects batch) override;
 
     std::pair<BSONObj, int> makeBatchObject(Document doc) const override {
         auto obj = doc.toBson();
@@ -243,6 +233,27 @@ private:
      */
     void createTimeseriesView();
 
+    /**
+     * Hands 'insertCommand' to the background writer thread, starting the thread on the first
+     * call. Blocks while 'kMaxPendingBatches' batches are already queued, which provides
+     * backpressure on the upstream pipeline. Throws if a previous background write failed.
+     */
+    void enqueueBatch(std::unique_ptr<write_ops::InsertCommandRequest> insertCommand);
+
+    /**
+     * Body of the background writer thread: writes queued batches to the temporary collection
+     * under its own Client and OperationContext until shut down and drained.
+     */
+    void backgroundWriterLoop(Service* service,
+                              std::shared_ptr<MongoProcessInterface> mongoProcessInterface);
+
+    /**
+     * Waits for the background writer thread, if started, to write all queued batches and exit.
+     * Does not throw; callers that must surface a background write failure check '_writerError'
+     * afterwards.
+     */
+    void joinBackgroundWriter();
+
     // Stash the writeConcern of the original command as the operation context may change by the
     // time we start to flush writes. This is because certain aggregations (e.g. $exchange)
     // establish cursors with batchSize 0 then run subsequent getMore's which use a new operation
@@ -264,6 +275,19 @@ private:
     // 'validateTimeseries', since 'validateTimeseries' sets this value.
     boost::optional<TimeseriesOptions> _timeseries;
 
+    // Batches are written to the temporary collection by a dedicated thread so that the upstream
+    // pipeline can compute the next batch while the previous one is being written. The queue is
+    // bounded: 'enqueueBatch' blocks once 'kMaxPendingBatches' batches are awaiting a write.
+    static constexpr size_t kMaxPendingBatches = 2;
+
+    stdx::mutex _writerMutex;
+    stdx::condition_variable _writerHasWork;
+    stdx::condition_variable _writerHasSpace;
+    std::deque<std::unique_ptr<write_ops::InsertCommandRequest>> _pendingBatches;
+    Status _writerError = Status::OK();
+    bool _writerShutdown = false;
+    stdx::thread _writerThread;
+
     // Tracks the current state of the temporary collection, and is used for cleanup.
     OutCleanUpProgress _tmpCleanUpState = OutCleanUpProgress::kComplete;
 };
@@ -50,6 +50,7 @@
 #include "mongo/db/pipeline/process_interface/mongo_process_interface.h"
 #include "mongo/db/query/allowed_contexts.h"
 #include "mongo/db/query/plan_summary_stats.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/views/resolved_view.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/logv2/log.h"
@@ -251,23 +252,8 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceUnionWith::createFromBson(
         expCtx, std::move(unionNss), std::move(pipeline));
 }
 
-DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
-    if (!_pipeline) {
-        // We must have already been disposed, so we're finished.
-        return GetNextResult::makeEOF();
-    }
-
-    if (_executionState == ExecutionProgress::kIteratingSource) {
-        auto nextInput = pSource->getNext();
-        if (!nextInput.isEOF()) {
-            return nextInput;
-        }
-        _executionState = ExecutionProgress::kStartingSubPipeline;
-        // All documents from the base collection have been returned, switch to iterating the sub-
-        // pipeline by falling through below.
-    }
-
-    if (_executionState == ExecutionProgress::kStartingSubPipeline) {
+void DocumentSourceUnionWith::prepareSubPipelineForExecution() {
+    while (!_subPipelinePrepared) {
         // Since the subpipeline will be executed again for explain, we store the starting
         // state of the variables to reset them later.
         if (pExpCtx->getExplain()) {
@@ -297,7 +283,7 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
                         "$unionWith POST pipeline prep: ",
                         "pipeline"_attr = _pipeline->serializeToBson());
 
-            _executionState = ExecutionProgress::kIteratingSubPipeline;
+            _subPipelinePrepared = true;
         } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& e) {
             _pipeline = buildPipelineFromViewDefinition(
                 pExpCtx,
@@ -305,9 +291,37 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
                 std::move(serializedPipe),
                 e->getNamespace());
             logShardedViewFound(e);
-            return doGetNext();
         }
     }
+}
+
+DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
+    if (!_pipeline) {
+        // We must have already been disposed, so we're finished.
+        return GetNextResult::makeEOF();
+    }
+
+    if (_executionState == ExecutionProgress::kIteratingSource) {
+        if (!_subPipelinePrepared && internalQueryUnionWithEagerlyPrepareSubPipeline.load()) {
+            // Prepare the sub-pipeline before draining 'pSource' so that its remote cursors are
+            // established (and the remote hosts start producing) while the base branch is still
+            // streaming. The sub-pipeline is not iterated until 'pSource' is exhausted, so the
+            // stage's output order is unchanged.
+            prepareSubPipelineForExecution();
+        }
+        auto nextInput = pSource->getNext();
+        if (!nextInput.isEOF()) {
+            return nextInput;
+        }
+        _executionState = ExecutionProgress::kStartingSubPipeline;
+        // All documents from the base collection have been returned, switch to iterating the sub-
+        // pipeline by falling through below.
+    }
+
+    if (_executionState == ExecutionProgress::kStartingSubPipeline) {
+        prepareSubPipelineForExecution();
+        _executionState = ExecutionProgress::kIteratingSubPipeline;
+    }
 
     // The $unionWith stage takes responsibility for disposing of its Pipeline. When the outer
     // Pipeline that contains the $unionWith is disposed of, it will propagate dispose() to its
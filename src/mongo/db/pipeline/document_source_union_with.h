@@ -249,6 +249,13 @@ private:
     void logShardedViewFound(
         const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& e) const;
 
+    /**
+     * Prepares '_pipeline' for execution, retrying with a resolved view definition if the union
+     * namespace turns out to be a sharded view. Idempotent; sets '_subPipelinePrepared' on
+     * success.
+     */
+    void prepareSubPipelineForExecution();
+
     std::unique_ptr<Pipeline, PipelineDeleter> _pipeline;
     // The original, unresolved namespace to union.
     NamespaceString _userNss;
@@ -260,6 +267,13 @@ private:
     // copies of these stages as they may be pushed down to the find layer.
     std::vector<BSONObj> _pushedDownStages;
     ExecutionProgress _executionState = ExecutionProgress::kIteratingSource;
+
+    // Whether '_pipeline' has been prepared for execution. Preparation normally happens once
+    // 'pSource' is exhausted, but when the 'internalQueryUnionWithEagerlyPrepareSubPipeline' knob
+    // is set it happens on the first call to doGetNext() so that remote cursors of the union
+    // branch are established (and start producing) while the base branch is still streaming.
+    bool _subPipelinePrepared = false;
+
     UnionWithStats _stats;
 
     // $unionWith will execute the subpipeline twice for explain with execution stats - once for
@@ -65,6 +65,7 @@
 #include "mongo/db/field_ref.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/expression_cse.h"
 #include "mongo/db/pipeline/expression_parser_gen.h"
 #include "mongo/db/pipeline/variable_validation.h"
 #include "mongo/db/query/bson/dotted_path_support.h"
@@ -1579,6 +1580,11 @@ intrusive_ptr<Expression> ExpressionObject::optimize() {
         return ExpressionConstant::create(
             getExpressionContext(), evaluate(Document(), &(getExpressionContext()->variables)));
     }
+    if (internalQueryEnableCommonSubexpressionHoisting.load()) {
+        // Fields of a projection-like object frequently repeat the same computation; bind such
+        // duplicates to a $let variable so they are evaluated once per document.
+        return expression_cse::hoistCommonSubexpressions(getExpressionContext(), this);
+    }
     return this;
 }
 
@@ -0,0 +1,209 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/pipeline/expression_cse.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/exec/document_value/value_comparator.h"
+#include "mongo/db/pipeline/expression_dependencies.h"
+#include "mongo/db/pipeline/expression_function.h"
+#include "mongo/db/pipeline/variables.h"
+
+namespace mongo::expression_cse {
+namespace {
+
+// Trees larger than this are left alone. Identifying duplicates serializes every subexpression and
+// is quadratic in the size of the tree in the worst case, which is only acceptable for trees of
+// moderate size.
+constexpr size_t kMaxNodesToConsider = 10'000;
+
+size_t countNodes(const Expression* expr) {
+    size_t nodes = 1;
+    for (auto&& child : expr->getChildren()) {
+        if (child) {
+            nodes += countNodes(child.get());
+        }
+    }
+    return nodes;
+}
+
+/**
+ * Returns true if any node in the tree rooted at 'expr' produces a different value each time it is
+ * evaluated. Coalescing the evaluations of such subexpressions would change query results.
+ */
+bool containsNonDeterministicExpression(const Expression* expr) {
+    if (dynamic_cast<const ExpressionRandom*>(expr) ||
+        dynamic_cast<const ExpressionFunction*>(expr)) {
+        return true;
+    }
+    for (auto&& child : expr->getChildren()) {
+        if (child && containsNonDeterministicExpression(child.get())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Returns true if the tree rooted at 'expr' may be bound to a $let variable at the top of the
+ * overall expression. Constants and bare field paths are excluded as too cheap to be worth a
+ * binding, and subexpressions referencing user-defined variables are excluded because they cannot
+ * be lifted above the $let/$map/$filter scope that binds those variables.
+ */
+bool isHoistable(const Expression* expr) {
+    if (dynamic_cast<const ExpressionConstant*>(expr) ||
+        dynamic_cast<const ExpressionFieldPath*>(expr)) {
+        return false;
+    }
+
+    std::set<Variables::Id> refs;
+    expression::addVariableRefs(expr, &refs);
+    if (std::any_of(refs.begin(), refs.end(), Variables::isUserDefinedVariable)) {
+        return false;
+    }
+
+    return !containsNonDeterministicExpression(expr);
+}
+
+struct CandidateInfo {
+    size_t occurrences = 0;
+    size_t nodeCount = 0;
+};
+
+/**
+ * Records every hoistable subtree of 'expr' in 'candidates', keyed by its serialization so that
+ * structurally identical subtrees collide. Returns the number of nodes in the tree.
+ */
+size_t collectCandidates(const Expression* expr, ValueUnorderedMap<CandidateInfo>& candidates) {
+    size_t nodes = 1;
+    for (auto&& child : expr->getChildren()) {
+        if (child) {
+            nodes += collectCandidates(child.get(), candidates);
+        }
+    }
+
+    if (isHoistable(expr)) {
+        auto& info = candidates[expr->serialize()];
+        ++info.occurrences;
+        info.nodeCount = nodes;
+    }
+    return nodes;
+}
+
+/**
+ * Appends to 'matches' a pointer to every child slot of the tree rooted at 'expr' whose
+ * subexpression serializes to 'key'. Does not descend into matching subtrees; their occurrences of
+ * smaller duplicates are reached through the binding once the match is hoisted.
+ */
+void collectMatches(Expression* expr,
+                    const Value& key,
+                    std::vector<boost::intrusive_ptr<Expression>*>* matches) {
+    for (auto&& child : expr->getChildren()) {
+        if (!child) {
+            continue;
+        }
+        if (ValueComparator::kInstance.evaluate(child->serialize() == key)) {
+            matches->push_back(&child);
+            continue;
+        }
+        collectMatches(child.get(), key, matches);
+    }
+}
+
+}  // namespace
+
+boost::intrusive_ptr<Expression> hoistCommonSubexpressions(ExpressionContext* expCtx,
+                                                           boost::intrusive_ptr<Expression> expr) {
+    if (!expr || countNodes(expr.get()) > kMaxNodesToConsider) {
+        return expr;
+    }
+
+    auto candidateMap = ValueComparator::kInstance.makeUnorderedValueMap<CandidateInfo>();
+    collectCandidates(expr.get(), candidateMap);
+
+    std::vector<std::pair<Value, CandidateInfo>> duplicated;
+    for (auto&& candidate : candidateMap) {
+        if (candidate.second.occurrences > 1) {
+            duplicated.push_back(candidate);
+        }
+    }
+    if (duplicated.empty()) {
+        return expr;
+    }
+
+    // Hoist larger subtrees first. A duplicate contained in a larger duplicate then survives (once)
+    // inside the larger subtree's binding, where a later, smaller key can still pick it up; the
+    // smaller key's $let ends up wrapped around the larger key's, so the reference inside the inner
+    // binding resolves to the outer variable, which is already bound by the time the inner binding
+    // is evaluated. Ties are broken by key to keep the rewrite deterministic.
+    std::sort(duplicated.begin(), duplicated.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.second.nodeCount != rhs.second.nodeCount) {
+            return lhs.second.nodeCount > rhs.second.nodeCount;
+        }
+        return ValueComparator::kInstance.evaluate(lhs.first < rhs.first);
+    });
+
+    size_t varCounter = 0;
+    for (auto&& candidate : duplicated) {
+        // Recompute the occurrences against the current tree; earlier rewrites may have absorbed
+        // some of them into a binding.
+        std::vector<boost::intrusive_ptr<Expression>*> matches;
+        collectMatches(expr.get(), candidate.first, &matches);
+        if (matches.size() < 2) {
+            continue;
+        }
+
+        auto varName = fmt::format("cse{}", varCounter++);
+        auto binding = *matches.front();
+        expr = ExpressionLet::create(
+            expCtx,
+            {{varName, std::move(binding)}},
+            expCtx->variablesParseState,
+            [&varName, &matches, &expr](ExpressionContext* ctx,
+                                        const VariablesParseState& vpsWithLetVars) {
+                for (auto* slot : matches) {
+                    *slot = ExpressionFieldPath::createVarFromString(ctx, varName, vpsWithLetVars);
+                }
+                return expr;
+            });
+    }
+
+    return expr;
+}
+
+}  // namespace mongo::expression_cse
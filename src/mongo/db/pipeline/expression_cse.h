@@ -0,0 +1,65 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include "mongo/db/pipeline/expression.h"
+#include "mongo/db/pipeline/expression_context.h"
+
+namespace mongo::expression_cse {
+
+/**
+ * Rewrites 'expr' so that non-trivial subexpressions which occur more than once are evaluated only
+ * once per input document. Each set of identical subexpressions is bound to a variable of a
+ * generated $let wrapped around 'expr', and the occurrences are replaced with references to that
+ * variable; $let bindings are evaluated once per document, so the binding acts as a memoized
+ * per-document slot. For example
+ *
+ *   {a: {$toUpper: "$x"}, b: {$concat: [{$toUpper: "$x"}, "!"]}}
+ *
+ * becomes
+ *
+ *   {$let: {vars: {cse0: {$toUpper: "$x"}},
+ *           in: {a: "$$cse0", b: {$concat: ["$$cse0", "!"]}}}}
+ *
+ * Only subexpressions that are safe to hoist are considered: constants and bare field paths are
+ * too cheap to be worth a binding, subexpressions referencing user-defined variables cannot be
+ * lifted above the scope that binds them, and non-deterministic subexpressions (e.g. $rand) must
+ * not have their evaluations coalesced.
+ *
+ * Returns the rewritten expression, or 'expr' unchanged if there is nothing to hoist. Intended to
+ * be called after 'expr' has been optimized, so that constant folding has already collapsed
+ * subexpressions that would otherwise appear to be duplicated work.
+ */
+boost::intrusive_ptr<Expression> hoistCommonSubexpressions(ExpressionContext* expCtx,
+                                                           boost::intrusive_ptr<Expression> expr);
+
+}  // namespace mongo::expression_cse
@@ -0,0 +1,154 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/pipeline/expression_cse.h"
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include "mongo/bson/json.h"
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/exec/document_value/document_value_test_util.h"
+#include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/pipeline/expression.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace ExpressionTests {
+namespace {
+
+TEST(ExpressionCSETest, HoistsDuplicateSubexpressionIntoLet) {
+    auto expCtx = ExpressionContextForTest{};
+    auto expression = Expression::parseObject(
+        &expCtx,
+        fromjson(R"({a: {$toUpper: "$x"}, b: {$concat: [{$toUpper: "$x"}, "!"]}})"),
+        expCtx.variablesParseState);
+
+    auto rewritten = expression_cse::hoistCommonSubexpressions(&expCtx, expression);
+
+    auto expected = Expression::parseExpression(
+        &expCtx,
+        fromjson(R"({$let: {vars: {cse0: {$toUpper: "$x"}},
+                            in: {a: "$$cse0", b: {$concat: ["$$cse0", "!"]}}}})"),
+        expCtx.variablesParseState);
+    ASSERT_VALUE_EQ(expected->serialize(), rewritten->serialize());
+
+    auto result = rewritten->evaluate(Document{{"x", "ab"_sd}}, &expCtx.variables);
+    ASSERT_VALUE_EQ(Value(Document{{"a", "AB"_sd}, {"b", "AB!"_sd}}), result);
+}
+
+TEST(ExpressionCSETest, HoistsNestedDuplicatesLargestFirst) {
+    auto expCtx = ExpressionContextForTest{};
+    auto expression = Expression::parseObject(&expCtx,
+                                              fromjson(R"({a: {$concat: [{$toUpper: "$x"}, "-"]},
+                     b: {$concat: [{$toUpper: "$x"}, "-"]},
+                     c: {$toUpper: "$x"}})"),
+                                              expCtx.variablesParseState);
+
+    auto rewritten = expression_cse::hoistCommonSubexpressions(&expCtx, expression);
+
+    // The larger duplicate is bound first, so its $let ends up innermost and its binding refers to
+    // the variable bound by the outer $let.
+    auto expected = Expression::parseExpression(
+        &expCtx,
+        fromjson(R"({$let: {vars: {cse1: {$toUpper: "$x"}},
+                            in: {$let: {vars: {cse0: {$concat: ["$$cse1", "-"]}},
+                                        in: {a: "$$cse0", b: "$$cse0", c: "$$cse1"}}}}})"),
+        expCtx.variablesParseState);
+    ASSERT_VALUE_EQ(expected->serialize(), rewritten->serialize());
+
+    auto result = rewritten->evaluate(Document{{"x", "ab"_sd}}, &expCtx.variables);
+    ASSERT_VALUE_EQ(Value(Document{{"a", "AB-"_sd}, {"b", "AB-"_sd}, {"c", "AB"_sd}}), result);
+}
+
+TEST(ExpressionCSETest, LeavesUniqueSubexpressionsAlone) {
+    auto expCtx = ExpressionContextForTest{};
+    auto expression =
+        Expression::parseObject(&expCtx,
+                                fromjson(R"({a: {$toUpper: "$x"}, b: {$toLower: "$x"}})"),
+                                expCtx.variablesParseState);
+
+    auto rewritten = expression_cse::hoistCommonSubexpressions(&expCtx, expression);
+    ASSERT_VALUE_EQ(expression->serialize(), rewritten->serialize());
+}
+
+TEST(ExpressionCSETest, DoesNotHoistDuplicatedConstantsOrFieldPaths) {
+    auto expCtx = ExpressionContextForTest{};
+    auto expression = Expression::parseObject(
+        &expCtx, fromjson(R"({a: "$x", b: "$x", c: 42, d: 42})"), expCtx.variablesParseState);
+
+    auto rewritten = expression_cse::hoistCommonSubexpressions(&expCtx, expression);
+    ASSERT_VALUE_EQ(expression->serialize(), rewritten->serialize());
+}
+
+TEST(ExpressionCSETest, DoesNotHoistSubexpressionsReferencingUserVariables) {
+    auto expCtx = ExpressionContextForTest{};
+    // The duplicated $add refers to a $let-bound variable, so it cannot be lifted above the $let
+    // that binds it.
+    auto expression = Expression::parseObject(
+        &expCtx,
+        fromjson(R"({a: {$let: {vars: {v: "$x"}, in: {$add: ["$$v", 1]}}},
+                     b: {$let: {vars: {v: "$x"}, in: {$add: ["$$v", 1]}}}})"),
+        expCtx.variablesParseState);
+
+    auto rewritten = expression_cse::hoistCommonSubexpressions(&expCtx, expression);
+    ASSERT_VALUE_EQ(expression->serialize(), rewritten->serialize());
+}
+
+TEST(ExpressionCSETest, DoesNotHoistNonDeterministicSubexpressions) {
+    auto expCtx = ExpressionContextForTest{};
+    auto expression =
+        Expression::parseObject(&expCtx,
+                                fromjson(R"({a: {$rand: {}}, b: {$rand: {}}})"),
+                                expCtx.variablesParseState);
+
+    auto rewritten = expression_cse::hoistCommonSubexpressions(&expCtx, expression);
+    ASSERT_VALUE_EQ(expression->serialize(), rewritten->serialize());
+}
+
+TEST(ExpressionCSETest, SystemVariableReferencesAreHoistable) {
+    auto expCtx = ExpressionContextForTest{};
+    auto expression = Expression::parseObject(
+        &expCtx,
+        fromjson(R"({a: {$add: ["$x", {$hour: "$$NOW"}]}, b: {$add: ["$x", {$hour: "$$NOW"}]}})"),
+        expCtx.variablesParseState);
+
+    auto rewritten = expression_cse::hoistCommonSubexpressions(&expCtx, expression);
+
+    auto expected = Expression::parseExpression(
+        &expCtx,
+        fromjson(R"({$let: {vars: {cse0: {$add: ["$x", {$hour: "$$NOW"}]}},
+                            in: {a: "$$cse0", b: "$$cse0"}}})"),
+        expCtx.variablesParseState);
+    ASSERT_VALUE_EQ(expected->serialize(), rewritten->serialize());
+}
+
+}  // namespace
+}  // namespace ExpressionTests
+}  // namespace mongo
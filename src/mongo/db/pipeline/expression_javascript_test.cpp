@@ -28,6 +28,7 @@
  */
 
 #include <memory>
+#include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
@@ -43,6 +44,7 @@
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/pipeline/expression_function.h"
 #include "mongo/db/pipeline/expression_js_emit.h"
+#include "mongo/db/pipeline/javascript_execution.h"
 #include "mongo/db/pipeline/process_interface/standalone_process_interface.h"
 #include "mongo/db/pipeline/variables.h"
 #include "mongo/db/query/query_knobs_gen.h"
@@ -199,6 +201,31 @@ TEST_F(MapReduceFixture, ExpressionFunctionFailsIfLangIsNotSpecified) {
                        31418);
 }
 
+TEST_F(MapReduceFixture, JsExecutionCallFunctionBatchedReturnsOneResultPerTuple) {
+    auto jsExec = getExpCtx()->getJsExecWithScope();
+
+    std::vector<Value> argsBatch{Value(BSON_ARRAY(1 << 2)),
+                                 Value(BSON_ARRAY(3 << 4)),
+                                 Value(BSON_ARRAY(5))};
+    auto results = jsExec->callFunctionBatched(
+        "function(first, second) { return second === undefined ? first : first + second; }",
+        argsBatch);
+
+    ASSERT_EQUALS(results.size(), 3u);
+    ASSERT_VALUE_EQ(results[0], Value(3));
+    ASSERT_VALUE_EQ(results[1], Value(7));
+    ASSERT_VALUE_EQ(results[2], Value(5));
+}
+
+TEST_F(MapReduceFixture, JsExecutionCallFunctionBatchedFailsIfTupleIsNotArray) {
+    auto jsExec = getExpCtx()->getJsExecWithScope();
+
+    std::vector<Value> argsBatch{Value(1)};
+    ASSERT_THROWS_CODE(jsExec->callFunctionBatched("function(first) { return first; }", argsBatch),
+                       AssertionException,
+                       9876520);
+}
+
 TEST_F(MapReduceFixture, ExpressionInternalJsEmitProducesExpectedResult) {
     auto bsonExpr = BSON("expr" << BSON("this"
                                         << "$$ROOT"
@@ -28,19 +28,58 @@
  */
 
 #include <utility>
+#include <vector>
 
 #include <boost/optional/optional.hpp>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/bsontypes.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/auth/user_name.h"
 #include "mongo/db/pipeline/javascript_execution.h"
+#include "mongo/db/tenant_id.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/database_name_util.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/serialization_context.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
 
 namespace {
 const auto getExec = OperationContext::declareDecoration<std::unique_ptr<JsExecution>>();
+
+/**
+ * Builds a key capturing everything that feeds the setup of a JsExecution's scope, so that a scope
+ * retired by a completed operation is reused only when the next operation's environment is
+ * identical. Must include the authenticated users (mirroring the pooled scope names used for
+ * $where) so that JS globals never leak across users.
+ */
+std::string makeScopeReuseKey(OperationContext* opCtx,
+                              const BSONObj& scopeVars,
+                              const DatabaseName& database,
+                              bool loadStoredProcedures,
+                              boost::optional<int> jsHeapLimitMB) {
+    StringBuilder sb;
+
+    auto as = AuthorizationSession::get(opCtx->getClient());
+    if (auto name = as->getAuthenticatedUserName()) {
+        // Using a NUL byte which isn't valid in usernames to separate them.
+        if (const auto& tenant = name->tenantId()) {
+            sb << '\0' << tenant->toString();
+        }
+        sb << '\0' << name->getUnambiguousName();
+    }
+
+    sb << '\0' << DatabaseNameUtil::serialize(database, SerializationContext::stateDefault());
+    sb << '\0' << (loadStoredProcedures ? '1' : '0');
+    sb << '\0' << jsHeapLimitMB.value_or(-1);
+    sb << '\0';
+    sb.append(StringData(scopeVars.objdata(), scopeVars.objsize()));
+
+    return sb.str();
+}
 }  // namespace
 
 JsExecution* JsExecution::get(OperationContext* opCtx,
@@ -56,7 +95,11 @@ JsExecution* JsExecution::get(OperationContext* opCtx,
 
     // There is no cached JsExecution object, so create and cache one now.
     auto& exec = getExec(opCtx);
-    exec = std::make_unique<JsExecution>(opCtx, scope, jsHeapLimitMB);
+    exec = std::make_unique<JsExecution>(
+        opCtx,
+        scope,
+        jsHeapLimitMB,
+        makeScopeReuseKey(opCtx, scope, database, loadStoredProcedures, jsHeapLimitMB));
     exec->getScope()->setLocalDB(database);
     if (loadStoredProcedures) {
         exec->getScope()->loadStored(opCtx, true);
@@ -91,6 +134,70 @@ Value JsExecution::callFunction(ScriptingFunction func,
     return Value(returnValue.done().firstElement());
 }
 
+std::vector<Value> JsExecution::callFunctionBatched(const std::string& funcSource,
+                                                    const std::vector<Value>& argsBatch) {
+    // Expose the user function, then drive it from a loop inside the JS engine, the same technique
+    // $accumulator uses to process its pending calls.
+    _scope->setFunction("__batchedFn", funcSource.c_str());
+    ScriptingFunction driver = _scope->createFunction(
+        "function(batch) {"
+        "  const length = batch.length;"
+        "  const results = [];"
+        "  for (let i = 0; i < length; ++i) {"
+        "    const args = batch[i];"
+        // Try to avoid doing an expensive argument spread by handling a few common arities as
+        // special cases.
+        "    switch (args.length) {"
+        "      case 1: results.push(__batchedFn(args[0])); break;"
+        "      case 2: results.push(__batchedFn(args[0], args[1])); break;"
+        "      case 3: results.push(__batchedFn(args[0], args[1], args[2])); break;"
+        "      default: results.push(__batchedFn(...args)); break;"
+        "    }"
+        "  }"
+        "  return results;"
+        "}");
+
+    std::vector<Value> results;
+    results.reserve(argsBatch.size());
+    for (auto it = argsBatch.begin(), end = argsBatch.end(); it != end;) {
+        // Take as many argument tuples as will fit in one BSON array.
+        BSONArrayBuilder params;
+        BSONArrayBuilder batch = params.subarrayStart();
+        const auto chunkBegin = it;
+        for (; it != end; ++it) {
+            uassert(9876520,
+                    str::stream() << "Each batched argument tuple must be an array, found: "
+                                  << it->getType(),
+                    it->getType() == BSONType::Array);
+            // The JS call will fail if the arguments object is larger than BSONObjMaxInternalSize,
+            // which is a much greater limit than BSONObjMaxUserSize. So it should be safe to go
+            // slightly over the BSONObjMaxUserSize.
+            if (params.len() + it->getApproximateSize() > BSONObjMaxUserSize)
+                break;
+            it->addToBsonArray(&batch);
+        }
+        batch.done();
+
+        // For the outer loop to make progress, the inner loop needs to append at least one
+        // argument tuple to the batch.
+        uassert(9876521,
+                str::stream() << "Batched function arguments exceed max BSON size: "
+                              << params.len() + it->getApproximateSize(),
+                it != chunkBegin);
+        const size_t chunkSize = it - chunkBegin;
+
+        Value chunkResults = callFunction(driver, params.arr(), {});
+        uassert(9876522,
+                "The batched function driver must return one result per argument tuple",
+                chunkResults.getType() == BSONType::Array &&
+                    chunkResults.getArrayLength() == chunkSize);
+        for (auto&& result : chunkResults.getArray()) {
+            results.push_back(result);
+        }
+    }
+    return results;
+}
+
 void JsExecution::callFunctionWithoutReturn(ScriptingFunction func,
                                             const BSONObj& params,
                                             const BSONObj& thisObj) {
@@ -33,6 +33,7 @@
 #include <boost/optional/optional.hpp>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
@@ -74,12 +75,24 @@ public:
     static JsExecution* getCached(OperationContext* opCtx, bool loadStoredProcedures);
 
     /**
-     * Construct with a thread-local scope and initialize with the given scope variables.
+     * Construct with a thread-local scope and initialize with the given scope variables. If
+     * 'scopeReuseKey' is non-empty, a scope retired by a previous JsExecution on this thread under
+     * the same key may be reused instead of constructing a new one, preserving its compiled
+     * function cache; the key must capture everything that feeds scope setup (see
+     * JsExecution::get()).
      */
     JsExecution(OperationContext* opCtx,
                 const BSONObj& scopeVars,
-                boost::optional<int> jsHeapLimitMB = boost::none)
-        : _scope(getGlobalScriptEngine()->newScopeForCurrentThread(jsHeapLimitMB)) {
+                boost::optional<int> jsHeapLimitMB = boost::none,
+                std::string scopeReuseKey = {})
+        : _scopeReuseKey(std::move(scopeReuseKey)) {
+        auto* scriptEngine = getGlobalScriptEngine();
+        if (!_scopeReuseKey.empty()) {
+            _scope = scriptEngine->tryReuseScopeForCurrentThread(_scopeReuseKey);
+        }
+        if (!_scope) {
+            _scope.reset(scriptEngine->newScopeForCurrentThread(jsHeapLimitMB));
+        }
         _scopeVars = scopeVars.getOwned();
         _scope->init(&_scopeVars);
         _fnCallTimeoutMillis = internalQueryJavaScriptFnTimeoutMillis.load();
@@ -88,6 +101,9 @@ public:
 
     ~JsExecution() {
         _scope->unregisterOperation();
+        if (auto* scriptEngine = getGlobalScriptEngine()) {
+            scriptEngine->recycleScopeForCurrentThread(_scopeReuseKey, std::move(_scope));
+        }
     };
 
     /**
@@ -108,6 +124,18 @@ public:
      */
     Value callFunction(ScriptingFunction func, const BSONObj& params, const BSONObj& thisObj);
 
+    /**
+     * Invokes the javascript function given by 'funcSource' once per argument tuple in
+     * 'argsBatch', where each tuple is an array Value holding that invocation's arguments.
+     * Returns one result per tuple, in order.
+     *
+     * The batch is driven by a wrapper function that loops inside the JS engine, so each chunk of
+     * tuples (split to respect the max BSON size) costs a single crossing of the C++/JS boundary
+     * rather than one per invocation.
+     */
+    std::vector<Value> callFunctionBatched(const std::string& funcSource,
+                                           const std::vector<Value>& argsBatch);
+
     /**
      * Creates a function in the owned Scope* if it hasn't been created yet.
      */
@@ -128,6 +156,7 @@ public:
     }
 
 private:
+    std::string _scopeReuseKey;
     BSONObj _scopeVars;
     std::unique_ptr<Scope> _scope;
     bool _storedProceduresLoaded = false;
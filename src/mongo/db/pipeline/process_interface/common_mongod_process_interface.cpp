@@ -36,6 +36,7 @@
 #include <boost/smart_ptr.hpp>
 #include <cstddef>
 #include <limits>
+#include <numeric>
 #include <vector>
 
 #include <boost/none.hpp>
@@ -261,7 +262,7 @@ std::vector<Document> CommonMongodProcessInterface::getIndexStats(OperationConte
         doc["name"] = Value(indexName);
         doc["key"] = Value(stats->indexKey);
         doc["host"] = Value(host);
-        doc["accesses"]["ops"] = Value(stats->accesses.loadRelaxed());
+        doc["accesses"]["ops"] = Value(stats->accesses.get());
         doc["accesses"]["since"] = Value(stats->trackerStartTime);
 
         if (addShardName)
@@ -1063,4 +1064,34 @@ boost::optional<Document> CommonMongodProcessInterface::lookupSingleDocumentLoca
     return Document(document).getOwned();
 }
 
+std::vector<boost::optional<Document>> CommonMongodProcessInterface::lookupDocumentsLocally(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    const NamespaceString& nss,
+    const std::vector<Document>& documentKeys) {
+    std::vector<BSONObj> keys;
+    keys.reserve(documentKeys.size());
+    for (const auto& documentKey : documentKeys) {
+        keys.push_back(documentKey.toBson());
+    }
+
+    // Perform the point lookups in ascending key order: for clustered collections, such as the
+    // change stream pre-images collection, keys that are adjacent in sort order live on adjacent
+    // leaf pages, so a sorted batch touches each page once instead of revisiting them at random.
+    std::vector<size_t> order(documentKeys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return keys[lhs].woCompare(keys[rhs]) < 0;
+    });
+
+    std::vector<boost::optional<Document>> results(documentKeys.size());
+    AutoGetCollectionForReadMaybeLockFree autoColl(expCtx->getOperationContext(), nss);
+    for (auto idx : order) {
+        BSONObj document;
+        if (Helpers::findById(expCtx->getOperationContext(), nss, keys[idx], document)) {
+            results[idx] = Document(document).getOwned();
+        }
+    }
+    return results;
+}
+
 }  // namespace mongo
@@ -188,6 +188,11 @@ public:
         const NamespaceString& nss,
         const Document& documentKey) final;
 
+    std::vector<boost::optional<Document>> lookupDocumentsLocally(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        const NamespaceString& nss,
+        const std::vector<Document>& documentKeys) final;
+
 protected:
     BSONObj getCollectionOptionsLocally(OperationContext* opCtx, const NamespaceString& nss);
 
@@ -92,6 +92,15 @@ std::vector<BSONObj> CommonProcessInterface::getCurrentOps(
     auto reportCurrentOpForService = [&](Service* service) {
         for (Service::LockedClientsCursor cursor(service); ClientLock lc = cursor.next();) {
             Client* client = &*lc;
+
+            // Filter out idle connections first; it is the cheapest check and excludes most
+            // clients on connection-heavy nodes, keeping the time this client's lock is held to
+            // a minimum.
+            if (connMode == CurrentOpConnectionsMode::kExcludeIdle &&
+                !client->hasAnyActiveCurrentOp()) {
+                continue;
+            }
+
             if (AuthorizationManager::get(opCtx->getService())->isAuthEnabled()) {
                 // If auth is disabled, ignore the allUsers parameter.
                 if (userMode == CurrentOpUserMode::kExcludeOthers &&
@@ -112,12 +121,6 @@ std::vector<BSONObj> CommonProcessInterface::getCurrentOps(
                 }
             }
 
-            // Ignore inactive connections unless 'idleConnections' is true.
-            if (connMode == CurrentOpConnectionsMode::kExcludeIdle &&
-                !client->hasAnyActiveCurrentOp()) {
-                continue;
-            }
-
             // Here, we first convert the operation managed by the client object into its BSON
             // representation that will be returned to the caller. Although its still possible that
             // this operation/client is filtered out based on the configured mode of this call,
@@ -566,6 +566,25 @@ public:
         const NamespaceString& nss,
         const Document& documentKey) = 0;
 
+    /**
+     * Batched form of 'lookupSingleDocumentLocally'. Returns one entry per element of
+     * 'documentKeys', in the same order, with boost::none for keys that have no matching document.
+     * The default implementation performs the point lookups one at a time; mongod overrides it to
+     * fetch the whole batch in ascending key order under a single collection acquisition. It is
+     * illegal to call this method on nodes other than mongod.
+     */
+    virtual std::vector<boost::optional<Document>> lookupDocumentsLocally(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        const NamespaceString& nss,
+        const std::vector<Document>& documentKeys) {
+        std::vector<boost::optional<Document>> results;
+        results.reserve(documentKeys.size());
+        for (const auto& documentKey : documentKeys) {
+            results.push_back(lookupSingleDocumentLocally(expCtx, nss, documentKey));
+        }
+        return results;
+    }
+
     /**
      * Returns a vector of all idle (non-pinned) local cursors.
      */
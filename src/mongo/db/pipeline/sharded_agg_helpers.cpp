@@ -68,6 +68,7 @@
 #include "mongo/db/pipeline/document_source_change_stream.h"
 #include "mongo/db/pipeline/document_source_change_stream_gen.h"
 #include "mongo/db/pipeline/document_source_group.h"
+#include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_set_variable_from_subpipeline.h"
 #include "mongo/db/pipeline/lite_parsed_pipeline.h"
@@ -839,6 +840,145 @@ BSONObj createCommandForTargetedShards(const boost::intrusive_ptr<ExpressionCont
                                  shardCommand);
 }
 
+/**
+ * Appends to 'bob' the predicates of 'matchQuery' which constrain a shard key field of the change
+ * stream's "documentKey", rewritten to address the shard key field directly. Only conjuncts whose
+ * operators cannot match a missing field ($eq, $gt, $gte, $lt, $lte and $in over scalar values) are
+ * retained, so that any event passing the original $match is guaranteed to carry a documentKey
+ * within the extracted bounds. Conjuncts which cannot be expressed this way are simply omitted,
+ * which can only widen the resulting set of targeted shards.
+ */
+void extractShardKeyPredicates(const BSONObj& matchQuery,
+                               const OrderedPathSet& shardKeyPaths,
+                               BSONObjBuilder* bob) {
+    static constexpr StringData kDocumentKeyPrefix = "documentKey."_sd;
+
+    auto isPointValue = [](const BSONElement& val) {
+        switch (val.type()) {
+            case BSONType::Array:
+            case BSONType::Object:
+            case BSONType::Undefined:
+            case BSONType::jstNULL:
+            case BSONType::RegEx:
+                return false;
+            default:
+                return true;
+        }
+    };
+
+    for (auto&& elem : matchQuery) {
+        const auto fieldName = elem.fieldNameStringData();
+        if (fieldName == "$and" && elem.type() == BSONType::Array) {
+            for (auto&& clause : elem.Array()) {
+                if (clause.type() == BSONType::Object) {
+                    extractShardKeyPredicates(clause.Obj(), shardKeyPaths, bob);
+                }
+            }
+            continue;
+        }
+        if (!fieldName.starts_with(kDocumentKeyPrefix)) {
+            continue;
+        }
+        const auto shardKeyPath = fieldName.substr(kDocumentKeyPrefix.size());
+        if (!shardKeyPaths.count(shardKeyPath.toString())) {
+            continue;
+        }
+
+        bool targetable = false;
+        if (elem.type() == BSONType::Object &&
+            elem.Obj().firstElementFieldNameStringData().starts_with('$')) {
+            // An operator object; admissible only if every operator keeps the predicate a
+            // missing-excluding point or range constraint.
+            targetable = true;
+            for (auto&& op : elem.Obj()) {
+                const auto opName = op.fieldNameStringData();
+                if (opName == "$in") {
+                    if (op.type() != BSONType::Array) {
+                        targetable = false;
+                        continue;
+                    }
+                    const auto inValues = op.Array();
+                    targetable = targetable &&
+                        std::all_of(inValues.begin(), inValues.end(), isPointValue);
+                } else if (opName == "$eq" || opName == "$gt" || opName == "$gte" ||
+                           opName == "$lt" || opName == "$lte") {
+                    targetable = targetable && isPointValue(op);
+                } else {
+                    targetable = false;
+                }
+            }
+        } else {
+            // Implicit equality; objects without a leading '$' are literal values.
+            targetable = isPointValue(elem) || elem.type() == BSONType::Object;
+        }
+
+        if (targetable) {
+            bob->appendAs(elem, shardKeyPath);
+        }
+    }
+}
+
+/**
+ * If 'internalQueryChangeStreamEnableShardKeyPruning' is enabled, removes from 'shardIds' the
+ * shards which do not currently own any chunk that could produce events matching the change
+ * stream's user $match, as determined by the shard key predicates it places on "documentKey".
+ * Events without a documentKey (e.g. DDL events) cannot satisfy such predicates, so pruning never
+ * changes the visible event sequence under the stable-placement constraint documented on the knob.
+ */
+void pruneChangeStreamShardsOnShardKey(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                                       const Pipeline* pipeline,
+                                       const boost::optional<CollectionRoutingInfo>& cri,
+                                       const BSONObj& collation,
+                                       std::set<ShardId>* shardIds) {
+    if (!internalQueryChangeStreamEnableShardKeyPruning.load()) {
+        return;
+    }
+    if (!cri || !cri->cm.isSharded() || shardIds->size() <= 1) {
+        return;
+    }
+
+    // Find the $match following the internal change stream stages, if any. User stages which may
+    // precede it after optimization never swap ahead of the internal stages, so scanning stops at
+    // the first stage that is neither internal nor the $match we are looking for.
+    const DocumentSourceMatch* matchStage = nullptr;
+    for (const auto& source : pipeline->getSources()) {
+        if (auto match = dynamic_cast<const DocumentSourceMatch*>(source.get());
+            match && !dynamic_cast<const DocumentSourceInternalChangeStreamStage*>(source.get())) {
+            matchStage = match;
+            break;
+        }
+        if (!dynamic_cast<const DocumentSourceInternalChangeStreamStage*>(source.get())) {
+            break;
+        }
+    }
+    if (!matchStage) {
+        return;
+    }
+
+    BSONObjBuilder shardKeyQueryBob;
+    extractShardKeyPredicates(matchStage->getQuery(),
+                              getShardKeyPathsSet(cri->cm.getShardKeyPattern()),
+                              &shardKeyQueryBob);
+    const auto shardKeyQuery = shardKeyQueryBob.obj();
+    if (shardKeyQuery.isEmpty()) {
+        return;
+    }
+
+    auto owningShards = getTargetedShardsForQuery(expCtx, cri->cm, shardKeyQuery, collation);
+    if (owningShards.empty()) {
+        return;
+    }
+
+    for (auto it = shardIds->begin(); it != shardIds->end();) {
+        it = owningShards.count(*it) ? std::next(it) : shardIds->erase(it);
+    }
+    LOGV2_DEBUG(9876528,
+                3,
+                "Pruned change stream shard targeting using shard key predicates",
+                "shardKeyQuery"_attr = redact(shardKeyQuery),
+                "targetedShardCount"_attr = shardIds->size());
+}
+
 TargetingResults targetPipeline(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                 const Pipeline* pipeline,
                                 PipelineDataSource pipelineDataSource,
@@ -924,6 +1064,11 @@ TargetingResults targetPipeline(const boost::intrusive_ptr<ExpressionContext>& e
                          ->anyShardRemovedSince(expCtx->getOperationContext(),
                                                 changeStreamOpeningTime));
         }
+
+        // If the user's $match constrains the shard key, optionally avoid opening cursors on the
+        // shards whose chunks cannot produce matching events.
+        pruneChangeStreamShardsOnShardKey(
+            expCtx, pipeline, cri, shardTargetingCollation, &shardIds);
     }
 
     return {std::move(shardQuery),
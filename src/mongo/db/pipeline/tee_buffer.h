@@ -69,7 +69,10 @@ public:
      */
     void dispose(size_t consumerId) {
         _consumers[consumerId].stillInUse = false;
-        _consumers[consumerId].nLeftToReturn = 0;
+        if (_consumers[consumerId].nLeftToReturn > 0) {
+            _consumers[consumerId].nLeftToReturn = 0;
+            --_nConsumersStillProcessingThisBatch;
+        }
         if (std::none_of(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
                 return info.stillInUse;
             })) {
@@ -107,5 +110,9 @@ private:
         int nLeftToReturn = 0;
     };
     std::vector<ConsumerInfo> _consumers;
+
+    // Number of in-use consumers that have not yet consumed the whole current batch. Kept up to
+    // date so that getNext() does not have to scan '_consumers' for every document returned.
+    size_t _nConsumersStillProcessingThisBatch = 0;
 };
 }  // namespace mongo
@@ -71,6 +71,7 @@
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_operation_metrics.h"
+#include "mongo/db/pipeline/document_source_operation_samples.h"
 #include "mongo/db/pipeline/document_source_out.h"
 #include "mongo/db/pipeline/document_source_plan_cache_stats.h"
 #include "mongo/db/pipeline/document_source_query_stats.h"
@@ -174,6 +175,7 @@ void registerMongodVisitor(ServiceContext* service) {
                        DocumentSourceMatch,
                        DocumentSourceMerge,
                        DocumentSourceOperationMetrics,
+                       DocumentSourceOperationSamples,
                        DocumentSourceOut,
                        DocumentSourcePlanCacheStats,
                        DocumentSourceQueue,
@@ -30,11 +30,116 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 #include "mongo/db/pipeline/percentile_algo_continuous.h"
 #include "mongo/db/pipeline/window_function/window_function.h"
 
 namespace mongo {
 
+/**
+ * A multiset of doubles supporting insertion, removal, and selection by rank in O(sqrt(n)) time.
+ *
+ * Values are kept in ascending order across a sequence of sorted blocks. Insertion and removal
+ * binary-search for the owning block and shift elements within that one block only; selection by
+ * rank walks the block sizes and then indexes into the target block. A single sorted array (e.g.
+ * boost::container::flat_multiset) must shift O(n) elements per insert or erase, which makes
+ * sliding a large window over the input quadratic in the window size.
+ */
+class OrderStatisticsMultiset {
+public:
+    size_t size() const {
+        return _size;
+    }
+
+    bool empty() const {
+        return _size == 0;
+    }
+
+    void clear() {
+        _blocks.clear();
+        _size = 0;
+    }
+
+    void insert(double value) {
+        auto blockIt = _findBlock(value);
+        if (blockIt == _blocks.end()) {
+            // 'value' is greater than every stored value; it belongs in the last block.
+            if (_blocks.empty()) {
+                _blocks.emplace_back();
+            }
+            blockIt = std::prev(_blocks.end());
+        }
+        blockIt->insert(std::upper_bound(blockIt->begin(), blockIt->end(), value), value);
+        ++_size;
+        if (blockIt->size() > kMaxBlockSize) {
+            _splitBlock(blockIt);
+        }
+    }
+
+    /**
+     * Removes one occurrence of 'value'. Returns false if the value is not present.
+     */
+    bool erase(double value) {
+        auto blockIt = _findBlock(value);
+        if (blockIt == _blocks.end()) {
+            return false;
+        }
+        auto valueIt = std::lower_bound(blockIt->begin(), blockIt->end(), value);
+        if (valueIt == blockIt->end() || *valueIt != value) {
+            return false;
+        }
+        blockIt->erase(valueIt);
+        --_size;
+        if (blockIt->empty()) {
+            _blocks.erase(blockIt);
+        }
+        return true;
+    }
+
+    /**
+     * Returns the value at 0-based 'rank' in ascending order. 'rank' must be less than size().
+     */
+    double selectAtRank(size_t rank) const {
+        tassert(9876523, "Rank out of bounds of OrderStatisticsMultiset", rank < _size);
+        auto blockIt = _blocks.begin();
+        while (rank >= blockIt->size()) {
+            rank -= blockIt->size();
+            ++blockIt;
+        }
+        return (*blockIt)[rank];
+    }
+
+private:
+    // Bounds the per-operation shifting cost within a block. Blocks shrink through erasure and are
+    // dropped once empty; they are never merged, which keeps removal cheap and is good enough for
+    // the sliding-window usage where insertions and removals are balanced.
+    static constexpr size_t kMaxBlockSize = 2048;
+
+    using Blocks = std::vector<std::vector<double>>;
+
+    // Returns the first block whose greatest element is >= 'value', i.e. the only block that can
+    // contain 'value'. Returns end() if 'value' is greater than every stored value.
+    Blocks::iterator _findBlock(double value) {
+        return std::lower_bound(
+            _blocks.begin(), _blocks.end(), value, [](const std::vector<double>& block, double v) {
+                return block.back() < v;
+            });
+    }
+
+    void _splitBlock(Blocks::iterator blockIt) {
+        const size_t half = blockIt->size() / 2;
+        std::vector<double> upper(blockIt->begin() + half, blockIt->end());
+        blockIt->resize(half);
+        _blocks.insert(std::next(blockIt), std::move(upper));
+    }
+
+    Blocks _blocks;
+    size_t _size = 0;
+};
+
 /**
  * Shared base class for implementing $percentile and $median window functions.
  */
@@ -55,12 +160,9 @@ public:
             return;
         }
 
-        auto iter = _values.find(value.coerceToDouble());
-        tassert(7455904,
-                "Cannot remove a value not tracked by WindowFunctionPercentile",
-                iter != _values.end());
+        bool removed = _values.erase(value.coerceToDouble());
+        tassert(7455904, "Cannot remove a value not tracked by WindowFunctionPercentile", removed);
         _memUsageTracker.add(-static_cast<int64_t>(sizeof(double)));
-        _values.erase(iter);
     }
 
     void reset() override {
@@ -71,30 +173,16 @@ public:
 protected:
     explicit WindowFunctionPercentileCommon(ExpressionContext* const expCtx,
                                             PercentileMethodEnum method)
-        : WindowFunctionState(expCtx),
-          _values(boost::container::flat_multiset<double>()),
-          _method(method) {}
+        : WindowFunctionState(expCtx), _method(method) {}
 
     Value computePercentile(double p) const {
-        // Calculate the rank.
-        const double n = _values.size();
-
-        // boost::container::flat_multiset stores the values in ascending order, so we don't need to
-        // sort them before finding the value at index 'rank'.
-        // boost::container::flat_multiset has random-access iterators, so std::advance has an
-        // expected runtime of O(1).
-        const double rank = DiscretePercentile::computeTrueRank(n, p);
-        auto it = _values.begin();
-        std::advance(it, rank);
-        return Value(*it);
+        // Calculate the rank, then select the value holding it.
+        const int rank = DiscretePercentile::computeTrueRank(static_cast<int>(_values.size()), p);
+        return Value(_values.selectAtRank(static_cast<size_t>(rank)));
     }
 
     // Holds all the values in the window in ascending order.
-    // A boost::container::flat_multiset stores elements in a contiguous array, so iterating through
-    // the set is faster than iterating through a std::multiset which stores its elements typically
-    // as a binary search tree. Thus, using a boost::container::flat_multiset significantly improved
-    // performance.
-    boost::container::flat_multiset<double> _values;
+    OrderStatisticsMultiset _values;
     PercentileMethodEnum _method;
 };
 
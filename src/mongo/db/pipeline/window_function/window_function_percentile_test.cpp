@@ -0,0 +1,163 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include "mongo/bson/bsontypes.h"
+#include "mongo/db/exec/document_value/document_value_test_util.h"
+#include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/pipeline/accumulator_percentile_enum_gen.h"
+#include "mongo/db/pipeline/aggregation_context_fixture.h"
+#include "mongo/db/pipeline/percentile_algo_discrete.h"
+#include "mongo/db/pipeline/window_function/window_function_percentile.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/intrusive_counter.h"
+
+namespace mongo {
+namespace {
+
+class WindowFunctionMedianTest : public AggregationContextFixture {
+public:
+    WindowFunctionMedianTest()
+        : expCtx(getExpCtx()), median(expCtx.get(), PercentileMethodEnum::kDiscrete) {}
+
+    boost::intrusive_ptr<ExpressionContext> expCtx;
+    WindowFunctionMedian median;
+};
+
+TEST_F(WindowFunctionMedianTest, EmptyWindowReturnsNull) {
+    ASSERT_VALUE_EQ(median.getValue(), Value{BSONNULL});
+
+    median.add(Value{1});
+    median.remove(Value{1});
+    ASSERT_VALUE_EQ(median.getValue(), Value{BSONNULL});
+}
+
+TEST_F(WindowFunctionMedianTest, IgnoresNonNumericValues) {
+    median.add(Value{std::string("str")});
+    ASSERT_VALUE_EQ(median.getValue(), Value{BSONNULL});
+
+    median.add(Value{3});
+    median.add(Value{std::string("str")});
+    median.remove(Value{std::string("str")});
+    ASSERT_VALUE_EQ(median.getValue(), Value{3.0});
+}
+
+TEST_F(WindowFunctionMedianTest, SlidingWindow) {
+    median.add(Value{1});
+    median.add(Value{2});
+    median.add(Value{3});
+    ASSERT_VALUE_EQ(median.getValue(), Value{2.0});
+
+    // Slide the window: remove the oldest value, add a new one.
+    median.remove(Value{1});
+    median.add(Value{10});
+    ASSERT_VALUE_EQ(median.getValue(), Value{3.0});
+
+    median.remove(Value{2});
+    median.add(Value{20});
+    ASSERT_VALUE_EQ(median.getValue(), Value{10.0});
+}
+
+class WindowFunctionPercentileTest : public AggregationContextFixture {
+public:
+    WindowFunctionPercentileTest() : expCtx(getExpCtx()) {}
+
+    boost::intrusive_ptr<ExpressionContext> expCtx;
+};
+
+TEST_F(WindowFunctionPercentileTest, EmptyWindowReturnsNullPerPercentile) {
+    WindowFunctionPercentile percentile(expCtx.get(), PercentileMethodEnum::kDiscrete, {0.5, 0.9});
+    ASSERT_VALUE_EQ(percentile.getValue(),
+                    Value(std::vector<Value>{Value{BSONNULL}, Value{BSONNULL}}));
+}
+
+TEST_F(WindowFunctionPercentileTest, ComputesMultiplePercentiles) {
+    WindowFunctionPercentile percentile(
+        expCtx.get(), PercentileMethodEnum::kDiscrete, {0.1, 0.5, 0.99});
+    for (int i = 1; i <= 100; i++) {
+        percentile.add(Value{i});
+    }
+    ASSERT_VALUE_EQ(percentile.getValue(),
+                    Value(std::vector<Value>{Value{10.0}, Value{50.0}, Value{99.0}}));
+}
+
+TEST_F(WindowFunctionPercentileTest, DuplicatesAreRemovedIndividually) {
+    WindowFunctionPercentile percentile(expCtx.get(), PercentileMethodEnum::kDiscrete, {1.0});
+    percentile.add(Value{5});
+    percentile.add(Value{5});
+    percentile.add(Value{1});
+
+    percentile.remove(Value{5});
+    ASSERT_VALUE_EQ(percentile.getValue(), Value(std::vector<Value>{Value{5.0}}));
+
+    percentile.remove(Value{5});
+    ASSERT_VALUE_EQ(percentile.getValue(), Value(std::vector<Value>{Value{1.0}}));
+}
+
+// Slides a large window over shuffled input to exercise block splits and removals in the
+// underlying OrderStatisticsMultiset, comparing each result against a sorted reference.
+TEST_F(WindowFunctionPercentileTest, LargeSlidingWindowMatchesSortedReference) {
+    constexpr size_t kWindowSize = 5000;
+    constexpr size_t kTotalValues = 15000;
+
+    std::vector<double> values(kTotalValues);
+    for (size_t i = 0; i < kTotalValues; i++) {
+        values[i] = static_cast<double>(i % 1000);
+    }
+    std::mt19937 gen(2025);
+    std::shuffle(values.begin(), values.end(), gen);
+
+    WindowFunctionPercentile percentile(expCtx.get(), PercentileMethodEnum::kDiscrete, {0.99});
+    for (size_t i = 0; i < kWindowSize; i++) {
+        percentile.add(Value{values[i]});
+    }
+
+    for (size_t i = kWindowSize; i < kTotalValues; i++) {
+        percentile.add(Value{values[i]});
+        percentile.remove(Value{values[i - kWindowSize]});
+
+        // Checking against the sorted reference requires a full sort, so only do it periodically.
+        if (i % 500 != 0) {
+            continue;
+        }
+        std::vector<double> window(values.begin() + i - kWindowSize + 1, values.begin() + i + 1);
+        std::sort(window.begin(), window.end());
+        const int rank =
+            DiscretePercentile::computeTrueRank(static_cast<int>(window.size()), 0.99);
+        ASSERT_VALUE_EQ(percentile.getValue(), Value(std::vector<Value>{Value{window[rank]}}));
+    }
+}
+
+}  // namespace
+}  // namespace mongo
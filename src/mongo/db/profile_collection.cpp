@@ -29,6 +29,7 @@
 
 #include "mongo/db/profile_collection.h"
 
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -52,6 +53,7 @@
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/client.h"
 #include "mongo/db/collection_crud/collection_write_path.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/concurrency/locker.h"
@@ -71,14 +73,185 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/s/shard_version.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
-#include "mongo/util/scopeguard.h"
+#include "mongo/util/producer_consumer_queue.h"
 #include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
 
 namespace mongo::profile_collection {
+namespace {
+
+auto& profileEntriesDropped = *MetricBuilder<Counter64>{"profiler.entriesDroppedOnOverload"};
+
+/**
+ * Inserts the profile document 'p' for an operation on 'ns' into that database's system.profile
+ * collection, creating the collection if it does not exist yet.
+ */
+void writeProfileDocument(OperationContext* opCtx, const NamespaceString& ns, const BSONObj& p) {
+    const auto dbProfilingNS = NamespaceString::makeSystemDotProfileNamespace(ns.dbName());
+
+    boost::optional<CollectionAcquisition> profileCollection;
+    while (true) {
+        profileCollection.emplace(
+            acquireCollection(opCtx,
+                              CollectionAcquisitionRequest(
+                                  dbProfilingNS,
+                                  PlacementConcern{boost::none, ShardVersion::UNSHARDED()},
+                                  repl::ReadConcernArgs::get(opCtx),
+                                  AcquisitionPrerequisites::kWrite),
+                              MODE_IX));
+
+        Database* const db = DatabaseHolder::get(opCtx)->getDb(opCtx, dbProfilingNS.dbName());
+        if (!db) {
+            // Database disappeared.
+            LOGV2(20700, "note: not profiling because db went away for namespace", logAttrs(ns));
+            return;
+        }
+
+        if (profileCollection->exists()) {
+            break;
+        }
+
+        uassertStatusOK(createProfileCollection(opCtx, db));
+        profileCollection.reset();
+    }
+
+    invariant(profileCollection && profileCollection->exists());
+
+    WriteUnitOfWork wuow(opCtx);
+    OpDebug* const nullOpDebug = nullptr;
+    uassertStatusOK(collection_internal::insertDocument(
+        opCtx, profileCollection->getCollectionPtr(), InsertStatement(p), nullOpDebug, false));
+    wuow.commit();
+}
+
+/**
+ * Writes profile documents on a dedicated background thread, so the operation being profiled does
+ * not pay for the system.profile insert inside its own latency. Entries are dropped (and counted
+ * in 'profiler.entriesDroppedOnOverload') when the writer cannot keep up, rather than stalling the
+ * profiled operation.
+ */
+class ProfileWriter {
+public:
+    struct Entry {
+        BSONObj doc;
+        NamespaceString nss;
+        NetworkOp op;
+    };
+
+    static ProfileWriter& get(ServiceContext* service);
+
+    ~ProfileWriter() {
+        _shutdown();
+    }
+
+    /**
+     * Hands the profile entry to the background writer, spawning it on first use.
+     */
+    void enqueue(Entry entry) {
+        {
+            stdx::lock_guard lk(_mutex);
+            if (_shuttingDown) {
+                return;
+            }
+            if (!_thread.joinable()) {
+                _thread = stdx::thread([this] {
+                    _run();
+                });
+            }
+        }
+
+        try {
+            if (!_queue.tryPush(std::move(entry))) {
+                profileEntriesDropped.increment();
+            }
+        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+            // The writer is shutting down; the entry is dropped along with the queue.
+        }
+    }
+
+private:
+    using Queue = MultiProducerSingleConsumerQueue<Entry>;
+
+    // A profile entry is at most a few kilobytes, so this bounds the writer's backlog to a few
+    // megabytes before entries start getting dropped.
+    static constexpr size_t kMaxQueueDepth = 1024;
+
+    // Upper bound on the entries drained per wakeup, so a single batch cannot hold onto an
+    // operation context for an unbounded amount of time.
+    static constexpr size_t kMaxBatchSize = 128;
+
+    static Queue::Options _makeQueueOptions() {
+        Queue::Options options;
+        options.maxQueueDepth = kMaxQueueDepth;
+        return options;
+    }
+
+    void _shutdown() {
+        stdx::thread thread;
+        {
+            stdx::lock_guard lk(_mutex);
+            if (_shuttingDown) {
+                return;
+            }
+            _shuttingDown = true;
+            thread = std::move(_thread);
+        }
+
+        _queue.closeProducerEnd();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void _run();
+
+    stdx::mutex _mutex;
+    bool _shuttingDown{false};
+    stdx::thread _thread;
+
+    Queue _queue{_makeQueueOptions()};
+};
+
+const auto getProfileWriter = ServiceContext::declareDecoration<ProfileWriter>();
+
+ProfileWriter& ProfileWriter::get(ServiceContext* service) {
+    return getProfileWriter(service);
+}
+
+void ProfileWriter::_run() {
+    auto service = getProfileWriter.owner(this)->getService(ClusterRole::ShardServer);
+    Client::initThread("SystemProfileWriter", service, Client::noSession());
+
+    while (true) {
+        std::deque<Entry> batch;
+        try {
+            batch = _queue.popManyUpTo(kMaxBatchSize).first;
+        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueConsumed>&) {
+            // The producer end was closed and the backlog is drained: we are shutting down.
+            return;
+        }
+
+        const auto opCtx = cc().makeOperationContext();
+        for (const auto& entry : batch) {
+            try {
+                writeProfileDocument(opCtx.get(), entry.nss, entry.doc);
+            } catch (const AssertionException& assertionEx) {
+                LOGV2_WARNING(20703,
+                              "Caught Assertion while trying to profile operation",
+                              "operation"_attr = networkOpToString(entry.op),
+                              logAttrs(entry.nss),
+                              "assertion"_attr = redact(assertionEx));
+            }
+        }
+    }
+}
+
+}  // namespace
 
 void profile(OperationContext* opCtx, NetworkOp op) {
     // Initialize with 1kb at start in order to avoid realloc later
@@ -123,76 +296,14 @@ void profile(OperationContext* opCtx, NetworkOp op) {
     AuthorizationSession* authSession = AuthorizationSession::get(opCtx->getClient());
     OpDebug::appendUserInfo(*CurOp::get(opCtx), b, authSession);
 
-    const BSONObj p = b.done().redact(BSONObj::RedactLevel::sensitiveOnly);
+    // The entry outlives this operation's storage, so it must own its document.
+    const BSONObj p = b.done().redact(BSONObj::RedactLevel::sensitiveOnly).getOwned();
 
     const auto ns = CurOp::get(opCtx)->getNSS();
 
-    try {
-        // We create a new opCtx so that we aren't interrupted by having the original operation
-        // killed or timed out. Those are the case we want to have profiling data.
-        auto newClient = opCtx->getServiceContext()
-                             ->getService(ClusterRole::ShardServer)
-                             ->makeClient("profiling");
-        auto newCtx = newClient->makeOperationContext();
-
-        // We swap the lockers as that way we preserve locks held in transactions and any other
-        // options set for the locker like maxLockTimeout.
-        auto oldLocker = shard_role_details::swapLocker(
-            opCtx, std::make_unique<Locker>(opCtx->getServiceContext()));
-        auto emptyLocker = shard_role_details::swapLocker(newCtx.get(), std::move(oldLocker));
-        ON_BLOCK_EXIT([&] {
-            auto oldCtxLocker =
-                shard_role_details::swapLocker(newCtx.get(), std::move(emptyLocker));
-            shard_role_details::swapLocker(opCtx, std::move(oldCtxLocker));
-        });
-        AlternativeClientRegion acr(newClient);
-        const auto dbProfilingNS = NamespaceString::makeSystemDotProfileNamespace(ns.dbName());
-
-        boost::optional<CollectionAcquisition> profileCollection;
-        while (true) {
-            profileCollection.emplace(
-                acquireCollection(newCtx.get(),
-                                  CollectionAcquisitionRequest(
-                                      dbProfilingNS,
-                                      PlacementConcern{boost::none, ShardVersion::UNSHARDED()},
-                                      repl::ReadConcernArgs::get(newCtx.get()),
-                                      AcquisitionPrerequisites::kWrite),
-                                  MODE_IX));
-
-            Database* const db =
-                DatabaseHolder::get(newCtx.get())->getDb(newCtx.get(), dbProfilingNS.dbName());
-            if (!db) {
-                // Database disappeared.
-                LOGV2(
-                    20700, "note: not profiling because db went away for namespace", logAttrs(ns));
-                return;
-            }
-
-            if (profileCollection->exists()) {
-                break;
-            }
-
-            uassertStatusOK(createProfileCollection(newCtx.get(), db));
-            profileCollection.reset();
-        }
-
-        invariant(profileCollection && profileCollection->exists());
-
-        WriteUnitOfWork wuow(newCtx.get());
-        OpDebug* const nullOpDebug = nullptr;
-        uassertStatusOK(collection_internal::insertDocument(newCtx.get(),
-                                                            profileCollection->getCollectionPtr(),
-                                                            InsertStatement(p),
-                                                            nullOpDebug,
-                                                            false));
-        wuow.commit();
-    } catch (const AssertionException& assertionEx) {
-        LOGV2_WARNING(20703,
-                      "Caught Assertion while trying to profile operation",
-                      "operation"_attr = networkOpToString(op),
-                      logAttrs(ns),
-                      "assertion"_attr = redact(assertionEx));
-    }
+    // The insert into system.profile happens on a background thread, so the profiled operation
+    // does not pay for it: building the document above is the only work done inline.
+    ProfileWriter::get(opCtx->getServiceContext()).enqueue({p, ns, op});
 }
 
 Status createProfileCollection(OperationContext* opCtx, Database* db) {
@@ -43,7 +43,10 @@ class OperationContext;
 namespace profile_collection {
 
 /**
- * Invoked when database profile is enabled.
+ * Invoked when database profile is enabled. Builds the profile document for the current operation
+ * inline, but hands it to a background writer for the actual system.profile insert, so the entry
+ * may not be visible immediately after the operation returns. Entries are dropped (and counted in
+ * the 'profiler.entriesDroppedOnOverload' metric) if the writer cannot keep up.
  */
 void profile(OperationContext* opCtx, NetworkOp op);
 
@@ -157,6 +157,21 @@ void ClassicPlannerInterface::addUpdateStage(ParsedUpdate* parsedUpdate,
     const auto& request = parsedUpdate->getRequest();
     const bool isUpsert = updateStageParams.request->isUpsert();
     const auto timeseriesOptions = collections().getMainCollection()->getTimeseriesOptions();
+    const auto& collectionPtr = collections().getMainCollection();
+
+    // Mirrors the batched delete eligibility checks above, plus the update-specific restrictions
+    // enforced by the batched update stage.
+    const bool batchUpdate = gBatchUserMultiUpdates.load() &&
+        (shard_role_details::getRecoveryUnit(opCtx())->getState() ==
+             RecoveryUnit::State::kInactive ||
+         shard_role_details::getRecoveryUnit(opCtx())->getState() ==
+             RecoveryUnit::State::kActiveNotInUnitOfWork) &&
+        !opCtx()->inMultiDocumentTransaction() && !opCtx()->isRetryableWrite() &&
+        !collectionPtr->isChangeStreamPreAndPostImagesEnabled() &&
+        !collectionPtr->ns().isConfigDB() && request->isMulti() && !isUpsert &&
+        !request->shouldReturnAnyDocs() && request->getSort().isEmpty() &&
+        request->source() != OperationSource::kFromMigrate &&
+        !updateStageParams.numStatsForDoc;
     if (parsedUpdate->isEligibleForArbitraryTimeseriesUpdate()) {
         if (request->isMulti()) {
             // If this is a multi-update, we need to spool the data before beginning to apply
@@ -191,6 +206,13 @@ void ClassicPlannerInterface::addUpdateStage(ParsedUpdate* parsedUpdate,
                                               ws(),
                                               collections().getMainAcquisition(),
                                               _root.release());
+    } else if (batchUpdate) {
+        _root = std::make_unique<BatchedUpdateStage>(cq()->getExpCtxRaw(),
+                                                     updateStageParams,
+                                                     std::make_unique<BatchedUpdateStageParams>(),
+                                                     ws(),
+                                                     collections().getMainAcquisition(),
+                                                     _root.release());
     } else {
         _root = std::make_unique<UpdateStage>(cq()->getExpCtxRaw(),
                                               updateStageParams,
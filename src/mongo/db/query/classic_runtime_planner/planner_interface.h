@@ -30,6 +30,7 @@
 #pragma once
 
 #include "mongo/db/exec/batched_delete_stage.h"
+#include "mongo/db/exec/batched_update_stage.h"
 #include "mongo/db/exec/cached_plan.h"
 #include "mongo/db/exec/multi_plan.h"
 #include "mongo/db/exec/plan_cache_util.h"
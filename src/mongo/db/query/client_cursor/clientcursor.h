@@ -34,6 +34,7 @@
 #include <boost/optional/optional.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <string>
@@ -333,6 +334,41 @@ public:
         _stashedRecoveryUnit = std::move(ru);
     }
 
+    /**
+     * A batch of results staged ahead of demand at the end of a getMore, to be returned by the
+     * next getMore on this cursor without running the PlanExecutor again. Only populated when
+     * 'internalQueryGetMorePrefetchNextBatch' is enabled.
+     */
+    struct PreFetchedBatch {
+        // Owned documents, in the order they were produced by the executor.
+        std::deque<BSONObj> docs;
+
+        // Total size of 'docs' in bytes.
+        size_t bytesBuffered = 0;
+
+        // Whether the executor returned EOF while this batch was staged. If so, the cursor can be
+        // exhausted once 'docs' is drained, without running the executor again.
+        bool exhausted = false;
+    };
+
+    bool hasPreFetchedBatch() const {
+        return _preFetchedBatch.has_value();
+    }
+
+    PreFetchedBatch& preFetchedBatch() {
+        invariant(_preFetchedBatch);
+        return *_preFetchedBatch;
+    }
+
+    void stashPreFetchedBatch(PreFetchedBatch batch) {
+        invariant(!_preFetchedBatch);
+        _preFetchedBatch.emplace(std::move(batch));
+    }
+
+    void clearPreFetchedBatch() {
+        _preFetchedBatch = boost::none;
+    }
+
     /**
      * Returns true if a client has requested that this cursor can be killed.
      */
@@ -492,6 +528,9 @@ private:
     // oplog fetching.
     boost::optional<repl::OpTime> _lastKnownCommittedOpTime;
 
+    // Results staged for the next getMore. See the comment on 'PreFetchedBatch'.
+    boost::optional<PreFetchedBatch> _preFetchedBatch;
+
     // Passed along from the original query so that it can be logged if necessary in getMore
     // requests.
     boost::optional<uint32_t> _planCacheKey;
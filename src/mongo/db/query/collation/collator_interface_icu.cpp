@@ -58,6 +58,14 @@ std::shared_ptr<CollatorInterface> CollatorInterfaceICU::cloneShared() const {
 }
 
 int CollatorInterfaceICU::compare(StringData left, StringData right) const {
+    if (left.size() <= kMaxCacheableStringLength && right.size() <= kMaxCacheableStringLength) {
+        // Resolve the comparison through cached sort keys. Each distinct value's key is computed
+        // once (while it stays in the cache) and subsequent comparisons are plain byte
+        // comparisons, which is much cheaper than a full ICU comparison per call.
+        const auto result = lookupOrComputeSortKey(left).compare(lookupOrComputeSortKey(right));
+        return (result > 0) - (result < 0);
+    }
+
     UErrorCode status = U_ZERO_ERROR;
     auto compareResult = _collator->compareUTF8(icu::StringPiece(left.rawData(), left.size()),
                                                 icu::StringPiece(right.rawData(), right.size()),
@@ -82,6 +90,13 @@ int CollatorInterfaceICU::compare(StringData left, StringData right) const {
 
 CollatorInterface::ComparisonKey CollatorInterfaceICU::getComparisonKey(
     StringData stringData) const {
+    if (stringData.size() <= kMaxCacheableStringLength) {
+        return makeComparisonKey(lookupOrComputeSortKey(stringData));
+    }
+    return makeComparisonKey(computeSortKey(stringData));
+}
+
+std::string CollatorInterfaceICU::computeSortKey(StringData stringData) const {
     // A StringPiece is ICU's StringData. They are logically the same abstraction.
     const icu::StringPiece stringPiece(stringData.rawData(), stringData.size());
 
@@ -99,11 +114,28 @@ CollatorInterface::ComparisonKey CollatorInterfaceICU::getComparisonKey(
     invariant(keyLength > 0);
     invariant(keyBuffer);
 
-    // The last byte of the sort key should always be null. When we construct the comparison key, we
-    // omit the trailing null byte.
+    // The last byte of the sort key should always be null. When we construct the comparison key,
+    // we omit the trailing null byte.
     invariant(keyBuffer[keyLength - 1u] == '\0');
     const char* charBuffer = reinterpret_cast<const char*>(keyBuffer);
-    return makeComparisonKey(std::string(charBuffer, keyLength - 1u));
+    return std::string(charBuffer, keyLength - 1u);
+}
+
+std::string CollatorInterfaceICU::lookupOrComputeSortKey(StringData stringData) const {
+    std::string key{stringData};
+    {
+        stdx::lock_guard<stdx::mutex> lk(_sortKeyCacheMutex);
+        auto it = _sortKeyCache.find(key);
+        if (it != _sortKeyCache.end()) {
+            return it->second;
+        }
+    }
+
+    // Compute the sort key outside the lock; ICU does the expensive part.
+    auto sortKey = computeSortKey(stringData);
+    stdx::lock_guard<stdx::mutex> lk(_sortKeyCacheMutex);
+    _sortKeyCache.add(std::move(key), sortKey);
+    return sortKey;
 }
 
 }  // namespace mongo
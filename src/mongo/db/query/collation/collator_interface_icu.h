@@ -29,12 +29,16 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <unicode/coll.h>
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/basic_types_gen.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/lru_cache.h"
 
 namespace mongo {
 
@@ -54,9 +58,35 @@ public:
     ComparisonKey getComparisonKey(StringData stringData) const final;
 
 private:
+    // Strings no longer than this are eligible for the sort key cache. Longer strings are unlikely
+    // to repeat and would crowd out the values the cache is meant to serve.
+    static constexpr size_t kMaxCacheableStringLength = 256;
+
+    // The number of sort keys retained in the cache.
+    static constexpr size_t kSortKeyCacheSize = 1024;
+
+    /**
+     * Computes the ICU sort key for 'stringData', without the trailing null byte.
+     */
+    std::string computeSortKey(StringData stringData) const;
+
+    /**
+     * Returns the sort key for 'stringData' from the cache, computing and inserting it on a miss.
+     * Must only be called for strings no longer than 'kMaxCacheableStringLength'.
+     */
+    std::string lookupOrComputeSortKey(StringData stringData) const;
+
     // The ICU implementation of the collator to which we delegate interesting work. Const methods
     // on the ICU collator are expected to be thread-safe.
     const std::unique_ptr<icu::Collator> _collator;
+
+    // Computing an ICU sort key, or comparing two strings through ICU, is far more expensive than
+    // comparing two precomputed sort keys byte-wise. Sorts repeatedly compare the same values (each
+    // value takes part in many comparisons, and low-cardinality fields repeat values outright), so
+    // recently used sort keys are kept in a small LRU cache. Guarded by '_sortKeyCacheMutex'
+    // because const methods of a collator may be called concurrently.
+    mutable stdx::mutex _sortKeyCacheMutex;
+    mutable LRUCache<std::string, std::string> _sortKeyCache{kSortKeyCacheSize};
 };
 
 }  // namespace mongo
@@ -598,4 +598,44 @@ TEST(CollatorInterfaceICUTest, ComparisonKeysForFrCaCollatorCorrect) {
               "\x2D\x45\x4F\x31\x01\x88\x44\x8E\x06\x01\x0A");
 }
 
+TEST(CollatorInterfaceICUTest, RepeatedComparisonsOfSameStringsAreConsistent) {
+    Collation collationSpec;
+    collationSpec.setLocale("en_US");
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::Collator> coll(
+        icu::Collator::createInstance(icu::Locale("en", "US"), status));
+    ASSERT(U_SUCCESS(status));
+    CollatorInterfaceICU icuCollator(collationSpec, std::move(coll));
+
+    // Exercise the sort key cache: the first comparison computes and caches the sort keys, the
+    // repeats must be served from the cache with identical results.
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_LT(icuCollator.compare("ab", "ba"), 0);
+        ASSERT_GT(icuCollator.compare("ba", "ab"), 0);
+        ASSERT_EQ(icuCollator.compare("ab", "ab"), 0);
+        ASSERT_EQ(icuCollator.getComparisonKey("abc").getKeyData(),
+                  "\x29\x2B\x2D\x01\x07\x01\x07");
+    }
+}
+
+TEST(CollatorInterfaceICUTest, StringsLongerThanSortKeyCacheLimitCompareCorrectly) {
+    Collation collationSpec;
+    collationSpec.setLocale("en_US");
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::Collator> coll(
+        icu::Collator::createInstance(icu::Locale("en", "US"), status));
+    ASSERT(U_SUCCESS(status));
+    CollatorInterfaceICU icuCollator(collationSpec, std::move(coll));
+
+    // Strings longer than the cacheable limit take the uncached ICU comparison path and must
+    // agree with comparisons of their comparison keys.
+    const std::string lesser(10 * 1024, 'a');
+    const std::string greater(10 * 1024, 'b');
+    ASSERT_LT(icuCollator.compare(lesser, greater), 0);
+    ASSERT_GT(icuCollator.compare(greater, lesser), 0);
+    ASSERT_EQ(icuCollator.compare(lesser, lesser), 0);
+    ASSERT_LT(icuCollator.getComparisonKey(lesser).getKeyData(),
+              icuCollator.getComparisonKey(greater).getKeyData());
+}
+
 }  // namespace
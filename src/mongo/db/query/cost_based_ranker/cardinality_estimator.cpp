@@ -32,6 +32,7 @@
 #include "mongo/db/matcher/expression_array.h"
 #include "mongo/db/query/ce/histogram_estimator.h"
 #include "mongo/db/query/cost_based_ranker/heuristic_estimator.h"
+#include "mongo/db/query/cost_based_ranker/selectivity_estimate_cache.h"
 #include "mongo/db/query/index_bounds_builder.h"
 #include "mongo/db/query/stage_types.h"
 #include <absl/container/flat_hash_map.h>
@@ -149,6 +150,7 @@ CEResult CardinalityEstimator::estimate(const QuerySolutionNode* node) {
             return Status(ErrorCodes::UnsupportedCbrNode, "encountered unsupported stages");
         }
         case STAGE_BATCHED_DELETE:
+        case STAGE_BATCHED_UPDATE:
         case STAGE_CACHED_PLAN:
         case STAGE_COUNT:
         case STAGE_COUNT_SCAN:
@@ -626,6 +628,23 @@ CEResult CardinalityEstimator::estimateConjWithHistogram(
                           << path);
     }
 
+    // Histogram estimation is deterministic for a given predicate conjunction, so its derived
+    // selectivity can be reused across queries. Probe the process-wide estimate cache before
+    // paying for interval construction and histogram traversal. The cached selectivity is
+    // scale-free, so it can be applied to the current input cardinality directly.
+    SelectivityEstimateCache* estimateCache = nullptr;
+    std::string estimateCacheKey;
+    if (_inputCard != zeroCE) {
+        estimateCache = SelectivityEstimateCache::getIfEnabled();
+        if (estimateCache) {
+            estimateCacheKey =
+                SelectivityEstimateCache::makeKey(_collInfo.collStats->getNss(), path, nodes);
+            if (auto cachedSel = estimateCache->lookup(estimateCacheKey)) {
+                return *cachedSel * _inputCard;
+            }
+        }
+    }
+
     // At this point, we know that 'path' is non-multikey, so we can safely build an interval for
     // each conjunct and intersect them.
     IndexEntry fakeIndex(BSON(path << "1") /* keyPattern */,
@@ -655,7 +674,11 @@ CEResult CardinalityEstimator::estimateConjWithHistogram(
     }
     // TODO: SERVER-98094 use tightness depending the context in which a predicate is estimated
 
-    return estimate(&oil, true);
+    auto ceRes = estimate(&oil, true);
+    if (estimateCache && ceRes.isOK()) {
+        estimateCache->put(estimateCacheKey, ceRes.getValue() / _inputCard);
+    }
+    return ceRes;
 }
 
 CEResult CardinalityEstimator::tryHistogramAnd(const AndMatchExpression* node) {
@@ -0,0 +1,91 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/cost_based_ranker/selectivity_estimate_cache.h"
+
+#include <memory>
+#include <utility>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/util/namespace_string_util.h"
+#include "mongo/util/static_immortal.h"
+#include "mongo/util/str.h"
+
+namespace mongo::cost_based_ranker {
+
+SelectivityEstimateCache* SelectivityEstimateCache::getIfEnabled() {
+    // The sizing knob is startup-only, so the capacity read here is stable for the lifetime of
+    // the process.
+    static StaticImmortal<std::unique_ptr<SelectivityEstimateCache>> cache{
+        []() -> std::unique_ptr<SelectivityEstimateCache> {
+            const auto numEntries = internalQueryCbrSelectivityEstimateCacheEntries.load();
+            if (numEntries <= 0) {
+                return nullptr;
+            }
+            return std::make_unique<SelectivityEstimateCache>(static_cast<size_t>(numEntries));
+        }()};
+    return cache->get();
+}
+
+std::string SelectivityEstimateCache::makeKey(const NamespaceString& nss,
+                                              StringData path,
+                                              const std::vector<const MatchExpression*>& nodes) {
+    StringBuilder sb;
+    sb << NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault()) << '\0' << path;
+    for (auto&& expr : nodes) {
+        sb << '\0' << expr->serialize().toString();
+    }
+    return sb.str();
+}
+
+boost::optional<SelectivityEstimate> SelectivityEstimateCache::lookup(const std::string& key) {
+    stdx::lock_guard lk(_mutex);
+    if (auto it = _cache.find(key); it != _cache.end()) {
+        return it->second;
+    }
+    return boost::none;
+}
+
+void SelectivityEstimateCache::put(const std::string& key, SelectivityEstimate sel) {
+    stdx::lock_guard lk(_mutex);
+    _cache.add(key, std::move(sel));
+}
+
+void SelectivityEstimateCache::clear() {
+    stdx::lock_guard lk(_mutex);
+    _cache.clear();
+}
+
+size_t SelectivityEstimateCache::size() {
+    stdx::lock_guard lk(_mutex);
+    return _cache.size();
+}
+
+}  // namespace mongo::cost_based_ranker
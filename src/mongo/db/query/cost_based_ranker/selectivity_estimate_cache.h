@@ -0,0 +1,94 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/string_data.h"
+#include "mongo/db/matcher/expression.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/query/cost_based_ranker/estimates.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/lru_cache.h"
+
+namespace mongo::cost_based_ranker {
+
+/**
+ * A process-wide LRU cache of histogram-derived selectivity estimates keyed by collection, path
+ * and normalized predicate conjunction. Workloads that repeatedly plan similar query shapes over
+ * the same predicates reuse previously derived selectivities instead of re-deriving them by
+ * intersecting intervals and walking histogram buckets on every plan enumeration.
+ *
+ * Cached selectivities are scale-free (relative to the input cardinality of the estimated plan
+ * fragment), so an entry is valid for any fragment probing the same predicate. The cache is
+ * cleared whenever the analyze command refreshes histograms, mirroring the invalidation of the
+ * histograms themselves in the stats cache.
+ *
+ * The cache is sized by the 'internalQueryCbrSelectivityEstimateCacheEntries' startup parameter;
+ * a size of zero disables it entirely.
+ */
+class SelectivityEstimateCache {
+public:
+    /**
+     * Returns the process-wide cache instance, or nullptr when the cache is disabled.
+     */
+    static SelectivityEstimateCache* getIfEnabled();
+
+    /**
+     * Builds the cache key for the conjunction of predicates in 'nodes', all of which are over
+     * 'path', against the collection described by 'nss'.
+     */
+    static std::string makeKey(const NamespaceString& nss,
+                               StringData path,
+                               const std::vector<const MatchExpression*>& nodes);
+
+    explicit SelectivityEstimateCache(size_t numEntries) : _cache(numEntries) {}
+
+    boost::optional<SelectivityEstimate> lookup(const std::string& key);
+
+    void put(const std::string& key, SelectivityEstimate sel);
+
+    /**
+     * Drops all entries. Invoked when the analyze command refreshes histograms.
+     */
+    void clear();
+
+    size_t size();
+
+private:
+    stdx::mutex _mutex;
+    LRUCache<std::string, SelectivityEstimate> _cache;
+};
+
+}  // namespace mongo::cost_based_ranker
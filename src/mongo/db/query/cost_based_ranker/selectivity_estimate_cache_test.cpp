@@ -0,0 +1,97 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/cost_based_ranker/selectivity_estimate_cache.h"
+
+#include "mongo/bson/json.h"
+#include "mongo/db/query/cost_based_ranker/cbr_test_utils.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo::cost_based_ranker {
+namespace {
+
+const NamespaceString kNss = NamespaceString::createNamespaceString_forTest("test.coll");
+
+SelectivityEstimate makeSel(double sel) {
+    return SelectivityEstimate(SelectivityType{sel}, EstimationSource::Histogram);
+}
+
+TEST(SelectivityEstimateCacheTest, LookupReturnsPutValue) {
+    SelectivityEstimateCache cache(10);
+    auto pred = parse(fromjson("{a: {$gt: 5}}"));
+    auto key = SelectivityEstimateCache::makeKey(kNss, "a", {pred.get()});
+
+    ASSERT_FALSE(cache.lookup(key));
+    cache.put(key, makeSel(0.25));
+    auto cached = cache.lookup(key);
+    ASSERT_TRUE(cached);
+    ASSERT_EQ(*cached, makeSel(0.25));
+}
+
+TEST(SelectivityEstimateCacheTest, KeyDistinguishesCollectionPathAndPredicate) {
+    auto pred1 = parse(fromjson("{a: {$gt: 5}}"));
+    auto pred2 = parse(fromjson("{a: {$gt: 6}}"));
+    const auto otherNss = NamespaceString::createNamespaceString_forTest("test.other");
+
+    auto key = SelectivityEstimateCache::makeKey(kNss, "a", {pred1.get()});
+    ASSERT_NE(key, SelectivityEstimateCache::makeKey(otherNss, "a", {pred1.get()}));
+    ASSERT_NE(key, SelectivityEstimateCache::makeKey(kNss, "b", {pred1.get()}));
+    ASSERT_NE(key, SelectivityEstimateCache::makeKey(kNss, "a", {pred2.get()}));
+    ASSERT_NE(key, SelectivityEstimateCache::makeKey(kNss, "a", {pred1.get(), pred2.get()}));
+    ASSERT_EQ(key, SelectivityEstimateCache::makeKey(kNss, "a", {pred1.get()}));
+}
+
+TEST(SelectivityEstimateCacheTest, EvictsLeastRecentlyUsedEntry) {
+    SelectivityEstimateCache cache(2);
+    cache.put("first", makeSel(0.1));
+    cache.put("second", makeSel(0.2));
+    // Touch "first" so that "second" becomes the eviction candidate.
+    ASSERT_TRUE(cache.lookup("first"));
+    cache.put("third", makeSel(0.3));
+
+    ASSERT_EQ(cache.size(), 2u);
+    ASSERT_TRUE(cache.lookup("first"));
+    ASSERT_FALSE(cache.lookup("second"));
+    ASSERT_TRUE(cache.lookup("third"));
+}
+
+TEST(SelectivityEstimateCacheTest, ClearDropsAllEntries) {
+    SelectivityEstimateCache cache(10);
+    cache.put("first", makeSel(0.1));
+    cache.put("second", makeSel(0.2));
+    cache.clear();
+
+    ASSERT_EQ(cache.size(), 0u);
+    ASSERT_FALSE(cache.lookup("first"));
+    ASSERT_FALSE(cache.lookup("second"));
+}
+
+}  // namespace
+}  // namespace mongo::cost_based_ranker
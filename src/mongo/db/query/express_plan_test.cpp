@@ -281,6 +281,42 @@ TEST_F(ExpressPlanTest, TestLookupViaUserIndexWithMatchingQuery) {
     ASSERT_EQ(iteratorStats.indexKeyPattern(), "{ a: 1 }");
 }
 
+TEST_F(ExpressPlanTest, TestLookupViaUserIndexWithCoveredProjection) {
+    StringData indexName = "a_1"_sd;
+    auto indexSpec = BSON("v" << 2 << "name" << indexName << "key" << BSON("a" << 1));
+    auto collection = createAndPopulateTestCollectionWithIndex(
+        indexSpec, "{_id: 0, a: 2}"_sd, "{_id: 1, a: 3}"_sd, "{_id: 2, a: 5}"_sd);
+    const CollectionPtr& collectionPtr = *collection;
+
+    auto indexDescriptor =
+        collectionPtr->getIndexCatalog()->findIndexByName(operationContext(), indexName);
+
+    IteratorStats iteratorStats;
+    auto filter = fromjson("{a: 5}");
+    CollatorInterface* collator = nullptr;
+    LookupViaUserIndex<const CollectionPtr*> iterator(filter.firstElement(),
+                                                      indexDescriptor->getEntry()->getIdent(),
+                                                      indexName.toString(),
+                                                      collator,
+                                                      true /* coveredProjection */);
+    iterator.open(operationContext(), &collectionPtr, &iteratorStats);
+
+    // In covered mode the iterator returns the rehydrated index key without fetching the
+    // document from the collection.
+    auto [result, obj] = iterateAndExpectDocument(operationContext(), iterator);
+    ASSERT(std::holds_alternative<Exhausted>(result));
+    ASSERT_BSONOBJ_EQ(obj, fromjson("{a: 5}"));
+
+    result = iterateButExpectNoDocument(operationContext(), iterator);
+    ASSERT(std::holds_alternative<Exhausted>(result));
+
+    ASSERT_EQ(iteratorStats.stageName(), "EXPRESS_IXSCAN");
+    ASSERT_EQ(iteratorStats.numKeysExamined(), 1);
+    ASSERT_EQ(iteratorStats.numDocumentsFetched(), 0);
+    ASSERT_EQ(iteratorStats.indexName(), "a_1");
+    ASSERT_EQ(iteratorStats.indexKeyPattern(), "{ a: 1 }");
+}
+
 TEST_F(ExpressPlanTest, TestLookupViaUserIndexWithMatchingQueryUsingCollator) {
     StringData indexName = "a_1"_sd;
     auto collationSpec = BSON("locale"
@@ -143,6 +143,24 @@ std::size_t FindCommon::getBytesToReserveForGetMoreReply(bool isTailable,
     // command metadata to the reply.
     return kMaxBytesToReturnToClientAtOnce;
 }
+
+std::size_t FindCommon::getBytesToReserveForFirstBatch(size_t firstResultSize, size_t batchSize) {
+#ifdef _WIN32
+    // SERVER-22100: see getBytesToReserveForGetMoreReply() above; skip pre-allocation in Windows
+    // DEBUG builds.
+    if (kDebugBuild)
+        return 0;
+#endif
+
+    // Estimate the batch as 'batchSize' documents the size of the first one, using the same size
+    // floor as getMore to avoid under-allocating for small leading documents. The reply buffer
+    // already holds the initial kInitReplyBufferSize reservation, so only reserve beyond it when
+    // the estimated batch is bigger.
+    size_t estmtObjSize = std::max(kMinDocSizeForGetMorePreAllocation, firstResultSize);
+    size_t estimate = std::min(estmtObjSize * batchSize, kMaxBytesToReturnToClientAtOnce);
+    return estimate > kInitReplyBufferSize ? estimate : 0;
+}
+
 bool FindCommon::BSONArrayResponseSizeTracker::haveSpaceForNext(const BSONObj& document) {
     return FindCommon::haveSpaceForNext(document, _numberOfDocuments, _bsonArraySizeInBytes);
 }
@@ -129,13 +129,15 @@ public:
                               CursorResponseBuilder* builder,
                               ResourceConsumption::DocumentUnitCounter* docUnitsReturned,
                               BSONObj& pbrt,
-                              bool& failedToAppend)
+                              bool& failedToAppend,
+                              const size_t preReserveBatchSize = 0)
             : _alwaysAcceptFirstDoc{alwaysAcceptFirstDoc},
               _exec{exec},
               _builder{builder},
               _docUnitsReturned{docUnitsReturned},
               _pbrt{pbrt},
-              _failedToAppend{failedToAppend} {}
+              _failedToAppend{failedToAppend},
+              _preReserveBatchSize{preReserveBatchSize} {}
 
         BSONObjCursorAppender(const BSONObjCursorAppender&) = default;
         ~BSONObjCursorAppender() = default;
@@ -146,6 +148,13 @@ public:
                                                      const size_t numAppended) {
             objSize = obj.objsize();
 
+            // Size the reply buffer off the first document so the rest of the batch appends
+            // without growing (and re-copying) the underlying message buffer.
+            if (numAppended == 0 && _preReserveBatchSize > 0) {
+                _builder->reserveReplyBuffer(
+                    FindCommon::getBytesToReserveForFirstBatch(objSize, _preReserveBatchSize));
+            }
+
             if (MONGO_unlikely(
                     !(_alwaysAcceptFirstDoc && numAppended == 0) &&
                     !FindCommon::fitsInBatch(_builder->bytesUsed(),
@@ -173,6 +182,7 @@ public:
         ResourceConsumption::DocumentUnitCounter* _docUnitsReturned;
         BSONObj& _pbrt;
         bool& _failedToAppend;
+        const size_t _preReserveBatchSize = 0;
 
         // State within append() calls.
         size_t objSize;
@@ -229,6 +239,12 @@ public:
                                                         size_t firstResultSize,
                                                         size_t batchSize);
 
+    /**
+     * Computes a preallocation size for the first-batch reply buffer of a find command based on
+     * the size of the first result and the requested batch size.
+     */
+    static std::size_t getBytesToReserveForFirstBatch(size_t firstResultSize, size_t batchSize);
+
     /**
      * Tracker of a size of a server response presented as a BSON array. Facilitates limiting
      * the server response size to 16MB + certain epsilon. Accounts for array element and it's
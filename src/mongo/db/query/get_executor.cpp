@@ -1419,6 +1419,24 @@ StatusWith<std::unique_ptr<projection_ast::Projection>> makeProjection(const BSO
     return std::make_unique<projection_ast::Projection>(proj);
 }
 
+/**
+ * Attempts to parse 'projObj' into a projection that the express write path can apply itself: a
+ * simple projection over top-level fields with no positional operator, expressions, or metadata.
+ * Returns nullptr when the projection does not qualify, in which case the caller must fall back to
+ * the classic path, which parses the projection against the query and reports any parse error.
+ */
+std::unique_ptr<projection_ast::Projection> tryMakeProjectionForExpressWrite(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, const BSONObj& projObj) try {
+    auto projection = std::make_unique<projection_ast::Projection>(projection_ast::parseAndAnalyze(
+        expCtx, projObj.getOwned(), ProjectionPolicies::findProjectionPolicies()));
+    if (!projection->isSimple()) {
+        return nullptr;
+    }
+    return projection;
+} catch (const DBException&) {
+    return nullptr;
+}
+
 }  // namespace
 
 //
@@ -1515,11 +1533,19 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorDele
                                                   collectionPtr->getDefaultCollator());
 
             if (hasIdIndex && CanonicalQuery::isSimpleIdQuery(unparsedQuery) &&
-                request->getProj().isEmpty() && hasCollectionDefaultCollation) {
-
-                LOGV2_DEBUG(8376000, 2, "Using express", "query"_attr = redact(unparsedQuery));
+                hasCollectionDefaultCollation) {
+                // A simple projection on the deleted document can be applied by the express
+                // executor itself; anything more complex requires the classic path.
+                std::unique_ptr<projection_ast::Projection> projection;
+                if (!request->getProj().isEmpty()) {
+                    projection = tryMakeProjectionForExpressWrite(expCtx, request->getProj());
+                }
+                if (request->getProj().isEmpty() || projection) {
+                    LOGV2_DEBUG(8376000, 2, "Using express", "query"_attr = redact(unparsedQuery));
 
-                return makeExpressExecutorForDelete(opCtx, coll, parsedDelete);
+                    return makeExpressExecutorForDelete(
+                        opCtx, coll, parsedDelete, std::move(projection));
+                }
             }
         }
 
@@ -1676,20 +1702,28 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorUpda
             const bool hasCollectionDefaultCollation = CollatorInterface::collatorsMatch(
                 expCtx->getCollator(), collectionPtr->getDefaultCollator());
 
-            if (CanonicalQuery::isSimpleIdQuery(unparsedQuery) && request->getProj().isEmpty() &&
-                hasCollectionDefaultCollation) {
+            if (CanonicalQuery::isSimpleIdQuery(unparsedQuery) && hasCollectionDefaultCollation) {
 
                 const auto idIndexDesc = collectionPtr->getIndexCatalog()->findIdIndex(opCtx);
-                if (!request->isUpsert() &&
+                // A simple projection on the returned document can be applied by the express
+                // executor itself; anything more complex requires the classic path.
+                std::unique_ptr<projection_ast::Projection> projection;
+                if (!request->getProj().isEmpty()) {
+                    projection = tryMakeProjectionForExpressWrite(expCtx, request->getProj());
+                }
+                const bool projectionIsExpressCompatible =
+                    request->getProj().isEmpty() || projection;
+                if (!request->isUpsert() && projectionIsExpressCompatible &&
                     (idIndexDesc ||
                      clustered_util::isClusteredOnId(collectionPtr->getClusteredInfo()))) {
                     // Upserts not supported in express for now.
                     LOGV2_DEBUG(83759, 2, "Using Express", "query"_attr = redact(unparsedQuery));
 
                     return makeExpressExecutorForUpdate(
-                        opCtx, coll, parsedUpdate, false /* return owned BSON */);
+                        opCtx, coll, parsedUpdate, false /* return owned BSON */,
+                        std::move(projection));
 
-                } else if (idIndexDesc) {
+                } else if (idIndexDesc && request->getProj().isEmpty()) {
                     LOGV2_DEBUG(20930, 2, "Using idhack", "query"_attr = redact(unparsedQuery));
                     UpdateStageParams updateStageParams(
                         request, driver, opDebug, std::move(documentCounter));
@@ -29,9 +29,12 @@
 
 #pragma once
 
+#include <memory>
+
 #include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/query/lru_key_value.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/container_size_helper.h"
 
 namespace mongo {
@@ -62,6 +65,15 @@ public:
     using Partition = typename Partitioned<Lru, Partitioner>::OnePartition;
     using PartitionId = typename Partitioned<Lru, Partitioner>::PartitionId;
 
+    /**
+     * Per-partition lookup counters. Tracked outside the partition mutex so that observability
+     * (e.g. serverStatus) never contends with the lookup path beyond a relaxed atomic increment.
+     */
+    struct PartitionStats {
+        AtomicWord<long long> hits;
+        AtomicWord<long long> misses;
+    };
+
     /**
      * Initialize plan cache with the total cache size in bytes and number of partitions.
      *
@@ -98,7 +110,8 @@ public:
      * evictions.
      */
     explicit PartitionedCache(size_t cacheSize, size_t numPartitions)
-        : _numPartitions(numPartitions) {
+        : _numPartitions(numPartitions),
+          _partitionStats(std::make_unique<PartitionStats[]>(numPartitions)) {
         invariant(numPartitions > 0);
         Lru lru{cacheSize / numPartitions};
         _partitionedCache =
@@ -126,9 +139,11 @@ public:
         auto partition = _partitionedCache->lockOnePartition(key);
         auto entry = partition->get(key);
         if (!entry.isOK()) {
+            _partitionStats[partition.id()].misses.fetchAndAddRelaxed(1);
             return {entry.getStatus()};
         }
 
+        _partitionStats[partition.id()].hits.fetchAndAddRelaxed(1);
         return {&entry.getValue()->second};
     }
 
@@ -140,9 +155,11 @@ public:
         auto partition = _partitionedCache->lockOnePartition(key);
         auto entry = partition->get(key);
         if (!entry.isOK()) {
+            _partitionStats[partition.id()].misses.fetchAndAddRelaxed(1);
             return std::make_pair(entry.getStatus(), std::move(partition));
         }
 
+        _partitionStats[partition.id()].hits.fetchAndAddRelaxed(1);
         return std::make_pair(StatusWith{&entry.getValue()->second}, std::move(partition));
     }
 
@@ -205,6 +222,15 @@ public:
         return _numPartitions;
     }
 
+    /**
+     * Returns the lookup counters for the given partition. Counters are cumulative since the
+     * cache was constructed; they are not reset by 'clear()' or 'reset()'.
+     */
+    const PartitionStats& partitionStats(PartitionId partitionId) const {
+        invariant(partitionId < _numPartitions);
+        return _partitionStats[partitionId];
+    }
+
     /**
      * Invoke `op` for each entry in the cache. Consistency across partitions is not guaranteed.
      */
@@ -235,6 +261,8 @@ public:
 
 private:
     std::size_t _numPartitions;
+    // Mutable so lookups through const accessors can record hits and misses.
+    mutable std::unique_ptr<PartitionStats[]> _partitionStats;
     std::unique_ptr<Partitioned<Lru, Partitioner>> _partitionedCache;
 };
 
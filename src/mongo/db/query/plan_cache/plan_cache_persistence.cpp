@@ -0,0 +1,260 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/plan_cache/plan_cache_persistence.h"
+
+#include <fstream>
+#include <memory>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "mongo/base/data_type_endian.h"
+#include "mongo/base/data_view.h"
+#include "mongo/bson/bson_validate.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/query/collection_query_info.h"
+#include "mongo/db/query/find_command.h"
+#include "mongo/db/query/plan_cache/classic_plan_cache.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/str.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/namespace_string_util.h"
+#include "mongo/util/periodic_runner.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
+
+namespace mongo::plan_cache_persistence {
+namespace {
+
+constexpr int kFormatVersion = 1;
+
+// How often the periodic job rewrites the shapes file.
+constexpr Seconds kDumpInterval{300};
+
+const auto periodicShapeDumpAnchor = ServiceContext::declareDecoration<PeriodicJobAnchor>();
+
+boost::filesystem::path shapesFilePath(const boost::filesystem::path& dbpath) {
+    return dbpath / std::string{kShapesFilename};
+}
+
+}  // namespace
+
+BSONObj serializeShape(StringData ns,
+                       const BSONObj& filter,
+                       const BSONObj& sort,
+                       const BSONObj& projection,
+                       const BSONObj& collation) {
+    BSONObjBuilder bob;
+    bob.append("ns", ns);
+    bob.append("filter", filter);
+    bob.append("sort", sort);
+    bob.append("projection", projection);
+    bob.append("collation", collation);
+    return bob.obj();
+}
+
+size_t dumpShapes(OperationContext* opCtx, const boost::filesystem::path& dbpath) {
+    std::vector<BSONObj> shapes;
+
+    auto catalog = CollectionCatalog::get(opCtx);
+    for (const auto& dbName : catalog->getAllDbNames()) {
+        for (auto&& coll : catalog->range(dbName)) {
+            if (coll->ns().isSystem()) {
+                continue;
+            }
+            auto ns = NamespaceStringUtil::serialize(coll->ns(),
+                                                     SerializationContext::stateDefault());
+            const auto* planCache =
+                CollectionQueryInfo::getCollectionQueryInfo(coll).getPlanCache();
+            planCache->forEach([&](const PlanCacheKey&,
+                                   const std::shared_ptr<const PlanCacheEntry>& entry) {
+                // Large entries do not retain debug info, and distinct() shapes cannot be
+                // replayed through the find path.
+                if (!entry->debugInfo ||
+                    !entry->debugInfo->createdFromQuery.distinct.isEmpty()) {
+                    return;
+                }
+                const auto& cfq = entry->debugInfo->createdFromQuery;
+                shapes.push_back(
+                    serializeShape(ns, cfq.filter, cfq.sort, cfq.projection, cfq.collation));
+            });
+        }
+    }
+
+    writeShapesFile(dbpath, shapes);
+
+    LOGV2_DEBUG(9437302,
+                1,
+                "Persisted plan cache query shapes",
+                "numShapes"_attr = shapes.size(),
+                "path"_attr = shapesFilePath(dbpath).string());
+    return shapes.size();
+}
+
+void writeShapesFile(const boost::filesystem::path& dbpath, const std::vector<BSONObj>& shapes) {
+    // Write to a temporary file and rename over the previous one so readers never observe a
+    // partially written file.
+    auto finalPath = shapesFilePath(dbpath);
+    auto tmpPath = finalPath;
+    tmpPath += ".tmp";
+    {
+        std::ofstream out(tmpPath.string(), std::ios::binary | std::ios::trunc);
+        uassert(9437300,
+                str::stream() << "Failed to open plan cache shapes file for writing: "
+                              << tmpPath.string(),
+                out.is_open());
+        auto header = BSON("version" << kFormatVersion);
+        out.write(header.objdata(), header.objsize());
+        for (const auto& shape : shapes) {
+            out.write(shape.objdata(), shape.objsize());
+        }
+        out.flush();
+        uassert(9437301,
+                str::stream() << "Failed to write plan cache shapes file: " << tmpPath.string(),
+                out.good());
+    }
+    boost::filesystem::rename(tmpPath, finalPath);
+}
+
+std::vector<BSONObj> loadShapes(const boost::filesystem::path& dbpath) {
+    auto path = shapesFilePath(dbpath);
+    std::ifstream in(path.string(), std::ios::binary);
+    if (!in.is_open()) {
+        return {};
+    }
+    std::string buffer{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+
+    std::vector<BSONObj> shapes;
+    size_t offset = 0;
+    bool sawHeader = false;
+    while (buffer.size() - offset >= sizeof(int32_t)) {
+        auto objSize = static_cast<size_t>(
+            ConstDataView(buffer.data() + offset).read<LittleEndian<int32_t>>());
+        if (objSize < BSONObj::kMinBSONLength || objSize > buffer.size() - offset ||
+            !validateBSON(buffer.data() + offset, objSize).isOK()) {
+            LOGV2_WARNING(9437303,
+                          "Ignoring malformed trailing data in plan cache shapes file",
+                          "path"_attr = path.string(),
+                          "offset"_attr = offset);
+            break;
+        }
+        // The documents point into 'buffer', so they must be copied to own their storage.
+        BSONObj obj = BSONObj(buffer.data() + offset).getOwned();
+        offset += objSize;
+        if (!sawHeader) {
+            sawHeader = true;
+            if (obj.getIntField("version") != kFormatVersion) {
+                LOGV2_WARNING(9437304,
+                              "Ignoring plan cache shapes file with unrecognized version",
+                              "path"_attr = path.string(),
+                              "version"_attr = obj.getIntField("version"));
+                return {};
+            }
+            continue;
+        }
+        shapes.push_back(std::move(obj));
+    }
+    return shapes;
+}
+
+void warmUpFromPersistedShapes(OperationContext* opCtx, const boost::filesystem::path& dbpath) {
+    auto shapes = loadShapes(dbpath);
+    if (shapes.empty()) {
+        return;
+    }
+
+    size_t numReplayed = 0;
+    DBDirectClient client(opCtx);
+    for (const auto& shape : shapes) {
+        try {
+            auto nss = NamespaceStringUtil::deserialize(
+                boost::none, shape.getStringField("ns"), SerializationContext::stateDefault());
+            FindCommandRequest request(nss);
+            request.setFilter(shape.getObjectField("filter").getOwned());
+            request.setSort(shape.getObjectField("sort").getOwned());
+            request.setProjection(shape.getObjectField("projection").getOwned());
+            if (auto collation = shape.getObjectField("collation"); !collation.isEmpty()) {
+                request.setCollation(collation.getOwned());
+            }
+            // One result is enough: plan selection runs when the executor is built, which is
+            // what repopulates the plan cache.
+            request.setLimit(1);
+            request.setSingleBatch(true);
+            client.find(std::move(request));
+            ++numReplayed;
+        } catch (const DBException& ex) {
+            LOGV2_DEBUG(9437305,
+                        1,
+                        "Failed to replay persisted plan cache shape",
+                        "shape"_attr = redact(shape),
+                        "error"_attr = redact(ex));
+        }
+    }
+
+    // Remove the file so shapes from a previous incarnation are never replayed twice; the
+    // periodic job will write a fresh one.
+    boost::system::error_code ec;
+    boost::filesystem::remove(shapesFilePath(dbpath), ec);
+
+    LOGV2(9437306,
+          "Warmed up plan cache from persisted query shapes",
+          "numShapes"_attr = shapes.size(),
+          "numReplayed"_attr = numReplayed);
+}
+
+void startPeriodicShapeDump(ServiceContext* serviceContext) {
+    auto periodicRunner = serviceContext->getPeriodicRunner();
+    invariant(periodicRunner);
+
+    PeriodicRunner::PeriodicJob job(
+        "planCacheShapeDump",
+        [](Client* client) {
+            auto opCtx = client->makeOperationContext();
+            try {
+                dumpShapes(opCtx.get(), boost::filesystem::path(storageGlobalParams.dbpath));
+            } catch (const DBException& ex) {
+                LOGV2_DEBUG(9437307,
+                            1,
+                            "Periodic plan cache shape dump failed",
+                            "error"_attr = redact(ex));
+            }
+        },
+        kDumpInterval,
+        false /*isKillableByStepdown*/);
+
+    auto anchor = periodicRunner->makeJob(std::move(job));
+    anchor.start();
+    periodicShapeDumpAnchor(serviceContext) = std::move(anchor);
+}
+
+}  // namespace mongo::plan_cache_persistence
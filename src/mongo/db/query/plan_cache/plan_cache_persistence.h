@@ -0,0 +1,104 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo::plan_cache_persistence {
+
+/**
+ * Best-effort persistence of plan cache query shapes across mongod restarts.
+ *
+ * Cached plans themselves cannot be serialized, but the query shapes which produced them can.
+ * While the server is running we periodically write the shapes of all classic plan cache entries
+ * to a sidecar file in the dbpath. After a restart the saved shapes are replayed through the
+ * normal find path, which re-runs multiplanning for each shape up front rather than spreading the
+ * repopulation cost over the first minutes of production traffic.
+ *
+ * The whole mechanism is opt-in via the 'internalQueryPersistPlanCacheShapes' server parameter.
+ */
+
+/**
+ * Name of the sidecar file in the dbpath. The file contains a header document followed by one
+ * BSON document per persisted query shape.
+ */
+constexpr StringData kShapesFilename = "plan_cache_shapes.bson"_sd;
+
+/**
+ * Serializes a single plan cache query shape. Exposed for testing.
+ */
+BSONObj serializeShape(StringData ns,
+                       const BSONObj& filter,
+                       const BSONObj& sort,
+                       const BSONObj& projection,
+                       const BSONObj& collation);
+
+/**
+ * Writes 'shapes' to '<dbpath>/plan_cache_shapes.bson', replacing any previous file atomically.
+ */
+void writeShapesFile(const boost::filesystem::path& dbpath, const std::vector<BSONObj>& shapes);
+
+/**
+ * Writes the query shapes of all classic plan cache entries which retain debug info to
+ * '<dbpath>/plan_cache_shapes.bson', replacing any previous file atomically. Shapes belonging to
+ * entries without debug info (large entries do not retain it) and distinct() shapes are skipped.
+ * Returns the number of shapes written.
+ */
+size_t dumpShapes(OperationContext* opCtx, const boost::filesystem::path& dbpath);
+
+/**
+ * Reads persisted shapes back from '<dbpath>/plan_cache_shapes.bson'. Returns an empty vector if
+ * the file does not exist or has an unrecognized format; a truncated file yields the shapes that
+ * could be parsed.
+ */
+std::vector<BSONObj> loadShapes(const boost::filesystem::path& dbpath);
+
+/**
+ * Replays each persisted shape as a limit-1 find through DBDirectClient, repopulating the plan
+ * caches via the regular planning path. Failures for individual shapes (e.g. dropped collections)
+ * are logged and skipped. The shapes file is removed afterwards so stale shapes are never
+ * replayed twice.
+ */
+void warmUpFromPersistedShapes(OperationContext* opCtx, const boost::filesystem::path& dbpath);
+
+/**
+ * Starts the periodic job which dumps plan cache shapes to disk. Must only be called once, after
+ * the storage engine and periodic runner have been initialized.
+ */
+void startPeriodicShapeDump(ServiceContext* serviceContext);
+
+}  // namespace mongo::plan_cache_persistence
@@ -0,0 +1,100 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/plan_cache/plan_cache_persistence.h"
+
+#include <fstream>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo::plan_cache_persistence {
+namespace {
+
+TEST(PlanCachePersistenceTest, WriteAndLoadShapesRoundTrip) {
+    unittest::TempDir tempDir("planCachePersistence");
+    boost::filesystem::path dbpath(tempDir.path());
+
+    std::vector<BSONObj> shapes;
+    shapes.push_back(serializeShape(
+        "test.users", BSON("a" << 1), BSON("b" << 1), BSONObj(), BSON("locale" << "fr")));
+    shapes.push_back(
+        serializeShape("test.orders", BSON("c" << BSON("$gt" << 5)), BSONObj(), BSONObj(), {}));
+    writeShapesFile(dbpath, shapes);
+
+    auto loaded = loadShapes(dbpath);
+    ASSERT_EQ(loaded.size(), 2U);
+    ASSERT_BSONOBJ_EQ(loaded[0], shapes[0]);
+    ASSERT_BSONOBJ_EQ(loaded[1], shapes[1]);
+    ASSERT_EQ(loaded[0].getStringField("ns"), "test.users");
+}
+
+TEST(PlanCachePersistenceTest, LoadShapesMissingFileReturnsEmpty) {
+    unittest::TempDir tempDir("planCachePersistence");
+    ASSERT_TRUE(loadShapes(boost::filesystem::path(tempDir.path())).empty());
+}
+
+TEST(PlanCachePersistenceTest, LoadShapesIgnoresTruncatedTrailingDocument) {
+    unittest::TempDir tempDir("planCachePersistence");
+    boost::filesystem::path dbpath(tempDir.path());
+
+    std::vector<BSONObj> shapes;
+    shapes.push_back(serializeShape("test.a", BSON("x" << 1), BSONObj(), BSONObj(), {}));
+    shapes.push_back(serializeShape("test.b", BSON("y" << 1), BSONObj(), BSONObj(), {}));
+    writeShapesFile(dbpath, shapes);
+
+    // Chop a few bytes off the end of the file, corrupting only the last document.
+    auto path = dbpath / std::string{kShapesFilename};
+    boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 3);
+
+    auto loaded = loadShapes(dbpath);
+    ASSERT_EQ(loaded.size(), 1U);
+    ASSERT_BSONOBJ_EQ(loaded[0], shapes[0]);
+}
+
+TEST(PlanCachePersistenceTest, LoadShapesRejectsUnrecognizedVersion) {
+    unittest::TempDir tempDir("planCachePersistence");
+    boost::filesystem::path dbpath(tempDir.path());
+
+    auto path = dbpath / std::string{kShapesFilename};
+    auto header = BSON("version" << 999);
+    auto shape = serializeShape("test.a", BSON("x" << 1), BSONObj(), BSONObj(), {});
+    std::ofstream out(path.string(), std::ios::binary);
+    out.write(header.objdata(), header.objsize());
+    out.write(shape.objdata(), shape.objsize());
+    out.close();
+
+    ASSERT_TRUE(loadShapes(dbpath).empty());
+}
+
+}  // namespace
+}  // namespace mongo::plan_cache_persistence
@@ -381,6 +381,24 @@ TEST_F(PlanCacheTest, InactiveEntriesDisabled) {
     ASSERT_EQ(planCache.get(key).state, PlanCache::CacheEntryState::kNotPresent);
 }
 
+TEST_F(PlanCacheTest, PartitionStatsTrackHitsAndMisses) {
+    PlanCache planCache(5000);
+    ASSERT_EQ(planCache.numPartitions(), 1U);
+
+    std::unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
+    auto key = makeKey(*cq);
+
+    ASSERT_EQ(planCache.get(key).state, PlanCache::CacheEntryState::kNotPresent);
+    const auto missesBeforeAdd = planCache.partitionStats(0).misses.load();
+    ASSERT_GTE(missesBeforeAdd, 1);
+    ASSERT_EQ(planCache.partitionStats(0).hits.load(), 0);
+
+    addCacheEntryForShape(*cq.get(), &planCache);
+    ASSERT_EQ(planCache.get(key).state, PlanCache::CacheEntryState::kPresentInactive);
+    ASSERT_EQ(planCache.get(key).state, PlanCache::CacheEntryState::kPresentInactive);
+    ASSERT_EQ(planCache.partitionStats(0).hits.load(), 2);
+}
+
 TEST_F(PlanCacheTest, PlanCacheLRUPolicyRemovesInactiveEntries) {
     // Use a tiny cache size.
     const size_t kCacheSize = 2;
@@ -33,6 +33,7 @@
 #include <absl/container/node_hash_map.h>
 
 #include "mongo/base/status_with.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/query/plan_cache/sbe_plan_cache_on_parameter_change.h"
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/util/memory_util.h"
@@ -93,9 +94,59 @@ ServiceContext::ConstructorActionRegisterer planCacheRegisterer{
                         "cappedSize"_attr = cappedCacheSize);
         }
         auto& globalPlanCache = sbePlanCacheDecoration(serviceCtx);
-        globalPlanCache = std::make_unique<sbe::PlanCache>(cappedCacheSize, 32);
+        globalPlanCache = std::make_unique<sbe::PlanCache>(
+            cappedCacheSize, static_cast<size_t>(planCacheNumPartitions));
     }};
 
+/**
+ * Reports per-partition lookup counters and size estimates for the SBE plan cache. Not included
+ * by default; request it with {serverStatus: 1, planCachePartitions: 1} when sizing
+ * 'planCacheNumPartitions' for a workload.
+ */
+class PlanCachePartitionsServerStatusSection final : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        auto& planCache = getPlanCache(opCtx);
+
+        BSONObjBuilder bob;
+        bob.appendNumber("numPartitions", static_cast<long long>(planCache.numPartitions()));
+
+        long long totalHits = 0;
+        long long totalMisses = 0;
+        BSONArrayBuilder partitionsBob(bob.subarrayStart("partitions"));
+        for (size_t partitionId = 0; partitionId < planCache.numPartitions(); ++partitionId) {
+            const auto& stats = planCache.partitionStats(partitionId);
+            const auto hits = stats.hits.loadRelaxed();
+            const auto misses = stats.misses.loadRelaxed();
+            totalHits += hits;
+            totalMisses += misses;
+
+            BSONObjBuilder partitionBob(partitionsBob.subobjStart());
+            partitionBob.appendNumber("hits", hits);
+            partitionBob.appendNumber("misses", misses);
+            partitionBob.appendNumber(
+                "sizeEstimateBytes",
+                static_cast<long long>(planCache.getPartition(partitionId)->size()));
+        }
+        partitionsBob.doneFast();
+
+        bob.appendNumber("totalHits", totalHits);
+        bob.appendNumber("totalMisses", totalMisses);
+        return bob.obj();
+    }
+};
+
+auto& planCachePartitionsServerStatusSection =
+    *ServerStatusSectionBuilder<PlanCachePartitionsServerStatusSection>("planCachePartitions")
+         .forShard();
+
 }  // namespace
 
 sbe::PlanCache& getPlanCache(ServiceContext* serviceCtx) {
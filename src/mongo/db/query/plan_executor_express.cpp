@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <boost/optional/optional.hpp>
 #include <fmt/format.h>
 #include <memory>
@@ -165,7 +166,8 @@ public:
                         typename Plan::CollectionType coll,
                         Plan plan,
                         const express::ExceptionRecoveryPolicy* recoveryPolicy,
-                        bool returnOwnedBson);
+                        bool returnOwnedBson,
+                        std::unique_ptr<projection_ast::Projection> ownedProjection = nullptr);
 
     CanonicalQuery* getCanonicalQuery() const override {
         return _cq.get();
@@ -332,6 +334,11 @@ private:
 
     OperationContext* _opCtx;
     std::unique_ptr<CanonicalQuery> _cq;
+
+    // Write executors have no CanonicalQuery to own their projection, so the executor owns it
+    // directly to keep the plan's raw projection pointer valid.
+    std::unique_ptr<projection_ast::Projection> _ownedProjection;
+
     NamespaceString _nss;  // Copied from _cq.
 
     mongo::CommonStats _commonStats;
@@ -363,9 +370,11 @@ PlanExecutorExpress<Plan>::PlanExecutorExpress(
     typename Plan::CollectionType collection,
     Plan plan,
     const express::ExceptionRecoveryPolicy* recoveryPolicy,
-    bool returnOwnedBson)
+    bool returnOwnedBson,
+    std::unique_ptr<projection_ast::Projection> ownedProjection)
     : _opCtx(opCtx),
       _cq(std::move(cq)),
+      _ownedProjection(std::move(ownedProjection)),
       _nss(express::accessCollection(collection).ns()),
       _commonStats("EXPRESS"),
       _planExplainer(&_commonStats, &_planStats, &_iteratorStats, &_writeOperationStats),
@@ -619,6 +628,30 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
         coll.get());
 }
 
+namespace {
+/**
+ * Returns true if the query's projection can be answered entirely from the key of 'index', so the
+ * express executor can skip fetching the document. Requires an inclusion projection whose fields
+ * are all top-level components of a non-multikey, non-collated index's key pattern.
+ */
+bool isProjectionCoveredByIndex(const CanonicalQuery& cq, const IndexEntry& index) {
+    const auto* proj = cq.getProj();
+    if (!proj || !proj->isSimple() || !proj->isInclusionOnly()) {
+        return false;
+    }
+    // Multikey index keys do not round-trip to the original document shape, and keys of an index
+    // with a collation store sort keys rather than the original values.
+    if (index.multikey || index.collator) {
+        return false;
+    }
+    const auto& requiredFields = proj->getRequiredFields();
+    return std::all_of(requiredFields.begin(), requiredFields.end(), [&](const auto& field) {
+        auto keyElt = index.keyPattern[field];
+        return !keyElt.eoo() && field.find('.') == std::string::npos;
+    });
+}
+}  // namespace
+
 std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindByUserIndex(
     OperationContext* opCtx,
     std::unique_ptr<CanonicalQuery> cq,
@@ -636,6 +669,9 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
                         index.toString()),
             indexDescriptor);
 
+    // Shard filtering requires the full document, so only skip the fetch when there is no filter.
+    const bool coveredProjection = !collectionFilter && isProjectionCoveredByIndex(*cq, index);
+
     return std::visit(
         [&](auto collectionAlternative) {
             const CollatorInterface* collator = cq->getCollator();
@@ -647,7 +683,8 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
                                            queryFilter,
                                            indexDescriptor->getEntry()->getIdent(),
                                            index.identifier.catalogName,
-                                           collator),
+                                           collator,
+                                           coveredProjection),
                                        express::NoWriteOperation(),
                                        std::move(cq),
                                        collectionAlternative,
@@ -683,7 +720,8 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForUpdat
     OperationContext* opCtx,
     CollectionAcquisition collection,
     ParsedUpdate* parsedUpdate,
-    bool returnOwnedBson) {
+    bool returnOwnedBson,
+    std::unique_ptr<projection_ast::Projection> projection) {
 
     const UpdateRequest* request = parsedUpdate->getRequest();
 
@@ -724,27 +762,45 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForUpdat
         }
     }();
 
+    using Projection = std::variant<express::IdentityProjection, const projection_ast::Projection*>;
+    Projection projectionChoice((express::IdentityProjection()));
+    if (projection) {
+        tassert(9876518,
+                "Express update executor only supports simple projections",
+                projection->isSimple());
+        projectionChoice = projection.get();
+    }
+
     fastPathQueryCounters.incrementExpressQueryCounter();
     auto recoveryPolicy = getExpressRecoveryPolicy(opCtx, parsedUpdate->yieldPolicy());
 
     return std::visit(
         [&](auto chosenIterator,
-            auto chosenShardFilter) -> std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> {
+            auto chosenShardFilter,
+            auto chosenProjection) -> std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> {
             auto plan = express::ExpressPlan(std::move(chosenIterator),
                                              std::move(writeOperation),
                                              std::move(chosenShardFilter),
-                                             express::IdentityProjection());
-            return {
-                new PlanExecutorExpress(
-                    opCtx, nullptr, collection, std::move(plan), recoveryPolicy, returnOwnedBson),
-                PlanExecutor::Deleter(opCtx)};
+                                             std::move(chosenProjection));
+            return {new PlanExecutorExpress(opCtx,
+                                            nullptr,
+                                            collection,
+                                            std::move(plan),
+                                            recoveryPolicy,
+                                            returnOwnedBson,
+                                            std::move(projection)),
+                    PlanExecutor::Deleter(opCtx)};
         },
         std::move(iterator),
-        std::move(shardFilter));
+        std::move(shardFilter),
+        std::move(projectionChoice));
 }
 
 std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForDelete(
-    OperationContext* opCtx, CollectionAcquisition collection, ParsedDelete* parsedDelete) {
+    OperationContext* opCtx,
+    CollectionAcquisition collection,
+    ParsedDelete* parsedDelete,
+    std::unique_ptr<projection_ast::Projection> projection) {
     const DeleteRequest* request = parsedDelete->getRequest();
 
     using Iterator = std::variant<express::IdLookupViaIndex<CollectionAcquisition>,
@@ -792,28 +848,40 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForDelet
         }
     }();
 
+    using Projection = std::variant<express::IdentityProjection, const projection_ast::Projection*>;
+    Projection projectionChoice((express::IdentityProjection()));
+    if (projection) {
+        tassert(9876519,
+                "Express delete executor only supports simple projections",
+                projection->isSimple());
+        projectionChoice = projection.get();
+    }
+
     fastPathQueryCounters.incrementExpressQueryCounter();
     auto recoveryPolicy = getExpressRecoveryPolicy(opCtx, parsedDelete->yieldPolicy());
 
     return std::visit(
         [&](auto chosenIterator,
             auto chosenWriteOperation,
-            auto chosenShardFilter) -> std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> {
+            auto chosenShardFilter,
+            auto chosenProjection) -> std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> {
             auto plan = express::ExpressPlan(std::move(chosenIterator),
                                              std::move(chosenWriteOperation),
                                              std::move(chosenShardFilter),
-                                             express::IdentityProjection());
+                                             std::move(chosenProjection));
             return {new PlanExecutorExpress(opCtx,
                                             nullptr /* cq */,
                                             collection,
                                             std::move(plan),
                                             recoveryPolicy,
-                                            false /* returnOwnedBson */),
+                                            false /* returnOwnedBson */,
+                                            std::move(projection)),
                     PlanExecutor::Deleter(opCtx)};
         },
         std::move(iterator),
         std::move(writeOperation),
-        std::move(shardFilter));
+        std::move(shardFilter),
+        std::move(projectionChoice));
 }
 
 boost::optional<IndexEntry> getIndexForExpressEquality(const CanonicalQuery& cq,
@@ -33,6 +33,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/index_entry.h"
 #include "mongo/db/query/plan_executor.h"
+#include "mongo/db/query/projection.h"
 #include "mongo/db/query/query_planner_params.h"
 #include "mongo/db/query/write_ops/parsed_delete.h"
 #include "mongo/db/query/write_ops/parsed_update.h"
@@ -63,14 +64,26 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
     boost::optional<ScopedCollectionFilter> collectionFilter,
     bool returnOwnedBson);
 
+/**
+ * 'projection', if provided, must be a simple projection (see Projection::isSimple()); the
+ * executor applies it to the returned document and takes ownership of it.
+ */
 std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForUpdate(
     OperationContext* opCtx,
     CollectionAcquisition collection,
     ParsedUpdate* parsedUpdate,
-    bool returnOwnedBson);
+    bool returnOwnedBson,
+    std::unique_ptr<projection_ast::Projection> projection = nullptr);
 
+/**
+ * 'projection', if provided, must be a simple projection (see Projection::isSimple()); the
+ * executor applies it to the deleted document and takes ownership of it.
+ */
 std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForDelete(
-    OperationContext* opCtx, CollectionAcquisition collection, ParsedDelete* parsedDelete);
+    OperationContext* opCtx,
+    CollectionAcquisition collection,
+    ParsedDelete* parsedDelete,
+    std::unique_ptr<projection_ast::Projection> projection = nullptr);
 
 /**
  * Tries to find an index suitable for use in the express equality path. Excludes indexes which
@@ -693,7 +693,8 @@ UpdateResult PlanExecutorImpl::getUpdateResult() const {
                 stats.objInserted /* objInserted */,
                 static_cast<TimeseriesModifyStage*>(updateStage)->containsDotsAndDollarsField());
         }
-        case StageType::STAGE_UPDATE: {
+        case StageType::STAGE_UPDATE:
+        case StageType::STAGE_BATCHED_UPDATE: {
             const auto& stats = static_cast<const UpdateStats&>(*updateStage->getSpecificStats());
             return updateStatsToResult(
                 stats, static_cast<UpdateStage*>(updateStage)->containsDotsAndDollarsField());
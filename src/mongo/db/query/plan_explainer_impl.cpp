@@ -611,7 +611,7 @@ void statsToBSON(const stage_builder::PlanStageToQsnMap& planStageQsnMap,
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
             bob->appendNumber("nBucketsUnpacked", static_cast<long long>(spec->nBucketsUnpacked));
         }
-    } else if (STAGE_UPDATE == stats.stageType) {
+    } else if (STAGE_UPDATE == stats.stageType || STAGE_BATCHED_UPDATE == stats.stageType) {
         UpdateStats* spec = static_cast<UpdateStats*>(stats.specific.get());
 
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
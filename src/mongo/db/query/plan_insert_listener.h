@@ -84,10 +84,14 @@ public:
     void prepareForWait(OperationContext* opCtx) final {
         invariant(_notifier);
         _currentVersion = _notifier->getVersion();
+        // Remember the timestamp the preceding read was performed at, if any. Notifications for
+        // data that was already visible at this timestamp need not end the wait.
+        _lastReadTimestamp =
+            shard_role_details::getRecoveryUnit(opCtx)->getPointInTimeReadTimestamp();
     }
 
     void waitUntil(OperationContext* opCtx, Date_t deadline) final {
-        _notifier->waitUntil(opCtx, _lastEOFVersion, deadline);
+        _notifier->waitUntil(opCtx, _lastEOFVersion, deadline, _lastReadTimestamp);
     }
 
     void doneWaiting(OperationContext* opCtx) final {
@@ -99,6 +103,8 @@ private:
     uint64_t _lastEOFVersion = ~uint64_t(0);
     // This will be initialized by prepareForWait.
     uint64_t _currentVersion;
+    // The point-in-time read timestamp of the last EOF read, if the operation reads at one.
+    boost::optional<Timestamp> _lastReadTimestamp;
 };
 
 // Class used to notify listeners on majority committed point advancement events.
@@ -29,7 +29,6 @@
 
 #include "rate_limiting.h"
 
-#include "mongo/stdx/mutex.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/system_clock_source.h"
 
@@ -40,59 +39,69 @@ RateLimiting::RateLimiting(RequestCount samplingRate,
     : _clockSource(clockSource != nullptr ? clockSource : SystemClockSource::get()),
       _samplingRate(samplingRate),
       _timePeriod(timePeriod),
-      _windowStart(_clockSource->now()),
+      _windowStartMillis(_clockSource->now().toMillisSinceEpoch()),
       _prevCount(0),
       _currentCount(0) {}
 
 Date_t RateLimiting::tickWindow() {
     Date_t currentTime = _clockSource->now();
 
-    // Elapsed time since window start exceeds the time period. Start a new window.
-    if (currentTime - _windowStart > _timePeriod) {
-        _windowStart = currentTime;
-        _prevCount = _currentCount;
-        _currentCount = 0;
+    // Elapsed time since window start exceeds the time period. Start a new window. Many threads
+    // may notice the expiry concurrently; the one that wins the CAS rolls the counters over.
+    // Requests racing with the rollover may be attributed to either window, which is acceptable
+    // since this rate limiter is approximate by design.
+    auto windowStartMillis = _windowStartMillis.load();
+    if (currentTime.toMillisSinceEpoch() - windowStartMillis > _timePeriod.count() &&
+        _windowStartMillis.compareAndSwap(&windowStartMillis, currentTime.toMillisSinceEpoch())) {
+        _prevCount.store(_currentCount.swap(0));
     }
     return currentTime;
 }
 
+bool RateLimiting::tryAdmit(double estimatedRemaining) {
+    auto samplingRate = _samplingRate.load();
+
+    // Fast path: when the window is already full, reject without writing to shared state so that
+    // rate limited requests do not contend on the counter's cache line.
+    if (_currentCount.load() + estimatedRemaining >= samplingRate) {
+        return false;
+    }
+
+    // Claim a slot, then re-check the bound: another thread may have taken the last slot between
+    // the load above and our increment. If so, give the slot back.
+    auto countBefore = _currentCount.fetchAndAdd(1);
+    if (countBefore + estimatedRemaining >= samplingRate) {
+        _currentCount.fetchAndSubtract(1);
+        return false;
+    }
+    return true;
+}
+
 bool RateLimiting::handleRequestFixedWindow() {
-    stdx::unique_lock windowLock{_windowMutex};
     tickWindow();
 
-    if (_currentCount < _samplingRate.load()) {
-        _currentCount += 1;
-        return true;
-    }
-    return false;
+    return tryAdmit(0);
 }
 
 bool RateLimiting::handleRequestSlidingWindow() {
-    stdx::unique_lock windowLock{_windowMutex};
-
     Date_t currentTime = tickWindow();
-    auto windowStart = _windowStart;
-    auto prevCount = _prevCount;
+    auto windowStartMillis = _windowStartMillis.load();
+    auto prevCount = _prevCount.load();
 
     // Sliding window is implemented over fixed size time periods/blocks as follows. Instead of
-    // making the decision to limit the rate using only the current time period, we look to the rate
+    // making the decision to limit the rate using only the current time block, we look to the rate
     // of the previous period to predicate the rate of the current. This smooths the "sampling" of
     // the events by predicting a constant rate and limiting accordingly.
 
     // Percentage of time remaining in current window.
     double percentRemainingOfCurrentWindow =
-        ((double)(_timePeriod.count() - (currentTime - windowStart).count())) / _timePeriod.count();
+        ((double)(_timePeriod.count() - (currentTime.toMillisSinceEpoch() - windowStartMillis))) /
+        _timePeriod.count();
     // Estimate the number of requests remaining in the current period. We assume the requests in
     // the previous time block occurred at a constant rate. We multiply the total number of requests
     // in the previous period by the percentage of time remaining in the current period.
     double estimatedRemaining = prevCount * percentRemainingOfCurrentWindow;
-    // Add this estimate to the requests we know have taken place within the current time block.
-    double estimatedCount = _currentCount + estimatedRemaining;
 
-    if (estimatedCount < _samplingRate.load()) {
-        _currentCount += 1;
-        return true;
-    }
-    return false;
+    return tryAdmit(estimatedRemaining);
 }
 }  // namespace mongo
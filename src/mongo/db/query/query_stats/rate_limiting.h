@@ -30,10 +30,8 @@
 #pragma once
 
 #include <cstdint>
-#include <mutex>
 
 #include "mongo/platform/atomic_word.h"
-#include "mongo/stdx/mutex.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/system_clock_source.h"
@@ -43,8 +41,13 @@ namespace mongo {
 
 /**
  * Rate limiting is used to put a bound on the number of requests to a certain resource over a fixed
- * time window. This implementation is approximate in the sense that it may permit the bound to
+ * time window. This implementation is approximate in the sense that it may permit the bound to be
  * exceeded. The bound is approximate as a trade off to reduce contention on internal resources.
+ *
+ * The implementation is lock-free: all state is kept in atomics so that this can sit on the hot
+ * path of every request under high concurrency. In particular, once the limit for the current
+ * window has been reached, rejected requests pay only a handful of atomic loads and do not write
+ * to shared state at all.
  */
 class RateLimiting {
     using RequestCount = uint32_t;
@@ -90,10 +93,20 @@ public:
 private:
     /*
      * Resets the current window if it has ended. Returns the current time. This must be called in
-     * the beginning of each handleRequest...() method.
+     * the beginning of each handleRequest...() method. Many threads may call this concurrently;
+     * only the one that wins the CAS on the window start rolls the counters over.
      */
     Date_t tickWindow();
 
+    /*
+     * Attempts to claim a slot in the current window. The caller passes an estimate of how many
+     * additional requests, beyond the ones counted in '_currentCount', should be attributed to the
+     * window (zero for the fixed window; the carry-over from the previous window for the sliding
+     * window). The claim is checked again after the increment so that the number of admitted
+     * requests never exceeds the configured bound due to a concurrent race.
+     */
+    bool tryAdmit(double estimatedRemaining);
+
     /*
      * Clock source used to track time.
      */
@@ -110,23 +123,18 @@ private:
     const Milliseconds _timePeriod;
 
     /*
-     * Window start.
+     * Window start, expressed as milliseconds since epoch so it can be stored atomically.
      */
-    Date_t _windowStart;
+    AtomicWord<long long> _windowStartMillis;
 
     /*
      * Count of requests handled in the previous window.
      */
-    RequestCount _prevCount;
+    AtomicWord<RequestCount> _prevCount;
 
     /*
      * Count of requests handled in the current window.
      */
-    RequestCount _currentCount;
-
-    /*
-     * Mutex used when reading/writing the window.
-     */
-    stdx::mutex _windowMutex;
+    AtomicWord<RequestCount> _currentCount;
 };
 }  // namespace mongo
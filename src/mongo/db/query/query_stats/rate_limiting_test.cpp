@@ -30,8 +30,11 @@
 #include "mongo/db/query/query_stats/rate_limiting.h"
 
 #include <memory>
+#include <vector>
 
 #include "mongo/base/string_data.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/time_support.h"
@@ -78,4 +81,31 @@ TEST(RateLimitingTest, FixedWindowPermitsRequestAfterWindowExpires) {
     ASSERT_TRUE(rl.handleRequestFixedWindow());
 }
 
+TEST(RateLimitingTest, FixedWindowEnforcesBoundUnderConcurrency) {
+    constexpr uint32_t samplingRate = 100;
+    constexpr size_t numThreads = 8;
+    constexpr size_t requestsPerThread = 1000;
+
+    auto rl = RateLimiting(samplingRate, Hours{1});
+
+    AtomicWord<uint32_t> admitted{0};
+    std::vector<stdx::thread> threads;
+    for (size_t i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&] {
+            for (size_t j = 0; j < requestsPerThread; ++j) {
+                if (rl.handleRequestFixedWindow()) {
+                    admitted.fetchAndAdd(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // The window never rolls over during the test, so exactly 'samplingRate' requests must have
+    // been admitted no matter how the threads interleave.
+    ASSERT_EQ(samplingRate, admitted.load());
+}
+
 }  // namespace mongo
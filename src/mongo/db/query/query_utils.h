@@ -74,7 +74,8 @@ inline bool isIdHackEligibleQuery(const CollectionPtr& collection, const Canonic
 /**
  * Returns 'true' if 'query' on the given 'collection' can be answered using a special IXSCAN +
  * FETCH plan. Among other restrictions, the query must be a single-field equality generating exact
- * bounds.
+ * bounds. A simple projection is permitted; the express executor applies it after the lookup, and
+ * can skip the FETCH entirely when the projection is covered by the chosen index.
  */
 inline bool isEqualityExpressEligibleQuery(const CollectionPtr& collection,
                                            const CanonicalQuery& cq) {
@@ -86,10 +87,11 @@ inline bool isEqualityExpressEligibleQuery(const CollectionPtr& collection,
     }
 
     return
-        // Properties of the find command.
+        // Properties of the find command. Note that the caller ('isExpressEligible') rejects
+        // non-simple projections before this function is consulted.
         !findCommand.getShowRecordId() && findCommand.getHint().isEmpty() &&
         findCommand.getMin().isEmpty() && findCommand.getMax().isEmpty() &&
-        findCommand.getProjection().isEmpty() && findCommand.getSort().isEmpty() &&
+        findCommand.getSort().isEmpty() &&
         !findCommand.getSkip() && !findCommand.getTailable() &&
         // Properties of the query's match expression.
         me->matchType() == MatchExpression::EQ &&
@@ -477,6 +477,7 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
                 return mockStage;
             }
             case STAGE_BATCHED_DELETE:
+            case STAGE_BATCHED_UPDATE:
             case STAGE_CACHED_PLAN:
             case STAGE_COUNT:
             case STAGE_DELETE:
@@ -57,6 +57,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/dependencies.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/record_id_bound.h"
 #include "mongo/db/query/stage_builder/sbe/builder.h"
 #include "mongo/db/query/stage_builder/sbe/gen_coll_scan.h"
@@ -350,6 +351,59 @@ std::pair<SbStage, PlanStageSlots> generateClusteredCollScan(
     return {std::move(stage), std::move(outputs)};
 }  // generateClusteredCollScan
 
+/**
+ * Generates a parallel collection scan sub-tree: a ParallelScanStage that partitions the RecordId
+ * space into ranges handed out to producer threads, each with its own storage cursor, beneath an
+ * ExchangeConsumer that merges the producers' output into this thread's plan. The filter, if any,
+ * is placed below the exchange so that pushed-down $match predicates are evaluated on the producer
+ * side.
+ */
+std::pair<SbStage, PlanStageSlots> generateParallelCollScan(StageBuilderState& state,
+                                                            const CollectionPtr& collection,
+                                                            const CollectionScanNode* csn,
+                                                            std::vector<std::string> fields,
+                                                            sbe::ScanCallbacks callbacks) {
+    SbBuilder b(state, csn->nodeId());
+
+    auto [stage, resultSlot, recordIdSlot, fieldSlots] =
+        b.makeParallelScan(collection->uuid(), collection->ns().dbName(), fields,
+                           std::move(callbacks));
+
+    PlanStageSlots outputs;
+    outputs.setResultObj(resultSlot);
+    outputs.set(PlanStageSlots::kRecordId, recordIdSlot);
+    for (size_t i = 0; i < fields.size(); ++i) {
+        outputs.set(std::make_pair(PlanStageSlots::kField, fields[i]), fieldSlots[i]);
+    }
+
+    if (csn->filter) {
+        // 'stopApplyingFilterAfterFirstMatch' is only for oplog scans, which are not eligible for
+        // a parallel scan.
+        invariant(!csn->stopApplyingFilterAfterFirstMatch);
+
+        auto filterExpr = generateFilter(state, csn->filter.get(), resultSlot, outputs);
+        if (!filterExpr.isNull()) {
+            stage = b.makeFilter(std::move(stage), std::move(filterExpr));
+        }
+    }
+
+    // Ship the result object, the RecordId, and the scanned fields through the exchange so they
+    // remain accessible to the consumer side of the plan.
+    SbSlotVector exchangeFields;
+    exchangeFields.reserve(fieldSlots.size() + 2);
+    exchangeFields.emplace_back(resultSlot);
+    exchangeFields.emplace_back(recordIdSlot);
+    for (const auto& slot : fieldSlots) {
+        exchangeFields.emplace_back(slot);
+    }
+
+    stage = b.makeExchangeConsumer(std::move(stage),
+                                   static_cast<size_t>(internalQueryParallelScanNumProducers.load()),
+                                   exchangeFields);
+
+    return {std::move(stage), std::move(outputs)};
+}  // generateParallelCollScan
+
 /**
  * Generates a generic collection scan sub-tree.
  *  - If a resume token has been provided, the scan will start from a RecordId contained within this
@@ -384,6 +438,15 @@ std::pair<SbStage, PlanStageSlots> generateGenericCollScan(StageBuilderState& st
 
     sbe::ScanCallbacks callbacks({}, {}, makeOpenCallbackIfNeeded(collection, csn));
 
+    // A forward scan with no resume point and no oplog bookkeeping can run as a parallel scan
+    // when the 'internalQueryAllowParallelCollectionScan' knob is set.
+    if (internalQueryAllowParallelCollectionScan.load() && forward && !csn->tailable &&
+        !isResumingTailableScan && !csn->resumeScanPoint && !csn->shouldTrackLatestOplogTimestamp &&
+        !csn->stopApplyingFilterAfterFirstMatch) {
+        return generateParallelCollScan(
+            state, collection, csn, std::move(fields), std::move(callbacks));
+    }
+
     SbStage resumeRecordIdTree;
     boost::optional<SbSlot> seekSlot;
     bool tolerateKeyNotFound = false;
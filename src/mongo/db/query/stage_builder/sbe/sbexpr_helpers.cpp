@@ -33,6 +33,7 @@
 #include "mongo/db/exec/sbe/stages/block_to_row.h"
 #include "mongo/db/exec/sbe/stages/branch.h"
 #include "mongo/db/exec/sbe/stages/co_scan.h"
+#include "mongo/db/exec/sbe/stages/exchange.h"
 #include "mongo/db/exec/sbe/stages/hash_join.h"
 #include "mongo/db/exec/sbe/stages/hash_lookup.h"
 #include "mongo/db/exec/sbe/stages/hash_lookup_unwind.h"
@@ -423,6 +424,50 @@ std::tuple<SbStage, SbSlot, SbSlot, SbSlotVector> SbBuilder::makeScan(
     return {std::move(scanStage), resultSlot, recordIdSlot, std::move(scanFieldSlots)};
 }
 
+std::tuple<SbStage, SbSlot, SbSlot, SbSlotVector> SbBuilder::makeParallelScan(
+    UUID collectionUuid,
+    DatabaseName dbName,
+    std::vector<std::string> scanFieldNames,
+    sbe::ScanCallbacks scanCallbacks) {
+    auto resultSlot = SbSlot{_state.slotId()};
+    auto recordIdSlot = SbSlot{_state.slotId()};
+
+    SbSlotVector scanFieldSlots;
+    scanFieldSlots.reserve(scanFieldNames.size());
+
+    for (size_t i = 0; i < scanFieldNames.size(); ++i) {
+        scanFieldSlots.emplace_back(SbSlot{_state.slotId()});
+    }
+
+    auto scanStage = sbe::makeS<sbe::ParallelScanStage>(collectionUuid,
+                                                        std::move(dbName),
+                                                        lower(resultSlot),
+                                                        lower(recordIdSlot),
+                                                        boost::none /* snapshotIdSlot */,
+                                                        boost::none /* indexIdentSlot */,
+                                                        boost::none /* indexKeySlot */,
+                                                        boost::none /* indexKeyPatternSlot */,
+                                                        std::move(scanFieldNames),
+                                                        lower(scanFieldSlots),
+                                                        _state.yieldPolicy,
+                                                        _nodeId,
+                                                        std::move(scanCallbacks));
+
+    return {std::move(scanStage), resultSlot, recordIdSlot, std::move(scanFieldSlots)};
+}
+
+SbStage SbBuilder::makeExchangeConsumer(SbStage stage,
+                                        size_t numOfProducers,
+                                        const SbSlotVector& fields) {
+    return sbe::makeS<sbe::ExchangeConsumer>(std::move(stage),
+                                             numOfProducers,
+                                             lower(fields),
+                                             sbe::ExchangePolicy::roundrobin,
+                                             nullptr /* partition */,
+                                             nullptr /* orderLess */,
+                                             _nodeId);
+}
+
 std::tuple<SbStage, SbSlot, SbSlotVector, SbIndexInfoSlots> SbBuilder::makeSimpleIndexScan(
     const VariableTypes& varTypes,
     UUID collectionUuid,
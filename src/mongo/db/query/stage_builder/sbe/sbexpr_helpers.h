@@ -313,6 +313,16 @@ public:
         sbe::ScanCallbacks scanCallbacks = {},
         boost::optional<SbSlot> oplogTsSlot = boost::none);
 
+    std::tuple<SbStage, SbSlot, SbSlot, SbSlotVector> makeParallelScan(
+        UUID collectionUuid,
+        DatabaseName dbName,
+        std::vector<std::string> scanFieldNames = {},
+        sbe::ScanCallbacks scanCallbacks = {});
+
+    SbStage makeExchangeConsumer(SbStage stage,
+                                 size_t numOfProducers,
+                                 const SbSlotVector& fields);
+
     std::tuple<SbStage, SbSlot, SbSlotVector, SbIndexInfoSlots> makeSimpleIndexScan(
         UUID collectionUuid,
         DatabaseName dbName,
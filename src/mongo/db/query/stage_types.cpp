@@ -41,6 +41,8 @@ StringData nodeStageTypeToString(const QuerySolutionNode* node) {
             return "AND_SORTED"_sd;
         case STAGE_BATCHED_DELETE:
             return "BATCHED_DELETE"_sd;
+        case STAGE_BATCHED_UPDATE:
+            return "BATCHED_UPDATE"_sd;
         case STAGE_CACHED_PLAN:
             return "CACHED_PLAN"_sd;
         case STAGE_COLLSCAN: {
@@ -54,6 +54,11 @@ public:
     virtual void addHistogram(const std::string& path,
                               std::shared_ptr<const CEHistogram> histogram) const = 0;
 
+    /**
+     * Returns the namespace of the collection these statistics describe.
+     */
+    virtual const NamespaceString& getNss() const = 0;
+
     virtual ~CollectionStatistics() = default;
 };
 
@@ -48,6 +48,10 @@ double CollectionStatisticsImpl::getCardinality() const {
     return _cardinality;
 }
 
+const NamespaceString& CollectionStatisticsImpl::getNss() const {
+    return _nss;
+}
+
 void CollectionStatisticsImpl::addHistogram(const std::string& path,
                                             std::shared_ptr<const CEHistogram> histogram) const {
     _histograms[path] = histogram;
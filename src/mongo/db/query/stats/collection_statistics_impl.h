@@ -61,6 +61,11 @@ public:
     void addHistogram(const std::string& path,
                       std::shared_ptr<const CEHistogram> histogram) const override;
 
+    /**
+     * Returns the namespace of the collection these statistics describe.
+     */
+    const NamespaceString& getNss() const override;
+
     ~CollectionStatisticsImpl() override = default;
 
 private:
@@ -35,7 +35,9 @@
 namespace mongo::stats {
 
 CollectionStatisticsMock::CollectionStatisticsMock(double cardinality)
-    : _cardinality{cardinality}, _histograms{} {};
+    : _cardinality{cardinality},
+      _histograms{},
+      _nss{NamespaceString::createNamespaceString_forTest("test.statsMock")} {};
 
 double CollectionStatisticsMock::getCardinality() const {
     return _cardinality;
@@ -53,4 +55,8 @@ const CEHistogram* CollectionStatisticsMock::getHistogram(const std::string& pat
     return nullptr;
 }
 
+const NamespaceString& CollectionStatisticsMock::getNss() const {
+    return _nss;
+}
+
 }  // namespace mongo::stats
@@ -58,11 +58,17 @@ public:
      */
     const CEHistogram* getHistogram(const std::string& path) const override;
 
+    /**
+     * Returns a fixed test namespace.
+     */
+    const NamespaceString& getNss() const override;
+
     ~CollectionStatisticsMock() override = default;
 
 private:
     double _cardinality;
     mutable Histograms _histograms;
+    NamespaceString _nss;
 };
 
 }  // namespace mongo::stats
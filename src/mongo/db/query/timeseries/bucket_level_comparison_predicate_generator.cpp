@@ -39,8 +39,10 @@
 #include "mongo/db/matcher/expression_expr.h"
 #include "mongo/db/matcher/expression_internal_expr_comparison.h"
 #include "mongo/db/matcher/expression_leaf.h"
+#include "mongo/db/matcher/expression_tree.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
+#include "mongo/db/timeseries/timeseries_gen.h"
 #include "mongo/db/timeseries/timeseries_options.h"
 
 
@@ -209,6 +211,24 @@ std::unique_ptr<MatchExpression> createTypeEqualityPredicate(
     return makeOr(std::move(typeEqualityPredicates));
 }
 
+/**
+ * Creates a predicate against the optional 'control.distinct.<field>' summary, which lists every
+ * distinct value of the field in the bucket. A bucket whose summary exists but does not contain the
+ * queried value cannot contain a matching event, even when the control min/max range straddles the
+ * value. Buckets without a summary must be kept, hence the $exists branch.
+ */
+std::unique_ptr<MatchExpression> createDistinctSummaryPredicate(StringData matchExprPath,
+                                                                const BSONElement& matchExprData) {
+    auto distinctPath = std::string{timeseries::kControlDistinctFieldNamePrefix} + matchExprPath;
+    const StringData distinctPathStringData(distinctPath);
+    // The summary is an array, so use a regular equality which implicitly traverses it. The
+    // $_internalExpr variants have $expr semantics and would compare against the whole array.
+    return makeOr(makeVector<std::unique_ptr<MatchExpression>>(
+        std::make_unique<NotMatchExpression>(
+            std::make_unique<ExistsMatchExpression>(distinctPathStringData)),
+        makeCmpMatchExpr<EqualityMatchExpression>(distinctPathStringData, matchExprData)));
+}
+
 BucketLevelComparisonPredicateGeneratorBase::Output generateNonTimeFieldPredicate(
     const ComparisonMatchExpressionBase* matchExpr,
     const BucketLevelComparisonPredicateGeneratorBase::Params params,
@@ -218,14 +238,21 @@ BucketLevelComparisonPredicateGeneratorBase::Output generateNonTimeFieldPredicat
     const BSONElement& matchExprData) {
     switch (matchExpr->matchType()) {
         case MatchExpression::EQ:
-        case MatchExpression::INTERNAL_EXPR_EQ:
-            return {makeOr(makeVector<std::unique_ptr<MatchExpression>>(
+        case MatchExpression::INTERNAL_EXPR_EQ: {
+            auto rangePredicate = makeOr(makeVector<std::unique_ptr<MatchExpression>>(
                 makeAnd(makeCmpMatchExpr<InternalExprLTEMatchExpression>(minPathStringData,
                                                                          matchExprData),
                         makeCmpMatchExpr<InternalExprGTEMatchExpression>(maxPathStringData,
                                                                          matchExprData)),
                 createTypeEqualityPredicate(
-                    params.pExpCtx, matchExprPath, params.assumeNoMixedSchemaData)))};
+                    params.pExpCtx, matchExprPath, params.assumeNoMixedSchemaData)));
+            // Only consult the distinct-value summary when buckets are being written with one.
+            if (gTimeseriesBucketMaxDistinctSummaryValues.load() > 0) {
+                return {makeAnd(std::move(rangePredicate),
+                                createDistinctSummaryPredicate(matchExprPath, matchExprData))};
+            }
+            return {std::move(rangePredicate)};
+        }
         case MatchExpression::GT:
         case MatchExpression::INTERNAL_EXPR_GT:
             return {makeOr(makeVector<std::unique_ptr<MatchExpression>>(
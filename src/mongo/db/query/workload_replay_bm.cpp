@@ -0,0 +1,292 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * Replays a recorded workload profile through the full find path (parse, plan and execute via the
+ * service entry point) against a dataset generated from the profile's data distribution, and
+ * reports the mean latency of every query shape as a per-shape benchmark counter. Running with
+ * --benchmark_format=json therefore yields machine-readable per-shape latencies, suitable for
+ * comparing two server builds against the same workload.
+ *
+ * The profile is read from the file named by the MONGO_WORKLOAD_REPLAY_PROFILE environment
+ * variable; when the variable is unset, a small built-in demo profile keeps the target runnable.
+ * A profile is a single JSON document of the form:
+ *
+ *     {
+ *         dataset: {
+ *             numDocuments: 10000,  // Optional, defaults to 10000.
+ *             fields: [
+ *                 {name: "category", type: "choice", values: ["a", "b", "c"]},
+ *                 {name: "value", type: "int", min: 0, max: 100000},
+ *                 {name: "score", type: "double", min: 0, max: 1},
+ *                 {name: "label", type: "string", length: 12}
+ *             ]
+ *         },
+ *         indexes: [{value: 1}],  // Optional list of index key patterns.
+ *         queries: [
+ *             // One entry per query shape; 'projection' is optional. Shapes exported from
+ *             // queryStats must have their placeholders replaced with representative constants.
+ *             {name: "pointValue", filter: {value: 12345}}
+ *         ]
+ *     }
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/json.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/query/query_bm_fixture.h"
+#include "mongo/rpc/op_msg.h"
+#include "mongo/transport/service_entry_point.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/static_immortal.h"
+#include "mongo/util/str.h"
+#include "mongo/util/timer.h"
+
+namespace mongo {
+namespace {
+
+constexpr auto kProfileEnvVar = "MONGO_WORKLOAD_REPLAY_PROFILE";
+
+// Used when MONGO_WORKLOAD_REPLAY_PROFILE is unset, so that the target remains runnable (and its
+// profile plumbing exercised) without a recorded workload at hand.
+constexpr auto kDemoProfile = R"({
+    dataset: {
+        numDocuments: 10000,
+        fields: [
+            {name: "category", type: "choice", values: ["a", "b", "c", "d"]},
+            {name: "value", type: "int", min: 0, max: 100000},
+            {name: "label", type: "string", length: 12}
+        ]
+    },
+    indexes: [{value: 1}],
+    queries: [
+        {name: "pointValue", filter: {value: 12345}},
+        {name: "rangeValueByCategory",
+         filter: {value: {$lt: 1000}, category: "a"},
+         projection: {label: 1}}
+    ]
+})";
+
+struct WorkloadQueryShape {
+    std::string name;
+    BSONObj filter;
+    BSONObj projection;
+};
+
+struct WorkloadProfile {
+    long long numDocuments = 10000;
+    std::vector<BSONObj> fieldSpecs;
+    std::vector<BSONObj> indexKeyPatterns;
+    std::vector<WorkloadQueryShape> queries;
+};
+
+WorkloadProfile parseProfile(const BSONObj& spec) {
+    WorkloadProfile profile;
+
+    auto dataset = spec["dataset"];
+    uassert(9876529,
+            "workload profile must contain a 'dataset' object with a 'fields' array",
+            dataset.type() == BSONType::Object &&
+                dataset.Obj()["fields"].type() == BSONType::Array);
+    if (auto numDocuments = dataset.Obj()["numDocuments"]; numDocuments.isNumber()) {
+        profile.numDocuments = numDocuments.numberLong();
+    }
+    for (auto&& field : dataset.Obj()["fields"].Array()) {
+        uassert(9876530,
+                "every dataset field spec must be an object with 'name' and 'type' strings",
+                field.type() == BSONType::Object &&
+                    field.Obj()["name"].type() == BSONType::String &&
+                    field.Obj()["type"].type() == BSONType::String);
+        profile.fieldSpecs.push_back(field.Obj().getOwned());
+    }
+
+    if (auto indexes = spec["indexes"]; indexes.type() == BSONType::Array) {
+        for (auto&& keyPattern : indexes.Array()) {
+            profile.indexKeyPatterns.push_back(keyPattern.Obj().getOwned());
+        }
+    }
+
+    uassert(9876531,
+            "workload profile must contain a non-empty 'queries' array",
+            spec["queries"].type() == BSONType::Array && !spec["queries"].Array().empty());
+    for (auto&& query : spec["queries"].Array()) {
+        auto queryObj = query.Obj();
+        uassert(9876532,
+                "every query shape must have a 'name' string and a 'filter' object",
+                queryObj["name"].type() == BSONType::String &&
+                    queryObj["filter"].type() == BSONType::Object);
+        WorkloadQueryShape shape;
+        shape.name = queryObj["name"].String();
+        shape.filter = queryObj["filter"].Obj().getOwned();
+        if (queryObj["projection"].type() == BSONType::Object) {
+            shape.projection = queryObj["projection"].Obj().getOwned();
+        }
+        profile.queries.push_back(std::move(shape));
+    }
+
+    return profile;
+}
+
+const WorkloadProfile& workloadProfile() {
+    static StaticImmortal<WorkloadProfile> profile{[] {
+        if (const char* path = getenv(kProfileEnvVar)) {
+            std::ifstream file(path);
+            uassert(9876533,
+                    str::stream() << "could not open workload profile file: " << path,
+                    file.good());
+            std::stringstream contents;
+            contents << file.rdbuf();
+            return parseProfile(fromjson(contents.str()));
+        }
+        return parseProfile(fromjson(kDemoProfile));
+    }()};
+    return *profile;
+}
+
+class WorkloadReplayBenchmark : public QueryBenchmarkFixture {
+public:
+    void replayWorkload(benchmark::State& state) {
+        const auto& queries = workloadProfile().queries;
+
+        // Serialize each shape's find command once, up front.
+        std::vector<Message> requests;
+        requests.reserve(queries.size());
+        for (const auto& shape : queries) {
+            BSONObjBuilder bob;
+            bob.append("find", kNss.coll());
+            bob.append("$db", kNss.db_forTest());
+            bob.append("filter", shape.filter);
+            if (!shape.projection.isEmpty()) {
+                bob.append("projection", shape.projection);
+            }
+            OpMsgRequest request;
+            request.body = bob.obj();
+            requests.push_back(request.serialize());
+        }
+
+        std::vector<int64_t> totalNanos(queries.size(), 0);
+        int64_t rounds = 0;
+
+        ThreadClient threadClient{getGlobalServiceContext()->getService()};
+        runBenchmarkWithProfiler(
+            [&]() {
+                Client& client = cc();
+                for (size_t i = 0; i < requests.size(); ++i) {
+                    auto opCtx = client.makeOperationContext();
+                    Timer timer;
+                    auto statusWithResponse = client.getService()
+                                                  ->getServiceEntryPoint()
+                                                  ->handleRequest(opCtx.get(), requests[i])
+                                                  .getNoThrow();
+                    totalNanos[i] += timer.nanos();
+                    iassert(statusWithResponse);
+                }
+                ++rounds;
+            },
+            state);
+
+        // Report the mean latency per shape. These counters appear per shape name in the JSON
+        // benchmark output, which is what downstream comparison tooling consumes.
+        for (size_t i = 0; i < queries.size(); ++i) {
+            state.counters[queries[i].name + "_ns"] = benchmark::Counter(
+                static_cast<double>(totalNanos[i]) / std::max<int64_t>(rounds, 1));
+        }
+    }
+
+private:
+    BSONObj generateDocument(size_t index, size_t approximateSize) override {
+        // Document shape is fully described by the profile; 'approximateSize' is unused.
+        BSONObjBuilder bob;
+        bob.append("_id", OID::gen());
+        for (const auto& spec : workloadProfile().fieldSpecs) {
+            auto name = spec["name"].String();
+            auto type = spec["type"].String();
+            if (type == "int") {
+                const auto min = spec["min"].numberLong();
+                const auto max = spec["max"].numberLong();
+                bob.append(name, static_cast<long long>(boundedRandom(min, max)));
+            } else if (type == "double") {
+                const auto min = spec["min"].numberDouble();
+                const auto max = spec["max"].numberDouble();
+                bob.append(name, min + (max - min) * (boundedRandom(0, 10000) / 10000.0));
+            } else if (type == "string") {
+                bob.append(name, randomLowercaseAlphaString(spec["length"].numberLong()));
+            } else if (type == "choice") {
+                auto values = spec["values"].Array();
+                bob.appendAs(values[boundedRandom(0, values.size() - 1)], name);
+            } else {
+                uasserted(9876534, str::stream() << "unknown dataset field type: " << type);
+            }
+        }
+        return bob.obj();
+    }
+
+    std::vector<BSONObj> getIndexSpecs() const override {
+        std::vector<BSONObj> specs;
+        for (const auto& keyPattern : workloadProfile().indexKeyPatterns) {
+            StringBuilder name;
+            for (auto&& elem : keyPattern) {
+                if (name.len() > 0) {
+                    name << "_";
+                }
+                name << elem.fieldNameStringData() << "_" << elem.numberInt();
+            }
+            specs.push_back(BSONObjBuilder{}
+                                .append("v", IndexDescriptor::kLatestIndexVersion)
+                                .append("key", keyPattern)
+                                .append("name", name.str())
+                                .obj());
+        }
+        return specs;
+    }
+
+    int64_t boundedRandom(int64_t min, int64_t max) {
+        return min + std::abs(randomInt64() % (max - min + 1));
+    }
+};
+
+BENCHMARK_DEFINE_F(WorkloadReplayBenchmark, Replay)(benchmark::State& state) {
+    replayWorkload(state);
+}
+
+static void configureReplay(benchmark::internal::Benchmark* bm) {
+    bm->Args({workloadProfile().numDocuments, 0})->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_REGISTER_F(WorkloadReplayBenchmark, Replay)->Apply(configureReplay);
+
+}  // namespace
+}  // namespace mongo
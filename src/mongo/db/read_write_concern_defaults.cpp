@@ -211,12 +211,21 @@ void ReadWriteConcernDefaults::observeDirectWriteToConfigSettings(OperationConte
 
 void ReadWriteConcernDefaults::invalidate() {
     _defaults.invalidateKey(Type::kReadWriteConcernEntry);
+    // Unpublish the lock-free snapshot so subsequent readers fall through to the cache (and
+    // thereby trigger a refresh). A concurrent reader may republish the invalidated value, which
+    // is within the staleness the contract of this method already permits.
+    std::atomic_store(&_currentSnapshot,  // NOLINT
+                      std::shared_ptr<const RWConcernDefaultAndTime>());
 }
 
 void ReadWriteConcernDefaults::setDefault(OperationContext* opCtx, RWConcernDefault&& rwc) {
-    _defaults.insertOrAssignAndGet(Type::kReadWriteConcernEntry,
-                                   std::move(rwc),
-                                   opCtx->getServiceContext()->getFastClockSource()->now());
+    auto handle = _defaults.insertOrAssignAndGet(
+        Type::kReadWriteConcernEntry,
+        std::move(rwc),
+        opCtx->getServiceContext()->getFastClockSource()->now());
+    std::atomic_store(&_currentSnapshot,  // NOLINT
+                      std::make_shared<const RWConcernDefaultAndTime>(
+                          *handle, handle.updateWallClockTime()));
 }
 
 void ReadWriteConcernDefaults::refreshIfNecessary(OperationContext* opCtx) {
@@ -255,6 +264,13 @@ repl::ReadConcernArgs ReadWriteConcernDefaults::getImplicitDefaultReadConcern()
 
 boost::optional<ReadWriteConcernDefaults::RWConcernDefaultAndTime>
 ReadWriteConcernDefaults::_getDefaultCWRWCFromDisk(OperationContext* opCtx) {
+    // Fast path: the current defaults are published as an immutable snapshot, so resolving the
+    // implicit concerns for a command is a single atomic load rather than a mutex acquisition on
+    // the read-through cache.
+    if (auto snapshot = std::atomic_load(&_currentSnapshot)) {  // NOLINT
+        return *snapshot;
+    }
+
     auto defaultsHandle = _defaults.acquire(opCtx, Type::kReadWriteConcernEntry);
     if (defaultsHandle) {
         // Since CWRWC is ok with continuing to use a value well after it has been invalidated
@@ -262,8 +278,13 @@ ReadWriteConcernDefaults::_getDefaultCWRWCFromDisk(OperationContext* opCtx) {
         // defaultsValue.isValid() here, and we don't need to return the Handle, since callers don't
         // need to check defaultsValue.isValid() later, either.  Just dereference it to get the
         // underlying contents.
-        return RWConcernDefaultAndTime(*defaultsHandle, defaultsHandle.updateWallClockTime());
+        auto value = std::make_shared<const RWConcernDefaultAndTime>(
+            *defaultsHandle, defaultsHandle.updateWallClockTime());
+        std::atomic_store(&_currentSnapshot, value);  // NOLINT
+        return *value;
     }
+    // A lookup miss is deliberately not published: the cache also doesn't retain misses, and
+    // publishing one would stop readers from noticing when a defaults document first appears.
     return boost::none;
 }
 
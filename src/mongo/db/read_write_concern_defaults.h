@@ -214,6 +214,14 @@ private:
 
     Cache _defaults;
 
+    // Immutable snapshot of the current defaults, published whenever the cache gains a value and
+    // cleared on invalidation. Readers resolving implicit concerns (i.e. every command) take a
+    // single atomic load here instead of a mutex acquisition on the read-through cache; they fall
+    // through to the cache only while no snapshot is published. A snapshot may briefly outlive an
+    // invalidation of the underlying cache entry, which is within the documented semantics of
+    // 'invalidate()' above.
+    std::shared_ptr<const RWConcernDefaultAndTime> _currentSnapshot;
+
     // Thread pool on which to perform loading of the cached RWC defaults
     ThreadPool _threadPool;
 
@@ -150,12 +150,14 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
     auto iter = begin;
     while (iter != end) {
         std::vector<RecordId> locs;
+        std::vector<BSONObj> docs;
         Status status = writeConflictRetry(
             _opCtx.get(), "CollectionBulkLoaderImpl/insertDocumentsUncapped", _nss, [&] {
                 WriteUnitOfWork wunit(_opCtx.get());
                 auto insertIter = iter;
                 int bytesInBlock = 0;
                 locs.clear();
+                docs.clear();
 
                 auto onRecordInserted = [&](const RecordId& location) {
                     locs.emplace_back(location);
@@ -165,6 +167,9 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
                 while (insertIter != end && bytesInBlock < collectionBulkLoaderBatchSizeInBytes) {
                     const auto& [replRid, doc] = fn(*insertIter++);
                     bytesInBlock += doc.objsize();
+                    // Keep the parsed document for the index pass below; this shares the
+                    // underlying buffer rather than copying it.
+                    docs.push_back(doc);
                     // This version of insert will not update any indexes.
                     auto status = collection_internal::insertDocumentForBulkLoader(
                         _opCtx.get(),
@@ -191,8 +196,7 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
         status = writeConflictRetry(_opCtx.get(), "_addDocumentToIndexBlocks", _nss, [&] {
             WriteUnitOfWork wunit(_opCtx.get());
             for (size_t index = 0; index < locs.size(); ++index) {
-                const auto& [_, doc] = fn(*iter++);
-                status = _addDocumentToIndexBlocks(doc, locs.at(index));
+                status = _addDocumentToIndexBlocks(docs.at(index), locs.at(index));
                 if (!status.isOK()) {
                     return status;
                 }
@@ -204,6 +208,7 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
         if (!status.isOK()) {
             return status;
         }
+        iter += locs.size();
     }
     return Status::OK();
 }
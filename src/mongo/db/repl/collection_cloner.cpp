@@ -512,9 +512,9 @@ void CollectionCloner::handleNextBatch(DBClientCursor& cursor) {
 
 void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd) {
     uassertStatusOK(cbd.status);
+    std::vector<BSONObj> docs;
     {
         stdx::lock_guard<stdx::mutex> lk(_mutex);
-        std::vector<BSONObj> docs;
         // Increment 'fetchedBatches' even if no documents were inserted to match the number of
         // 'receivedBatches'.
         ++_stats.fetchedBatches;
@@ -528,17 +528,20 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
         _progressMeter.hit(int(docs.size()));
         invariant(_collLoader);
-
-        CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
-            ? ([](const BSONObj& doc) {
-                  return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
-              })
-            : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
-        uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
     }
 
+    CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
+        ? ([](const BSONObj& doc) {
+              return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
+          })
+        : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
+    // The insert is done outside the lock so that the network thread can stage the next batch
+    // into '_documentsToInsert' while this one is being written. CollectionBulkLoader is not
+    // thread safe, but these callbacks are serialized by '_dbWorkTaskRunner' and '_collLoader'
+    // is not replaced while database work is in flight, so the loader is never accessed
+    // concurrently.
+    uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
+
     initialSyncHangDuringCollectionClone.executeIf(
         [&](const BSONObj&) {
             LOGV2(21138,
@@ -285,6 +285,8 @@ private:
     std::vector<BSONObj> _readyIndexSpecs;              // (X) Except for _id_
     std::vector<BSONObj> _unfinishedIndexSpecs;         // (X)
     BSONObj _idIndexSpec;                               // (X)
+    // Also used, but never modified, by the insert callbacks, which are serialized by
+    // '_dbWorkTaskRunner' and always joined before this is replaced.
     std::unique_ptr<CollectionBulkLoader> _collLoader;  // (X)
     //  Function for scheduling database work using the executor.
     ScheduleDbWorkFn _scheduleDbWorkFn;  // (R)
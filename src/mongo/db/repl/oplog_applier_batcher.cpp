@@ -60,6 +60,7 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/str.h"
 
@@ -129,6 +130,28 @@ std::size_t OplogApplierBatcher::getOpCount(const OplogEntry& entry) {
     return 1U;
 }
 
+void OplogApplierBatcher::recordBatchApplyTime(std::size_t opCount, Microseconds applyTime) {
+    if (opCount == 0) {
+        return;
+    }
+    auto sample = durationCount<Microseconds>(applyTime) / static_cast<long long>(opCount);
+    auto estimate = _perOpApplyMicros.load();
+    // Weight new measurements at 1/4 so a single unusually cheap or expensive batch does not
+    // swing the batch size; the first measurement seeds the estimate directly.
+    _perOpApplyMicros.store(estimate == 0 ? sample : (estimate * 3 + sample) / 4);
+}
+
+std::size_t OplogApplierBatcher::_getAdaptiveOpsLimit(std::size_t maxOps) const {
+    auto targetMillis = replBatchTimeTargetMillis.load();
+    auto perOpMicros = _perOpApplyMicros.load();
+    if (targetMillis <= 0 || perOpMicros <= 0) {
+        return maxOps;
+    }
+    auto targetOps =
+        std::size_t(durationCount<Microseconds>(Milliseconds(targetMillis)) / perOpMicros);
+    return std::clamp(targetOps, std::size_t(1), maxOps);
+}
+
 StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
     OperationContext* opCtx, const BatchLimits& batchLimits, Milliseconds waitToFillBatch) {
     if (batchLimits.ops == 0) {
@@ -145,7 +168,22 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
     }
     while (_oplogBuffer->peek(opCtx, &op)) {
         oplogBatcherPauseAfterSuccessfulPeek.pauseWhileSet();
-        auto entry = OplogEntry(op);
+
+        // Every batch-cutting decision below returns without consuming the peeked entry, so the
+        // first entry of the next batch gets peeked again by the next call. Reuse the parsed
+        // form cached by the previous call rather than re-parsing the BSON.
+        auto entry = [&]() -> OplogEntry {
+            if (_cachedHeadEntry) {
+                auto opTime = OpTime::parseFromOplogEntry(op);
+                if (opTime.isOK() && opTime.getValue() == _cachedHeadEntry->getOpTime()) {
+                    auto cached = std::move(*_cachedHeadEntry);
+                    _cachedHeadEntry = boost::none;
+                    return cached;
+                }
+                _cachedHeadEntry = boost::none;
+            }
+            return OplogEntry(op);
+        }();
 
         if (entry.shouldLogAsDDLOperation() && !serverGlobalParams.quiet.load()) {
             LOGV2(7360109,
@@ -180,6 +218,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
                     // reconfigs and shutdown to occur.
                     sleepsecs(1);
                 }
+                _cachedHeadEntry = std::move(entry);
                 return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
             }
         }
@@ -190,6 +229,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
                 break;
             case BatchAction::kStartNewBatch:
                 if (!ops.empty()) {
+                    _cachedHeadEntry = std::move(entry);
                     return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
                 }
                 break;
@@ -197,6 +237,8 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
                 if (ops.empty()) {
                     ops.push_back(std::move(entry));
                     _consume(opCtx, _oplogBuffer);
+                } else {
+                    _cachedHeadEntry = std::move(entry);
                 }
                 return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
         }
@@ -207,6 +249,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
         if (batchStats.totalOps > 0) {
             if (batchStats.totalOps + opCount > batchLimits.ops ||
                 batchStats.totalBytes + opBytes > batchLimits.bytes) {
+                _cachedHeadEntry = std::move(entry);
                 return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
             }
         }
@@ -215,6 +258,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
         if (batchStats.totalOps > 0 && !batchLimits.forceBatchBoundaryAfter.isNull() &&
             entry.getOpTime().getTimestamp() > batchLimits.forceBatchBoundaryAfter &&
             ops.back().getOpTime().getTimestamp() <= batchLimits.forceBatchBoundaryAfter) {
+            _cachedHeadEntry = std::move(entry);
             return OplogApplierBatch(std::move(ops), batchStats.totalBytes);
         }
 
@@ -351,8 +395,10 @@ void OplogApplierBatcher::_run(StorageInterface* storageInterface) {
                 _calculateSecondaryDelaySecsLatestTimestamp();
         }
 
-        // Check the limits once per batch since users can change them at runtime.
-        batchLimits.ops = getBatchLimitOplogEntries();
+        // Check the limits once per batch since users can change them at runtime. When adaptive
+        // batch sizing is enabled, further scale the operation count limit toward the per-batch
+        // wall-clock budget.
+        batchLimits.ops = _getAdaptiveOpsLimit(getBatchLimitOplogEntries());
 
         // Use the OplogBuffer to populate a local OplogBatch. Note that the buffer may be empty.
         OplogApplierBatch ops;
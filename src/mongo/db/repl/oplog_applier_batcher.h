@@ -41,6 +41,7 @@
 #include "mongo/db/repl/oplog_buffer.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/storage_interface.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/stdx/thread.h"
@@ -124,6 +125,20 @@ public:
         // TODO(SERVER-80981): Remove this parameter as it has been moved to OplogWriter.
         Milliseconds waitToFillBatch = Milliseconds(0));
 
+    /**
+     * Records the measured wall-clock time it took to apply a batch of 'opCount' operations. The
+     * batcher maintains a running per-operation cost estimate from these measurements and, when
+     * 'replBatchTimeTargetMillis' is set, uses it to size subsequent batches.
+     */
+    void recordBatchApplyTime(std::size_t opCount, Microseconds applyTime);
+
+    /**
+     * Exposes the adaptive operation count limit for testing.
+     */
+    std::size_t getAdaptiveOpsLimit_forTest(std::size_t maxOps) const {
+        return _getAdaptiveOpsLimit(maxOps);
+    }
+
     /**
      * Returns the number of logical operations represented by an oplog entry.
      * This is usually one but may be greater than one in certain cases, such as in a
@@ -154,6 +169,14 @@ private:
      */
     boost::optional<Date_t> _calculateSecondaryDelaySecsLatestTimestamp();
 
+    /**
+     * Returns the operation count limit to use for the next batch: 'maxOps', scaled down toward
+     * the 'replBatchTimeTargetMillis' wall-clock budget using the running per-operation cost
+     * estimate. Returns 'maxOps' unchanged when adaptive batch sizing is disabled or no
+     * measurements have been recorded yet.
+     */
+    std::size_t _getAdaptiveOpsLimit(std::size_t maxOps) const;
+
     /**
      * Pops the operation at the front of the OplogBuffer.
      */
@@ -164,6 +187,16 @@ private:
     OplogApplier* _oplogApplier;
     OplogBuffer* const _oplogBuffer;
 
+    // Exponentially weighted estimate of the wall-clock cost to apply a single operation, in
+    // microseconds. Zero until the first measurement is recorded. Written by the applier thread
+    // via recordBatchApplyTime() and read by the batcher thread.
+    AtomicWord<long long> _perOpApplyMicros{0};
+
+    // The parsed form of the oplog entry that cut the previous batch, left peeked but unconsumed
+    // in the OplogBuffer. getNextApplierBatch() reuses it for the head of the next batch instead
+    // of re-parsing the BSON. Only accessed by the thread calling getNextApplierBatch().
+    boost::optional<OplogEntry> _cachedHeadEntry;
+
     stdx::mutex _mutex;
     stdx::condition_variable _cv;
 
@@ -98,6 +98,7 @@
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplication
 
@@ -318,7 +319,8 @@ void _addOplogChainOpsToWriterVectors(OperationContext* opCtx,
                                       std::vector<std::vector<OplogEntry>>* derivedOps,
                                       std::vector<std::vector<ApplierOperation>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      RetryImageRectifier* retryImageRectifier) {
+                                      RetryImageRectifier* retryImageRectifier,
+                                      WriterAssignmentCache* writerAssignments) {
     auto [txnOps, shouldSerialize] =
         readTransactionOperationsFromOplogChainAndCheckForCommands(opCtx, *op, *partialTxnList);
     auto& extractedOps = retryImageRectifier->storeExtractedOpsAndDeletes(
@@ -327,13 +329,18 @@ void _addOplogChainOpsToWriterVectors(OperationContext* opCtx,
     partialTxnList->clear();
 
     if (op->shouldPrepare()) {
-        OplogApplierUtils::addDerivedPrepares(
-            opCtx, op, &extractedOps, writerVectors, collPropertiesCache, shouldSerialize);
+        OplogApplierUtils::addDerivedPrepares(opCtx,
+                                              op,
+                                              &extractedOps,
+                                              writerVectors,
+                                              collPropertiesCache,
+                                              shouldSerialize,
+                                              writerAssignments);
         return;
     }
 
     OplogApplierUtils::addDerivedOps(
-        opCtx, &extractedOps, writerVectors, collPropertiesCache, shouldSerialize);
+        opCtx, &extractedOps, writerVectors, collPropertiesCache, shouldSerialize, writerAssignments);
 }
 
 void _setOplogApplicationWorkerOpCtxStates(OperationContext* opCtx) {
@@ -571,6 +578,8 @@ void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
 
         // Apply the operations in this batch. '_applyOplogBatch' returns the optime of the
         // last op that was applied, which should be the last optime in the batch.
+        const auto entryCountInBatch = ops.count();
+        Timer applyTimer;
         auto swLastOpTimeAppliedInBatch = _applyOplogBatch(&opCtx, ops.releaseBatch());
         if (swLastOpTimeAppliedInBatch.getStatus().code() == ErrorCodes::InterruptedAtShutdown) {
             // If an operation was interrupted at shutdown, fail the batch without advancing
@@ -583,6 +592,10 @@ void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
         fassertNoTrace(34437, swLastOpTimeAppliedInBatch);
         invariant(swLastOpTimeAppliedInBatch.getValue() == lastOpTimeInBatch);
 
+        // Feed the measured apply time back to the batcher so it can size the next batch when
+        // adaptive batch sizing (replBatchTimeTargetMillis) is enabled.
+        _oplogBatcher->recordBatchApplyTime(entryCountInBatch, Microseconds(applyTimer.micros()));
+
         // Update various things that care about our last applied optime.
 
         // 1. Ensure that the last applied op time hasn't changed since the start of this batch.
@@ -789,7 +802,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
     std::vector<OplogEntry>* ops,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     std::vector<std::vector<OplogEntry>>* derivedOps,
-    SessionUpdateTracker* sessionUpdateTracker) noexcept {
+    SessionUpdateTracker* sessionUpdateTracker,
+    WriterAssignmentCache* writerAssignments) noexcept {
 
     // Caches partial transaction operations. Each map entry contains a cumulative list
     // of operations seen in this batch so far.
@@ -835,7 +849,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                                  &derivedOps->back(),
                                                  writerVectors,
                                                  &collPropertiesCache,
-                                                 false /*serial*/);
+                                                 false /*serial*/,
+                                                 writerAssignments);
             }
 
             // If this is a delete for a config.images_collection entry that will be written later
@@ -892,7 +907,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                                  derivedOps,
                                                  writerVectors,
                                                  &collPropertiesCache,
-                                                 &retryImageRectifier);
+                                                 &retryImageRectifier,
+                                                 writerAssignments);
                 invariant(partialTxnList->empty(), op.toStringForLogging());
             } else {
                 // The applyOps entry was not generated as part of a transaction.
@@ -900,8 +916,12 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                     ApplyOps::extractOperations(op), derivedOps, false /* isPrepared */);
 
                 // Nested entries cannot have different session updates.
-                OplogApplierUtils::addDerivedOps(
-                    opCtx, &extractedOps, writerVectors, &collPropertiesCache, false /*serial*/);
+                OplogApplierUtils::addDerivedOps(opCtx,
+                                                 &extractedOps,
+                                                 writerVectors,
+                                                 &collPropertiesCache,
+                                                 false /*serial*/,
+                                                 writerAssignments);
             }
             continue;
         }
@@ -916,7 +936,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                              derivedOps,
                                              writerVectors,
                                              &collPropertiesCache,
-                                             &retryImageRectifier);
+                                             &retryImageRectifier,
+                                             writerAssignments);
             continue;
         }
 
@@ -925,7 +946,7 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
         if (op.isPreparedCommitOrAbort() &&
             (getOptions().mode == OplogApplication::Mode::kSecondary)) {
             OplogApplierUtils::addDerivedCommitsOrAborts(
-                opCtx, &op, writerVectors, &collPropertiesCache);
+                opCtx, &op, writerVectors, &collPropertiesCache, writerAssignments);
             continue;
         }
 
@@ -940,15 +961,18 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
                                              derivedOps,
                                              writerVectors,
                                              &collPropertiesCache,
-                                             &retryImageRectifier);
+                                             &retryImageRectifier,
+                                             writerAssignments);
             invariant(partialTxnList->empty(), op.toStringForLogging());
             continue;
         }
 
-        OplogApplierUtils::addToWriterVector(opCtx, &op, writerVectors, &collPropertiesCache);
+        OplogApplierUtils::addToWriterVector(
+            opCtx, &op, writerVectors, &collPropertiesCache, boost::none, writerAssignments);
     }
     retryImageRectifier.handleLatestDeletes([&](OplogEntry* op) {
-        OplogApplierUtils::addToWriterVector(opCtx, op, writerVectors, &collPropertiesCache);
+        OplogApplierUtils::addToWriterVector(
+            opCtx, op, writerVectors, &collPropertiesCache, boost::none, writerAssignments);
     });
 }
 
@@ -958,13 +982,18 @@ void OplogApplierImpl::_fillWriterVectors(
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     std::vector<std::vector<OplogEntry>>* derivedOps) noexcept {
     SessionUpdateTracker sessionUpdateTracker;
-    _deriveOpsAndFillWriterVectors(opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker);
+
+    // The assignment cache spans both passes below so that ops on the same document, including
+    // session table updates flushed in either pass, always land in the same writer vector.
+    WriterAssignmentCache writerAssignments(writerVectors->size());
+    _deriveOpsAndFillWriterVectors(
+        opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker, &writerAssignments);
 
     auto newOplogWrites = sessionUpdateTracker.flushAll();
     if (!newOplogWrites.empty()) {
         derivedOps->emplace_back(std::move(newOplogWrites));
         _deriveOpsAndFillWriterVectors(
-            opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr);
+            opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr, &writerAssignments);
     }
 }
 
@@ -43,6 +43,7 @@
 #include "mongo/db/repl/oplog_buffer.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/oplog_entry_or_grouped_inserts.h"
+#include "mongo/db/repl/oplog_applier_utils.h"
 #include "mongo/db/repl/oplog_writer.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/replication_consistency_markers.h"
@@ -118,7 +119,8 @@ private:
                                         std::vector<OplogEntry>* ops,
                                         std::vector<std::vector<ApplierOperation>>* writerVectors,
                                         std::vector<std::vector<OplogEntry>>* derivedOps,
-                                        SessionUpdateTracker* sessionUpdateTracker) noexcept;
+                                        SessionUpdateTracker* sessionUpdateTracker,
+                                        WriterAssignmentCache* writerAssignments) noexcept;
 
     void _fillWriterVectors(OperationContext* opCtx,
                             std::vector<OplogEntry>* ops,
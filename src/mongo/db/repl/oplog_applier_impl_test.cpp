@@ -193,9 +193,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
         NamespaceString::createNamespaceString_forTest(boost::none, "test.t");
     NamespaceString otherNss = NamespaceString::createNamespaceString_forTest("test.othername");
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, {});
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -233,9 +233,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     NamespaceString otherNss =
         NamespaceString::createNamespaceString_forTest(nss.getSisterNS("othername"));
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, kUuid);
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -278,10 +278,10 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     // which in the case of this test just ignores such errors. This tests mostly that we don't
     // implicitly create the collection.
     auto op = makeOplogEntry(OpTypeEnum::kDelete, nss, {});
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
     ASSERT_FALSE(collectionExists(_opCtx.get(), nss));
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -315,9 +315,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
     repl::createCollection(_opCtx.get(), nss, {});
     auto op = makeOplogEntry(OpTypeEnum::kDelete, nss, {});
-    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     ASSERT_EQ(1, postDeleteWasEmpty - prevDeleteWasEmpty);
 
     ASSERT_EQ(postDeleteWasEmpty,
@@ -355,9 +355,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     auto uuid = createCollectionWithUuid(_opCtx.get(), nss);
     ASSERT_OK(getStorageInterface()->insertDocument(_opCtx.get(), nss, {BSON("_id" << 0)}, 0));
     auto op = makeOplogEntry(OpTypeEnum::kInsert, nss, uuid);
-    int prevInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc()->load();
+    int prevInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc()->load();
+    auto postInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc();
     ASSERT_EQ(1, postInsertOnExistingDoc - prevInsertOnExistingDoc);
 
     ASSERT_EQ(postInsertOnExistingDoc,
@@ -386,9 +386,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
                              update_oplog_entry::makeDeltaOplogEntry(
                                  BSON(doc_diff::kUpdateSectionFieldName << fromjson("{a: 1}"))),
                              BSON("_id" << 0));
-    int prevUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc()->load();
+    int prevUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, true);
-    auto postUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc()->load();
+    auto postUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc();
     ASSERT_EQ(1, postUpdateOnMissingDoc - prevUpdateOnMissingDoc);
 
     ASSERT_EQ(postUpdateOnMissingDoc,
@@ -433,9 +433,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     NamespaceString otherNss =
         NamespaceString::createNamespaceString_forTest(nss.getSisterNS("othername"));
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, options.uuid);
-    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     ASSERT_EQ(1, postDeleteWasEmpty - prevDeleteWasEmpty);
 
     ASSERT_EQ(postDeleteWasEmpty,
@@ -1331,6 +1331,29 @@ TEST_F(OplogApplierImplTest,
                   secondDerivedOp.getObject()["lastWriteOpTime"]["ts"].timestamp());
 }
 
+TEST(WriterAssignmentCacheTest, SameHashAlwaysAssignedToSameWriter) {
+    const uint32_t numWriters = 4;
+    WriterAssignmentCache cache(numWriters);
+
+    const auto firstWriterId = cache.getWriterId(42);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQUALS(firstWriterId, cache.getWriterId(42));
+    }
+}
+
+TEST(WriterAssignmentCacheTest, DistinctHashesSpreadAcrossAllWriters) {
+    const uint32_t numWriters = 4;
+    WriterAssignmentCache cache(numWriters);
+
+    // Distinct document keys should be spread across all writers regardless of their hash
+    // values, even when the hashes would collide in the same modulo bucket.
+    std::set<uint32_t> assignedWriters;
+    for (uint32_t i = 0; i < numWriters; i++) {
+        assignedWriters.insert(cache.getWriterId(i * numWriters));
+    }
+    ASSERT_EQUALS(numWriters, assignedWriters.size());
+}
+
 TEST_F(OplogApplierImplTest, applyOplogEntryOrGroupedInsertsInsertDocumentIncludesTenantId) {
     setServerParameter("multitenancySupport", true);
     setServerParameter("featureFlagRequireTenantID", true);
@@ -2373,14 +2396,14 @@ TEST_F(MultiOplogEntryOplogApplierImplTest, MultiApplyTwoTransactionsOneBatch) {
     // Note the insert counter so we can check it later.  It is necessary to use opCounters as
     // inserts are idempotent so we will not detect duplicate inserts just by checking inserts in
     // the opObserver.
-    int insertsBefore = replOpCounters.getInsert()->load();
+    int insertsBefore = replOpCounters.getInsert();
     // Insert all the oplog entries in one batch.  All inserts should be executed, in order, exactly
     // once.
     ASSERT_OK(oplogApplier.applyOplogBatch(
         _opCtx.get(),
         {insertOps1[0], insertOps1[1], commitOp1, insertOps2[0], insertOps2[1], commitOp2}));
     ASSERT_EQ(6U, oplogDocs().size());
-    ASSERT_EQ(4, replOpCounters.getInsert()->load() - insertsBefore);
+    ASSERT_EQ(4, replOpCounters.getInsert() - insertsBefore);
     ASSERT_EQ(4U, _insertedDocs[_nss1].size());
     checkTxnTable(_lsid,
                   txnNum2,
@@ -5261,10 +5284,10 @@ TEST_F(IdempotencyTestDisableSteadyStateConstraints, AcceptableErrorsRecordedInS
     auto collModOp = makeCommandOplogEntry(nextOpTime(), _nss, collModCmd, UUID::gen());
 
     // Ensure that NamespaceNotFound is "acceptable" but counted.
-    int prevAcceptableError = replOpCounters.getAcceptableErrorInCommand()->load();
+    int prevAcceptableError = replOpCounters.getAcceptableErrorInCommand();
     ASSERT_OK(runOpSteadyState(collModOp));
 
-    auto postAcceptableError = replOpCounters.getAcceptableErrorInCommand()->load();
+    auto postAcceptableError = replOpCounters.getAcceptableErrorInCommand();
     ASSERT_EQ(1, postAcceptableError - prevAcceptableError);
 
     ASSERT_EQ(postAcceptableError,
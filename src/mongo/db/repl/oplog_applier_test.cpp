@@ -39,6 +39,7 @@
 #include "mongo/db/database_name.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/repl/oplog_applier_batcher.h"
 #include "mongo/db/repl/oplog_applier_batcher_test_fixture.h"
 #include "mongo/db/repl/oplog_buffer_blocking_queue.h"
 #include "mongo/db/service_context.h"
@@ -392,6 +393,25 @@ TEST_F(OplogApplierTest, GetNextApplierBatchChecksBatchLimitsForSizeOfOperations
     ASSERT_EQUALS(srcOps[2], batch[0]);
 }
 
+TEST_F(OplogApplierTest, AdaptiveOpsLimitScalesWithMeasuredApplyCost) {
+    OplogApplierBatcher batcher(_applier.get(), _buffer.get());
+
+    // Without a time target the configured limit is used unchanged.
+    ASSERT_EQUALS(5000U, batcher.getAdaptiveOpsLimit_forTest(5000));
+
+    RAIIServerParameterControllerForTest timeTarget("replBatchTimeTargetMillis", 100);
+
+    // No measurements have been recorded yet.
+    ASSERT_EQUALS(5000U, batcher.getAdaptiveOpsLimit_forTest(5000));
+
+    // 1000 ops in one second is 1ms per op, so 100 ops fit in the 100ms budget.
+    batcher.recordBatchApplyTime(1000, Seconds(1));
+    ASSERT_EQUALS(100U, batcher.getAdaptiveOpsLimit_forTest(5000));
+
+    // The configured limit remains a hard ceiling.
+    ASSERT_EQUALS(50U, batcher.getAdaptiveOpsLimit_forTest(50));
+}
+
 TEST_F(OplogApplierTest,
        GetNextApplierBatchChecksBatchLimitsUsingEmbededCountInUnpreparedCommitTransactionOp1) {
     std::vector<OplogEntry> srcOps;
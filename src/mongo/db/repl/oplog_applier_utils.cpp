@@ -114,6 +114,16 @@ CachedCollectionProperties::getCollectionProperties(OperationContext* opCtx,
     return collProperties;
 }
 
+uint32_t WriterAssignmentCache::getWriterId(uint32_t hash) {
+    auto [it, inserted] = _assignments.try_emplace(hash, 0);
+    if (inserted) {
+        it->second = std::min_element(_assignedOpCounts.begin(), _assignedOpCounts.end()) -
+            _assignedOpCounts.begin();
+    }
+    ++_assignedOpCounts[it->second];
+    return it->second;
+}
+
 namespace {
 /**
  * Populates a CRUD op's idHash and updates the isForCappedCollection field if necessary.
@@ -152,9 +162,15 @@ uint32_t getWriterId(OperationContext* opCtx,
                      OplogEntry* op,
                      CachedCollectionProperties* collPropertiesCache,
                      uint32_t numWriters,
-                     boost::optional<uint32_t> forceWriterId = boost::none) {
+                     boost::optional<uint32_t> forceWriterId = boost::none,
+                     WriterAssignmentCache* writerAssignments = nullptr) {
     auto hash = OplogApplierUtils::getOplogEntryHash(opCtx, op, collPropertiesCache);
-    return (forceWriterId ? *forceWriterId : hash) % numWriters;
+    if (forceWriterId) {
+        return *forceWriterId % numWriters;
+    }
+    // When a batch-scoped assignment cache is provided, let it balance distinct keys across the
+    // writers instead of deriving the writer directly from the hash.
+    return writerAssignments ? writerAssignments->getWriterId(hash) : hash % numWriters;
 }
 
 /**
@@ -237,9 +253,10 @@ uint32_t OplogApplierUtils::addToWriterVector(
     OplogEntry* op,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     CachedCollectionProperties* collPropertiesCache,
-    boost::optional<uint32_t> forceWriterId) {
-    auto writerId =
-        getWriterId(opCtx, op, collPropertiesCache, writerVectors->size(), forceWriterId);
+    boost::optional<uint32_t> forceWriterId,
+    WriterAssignmentCache* writerAssignments) {
+    auto writerId = getWriterId(
+        opCtx, op, collPropertiesCache, writerVectors->size(), forceWriterId, writerAssignments);
     return addToWriterVectorImpl(writerId, writerVectors, op);
 }
 
@@ -274,13 +291,14 @@ void OplogApplierUtils::addDerivedOps(OperationContext* opCtx,
                                       std::vector<OplogEntry>* derivedOps,
                                       std::vector<std::vector<ApplierOperation>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      bool serial) {
+                                      bool serial,
+                                      WriterAssignmentCache* writerAssignments) {
     // Used to determine which writer vector to assign serial ops.
     boost::optional<uint32_t> serialWriterId;
 
     for (auto&& op : *derivedOps) {
-        auto writerId =
-            addToWriterVector(opCtx, &op, writerVectors, collPropertiesCache, serialWriterId);
+        auto writerId = addToWriterVector(
+            opCtx, &op, writerVectors, collPropertiesCache, serialWriterId, writerAssignments);
         if (serial && !serialWriterId) {
             serialWriterId.emplace(writerId);
         }
@@ -293,7 +311,8 @@ void OplogApplierUtils::addDerivedPrepares(
     std::vector<OplogEntry>* derivedOps,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     CachedCollectionProperties* collPropertiesCache,
-    bool serial) {
+    bool serial,
+    WriterAssignmentCache* writerAssignments) {
 
     // Get the SplitPrepareSessionManager to be used to create split sessions.
     auto splitSessManager = ReplicationCoordinator::get(opCtx)->getSplitPrepareSessionManager();
@@ -311,7 +330,12 @@ void OplogApplierUtils::addDerivedPrepares(
         // prepare op (as the prepares in initial sync or recovery mode) is so that we can keep a
         // logical invariant that all prepares in secondary mode are split, and thus we can apply
         // empty and non-empty prepares in the same way.
-        auto writerId = getWriterId(opCtx, prepareOp, collPropertiesCache, writerVectors->size());
+        auto writerId = getWriterId(opCtx,
+                                    prepareOp,
+                                    collPropertiesCache,
+                                    writerVectors->size(),
+                                    boost::none,
+                                    writerAssignments);
         const auto& sessionInfos = splitSessFunc({writerId});
         addToWriterVectorImpl(writerId,
                               writerVectors,
@@ -329,7 +353,12 @@ void OplogApplierUtils::addDerivedPrepares(
         std::vector<std::vector<const OplogEntry*>> bufWriterVectors(writerVectors->size());
         boost::optional<uint32_t> serialWriterId;
         for (auto&& op : *derivedOps) {
-            auto writerId = getWriterId(opCtx, &op, collPropertiesCache, writerVectors->size());
+            auto writerId = getWriterId(opCtx,
+                                        &op,
+                                        collPropertiesCache,
+                                        writerVectors->size(),
+                                        boost::none,
+                                        writerAssignments);
             if (serial && !serialWriterId) {
                 serialWriterId.emplace(writerId);
                 writerIds.emplace(*serialWriterId);
@@ -367,7 +396,8 @@ void OplogApplierUtils::addDerivedCommitsOrAborts(
     OperationContext* opCtx,
     OplogEntry* commitOrAbortOp,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
-    CachedCollectionProperties* collPropertiesCache) {
+    CachedCollectionProperties* collPropertiesCache,
+    WriterAssignmentCache* writerAssignments) {
 
     auto splitSessManager = ReplicationCoordinator::get(opCtx)->getSplitPrepareSessionManager();
     const auto& sessionInfos = splitSessManager->getSplitSessions(*commitOrAbortOp->getSessionId(),
@@ -377,7 +407,12 @@ void OplogApplierUtils::addDerivedCommitsOrAborts(
     // prepared when the node was primary or during inital sync/recovery. In this
     // case we do not split the commit and just add it as-is to the writer vector.
     if (!sessionInfos.has_value()) {
-        addToWriterVector(opCtx, commitOrAbortOp, writerVectors, collPropertiesCache);
+        addToWriterVector(opCtx,
+                          commitOrAbortOp,
+                          writerVectors,
+                          collPropertiesCache,
+                          boost::none,
+                          writerAssignments);
         return;
     }
 
@@ -70,6 +70,31 @@ private:
     stdx::unordered_map<NamespaceString, CollectionProperties> _cache;
 };
 
+/**
+ * Tracks which writer thread each document key has been assigned to within a single oplog batch.
+ *
+ * Ops on the same namespace and document key must all be applied by the same writer thread so
+ * that they apply in oplog order, but the first op on a key in a batch may go to any writer.
+ * Assigning it to the least loaded writer keeps the writer vectors balanced even when a single
+ * hot collection with a skewed document key distribution would otherwise hash most of the batch
+ * into a few writer buckets.
+ */
+class WriterAssignmentCache {
+public:
+    explicit WriterAssignmentCache(uint32_t numWriters) : _assignedOpCounts(numWriters) {}
+
+    /**
+     * Returns the writer id assigned to the given oplog entry hash. The first op with a given
+     * hash in the batch is assigned to the writer with the fewest assigned ops so far; subsequent
+     * ops with the same hash are assigned to the same writer.
+     */
+    uint32_t getWriterId(uint32_t hash);
+
+private:
+    stdx::unordered_map<uint32_t, uint32_t> _assignments;
+    std::vector<uint32_t> _assignedOpCounts;
+};
+
 /**
  * This class contains some static methods common to ordinary oplog application.
  */
@@ -115,7 +140,8 @@ public:
                                       OplogEntry* op,
                                       std::vector<std::vector<ApplierOperation>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      boost::optional<uint32_t> forceWriterId = boost::none);
+                                      boost::optional<uint32_t> forceWriterId = boost::none,
+                                      WriterAssignmentCache* writerAssignments = nullptr);
 
     /**
      * Adds a set of derivedOps to writerVectors. For ops derived from prepared transactions, the
@@ -128,7 +154,8 @@ public:
                               std::vector<OplogEntry>* derivedOps,
                               std::vector<std::vector<ApplierOperation>>* writerVectors,
                               CachedCollectionProperties* collPropertiesCache,
-                              bool serial);
+                              bool serial,
+                              WriterAssignmentCache* writerAssignments = nullptr);
 
     /**
      * Adds a set of derived prepared transaction operations to writerVectors.
@@ -184,7 +211,8 @@ public:
                                    std::vector<OplogEntry>* derivedOps,
                                    std::vector<std::vector<ApplierOperation>>* writerVectors,
                                    CachedCollectionProperties* collPropertiesCache,
-                                   bool shouldSerialize);
+                                   bool shouldSerialize,
+                                   WriterAssignmentCache* writerAssignments = nullptr);
 
     /**
      * Adds commit or abort transaction operations to the writerVectors.
@@ -218,7 +246,8 @@ public:
     static void addDerivedCommitsOrAborts(OperationContext* opCtx,
                                           OplogEntry* commitOrAbortOp,
                                           std::vector<std::vector<ApplierOperation>>* writerVectors,
-                                          CachedCollectionProperties* collPropertiesCache);
+                                          CachedCollectionProperties* collPropertiesCache,
+                                          WriterAssignmentCache* writerAssignments = nullptr);
 
     /**
      * Returns the namespace string for this oplogEntry; if it has a UUID it looks up the
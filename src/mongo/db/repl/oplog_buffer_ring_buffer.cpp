@@ -0,0 +1,267 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/repl/oplog_buffer_ring_buffer.h"
+
+#include <algorithm>
+
+#include "mongo/platform/pause.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+namespace repl {
+
+OplogBufferRingBuffer::OplogBufferRingBuffer(std::size_t maxSize)
+    : OplogBufferRingBuffer(maxSize, nullptr) {}
+
+OplogBufferRingBuffer::OplogBufferRingBuffer(std::size_t maxSize, Counters* counters)
+    : _maxSize(maxSize), _counters(counters) {
+    invariant(maxSize > 0);
+}
+
+void OplogBufferRingBuffer::startup(OperationContext*) {
+    invariant(!_isShutdown.load());
+    // Update server status metric to reflect the current oplog buffer's max size.
+    if (_counters) {
+        _counters->setMaxSize(_maxSize);
+    }
+}
+
+void OplogBufferRingBuffer::shutdown(OperationContext* opCtx) {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _isShutdown.store(true);
+        _clear(lk);
+    }
+
+    if (_counters) {
+        _counters->clear();
+    }
+}
+
+void OplogBufferRingBuffer::push(OperationContext*,
+                                 Batch::const_iterator begin,
+                                 Batch::const_iterator end,
+                                 boost::optional<const Cost&> cost) {
+    if (begin == end) {
+        return;
+    }
+
+    invariant(cost);
+    auto size = cost->size;
+    auto count = cost->count;
+
+    invariant(!_drainMode.load());
+
+    // Only fall back to the mutex when there is not enough space, which means the
+    // consumer is behind and the handoff latency does not matter anyway.
+    if (!_hasSpace(size)) {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _waitForSpace(lk, size);
+    }
+
+    // Do not push anything if already shutdown.
+    if (_isShutdown.load()) {
+        return;
+    }
+
+    // Fill the slot before advancing _head, which publishes it to the consumer.
+    auto head = _head.load();
+    _ring[head % kNumSlots] = OplogBatch<Value>(begin, end, size);
+    _head.store(head + 1);
+    _curSize.fetchAndAdd(size);
+    _curCount.fetchAndAdd(count);
+
+    // Only wake the consumer if it has given up spinning and gone to sleep. If the
+    // consumer sets the flag after we load it here, it re-checks _head under the mutex
+    // before sleeping, so the wakeup cannot be lost.
+    if (_consumerWaiting.load()) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _notEmptyCV.notify_one();
+    }
+
+    if (_counters) {
+        _counters->incrementN(count, size);
+    }
+}
+
+void OplogBufferRingBuffer::waitForSpace(OperationContext* opCtx, const Cost& cost) {
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    // This buffer has no limit for count.
+    _waitForSpace(lk, cost.size);
+}
+
+bool OplogBufferRingBuffer::isEmpty() const {
+    return _ringEmpty();
+}
+
+std::size_t OplogBufferRingBuffer::getSize() const {
+    return _curSize.load();
+}
+
+std::size_t OplogBufferRingBuffer::getCount() const {
+    return _curCount.load();
+}
+
+void OplogBufferRingBuffer::clear(OperationContext*) {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _clear(lk);
+    }
+
+    if (_counters) {
+        _counters->clear();
+    }
+}
+
+bool OplogBufferRingBuffer::tryPopBatch(OperationContext* opCtx, OplogBatch<Value>* batch) {
+    auto tail = _tail.load();
+    if (tail == _head.load()) {
+        return false;
+    }
+
+    // Empty the slot before advancing _tail, which hands it back to the producer.
+    auto& slot = _ring[tail % kNumSlots];
+    *batch = std::move(slot);
+    slot = {};
+    _tail.store(tail + 1);
+    _curSize.fetchAndSubtract(batch->byteSize());
+    _curCount.fetchAndSubtract(batch->count());
+
+    // Only notify the producer if it is blocked on space and enough space is now
+    // available. If the producer sets _waitSize after we load it here, it re-checks
+    // for space under the mutex before sleeping, so the wakeup cannot be lost.
+    auto waitSize = _waitSize.load();
+    if (waitSize > 0 && _hasSpace(waitSize)) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _notFullCV.notify_one();
+    }
+
+    if (_counters) {
+        _counters->decrementN(batch->count(), batch->byteSize());
+    }
+
+    return true;
+}
+
+bool OplogBufferRingBuffer::waitForDataFor(Milliseconds waitDuration,
+                                           Interruptible* interruptible) {
+    // Spin briefly before sleeping. When the producer is keeping up this avoids both the
+    // mutex and the futex round trip of the condition variable on every handoff.
+    for (std::size_t i = 0; i < _spinBudget; ++i) {
+        if (_hasDataOrIsStopped()) {
+            _spinBudget = std::min(_spinBudget * 2, kMaxSpins);
+            return !_ringEmpty();
+        }
+        MONGO_YIELD_CORE_FOR_SMT();
+    }
+    _spinBudget = kMinSpins;
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    _consumerWaiting.store(true);
+    ScopeGuard clearWaiting([&] { _consumerWaiting.store(false); });
+
+    interruptible->waitForConditionOrInterruptFor(
+        _notEmptyCV, lk, waitDuration, [this] { return _hasDataOrIsStopped(); });
+
+    return !_ringEmpty();
+}
+
+bool OplogBufferRingBuffer::waitForDataUntil(Date_t deadline, Interruptible* interruptible) {
+    for (std::size_t i = 0; i < _spinBudget; ++i) {
+        if (_hasDataOrIsStopped()) {
+            _spinBudget = std::min(_spinBudget * 2, kMaxSpins);
+            return !_ringEmpty();
+        }
+        MONGO_YIELD_CORE_FOR_SMT();
+    }
+    _spinBudget = kMinSpins;
+
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    _consumerWaiting.store(true);
+    ScopeGuard clearWaiting([&] { _consumerWaiting.store(false); });
+
+    interruptible->waitForConditionOrInterruptUntil(
+        _notEmptyCV, lk, deadline, [this] { return _hasDataOrIsStopped(); });
+
+    return !_ringEmpty();
+}
+
+void OplogBufferRingBuffer::enterDrainMode() {
+    _drainMode.store(true);
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    _notEmptyCV.notify_one();
+}
+
+void OplogBufferRingBuffer::exitDrainMode() {
+    _drainMode.store(false);
+}
+
+bool OplogBufferRingBuffer::_hasSpace(std::size_t size) const {
+    if (_ringFull()) {
+        return false;
+    }
+    // Allow any cost if the buffer is empty, caller should do appropriate batching.
+    return _curSize.load() + size <= _maxSize || _ringEmpty();
+}
+
+bool OplogBufferRingBuffer::_hasDataOrIsStopped() const {
+    return !_ringEmpty() || _drainMode.load() || _isShutdown.load();
+}
+
+void OplogBufferRingBuffer::_waitForSpace(stdx::unique_lock<stdx::mutex>& lk, std::size_t size) {
+    invariant(size > 0);
+    invariant(!_waitSize.load());
+
+    // We only support one concurrent producer. Re-check for space after publishing
+    // _waitSize so a pop that happened in between cannot be missed.
+    while (!_isShutdown.load()) {
+        _waitSize.store(size);
+        if (_hasSpace(size)) {
+            break;
+        }
+        _notFullCV.wait(lk);
+    }
+    _waitSize.store(0);
+}
+
+void OplogBufferRingBuffer::_clear(WithLock lk) {
+    auto head = _head.load();
+    for (auto tail = _tail.load(); tail != head; ++tail) {
+        _ring[tail % kNumSlots] = {};
+    }
+    _tail.store(head);
+    _curSize.store(0);
+    _curCount.store(0);
+    _notFullCV.notify_one();
+    _notEmptyCV.notify_one();
+}
+
+}  // namespace repl
+}  // namespace mongo
@@ -0,0 +1,170 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "mongo/db/repl/oplog_buffer.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+
+namespace mongo {
+namespace repl {
+
+/**
+ * Oplog buffer backed by a bounded, in-memory ring of batches that supports batched
+ * operations like tryPopBatch() but does not support point operations like peek(),
+ * tryPop().
+ *
+ * Unlike OplogBufferBatchedQueue, the fast paths of push() and tryPopBatch() do not
+ * take a mutex. The producer and consumer synchronize through atomic head and tail
+ * positions into a fixed array of batch slots, and only fall back to a mutex and
+ * condition variable after the buffer has been full or empty for a while. This cuts
+ * the producer-consumer handoff cost between the oplog fetcher and the batcher at
+ * high replication throughput, where the mutex would otherwise be bounced between
+ * the two threads on every batch.
+ *
+ * Values of this buffer are stored in batches and popped out in batches, in the same
+ * way as they were pushed in. An important assumption is that each batch pushed into
+ * the buffer is not too large in byte size, normally less than 16MB.
+ *
+ * Note: This buffer only works for single-producer, single-consumer use cases.
+ * Additionally, clear() and shutdown() may race with a push() or tryPopBatch() that
+ * is already past its blocking phase, so they should only be called once the producer
+ * and consumer are quiesced, which is how the replication machinery already uses
+ * oplog buffers during state transitions.
+ */
+class OplogBufferRingBuffer final : public OplogBuffer {
+public:
+    /**
+     * Number of batch slots in the ring, which bounds how many batches can be buffered
+     * at once. The byte budget passed to the constructor is normally the limiting
+     * factor; this only needs to be large enough that a burst of small batches does
+     * not fill the ring before the byte budget is reached.
+     */
+    static constexpr std::size_t kNumSlots = 256;
+
+    explicit OplogBufferRingBuffer(std::size_t maxSize);
+    OplogBufferRingBuffer(std::size_t maxSize, Counters* counters);
+
+    void startup(OperationContext* opCtx) override;
+    void shutdown(OperationContext* opCtx) override;
+    void push(OperationContext* opCtx,
+              Batch::const_iterator begin,
+              Batch::const_iterator end,
+              boost::optional<const Cost&> cost = boost::none) override;
+    void waitForSpace(OperationContext* opCtx, const Cost& cost) override;
+    bool isEmpty() const override;
+    std::size_t getSize() const override;
+    std::size_t getCount() const override;
+    void clear(OperationContext* opCtx) override;
+    bool tryPop(OperationContext* opCtx, Value* value) override {
+        MONGO_UNIMPLEMENTED;
+    }
+    bool tryPopBatch(OperationContext* opCtx, OplogBatch<Value>* batch) override;
+    bool waitForDataFor(Milliseconds waitDuration, Interruptible* interruptible) override;
+    bool waitForDataUntil(Date_t deadline, Interruptible* interruptible) override;
+    bool peek(OperationContext* opCtx, Value* value) override {
+        MONGO_UNIMPLEMENTED;
+    }
+    boost::optional<Value> lastObjectPushed(OperationContext* opCtx) const override {
+        MONGO_UNIMPLEMENTED;
+    };
+
+    // In drain mode, the queue does not block. It is the responsibility of the caller to ensure
+    // that no items are added to the queue while in drain mode; this is enforced by invariant().
+    void enterDrainMode() final;
+    void exitDrainMode() final;
+
+private:
+    // Bounds for the consumer's spin budget. The budget adapts within these bounds: it
+    // grows while the producer keeps up, so back-to-back batches are handed over without
+    // a sleep, and resets to the minimum whenever a spin ends in a sleep so an idle
+    // consumer does not burn CPU.
+    static constexpr std::size_t kMinSpins = 32;
+    static constexpr std::size_t kMaxSpins = 4096;
+
+    bool _ringEmpty() const {
+        return _tail.load() == _head.load();
+    }
+
+    bool _ringFull() const {
+        return _head.load() - _tail.load() == kNumSlots;
+    }
+
+    bool _hasSpace(std::size_t size) const;
+    bool _hasDataOrIsStopped() const;
+    void _waitForSpace(stdx::unique_lock<stdx::mutex>& lk, std::size_t size);
+    void _clear(WithLock lk);
+
+    const std::size_t _maxSize;
+    Counters* const _counters;
+
+    // Ring storage. The slot for ring position 'p' is _ring[p % kNumSlots]. Slots in
+    // [_tail, _head) hold pushed batches and are owned by the consumer, all other
+    // slots are owned by the producer.
+    std::vector<OplogBatch<Value>> _ring{kNumSlots};
+
+    // The producer advances _head after filling a slot and the consumer advances _tail
+    // after taking one, so each position is only written by its owner. Loads and stores
+    // are seq_cst, which also orders them against the waiting flags below so wakeups
+    // are not lost.
+    AtomicWord<uint64_t> _head{0};
+    AtomicWord<uint64_t> _tail{0};
+
+    AtomicWord<std::size_t> _curSize{0};
+    AtomicWord<std::size_t> _curCount{0};
+
+    AtomicWord<bool> _drainMode{false};
+    AtomicWord<bool> _isShutdown{false};
+
+    // Nonzero while the producer is blocked in _waitForSpace(), holding the size of the
+    // pending push. The consumer only touches the mutex to wake the producer when this
+    // is set and enough space has been freed.
+    AtomicWord<std::size_t> _waitSize{0};
+
+    // True while the consumer is blocked in waitForDataFor()/waitForDataUntil(). The
+    // producer only touches the mutex to wake the consumer when this is set.
+    AtomicWord<bool> _consumerWaiting{false};
+
+    // Only touched by the consumer thread.
+    std::size_t _spinBudget = kMinSpins;
+
+    // The mutex only serializes the slow paths above with each other and with
+    // clear()/shutdown(); neither fast path acquires it.
+    mutable stdx::mutex _mutex;
+    stdx::condition_variable _notEmptyCV;
+    stdx::condition_variable _notFullCV;
+};
+
+}  // namespace repl
+}  // namespace mongo
@@ -252,6 +252,7 @@ OplogFetcher::OplogFetcher(executor::TaskExecutor* executor,
 OplogFetcher::~OplogFetcher() {
     shutdown();
     join();
+    _joinReadAheadThread();
 }
 
 void OplogFetcher::setConnection(std::unique_ptr<DBClientConnection>&& _connectedClient) {
@@ -436,7 +437,7 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             return;
         }
 
-        auto batchResult = _getNextBatch();
+        auto batchResult = _readNextBatch();
         if (!batchResult.isOK()) {
             auto brStatus = batchResult.getStatus();
             // Determine if we should stop syncing from our current sync source. If we're going
@@ -457,8 +458,19 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             }
         }
 
+        const auto& batch = batchResult.getValue();
+
+        // Post the network read of the next batch to the read-ahead thread before validating and
+        // enqueueing this one, so the read (and the decompression of the response) overlaps with
+        // batch processing. The first batch is processed before any read-ahead is posted since
+        // processing it may discover that we need a different sync source, and a dead cursor has
+        // nothing left to read.
+        if (oplogFetcherReadAheadEnabled && !_firstBatch && !batch.cursorIsDead) {
+            _postReadAheadRequest();
+        }
+
         // This will advance our view of _lastFetched.
-        status = _onSuccessfulBatch(batchResult.getValue());
+        status = _onSuccessfulBatch(batch);
         if (!status.isOK()) {
             // The stopReplProducer fail point expects this to return successfully. If another fail
             // point wants this to return unsuccessfully, it should use a different error code.
@@ -471,8 +483,8 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             return;
         }
 
-        if (_cursor->isDead()) {
-            if (!_cursor->tailable()) {
+        if (batch.cursorIsDead) {
+            if (!batch.cursorIsTailable) {
                 try {
                     auto opCtx = cc().makeOperationContext();
                     stdx::unique_lock<stdx::mutex> lk(_mutex);
@@ -680,8 +692,8 @@ Status OplogFetcher::_createNewCursor(bool initialFind) {
     return Status::OK();
 }
 
-StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
-    Documents batch;
+StatusWith<OplogFetcher::Batch> OplogFetcher::_getNextBatch() {
+    Batch batch;
     try {
         Timer timer;
         if (!_cursor) {
@@ -745,12 +757,20 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
             _cursor->more();
         }
         while (_cursor->moreInCurrentBatch()) {
-            batch.emplace_back(_cursor->nextSafe());
+            batch.documents.emplace_back(_cursor->nextSafe());
         }
 
+        // Capture the per-response state needed to process this batch. The reply metadata, the
+        // post-batch resume token and the cursor state would otherwise be overwritten once the
+        // next batch's read is posted to the read-ahead thread.
+        batch.metadataObj = _metadataObj;
+        batch.postBatchResumeToken = _cursor->getPostBatchResumeToken();
+        batch.cursorIsDead = _cursor->isDead();
+        batch.cursorIsTailable = _cursor->tailable();
+
         // This value is only used on a successful batch for metrics.repl.network.getmores. This
         // metric intentionally tracks the time taken by the initial find as well.
-        _lastBatchElapsedMS = timer.millis();
+        batch.elapsedMS = timer.millis();
     } catch (const DBException& ex) {
         if (_cursor->connectionHasPendingReplies()) {
             // Close the connection because the connection cannot be used anymore as more data is on
@@ -764,7 +784,69 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
     return batch;
 }
 
-Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
+StatusWith<OplogFetcher::Batch> OplogFetcher::_readNextBatch() {
+    stdx::unique_lock<stdx::mutex> lk(_readAheadMutex);
+    if (!_readAheadRequested && !_readAheadResult) {
+        // No read-ahead is outstanding, so this thread owns the cursor and can read directly.
+        lk.unlock();
+        return _getNextBatch();
+    }
+    _readAheadCondVar.wait(lk, [&] { return static_cast<bool>(_readAheadResult); });
+    auto result = std::move(*_readAheadResult);
+    _readAheadResult = boost::none;
+    return result;
+}
+
+void OplogFetcher::_postReadAheadRequest() {
+    stdx::lock_guard<stdx::mutex> lk(_readAheadMutex);
+    invariant(!_readAheadRequested && !_readAheadResult);
+    if (!_readAheadThread.joinable()) {
+        _readAheadThread = stdx::thread([this] { _runReadAhead(); });
+    }
+    _readAheadRequested = true;
+    _readAheadCondVar.notify_all();
+}
+
+void OplogFetcher::_runReadAhead() {
+    Client::initThread("OplogFetcherReadAhead", getGlobalServiceContext()->getService());
+    while (true) {
+        {
+            stdx::unique_lock<stdx::mutex> lk(_readAheadMutex);
+            _readAheadCondVar.wait(lk, [&] { return _readAheadRequested || _readAheadShutdown; });
+            if (_readAheadShutdown) {
+                return;
+            }
+        }
+
+        // The read is performed outside the lock; the handshake guarantees that the fetcher
+        // thread does not touch the cursor until the result below is delivered.
+        auto result = _getNextBatch();
+
+        stdx::lock_guard<stdx::mutex> lk(_readAheadMutex);
+        _readAheadResult = std::move(result);
+        _readAheadRequested = false;
+        _readAheadCondVar.notify_all();
+    }
+}
+
+void OplogFetcher::_joinReadAheadThread() {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_readAheadMutex);
+        _readAheadShutdown = true;
+        _readAheadCondVar.notify_all();
+    }
+    if (_readAheadThread.joinable()) {
+        // Interrupt the read-ahead thread in case it is blocked reading off the network.
+        if (_conn) {
+            _conn->shutdownAndDisallowReconnect();
+        }
+        _readAheadThread.join();
+    }
+}
+
+Status OplogFetcher::_onSuccessfulBatch(const Batch& batch) {
+    const auto& documents = batch.documents;
+
     hangBeforeProcessingSuccessfulBatch.pauseWhileSet();
 
     if (_isShuttingDown()) {
@@ -821,13 +903,13 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         LOGV2_DEBUG(21271, 2, "Oplog fetcher read 0 operations from remote oplog");
     }
 
-    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(_metadataObj);
+    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(batch.metadataObj);
     if (!oqMetadataResult.isOK()) {
         LOGV2_ERROR(21278,
                     "Invalid oplog query metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = oqMetadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return oqMetadataResult.getStatus();
     }
     const auto& oqMetadata = oqMetadataResult.getValue();
@@ -883,13 +965,13 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     // Process replset metadata.  It is important that this happen after we've validated the
     // first batch, so we don't progress our knowledge of the commit point from a
     // response that triggers a rollback.
-    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(_metadataObj);
+    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(batch.metadataObj);
     if (!metadataResult.isOK()) {
         LOGV2_ERROR(21279,
                     "Invalid replication metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = metadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return metadataResult.getStatus();
     }
     const auto& replSetMetadata = metadataResult.getValue();
@@ -921,12 +1003,12 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     opsReadStats.increment(info.networkDocumentCount);
     networkByteStats.increment(info.networkDocumentBytes);
 
-    oplogBatchStats.recordMillis(_lastBatchElapsedMS, documents.empty());
+    oplogBatchStats.recordMillis(batch.elapsedMS, documents.empty());
 
-    if (_cursor->getPostBatchResumeToken()) {
+    if (batch.postBatchResumeToken) {
         auto pbrt =
             ResumeTokenOplogTimestamp::parse(IDLParserContext("OplogFetcher PostBatchResumeToken"),
-                                             *_cursor->getPostBatchResumeToken());
+                                             *batch.postBatchResumeToken);
         info.resumeToken = pbrt.getTs();
     }
 
@@ -963,7 +1045,11 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         _lastFetched = lastDocOpTime;
     }
 
-    _firstBatch = false;
+    // Only write '_firstBatch' when it actually changes. While it is true no read-ahead can be
+    // outstanding, so the write cannot race with the read-ahead thread reading the flag.
+    if (_firstBatch) {
+        _firstBatch = false;
+    }
     return Status::OK();
 }
 
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -54,6 +55,7 @@
 #include "mongo/executor/task_executor.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/net/hostandport.h"
@@ -338,6 +340,29 @@ private:
 
     // ============= End AbstractAsyncComponent overrides ==============
 
+    /**
+     * One batch of operations read off the cursor, together with the per-response state that
+     * processing the batch needs. That state is captured when the response is read because the
+     * next batch's network read may already be running on the read-ahead thread, overwriting the
+     * cursor's view of it, while this batch is validated and enqueued.
+     */
+    struct Batch {
+        Documents documents;
+
+        // The reply metadata received with this batch's response.
+        BSONObj metadataObj;
+
+        // The post-batch resume token carried by this batch's response, if any.
+        boost::optional<BSONObj> postBatchResumeToken;
+
+        // Time spent reading this batch off the network, for serverStatus metrics.
+        int elapsedMS = 0;
+
+        // The state of the cursor right after this batch was read.
+        bool cursorIsDead = false;
+        bool cursorIsTailable = false;
+    };
+
     /**
      * Creates a DBClientConnection and executes a query to retrieve oplog entries from this node's
      * sync source. This will create a tailable, awaitData, exhaust cursor which will be used until
@@ -392,7 +417,32 @@ private:
      * shouldContinue function to see if it should create a new cursor and if so, calls
      * _createNewCursor.
      */
-    StatusWith<Documents> _getNextBatch();
+    StatusWith<Batch> _getNextBatch();
+
+    /**
+     * Returns the next batch to process. Takes the result of the posted read-ahead if one is
+     * outstanding, otherwise reads the batch directly on this thread.
+     */
+    StatusWith<Batch> _readNextBatch();
+
+    /**
+     * Posts the network read of the next batch to the read-ahead thread, starting the thread on
+     * first use. The read-ahead thread performs the read — including decompression of the
+     * response — while the current batch is validated and enqueued on this thread. Must not be
+     * called while another read-ahead is outstanding.
+     */
+    void _postReadAheadRequest();
+
+    /**
+     * Body of the read-ahead thread. Waits for a posted request, reads one batch off the cursor
+     * and publishes the result, until told to shut down.
+     */
+    void _runReadAhead();
+
+    /**
+     * Signals the read-ahead thread to exit and joins it.
+     */
+    void _joinReadAheadThread();
 
     /**
      * Function called by the oplog fetcher when it gets a successful batch from the sync source.
@@ -400,7 +450,7 @@ private:
      *
      * On failure returns a status that will be passed to _finishCallback.
      */
-    Status _onSuccessfulBatch(const Documents& documents);
+    Status _onSuccessfulBatch(const Batch& batch);
 
     /**
      * Notifies caller that the oplog fetcher has completed processing operations from the remote
@@ -492,7 +542,24 @@ private:
     // Handle to currently scheduled _runQuery task.
     executor::TaskExecutor::CallbackHandle _runQueryHandle;
 
-    int _lastBatchElapsedMS = 0;
+    // Reads the next batch off the cursor while the current batch is validated and enqueued.
+    // Started lazily by the first read-ahead request and joined on destruction. The thread only
+    // touches '_cursor' and '_conn' between a posted request and the delivery of its result, so
+    // the two threads never use the connection concurrently.
+    stdx::thread _readAheadThread;
+
+    // Protects the read-ahead request/result handshake below.
+    stdx::mutex _readAheadMutex;
+    stdx::condition_variable _readAheadCondVar;
+
+    // True while a read posted to the read-ahead thread has not completed yet.
+    bool _readAheadRequested = false;
+
+    // Makes the read-ahead thread exit once its current read, if any, completes.
+    bool _readAheadShutdown = false;
+
+    // The result of the last posted read, waiting to be picked up by _readNextBatch.
+    boost::optional<StatusWith<Batch>> _readAheadResult;
 
     // Condition to be notified on shutdown.
     stdx::condition_variable _shutdownCondVar;
@@ -377,17 +377,43 @@ void ReplicationCoordinatorImpl::WriteConcernWaiterList::setValueIf(
     std::size_t erased = 0;
     for (auto& waiterListEntry : _waiters) {
         auto& waiterList = waiterListEntry.second;
+
+        // The waiters within the opTime bound, if any, are the only candidates to fulfill.
+        auto boundEnd = opTime ? waiterList.upper_bound(*opTime) : waiterList.end();
+        if (boundEnd == waiterList.begin()) {
+            continue;
+        }
+
+        // The predicate is monotonic in opTime for a fixed write concern, so if the last
+        // candidate is satisfied then the entire prefix is. This is the common case when the
+        // commit point advances and fulfills a whole bucket of waiters with a single predicate
+        // evaluation, which scans the member topology, instead of one evaluation per waiter.
+        bool wholePrefixSatisfied = false;
+        try {
+            wholePrefixSatisfied = func(lk, std::prev(boundEnd)->first, waiterListEntry.first);
+        } catch (const DBException&) {
+            // Fall through to the per-waiter loop below so that each waiter observes the same
+            // error it would have seen if evaluated individually.
+        }
+
         auto it = waiterList.begin();
-        for (; it != waiterList.end() && (!opTime || it->first <= *opTime); ++it) {
-            const auto& waiter = it->second;
-            try {
-                if (!func(lk, it->first, waiterListEntry.first))
-                    break;
-                waiter->promise.emplaceValue();
-            } catch (const DBException& e) {
-                waiter->promise.setError(e.toStatus());
+        if (wholePrefixSatisfied) {
+            for (; it != boundEnd; ++it) {
+                it->second->promise.emplaceValue();
+                ++erased;
+            }
+        } else {
+            for (; it != boundEnd; ++it) {
+                const auto& waiter = it->second;
+                try {
+                    if (!func(lk, it->first, waiterListEntry.first))
+                        break;
+                    waiter->promise.emplaceValue();
+                } catch (const DBException& e) {
+                    waiter->promise.setError(e.toStatus());
+                }
+                ++erased;
             }
-            ++erased;
         }
         waiterList.erase(waiterList.begin(), it);
     }
@@ -948,7 +948,8 @@ private:
         // Signals all waiters whose opTime is <= the given opTime (if any) that satisfy the
         // condition in func.  The func must have the property that, for any given
         // WriteConcernOptions, there is some optime T such that func returns true for all
-        // optimes <= T, and false for all optimes > T.
+        // optimes <= T, and false for all optimes > T.  This property is relied upon to
+        // fulfill a whole bucket of satisfied waiters with a single evaluation of func.
         void setValueIf(
             WithLock lk,
             std::function<bool(WithLock, const OpTime&, const WriteConcernOptions&)> func,
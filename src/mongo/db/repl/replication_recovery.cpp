@@ -34,6 +34,7 @@
 #include <boost/none.hpp>
 #include <boost/optional.hpp>
 #include <cstddef>
+#include <deque>
 #include <exception>
 #include <memory>
 #include <string>
@@ -52,6 +53,7 @@
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog_raii.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
@@ -93,6 +95,9 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
@@ -193,64 +198,61 @@ private:
 };
 
 /**
- * OplogBuffer adaptor for a DBClient query on the oplog.
+ * OplogBuffer adaptor that prefetches the recovery range of the local oplog.
  * Implements only functions used by OplogApplier::getNextApplierBatch().
+ *
+ * A dedicated read-ahead thread scans the oplog with its own OperationContext and stages the
+ * entries in a bounded in-memory buffer, so the scan and the I/O it performs overlap with batch
+ * application on the caller's thread instead of alternating with it.
  */
 class OplogBufferLocalOplog final : public OplogBuffer {
 public:
+    // Maximum amount of oplog data, in bytes, the read-ahead thread keeps buffered ahead of
+    // application before it blocks.
+    static constexpr std::size_t kMaxReadAheadBytes = 64 * 1024 * 1024;
+
     explicit OplogBufferLocalOplog(Timestamp oplogApplicationStartPoint,
                                    boost::optional<Timestamp> oplogApplicationEndPoint)
         : _oplogApplicationStartPoint(oplogApplicationStartPoint),
           _oplogApplicationEndPoint(oplogApplicationEndPoint) {}
 
+    ~OplogBufferLocalOplog() override {
+        // Stop the read-ahead thread if we are destroyed without an explicit shutdown(), e.g.
+        // when batch application fails and unwinds the recovery stack.
+        if (_readAheadThread.joinable()) {
+            shutdown(nullptr);
+        }
+    }
+
     void startup(OperationContext* opCtx) final {
         invariant(shard_role_details::getRecoveryUnit(opCtx)->getTimestampReadSource() ==
                   RecoveryUnit::ReadSource::kNoTimestamp);
 
-        _client = std::make_unique<DBDirectClient>(opCtx);
-        BSONObj predicate = _oplogApplicationEndPoint
-            ? BSON("$gte" << _oplogApplicationStartPoint << "$lte" << *_oplogApplicationEndPoint)
-            : BSON("$gte" << _oplogApplicationStartPoint);
-        FindCommandRequest findRequest{NamespaceString::kRsOplogNamespace};
-        findRequest.setFilter(BSON("ts" << predicate));
-        // Don't kill the cursor just because applying a batch oplog takes a long time.
-        findRequest.setNoCursorTimeout(true);
-        _cursor = _client->find(std::move(findRequest));
+        _readAheadThread = stdx::thread([this] { _runReadAhead(); });
 
-        // Check that the first document matches our appliedThrough point then skip it since it's
-        // already been applied.
-        if (!_cursor->more()) {
-            // This should really be impossible because we check above that the top of the oplog is
-            // strictly > appliedThrough. If this fails it represents a serious bug in either the
-            // storage engine or query's implementation of the oplog scan.
-            logv2::DynamicAttributes attrs;
-            attrs.add("oplogApplicationStartPoint", _oplogApplicationStartPoint.toBSON());
-            if (_oplogApplicationEndPoint) {
-                attrs.add("oplogApplicationEndPoint", _oplogApplicationEndPoint->toBSON());
-            }
-
-            LOGV2_FATAL_NOTRACE(
-                40293, "Couldn't find any entries in the oplog, which should be impossible", attrs);
-        }
-
-        _opTimeAtStartPoint = fassert(40291, OpTime::parseFromOplogEntry(_cursor->nextSafe()));
-        const auto firstTimestampFound = _opTimeAtStartPoint.getTimestamp();
-        if (firstTimestampFound != _oplogApplicationStartPoint) {
-            LOGV2_FATAL_NOTRACE(40292,
-                                "Oplog entry at oplogApplicationStartPoint is missing",
-                                "oplogApplicationStartPoint"_attr =
-                                    _oplogApplicationStartPoint.toBSON(),
-                                "firstTimestampFound"_attr = firstTimestampFound.toBSON());
-        }
+        // Wait for the read-ahead thread to locate and validate the entry at the start point so
+        // that, as before, startup() does not return successfully unless the scan is positioned
+        // past the already-applied start point.
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _cv.wait(lk, [this] { return _startPointValidated; });
     }
 
     void shutdown(OperationContext*) final {
-        _cursor = {};
-        _client = {};
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            _shutdown = true;
+            _cv.notify_all();
+        }
+        _readAheadThread.join();
     }
 
     bool isEmpty() const final {
-        return !_cursor->more();
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        // Block until we can give a definitive answer: either an entry is buffered or the
+        // read-ahead thread has exhausted the scan. The cursor-backed implementation had the
+        // same behavior, since checking for more entries could block on a getMore.
+        _cv.wait(lk, [this] { return !_buffer.empty() || _done; });
+        return _buffer.empty();
     }
 
     bool tryPop(OperationContext*, Value* value) final {
@@ -295,20 +297,108 @@ public:
 
 private:
     enum class Mode { kPeek, kPop };
+
     bool _peekOrPop(Value* value, Mode mode) {
-        if (isEmpty()) {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _cv.wait(lk, [this] { return !_buffer.empty() || _done; });
+        if (_buffer.empty()) {
             return false;
         }
-        *value = mode == Mode::kPeek ? _cursor->peekFirst() : _cursor->nextSafe();
+        if (mode == Mode::kPeek) {
+            *value = _buffer.front();
+        } else {
+            *value = std::move(_buffer.front());
+            _buffer.pop_front();
+            _bufferedBytes -= value->objsize();
+            // Wake the read-ahead thread if it is blocked on a full buffer.
+            _cv.notify_all();
+        }
         invariant(!value->isEmpty());
         return true;
     }
 
+    void _runReadAhead() {
+        Client::initThread("ReplRecoveryOplogReadAhead",
+                           getGlobalServiceContext()->getService(ClusterRole::ShardServer),
+                           Client::noSession(),
+                           ClientOperationKillableByStepdown{false});
+        auto opCtx = cc().makeOperationContext();
+
+        DBDirectClient client(opCtx.get());
+        BSONObj predicate = _oplogApplicationEndPoint
+            ? BSON("$gte" << _oplogApplicationStartPoint << "$lte" << *_oplogApplicationEndPoint)
+            : BSON("$gte" << _oplogApplicationStartPoint);
+        FindCommandRequest findRequest{NamespaceString::kRsOplogNamespace};
+        findRequest.setFilter(BSON("ts" << predicate));
+        // Don't kill the cursor just because applying a batch oplog takes a long time.
+        findRequest.setNoCursorTimeout(true);
+        auto cursor = client.find(std::move(findRequest));
+
+        // Check that the first document matches our appliedThrough point then skip it since it's
+        // already been applied.
+        if (!cursor->more()) {
+            // This should really be impossible because we check above that the top of the oplog is
+            // strictly > appliedThrough. If this fails it represents a serious bug in either the
+            // storage engine or query's implementation of the oplog scan.
+            logv2::DynamicAttributes attrs;
+            attrs.add("oplogApplicationStartPoint", _oplogApplicationStartPoint.toBSON());
+            if (_oplogApplicationEndPoint) {
+                attrs.add("oplogApplicationEndPoint", _oplogApplicationEndPoint->toBSON());
+            }
+
+            LOGV2_FATAL_NOTRACE(
+                40293, "Couldn't find any entries in the oplog, which should be impossible", attrs);
+        }
+
+        auto opTimeAtStartPoint = fassert(40291, OpTime::parseFromOplogEntry(cursor->nextSafe()));
+        const auto firstTimestampFound = opTimeAtStartPoint.getTimestamp();
+        if (firstTimestampFound != _oplogApplicationStartPoint) {
+            LOGV2_FATAL_NOTRACE(40292,
+                                "Oplog entry at oplogApplicationStartPoint is missing",
+                                "oplogApplicationStartPoint"_attr =
+                                    _oplogApplicationStartPoint.toBSON(),
+                                "firstTimestampFound"_attr = firstTimestampFound.toBSON());
+        }
+
+        {
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            _opTimeAtStartPoint = opTimeAtStartPoint;
+            _startPointValidated = true;
+            _cv.notify_all();
+        }
+
+        while (cursor->more()) {
+            // Own the entry since the cursor's current batch is released on the next getMore.
+            auto entry = cursor->nextSafe().getOwned();
+            stdx::unique_lock<stdx::mutex> lk(_mutex);
+            _cv.wait(lk, [this] { return _shutdown || _bufferedBytes < kMaxReadAheadBytes; });
+            if (_shutdown) {
+                break;
+            }
+            _bufferedBytes += entry.objsize();
+            _buffer.push_back(std::move(entry));
+            _cv.notify_all();
+        }
+
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _done = true;
+        _cv.notify_all();
+    }
+
     const Timestamp _oplogApplicationStartPoint;
     const boost::optional<Timestamp> _oplogApplicationEndPoint;
+    // Set by the read-ahead thread before '_startPointValidated' and immutable after startup().
     OpTime _opTimeAtStartPoint;
-    std::unique_ptr<DBDirectClient> _client;
-    std::unique_ptr<DBClientCursor> _cursor;
+
+    // Guards all following state shared with the read-ahead thread.
+    mutable stdx::mutex _mutex;
+    mutable stdx::condition_variable _cv;
+    std::deque<BSONObj> _buffer;
+    std::size_t _bufferedBytes = 0;
+    bool _startPointValidated = false;
+    bool _done = false;
+    bool _shutdown = false;
+    stdx::thread _readAheadThread;
 };
 
 boost::optional<Timestamp> recoverFromOplogPrecursor(OperationContext* opCtx,
@@ -124,7 +124,7 @@ using std::map;
 using std::string;
 using std::vector;
 
-using MigrationsAndResponses = std::vector<std::pair<const MigrateInfo&, SemiFuture<void>>>;
+using MigrationsAndResponses = std::vector<std::pair<const MigrateInfo&, SharedSemiFuture<void>>>;
 
 namespace {
 
@@ -220,7 +220,7 @@ public:
         : _opCtx(opCtx), _scheduler(scheduler), _numCompleted(0) {
         _migrationsAndResponses.reserve(migrations.size());
         for (const MigrateInfo& x : migrations) {
-            _migrationsAndResponses.emplace_back(x, SemiFuture<void>());
+            _migrationsAndResponses.emplace_back(x, SharedSemiFuture<void>());
         }
     }
 
@@ -386,14 +386,15 @@ void enqueueCollectionMigrations(OperationContext* opCtx,
     };
 
     for (auto& migrationAndResponse : migrationsAndResponses) {
-        migrationAndResponse.second = requestMigration(migrationAndResponse.first);
+        migrationAndResponse.second = requestMigration(migrationAndResponse.first).share();
     }
 }
 
 void enqueueChunkMigrations(OperationContext* opCtx,
                             BalancerCommandsScheduler& scheduler,
                             MigrationsAndResponses& migrationsAndResponses) {
-    auto requestMigration = [&](const MigrateInfo& migrateInfo) -> SemiFuture<void> {
+    auto buildMoveRangeRequest =
+        [&](const MigrateInfo& migrateInfo) -> std::pair<ShardsvrMoveRange, WriteConcernOptions> {
         auto catalogClient = ShardingCatalogManager::get(opCtx)->localCatalogClient();
         auto balancerConfig = Grid::get(opCtx)->getBalancerConfiguration();
 
@@ -424,12 +425,43 @@ void enqueueChunkMigrations(OperationContext* opCtx,
             getSecondaryThrottleAndWriteConcern(balancerConfig->getSecondaryThrottle());
         shardSvrRequest.setSecondaryThrottle(secondaryThrottle);
 
-        return scheduler.requestMoveRange(
-            opCtx, shardSvrRequest, wc, false /* issuedByRemoteUser */);
+        return {std::move(shardSvrRequest), wc};
     };
 
+    // Migrations towards distinct donor/recipient pairs are submitted immediately and proceed in
+    // parallel. When the round's schedule contains several migrations for the same pair, they are
+    // chained into a per-pair pipeline: each one is submitted as soon as the previous one
+    // resolves, since a shard can only take part in one migration at a time.
+    const auto executor = Grid::get(opCtx)->getExecutorPool()->getFixedExecutor();
+    std::map<std::pair<ShardId, ShardId>, SharedSemiFuture<void>> pipelineTails;
+
     for (auto& migrationAndResponse : migrationsAndResponses) {
-        migrationAndResponse.second = requestMigration(migrationAndResponse.first);
+        const auto& migrateInfo = migrationAndResponse.first;
+        auto [request, wc] = buildMoveRangeRequest(migrateInfo);
+
+        const auto pipelineKey = std::make_pair(migrateInfo.from, migrateInfo.to);
+        auto tailIt = pipelineTails.find(pipelineKey);
+        if (tailIt == pipelineTails.end()) {
+            migrationAndResponse.second =
+                scheduler.requestMoveRange(opCtx, request, wc, false /* issuedByRemoteUser */)
+                    .share();
+        } else {
+            migrationAndResponse.second =
+                tailIt->second.thenRunOn(executor)
+                    .onCompletion(
+                        [&scheduler, request = std::move(request), wc = std::move(wc)](Status) {
+                            // The predecessor's outcome is handled by its own response processing;
+                            // the next migration of the pipeline is submitted regardless. The
+                            // submission only enqueues the command on the scheduler's own worker,
+                            // so a short-lived operation context is sufficient.
+                            auto opCtxHolder = cc().makeOperationContext();
+                            return scheduler.requestMoveRange(
+                                opCtxHolder.get(), request, wc, false /* issuedByRemoteUser */);
+                        })
+                    .semi()
+                    .share();
+        }
+        pipelineTails[pipelineKey] = migrationAndResponse.second.split();
     }
 }
 
@@ -647,7 +647,8 @@ StatusWith<MigrateInfosWithReason> BalancerChunkSelectionPolicy::_getMigrateCand
         distribution,
         collDataSizeInfo,
         availableShards,
-        Grid::get(opCtx)->getBalancerConfiguration()->attemptToBalanceJumboChunks());
+        Grid::get(opCtx)->getBalancerConfiguration()->attemptToBalanceJumboChunks(),
+        balancerMaxMigrationsPerDonorRecipientPair.load());
 }
 
 }  // namespace mongo
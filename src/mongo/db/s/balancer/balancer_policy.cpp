@@ -454,7 +454,8 @@ MigrateInfosWithReason BalancerPolicy::balance(
     const DistributionStatus& distribution,
     const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
     stdx::unordered_set<ShardId>* availableShards,
-    bool forceJumbo) {
+    bool forceJumbo,
+    int64_t maxMigrationsPerDonorRecipientPair) {
     vector<MigrateInfo> migrations;
     MigrationReason firstReason = MigrationReason::none;
 
@@ -729,7 +730,8 @@ MigrateInfosWithReason BalancerPolicy::balance(
                                                  &migrations,
                                                  availableShards,
                                                  forceJumbo ? ForceJumbo::kForceBalancer
-                                                            : ForceJumbo::kDoNotForce)) {
+                                                            : ForceJumbo::kDoNotForce,
+                                                 maxMigrationsPerDonorRecipientPair)) {
             if (firstReason == MigrationReason::none) {
                 firstReason = MigrationReason::chunksImbalance;
             }
@@ -747,7 +749,8 @@ bool BalancerPolicy::_singleZoneBalanceBasedOnDataSize(
     const int64_t idealDataSizePerShardForZone,
     vector<MigrateInfo>* migrations,
     stdx::unordered_set<ShardId>* availableShards,
-    ForceJumbo forceJumbo) {
+    ForceJumbo forceJumbo,
+    int64_t maxMigrationsPerDonorRecipientPair) {
     const auto [from, fromSize] =
         _getMostOverloadedShard(shardStats, collDataSizeInfo, zone, *availableShards);
     if (!from.isValid())
@@ -799,32 +802,52 @@ bool BalancerPolicy::_singleZoneBalanceBasedOnDataSize(
     const auto& fromShardId = from;
     const auto& toShardId = to;
 
+    // Schedule as many chunk-sized migrations between the selected pair of shards as can be
+    // performed without pushing the recipient above the ideal size or draining the donor below
+    // it, bounded by 'maxMigrationsPerDonorRecipientPair'. The resulting migrations form an
+    // ordered per-pair schedule and must be executed serially.
+    const auto numMigrationsToSchedule = [&]() -> int64_t {
+        if (collDataSizeInfo.maxChunkSizeBytes <= 0) {
+            return 1;
+        }
+        const auto transferrableDataSize = std::min(fromSize - idealDataSizePerShardForZone,
+                                                    idealDataSizePerShardForZone - toSize);
+        return std::clamp(transferrableDataSize / collDataSizeInfo.maxChunkSizeBytes,
+                          int64_t(1),
+                          maxMigrationsPerDonorRecipientPair);
+    }();
+
     unsigned numJumboChunks = 0;
+    int64_t numScheduled = 0;
 
-    const auto chunkFound =
-        !distribution.forEachChunkOnShardInZone(fromShardId, zone, [&](const auto& chunk) {
-            if (chunk.isJumbo()) {
-                numJumboChunks++;
-                return true;  // continue
-            }
+    distribution.forEachChunkOnShardInZone(fromShardId, zone, [&](const auto& chunk) {
+        if (chunk.isJumbo()) {
+            numJumboChunks++;
+            return true;  // continue
+        }
 
-            migrations->emplace_back(toShardId,
-                                     chunk.getShardId(),
-                                     distribution.nss(),
-                                     distribution.getChunkManager().getUUID(),
-                                     chunk.getMin(),
-                                     boost::none /* max */,
-                                     chunk.getLastmod(),
-                                     forceJumbo,
-                                     collDataSizeInfo.maxChunkSizeBytes);
-            tassert(8245231,
-                    "Source shard does not exist in available shards",
-                    availableShards->erase(chunk.getShardId()));
-            tassert(8245232,
-                    "Target shard does not exist in available shards",
-                    availableShards->erase(toShardId));
-            return false;  // break
-        });
+        migrations->emplace_back(toShardId,
+                                 chunk.getShardId(),
+                                 distribution.nss(),
+                                 distribution.getChunkManager().getUUID(),
+                                 chunk.getMin(),
+                                 boost::none /* max */,
+                                 chunk.getLastmod(),
+                                 forceJumbo,
+                                 collDataSizeInfo.maxChunkSizeBytes);
+        // Continue iterating until the pair's schedule is full.
+        return ++numScheduled < numMigrationsToSchedule;
+    });
+
+    const bool chunkFound = numScheduled > 0;
+    if (chunkFound) {
+        tassert(8245231,
+                "Source shard does not exist in available shards",
+                availableShards->erase(fromShardId));
+        tassert(8245232,
+                "Target shard does not exist in available shards",
+                availableShards->erase(toShardId));
+    }
 
     if (!chunkFound && numJumboChunks) {
         LOGV2_WARNING(6581602,
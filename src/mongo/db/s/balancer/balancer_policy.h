@@ -460,15 +460,18 @@ public:
      * Returns a suggested set of chunks or ranges to move within a collection's shards, given the
      * specified state of the shards (draining, max size reached, etc) and the number of chunks or
      * data size for that collection. If the policy doesn't recommend anything to move, it returns
-     * an empty vector. The entries in the vector do are all for separate source/destination shards
-     * and as such do not need to be done serially and can be scheduled in parallel.
+     * an empty vector. Entries for separate source/destination shard pairs do not need to be done
+     * serially and can be scheduled in parallel. When 'maxMigrationsPerDonorRecipientPair' is
+     * greater than one, the vector may contain several consecutive entries for the same
+     * source/destination pair; those form an ordered schedule and must be executed serially, since
+     * a shard can only take part in one migration at a time.
      *
      * The balancing logic calculates the optimum number of chunks per shard for each zone and if
      * any of the shards have chunks, which are sufficiently higher than this number, suggests
      * moving chunks to shards, which are under this number.
      *
      * The availableShards parameter is in/out and it contains the set of shards, which haven't
-     * been used for migrations yet. Used so we don't return multiple conflicting migrations for the
+     * been used for migrations yet. Used so we don't return conflicting migrations for the
      * same shard.
      */
     static MigrateInfosWithReason balance(
@@ -476,7 +479,8 @@ public:
         const DistributionStatus& distribution,
         const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
         stdx::unordered_set<ShardId>* availableShards,
-        bool forceJumbo);
+        bool forceJumbo,
+        int64_t maxMigrationsPerDonorRecipientPair = 1);
 
 private:
     /*
@@ -500,12 +504,14 @@ private:
         const stdx::unordered_set<ShardId>& availableShards);
 
     /**
-     * Selects one range for the specified zone (if appropriate) to be moved in order to bring the
-     * deviation of the collection data size closer to even across all shards in the specified
+     * Selects a donor/recipient shard pair for the specified zone (if appropriate) and schedules
+     * up to 'maxMigrationsPerDonorRecipientPair' ranges to be moved between them in order to bring
+     * the deviation of the collection data size closer to even across all shards in the specified
      * zone. Takes into account and updates the shards, which haven't been used for migrations yet.
      *
-     * Returns true if a migration was suggested, false otherwise. This method is intented to be
-     * called multiple times until all posible migrations for a zone have been selected.
+     * Returns true if at least one migration was suggested, false otherwise. This method is
+     * intented to be called multiple times until all posible migrations for a zone have been
+     * selected.
      */
     static bool _singleZoneBalanceBasedOnDataSize(
         const ShardStatisticsVector& shardStats,
@@ -515,7 +521,8 @@ private:
         int64_t idealDataSizePerShardForZone,
         std::vector<MigrateInfo>* migrations,
         stdx::unordered_set<ShardId>* availableShards,
-        ForceJumbo forceJumbo);
+        ForceJumbo forceJumbo,
+        int64_t maxMigrationsPerDonorRecipientPair);
 };
 
 }  // namespace mongo
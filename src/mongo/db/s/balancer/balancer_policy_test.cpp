@@ -419,6 +419,56 @@ TEST(BalancerPolicy, ParallelBalancingNotSchedulingOnInUseSourceShardsWithMoveNo
     ASSERT_EQ(0U, migrations.size());
 }
 
+TEST(BalancerPolicy, MultipleMigrationsScheduledPerDonorRecipientPair) {
+    // IdealDataSize = 50. The surplus of the donor and the headroom of the recipient both allow
+    // for 4 chunk-sized migrations, so the whole per-pair schedule is emitted at once.
+    auto [cluster, cm] = generateCluster(
+        {{100, 100 * kDefaultMaxChunkSizeBytes}, {0, 0 * kDefaultMaxChunkSizeBytes}});
+
+    auto availableShards = getAllShardIds(cluster.first);
+    const auto [migrations, reason] =
+        BalancerPolicy::balance(cluster.first.shardStats,
+                                makeDistStatus(cm),
+                                buildDataSizeInfoForBalancingFromShardStats(cluster.first),
+                                &availableShards,
+                                false /* forceJumbo */,
+                                4 /* maxMigrationsPerDonorRecipientPair */);
+
+    ASSERT_EQ(4U, migrations.size());
+    for (size_t i = 0; i < migrations.size(); i++) {
+        ASSERT_EQ(getShardId(0), migrations[i].from);
+        ASSERT_EQ(getShardId(1), migrations[i].to);
+        ASSERT_BSONOBJ_EQ(cluster.second[getShardId(0)][i].getMin(), migrations[i].minKey);
+    }
+    ASSERT_EQ(MigrationReason::chunksImbalance, reason);
+}
+
+TEST(BalancerPolicy, MultipleMigrationsPerPairCappedByRecipientHeadroom) {
+    // IdealDataSize = 40. The donor has a surplus of 80, but each recipient only has headroom for
+    // 40, so no more than one migration per chunk of headroom may be scheduled towards each.
+    auto [cluster, cm] = generateCluster({{120, 120 * kDefaultMaxChunkSizeBytes},
+                                          {0, 0 * kDefaultMaxChunkSizeBytes},
+                                          {0, 0 * kDefaultMaxChunkSizeBytes}});
+
+    auto availableShards = getAllShardIds(cluster.first);
+    const auto [migrations, reason] =
+        BalancerPolicy::balance(cluster.first.shardStats,
+                                makeDistStatus(cm),
+                                buildDataSizeInfoForBalancingFromShardStats(cluster.first),
+                                &availableShards,
+                                false /* forceJumbo */,
+                                100 /* maxMigrationsPerDonorRecipientPair */);
+
+    // Only one donor/recipient pair may be formed per round, and the recipient's headroom (40)
+    // bounds the schedule despite the generous per-pair limit.
+    ASSERT_EQ(40U, migrations.size());
+    for (size_t i = 0; i < migrations.size(); i++) {
+        ASSERT_EQ(getShardId(0), migrations[i].from);
+        ASSERT_EQ(getShardId(1), migrations[i].to);
+    }
+    ASSERT_EQ(MigrationReason::chunksImbalance, reason);
+}
+
 TEST(BalancerPolicy, ParallelBalancingNotSchedulingOnInUseDestinationShards) {
     auto [cluster, cm] = generateCluster({{4, 4 * kDefaultMaxChunkSizeBytes},
                                           {4, 4 * kDefaultMaxChunkSizeBytes},
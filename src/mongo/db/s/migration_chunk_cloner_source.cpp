@@ -808,6 +808,104 @@ Status MigrationChunkClonerSource::nextCloneBatch(OperationContext* opCtx,
     return Status::OK();
 }
 
+boost::optional<StatusWith<BSONObj>> MigrationChunkClonerSource::takeCloneBatchReadAheadResult(
+    OperationContext* opCtx) {
+    stdx::unique_lock<stdx::mutex> lk(_mutex);
+    opCtx->waitForConditionOrInterrupt(
+        _cloneBatchReadAheadFinished, lk, [&] { return !_cloneBatchReadAheadInProgress; });
+    return std::exchange(_cloneBatchReadAheadResult, boost::none);
+}
+
+void MigrationChunkClonerSource::scheduleCloneBatchReadAhead() {
+    if (!migrateCloneReadAhead.load()) {
+        return;
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_state != kCloning || _cloneBatchReadAheadInProgress || _cloneBatchReadAheadResult) {
+        return;
+    }
+
+    if (!_cloneBatchReadAheadPool) {
+        ThreadPool::Options options;
+        options.poolName = "MigrationCloneReadAhead";
+        options.minThreads = 0;
+        options.maxThreads = 1;
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName,
+                               getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+        };
+        _cloneBatchReadAheadPool = std::make_unique<ThreadPool>(std::move(options));
+        _cloneBatchReadAheadPool->startup();
+    }
+
+    _cloneBatchReadAheadInProgress = true;
+    _cloneBatchReadAheadPool->schedule([this](Status status) {
+        // Builds are only scheduled in the kCloning state and the pool is shut down only after
+        // transitioning to kDone, both under '_mutex', so the task can never run with the
+        // shutdown error status.
+        invariant(status);
+        _runCloneBatchReadAhead();
+    });
+}
+
+void MigrationChunkClonerSource::_runCloneBatchReadAhead() {
+    auto result = [&]() -> StatusWith<BSONObj> {
+        try {
+            auto uniqueOpCtx = cc().makeOperationContext();
+            auto opCtx = uniqueOpCtx.get();
+
+            boost::optional<BSONArrayBuilder> arrBuilder;
+            int arrSizeAtPrevIteration = -1;
+
+            // Mirrors the _migrateClone command: keep filling the buffer until a call makes no
+            // progress, reacquiring the collection lock in between since nextCloneBatch returns
+            // early to give the caller a chance to yield.
+            while (!arrBuilder || arrBuilder->arrSize() > arrSizeAtPrevIteration) {
+                AutoGetCollection autoColl(opCtx, nss(), MODE_IS);
+                uassert(ErrorCodes::NamespaceNotFound,
+                        str::stream() << "Collection " << nss().toStringForErrorMsg()
+                                      << " does not exist",
+                        autoColl.getCollection());
+
+                uassert(ErrorCodes::NotWritablePrimary,
+                        "No longer primary while building the read-ahead clone batch",
+                        opCtx->writesAreReplicated() &&
+                            repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx,
+                                                                                        nss()));
+
+                {
+                    const auto scopedCsr =
+                        CollectionShardingRuntime::assertCollectionLockedAndAcquireShared(opCtx,
+                                                                                          nss());
+                    uassert(ErrorCodes::IllegalOperation,
+                            str::stream() << "No active migrations were found for collection "
+                                          << nss().toStringForErrorMsg(),
+                            MigrationSourceManager::getCurrentCloner(*scopedCsr).get() == this);
+                }
+
+                if (!arrBuilder) {
+                    arrBuilder.emplace(getCloneBatchBufferAllocationSize());
+                }
+
+                arrSizeAtPrevIteration = arrBuilder->arrSize();
+
+                uassertStatusOK(
+                    nextCloneBatch(opCtx, autoColl.getCollection(), arrBuilder.get_ptr()));
+            }
+
+            return {arrBuilder->arr()};
+        } catch (const DBException& ex) {
+            return ex.toStatus();
+        }
+    }();
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    _cloneBatchReadAheadResult = std::move(result);
+    _cloneBatchReadAheadInProgress = false;
+    _cloneBatchReadAheadFinished.notify_all();
+}
+
 bool MigrationChunkClonerSource::_processUpdateForXferMod(const BSONObj& preImageDocKey,
                                                           const BSONObj& postImageDocKey) {
     auto const& minKey = _args.getMin().value();
@@ -937,23 +1035,35 @@ Status MigrationChunkClonerSource::nextModsBatch(OperationContext* opCtx, BSONOb
 }
 
 void MigrationChunkClonerSource::_cleanup(bool wasSuccessful) {
-    stdx::unique_lock<stdx::mutex> lk(_mutex);
-    _state = kDone;
+    decltype(_cloneBatchReadAheadPool) readAheadPool;
 
-    _drainAllOutstandingOperationTrackRequests(lk);
+    {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _state = kDone;
+        readAheadPool = std::move(_cloneBatchReadAheadPool);
 
-    if (wasSuccessful) {
-        invariant(_reload.empty());
-        invariant(_deleted.empty());
-        invariant(_deferredReloadOrDeletePreImageDocKeys.empty());
+        _drainAllOutstandingOperationTrackRequests(lk);
+
+        if (wasSuccessful) {
+            invariant(_reload.empty());
+            invariant(_deleted.empty());
+            invariant(_deferredReloadOrDeletePreImageDocKeys.empty());
+        }
+
+        _reload.clear();
+        _untransferredUpsertsCounter = 0;
+        _deleted.clear();
+        _untransferredDeletesCounter = 0;
+        _deferredReloadOrDeletePreImageDocKeys.clear();
+        _deferredUntransferredOpsCounter = 0;
     }
 
-    _reload.clear();
-    _untransferredUpsertsCounter = 0;
-    _deleted.clear();
-    _untransferredDeletesCounter = 0;
-    _deferredReloadOrDeletePreImageDocKeys.clear();
-    _deferredUntransferredOpsCounter = 0;
+    // Join the read-ahead worker outside of '_mutex', which a still-running build needs in order
+    // to publish its result.
+    if (readAheadPool) {
+        readAheadPool->shutdown();
+        readAheadPool->join();
+    }
 }
 
 StatusWith<BSONObj> MigrationChunkClonerSource::_callRecipient(OperationContext* opCtx,
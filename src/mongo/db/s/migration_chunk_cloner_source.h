@@ -71,6 +71,7 @@
 #include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/notification.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
@@ -343,6 +344,26 @@ public:
                           const CollectionPtr& collection,
                           BSONArrayBuilder* arrBuilder);
 
+    /**
+     * Returns the outcome of a previously scheduled read-ahead build of the next initial clone
+     * batch, waiting for the build to finish if it is still running. Returns boost::none if no
+     * read-ahead build was scheduled.
+     *
+     * Must be called before any direct nextCloneBatch calls for the same request, so that only
+     * one thread at a time builds initial clone batches.
+     *
+     * NOTE: Must be called without any locks.
+     */
+    boost::optional<StatusWith<BSONObj>> takeCloneBatchReadAheadResult(OperationContext* opCtx);
+
+    /**
+     * Schedules a background build of the next initial clone batch so that it is already
+     * available by the time the recipient asks for it. No-op unless the 'migrateCloneReadAhead'
+     * server parameter is enabled, the cloner is in the middle of the clone phase and no other
+     * read-ahead build is pending.
+     */
+    void scheduleCloneBatchReadAhead();
+
     /**
      * Called by the recipient shard. Transfers the accummulated local mods from source to
      * destination. Must not be called before all cloned objects have been fetched through calls to
@@ -602,6 +623,14 @@ private:
                                            const CollectionPtr& collection,
                                            BSONArrayBuilder* arrBuilder);
 
+    /**
+     * Runs on '_cloneBatchReadAheadPool' and builds one full initial clone batch, following the
+     * same lock acquisition and yield protocol as the _migrateClone command. The outcome, be it
+     * the built batch or the error the build failed with, is published to
+     * '_cloneBatchReadAheadResult'.
+     */
+    void _runCloneBatchReadAhead();
+
     /**
      * Get the recordIds that belong to the chunk migrated and sort them in _cloneRecordIds (to
      * avoid seeking disk later).
@@ -737,6 +766,20 @@ private:
     // Indicates whether new requests to track an operation are accepted.
     bool _acceptingNewOperationTrackRequests{true};
 
+    // Single-threaded worker, which pre-builds the next initial clone batch when the
+    // 'migrateCloneReadAhead' server parameter is enabled. Created lazily on the first scheduled
+    // read-ahead build and torn down by _cleanup().
+    std::unique_ptr<ThreadPool> _cloneBatchReadAheadPool;
+
+    // True while a read-ahead build is running on '_cloneBatchReadAheadPool'.
+    bool _cloneBatchReadAheadInProgress{false};
+
+    // The outcome of the last read-ahead build, consumed by takeCloneBatchReadAheadResult().
+    boost::optional<StatusWith<BSONObj>> _cloneBatchReadAheadResult;
+
+    // Signalled when a read-ahead build finishes.
+    stdx::condition_variable _cloneBatchReadAheadFinished;
+
     // List of _id of documents that were modified that must be re-cloned (xfer mods)
     std::list<BSONObj> _reload;
 
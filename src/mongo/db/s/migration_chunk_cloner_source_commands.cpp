@@ -61,6 +61,7 @@
 #include "mongo/db/s/migration_chunk_cloner_source.h"
 #include "mongo/db/s/migration_session_id.h"
 #include "mongo/db/s/migration_source_manager.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/write_concern.h"
 #include "mongo/db/write_concern_options.h"
@@ -192,27 +193,52 @@ public:
         const MigrationSessionId migrationSessionId(
             uassertStatusOK(MigrationSessionId::extractFromBSON(cmdObj)));
 
-        boost::optional<BSONArrayBuilder> arrBuilder;
+        boost::optional<BSONObj> objects;
 
-        // Try to maximize on the size of the buffer, which we are returning in order to have less
-        // round-trips
-        int arrSizeAtPrevIteration = -1;
+        {
+            // If a read-ahead build of this batch was scheduled while the previous batch was in
+            // transit, use its result instead of walking the chunk on the request thread. This
+            // must happen even if the 'migrateCloneReadAhead' parameter has been turned off in
+            // the meantime, because the documents in a pending read-ahead batch have already
+            // been consumed from the clone list.
+            AutoGetActiveCloner autoCloner(opCtx, migrationSessionId, false);
+            if (auto readAhead = autoCloner.getCloner()->takeCloneBatchReadAheadResult(opCtx)) {
+                objects = uassertStatusOK(std::move(*readAhead));
+            }
+        }
+
+        if (!objects) {
+            boost::optional<BSONArrayBuilder> arrBuilder;
+
+            // Try to maximize on the size of the buffer, which we are returning in order to have
+            // less round-trips
+            int arrSizeAtPrevIteration = -1;
 
-        while (!arrBuilder || arrBuilder->arrSize() > arrSizeAtPrevIteration) {
-            AutoGetActiveCloner autoCloner(opCtx, migrationSessionId, true);
+            while (!arrBuilder || arrBuilder->arrSize() > arrSizeAtPrevIteration) {
+                AutoGetActiveCloner autoCloner(opCtx, migrationSessionId, true);
 
-            if (!arrBuilder) {
-                arrBuilder.emplace(autoCloner.getCloner()->getCloneBatchBufferAllocationSize());
+                if (!arrBuilder) {
+                    arrBuilder.emplace(autoCloner.getCloner()->getCloneBatchBufferAllocationSize());
+                }
+
+                arrSizeAtPrevIteration = arrBuilder->arrSize();
+
+                uassertStatusOK(autoCloner.getCloner()->nextCloneBatch(
+                    opCtx, autoCloner.getColl(), arrBuilder.get_ptr()));
             }
 
-            arrSizeAtPrevIteration = arrBuilder->arrSize();
+            objects = arrBuilder->arr();
+        }
 
-            uassertStatusOK(autoCloner.getCloner()->nextCloneBatch(
-                opCtx, autoCloner.getColl(), arrBuilder.get_ptr()));
+        // While this batch is on the wire, overlap the collection reads for the next one. An
+        // empty batch tells the recipient that the clone phase is complete, so there is nothing
+        // left to read ahead.
+        if (migrateCloneReadAhead.load() && !objects->isEmpty()) {
+            AutoGetActiveCloner autoCloner(opCtx, migrationSessionId, false);
+            autoCloner.getCloner()->scheduleCloneBatchReadAhead();
         }
 
-        invariant(arrBuilder);
-        result.appendArray("objects", arrBuilder->arr());
+        result.appendArray("objects", *objects);
 
         return true;
     }
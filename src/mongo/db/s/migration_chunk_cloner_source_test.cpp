@@ -100,6 +100,7 @@
 #include "mongo/db/write_concern_options.h"
 #include "mongo/executor/network_test_env.h"
 #include "mongo/executor/remote_command_request.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/catalog/sharding_catalog_client.h"
 #include "mongo/s/catalog/sharding_catalog_client_mock.h"
@@ -923,6 +924,54 @@ TEST_F(MigrationChunkClonerSourceTest, CorrectDocumentsFetched) {
     futureCommit.default_timed_get();
 }
 
+TEST_F(MigrationChunkClonerSourceTest, CloneBatchReadAheadReportsBuildOutcome) {
+    RAIIServerParameterControllerForTest readAheadParam("migrateCloneReadAhead", true);
+
+    const std::vector<BSONObj> contents = {createCollectionDocument(100),
+                                           createCollectionDocument(199)};
+
+    createShardedCollection(contents);
+
+    const ShardsvrMoveRange req =
+        createMoveRangeRequest(ChunkRange(BSON("X" << 100), BSON("X" << 200)));
+    MigrationChunkClonerSource cloner(operationContext(),
+                                      req,
+                                      WriteConcernOptions(),
+                                      kShardKeyPattern,
+                                      kDonorConnStr,
+                                      kRecipientConnStr.getServers()[0]);
+
+    {
+        auto futureStartClone = launchAsync([&]() {
+            onCommand([&](const RemoteCommandRequest& request) { return BSON("ok" << true); });
+        });
+
+        ASSERT_OK(cloner.startClone(operationContext(), UUID::gen(), _lsid, _txnNumber));
+        futureStartClone.default_timed_get();
+    }
+
+    // Without a scheduled read-ahead build there is nothing to take.
+    ASSERT_FALSE(cloner.takeCloneBatchReadAheadResult(operationContext()));
+
+    // The background build fails because this cloner is not registered with an active
+    // MigrationSourceManager, and the failure must surface through the read-ahead result.
+    cloner.scheduleCloneBatchReadAhead();
+
+    auto readAhead = cloner.takeCloneBatchReadAheadResult(operationContext());
+    ASSERT_TRUE(readAhead);
+    ASSERT_EQ(ErrorCodes::IllegalOperation, readAhead->getStatus());
+
+    // The result was consumed by the take above.
+    ASSERT_FALSE(cloner.takeCloneBatchReadAheadResult(operationContext()));
+
+    auto futureCancel = launchAsync([&]() {
+        onCommand([&](const RemoteCommandRequest& request) { return BSON("ok" << true); });
+    });
+
+    cloner.cancelClone(operationContext());
+    futureCancel.default_timed_get();
+}
+
 TEST_F(MigrationChunkClonerSourceTest, RemoveDuplicateDocuments) {
     const std::vector<BSONObj> contents = {createCollectionDocument(100),
                                            createCollectionDocument(199)};
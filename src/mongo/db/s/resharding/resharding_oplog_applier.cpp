@@ -55,6 +55,7 @@
 #include "mongo/db/s/resharding/resharding_donor_oplog_iterator.h"
 #include "mongo/db/s/resharding/resharding_future_util.h"
 #include "mongo/db/s/resharding/resharding_oplog_applier.h"
+#include "mongo/db/s/resharding/resharding_server_parameters_gen.h"
 #include "mongo/db/s/resharding/resharding_util.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/logv2/log.h"
@@ -168,22 +169,59 @@ SemiFuture<void> ReshardingOplogApplier::run(
     struct ChainContext {
         std::unique_ptr<ReshardingDonorOplogIteratorInterface> oplogIter;
         Timer fetchTimer;
+
+        // Cancellation source for in-flight batch fetches, used to abandon a prefetched batch
+        // that the chain ended up never consuming.
+        CancellationSource fetchCancelSource;
+
+        // The batch fetch which was started while the previous batch was still being applied.
+        boost::optional<SharedSemiFuture<OplogBatch>> prefetchedBatch;
     };
 
     auto chainCtx = std::make_shared<ChainContext>();
     chainCtx->oplogIter = std::move(_oplogIter);
+    chainCtx->fetchCancelSource = CancellationSource(cancelToken);
+
+    // Starts fetching the next batch of oplog entries from the donor oplog buffer. The fetch runs
+    // on 'executor' so that it can proceed while the current batch is being applied.
+    auto startFetch = [this, chainCtx, executor, factory] {
+        chainCtx->fetchTimer.reset();
+        return ExecutorFuture(executor)
+            .then([chainCtx, executor, factory] {
+                return chainCtx->oplogIter->getNextBatch(
+                    executor, chainCtx->fetchCancelSource.token(), factory);
+            })
+            .then([this, chainCtx](OplogBatch batch) {
+                _env->applierMetrics()->onBatchRetrievedDuringOplogApplying(
+                    duration_cast<Milliseconds>(chainCtx->fetchTimer.elapsed()));
+                return batch;
+            });
+    };
 
-    return AsyncTry([this, chainCtx, executor, cancelToken, factory] {
-               chainCtx->fetchTimer.reset();
-               return chainCtx->oplogIter->getNextBatch(executor, cancelToken, factory)
-                   .thenRunOn(executor)
-                   .then([this, chainCtx, executor, cancelToken, factory](OplogBatch batch) {
+    return AsyncTry([this, chainCtx, executor, cancelToken, factory, startFetch] {
+               auto batchFuture = [&]() -> ExecutorFuture<OplogBatch> {
+                   if (chainCtx->prefetchedBatch) {
+                       auto future = chainCtx->prefetchedBatch->thenRunOn(executor);
+                       chainCtx->prefetchedBatch = boost::none;
+                       return future;
+                   }
+                   return startFetch();
+               }();
+
+               return std::move(batchFuture)
+                   .then([this, chainCtx, executor, cancelToken, factory, startFetch](
+                             OplogBatch batch) {
                        LOGV2_DEBUG(5391002, 3, "Starting batch", "batchSize"_attr = batch.size());
 
-                       _env->applierMetrics()->onBatchRetrievedDuringOplogApplying(
-                           duration_cast<Milliseconds>(chainCtx->fetchTimer.elapsed()));
-
                        _currentBatchToApply = std::move(batch);
+
+                       // Overlap fetching the next batch with applying the current one. An empty
+                       // batch means there is nothing past the final oplog entry left to fetch.
+                       if (!_currentBatchToApply.empty() &&
+                           resharding::gReshardingOplogApplierPrefetchBatches.load()) {
+                           chainCtx->prefetchedBatch = startFetch().share();
+                       }
+
                        return _applyBatch(executor, cancelToken, factory);
                    })
                    .then([this, executor, cancelToken, factory] {
@@ -223,6 +261,15 @@ SemiFuture<void> ReshardingOplogApplier::run(
         // RecipientStateMachine, along with its ReshardingOplogApplier member, may have already
         // been destructed.
         .onCompletion([chainCtx](Status status) {
+            if (chainCtx->prefetchedBatch) {
+                // The chain ended without consuming the prefetched batch, e.g. because applying
+                // the batch before it failed. Cancel the fetch and wait for it to complete before
+                // disposing of the iterator underneath it.
+                chainCtx->fetchCancelSource.cancel();
+                chainCtx->prefetchedBatch->getNoThrow().getStatus().ignore();
+                chainCtx->prefetchedBatch = boost::none;
+            }
+
             if (chainCtx->oplogIter) {
                 // Use a separate Client to make a better effort of calling dispose() even when the
                 // CancellationToken has been canceled.
@@ -84,6 +84,7 @@
 #include "mongo/executor/network_connection_hook.h"
 #include "mongo/executor/network_interface_factory.h"
 #include "mongo/executor/thread_pool_task_executor.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/rpc/metadata/egress_metadata_hook_list.h"
 #include "mongo/rpc/metadata/metadata_hook.h"
 #include "mongo/s/catalog/sharding_catalog_client.h"
@@ -568,6 +569,56 @@ TEST_F(ReshardingOplogApplierTest, ApplyBasicCrud) {
     ASSERT_EQ(4, progressDoc->getNumEntriesApplied());
 }
 
+TEST_F(ReshardingOplogApplierTest, ApplyBasicCrudWithoutBatchPrefetching) {
+    RAIIServerParameterControllerForTest prefetchParam("reshardingOplogApplierPrefetchBatches",
+                                                       false);
+
+    loadCatalogCacheValues();
+    std::deque<repl::OplogEntry> crudOps;
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(5, 3), 1),
+                                repl::OpTypeEnum::kInsert,
+                                BSON("_id" << 1),
+                                boost::none));
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(6, 3), 1),
+                                repl::OpTypeEnum::kInsert,
+                                BSON("_id" << 2),
+                                boost::none));
+    crudOps.push_back(makeOplog(repl::OpTime(Timestamp(7, 3), 1),
+                                repl::OpTypeEnum::kDelete,
+                                BSON("_id" << 1),
+                                boost::none));
+
+    auto iterator = std::make_unique<OplogIteratorMock>(std::move(crudOps), 2 /* batchSize */);
+    boost::optional<ReshardingOplogApplier> applier;
+    applier.emplace(makeApplierEnv(),
+                    kApplierBatchTaskCount,
+                    sourceId(),
+                    oplogBufferNs(),
+                    appliedToNs(),
+                    stashCollections(),
+                    0U /* myStashIdx */,
+                    chunkManager(),
+                    std::move(iterator));
+
+    auto cancelToken = operationContext()->getCancellationToken();
+    CancelableOperationContextFactory factory(cancelToken, getCancelableOpCtxExecutor());
+    auto future = applier->run(getExecutor(), getExecutor(), cancelToken, factory);
+    ASSERT_OK(future.getNoThrow());
+
+    DBDirectClient client(operationContext());
+    auto doc = client.findOne(appliedToNs(), BSON("_id" << 1));
+    ASSERT_BSONOBJ_EQ(BSONObj(), doc);
+
+    doc = client.findOne(appliedToNs(), BSON("_id" << 2));
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 2), doc);
+
+    auto progressDoc = ReshardingOplogApplier::checkStoredProgress(operationContext(), sourceId());
+    ASSERT_TRUE(progressDoc);
+    ASSERT_EQ(Timestamp(7, 3), progressDoc->getProgress().getClusterTime());
+    ASSERT_EQ(Timestamp(7, 3), progressDoc->getProgress().getTs());
+    ASSERT_EQ(3, progressDoc->getNumEntriesApplied());
+}
+
 TEST_F(ReshardingOplogApplierTest, CanceledApplyingBatch) {
     std::deque<repl::OplogEntry> crudOps;
     crudOps.push_back(makeOplog(repl::OpTime(Timestamp(5, 3), 1),
@@ -410,6 +410,10 @@ Status storeBaseOptions(const moe::Environment& params) {
         serverGlobalParams.logAppend = true;
     }
 
+    if (params.count("systemLog.logAsync") && params["systemLog.logAsync"].as<bool>() == true) {
+        serverGlobalParams.logAsync = true;
+    }
+
     if (params.count("systemLog.logRotate")) {
         std::string logRotateParam = params["systemLog.logRotate"].as<std::string>();
         if (logRotateParam == "reopen") {
@@ -373,6 +373,13 @@ void ServiceContext::registerClientObserver(std::unique_ptr<ClientObserver> obse
  */
 ClientLock Service::LockedClientsCursor::next() {
     while (auto client = _cursor.next()) {
+        // Filter on service membership before taking the client lock, so that enumerating one
+        // service (e.g. for currentOp) does not contend with operation threads of the other.
+        // Membership is re-checked under the lock since a client may be concurrently rebound to
+        // another service (e.g. by the replica set endpoint).
+        if (client->getService() != _service) {
+            continue;
+        }
         ClientLock lk(client);
         if (lk->getService() == _service) {
             return lk;
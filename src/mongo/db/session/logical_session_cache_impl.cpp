@@ -35,12 +35,14 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
+#include <cstddef>
 #include <iterator>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/db/operation_context.h"
@@ -126,18 +128,20 @@ void LogicalSessionCacheImpl::joinOnShutDown() {
 
 Status LogicalSessionCacheImpl::startSession(OperationContext* opCtx,
                                              const LogicalSessionRecord& record) {
-    stdx::lock_guard lg(_mutex);
-    return _addToCacheIfNotFull(lg, record);
+    auto partition = _activeSessions.lockOnePartition(record.getId());
+    return _addToCacheIfNotFull(partition, record);
 }
 
 Status LogicalSessionCacheImpl::vivify(OperationContext* opCtx, const LogicalSessionId& lsid) {
     auto parentLsid = getParentSessionId(lsid);
+    const auto& cacheKey = parentLsid ? *parentLsid : lsid;
 
-    stdx::lock_guard lg(_mutex);
+    auto partition = _activeSessions.lockOnePartition(cacheKey);
 
-    auto it = _activeSessions.find(parentLsid ? *parentLsid : lsid);
-    if (it == _activeSessions.end())
-        return _addToCacheIfNotFull(lg, makeLogicalSessionRecord(opCtx, lsid, _service->now()));
+    auto it = partition->find(cacheKey);
+    if (it == partition->end())
+        return _addToCacheIfNotFull(partition,
+                                    makeLogicalSessionRecord(opCtx, lsid, _service->now()));
 
     auto& cacheEntry = it->second;
     cacheEntry.setLastUse(_service->now());
@@ -164,7 +168,6 @@ void LogicalSessionCacheImpl::reapNow(OperationContext* opCtx) {
 }
 
 size_t LogicalSessionCacheImpl::size() {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
     return _activeSessions.size();
 }
 
@@ -268,8 +271,9 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     const auto replCoord = repl::ReplicationCoordinator::get(opCtx);
     if (replCoord && replCoord->getSettings().isReplSet() &&
         replCoord->getMemberState().arbiter()) {
-        stdx::lock_guard<stdx::mutex> lk(_mutex);
-        _activeSessions.clear();
+        auto allPartitions = _activeSessions.lockAllPartitions();
+        allPartitions.clear();
+        _numActiveSessions.store(0);
         return;
     }
 
@@ -299,39 +303,61 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
 
     _sessionsColl->setupSessionsCollection(opCtx);
 
-    LogicalSessionIdSet staleSessions;
     LogicalSessionIdSet explicitlyEndingSessions;
-    LogicalSessionIdMap<LogicalSessionRecord> activeSessions;
 
     {
         using std::swap;
         stdx::lock_guard<stdx::mutex> lk(_mutex);
         swap(explicitlyEndingSessions, _endingSessions);
-        swap(activeSessions, _activeSessions);
+    }
+
+    // Swap out each partition of the active sessions map in turn, so that sessions which are used
+    // while the refresh is running land in the now-empty cache and are picked up by the next
+    // refresh.
+    std::vector<LogicalSessionIdMap<LogicalSessionRecord>> activeSessionsByPartition(
+        kNumActiveSessionsPartitions);
+    for (std::size_t i = 0; i < kNumActiveSessionsPartitions; ++i) {
+        using std::swap;
+        auto partition = _activeSessions.lockOnePartitionById(i);
+        swap(activeSessionsByPartition[i], *partition);
+        _numActiveSessions.fetchAndSubtract(
+            static_cast<long long>(activeSessionsByPartition[i].size()));
     }
 
     // Create guards that in the case of a exception replace the ending or active sessions that
     // swapped out of LogicalSessionCache, and merges in any records that had been added since we
     // swapped them out.
-    auto backSwap = [this](auto& member, auto& temp) {
-        stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto backSwap = [](auto& member, auto& temp) {
         using std::swap;
         swap(member, temp);
         for (const auto& it : temp) {
             member.emplace(it);
         }
     };
-    ScopeGuard activeSessionsBackSwapper([&] { backSwap(_activeSessions, activeSessions); });
-    auto explicitlyEndingBackSwaper =
-        ScopeGuard([&] { backSwap(_endingSessions, explicitlyEndingSessions); });
+    ScopeGuard activeSessionsBackSwapper([&] {
+        for (std::size_t i = 0; i < kNumActiveSessionsPartitions; ++i) {
+            auto partition = _activeSessions.lockOnePartitionById(i);
+            const auto sizeBefore = partition->size();
+            backSwap(*partition, activeSessionsByPartition[i]);
+            _numActiveSessions.fetchAndAdd(static_cast<long long>(partition->size()) -
+                                           static_cast<long long>(sizeBefore));
+        }
+    });
+    auto explicitlyEndingBackSwaper = ScopeGuard([&] {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        backSwap(_endingSessions, explicitlyEndingSessions);
+    });
 
     // remove all explicitlyEndingSessions from activeSessions
     for (const auto& lsid : explicitlyEndingSessions) {
-        activeSessions.erase(lsid);
+        activeSessionsByPartition[SessionPartitioner()(lsid, kNumActiveSessionsPartitions)].erase(
+            lsid);
     }
 
-    // Refresh all recently active sessions as well as for sessions attached to running ops
-    LogicalSessionRecordSet activeSessionRecords;
+    // Refresh all recently active sessions as well as for sessions attached to running ops. Each
+    // running op session is bucketed with the partition its session id belongs to so that it is
+    // flushed exactly once.
+    std::vector<LogicalSessionRecordSet> recordsByPartition(kNumActiveSessionsPartitions);
 
     auto runningOpSessions = _service->getActiveOpSessions();
 
@@ -340,18 +366,30 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         if (explicitlyEndingSessions.count(it) > 0) {
             continue;
         }
-        activeSessionRecords.insert(makeLogicalSessionRecord(it, _service->now()));
+        auto record = makeLogicalSessionRecord(it, _service->now());
+        recordsByPartition[SessionPartitioner()(record.getId(), kNumActiveSessionsPartitions)]
+            .insert(std::move(record));
     }
-    for (const auto& it : activeSessions) {
-        activeSessionRecords.insert(it.second);
+    for (std::size_t i = 0; i < kNumActiveSessionsPartitions; ++i) {
+        for (const auto& it : activeSessionsByPartition[i]) {
+            recordsByPartition[i].insert(it.second);
+        }
     }
 
-    // Refresh the active sessions in the sessions collection.
-    _sessionsColl->refreshSessions(opCtx, activeSessionRecords);
+    // Refresh the active sessions in the sessions collection, one partition at a time, so that a
+    // large cache results in a series of smaller writes rather than one large one.
+    std::size_t numRefreshed = 0;
+    for (const auto& records : recordsByPartition) {
+        if (records.empty()) {
+            continue;
+        }
+        _sessionsColl->refreshSessions(opCtx, records);
+        numRefreshed += records.size();
+    }
     activeSessionsBackSwapper.dismiss();
     {
         stdx::lock_guard<stdx::mutex> lk(_mutex);
-        _stats.setLastSessionsCollectionJobEntriesRefreshed(activeSessionRecords.size());
+        _stats.setLastSessionsCollectionJobEntriesRefreshed(numRefreshed);
     }
 
     // Remove the ending sessions from the sessions collection.
@@ -370,14 +408,10 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     auto openCursorSessions = _service->getOpenCursorSessions(opCtx);
     // Exclude sessions added to _activeSessions from the openCursorSession to avoid race between
     // killing cursors on the removed sessions and creating sessions.
-    {
-        stdx::lock_guard<stdx::mutex> lk(_mutex);
-
-        for (const auto& it : _activeSessions) {
-            auto newSessionIt = openCursorSessions.find(it.first);
-            if (newSessionIt != openCursorSessions.end()) {
-                openCursorSessions.erase(newSessionIt);
-            }
+    for (auto it = openCursorSessions.begin(); it != openCursorSessions.end();) {
+        auto current = it++;
+        if (_activeSessions.count(*current) > 0) {
+            openCursorSessions.erase(current);
         }
     }
 
@@ -416,13 +450,16 @@ void LogicalSessionCacheImpl::endSessions(const LogicalSessionIdSet& sessions) {
 }
 
 LogicalSessionCacheStats LogicalSessionCacheImpl::getStats() {
+    const auto activeSessionsCount = _activeSessions.size();
     stdx::lock_guard<stdx::mutex> lk(_mutex);
-    _stats.setActiveSessionsCount(_activeSessions.size());
+    _stats.setActiveSessionsCount(activeSessionsCount);
     return _stats;
 }
 
-Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRecord record) {
-    if (_activeSessions.size() >= size_t(maxSessions)) {
+Status LogicalSessionCacheImpl::_addToCacheIfNotFull(ActiveSessionsMap::OnePartition& partition,
+                                                     LogicalSessionRecord record) {
+    const auto numActiveSessions = _numActiveSessions.load();
+    if (numActiveSessions >= static_cast<long long>(maxSessions)) {
         Status status = {ErrorCodes::TooManyLogicalSessions,
                          str::stream()
                              << "Unable to add session ID " << record.getId()
@@ -436,34 +473,40 @@ Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRec
                     bumpedSeverity().toInt(),
                     "Unable to add session into the cache, too many active sessions",
                     "sessionId"_attr = record.getId(),
-                    "sessionCount"_attr = _activeSessions.size(),
+                    "sessionCount"_attr = numActiveSessions,
                     "maxSessions"_attr = maxSessions);
         return status;
     }
 
-    _activeSessions.insert(std::make_pair(record.getId(), std::move(record)));
+    if (partition->insert(std::make_pair(record.getId(), std::move(record))).second) {
+        _numActiveSessions.fetchAndAdd(1);
+    }
 
     return Status::OK();
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds() const {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto allPartitions = _activeSessions.lockAllPartitions();
     std::vector<LogicalSessionId> ret;
-    ret.reserve(_activeSessions.size());
-    for (const auto& id : _activeSessions) {
-        ret.push_back(id.first);
+    ret.reserve(allPartitions.size());
+    for (const auto& partition : allPartitions) {
+        for (const auto& id : *partition) {
+            ret.push_back(id.first);
+        }
     }
     return ret;
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds(
     const std::vector<SHA256Block>& userDigests) const {
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    auto allPartitions = _activeSessions.lockAllPartitions();
     std::vector<LogicalSessionId> ret;
-    for (const auto& it : _activeSessions) {
-        if (std::find(userDigests.cbegin(), userDigests.cend(), it.first.getUid()) !=
-            userDigests.cend()) {
-            ret.push_back(it.first);
+    for (const auto& partition : allPartitions) {
+        for (const auto& it : *partition) {
+            if (std::find(userDigests.cbegin(), userDigests.cend(), it.first.getUid()) !=
+                userDigests.cend()) {
+                ret.push_back(it.first);
+            }
         }
     }
     return ret;
@@ -475,9 +518,9 @@ boost::optional<LogicalSessionRecord> LogicalSessionCacheImpl::peekCached(
             str::stream() << "Cannot specify a child session id " << lsid,
             isParentSessionId(lsid));
 
-    stdx::lock_guard<stdx::mutex> lk(_mutex);
-    const auto it = _activeSessions.find(lsid);
-    if (it == _activeSessions.end()) {
+    auto partition = _activeSessions.lockOnePartition(lsid);
+    const auto it = partition->find(lsid);
+    if (it == partition->end()) {
         return boost::none;
     }
     return it->second;
@@ -38,6 +38,7 @@
 
 #include "mongo/base/status.h"
 #include "mongo/crypto/sha256_block.h"
+#include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/client.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/session/logical_session_cache.h"
@@ -46,8 +47,8 @@
 #include "mongo/db/session/logical_session_id_gen.h"
 #include "mongo/db/session/service_liaison.h"
 #include "mongo/db/session/sessions_collection.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
-#include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/functional.h"
 #include "mongo/util/hierarchical_acquisition.h"
 #include "mongo/util/time_support.h"
@@ -106,6 +107,21 @@ public:
     LogicalSessionCacheStats getStats() override;
 
 private:
+    static constexpr std::size_t kNumActiveSessionsPartitions = 16;
+
+    /**
+     * Assigns session ids to partitions of the active sessions map. Sessions are always keyed by
+     * their parent session id, which hashes by the session's UUID.
+     */
+    struct SessionPartitioner {
+        std::size_t operator()(const LogicalSessionId& lsid, std::size_t nPartitions) const {
+            return LogicalSessionIdHash{}(lsid) % nPartitions;
+        }
+    };
+
+    using ActiveSessionsMap =
+        Partitioned<LogicalSessionIdMap<LogicalSessionRecord>, SessionPartitioner>;
+
     void _periodicRefresh(Client* client);
     void _refresh(Client* client);
 
@@ -117,7 +133,8 @@ private:
      */
     bool _isDead(const LogicalSessionRecord& record, Date_t now) const;
 
-    Status _addToCacheIfNotFull(WithLock, LogicalSessionRecord record);
+    Status _addToCacheIfNotFull(ActiveSessionsMap::OnePartition& partition,
+                                LogicalSessionRecord record);
 
     const std::unique_ptr<ServiceLiaison> _service;
     const std::shared_ptr<SessionsCollection> _sessionsColl;
@@ -125,7 +142,14 @@ private:
 
     mutable stdx::mutex _mutex;
 
-    LogicalSessionIdMap<LogicalSessionRecord> _activeSessions;
+    // Partitioned so that writes against different sessions do not contend on a single mutex and
+    // so that the periodic refresh can flush the cache one partition at a time. Mutable because
+    // Partitioned only exposes a locking interface. Const methods only read the contents.
+    mutable ActiveSessionsMap _activeSessions{kNumActiveSessionsPartitions};
+
+    // Tracks the total number of entries across all partitions of '_activeSessions' so that the
+    // maxSessions limit can be enforced without locking every partition on each insert.
+    AtomicWord<long long> _numActiveSessions{0};
 
     LogicalSessionIdSet _endingSessions;
 
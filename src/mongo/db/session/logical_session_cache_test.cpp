@@ -304,14 +304,17 @@ TEST_F(LogicalSessionCacheTest, ManySignedLsidsInCacheRefresh) {
         ASSERT_OK(cache()->startSession(opCtx(), record));
     }
 
-    // Check that all signedLsids refresh
-    sessions()->setRefreshHook([&count](const LogicalSessionRecordSet& sessions) {
-        ASSERT_EQ(sessions.size(), size_t(count));
+    // Check that all signedLsids refresh. The cache flushes its sessions one partition at a time,
+    // so accumulate the records across the individual refresh calls.
+    size_t numRefreshed = 0;
+    sessions()->setRefreshHook([&numRefreshed](const LogicalSessionRecordSet& sessions) {
+        numRefreshed += sessions.size();
     });
 
     // Force a refresh
     service()->fastForward(kForceRefresh);
     ASSERT_OK(cache()->refreshNow(opCtx()));
+    ASSERT_EQ(numRefreshed, size_t(count));
 }
 
 //
@@ -81,17 +81,21 @@ std::string provenanceToString(SessionCatalog::Provenance provenance) {
 }  // namespace
 
 SessionCatalog::~SessionCatalog() {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
-    for (const auto& [_, sri] : _sessions) {
-        ObservableSession osession(lg, sri.get(), &sri->parentSession);
-        invariant(!osession.hasCurrentOperation());
-        invariant(!osession._killed());
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lg(partition.mutex);
+        for (const auto& [_, sri] : partition.sessions) {
+            ObservableSession osession(lg, sri.get(), &sri->parentSession);
+            invariant(!osession.hasCurrentOperation());
+            invariant(!osession._killed());
+        }
     }
 }
 
 void SessionCatalog::reset_forTest() {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
-    _sessions.clear();
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lg(partition.mutex);
+        partition.sessions.clear();
+    }
 }
 
 SessionCatalog* SessionCatalog::get(OperationContext* opCtx) {
@@ -114,9 +118,10 @@ SessionCatalog::ScopedCheckedOutSession SessionCatalog::_checkOutSessionInner(
         dassert(opCtx->getLogicalSessionId() == lsid);
     }
 
-    stdx::unique_lock<stdx::mutex> ul(_mutex);
+    auto& partition = _partitionFor(lsid);
+    stdx::unique_lock<stdx::mutex> ul(partition.mutex);
 
-    auto sri = _getOrCreateSessionRuntimeInfo(ul, lsid);
+    auto sri = _getOrCreateSessionRuntimeInfo(ul, partition, lsid);
     auto session = sri->getSession(ul, lsid);
     invariant(session);
 
@@ -183,11 +188,12 @@ SessionCatalog::SessionToKill SessionCatalog::checkOutSessionForKill(OperationCo
 void SessionCatalog::scanSession(const LogicalSessionId& lsid,
                                  const ScanSessionsCallbackFn& workerFn,
                                  ScanSessionCreateSession createSession) {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
+    auto& partition = _partitionFor(lsid);
+    stdx::lock_guard<stdx::mutex> lg(partition.mutex);
 
     auto sri = (createSession == ScanSessionCreateSession::kYes)
-        ? _getOrCreateSessionRuntimeInfo(lg, lsid)
-        : _getSessionRuntimeInfo(lg, lsid);
+        ? _getOrCreateSessionRuntimeInfo(lg, partition, lsid)
+        : _getSessionRuntimeInfo(lg, partition, lsid);
 
     if (sri) {
         auto session = sri->getSession(lg, lsid);
@@ -201,36 +207,40 @@ void SessionCatalog::scanSession(const LogicalSessionId& lsid,
 
 void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
                                   const ScanSessionsCallbackFn& workerFn) {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
+    LOGV2_DEBUG(21976, 2, "Scanning sessions", "sessionCount"_attr = size());
 
-    LOGV2_DEBUG(21976, 2, "Scanning sessions", "sessionCount"_attr = _sessions.size());
-
-    for (auto& [parentLsid, sri] : _sessions) {
-        if (matcher.match(parentLsid)) {
-            ObservableSession osession(lg, sri.get(), &sri->parentSession);
-            workerFn(osession);
-            invariant(!osession._markedForReap, "Cannot reap a session via 'scanSessions'");
-        }
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lg(partition.mutex);
 
-        for (auto& [childLsid, session] : sri->childSessions) {
-            if (matcher.match(childLsid)) {
-                ObservableSession osession(lg, sri.get(), &session);
+        for (auto& [parentLsid, sri] : partition.sessions) {
+            if (matcher.match(parentLsid)) {
+                ObservableSession osession(lg, sri.get(), &sri->parentSession);
                 workerFn(osession);
                 invariant(!osession._markedForReap, "Cannot reap a session via 'scanSessions'");
             }
+
+            for (auto& [childLsid, session] : sri->childSessions) {
+                if (matcher.match(childLsid)) {
+                    ObservableSession osession(lg, sri.get(), &session);
+                    workerFn(osession);
+                    invariant(!osession._markedForReap, "Cannot reap a session via 'scanSessions'");
+                }
+            }
         }
     }
 }
 
 void SessionCatalog::scanParentSessions(const ScanSessionsCallbackFn& workerFn) {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
+    LOGV2_DEBUG(6685000, 2, "Scanning sessions", "sessionCount"_attr = size());
 
-    LOGV2_DEBUG(6685000, 2, "Scanning sessions", "sessionCount"_attr = _sessions.size());
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lg(partition.mutex);
 
-    for (auto& [parentLsid, sri] : _sessions) {
-        ObservableSession osession(lg, sri.get(), &sri->parentSession);
-        workerFn(osession);
-        invariant(!osession._markedForReap, "Cannot reap a session via 'scanSessions'");
+        for (auto& [parentLsid, sri] : partition.sessions) {
+            ObservableSession osession(lg, sri.get(), &sri->parentSession);
+            workerFn(osession);
+            invariant(!osession._markedForReap, "Cannot reap a session via 'scanSessions'");
+        }
     }
 }
 
@@ -242,11 +252,12 @@ LogicalSessionIdSet SessionCatalog::scanSessionsForReap(
 
     std::unique_ptr<SessionRuntimeInfo> sriToReap;
     {
-        stdx::lock_guard<stdx::mutex> lg(_mutex);
+        auto& partition = _partitionFor(parentLsid);
+        stdx::lock_guard<stdx::mutex> lg(partition.mutex);
 
-        auto sriIt = _sessions.find(parentLsid);
+        auto sriIt = partition.sessions.find(parentLsid);
         // The reaper should never try to reap a non-existent session id.
-        invariant(sriIt != _sessions.end());
+        invariant(sriIt != partition.sessions.end());
         auto sri = sriIt->second.get();
 
         LogicalSessionIdSet remainingSessions;
@@ -280,7 +291,7 @@ LogicalSessionIdSet SessionCatalog::scanSessionsForReap(
 
         if (shouldReapRemaining) {
             sriToReap = std::move(sriIt->second);
-            _sessions.erase(sriIt);
+            partition.sessions.erase(sriIt);
             remainingSessions.clear();
         }
 
@@ -289,9 +300,10 @@ LogicalSessionIdSet SessionCatalog::scanSessionsForReap(
 }
 
 SessionCatalog::KillToken SessionCatalog::killSession(const LogicalSessionId& lsid) {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
+    auto& partition = _partitionFor(lsid);
+    stdx::lock_guard<stdx::mutex> lg(partition.mutex);
 
-    auto sri = _getSessionRuntimeInfo(lg, lsid);
+    auto sri = _getSessionRuntimeInfo(lg, partition, lsid);
     uassert(ErrorCodes::NoSuchSession, "Session not found", sri);
     auto session = sri->getSession(lg, lsid);
     uassert(ErrorCodes::NoSuchSession, "Session not found", session);
@@ -299,8 +311,12 @@ SessionCatalog::KillToken SessionCatalog::killSession(const LogicalSessionId& ls
 }
 
 size_t SessionCatalog::size() const {
-    stdx::lock_guard<stdx::mutex> lg(_mutex);
-    return _sessions.size();
+    size_t size = 0;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<stdx::mutex> lg(partition.mutex);
+        size += partition.sessions.size();
+    }
+    return size;
 }
 
 void SessionCatalog::setDisallowNewTransactions() {
@@ -311,12 +327,17 @@ bool SessionCatalog::getDisallowNewTransactions() {
     return _disallowNewTransactions.load();
 }
 
+SessionCatalog::Partition& SessionCatalog::_partitionFor(const LogicalSessionId& lsid) {
+    const auto& parentLsid = isParentSessionId(lsid) ? lsid : *getParentSessionId(lsid);
+    return _partitions[LogicalSessionIdHash{}(parentLsid) % _numPartitions];
+}
+
 SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getSessionRuntimeInfo(
-    WithLock wl, const LogicalSessionId& lsid) {
+    WithLock wl, Partition& partition, const LogicalSessionId& lsid) {
     const auto& parentLsid = isParentSessionId(lsid) ? lsid : *getParentSessionId(lsid);
-    auto sriIt = _sessions.find(parentLsid);
+    auto sriIt = partition.sessions.find(parentLsid);
 
-    if (sriIt == _sessions.end()) {
+    if (sriIt == partition.sessions.end()) {
         return nullptr;
     }
 
@@ -331,14 +352,15 @@ SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getSessionRuntimeInfo(
 }
 
 SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getOrCreateSessionRuntimeInfo(
-    WithLock lk, const LogicalSessionId& lsid) {
-    if (auto sri = _getSessionRuntimeInfo(lk, lsid)) {
+    WithLock lk, Partition& partition, const LogicalSessionId& lsid) {
+    if (auto sri = _getSessionRuntimeInfo(lk, partition, lsid)) {
         return sri;
     }
 
     const auto& parentLsid = isParentSessionId(lsid) ? lsid : *getParentSessionId(lsid);
     auto sriIt =
-        _sessions.emplace(parentLsid, std::make_unique<SessionRuntimeInfo>(parentLsid)).first;
+        partition.sessions.emplace(parentLsid, std::make_unique<SessionRuntimeInfo>(parentLsid))
+            .first;
     auto sri = sriIt->second.get();
 
     if (isChildSession(lsid)) {
@@ -358,11 +380,12 @@ void SessionCatalog::_releaseSession(
     Session* session,
     boost::optional<KillToken> killToken,
     boost::optional<TxnNumberAndProvenance> clientTxnNumberStarted) {
-    stdx::unique_lock<stdx::mutex> ul(_mutex);
+    auto& partition = _partitionFor(sri->parentSession.getSessionId());
+    stdx::unique_lock<stdx::mutex> ul(partition.mutex);
 
     // Make sure we have exactly the same session on the map and that it is still associated with an
     // operation context (meaning checked-out)
-    invariant(_sessions[sri->parentSession.getSessionId()].get() == sri);
+    invariant(partition.sessions[sri->parentSession.getSessionId()].get() == sri);
     invariant(sri->checkoutOpCtx);
     if (killToken) {
         dassert(killToken->lsidToKill == session->getSessionId());
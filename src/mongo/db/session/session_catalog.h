@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional.hpp>
 #include <boost/optional/optional.hpp>
@@ -123,13 +124,12 @@ public:
                                          Milliseconds* timeout = nullptr);
 
     /**
-     * Iterates through the SessionCatalog under the SessionCatalog mutex and applies 'workerFn' to
-     * each Session which matches the specified 'lsid' or 'matcher'. Does not support reaping.
+     * Iterates through the SessionCatalog under the partition mutexes (taken one at a time) and
+     * applies 'workerFn' to each Session which matches the specified 'lsid' or 'matcher'. Does not
+     * support reaping.
      *
-     * NOTE: Since this method runs with the session catalog mutex, the work done by 'workerFn' is
-     * not allowed to block, perform I/O or acquire any lock manager locks.
-     * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
-     * SessionCatalog.
+     * NOTE: Since this method runs with a catalog partition's mutex, the work done by 'workerFn'
+     * is not allowed to block, perform I/O or acquire any lock manager locks.
      */
     enum class ScanSessionCreateSession { kYes, kNo };
     void scanSession(const LogicalSessionId& lsid,
@@ -156,7 +156,7 @@ public:
                                             const ScanSessionsCallbackFn& childSessionWorkerFn);
 
     /**
-     * Shortcut to invoke 'kill' on the specified session under the SessionCatalog mutex. Throws a
+     * Shortcut to invoke 'kill' on the specified session under its partition's mutex. Throws a
      * NoSuchSession exception if the session doesn't exist.
      */
     KillToken killSession(const LogicalSessionId& lsid);
@@ -208,7 +208,7 @@ private:
         // opCtx that starts a new client txnNumber checks this logical session back in.
         TxnNumber lastClientTxnNumberStarted = kUninitializedTxnNumber;
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
+        // Signaled when the state becomes available. Uses the catalog partition's mutex to protect
         // the state transitions.
         stdx::condition_variable availableCondVar;
 
@@ -227,6 +227,19 @@ private:
     };
     using SessionRuntimeInfoMap = LogicalSessionIdMap<std::unique_ptr<SessionRuntimeInfo>>;
 
+    /**
+     * The runtime state is sharded by the hash of the parent logical session id so that check-outs
+     * of unrelated sessions do not serialize on a single catalog-wide mutex. A logical session and
+     * all of its child sessions always map to the same partition.
+     */
+    struct Partition {
+        // Protects the map below and the runtime info linked on it.
+        mutable stdx::mutex mutex;
+
+        // Owns the Session objects for the sessions mapped to this partition.
+        SessionRuntimeInfoMap sessions;
+    };
+
     /**
      * Returns a callback with the default logic used to decide if a session may be reaped early.
      */
@@ -248,16 +261,27 @@ private:
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
-     * Returns the session runtime info for 'lsid' from the '_sessions' map. The returned pointer
-     * is guaranteed to be linked on the map for as long as the mutex is held.
+     * Returns the partition on which the runtime info for 'lsid' resides. Child session ids map to
+     * the partition of their parent session.
      */
-    SessionRuntimeInfo* _getSessionRuntimeInfo(WithLock lk, const LogicalSessionId& lsid);
+    Partition& _partitionFor(const LogicalSessionId& lsid);
 
     /**
-     * Creates or returns the session runtime info for 'lsid' from the '_sessions' map. The
-     * returned pointer is guaranteed to be linked on the map for as long as the mutex is held.
+     * Returns the session runtime info for 'lsid' from the partition's map. The returned pointer
+     * is guaranteed to be linked on the map for as long as the partition's mutex is held.
      */
-    SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock lk, const LogicalSessionId& lsid);
+    SessionRuntimeInfo* _getSessionRuntimeInfo(WithLock lk,
+                                               Partition& partition,
+                                               const LogicalSessionId& lsid);
+
+    /**
+     * Creates or returns the session runtime info for 'lsid' from the partition's map. The
+     * returned pointer is guaranteed to be linked on the map for as long as the partition's mutex
+     * is held.
+     */
+    SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock lk,
+                                                       Partition& partition,
+                                                       const LogicalSessionId& lsid);
 
     /**
      * Makes a session, previously checked out through 'checkoutSession', available again. Will free
@@ -279,11 +303,10 @@ private:
     MakeSessionWorkerFnForEagerReap _makeSessionWorkerFnForEagerReap =
         _defaultMakeSessionWorkerFnForEagerReap;
 
-    // Protects the state below
-    mutable stdx::mutex _mutex;
-
-    // Owns the Session objects for all current Sessions.
-    SessionRuntimeInfoMap _sessions;
+    // Balance scalability of uncontended session check-outs against the cost of whole-catalog
+    // scans, which take each partition mutex in turn. Should be a power of two.
+    static constexpr size_t _numPartitions{16};
+    std::array<Partition, _numPartitions> _partitions;
 
     AtomicWord<bool> _disallowNewTransactions{false};
 };
@@ -403,8 +426,8 @@ using SessionToKill = SessionCatalog::SessionToKill;
 /**
  * This type represents access to a transaction session inside of a scanSessions loop.
  * If you have one of these, you're in a scanSessions callback context, and so
- * have locked the whole catalog and, if the observed session is bound to an operation context,
- * you hold that operation context's client's mutex, as well.
+ * have locked the catalog partition the session maps to and, if the observed session is bound to
+ * an operation context, you hold that operation context's client's mutex, as well.
  */
 class ObservableSession {
 public:
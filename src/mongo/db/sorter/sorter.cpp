@@ -49,6 +49,7 @@
 #include "mongo/db/sorter/sorter.h"
 
 #include <algorithm>
+#include <array>
 #include <cerrno>
 #include <cstdint>
 #include <cstdlib>
@@ -91,6 +92,9 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 #include "mongo/util/file.h"
@@ -131,6 +135,11 @@ EncryptionHooks* getEncryptionHooksIfEnabled() {
 
 constexpr std::size_t kSortedFileBufferSize = 64 * 1024;
 
+// How many bytes of a spilled range a FileIterator reads from disk at a time. Serving block
+// headers and payloads from this buffer turns the many small reads of a merge into a few large
+// sequential ones per range.
+constexpr std::size_t kSorterFileReadAheadSize = 64 * 1024;
+
 }  // namespace
 
 namespace sorter {
@@ -143,6 +152,184 @@ inline std::string myErrnoWithDescription() {
     return sb.str();
 }
 
+/**
+ * Minimum number of elements each worker thread should be responsible for before it is worth
+ * paying the thread startup and merge costs of parallelSort().
+ */
+constexpr std::size_t kParallelSortMinPerThread = 64 * 1024;
+
+/**
+ * Sorts ['begin', 'end') using up to 'maxSortThreads' threads. The range is partitioned into
+ * equally sized chunks which are sorted on their own threads, and the sorted chunks are then
+ * combined with a tree of std::inplace_merge passes, with the independent merges of each level
+ * also running in parallel. Falls back to a plain std::sort for small inputs or when the
+ * 'maxSortThreads' server parameter is 1.
+ *
+ * Exceptions thrown by the comparator on a worker thread are rethrown on the calling thread.
+ */
+template <typename Iterator, typename Less>
+void parallelSort(Iterator begin, Iterator end, const Less& less) {
+    const std::size_t numElements = static_cast<std::size_t>(end - begin);
+    std::size_t numThreads = static_cast<std::size_t>(maxSortThreads.load());
+    numThreads = std::min(numThreads, numElements / kParallelSortMinPerThread);
+    if (numThreads <= 1) {
+        std::sort(begin, end, less);
+        return;
+    }
+
+    // Runs 'fn(i)' for each i in [0, n), reusing the calling thread for i == 0, and rethrows the
+    // first exception raised by any invocation. The spawned threads are short-lived relative to
+    // the sort itself, so there is no benefit to pooling them across passes.
+    auto inParallel = [](std::size_t n, auto&& fn) {
+        std::vector<stdx::thread> workers;
+        workers.reserve(n - 1);
+        std::vector<std::exception_ptr> exceptions(n);
+        for (std::size_t i = 1; i < n; ++i) {
+            workers.emplace_back([&, i] {
+                try {
+                    fn(i);
+                } catch (...) {
+                    exceptions[i] = std::current_exception();
+                }
+            });
+        }
+        try {
+            fn(0);
+        } catch (...) {
+            exceptions[0] = std::current_exception();
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (auto& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    };
+
+    // Partition into equal chunks and sort each chunk on its own thread. 'bounds' holds the chunk
+    // boundaries, so chunk i is [bounds[i], bounds[i + 1]).
+    std::vector<Iterator> bounds;
+    bounds.reserve(numThreads + 1);
+    for (std::size_t i = 0; i <= numThreads; ++i) {
+        bounds.push_back(begin + (numElements * i) / numThreads);
+    }
+    inParallel(numThreads, [&](std::size_t i) { std::sort(bounds[i], bounds[i + 1], less); });
+
+    // Merge adjacent sorted chunks pairwise until a single sorted range remains. Each level halves
+    // the number of chunks; a chunk without a partner is carried over to the next level.
+    while (bounds.size() > 2) {
+        const std::size_t numMerges = (bounds.size() - 1) / 2;
+        inParallel(numMerges, [&](std::size_t i) {
+            std::inplace_merge(bounds[2 * i], bounds[2 * i + 1], bounds[2 * i + 2], less);
+        });
+
+        std::vector<Iterator> merged;
+        merged.reserve(numMerges + 2);
+        merged.push_back(bounds.front());
+        for (std::size_t i = 0; i < numMerges; ++i) {
+            merged.push_back(bounds[2 * i + 2]);
+        }
+        if ((bounds.size() - 1) % 2 == 1) {
+            merged.push_back(bounds.back());
+        }
+        bounds = std::move(merged);
+    }
+}
+
+/**
+ * Whether 'Comparator' orders keys exactly as a memcmp of their byte representations, with a
+ * shorter key sorting before any longer key it is a prefix of. Comparators declare this property
+ * with
+ *     static constexpr bool kByteComparable = true;
+ * and the key type must then expose its bytes through getView(). Byte-comparable keys (e.g.
+ * key_string::Value) are eligible for the radixSort() fast path.
+ */
+template <typename Comparator>
+constexpr bool comparatorIsByteComparable() {
+    if constexpr (requires { Comparator::kByteComparable; }) {
+        return Comparator::kByteComparable;
+    } else {
+        return false;
+    }
+}
+
+// Below this many elements the bucket bookkeeping of radixSort() costs more than the comparisons
+// it saves, so small buckets are finished with a comparison sort.
+constexpr std::size_t kRadixSortMinElements = 128;
+
+/**
+ * In-place MSD (most significant digit first) radix sort of the ['begin', 'end') range of
+ * (key, value) pairs on the bytes of each key's getView(), starting at byte 'depth'. Keys
+ * exhausted at 'depth' sort first, matching the memcmp convention that a shorter key precedes
+ * every longer key it prefixes. Produces the same order as a comparison sort with a
+ * byte-comparable comparator (see comparatorIsByteComparable()) but visits each key byte once
+ * instead of O(log n) times, which is a significant win on KeyString-heavy sorts such as the
+ * bulk-load phase of index builds. 'less' is only used to finish buckets smaller than
+ * kRadixSortMinElements.
+ */
+template <typename Iterator, typename Less>
+void radixSort(Iterator begin, Iterator end, const Less& less, std::size_t depth = 0) {
+    while (true) {
+        const std::size_t numElements = static_cast<std::size_t>(end - begin);
+        if (numElements < kRadixSortMinElements) {
+            std::sort(begin, end, less);
+            return;
+        }
+
+        // One bucket per possible byte value, plus bucket 0 for keys exhausted at this depth.
+        constexpr std::size_t kNumBuckets = 257;
+        auto bucketOf = [depth](const auto& elem) {
+            auto view = elem.first.getView();
+            if (depth >= view.size()) {
+                return std::size_t{0};
+            }
+            return static_cast<std::size_t>(static_cast<unsigned char>(view[depth])) + 1;
+        };
+
+        std::array<std::size_t, kNumBuckets + 1> offsets{};
+        for (auto it = begin; it != end; ++it) {
+            ++offsets[bucketOf(*it) + 1];
+        }
+        // If every key has the same byte at this depth, advance to the next byte without
+        // recursing. This keeps the recursion depth bounded by the number of splitting bytes
+        // rather than the key length, which matters when many keys share a long prefix (e.g.
+        // duplicate index keys that only differ in their trailing RecordId).
+        if (std::count(offsets.begin() + 1, offsets.end(), numElements) == 1 &&
+            offsets[1] != numElements) {
+            ++depth;
+            continue;
+        }
+        for (std::size_t b = 0; b < kNumBuckets; ++b) {
+            offsets[b + 1] += offsets[b];
+        }
+
+        // American-flag style in-place permutation: 'next' tracks the first unfilled position of
+        // each bucket. Every swap places one element into its final bucket, so the pass is O(n).
+        std::array<std::size_t, kNumBuckets> next;
+        std::copy_n(offsets.begin(), kNumBuckets, next.begin());
+        for (std::size_t b = 0; b < kNumBuckets; ++b) {
+            while (next[b] < offsets[b + 1]) {
+                const std::size_t target = bucketOf(*(begin + next[b]));
+                if (target == b) {
+                    ++next[b];
+                } else {
+                    std::iter_swap(begin + next[b], begin + next[target]++);
+                }
+            }
+        }
+
+        // Bucket 0 holds keys with no bytes left and is already fully sorted.
+        for (std::size_t b = 1; b < kNumBuckets; ++b) {
+            if (offsets[b + 1] - offsets[b] > 1) {
+                radixSort(begin + offsets[b], begin + offsets[b + 1], less, depth + 1);
+            }
+        }
+        return;
+    }
+}
+
 template <typename Key, typename Comparator>
 void dassertCompIsSane(const Comparator& comp, const Key& lhs, const Key& rhs) {
 #if defined(MONGO_CONFIG_DEBUG_BUILD) && !defined(_MSC_VER)
@@ -393,7 +580,10 @@ private:
     }
 
     /**
-     * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
+     * Attempts to read data from disk. Small reads are served from a larger read-ahead buffer
+     * spanning this iterator's file range, so the underlying file sees a few large sequential
+     * reads per range rather than one small read per block header and payload. Sets _done to true
+     * when file offset reaches _fileEndOffset.
      */
     void _read(void* out, size_t size) {
         if (_fileCurrentOffset == _fileEndOffset) {
@@ -405,8 +595,30 @@ private:
                   str::stream() << "Current file offset (" << _fileCurrentOffset
                                 << ") greater than end offset (" << _fileEndOffset << ")");
 
-        _file->read(_fileCurrentOffset, size, out);
-        _fileCurrentOffset += size;
+        auto* dest = static_cast<char*>(out);
+        while (size > 0) {
+            if (_readAheadConsumed == _readAheadValid) {
+                // The buffer is exhausted, so the next unread byte of the range is at
+                // _fileCurrentOffset. Refill with as much of the remaining range as fits.
+                uassert(9876526, "file too short?", _fileCurrentOffset < _fileEndOffset);
+                if (!_readAheadBuffer) {
+                    _readAheadBuffer = std::make_unique<char[]>(kSorterFileReadAheadSize);
+                }
+                _readAheadValid = std::min(static_cast<std::streamsize>(kSorterFileReadAheadSize),
+                                           static_cast<std::streamsize>(_fileEndOffset -
+                                                                        _fileCurrentOffset));
+                _file->read(_fileCurrentOffset, _readAheadValid, _readAheadBuffer.get());
+                _readAheadConsumed = 0;
+            }
+
+            const auto available =
+                std::min(static_cast<size_t>(_readAheadValid - _readAheadConsumed), size);
+            std::memcpy(dest, _readAheadBuffer.get() + _readAheadConsumed, available);
+            _readAheadConsumed += available;
+            _fileCurrentOffset += available;
+            dest += available;
+            size -= available;
+        }
     }
 
     const Settings _settings;
@@ -414,6 +626,13 @@ private:
 
     std::unique_ptr<char[]> _buffer;
     std::unique_ptr<BufReader> _bufferReader;
+
+    // Read-ahead over this iterator's file range, allocated lazily on the first disk read.
+    // '_readAheadConsumed' bytes of the '_readAheadValid' valid bytes have been handed out.
+    std::unique_ptr<char[]> _readAheadBuffer;
+    std::streamsize _readAheadValid = 0;
+    std::streamsize _readAheadConsumed = 0;
+
     std::shared_ptr<SorterBase::File> _file;  // File containing the sorted data range.
     std::streamoff _fileStartOffset;          // File offset at which the sorted data range starts.
     std::streamoff _fileCurrentOffset;        // File offset at which we are currently reading from.
@@ -884,7 +1103,11 @@ private:
 
     void sort() {
         STLComparator less(this->_comp);
-        std::sort(_data.begin(), _data.end(), less);
+        if constexpr (comparatorIsByteComparable<Comparator>()) {
+            radixSort(_data.begin(), _data.end(), less);
+        } else {
+            parallelSort(_data.begin(), _data.end(), less);
+        }
         this->_stats.incrementNumSorted(_data.size());
         auto& memPool = this->_memPool;
         if (memPool) {
@@ -1372,6 +1595,23 @@ inline SorterBase::File::File(std::string path, SorterFileStats* stats)
 }
 
 inline SorterBase::File::~File() {
+    if (_keep) {
+        try {
+            _drainWriteBehind();
+        } catch (...) {
+            reportFailedDestructor(MONGO_SOURCE_LOCATION());
+        }
+    }
+
+    if (_writeBehindThread.joinable()) {
+        {
+            stdx::lock_guard<stdx::mutex> lk(_writeBehindMutex);
+            _writeBehindShutdown = true;
+        }
+        _writeBehindCondVar.notify_all();
+        _writeBehindThread.join();
+    }
+
     if (_stats && _file.is_open()) {
         _stats->closed.addAndFetch(1);
     }
@@ -1416,6 +1656,9 @@ inline SorterBase::File::~File() {
 }
 
 inline void SorterBase::File::read(std::streamoff offset, std::streamsize size, void* out) {
+    // All buffered data must reach the fstream before it can be read back.
+    _drainWriteBehind();
+
     if (!_file.is_open()) {
         _open();
     }
@@ -1453,12 +1696,28 @@ inline void SorterBase::File::read(std::streamoff offset, std::streamsize size,
 inline void SorterBase::File::write(const char* data, std::streamsize size) {
     _ensureOpenForWriting();
 
+    const auto writeBufferBytes = static_cast<size_t>(sorterSpillWriteBufferBytes);
+    if (writeBufferBytes == 0) {
+        _writeToFile(data, size);
+    } else {
+        // Accumulate the data and let the write-behind thread issue the disk write so the caller
+        // can go back to serializing and compressing the next chunk. Write errors surface on a
+        // later write, drain or read.
+        _writeBuffer.append(data, size);
+        if (_writeBuffer.size() >= writeBufferBytes) {
+            _submitWriteBuffer();
+        }
+    }
+
+    _offset += size;
+    if (_stats) {
+        this->_stats->addSpilledDataSize(size);
+    }
+}
+
+inline void SorterBase::File::_writeToFile(const char* data, std::streamsize size) {
     try {
         _file.write(data, size);
-        _offset += size;
-        if (_stats) {
-            this->_stats->addSpilledDataSize(size);
-        };
     } catch (const std::system_error& ex) {
         if (ex.code() == std::errc::no_space_on_device) {
             uasserted(ErrorCodes::OutOfDiskSpace,
@@ -1474,6 +1733,66 @@ inline void SorterBase::File::write(const char* data, std::streamsize size) {
     }
 }
 
+inline void SorterBase::File::_submitWriteBuffer() {
+    stdx::unique_lock<stdx::mutex> lk(_writeBehindMutex);
+    if (!_writeBehindThread.joinable()) {
+        _writeBehindThread = stdx::thread([this] {
+            _runWriteBehind();
+        });
+    }
+
+    // Double buffering: wait for the previous buffer to hit the fstream before swapping in the
+    // next one.
+    _writeBehindCondVar.wait(lk, [&] { return !_writeBehindActive; });
+    uassertStatusOK(_writeBehindStatus);
+
+    _inFlightWriteBuffer.swap(_writeBuffer);
+    _writeBuffer.clear();
+    _writeBehindActive = true;
+    _writeBehindCondVar.notify_all();
+}
+
+inline void SorterBase::File::_drainWriteBehind() {
+    if (_writeBehindThread.joinable()) {
+        stdx::unique_lock<stdx::mutex> lk(_writeBehindMutex);
+        _writeBehindCondVar.wait(lk, [&] { return !_writeBehindActive; });
+        uassertStatusOK(_writeBehindStatus);
+    }
+
+    if (!_writeBuffer.empty()) {
+        // Whatever did not fill a whole buffer is written inline; the write-behind thread is idle
+        // at this point so the fstream is safe to touch.
+        _writeToFile(_writeBuffer.data(), _writeBuffer.size());
+        _writeBuffer.clear();
+    }
+}
+
+inline void SorterBase::File::_runWriteBehind() {
+    stdx::unique_lock<stdx::mutex> lk(_writeBehindMutex);
+    while (true) {
+        _writeBehindCondVar.wait(lk, [&] { return _writeBehindActive || _writeBehindShutdown; });
+        if (!_writeBehindActive) {
+            return;
+        }
+
+        lk.unlock();
+        Status status = Status::OK();
+        try {
+            _writeToFile(_inFlightWriteBuffer.data(), _inFlightWriteBuffer.size());
+        } catch (const DBException& ex) {
+            status = ex.toStatus();
+        }
+        lk.lock();
+
+        _inFlightWriteBuffer.clear();
+        if (_writeBehindStatus.isOK()) {
+            _writeBehindStatus = status;
+        }
+        _writeBehindActive = false;
+        _writeBehindCondVar.notify_all();
+    }
+}
+
 inline std::streamoff SorterBase::File::currentOffset() {
     _ensureOpenForWriting();
     invariant(_offset >= 0);
@@ -45,6 +45,7 @@
 #include <utility>
 #include <vector>
 
+#include "mongo/base/status.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/query/query_shape/serialization_options.h"
@@ -52,6 +53,9 @@
 #include "mongo/db/sorter/sorter_gen.h"
 #include "mongo/db/sorter/sorter_stats.h"
 #include "mongo/logv2/log_attr.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 #include "mongo/util/shared_buffer_fragment.h"
@@ -335,9 +339,47 @@ public:
          */
         void _ensureOpenForWriting();
 
+        /**
+         * Appends the given data to the underlying fstream, translating failures into
+         * DBExceptions. Called on the caller's thread when write-behind is disabled and on
+         * '_writeBehindThread' otherwise.
+         */
+        void _writeToFile(const char* data, std::streamsize size);
+
+        /**
+         * Hands '_writeBuffer' to the write-behind thread, starting the thread on first use.
+         * Blocks while a previously submitted buffer is still being written so that at most one
+         * write is in flight while the next buffer fills.
+         */
+        void _submitWriteBuffer();
+
+        /**
+         * Blocks until any in-flight write completes, rethrows any write error the write-behind
+         * thread encountered and writes whatever remains in '_writeBuffer' inline.
+         */
+        void _drainWriteBehind();
+
+        void _runWriteBehind();
+
         boost::filesystem::path _path;
         std::fstream _file;
 
+        // Spilled data accumulates here and is handed to '_writeBehindThread' one buffer at a
+        // time, so serializing and compressing the next buffer overlaps the disk write of the
+        // previous one. Unused when 'sorterSpillWriteBufferBytes' is 0; writes then go straight to
+        // the fstream.
+        std::string _writeBuffer;
+        std::string _inFlightWriteBuffer;
+
+        // The members below are guarded by '_writeBehindMutex'. '_writeBehindThread' only touches
+        // '_file' while '_writeBehindActive' is true.
+        bool _writeBehindActive = false;
+        bool _writeBehindShutdown = false;
+        Status _writeBehindStatus = Status::OK();
+        stdx::thread _writeBehindThread;
+        stdx::mutex _writeBehindMutex;
+        stdx::condition_variable _writeBehindCondVar;
+
         // The current offset of the end of the file if there may be unflushed data, or -1 if the
         // file either has not yet been opened or has been flushed.
         std::streamoff _offset = -1;
@@ -42,6 +42,7 @@
 #include "mongo/base/static_assert.h"
 #include "mongo/config.h"  // IWYU pragma: keep
 #include "mongo/db/sorter/sorter.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/random.h"
 #include "mongo/stdx/thread.h"  // IWYU pragma: keep
@@ -399,6 +400,26 @@ private:
     }
 };
 
+TEST(SorterFileTest, WriteBehindRoundTrip) {
+    unittest::TempDir tempDir("sorterFileWriteBehindTest");
+    const SortOptions opts = SortOptions().TempDir(tempDir.path());
+
+    // Exercise synchronous writes and a write-behind buffer small enough that every spilled chunk
+    // is handed to the write-behind thread.
+    for (int bufferBytes : {0, 1024}) {
+        RAIIServerParameterControllerForTest bufferBytesParam("sorterSpillWriteBufferBytes",
+                                                              bufferBytes);
+        auto file = std::make_shared<Sorter<IntWrapper, IntWrapper>::File>(
+            sorter::nextFileName(opts.tempDir));
+        SortedFileWriter<IntWrapper, IntWrapper> writer(opts, std::move(file));
+        const int numItems = 100000;
+        for (int i = 0; i < numItems; ++i) {
+            writer.addAlreadySorted(i, -i);
+        }
+        ASSERT_ITERATORS_EQUIVALENT(writer.done(), std::make_unique<IntIterator>(0, numItems));
+    }
+}
+
 
 class MergeIteratorTests {
 public:
@@ -1066,6 +1087,31 @@ protected:
     static constexpr size_t kLimit = kElementCount / 2;
 };
 
+/**
+ * Exercises the multi-threaded in-memory sort path (see parallelSort()). With 'InMemory' the
+ * entire data set is sorted in memory in parallel; otherwise the memory limit is sized so that
+ * each spilled run is still large enough for the parallel path to engage.
+ */
+template <bool InMemory, bool Random = true>
+class ParallelSortLotsOfData : public LotsOfDataLittleMemory<Random> {
+    SortOptions adjustSortOptions(SortOptions opts) override {
+        // Each sorted run must hold well over 2 * kParallelSortMinPerThread items for the sort to
+        // actually run in parallel.
+        return opts.MaxMemoryUsageBytes(InMemory ? 64 * 1024 * 1024 : 4 * 1024 * 1024)
+            .ExtSortAllowed();
+    }
+
+    size_t correctNumRanges() const override {
+        return 0;
+    }
+
+    size_t correctSpilledRanges() const override {
+        return 0;
+    }
+
+    RAIIServerParameterControllerForTest _maxSortThreads{"maxSortThreads", 4};
+};
+
 }  // namespace SorterTests
 
 class SorterSuite : public unittest::OldStyleSuiteSpecification {
@@ -1113,6 +1159,8 @@ public:
         add<SorterTests::PauseAndResumeLimitOne>();
         add<SorterTests::ManualSpills>();
         add<SorterTests::ManualSpillsWithLimit>();
+        add<SorterTests::ParallelSortLotsOfData</*inMemory=*/true>>();
+        add<SorterTests::ParallelSortLotsOfData</*inMemory=*/false>>();
     }
 };
 
@@ -1410,6 +1458,101 @@ DEATH_TEST_F(SorterMakeFromExistingRangesTest,
     // used the wrong checksum algorithm)
 }
 
+/**
+ * A key whose sort order is a memcmp of its bytes, like key_string::Value. Used to exercise the
+ * radix-sort fast path taken when a comparator declares itself byte-comparable (see radixSort()
+ * in sorter.cpp).
+ */
+class ByteComparableKey {
+public:
+    ByteComparableKey(std::string bytes = "") : _bytes(std::move(bytes)) {}
+
+    std::span<const char> getView() const {
+        return {_bytes.data(), _bytes.size()};
+    }
+
+    /// members for Sorter
+    struct SorterDeserializeSettings {};  // unused
+    void serializeForSorter(BufBuilder& buf) const {
+        buf.appendNum(static_cast<int>(_bytes.size()));
+        buf.appendBuf(_bytes.data(), _bytes.size());
+    }
+    static ByteComparableKey deserializeForSorter(BufReader& buf, const SorterDeserializeSettings&) {
+        auto size = buf.read<LittleEndian<int>>().value;
+        return ByteComparableKey(std::string(static_cast<const char*>(buf.skip(size)), size));
+    }
+    int memUsageForSorter() const {
+        return sizeof(ByteComparableKey) + _bytes.capacity();
+    }
+    ByteComparableKey getOwned() const {
+        return *this;
+    }
+    void makeOwned() {}
+
+private:
+    std::string _bytes;
+};
+
+struct ByteComparableComparator {
+    static constexpr bool kByteComparable = true;
+
+    int operator()(const ByteComparableKey& l, const ByteComparableKey& r) const {
+        auto lv = l.getView();
+        auto rv = r.getView();
+        if (int cmp = std::memcmp(lv.data(), rv.data(), std::min(lv.size(), rv.size()))) {
+            return cmp;
+        }
+        return lv.size() < rv.size() ? -1 : lv.size() > rv.size() ? 1 : 0;
+    }
+};
+
+TEST(RadixSorterTest, SortsByteComparableKeys) {
+    unittest::TempDir tempDir("radix_sorter_test");
+    const SortOptions opts =
+        SortOptions().TempDir(tempDir.path()).MaxMemoryUsageBytes(100 * 1024 * 1024);
+
+    PseudoRandom random(int64_t(time(nullptr)));
+    std::vector<std::string> keys;
+
+    // Random keys of varying lengths, with duplicates.
+    for (int i = 0; i < 5000; i++) {
+        std::string key;
+        const int len = random.nextInt32(20);
+        for (int j = 0; j < len; j++) {
+            key.push_back(static_cast<char>(random.nextInt32(256)));
+        }
+        keys.push_back(key);
+        if (i % 10 == 0) {
+            keys.push_back(key);
+        }
+    }
+
+    // A cluster of keys sharing a long common prefix, which makes radixSort() skip ahead past
+    // the shared bytes rather than recursing on each of them.
+    const std::string prefix(64, 'x');
+    for (int i = 0; i < 500; i++) {
+        keys.push_back(prefix + std::to_string(random.nextInt32(100)));
+    }
+
+    using KeySorter = Sorter<ByteComparableKey, NullValue>;
+    auto sorter =
+        std::unique_ptr<KeySorter>(KeySorter::make(opts, ByteComparableComparator()));
+    for (const auto& key : keys) {
+        sorter->add(ByteComparableKey(key), NullValue());
+    }
+
+    // std::string comparison has the same order as the byte-comparable comparator.
+    std::sort(keys.begin(), keys.end());
+
+    auto iter = sorter->done();
+    for (const auto& expected : keys) {
+        ASSERT(iter->more());
+        auto view = iter->next().first.getView();
+        ASSERT_EQ(expected, std::string(view.data(), view.size()));
+    }
+    ASSERT_FALSE(iter->more());
+}
+
 class BoundedSorterTest : public unittest::Test {
 public:
     using Key = IntWrapper;
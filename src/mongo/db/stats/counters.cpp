@@ -47,26 +47,29 @@ namespace mongo {
 using namespace fmt::literals;
 
 void OpCounters::_reset() {
-    _insert->store(0);
-    _query->store(0);
-    _update->store(0);
-    _delete->store(0);
-    _getmore->store(0);
-    _command->store(0);
-    _nestedAggregate->store(0);
-
-    _queryDeprecated->store(0);
-
-    _insertOnExistingDoc->store(0);
-    _updateOnMissingDoc->store(0);
-    _deleteWasEmpty->store(0);
-    _deleteFromMissingNamespace->store(0);
-    _acceptableErrorInCommand->store(0);
+    _insert.setToZero();
+    _query.setToZero();
+    _update.setToZero();
+    _delete.setToZero();
+    _getmore.setToZero();
+    _command.setToZero();
+    _nestedAggregate.setToZero();
+
+    _queryDeprecated.setToZero();
+
+    _insertOnExistingDoc.setToZero();
+    _updateOnMissingDoc.setToZero();
+    _deleteWasEmpty.setToZero();
+    _deleteFromMissingNamespace.setToZero();
+    _acceptableErrorInCommand.setToZero();
 }
 
-void OpCounters::_checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n) {
-    static constexpr auto maxCount = 1LL << 60;
-    auto oldValue = (this->*counter)->fetchAndAddRelaxed(n);
+void OpCounters::_checkWrap(StripedCounter64 OpCounters::*counter, int n) {
+    // Each increment only observes the previous value of the calling thread's stripe, so the
+    // per-stripe limit is the overall 2^60 limit divided by the stripe count; the summed value
+    // stays bounded as before.
+    static constexpr auto maxCount = (1LL << 60) / StripedCounter64::kNumStripes;
+    auto oldValue = (this->*counter).fetchAndAddRelaxed(n);
     if (oldValue > maxCount) {
         _reset();
     }
@@ -74,25 +77,25 @@ void OpCounters::_checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*c
 
 BSONObj OpCounters::getObj() const {
     BSONObjBuilder b;
-    b.append("insert", _insert->loadRelaxed());
-    b.append("query", _query->loadRelaxed());
-    b.append("update", _update->loadRelaxed());
-    b.append("delete", _delete->loadRelaxed());
-    b.append("getmore", _getmore->loadRelaxed());
-    b.append("command", _command->loadRelaxed());
-
-    auto queryDep = _queryDeprecated->loadRelaxed();
+    b.append("insert", _insert.get());
+    b.append("query", _query.get());
+    b.append("update", _update.get());
+    b.append("delete", _delete.get());
+    b.append("getmore", _getmore.get());
+    b.append("command", _command.get());
+
+    auto queryDep = _queryDeprecated.get();
     if (queryDep > 0) {
         BSONObjBuilder d(b.subobjStart("deprecated"));
         d.append("query", queryDep);
     }
 
     // Append counters for constraint relaxations, only if they exist.
-    auto insertOnExistingDoc = _insertOnExistingDoc->loadRelaxed();
-    auto updateOnMissingDoc = _updateOnMissingDoc->loadRelaxed();
-    auto deleteWasEmpty = _deleteWasEmpty->loadRelaxed();
-    auto deleteFromMissingNamespace = _deleteFromMissingNamespace->loadRelaxed();
-    auto acceptableErrorInCommand = _acceptableErrorInCommand->loadRelaxed();
+    auto insertOnExistingDoc = _insertOnExistingDoc.get();
+    auto updateOnMissingDoc = _updateOnMissingDoc.get();
+    auto deleteWasEmpty = _deleteWasEmpty.get();
+    auto deleteFromMissingNamespace = _deleteFromMissingNamespace.get();
+    auto acceptableErrorInCommand = _acceptableErrorInCommand.get();
     auto totalRelaxed = insertOnExistingDoc + updateOnMissingDoc + deleteWasEmpty +
         deleteFromMissingNamespace + acceptableErrorInCommand;
 
@@ -109,32 +112,25 @@ BSONObj OpCounters::getObj() const {
 }
 
 void NetworkCounter::hitPhysicalIn(ConnectionType connectionType, long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
+    // The increment only observes the calling thread's stripe, so the limit is per-stripe.
+    static const int64_t MAX = (1LL << 60) / StripedCounter64::kNumStripes;
     auto& ref = connectionType == ConnectionType::kIngress ? _ingressPhysicalBytesIn
                                                            : _egressPhysicalBytesIn;
 
     // don't care about the race as its just a counter
-    const bool overflow = ref->loadRelaxed() > MAX;
-
-    if (overflow) {
-        ref->store(bytes);
-    } else {
-        ref->fetchAndAdd(bytes);
+    if (ref.fetchAndAddRelaxed(bytes) > MAX) {
+        ref.setToZero();
     }
 }
 
 void NetworkCounter::hitPhysicalOut(ConnectionType connectionType, long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
+    static const int64_t MAX = (1LL << 60) / StripedCounter64::kNumStripes;
     auto& ref = connectionType == ConnectionType::kIngress ? _ingressPhysicalBytesOut
                                                            : _egressPhysicalBytesOut;
 
     // don't care about the race as its just a counter
-    const bool overflow = ref->loadRelaxed() > MAX;
-
-    if (overflow) {
-        ref->store(bytes);
-    } else {
-        ref->fetchAndAdd(bytes);
+    if (ref.fetchAndAddRelaxed(bytes) > MAX) {
+        ref.setToZero();
     }
 }
 
@@ -158,17 +154,13 @@ void NetworkCounter::hitLogicalIn(ConnectionType connectionType, long long bytes
 }
 
 void NetworkCounter::hitLogicalOut(ConnectionType connectionType, long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
+    static const int64_t MAX = (1LL << 60) / StripedCounter64::kNumStripes;
     auto& ref = connectionType == ConnectionType::kIngress ? _ingressLogicalBytesOut
                                                            : _egressLogicalBytesOut;
 
     // don't care about the race as its just a counter
-    const bool overflow = ref->loadRelaxed() > MAX;
-
-    if (overflow) {
-        ref->store(bytes);
-    } else {
-        ref->fetchAndAdd(bytes);
+    if (ref.fetchAndAddRelaxed(bytes) > MAX) {
+        ref.setToZero();
     }
 }
 
@@ -186,18 +178,16 @@ void NetworkCounter::acceptedTFOIngress() {
 
 void NetworkCounter::append(BSONObjBuilder& b) {
     b.append("bytesIn", static_cast<long long>(_ingressTogether->logicalBytesIn.loadRelaxed()));
-    b.append("bytesOut", static_cast<long long>(_ingressLogicalBytesOut->loadRelaxed()));
-    b.append("physicalBytesIn", static_cast<long long>(_ingressPhysicalBytesIn->loadRelaxed()));
-    b.append("physicalBytesOut", static_cast<long long>(_ingressPhysicalBytesOut->loadRelaxed()));
+    b.append("bytesOut", _ingressLogicalBytesOut.get());
+    b.append("physicalBytesIn", _ingressPhysicalBytesIn.get());
+    b.append("physicalBytesOut", _ingressPhysicalBytesOut.get());
 
     BSONObjBuilder egressBuilder(b.subobjStart("egress"));
     egressBuilder.append("bytesIn",
                          static_cast<long long>(_egressTogether->logicalBytesIn.loadRelaxed()));
-    egressBuilder.append("bytesOut", static_cast<long long>(_egressLogicalBytesOut->loadRelaxed()));
-    egressBuilder.append("physicalBytesIn",
-                         static_cast<long long>(_egressPhysicalBytesIn->loadRelaxed()));
-    egressBuilder.append("physicalBytesOut",
-                         static_cast<long long>(_egressPhysicalBytesOut->loadRelaxed()));
+    egressBuilder.append("bytesOut", _egressLogicalBytesOut.get());
+    egressBuilder.append("physicalBytesIn", _egressPhysicalBytesIn.get());
+    egressBuilder.append("physicalBytesOut", _egressPhysicalBytesOut.get());
     egressBuilder.append("numRequests",
                          static_cast<long long>(_egressTogether->requests.loadRelaxed()));
     egressBuilder.done();
@@ -39,6 +39,7 @@
 #include <utility>
 #include <vector>
 
+#include "mongo/base/counter.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
@@ -117,41 +118,41 @@ public:
     }
 
     // thse are used by metrics things, do not remove
-    const AtomicWord<long long>* getInsert() const {
-        return &*_insert;
+    long long getInsert() const {
+        return _insert.get();
     }
-    const AtomicWord<long long>* getQuery() const {
-        return &*_query;
+    long long getQuery() const {
+        return _query.get();
     }
-    const AtomicWord<long long>* getUpdate() const {
-        return &*_update;
+    long long getUpdate() const {
+        return _update.get();
     }
-    const AtomicWord<long long>* getDelete() const {
-        return &*_delete;
+    long long getDelete() const {
+        return _delete.get();
     }
-    const AtomicWord<long long>* getGetMore() const {
-        return &*_getmore;
+    long long getGetMore() const {
+        return _getmore.get();
     }
-    const AtomicWord<long long>* getCommand() const {
-        return &*_command;
+    long long getCommand() const {
+        return _command.get();
     }
-    const AtomicWord<long long>* getNestedAggregate() const {
-        return &*_nestedAggregate;
+    long long getNestedAggregate() const {
+        return _nestedAggregate.get();
     }
-    const AtomicWord<long long>* getInsertOnExistingDoc() const {
-        return &*_insertOnExistingDoc;
+    long long getInsertOnExistingDoc() const {
+        return _insertOnExistingDoc.get();
     }
-    const AtomicWord<long long>* getUpdateOnMissingDoc() const {
-        return &*_updateOnMissingDoc;
+    long long getUpdateOnMissingDoc() const {
+        return _updateOnMissingDoc.get();
     }
-    const AtomicWord<long long>* getDeleteWasEmpty() const {
-        return &*_deleteWasEmpty;
+    long long getDeleteWasEmpty() const {
+        return _deleteWasEmpty.get();
     }
-    const AtomicWord<long long>* getDeleteFromMissingNamespace() const {
-        return &*_deleteFromMissingNamespace;
+    long long getDeleteFromMissingNamespace() const {
+        return _deleteFromMissingNamespace.get();
     }
-    const AtomicWord<long long>* getAcceptableErrorInCommand() const {
-        return &*_acceptableErrorInCommand;
+    long long getAcceptableErrorInCommand() const {
+        return _acceptableErrorInCommand.get();
     }
 
     // Reset all counters. To used for testing purposes only.
@@ -164,24 +165,24 @@ private:
     void _reset();
 
     // Increment member `counter` by `n`, resetting all counters if it was > 2^60.
-    void _checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n);
-
-    CacheExclusive<AtomicWord<long long>> _insert;
-    CacheExclusive<AtomicWord<long long>> _query;
-    CacheExclusive<AtomicWord<long long>> _update;
-    CacheExclusive<AtomicWord<long long>> _delete;
-    CacheExclusive<AtomicWord<long long>> _getmore;
-    CacheExclusive<AtomicWord<long long>> _command;
-    CacheExclusive<AtomicWord<long long>> _nestedAggregate;
-
-    CacheExclusive<AtomicWord<long long>> _insertOnExistingDoc;
-    CacheExclusive<AtomicWord<long long>> _updateOnMissingDoc;
-    CacheExclusive<AtomicWord<long long>> _deleteWasEmpty;
-    CacheExclusive<AtomicWord<long long>> _deleteFromMissingNamespace;
-    CacheExclusive<AtomicWord<long long>> _acceptableErrorInCommand;
+    void _checkWrap(StripedCounter64 OpCounters::*counter, int n);
+
+    StripedCounter64 _insert;
+    StripedCounter64 _query;
+    StripedCounter64 _update;
+    StripedCounter64 _delete;
+    StripedCounter64 _getmore;
+    StripedCounter64 _command;
+    StripedCounter64 _nestedAggregate;
+
+    StripedCounter64 _insertOnExistingDoc;
+    StripedCounter64 _updateOnMissingDoc;
+    StripedCounter64 _deleteWasEmpty;
+    StripedCounter64 _deleteFromMissingNamespace;
+    StripedCounter64 _acceptableErrorInCommand;
 
     // Counter for the deprecated OP_QUERY opcode.
-    CacheExclusive<AtomicWord<long long>> _queryDeprecated;
+    StripedCounter64 _queryDeprecated;
 };
 
 OpCounters& serviceOpCounters(ClusterRole role);
@@ -228,28 +229,29 @@ public:
     void append(BSONObjBuilder& b);
 
 private:
-    CacheExclusive<AtomicWord<long long>> _ingressPhysicalBytesIn{0};
-    CacheExclusive<AtomicWord<long long>> _ingressPhysicalBytesOut{0};
+    StripedCounter64 _ingressPhysicalBytesIn;
+    StripedCounter64 _ingressPhysicalBytesOut;
 
-    CacheExclusive<AtomicWord<long long>> _egressPhysicalBytesIn{0};
-    CacheExclusive<AtomicWord<long long>> _egressPhysicalBytesOut{0};
+    StripedCounter64 _egressPhysicalBytesIn;
+    StripedCounter64 _egressPhysicalBytesOut;
 
     // These two counters are always incremented at the same time, so
     // we place them on the same cache line. We use
     // CacheCombinedExclusive to ensure that they are combined within
     // the scope of a constructive interference region, and protected
     // from false sharing by padding out to destructive interference
-    // size.
+    // size. Striping them would forfeit that pairing, so they stay as
+    // single atomics.
     struct Together {
         AtomicWord<long long> logicalBytesIn{0};
         AtomicWord<long long> requests{0};
     };
 
     CacheCombinedExclusive<Together> _ingressTogether{};
-    CacheExclusive<AtomicWord<long long>> _ingressLogicalBytesOut{0};
+    StripedCounter64 _ingressLogicalBytesOut;
 
     CacheCombinedExclusive<Together> _egressTogether{};
-    CacheExclusive<AtomicWord<long long>> _egressLogicalBytesOut{0};
+    StripedCounter64 _egressLogicalBytesOut;
 
     CacheExclusive<AtomicWord<long long>> _numSlowDNSOperations{0};
     CacheExclusive<AtomicWord<long long>> _numSlowSSLOperations{0};
@@ -408,22 +410,23 @@ public:
 
     // Query counters that record whether a find query was fully or partially executed in SBE, or
     // fully executed using the classic engine. One of these will always be incremented during a
-    // query.
-    Counter64& sbeFindQueryCounter = *MetricBuilder<Counter64>{"query.queryFramework.find.sbe"};
-    Counter64& classicFindQueryCounter =
-        *MetricBuilder<Counter64>{"query.queryFramework.find.classic"};
+    // query, by whichever thread ran it, so they are striped to avoid cache-line contention.
+    StripedCounter64& sbeFindQueryCounter =
+        *MetricBuilder<StripedCounter64>{"query.queryFramework.find.sbe"};
+    StripedCounter64& classicFindQueryCounter =
+        *MetricBuilder<StripedCounter64>{"query.queryFramework.find.classic"};
 
     // Aggregation query counters that record whether an aggregation was fully or partially executed
     // in DocumentSource (an sbe/classic hybrid plan), or fully pushed down to the sbe/classic
     // layer. These are only incremented during aggregations.
-    Counter64& sbeOnlyAggregationCounter =
-        *MetricBuilder<Counter64>{"query.queryFramework.aggregate.sbeOnly"};
-    Counter64& classicOnlyAggregationCounter =
-        *MetricBuilder<Counter64>{"query.queryFramework.aggregate.classicOnly"};
-    Counter64& sbeHybridAggregationCounter =
-        *MetricBuilder<Counter64>{"query.queryFramework.aggregate.sbeHybrid"};
-    Counter64& classicHybridAggregationCounter =
-        *MetricBuilder<Counter64>{"query.queryFramework.aggregate.classicHybrid"};
+    StripedCounter64& sbeOnlyAggregationCounter =
+        *MetricBuilder<StripedCounter64>{"query.queryFramework.aggregate.sbeOnly"};
+    StripedCounter64& classicOnlyAggregationCounter =
+        *MetricBuilder<StripedCounter64>{"query.queryFramework.aggregate.classicOnly"};
+    StripedCounter64& sbeHybridAggregationCounter =
+        *MetricBuilder<StripedCounter64>{"query.queryFramework.aggregate.sbeHybrid"};
+    StripedCounter64& classicHybridAggregationCounter =
+        *MetricBuilder<StripedCounter64>{"query.queryFramework.aggregate.classicHybrid"};
 };
 extern QueryFrameworkCounters queryFrameworkCounters;
 
@@ -438,9 +441,11 @@ public:
     }
 
     // Counter for the number of queries planned using idHack fast planning.
-    Counter64& idHackQueryCounter = *MetricBuilder<Counter64>{"query.planning.fastPath.idHack"};
+    StripedCounter64& idHackQueryCounter =
+        *MetricBuilder<StripedCounter64>{"query.planning.fastPath.idHack"};
     // Counter for the number of queries planned using express fast planning.
-    Counter64& expressQueryCounter = *MetricBuilder<Counter64>{"query.planning.fastPath.express"};
+    StripedCounter64& expressQueryCounter =
+        *MetricBuilder<StripedCounter64>{"query.planning.fastPath.express"};
 };
 extern FastPathQueryCounters fastPathQueryCounters;
 
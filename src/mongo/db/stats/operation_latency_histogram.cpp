@@ -271,6 +271,19 @@ void OperationLatencyHistogram::append(bool includeHistograms,
     appendHistograms(_histograms, includeHistograms, slowMSBucketsOnly, *builder);
 }
 
+void OperationLatencyHistogram::add(const OperationLatencyHistogram& other) {
+    for (int i = 0; i < operation_latency_histogram_details::kHistogramsCount; i++) {
+        auto& histogram = _histograms[i];
+        const auto& otherHistogram = other._histograms[i];
+        for (int bucket = 0; bucket < operation_latency_histogram_details::kMaxBuckets; bucket++) {
+            histogram.buckets[bucket] += otherHistogram.buckets[bucket];
+        }
+        histogram.entryCount += otherHistogram.entryCount;
+        histogram.sum += otherHistogram.sum;
+        histogram.sumQueryableEncryption += otherHistogram.sumQueryableEncryption;
+    }
+}
+
 void AtomicOperationLatencyHistogram::increment(uint64_t latency,
                                                 Command::ReadWriteType type,
                                                 bool isQueryableEncryptionOperation) {
@@ -78,6 +78,11 @@ public:
      */
     void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
 
+    /**
+     * Adds the bucket counts and latency totals of "other" into this histogram.
+     */
+    void add(const OperationLatencyHistogram& other);
+
 private:
     std::array<HistogramType, operation_latency_histogram_details::kHistogramsCount> _histograms;
 };
@@ -101,6 +101,33 @@ TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatency) {
     }
 }
 
+// Verify that adding one histogram into another sums bucket counts and latency totals.
+TEST(OperationLatencyHistogram, AddSumsBucketCountsAndTotals) {
+    OperationLatencyHistogram hist;
+    OperationLatencyHistogram other;
+    for (int i = 0; i < kMaxBuckets; i++) {
+        hist.increment(kLowerBounds[i], Command::ReadWriteType::kRead, false);
+        other.increment(kLowerBounds[i], Command::ReadWriteType::kRead, false);
+        other.increment(kLowerBounds[i], Command::ReadWriteType::kWrite, false);
+    }
+
+    hist.add(other);
+
+    uint64_t expectedSum = 2 * std::accumulate(kLowerBounds.begin(), kLowerBounds.end(), 0ULL);
+    BSONObjBuilder outBuilder;
+    hist.append(true, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), 2 * kMaxBuckets);
+    ASSERT_EQUALS(static_cast<uint64_t>(out["reads"]["latency"].Long()), expectedSum);
+    ASSERT_EQUALS(out["writes"]["ops"].Long(), kMaxBuckets);
+
+    std::vector<BSONElement> readBuckets = out["reads"]["histogram"].Array();
+    ASSERT_EQUALS(readBuckets.size(), static_cast<unsigned int>(kMaxBuckets));
+    for (int i = 0; i < kMaxBuckets; i++) {
+        ASSERT_EQUALS(readBuckets[i].Obj()["count"].Long(), 2);
+    }
+}
+
 TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatencySlowBuckets) {
     OperationLatencyHistogram hist;
     // Increment at the boundary, boundary+1, and boundary-1.
@@ -0,0 +1,92 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <cstdint>
+#include <utility>
+
+#include "mongo/db/stats/operation_sampler.h"
+#include "mongo/db/stats/operation_sampler_gen.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/random.h"
+#include "mongo/util/static_immortal.h"
+
+namespace mongo {
+
+OperationSampler& OperationSampler::get() {
+    static StaticImmortal<OperationSampler> sampler;
+    return *sampler;
+}
+
+bool OperationSampler::shouldSample(Client* client) const {
+    const double rate = gOperationSamplingRate.loadRelaxed();
+    if (rate <= 0.0) {
+        return false;
+    }
+
+    return client->getPrng().nextCanonicalDouble() < rate;
+}
+
+void OperationSampler::record(BSONObj sample) {
+    auto& stripe = _myStripe();
+    stdx::lock_guard<stdx::mutex> lk(stripe.mutex);
+    if (stripe.samples.size() < kSamplesPerStripe) {
+        stripe.samples.push_back(std::move(sample));
+    } else {
+        stripe.samples[stripe.next] = std::move(sample);
+    }
+    stripe.next = (stripe.next + 1) % kSamplesPerStripe;
+}
+
+std::vector<BSONObj> OperationSampler::getSamples(bool clear) {
+    std::vector<BSONObj> out;
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard<stdx::mutex> lk(stripe.mutex);
+        if (stripe.samples.size() < kSamplesPerStripe) {
+            out.insert(out.end(), stripe.samples.begin(), stripe.samples.end());
+        } else {
+            // The ring has wrapped, so 'next' is the oldest entry.
+            out.insert(out.end(), stripe.samples.begin() + stripe.next, stripe.samples.end());
+            out.insert(out.end(), stripe.samples.begin(), stripe.samples.begin() + stripe.next);
+        }
+
+        if (clear) {
+            stripe.samples.clear();
+            stripe.next = 0;
+        }
+    }
+    return out;
+}
+
+OperationSampler::Stripe& OperationSampler::_myStripe() {
+    static AtomicWord<uint32_t> nextSlot;
+    thread_local const uint32_t slot = nextSlot.fetchAndAdd(1) % kNumStripes;
+    return _stripes[slot];
+}
+
+}  // namespace mongo
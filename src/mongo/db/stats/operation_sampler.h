@@ -0,0 +1,99 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/client.h"
+#include "mongo/stdx/mutex.h"
+
+namespace mongo {
+
+/**
+ * An in-memory buffer of summaries for a sampled fraction of all completed operations.
+ *
+ * Slow query logging only covers operations above the slowms threshold; the aggregate latency of
+ * everything below it is invisible. CurOp records a summary of a uniformly random
+ * 'operationSamplingRate' fraction of all completed operations here regardless of duration,
+ * including lock waits, admission queue times, and basic execution metrics.
+ *
+ * The buffer is striped by thread so that concurrent writers do not contend, and each stripe is a
+ * ring that overwrites its oldest entries, so the buffer always holds the most recent samples and
+ * needs no maintenance. The $operationSamples aggregation stage reads, and optionally clears, the
+ * buffer.
+ *
+ * The fast path for unsampled operations is a single relaxed atomic load.
+ */
+class OperationSampler {
+public:
+    static constexpr size_t kNumStripes = 16;
+    static constexpr size_t kSamplesPerStripe = 1024;
+
+    /**
+     * Gets the process-wide OperationSampler.
+     */
+    static OperationSampler& get();
+
+    /**
+     * Returns true if the caller should record a sample for the operation completing now. Costs
+     * one relaxed atomic load when sampling is disabled, plus one PRNG draw when enabled.
+     */
+    bool shouldSample(Client* client) const;
+
+    /**
+     * Stores 'sample', overwriting the oldest sample in the caller's stripe if it is full.
+     */
+    void record(BSONObj sample);
+
+    /**
+     * Returns the buffered samples, oldest first within each stripe. Empties the buffer if
+     * 'clear' is set.
+     */
+    std::vector<BSONObj> getSamples(bool clear);
+
+private:
+    struct Stripe {
+        stdx::mutex mutex;
+
+        // Ring of samples; 'next' is the slot the next sample is written to, and doubles as the
+        // index of the oldest sample once the ring has wrapped.
+        std::vector<BSONObj> samples;
+        size_t next = 0;
+    };
+
+    Stripe& _myStripe();
+
+    std::array<Stripe, kNumStripes> _stripes;
+};
+
+}  // namespace mongo
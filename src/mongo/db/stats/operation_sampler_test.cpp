@@ -0,0 +1,115 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/db/stats/operation_sampler.h"
+#include "mongo/db/stats/operation_sampler_gen.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+class OperationSamplerTest : public ServiceContextTest {
+public:
+    void tearDown() override {
+        gOperationSamplingRate.store(0.0);
+    }
+};
+
+TEST_F(OperationSamplerTest, RecordBelowCapacity) {
+    OperationSampler sampler;
+    for (int i = 0; i < 10; i++) {
+        sampler.record(BSON("i" << i));
+    }
+
+    auto samples = sampler.getSamples(false /* clear */);
+    ASSERT_EQ(samples.size(), 10);
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(samples[i]["i"].numberInt(), i);
+    }
+
+    // A non-clearing read leaves the buffer intact.
+    ASSERT_EQ(sampler.getSamples(false /* clear */).size(), 10);
+}
+
+TEST_F(OperationSamplerTest, RecordOverwritesOldestWhenFull) {
+    OperationSampler sampler;
+    const int total = static_cast<int>(OperationSampler::kSamplesPerStripe) + 5;
+    for (int i = 0; i < total; i++) {
+        sampler.record(BSON("i" << i));
+    }
+
+    auto samples = sampler.getSamples(false /* clear */);
+    ASSERT_EQ(samples.size(), OperationSampler::kSamplesPerStripe);
+
+    // The five oldest samples were overwritten, and the survivors come back oldest first.
+    ASSERT_EQ(samples.front()["i"].numberInt(), 5);
+    ASSERT_EQ(samples.back()["i"].numberInt(), total - 1);
+    for (size_t i = 1; i < samples.size(); i++) {
+        ASSERT_EQ(samples[i]["i"].numberInt(), samples[i - 1]["i"].numberInt() + 1);
+    }
+}
+
+TEST_F(OperationSamplerTest, GetSamplesClears) {
+    OperationSampler sampler;
+    sampler.record(BSON("i" << 0));
+    sampler.record(BSON("i" << 1));
+
+    ASSERT_EQ(sampler.getSamples(true /* clear */).size(), 2);
+    ASSERT_EQ(sampler.getSamples(false /* clear */).size(), 0);
+
+    // The ring starts over cleanly after a clearing read.
+    sampler.record(BSON("i" << 2));
+    auto samples = sampler.getSamples(false /* clear */);
+    ASSERT_EQ(samples.size(), 1);
+    ASSERT_EQ(samples[0]["i"].numberInt(), 2);
+}
+
+TEST_F(OperationSamplerTest, ShouldSampleRespectsRate) {
+    OperationSampler sampler;
+
+    gOperationSamplingRate.store(0.0);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_FALSE(sampler.shouldSample(getClient()));
+    }
+
+    gOperationSamplingRate.store(1.0);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(sampler.shouldSample(getClient()));
+    }
+}
+
+}  // namespace
+}  // namespace mongo
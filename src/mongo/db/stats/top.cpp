@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <string>
 #include <utility>
@@ -40,6 +41,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/service_context.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/namespace_string_util.h"
 
 namespace mongo {
@@ -169,6 +171,53 @@ Top& Top::getDecoration(OperationContext* opCtx) {
     return getTop(opCtx->getServiceContext());
 }
 
+void Top::CollectionData::add(const CollectionData& other) {
+    total.add(other.total);
+
+    readLock.add(other.readLock);
+    writeLock.add(other.writeLock);
+
+    queries.add(other.queries);
+    getmore.add(other.getmore);
+    insert.add(other.insert);
+    update.add(other.update);
+    remove.add(other.remove);
+    commands.add(other.commands);
+
+    opLatencyHistogram.add(other.opLatencyHistogram);
+
+    // Once an operation that must not leave diagnostic information has touched the collection,
+    // recording stays disabled for it.
+    isStatsRecordingAllowed = isStatsRecordingAllowed && other.isStatsRecordingAllowed;
+}
+
+Top::UsageStripe& Top::_stripeForCurrentThread() {
+    const auto threadHash = std::hash<stdx::thread::id>{}(stdx::this_thread::get_id());
+    return _stripes[threadHash % _numStripes];
+}
+
+Top::CollectionData Top::_mergedUsageForCollection(StringData nssStr) {
+    CollectionData merged;
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard lk(stripe.mutex);
+        if (auto it = stripe.usage.find(nssStr); it != stripe.usage.end()) {
+            merged.add(it->second);
+        }
+    }
+    return merged;
+}
+
+Top::UsageMap Top::_mergeUsage() {
+    UsageMap merged;
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard lk(stripe.mutex);
+        for (const auto& [nssStr, coll] : stripe.usage) {
+            merged[nssStr].add(coll);
+        }
+    }
+    return merged;
+}
+
 void Top::record(OperationContext* opCtx,
                  const NamespaceString& nss,
                  LogicalOp logicalOp,
@@ -182,8 +231,9 @@ void Top::record(OperationContext* opCtx,
 
     auto hashedNs = UsageMap::hasher().hashed_key(nssStr);
     auto microsCount = durationCount<Microseconds>(micros);
-    stdx::lock_guard lk(_lockUsage);
-    CollectionData& coll = _usage[hashedNs];
+    auto& stripe = _stripeForCurrentThread();
+    stdx::lock_guard lk(stripe.mutex);
+    CollectionData& coll = stripe.usage[hashedNs];
     updateCollectionData(lk, opCtx, coll, logicalOp, lockType, microsCount, readWriteType);
 }
 
@@ -205,17 +255,20 @@ void Top::record(OperationContext* opCtx,
     }
 
     auto microsCount = durationCount<Microseconds>(micros);
-    stdx::lock_guard lk(_lockUsage);
+    auto& stripe = _stripeForCurrentThread();
+    stdx::lock_guard lk(stripe.mutex);
     for (const auto& hashedNs : hashedSet) {
-        CollectionData& coll = _usage[hashedNs];
+        CollectionData& coll = stripe.usage[hashedNs];
         updateCollectionData(lk, opCtx, coll, logicalOp, lockType, microsCount, readWriteType);
     }
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
     const auto nssStr = NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault());
-    stdx::lock_guard lk(_lockUsage);
-    _usage.erase(nssStr);
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard lk(stripe.mutex);
+        stripe.usage.erase(nssStr);
+    }
 }
 
 void Top::appendStatsEntry(BSONObjBuilder& b, StringData name, const UsageData& data) {
@@ -240,11 +293,11 @@ void Top::appendUsageStatsForCollection(BSONObjBuilder& result, const Collection
 }
 
 void Top::append(BSONObjBuilder& topStatsBuilder) {
-    stdx::lock_guard lk(_lockUsage);
+    const auto usage = _mergeUsage();
 
     // Pull all the names into a vector so we can sort them for the user.
     std::vector<std::string> names;
-    for (UsageMap::const_iterator i = _usage.begin(); i != _usage.end(); ++i) {
+    for (UsageMap::const_iterator i = usage.begin(); i != usage.end(); ++i) {
         names.push_back(i->first);
     }
 
@@ -253,7 +306,7 @@ void Top::append(BSONObjBuilder& topStatsBuilder) {
     for (size_t i = 0; i < names.size(); i++) {
         BSONObjBuilder bb(topStatsBuilder.subobjStart(names[i]));
 
-        const CollectionData& coll = _usage.find(names[i])->second;
+        const CollectionData& coll = usage.find(names[i])->second;
         auto pos = names[i].find('.');
         if (coll.isStatsRecordingAllowed &&
             !NamespaceString::isFLE2StateCollection(names[i].substr(pos + 1))) {
@@ -267,22 +320,19 @@ void Top::appendLatencyStats(const NamespaceString& nss,
                              bool includeHistograms,
                              BSONObjBuilder* builder) {
     const auto nssStr = NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault());
-    auto hashedNs = UsageMap::hasher().hashed_key(nssStr);
-    stdx::lock_guard lk(_lockUsage);
+    const auto coll = _mergedUsageForCollection(nssStr);
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    coll.opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
     builder->append("ns", nssStr);
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
 
 void Top::appendOperationStats(const NamespaceString& nss, BSONObjBuilder* builder) {
     const auto nssStr = NamespaceStringUtil::serialize(nss, SerializationContext::stateDefault());
-    auto hashedNs = UsageMap::hasher().hashed_key(nssStr);
-    stdx::lock_guard lk(_lockUsage);
     BSONObjBuilder opStatsBuilder;
 
     // Appends usage statistics to operationStats object.
-    const CollectionData& coll = _usage[hashedNs];
+    const auto coll = _mergedUsageForCollection(nssStr);
     auto pos = nssStr.find('.');
     if (coll.isStatsRecordingAllowed &&
         !NamespaceString::isFLE2StateCollection(nssStr.substr(pos + 1))) {
@@ -33,10 +33,13 @@
  * DB usage monitor.
  */
 
+#include <array>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <span>
 
+#include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/namespace_string.h"
@@ -102,6 +105,11 @@ public:
             count++;
             time += micros;
         }
+
+        void add(const UsageData& other) {
+            count += other.count;
+            time += other.time;
+        }
     };
 
     struct CollectionData {
@@ -120,6 +128,12 @@ public:
         OperationLatencyHistogram opLatencyHistogram;
 
         bool isStatsRecordingAllowed{true};
+
+        /**
+         * Folds another record for the same collection into this one. Used when merging the
+         * per-stripe usage records into a single record for reporting.
+         */
+        void add(const CollectionData& other);
     };
 
     enum class LockType {
@@ -182,9 +196,34 @@ public:
     void appendOperationStats(const NamespaceString& nss, BSONObjBuilder* builder);
 
 private:
-    // _lockUsage should always be acquired before using _usage.
-    stdx::mutex _lockUsage;
-    UsageMap _usage;
+    struct UsageStripe {
+        // Protects 'usage'.
+        stdx::mutex mutex;
+        UsageMap usage;
+    };
+
+    /**
+     * Returns the stripe the current thread records into, picked by thread id so that operation
+     * completions on different threads rarely contend on the same mutex.
+     */
+    UsageStripe& _stripeForCurrentThread();
+
+    /**
+     * Merges the per-stripe records for the collection with the given serialized namespace into a
+     * single record. Returns a default-constructed record if the collection is unknown.
+     */
+    CollectionData _mergedUsageForCollection(StringData nssStr);
+
+    /**
+     * Merges all per-stripe records into a single usage map.
+     */
+    UsageMap _mergeUsage();
+
+    // Usage records are striped so that recording usage on operation completion does not serialize
+    // on a single mutex; the read paths merge the stripes on demand, which is acceptable since
+    // they only run when a monitoring command asks for the stats.
+    static constexpr size_t _numStripes{16};
+    std::array<UsageStripe, _numStripes> _stripes;
 };
 
 }  // namespace mongo
@@ -29,6 +29,7 @@
 
 
 // IWYU pragma: no_include "cxxabi.h"
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <utility>
@@ -39,8 +40,11 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/checkpointer.h"
+#include "mongo/db/storage/disk_space_monitor.h"
+#include "mongo/db/storage/kv/kv_engine.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -62,6 +66,10 @@ const auto getCheckpointer = ServiceContext::declareDecoration<std::unique_ptr<C
 
 MONGO_FAIL_POINT_DEFINE(pauseCheckpointThread);
 
+// How often the checkpoint thread samples the engine's dirty data while waiting out the syncdelay
+// interval. Only used when 'checkpointDirtyDataThresholdMB' is set.
+constexpr auto kDirtyDataPollPeriod = Seconds(1);
+
 }  // namespace
 
 Checkpointer* Checkpointer::get(ServiceContext* serviceCtx) {
@@ -95,23 +103,67 @@ void Checkpointer::run() {
             MONGO_IDLE_THREAD_BLOCK;
 
             // Wait for 'storageGlobalParams.syncdelay' seconds; or until either shutdown is
-            // signaled or a checkpoint is triggered.
+            // signaled, a checkpoint is triggered, or the engine accumulates more than
+            // 'checkpointDirtyDataThresholdMB' megabytes of dirty data.
             LOGV2_DEBUG(7702900,
                         1,
                         "Checkpoint thread sleeping",
                         "duration"_attr = static_cast<std::int64_t>(storageGlobalParams.syncdelay));
-            _sleepCV.wait_for(
-                lock,
-                stdx::chrono::seconds(static_cast<std::int64_t>(storageGlobalParams.syncdelay)),
-                [&] { return _shuttingDown || _triggerCheckpoint; });
-
-            // If the syncdelay is set to 0, that means we should skip checkpointing. However,
-            // syncdelay is adjustable by a runtime server parameter, so we need to wake up to check
-            // periodically. The wakeup to check period is arbitrary.
-            while (storageGlobalParams.syncdelay == 0 && !_shuttingDown && !_triggerCheckpoint) {
-                _sleepCV.wait_for(lock, stdx::chrono::seconds(static_cast<std::int64_t>(3)), [&] {
-                    return _shuttingDown || _triggerCheckpoint;
-                });
+            const Date_t deadline = Date_t::now() +
+                Seconds(static_cast<std::int64_t>(storageGlobalParams.syncdelay));
+            while (!_shuttingDown && !_triggerCheckpoint) {
+                // If the syncdelay is set to 0, that means we should skip checkpointing. However,
+                // syncdelay is adjustable by a runtime server parameter, so we need to wake up to
+                // check periodically. The wakeup to check period is arbitrary.
+                if (storageGlobalParams.syncdelay == 0) {
+                    _sleepCV.wait_for(lock, stdx::chrono::seconds(static_cast<std::int64_t>(3)), [&] {
+                        return _shuttingDown || _triggerCheckpoint;
+                    });
+                    continue;
+                }
+
+                const Milliseconds timeLeft = deadline - Date_t::now();
+                if (timeLeft <= Milliseconds::zero()) {
+                    break;
+                }
+
+                const int64_t dirtyThresholdBytes =
+                    gCheckpointDirtyDataThresholdMB.load() * 1024 * 1024;
+                if (dirtyThresholdBytes == 0) {
+                    _sleepCV.wait_for(lock, timeLeft.toSystemDuration(), [&] {
+                        return _shuttingDown || _triggerCheckpoint;
+                    });
+                    continue;
+                }
+
+                // A dirty data threshold is set: sleep in short slices and sample the engine's
+                // dirty bytes, so that a write burst brings the next checkpoint forward instead
+                // of letting dirty data pile up for the full syncdelay. Checkpointing early under
+                // sustained writes yields more frequent, smaller checkpoints that spread the
+                // checkpoint I/O over time.
+                const Milliseconds pollTime =
+                    std::min(timeLeft, Milliseconds(kDirtyDataPollPeriod));
+                if (_sleepCV.wait_for(lock, pollTime.toSystemDuration(), [&] {
+                        return _shuttingDown || _triggerCheckpoint;
+                    })) {
+                    break;
+                }
+
+                lock.unlock();
+                const int64_t dirtyBytes = opCtx->getServiceContext()
+                                               ->getStorageEngine()
+                                               ->getEngine()
+                                               ->getCacheDirtyBytes();
+                lock.lock();
+                if (dirtyBytes >= dirtyThresholdBytes) {
+                    LOGV2_DEBUG(10470601,
+                                1,
+                                "Taking a checkpoint early because the dirty data threshold was "
+                                "reached",
+                                "dirtyBytes"_attr = dirtyBytes,
+                                "thresholdBytes"_attr = dirtyThresholdBytes);
+                    break;
+                }
             }
 
             if (_shuttingDown) {
@@ -140,6 +192,10 @@ void Checkpointer::run() {
                         "Checkpoint was slow to complete",
                         "secondsElapsed"_attr = secondsElapsed);
         }
+
+        // Checkpoints can reclaim a significant amount of disk space, so refresh the disk space
+        // monitor now rather than waiting for its next periodic pass.
+        DiskSpaceMonitor::get(opCtx->getServiceContext())->check(opCtx.get());
     }
 }
 
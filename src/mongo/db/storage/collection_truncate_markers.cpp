@@ -37,8 +37,12 @@
 #include <boost/optional/optional.hpp>
 
 #include "mongo/db/operation_context.h"
+#include "mongo/db/server_feature_flags_gen.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/storage/record_data.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/logv2/log.h"
@@ -46,6 +50,7 @@
 #include "mongo/logv2/log_component.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -180,6 +185,22 @@ CollectionTruncateMarkers::InitialSetOfMarkers CollectionTruncateMarkers::create
                "Scanning collection to determine where to place markers for truncation",
                "uuid"_attr = collectionIterator.getRecordStore()->uuid());
 
+    // The scan visits the whole collection in RecordId order, typically on a cold cache at
+    // startup, so let the storage engine read leaf pages ahead of the cursor instead of faulting
+    // them in one at a time.
+    const bool usePrefetching =
+        gFeatureFlagPrefetch.isEnabled(
+            serverGlobalParams.featureCompatibility.acquireFCVSnapshot()) &&
+        !opCtx->getServiceContext()->getStorageEngine()->isEphemeral();
+    if (usePrefetching) {
+        shard_role_details::getRecoveryUnit(opCtx)->setPrefetching(true);
+    }
+    ON_BLOCK_EXIT([&] {
+        if (usePrefetching) {
+            shard_role_details::getRecoveryUnit(opCtx)->setPrefetching(false);
+        }
+    });
+
     int64_t numRecords = 0;
     int64_t dataSize = 0;
     int64_t currentRecords = 0;
@@ -149,6 +149,15 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    /**
+     * Returns the number of bytes by which the collection currently exceeds its configured
+     * capacity, or 0 if it is within bounds or the implementation does not track a capacity.
+     * This is the amount of data still awaiting reclamation ("truncation debt").
+     */
+    virtual int64_t excessBytes() const {
+        return 0;
+    }
+
     static StringData toString(MarkersCreationMethod creationMethod);
 
     // The initial set of markers to use when constructing the CollectionMarkers object.
@@ -259,6 +268,10 @@ public:
         return _totalTimeProcessing;
     }
 
+    int64_t getMinBytesPerMarker() const {
+        return _minBytesPerMarker.load();
+    }
+
     MarkersCreationMethod getMarkersCreationMethod() const {
         return _creationMethod;
     }
@@ -39,6 +39,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/control/journal_flusher.h"
+#include "mongo/db/storage/disk_space_monitor.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/db/transaction_resources.h"
@@ -133,6 +134,10 @@ void JournalFlusher::run() {
 
             // Release snapshot before we start the next round.
             shard_role_details::getRecoveryUnit(_uniqueCtx->get())->abandonSnapshot();
+
+            // Piggyback a disk space check on the journal flush so that running out of disk
+            // space is noticed sooner than the DiskSpaceMonitor's polling interval.
+            DiskSpaceMonitor::get(tc->getServiceContext())->check(_uniqueCtx->get());
         } catch (const AssertionException& e) {
             {
                 // Reset opCtx if we get an error.
@@ -81,7 +81,10 @@ DiskSpaceMonitor* DiskSpaceMonitor::get(ServiceContext* svcCtx) {
 void DiskSpaceMonitor::_start(ServiceContext* svcCtx) {
     LOGV2(7333401, "Starting the DiskSpaceMonitor");
     invariant(!_job, "DiskSpaceMonitor is already started");
-    _dbpath = storageGlobalParams.dbpath;
+    {
+        stdx::lock_guard<stdx::mutex> lock(_mutex);
+        _dbpath = storageGlobalParams.dbpath;
+    }
     _job = svcCtx->getPeriodicRunner()->makeJob(
         PeriodicRunner::PeriodicJob{"DiskSpaceMonitor",
                                     [this](Client* client) { _run(client); },
@@ -105,7 +108,10 @@ void DiskSpaceMonitor::registerAction(std::unique_ptr<Action> action) {
 
 void DiskSpaceMonitor::takeAction(OperationContext* opCtx, int64_t availableBytes) {
     stdx::lock_guard<stdx::mutex> lock(_mutex);
+    _takeAction(lock, opCtx, availableBytes);
+}
 
+void DiskSpaceMonitor::_takeAction(WithLock, OperationContext* opCtx, int64_t availableBytes) {
     for (auto& action : _actions) {
         if (availableBytes <= action->getThresholdBytes()) {
             action->act(opCtx, availableBytes);
@@ -114,14 +120,27 @@ void DiskSpaceMonitor::takeAction(OperationContext* opCtx, int64_t availableByte
     }
 }
 
-void DiskSpaceMonitor::_run(Client* client) try {
-    auto opCtx = client->makeOperationContext();
+void DiskSpaceMonitor::check(OperationContext* opCtx) try {
+    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    if (_dbpath.empty()) {
+        // The monitor was never started, e.g. when data files are spread over multiple
+        // directories.
+        return;
+    }
 
     const auto availableBytes = getAvailableDiskSpaceBytesInDbPath(_dbpath);
     LOGV2_DEBUG(7333405, 2, "Available disk space", "bytes"_attr = availableBytes);
-    takeAction(opCtx.get(), availableBytes);
-    monitorPasses.increment();
+    _cachedAvailableBytes.store(availableBytes);
+    _takeAction(lock, opCtx, availableBytes);
 } catch (...) {
     LOGV2(7333404, "Caught exception in DiskSpaceMonitor", "error"_attr = exceptionToStatus());
 }
+
+void DiskSpaceMonitor::_run(Client* client) try {
+    auto opCtx = client->makeOperationContext();
+    check(opCtx.get());
+    monitorPasses.increment();
+} catch (...) {
+    LOGV2(7333406, "Caught exception in DiskSpaceMonitor", "error"_attr = exceptionToStatus());
+}
 }  // namespace mongo
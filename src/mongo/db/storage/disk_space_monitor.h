@@ -31,13 +31,16 @@
 
 #include <boost/filesystem/operations.hpp>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "mongo/db/auth/validated_tenancy_scope.h"
 #include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/periodic_runner.h"
 
 namespace mongo {
@@ -82,18 +85,40 @@ public:
      */
     void takeAction(OperationContext* opCtx, int64_t availableBytes);
 
+    /**
+     * Queries the available disk space, refreshes the cached value and runs all registered
+     * actions against it. In addition to the periodic job, this is piggybacked on journal flush
+     * and checkpoint completion so that low disk space is noticed sooner than the polling
+     * interval. No-op when the monitor is not running.
+     */
+    void check(OperationContext* opCtx);
+
+    /**
+     * Returns the available disk space in bytes observed by the most recent check. This is a
+     * single atomic load, cheap enough to consult on every write admission. Returns the maximum
+     * int64_t value before the first check has completed or when the monitor is not running.
+     */
+    int64_t getCachedAvailableBytes() const {
+        return _cachedAvailableBytes.load();
+    }
+
 private:
     void _start(ServiceContext* svcCtx);
     void _stop();
 
     void _run(Client*);
 
+    void _takeAction(WithLock, OperationContext* opCtx, int64_t availableBytes);
+
     PeriodicJobAnchor _job;
 
-    // Copy of the dbpath which is always safe to access.
-    std::string _dbpath;
-    // This mutex protects _actions and the entire run loop of the disk space monitor.
+    // This mutex protects _dbpath, _actions and the entire run loop of the disk space monitor.
     stdx::mutex _mutex;
+    // Copy of the dbpath which is always safe to access. Empty until the monitor is started.
+    std::string _dbpath;
     std::vector<std::unique_ptr<Action>> _actions;
+
+    // Available disk space observed by the most recent check.
+    AtomicWord<int64_t> _cachedAvailableBytes{std::numeric_limits<int64_t>::max()};
 };
 }  // namespace mongo
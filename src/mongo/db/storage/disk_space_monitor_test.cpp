@@ -74,5 +74,20 @@ TEST_F(DiskSpaceMonitorTest, Threshold) {
     monitor.takeAction(opCtx, 2000);
     ASSERT_EQ(2, actionPtr->hits);
 }
+
+TEST_F(DiskSpaceMonitorTest, CheckIsNoOpWhenNotStarted) {
+    OperationContext* opCtx = nullptr;
+    auto action = std::make_unique<SimpleAction>();
+    auto actionPtr = action.get();
+    monitor.registerAction(std::move(action));
+
+    // Before the first check the cached value must not trigger any thresholds.
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), monitor.getCachedAvailableBytes());
+
+    // The monitor was never started, so a piggybacked check does nothing.
+    monitor.check(opCtx);
+    ASSERT_EQ(0, actionPtr->hits);
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), monitor.getCachedAvailableBytes());
+}
 }  // namespace
 }  // namespace mongo
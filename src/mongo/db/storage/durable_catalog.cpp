@@ -420,7 +420,29 @@ boost::optional<DurableCatalogEntry> DurableCatalog::getParsedCatalogEntry(
     OperationContext* opCtx, const RecordId& catalogId) const {
     auto cursor = _rs->getCursor(opCtx);
     BSONObj obj = _findEntry(*cursor, catalogId);
-    return parseCatalogEntry(catalogId, obj);
+    if (obj.isEmpty()) {
+        return boost::none;
+    }
+
+    // Reuse the cached parsed entry if this snapshot observes the exact document it was parsed
+    // from. The bytes fully determine the parse, so a stale cache entry can never be returned: any
+    // catalog write (or rollback thereof) changes the document and falls through to a reparse.
+    {
+        stdx::lock_guard<stdx::mutex> lk(_parsedCatalogEntryCacheLock);
+        auto it = _parsedCatalogEntryCache.find(catalogId);
+        if (it != _parsedCatalogEntryCache.end() && it->second->rawEntry.binaryEqual(obj)) {
+            return it->second->parsedEntry;
+        }
+    }
+
+    auto parsedEntry = parseCatalogEntry(catalogId, obj);
+    if (parsedEntry) {
+        auto cached = std::make_shared<const CachedCatalogEntry>(
+            CachedCatalogEntry{obj.getOwned(), *parsedEntry});
+        stdx::lock_guard<stdx::mutex> lk(_parsedCatalogEntryCacheLock);
+        _parsedCatalogEntryCache[catalogId] = std::move(cached);
+    }
+    return parsedEntry;
 }
 
 std::shared_ptr<BSONCollectionCatalogEntry::MetaData> DurableCatalog::_parseMetaData(
@@ -504,6 +526,13 @@ Status DurableCatalog::_removeEntry(OperationContext* opCtx, const RecordId& cat
     _rs->deleteRecord(opCtx, catalogId);
     _catalogIdToEntryMap.erase(it);
 
+    // Drop the cached parsed entry to bound the cache's memory usage. Correctness does not depend
+    // on this: if the delete rolls back, the next lookup simply reparses the restored document.
+    {
+        stdx::lock_guard<stdx::mutex> cacheLock(_parsedCatalogEntryCacheLock);
+        _parsedCatalogEntryCache.erase(catalogId);
+    }
+
     return Status::OK();
 }
 
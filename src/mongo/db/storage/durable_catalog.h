@@ -353,6 +353,20 @@ private:
     absl::flat_hash_map<RecordId, EntryIdentifier, RecordId::Hasher> _catalogIdToEntryMap;
     mutable stdx::mutex _catalogIdToEntryMapLock;
 
+    /**
+     * Immutable snapshot of a parsed catalog entry along with an owned copy of the raw document it
+     * was parsed from. The cached parsed entry is only reused when the raw document read from the
+     * caller's snapshot is byte-for-byte identical to 'rawEntry', so the cache never needs to be
+     * explicitly invalidated by catalog writes: any change to the document causes a reparse.
+     */
+    struct CachedCatalogEntry {
+        BSONObj rawEntry;
+        DurableCatalogEntry parsedEntry;
+    };
+    mutable absl::flat_hash_map<RecordId, std::shared_ptr<const CachedCatalogEntry>, RecordId::Hasher>
+        _parsedCatalogEntryCache;
+    mutable stdx::mutex _parsedCatalogEntryCacheLock;
+
     StorageEngineInterface* const _engine;
 };
 }  // namespace mongo
@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <deque>
 #include <limits>
 #include <string>
 #include <utility>
@@ -248,6 +249,12 @@ BSONObj FlowControl::generateSection(OperationContext* opCtx,
     bob.append("isLagged", _isLagged.loadRelaxed());
     bob.append("isLaggedCount", _isLaggedCount.loadRelaxed());
     bob.append("isLaggedTimeMicros", _isLaggedTimeMicros.loadRelaxed());
+    // Attribute over-threshold periods to transient stalls separately from real replication debt
+    // so the two can be distinguished when diagnosing throttling.
+    bob.append("transientStallCount", _transientStallCount.loadRelaxed());
+    bob.append("transientStallTimeMicros", _transientStallTimeMicros.loadRelaxed());
+    bob.append("burstCreditMillis", _burstCreditMillis.loadRelaxed());
+    bob.append("forecastLagMillis", _lastForecastLagMillis.loadRelaxed());
 
     return bob.obj();
 }
@@ -353,6 +360,51 @@ int FlowControl::_calculateNewTicketsForLag(const std::vector<repl::MemberData>&
     return multiplyWithOverflowCheck(locksPerOp, sustainerAppliedPenalty, kMaxTickets);
 }
 
+std::int64_t FlowControl::_forecastLagMillis(const std::deque<std::uint64_t>& recentLagMillis,
+                                             std::uint64_t horizonMillis) {
+    if (recentLagMillis.size() < 2) {
+        // Not enough history to establish a trend; assume the latest reading holds.
+        return recentLagMillis.empty() ? -1 : static_cast<std::int64_t>(recentLagMillis.back());
+    }
+
+    // Lag readings are taken once per ticket refresh period. Extrapolate the average slope across
+    // the retained window out to the horizon.
+    const auto first = static_cast<std::int64_t>(recentLagMillis.front());
+    const auto last = static_cast<std::int64_t>(recentLagMillis.back());
+    const auto elapsedMillis =
+        static_cast<std::int64_t>((recentLagMillis.size() - 1) * kTicketRefreshPeriodMillis);
+    const double slopePerMilli = static_cast<double>(last - first) / elapsedMillis;
+
+    const double forecast = last + slopePerMilli * horizonMillis;
+    return forecast < 0.0 ? 0 : static_cast<std::int64_t>(forecast);
+}
+
+bool FlowControl::_shouldAbsorbTransientStall(std::uint64_t lagMillis,
+                                              std::uint64_t thresholdLagMillis) {
+    if (_isLagged.load()) {
+        // The lag penalty is already engaged; stay in that regime until the commit point is back
+        // under the threshold rather than oscillating between throttling and absorbing.
+        return false;
+    }
+
+    const auto targetLagMillis =
+        static_cast<std::uint64_t>(1000) * gFlowControlTargetLagSeconds.load();
+    if (lagMillis >= targetLagMillis) {
+        // The excursion has reached the operator-facing target lag; treat it as real replication
+        // debt no matter what the trend looks like.
+        return false;
+    }
+
+    if (_burstCreditMillis.load() >= static_cast<std::int64_t>(kTicketRefreshPeriodMillis)) {
+        return true;
+    }
+
+    // Out of burst credits. Keep absorbing only if the recent trend forecasts the lag dropping
+    // back under the threshold within the configured horizon.
+    const auto forecast = _lastForecastLagMillis.load();
+    return forecast >= 0 && static_cast<std::uint64_t>(forecast) <= thresholdLagMillis;
+}
+
 int FlowControl::getNumTickets(Date_t now) {
     // Flow control can be disabled until a certain deadline is passed.
     const Date_t disabledUntil = _disableUntil.load();
@@ -390,6 +442,19 @@ int FlowControl::getNumTickets(Date_t now) {
     // monotonically increasing. Recordings that satisfy the following check result in a negative
     // value for lag, so ignore them.
     const bool ignoreWallTimes = lastCommitted.wallTime > myLastApplied.wallTime;
+    const std::uint64_t lagMillis = getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime);
+
+    if (!ignoreWallTimes) {
+        // Retain a short window of lag readings (one per ticket refresh) for forecasting whether
+        // an over-threshold excursion is about to recover on its own.
+        _recentLagMillis.push_back(lagMillis);
+        while (_recentLagMillis.size() > kRecentLagWindowSize) {
+            _recentLagMillis.pop_front();
+        }
+        _lastForecastLagMillis.store(_forecastLagMillis(
+            _recentLagMillis,
+            static_cast<std::uint64_t>(1000) * gFlowControlLagForecastHorizonSeconds.load()));
+    }
 
     // _approximateOpsBetween will return -1 if the input timestamps are in the same "bucket".
     // This is an indication that there are very few ops between the two timestamps.
@@ -397,7 +462,7 @@ int FlowControl::getNumTickets(Date_t now) {
     // Don't let the no-op writer on idle systems fool the sophisticated "is the replica set
     // lagged" classifier.
     const bool isHealthy = !ignoreWallTimes &&
-        (getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime) < thresholdLagMillis ||
+        (lagMillis < thresholdLagMillis ||
          _approximateOpsBetween(lastCommitted.opTime.getTimestamp(),
                                 myLastApplied.opTime.getTimestamp()) == -1);
 
@@ -408,26 +473,57 @@ int FlowControl::getNumTickets(Date_t now) {
                                             gFlowControlTicketAdderConstant.load(),
                                         gFlowControlTicketMultiplierConstant.load(),
                                         kMaxTickets);
+        // Replenish one refresh period's worth of burst credit per healthy period, up to the
+        // configured allowance.
+        _burstCreditMillis.store(std::min<std::int64_t>(
+            _burstCreditMillis.load() + static_cast<std::int64_t>(kTicketRefreshPeriodMillis),
+            static_cast<std::int64_t>(1000) * gFlowControlBurstAllowanceSeconds.load()));
         _lastTimeSustainerAdvanced = Date_t::now();
+        if (_inTransientStall) {
+            _inTransientStall = false;
+            _transientStallTimeMicros.fetchAndAddRelaxed(curTimeMicros64() -
+                                                         _transientStallStartTime);
+        }
         if (_isLagged.load()) {
             _isLagged.store(false);
             auto waitTime = curTimeMicros64() - _startWaitTime;
             _isLaggedTimeMicros.fetchAndAddRelaxed(waitTime);
         }
     } else if (!ignoreWallTimes && sustainerAdvanced(_prevMemberData, _currMemberData)) {
-        // Expected case where flow control has meaningful data from the last period to make a new
-        // calculation.
-        ret =
-            _calculateNewTicketsForLag(_prevMemberData,
-                                       _currMemberData,
-                                       locksUsedLastPeriod,
-                                       locksPerOp,
-                                       getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime),
-                                       thresholdLagMillis);
-        if (!_isLagged.load()) {
-            _isLagged.store(true);
-            _isLaggedCount.fetchAndAddRelaxed(1);
-            _startWaitTime = curTimeMicros64();
+        if (_shouldAbsorbTransientStall(lagMillis, thresholdLagMillis)) {
+            // The excursion over the lag threshold still looks like a transient stall. Hold the
+            // previous target steady instead of applying the lag penalty so brief stalls do not
+            // throttle the primary.
+            ret = _lastTargetTicketsPermitted.load();
+            _burstCreditMillis.store(std::max<std::int64_t>(
+                _burstCreditMillis.load() - static_cast<std::int64_t>(kTicketRefreshPeriodMillis),
+                0));
+            if (!_inTransientStall) {
+                _inTransientStall = true;
+                _transientStallCount.fetchAndAddRelaxed(1);
+                _transientStallStartTime = curTimeMicros64();
+            }
+        } else {
+            // Expected case where flow control has meaningful data from the last period to make a
+            // new calculation.
+            ret = _calculateNewTicketsForLag(_prevMemberData,
+                                             _currMemberData,
+                                             locksUsedLastPeriod,
+                                             locksPerOp,
+                                             lagMillis,
+                                             thresholdLagMillis);
+            if (_inTransientStall) {
+                // The stall graduated into real replication debt; subsequent time is attributed
+                // to the lagged counters.
+                _inTransientStall = false;
+                _transientStallTimeMicros.fetchAndAddRelaxed(curTimeMicros64() -
+                                                             _transientStallStartTime);
+            }
+            if (!_isLagged.load()) {
+                _isLagged.store(true);
+                _isLaggedCount.fetchAndAddRelaxed(1);
+                _startWaitTime = curTimeMicros64();
+            }
         }
     } else {
         // Unexpected case where consecutive readings from the topology state don't meet some basic
@@ -445,7 +541,7 @@ int FlowControl::getNumTickets(Date_t now) {
                 DEBUG_LOG_LEVEL,
                 "FlowControl debug.",
                 "isLagged"_attr = (_isLagged.load() ? "true" : "false"),
-                "currlagMillis"_attr = getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime),
+                "currlagMillis"_attr = lagMillis,
                 "opsLagged"_attr = _approximateOpsBetween(lastCommitted.opTime.getTimestamp(),
                                                           myLastApplied.opTime.getTimestamp()),
                 "granting"_attr = ret,
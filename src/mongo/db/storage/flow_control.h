@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -64,6 +65,13 @@ class FlowControl {
 public:
     static constexpr int kMaxTickets = 1000 * 1000 * 1000;
 
+    // Period at which the ticket refresh job runs and, therefore, at which commit point lag is
+    // observed and burst credits are granted or spent.
+    static constexpr std::uint64_t kTicketRefreshPeriodMillis = 1000;
+
+    // Number of once-per-refresh-period lag readings retained for forecasting near-term lag.
+    static constexpr std::size_t kRecentLagWindowSize = 10;
+
     FlowControl(ServiceContext* service, repl::ReplicationCoordinator* replCoord);
 
     /**
@@ -131,6 +139,21 @@ public:
                                    std::uint64_t thresholdLagMillis);
     void _trimSamples(Timestamp trimSamplesTo);
 
+    /**
+     * Extrapolates the recent once-per-refresh-period lag readings (oldest first) out
+     * `horizonMillis` into the future. Returns -1 when there is no history to extrapolate from.
+     */
+    static std::int64_t _forecastLagMillis(const std::deque<std::uint64_t>& recentLagMillis,
+                                           std::uint64_t horizonMillis);
+
+    /**
+     * Decides whether an over-threshold lag reading should be absorbed rather than throttled.
+     * Brief majority commit point stalls (e.g. a secondary pausing for a checkpoint) are absorbed
+     * while burst credits remain or while the recent lag trend forecasts recovery within the
+     * configured horizon, so long as the lag has not reached the operator-facing target.
+     */
+    bool _shouldAbsorbTransientStall(std::uint64_t lagMillis, std::uint64_t thresholdLagMillis);
+
     // Sample of (timestamp, ops, lock acquisitions) where ops and lock acquisitions are
     // observations of the corresponding counter at (roughly) <timestamp>.
     typedef std::tuple<std::uint64_t, std::uint64_t, std::int64_t> Sample;
@@ -150,6 +173,13 @@ private:
     AtomicWord<int> _isLaggedCount{0};
     // Use an int64_t as this is serialized to bson which does not support unsigned 64-bit numbers.
     AtomicWord<std::int64_t> _isLaggedTimeMicros{0};
+    AtomicWord<int> _transientStallCount{0};
+    AtomicWord<std::int64_t> _transientStallTimeMicros{0};
+    // Milliseconds of over-threshold lag the controller may still absorb before engaging the lag
+    // penalty. Credits replenish while the commit point is healthy, bounded by
+    // `flowControlBurstAllowanceSeconds`.
+    AtomicWord<std::int64_t> _burstCreditMillis{0};
+    AtomicWord<std::int64_t> _lastForecastLagMillis{-1};
     AtomicWord<Date_t> _disableUntil;
 
     mutable stdx::mutex _sampledOpsMutex;
@@ -166,8 +196,14 @@ private:
 
     Date_t _lastTimeSustainerAdvanced;
 
-    // This value is used for calculating server status metrics.
+    // Recent once-per-refresh-period commit point lag readings, oldest first. Only read and
+    // written by the ticket refresh job.
+    std::deque<std::uint64_t> _recentLagMillis;
+
+    // These values are used for calculating server status metrics.
     std::uint64_t _startWaitTime = 0;
+    bool _inTransientStall = false;
+    std::uint64_t _transientStallStartTime = 0;
 
     PeriodicJobAnchor _jobAnchor;
 };
@@ -27,6 +27,8 @@
  *    it in the license file.
  */
 
+#include <cstdint>
+#include <deque>
 #include <utility>
 
 #include "mongo/base/string_data.h"
@@ -259,6 +261,42 @@ TEST_F(FlowControlTest, CalculatingTickets) {
                                                       thresholdLag));
 }
 
+TEST_F(FlowControlTest, ForecastingLag) {
+    const std::uint64_t horizonMillis = 5000;
+
+    // No history yields no forecast.
+    std::deque<std::uint64_t> noReadings;
+    ASSERT_EQ(-1, FlowControl::_forecastLagMillis(noReadings, horizonMillis));
+
+    // A single reading is assumed to hold steady.
+    std::deque<std::uint64_t> oneReading{4000};
+    ASSERT_EQ(4000, FlowControl::_forecastLagMillis(oneReading, horizonMillis));
+
+    // Lag growing by one second per refresh period forecasts five more seconds of growth across a
+    // five second horizon.
+    std::deque<std::uint64_t> rising{1000, 2000, 3000};
+    ASSERT_EQ(8000, FlowControl::_forecastLagMillis(rising, horizonMillis));
+
+    // Lag shrinking by one second per refresh period forecasts recovery, clamped at zero.
+    std::deque<std::uint64_t> falling{6000, 5000, 4000};
+    ASSERT_EQ(0, FlowControl::_forecastLagMillis(falling, horizonMillis));
+
+    // A flat trend forecasts the latest reading.
+    std::deque<std::uint64_t> flat{3000, 3000, 3000, 3000};
+    ASSERT_EQ(3000, FlowControl::_forecastLagMillis(flat, horizonMillis));
+}
+
+TEST_F(FlowControlTest, ServerStatusStallAttribution) {
+    // Before any evaluations, no time is attributed to either transient stalls or real lag, no
+    // burst credits have accrued and there is no lag history to forecast from.
+    BSONElement noopVar;
+    auto serverStatusSection = flowControl->generateSection(opCtx.get(), noopVar);
+    ASSERT_EQ(0, serverStatusSection["transientStallCount"].Int());
+    ASSERT_EQ(0, serverStatusSection["transientStallTimeMicros"].Long());
+    ASSERT_EQ(0, serverStatusSection["burstCreditMillis"].Long());
+    ASSERT_EQ(-1, serverStatusSection["forecastLagMillis"].Long());
+}
+
 TEST_F(FlowControlTest, DisableUntil) {
     const int ticketOverride = 52319;
 
@@ -341,6 +341,20 @@ namespace {
 void memcpy_flipBits(void* dst, const void* src, size_t bytes) {
     const char* input = static_cast<const char*>(src);
     char* output = static_cast<char*>(dst);
+
+    // Every byte appended for a descending-order field passes through here, so this is a hot
+    // loop when generating index keys in bulk. Flip a word at a time rather than a byte at a
+    // time; the unaligned loads and stores go through memcpy and the loop is simple enough for
+    // the compiler to vectorize.
+    while (bytes >= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, input, sizeof(word));
+        word = ~word;
+        memcpy(output, &word, sizeof(word));
+        input += sizeof(word);
+        output += sizeof(word);
+        bytes -= sizeof(word);
+    }
     const char* const end = input + bytes;
     while (input != end) {
         *output++ = ~(*input++);
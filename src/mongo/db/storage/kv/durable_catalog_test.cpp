@@ -934,6 +934,33 @@ TEST_F(DurableCatalogTest, CheckTimeseriesBucketsMayHaveMixedSchemaDataFlagFCVLa
     }
 }
 
+TEST_F(DurableCatalogTest, ParsedCatalogEntryCacheReusedUntilEntryChanges) {
+    RecordId catalogId = getCollection()->getCatalogId();
+
+    Lock::GlobalWrite globalLock{operationContext()};
+
+    // Repeated lookups of an unchanged catalog entry share the same parsed metadata instance.
+    auto firstEntry = getCatalog()->getParsedCatalogEntry(operationContext(), catalogId);
+    auto secondEntry = getCatalog()->getParsedCatalogEntry(operationContext(), catalogId);
+    ASSERT(firstEntry);
+    ASSERT(secondEntry);
+    ASSERT_EQ(firstEntry->metadata.get(), secondEntry->metadata.get());
+
+    // Changing the catalog entry invalidates the cached parse.
+    {
+        WriteUnitOfWork wuow(operationContext());
+        auto metadata = *firstEntry->metadata;
+        metadata.options.temp = true;
+        getCatalog()->putMetaData(operationContext(), catalogId, metadata);
+        wuow.commit();
+    }
+
+    auto thirdEntry = getCatalog()->getParsedCatalogEntry(operationContext(), catalogId);
+    ASSERT(thirdEntry);
+    ASSERT_NE(firstEntry->metadata.get(), thirdEntry->metadata.get());
+    ASSERT(thirdEntry->metadata->options.temp);
+}
+
 TEST_F(DurableCatalogTest, CreateCollectionCatalogEntryHasCorrectTenantNamespace) {
     gMultitenancySupport = true;
 
@@ -526,6 +526,14 @@ public:
         return 0;
     }
 
+    /**
+     * Returns an estimate of the number of dirty bytes currently held in the engine's cache, or 0
+     * if the engine does not track dirty data.
+     */
+    virtual int64_t getCacheDirtyBytes() const {
+        return 0;
+    }
+
     /**
      * Returns the input storage engine options, sanitized to remove options that may not apply to
      * this node, such as encryption. Might be called for both collection and index options. See
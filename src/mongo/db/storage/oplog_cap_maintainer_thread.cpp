@@ -42,6 +42,7 @@
 #include "mongo/db/storage/oplog_truncation.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/platform/compiler.h"
@@ -93,6 +94,8 @@ public:
                                        CollectionTruncateMarkers::MarkersCreationMethod::Sampling
                                    ? "sampling"
                                    : "scanning");
+                // Bytes beyond the configured oplog size still awaiting reclamation.
+                builder.append("truncationDebtBytes", truncateMarkers->excessBytes());
             }
         }
 
@@ -147,37 +150,81 @@ bool OplogCapMaintainerThread::_deleteExcessDocuments(OperationContext* opCtx) {
         return false;
     }
 
-    {
-        // Oplog state could have changed while yielding. Reacquire global lock
-        // and refresh oplog state to ensure we have a valid pointer.
-        Lock::GlobalLock globalLk(opCtx, MODE_IX);
-        auto rs = LocalOplogInfo::get(opCtx)->getRecordStore();
-        if (!rs) {
-            LOGV2_DEBUG(9064300, 2, "oplog collection does not exist");
-            return false;
-        }
-
-        auto mayTruncateUpTo = opCtx->getServiceContext()->getStorageEngine()->getPinnedOplog();
+    // Remove one truncate marker at a time, sleeping between markers so that reclamation
+    // proceeds as a steady trickle of small truncations instead of one large I/O burst. The
+    // sleep shrinks as the truncation debt grows, so a backlog of excess markers left by a
+    // write burst is still drained promptly.
+    bool truncatedAnything = false;
+    int64_t passTruncateMicros = 0;
+    while (true) {
+        Milliseconds pacingDelay{0};
+        {
+            // Oplog state could have changed while yielding. Reacquire global lock
+            // and refresh oplog state to ensure we have a valid pointer.
+            Lock::GlobalLock globalLk(opCtx, MODE_IX);
+            auto rs = LocalOplogInfo::get(opCtx)->getRecordStore();
+            if (!rs) {
+                LOGV2_DEBUG(9064300, 2, "oplog collection does not exist");
+                return false;
+            }
 
-        Timer timer;
-        oplog_truncation::reclaimOplog(opCtx, *rs, RecordId(mayTruncateUpTo.asULL()));
+            auto mayTruncateUpTo =
+                opCtx->getServiceContext()->getStorageEngine()->getPinnedOplog();
+
+            Timer timer;
+            auto highestTruncated = oplog_truncation::reclaimOplog(
+                opCtx, *rs, RecordId(mayTruncateUpTo.asULL()), 1 /* maxMarkersToTruncate */);
+
+            auto elapsedMicros = timer.micros();
+            _totalTimeTruncating.fetchAndAdd(elapsedMicros);
+            passTruncateMicros += elapsedMicros;
+
+            if (highestTruncated.isNull()) {
+                // No marker was eligible for truncation; this pass is done.
+                if (truncatedAnything) {
+                    _truncateCount.fetchAndAdd(1);
+                    LOGV2(22402,
+                          "Oplog truncation finished",
+                          "pinnedOplogTimestamp"_attr = mayTruncateUpTo,
+                          "numRecords"_attr = rs->numRecords(),
+                          "dataSize"_attr = rs->dataSize(),
+                          "duration"_attr = Milliseconds(passTruncateMicros / 1000));
+                }
+                break;
+            }
+            truncatedAnything = true;
+            _markersTruncated.fetchAndAdd(1);
 
-        auto elapsedMicros = timer.micros();
-        _totalTimeTruncating.fetchAndAdd(elapsedMicros);
-        _truncateCount.fetchAndAdd(1);
+            pacingDelay = _pacingDelay(*rs->oplog()->getCollectionTruncateMarkers());
+        }
 
-        auto elapsedMillis = elapsedMicros / 1000;
-        LOGV2(22402,
-              "Oplog truncation finished",
-              "pinnedOplogTimestamp"_attr = mayTruncateUpTo,
-              "numRecords"_attr = rs->numRecords(),
-              "dataSize"_attr = rs->dataSize(),
-              "duration"_attr = Milliseconds(elapsedMillis));
+        if (pacingDelay > Milliseconds(0)) {
+            opCtx->sleepFor(pacingDelay);
+        }
     }
 
     return true;
 }
 
+Milliseconds OplogCapMaintainerThread::_pacingDelay(
+    const CollectionTruncateMarkers& truncateMarkers) const {
+    auto baseDelay = Milliseconds(gOplogTruncationPacingDelayMillis.load());
+    if (baseDelay == Milliseconds(0)) {
+        return Milliseconds(0);
+    }
+
+    // Scale the delay down as the truncation debt grows. The debt, measured in markers, grows
+    // with the insert rate: every 'minBytesPerMarker' bytes of new oplog data push one more
+    // marker past the cap. One marker behind gets close to the full delay, while several
+    // markers behind shrink it towards zero so the oplog cannot grow unbounded.
+    auto minBytesPerMarker = truncateMarkers.getMinBytesPerMarker();
+    if (minBytesPerMarker <= 0) {
+        return baseDelay;
+    }
+    auto debtMarkers = truncateMarkers.excessBytes() / minBytesPerMarker;
+    return baseDelay / (1 + debtMarkers);
+}
+
 void OplogCapMaintainerThread::start() {
     massert(4204300, "OplogCapMaintainerThread already started", !_thread.joinable());
     _thread = stdx::thread(&OplogCapMaintainerThread::_run, this);
@@ -248,6 +295,7 @@ void OplogCapMaintainerThread::_run() {
 void OplogCapMaintainerThread::appendStats(BSONObjBuilder& builder) const {
     builder.append("totalTimeTruncatingMicros", _totalTimeTruncating.load());
     builder.append("truncateCount", _truncateCount.load());
+    builder.append("markersTruncated", _markersTruncated.load());
 }
 
 void OplogCapMaintainerThread::shutdown() {
@@ -32,9 +32,12 @@
 #include "mongo/db/auth/cluster_auth_mode.h"
 #include "mongo/db/service_context.h"
 #include "mongo/stdx/thread.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 
+class CollectionTruncateMarkers;
+
 /**
  * Responsible for deleting oplog truncate markers once their max capacity has been reached.
  */
@@ -62,13 +65,23 @@ private:
      */
     bool _deleteExcessDocuments(OperationContext* opCtx);
 
+    /**
+     * Returns how long to sleep before removing the next truncate marker. The delay shrinks as
+     * the truncation debt grows so that a backlog of excess markers is drained promptly, and is
+     * zero when pacing is disabled.
+     */
+    Milliseconds _pacingDelay(const CollectionTruncateMarkers& truncateMarkers) const;
+
     stdx::thread _thread;
 
     // Cumulative amount of time spent truncating the oplog.
     AtomicWord<int64_t> _totalTimeTruncating;
 
-    // Cumulative number of truncates of the oplog.
+    // Cumulative number of truncation passes over the oplog.
     AtomicWord<int64_t> _truncateCount;
+
+    // Cumulative number of truncate markers removed.
+    AtomicWord<int64_t> _markersTruncated;
 };
 
 }  // namespace mongo
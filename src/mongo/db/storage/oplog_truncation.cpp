@@ -39,9 +39,16 @@
 
 namespace mongo::oplog_truncation {
 
-RecordId reclaimOplog(OperationContext* opCtx, RecordStore& oplog, RecordId mayTruncateUpTo) {
+RecordId reclaimOplog(OperationContext* opCtx,
+                      RecordStore& oplog,
+                      RecordId mayTruncateUpTo,
+                      size_t maxMarkersToTruncate) {
     RecordId highestTruncated;
+    size_t markersTruncated = 0;
     for (auto getNextMarker = true; getNextMarker;) {
+        if (maxMarkersToTruncate > 0 && markersTruncated >= maxMarkersToTruncate) {
+            break;
+        }
         auto truncateMarkers = oplog.oplog()->getCollectionTruncateMarkers();
         auto truncateMarker = truncateMarkers->peekOldestMarkerIfNeeded(opCtx);
         if (!truncateMarker) {
@@ -120,6 +127,7 @@ RecordId reclaimOplog(OperationContext* opCtx, RecordStore& oplog, RecordId mayT
 
                 // Update the current first record as we truncate.
                 highestTruncated = truncateMarker->lastRecord;
+                markersTruncated++;
                 return true;
             });
     }
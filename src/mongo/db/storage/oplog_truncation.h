@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "mongo/db/record_id.h"
 
 namespace mongo {
@@ -44,9 +46,16 @@ namespace oplog_truncation {
  *
  * `mayTruncateUpTo` is the highest allowable record that will be truncated, inclusive.
  *
+ * `maxMarkersToTruncate` bounds how many truncate markers may be removed by a single call, with 0
+ * meaning no bound. The oplog cap maintainer uses this to reclaim space in small paced steps
+ * rather than draining every excess marker in one burst.
+ *
  * Returns the highest RecordId that was truncated, or a null RecordId if nothing was truncated.
  */
-RecordId reclaimOplog(OperationContext* opCtx, RecordStore& oplog, RecordId mayTruncateUpTo);
+RecordId reclaimOplog(OperationContext* opCtx,
+                      RecordStore& oplog,
+                      RecordId mayTruncateUpTo,
+                      size_t maxMarkersToTruncate = 0);
 
 }  // namespace oplog_truncation
 }  // namespace mongo
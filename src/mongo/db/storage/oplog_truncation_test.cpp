@@ -628,6 +628,67 @@ TEST(OplogTruncationTest, ReclaimTruncateMarkers) {
     }
 }
 
+/**
+ * Verify that 'maxMarkersToTruncate' bounds the number of truncate markers removed per call and
+ * that the truncation debt shrinks accordingly.
+ */
+TEST(OplogTruncationTest, ReclaimTruncateMarkersBounded) {
+    std::unique_ptr<RecordStoreHarnessHelper> harnessHelper = newRecordStoreHarnessHelper();
+    std::unique_ptr<RecordStore> rs(harnessHelper->newOplogRecordStore());
+    auto engine = harnessHelper->getEngine();
+
+    auto oplogTruncateMarkers = rs->oplog()->getCollectionTruncateMarkers();
+
+    ASSERT_OK(rs->oplog()->updateSize(100));
+
+    oplogTruncateMarkers->setMinBytesPerMarker(100);
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+
+        ASSERT_EQ(insertBSONWithSize(opCtx.get(), engine, rs.get(), Timestamp(1, 1), 100),
+                  RecordId(1, 1));
+        ASSERT_EQ(insertBSONWithSize(opCtx.get(), engine, rs.get(), Timestamp(1, 2), 100),
+                  RecordId(1, 2));
+        ASSERT_EQ(insertBSONWithSize(opCtx.get(), engine, rs.get(), Timestamp(1, 3), 100),
+                  RecordId(1, 3));
+        ASSERT_EQ(insertBSONWithSize(opCtx.get(), engine, rs.get(), Timestamp(1, 4), 100),
+                  RecordId(1, 4));
+
+        ASSERT_EQ(4U, oplogTruncateMarkers->numMarkers_forTest());
+        ASSERT_EQ(300, oplogTruncateMarkers->excessBytes());
+    }
+
+    // A bounded call only removes a single truncate marker even though three are eligible.
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+
+        harnessHelper->advanceStableTimestamp(Timestamp(1, 4));
+        auto mayTruncateUpTo = RecordId(engine->getPinnedOplog().asULL());
+        auto truncatedUpTo = oplog_truncation::reclaimOplog(
+            opCtx.get(), *rs.get(), mayTruncateUpTo, 1 /* maxMarkersToTruncate */);
+
+        ASSERT_EQ(RecordId(1, 1), truncatedUpTo);
+        ASSERT_EQ(3, rs->numRecords());
+        ASSERT_EQ(3U, oplogTruncateMarkers->numMarkers_forTest());
+        ASSERT_EQ(200, oplogTruncateMarkers->excessBytes());
+    }
+
+    // An unbounded call drains the remaining excess markers.
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+
+        auto mayTruncateUpTo = RecordId(engine->getPinnedOplog().asULL());
+        auto truncatedUpTo =
+            oplog_truncation::reclaimOplog(opCtx.get(), *rs.get(), mayTruncateUpTo);
+
+        ASSERT_EQ(RecordId(1, 3), truncatedUpTo);
+        ASSERT_EQ(1, rs->numRecords());
+        ASSERT_EQ(1U, oplogTruncateMarkers->numMarkers_forTest());
+        ASSERT_EQ(0, oplogTruncateMarkers->excessBytes());
+    }
+}
+
 /**
  * Verify that an oplog truncate marker isn't created if it would cause the logical representation
  * of the records to not be in increasing order.
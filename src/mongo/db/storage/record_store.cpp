@@ -27,6 +27,9 @@
  *    it in the license file.
  */
 
+#include <algorithm>
+#include <numeric>
+
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 
@@ -34,11 +37,54 @@
 #include "mongo/db/storage/damage_vector.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/str.h"
 
 namespace mongo {
 
-void CappedInsertNotifier::notifyAll() const {
+std::vector<RecordData> RecordStore::dataForMany(OperationContext* opCtx,
+                                                 const std::vector<RecordId>& ids) const {
+    // Visit the records in id order so the storage engine sees a near-sequential access pattern,
+    // but return the data in the caller's order.
+    std::vector<size_t> order(ids.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&ids](size_t lhs, size_t rhs) {
+        return ids[lhs] < ids[rhs];
+    });
+
+    std::vector<RecordData> out(ids.size());
+    auto cursor = getCursor(opCtx);
+    for (auto idx : order) {
+        auto record = cursor->seekExact(ids[idx]);
+        invariant(record,
+                  str::stream() << "Didn't find RecordId " << ids[idx] << " in record store");
+        record->data.makeOwned();  // Unowned data expires when the cursor is advanced.
+        out[idx] = std::move(record->data);
+    }
+    return out;
+}
+
+void CappedInsertNotifier::notifyAll(boost::optional<Timestamp> visibleTimestamp) const {
     stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (visibleTimestamp) {
+        // A single commit may produce one notification per insert batch in its write unit of work,
+        // all carrying the same commit timestamp. One wakeup per commit suffices.
+        if (_lastNotifiedTimestamp == visibleTimestamp) {
+            return;
+        }
+        _lastNotifiedTimestamp = visibleTimestamp;
+        // Commit timestamps are not necessarily monotonic (e.g. out-of-order commits during
+        // secondary batch application), so track the maximum seen so far.
+        _maxVisibleTimestamp = _maxVisibleTimestamp
+            ? std::max(*_maxVisibleTimestamp, *visibleTimestamp)
+            : *visibleTimestamp;
+    } else {
+        // Without a timestamp we cannot tell which waiters have already seen this data, so all of
+        // them must wake. A subsequent timestamped notification must not be collapsed into this
+        // one either.
+        _lastNotifiedTimestamp = boost::none;
+        _maxVisibleTimestamp = boost::none;
+    }
     ++_version;
     _notifier.notify_all();
 }
@@ -50,11 +96,22 @@ uint64_t CappedInsertNotifier::getVersion() const {
 
 void CappedInsertNotifier::waitUntil(OperationContext* opCtx,
                                      uint64_t prevVersion,
-                                     Date_t deadline) const {
+                                     Date_t deadline,
+                                     boost::optional<Timestamp> readTimestamp) const {
     stdx::unique_lock<stdx::mutex> lk(_mutex);
-    opCtx->waitForConditionOrInterruptUntil(_notifier, lk, deadline, [this, prevVersion]() {
-        return _dead || prevVersion != _version;
-    });
+    opCtx->waitForConditionOrInterruptUntil(
+        _notifier, lk, deadline, [this, prevVersion, readTimestamp]() {
+            if (_dead) {
+                return true;
+            }
+            if (prevVersion == _version) {
+                return false;
+            }
+            // Notifications have arrived, but if everything notified about so far was already
+            // visible at the caller's read timestamp there is nothing new for it to return.
+            return !readTimestamp || !_maxVisibleTimestamp ||
+                *_maxVisibleTimestamp > *readTimestamp;
+        });
 }
 
 void CappedInsertNotifier::kill() {
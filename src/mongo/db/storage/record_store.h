@@ -256,17 +256,27 @@ public:
 class CappedInsertNotifier {
 public:
     /**
-     * Wakes up all threads waiting.
+     * Wakes up all threads waiting. If 'visibleTimestamp' is provided, it is the commit timestamp
+     * of the newly committed data. A single commit may trigger several notifications (one per
+     * insert batch in the write unit of work); repeated notifications carrying the same timestamp
+     * are collapsed into a single wakeup.
      */
-    void notifyAll() const;
+    void notifyAll(boost::optional<Timestamp> visibleTimestamp = boost::none) const;
 
     /**
      * Waits until 'deadline', or until notifyAll() is called to indicate that new
      * data is available in the capped collection.
      *
+     * If 'readTimestamp' is provided, notifications for data that was already visible at that
+     * timestamp do not end the wait: the caller has already had the chance to read that data, so
+     * waking it would only trigger a fruitless re-scan.
+     *
      * NOTE: Waiting threads can be signaled by calling kill or notify* methods.
      */
-    void waitUntil(OperationContext* opCtx, uint64_t prevVersion, Date_t deadline) const;
+    void waitUntil(OperationContext* opCtx,
+                   uint64_t prevVersion,
+                   Date_t deadline,
+                   boost::optional<Timestamp> readTimestamp = boost::none) const;
 
     /**
      * Returns the version for use as an additional wake condition when used above.
@@ -296,6 +306,15 @@ private:
     // counter. Access to this counter is synchronized with '_mutex'.
     mutable uint64_t _version = 0;
 
+    // Commit timestamp of the most recent timestamped notification, used to collapse the several
+    // notifications a single commit may produce into one wakeup. Synchronized with '_mutex'.
+    mutable boost::optional<Timestamp> _lastNotifiedTimestamp;
+
+    // Upper bound on the visibility timestamps of the data notified about so far, or boost::none
+    // while unknown (i.e. after a notification arrived without a timestamp). Waiters which have
+    // already read at or beyond this timestamp may keep waiting. Synchronized with '_mutex'.
+    mutable boost::optional<Timestamp> _maxVisibleTimestamp = Timestamp();
+
     // True once the notifier is dead.
     bool _dead = false;
 };
@@ -382,6 +401,17 @@ public:
      */
     virtual RecordData dataFor(OperationContext*, const RecordId&) const = 0;
 
+    /**
+     * Gets the RecordData for every id in 'ids', all of which must exist, and returns the records
+     * in the same order as 'ids'. The returned data is always owned.
+     *
+     * The default implementation sorts the ids and fetches them with a single cursor in id order,
+     * so a batch collected from an index scan is read with near-sequential rather than random
+     * access. Prefer this over repeated dataFor calls when multiple ids are available up front.
+     */
+    virtual std::vector<RecordData> dataForMany(OperationContext*,
+                                                const std::vector<RecordId>& ids) const;
+
     /**
      * @param out - If the record exists, the contents of this are set.
      * @return true iff there is a Record for loc
@@ -588,9 +618,10 @@ public:
 
     /**
      * If the record store is capped and there are listeners waiting for notifications for capped
-     * inserts, notifies them.
+     * inserts, notifies them. 'visibleTimestamp' is the commit timestamp of the newly visible
+     * data when known; it lets waiters which have already read past that point keep waiting.
      */
-    virtual void notifyWaitersIfNeeded() = 0;
+    virtual void notifyWaitersIfNeeded(boost::optional<Timestamp> visibleTimestamp) = 0;
 
     /**
      * Truncate documents newer than the document at 'end' from the capped
@@ -168,9 +168,9 @@ bool RecordStoreBase::Capped::hasWaiters() const {
     return _cappedInsertNotifier && _cappedInsertNotifier.use_count() > 1;
 }
 
-void RecordStoreBase::Capped::notifyWaitersIfNeeded() {
+void RecordStoreBase::Capped::notifyWaitersIfNeeded(boost::optional<Timestamp> visibleTimestamp) {
     if (hasWaiters()) {
-        _cappedInsertNotifier->notifyAll();
+        _cappedInsertNotifier->notifyAll(visibleTimestamp);
     }
 }
 
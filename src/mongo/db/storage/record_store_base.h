@@ -135,7 +135,7 @@ public:
 
     bool hasWaiters() const final;
 
-    void notifyWaitersIfNeeded() final;
+    void notifyWaitersIfNeeded(boost::optional<Timestamp> visibleTimestamp) final;
 
     void truncateAfter(OperationContext*,
                        const RecordId&,
@@ -32,6 +32,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "mongo/base/status_with.h"
 #include "mongo/base/string_data.h"
@@ -125,5 +126,55 @@ TEST(RecordStoreTestHarness, DataForMultiple) {
     }
 }
 
+// Insert multiple records and fetch them all at once with dataForMany(), requesting them in
+// reverse insertion order to check that results come back in the caller's order.
+TEST(RecordStoreTestHarness, DataForMany) {
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    std::unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
+
+    ASSERT_EQUALS(0, rs->numRecords());
+
+    const int nToInsert = 10;
+    RecordId locs[nToInsert];
+    for (int i = 0; i < nToInsert; i++) {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        auto& ru = *shard_role_details::getRecoveryUnit(opCtx.get());
+        {
+            std::stringstream ss;
+            ss << "record----" << i;
+            std::string data = ss.str();
+
+            StorageWriteTransaction txn(ru);
+            StatusWith<RecordId> res =
+                rs->insertRecord(opCtx.get(), data.c_str(), data.size() + 1, Timestamp());
+            ASSERT_OK(res.getStatus());
+            locs[i] = res.getValue();
+            txn.commit();
+        }
+    }
+
+    ASSERT_EQUALS(nToInsert, rs->numRecords());
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+
+        std::vector<RecordId> ids;
+        for (int i = nToInsert - 1; i >= 0; i--) {
+            ids.push_back(locs[i]);
+        }
+
+        std::vector<RecordData> records = rs->dataForMany(opCtx.get(), ids);
+        ASSERT_EQUALS(ids.size(), records.size());
+        for (int i = 0; i < nToInsert; i++) {
+            std::stringstream ss;
+            ss << "record----" << (nToInsert - 1 - i);
+            std::string data = ss.str();
+
+            ASSERT_EQUALS(data.size() + 1, static_cast<size_t>(records[i].size()));
+            ASSERT_EQUALS(data, records[i].data());
+        }
+    }
+}
+
 }  // namespace
 }  // namespace mongo
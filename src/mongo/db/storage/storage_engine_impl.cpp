@@ -79,8 +79,11 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
@@ -101,6 +104,10 @@ namespace {
 const std::string kCatalogInfo = DatabaseName::kMdbCatalog.db(omitTenant).toString();
 const NamespaceString kCatalogInfoNamespace = NamespaceString(DatabaseName::kMdbCatalog);
 const auto kCatalogLogLevel = logv2::LogSeverity::Debug(2);
+
+// Number of durable catalog entries to assign per worker thread when parallelizing collection
+// initialization at startup. Catalogs smaller than this are initialized serially.
+constexpr size_t kMinCollectionsPerInitWorker = 256;
 }  // namespace
 
 StorageEngineImpl::StorageEngineImpl(OperationContext* opCtx,
@@ -327,6 +334,14 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
     LOGV2(9529903,
           "Initializing all collections in durable catalog",
           "numEntries"_attr = catalogEntries.size());
+    Timer initTimer;
+    struct CollectionToInit {
+        RecordId catalogId;
+        NamespaceString nss;
+        Timestamp minValidTs;
+    };
+    std::vector<CollectionToInit> collectionsToInit;
+    collectionsToInit.reserve(catalogEntries.size());
     for (DurableCatalog::EntryIdentifier entry : catalogEntries) {
         if (_options.forRestore) {
             // When restoring a subset of user collections from a backup, the collections not
@@ -439,14 +454,97 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
             }
         }
 
-        _initCollection(
-            opCtx, entry.catalogId, entry.nss, _options.forRepair, collectionMinValidTs);
+        collectionsToInit.push_back({entry.catalogId, entry.nss, collectionMinValidTs});
 
         if (entry.nss.isOrphanCollection()) {
             LOGV2(22248, "Orphaned collection found", logAttrs(entry.nss));
         }
     }
 
+    // Instantiating Collection objects is the dominant cost of startup on catalogs with many
+    // collections: each entry requires parsing the durable catalog metadata and opening the
+    // record store. The work is independent per entry, so spread it over a thread pool and
+    // register the results with the CollectionCatalog afterwards on this thread, which holds the
+    // global exclusive lock. Repair keeps the serial path as orphan recovery interleaves catalog
+    // writes with initialization.
+    size_t numWorkers = _options.forRepair
+        ? 1
+        : std::clamp(collectionsToInit.size() / kMinCollectionsPerInitWorker,
+                     size_t{1},
+                     static_cast<size_t>(ProcessInfo::getNumAvailableCores()));
+    if (numWorkers == 1) {
+        for (const auto& collectionToInit : collectionsToInit) {
+            _initCollection(opCtx,
+                            collectionToInit.catalogId,
+                            collectionToInit.nss,
+                            _options.forRepair,
+                            collectionToInit.minValidTs);
+        }
+    } else {
+        std::vector<std::shared_ptr<Collection>> collections(collectionsToInit.size());
+        std::vector<std::exception_ptr> exceptions(numWorkers);
+
+        ThreadPool::Options threadPoolOptions;
+        threadPoolOptions.poolName = "StartupCollectionInit";
+        threadPoolOptions.maxThreads = numWorkers;
+        threadPoolOptions.onCreateThread = [service = opCtx->getService()](
+                                               const std::string& threadName) {
+            Client::initThread(threadName, service);
+        };
+        ThreadPool threadPool(threadPoolOptions);
+        threadPool.startup();
+
+        for (size_t workerId = 0; workerId < numWorkers; ++workerId) {
+            threadPool.schedule([&, workerId](Status status) {
+                invariant(status);
+                try {
+                    auto workerOpCtx = cc().makeOperationContext();
+
+                    // During initial startup the storage engine has not been registered with the
+                    // service context yet, so new operation contexts get a noop recovery unit.
+                    // See the corresponding replacement for the startup operation context in the
+                    // StorageEngineImpl constructor.
+                    if (shard_role_details::getRecoveryUnit(workerOpCtx.get())->isNoop()) {
+                        shard_role_details::setRecoveryUnit(
+                            workerOpCtx.get(),
+                            std::unique_ptr<RecoveryUnit>(_engine->newRecoveryUnit()),
+                            WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
+                    }
+
+                    for (size_t i = workerId; i < collectionsToInit.size(); i += numWorkers) {
+                        collections[i] = _initCollectionObject(workerOpCtx.get(),
+                                                               collectionsToInit[i].catalogId,
+                                                               collectionsToInit[i].nss,
+                                                               false /* forRepair */);
+                    }
+                    shard_role_details::getRecoveryUnit(workerOpCtx.get())->abandonSnapshot();
+                } catch (...) {
+                    exceptions[workerId] = std::current_exception();
+                }
+            });
+        }
+        threadPool.shutdown();
+        threadPool.join();
+
+        for (auto&& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
+            for (size_t i = 0; i < collections.size(); ++i) {
+                catalog.registerCollection(
+                    opCtx, std::move(collections[i]), collectionsToInit[i].minValidTs);
+            }
+        });
+    }
+    LOGV2(9876517,
+          "Initialized all collections in durable catalog",
+          "numCollections"_attr = collectionsToInit.size(),
+          "workers"_attr = numWorkers,
+          "durationMillis"_attr = initTimer.millis());
+
     shard_role_details::getRecoveryUnit(opCtx)->abandonSnapshot();
 }
 
@@ -455,6 +553,16 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
                                         const NamespaceString& nss,
                                         bool forRepair,
                                         Timestamp minValidTs) {
+    auto collection = _initCollectionObject(opCtx, catalogId, nss, forRepair);
+    CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
+        catalog.registerCollection(opCtx, std::move(collection), /*commitTime*/ minValidTs);
+    });
+}
+
+std::shared_ptr<Collection> StorageEngineImpl::_initCollectionObject(OperationContext* opCtx,
+                                                                     RecordId catalogId,
+                                                                     const NamespaceString& nss,
+                                                                     bool forRepair) {
     const auto catalogEntry = _catalog->getParsedCatalogEntry(opCtx, catalogId);
     const auto md = catalogEntry->metadata;
     uassert(ErrorCodes::MustDowngrade,
@@ -475,11 +583,7 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
     }
 
     auto collectionFactory = Collection::Factory::get(getGlobalServiceContext());
-    auto collection = collectionFactory->make(opCtx, nss, catalogId, md, std::move(rs));
-
-    CollectionCatalog::write(opCtx, [&](CollectionCatalog& catalog) {
-        catalog.registerCollection(opCtx, std::move(collection), /*commitTime*/ minValidTs);
-    });
+    return collectionFactory->make(opCtx, nss, catalogId, md, std::move(rs));
 }
 
 void StorageEngineImpl::closeCatalog(OperationContext* opCtx) {
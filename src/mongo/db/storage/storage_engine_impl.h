@@ -70,6 +70,7 @@
 
 namespace mongo {
 
+class Collection;
 class DurableCatalog;
 class KVEngine;
 
@@ -422,6 +423,16 @@ private:
                          bool forRepair,
                          Timestamp minValidTs);
 
+    /**
+     * Instantiates the in-memory Collection object for a durable catalog entry without registering
+     * it with the CollectionCatalog. Safe to call concurrently for distinct entries as long as
+     * each caller uses its own OperationContext.
+     */
+    std::shared_ptr<Collection> _initCollectionObject(OperationContext* opCtx,
+                                                      RecordId catalogId,
+                                                      const NamespaceString& nss,
+                                                      bool forRepair);
+
     Status _dropCollections(OperationContext* opCtx,
                             const std::vector<UUID>& toDrop,
                             const std::string& collectionNamePrefix = "");
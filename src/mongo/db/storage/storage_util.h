@@ -131,14 +131,11 @@ Status insertBatchAndHandleRetry(OperationContext* opCtx,
     }
 
     // Try to insert the batch one-at-a-time because the batch failed all-at-once inserting.
+    // Conflicts reported by 'insertFn' through its returned status are retried in place rather
+    // than thrown.
     for (auto it = docs.cbegin(); it != docs.cend(); ++it) {
-        auto status = writeConflictRetry(opCtx, "batchInsertDocuments", nsOrUUID, [&] {
-            auto status = insertFn(opCtx, it, it + 1);
-            if (!status.isOK()) {
-                return status;
-            }
-
-            return Status::OK();
+        auto status = writeConflictRetryWithStatus(opCtx, "batchInsertDocuments", nsOrUUID, [&] {
+            return insertFn(opCtx, it, it + 1);
         });
 
         if (!status.isOK()) {
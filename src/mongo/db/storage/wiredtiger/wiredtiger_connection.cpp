@@ -35,6 +35,7 @@
 #include <wiredtiger.h>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_connection.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_error_util.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
@@ -42,8 +43,10 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_session.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -51,13 +54,33 @@
 
 namespace mongo {
 
+namespace {
+
+// One session cache partition per core, rounded up to a power of two so that a partition can be
+// picked with a mask, and capped to bound the cost of operations that visit every partition.
+size_t sessionCachePartitionCount() {
+    constexpr size_t kMaxPartitions = 64;
+    const auto cores = static_cast<size_t>(ProcessInfo::getNumAvailableCores());
+    size_t partitions = 1;
+    while (partitions < cores && partitions < kMaxPartitions) {
+        partitions <<= 1;
+    }
+    return partitions;
+}
+
+}  // namespace
+
 WiredTigerConnection::WiredTigerConnection(WiredTigerKVEngine* engine)
     : WiredTigerConnection(engine->getConn(), engine->getClockSource(), engine) {}
 
 WiredTigerConnection::WiredTigerConnection(WT_CONNECTION* conn,
                                            ClockSource* cs,
                                            WiredTigerKVEngine* engine)
-    : _conn(conn), _clockSource(cs), _engine(engine) {
+    : _conn(conn),
+      _clockSource(cs),
+      _engine(engine),
+      _numPartitions(sessionCachePartitionCount()),
+      _partitions(std::make_unique<SessionCachePartition[]>(_numPartitions)) {
     uassertStatusOK(_compiledConfigurations.compileAll(_conn));
     uassert(9728400,
             "wiredTigerCursorCacheSize parameter value must be <= 0",
@@ -115,8 +138,12 @@ void WiredTigerConnection::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 
 
 size_t WiredTigerConnection::getIdleSessionsCount() {
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        stdx::lock_guard<stdx::mutex> lock(_partitions[i].mutex);
+        count += _partitions[i].sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerConnection::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -128,14 +155,15 @@ void WiredTigerConnection::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        stdx::lock_guard<stdx::mutex> lock(_partitions[i].mutex);
+        auto& sessions = _partitions[i].sessions;
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = sessions.begin(); it != sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
@@ -151,16 +179,26 @@ void WiredTigerConnection::closeExpiredIdleSessions(int64_t idleTimeMillis) {
 }
 
 void WiredTigerConnection::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    // Increment the epoch as we are now closing all sessions with this epoch. All partitions are
+    // locked so the epoch bump and the removal of the cached sessions appear atomic to releasing
+    // threads.
+    SessionCache sessionsToClose;
 
     {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+        std::vector<stdx::unique_lock<stdx::mutex>> locks;
+        locks.reserve(_numPartitions);
+        for (size_t i = 0; i < _numPartitions; ++i) {
+            locks.emplace_back(_partitions[i].mutex);
+        }
         _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+        for (size_t i = 0; i < _numPartitions; ++i) {
+            auto& sessions = _partitions[i].sessions;
+            sessionsToClose.insert(sessionsToClose.end(), sessions.begin(), sessions.end());
+            sessions.clear();
+        }
     }
 
-    for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
+    for (SessionCache::iterator i = sessionsToClose.begin(); i != sessionsToClose.end(); i++) {
         delete (*i);
     }
 }
@@ -180,20 +218,40 @@ UniqueWiredTigerSession WiredTigerConnection::getUninterruptibleSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.load() & kShuttingDownMask));
 
+    auto& home = _getHomePartition();
     {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        if (!_sessions.empty()) {
+        stdx::lock_guard<stdx::mutex> lock(home.mutex);
+        if (!home.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = home.sessions.back();
+            home.sessions.pop_back();
             // Reset the idle time
             cachedSession->setIdleExpireTime(Date_t::min());
+            _cacheHits.fetchAndAddRelaxed(1);
+            return UniqueWiredTigerSession(cachedSession);
+        }
+    }
+
+    // The home partition is empty; steal an idle session from another partition before paying for
+    // a new WT_SESSION.
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        auto& partition = _partitions[i];
+        if (&partition == &home) {
+            continue;
+        }
+        stdx::lock_guard<stdx::mutex> lock(partition.mutex);
+        if (!partition.sessions.empty()) {
+            WiredTigerSession* cachedSession = partition.sessions.back();
+            partition.sessions.pop_back();
+            cachedSession->setIdleExpireTime(Date_t::min());
+            _cacheSteals.fetchAndAddRelaxed(1);
             return UniqueWiredTigerSession(cachedSession);
         }
     }
 
     // Outside of the cache partition lock, but on release will be put back on the cache
+    _cacheMisses.fetchAndAddRelaxed(1);
     return UniqueWiredTigerSession(new WiredTigerSession(this, _epoch.load()));
 }
 
@@ -238,8 +296,9 @@ void WiredTigerConnection::_releaseSession(WiredTigerSession* session) {
     // Set the time this session got idle at.
     session->setIdleExpireTime(_clockSource->now());
     {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        _sessions.push_back(session);
+        auto& home = _getHomePartition();
+        stdx::lock_guard<stdx::mutex> lock(home.mutex);
+        home.sessions.push_back(session);
     }
 
     if (_engine) {
@@ -247,6 +306,22 @@ void WiredTigerConnection::_releaseSession(WiredTigerSession* session) {
     }
 }
 
+WiredTigerConnection::SessionCachePartition& WiredTigerConnection::_getHomePartition() {
+    // Hash the thread id once per thread; with one partition per core this spreads concurrently
+    // running threads across partitions while keeping each thread on a stable partition.
+    static thread_local const size_t threadHash =
+        std::hash<stdx::thread::id>{}(stdx::this_thread::get_id());
+    return _partitions[threadHash & (_numPartitions - 1)];
+}
+
+void WiredTigerConnection::appendSessionCacheStats(BSONObjBuilder& bob) const {
+    BSONObjBuilder sub(bob.subobjStart("sessionCache"));
+    sub.append("partitions", static_cast<long long>(_numPartitions));
+    sub.append("hits", _cacheHits.loadRelaxed());
+    sub.append("stolen", _cacheSteals.loadRelaxed());
+    sub.append("misses", _cacheMisses.loadRelaxed());
+}
+
 void WiredTigerConnection::WiredTigerSessionDeleter::operator()(WiredTigerSession* session) const {
     session->_connection->_releaseSession(session);
 }
@@ -42,12 +42,14 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/interruptible.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
 
+class BSONObjBuilder;
 class StatsCollectionPermit;
 class WiredTigerKVEngine;
 
@@ -181,6 +183,12 @@ public:
         return &_compiledConfigurations;
     }
 
+    /**
+     * Appends session cache checkout statistics (partition count, hits, steals and misses) to
+     * 'bob' as a 'sessionCache' subobject. Reported under the 'wiredtiger' serverStatus section.
+     */
+    void appendSessionCacheStats(BSONObjBuilder& bob) const;
+
 private:
     // Opens a session.
     WT_SESSION* _openSession(WiredTigerSession* session,
@@ -218,9 +226,27 @@ private:
     AtomicWord<unsigned> _shuttingDown{0};
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    stdx::mutex _cacheLock;
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The session cache is partitioned to reduce mutex contention on session checkout at high
+    // core counts. Each thread has a home partition chosen by hashing its thread id;
+    // getUninterruptibleSession() falls back to stealing an idle session from another partition
+    // before opening a new one.
+    struct alignas(stdx::hardware_destructive_interference_size) SessionCachePartition {
+        stdx::mutex mutex;
+        SessionCache sessions;
+    };
+
+    SessionCachePartition& _getHomePartition();
+
+    const size_t _numPartitions;
+    std::unique_ptr<SessionCachePartition[]> _partitions;
+
+    // Session checkout statistics: a hit found a cached session in the home partition, a steal
+    // took one from another partition and a miss opened a new WT_SESSION.
+    AtomicWord<long long> _cacheHits{0};
+    AtomicWord<long long> _cacheSteals{0};
+    AtomicWord<long long> _cacheMisses{0};
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
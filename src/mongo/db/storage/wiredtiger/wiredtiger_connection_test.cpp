@@ -38,6 +38,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/unittest/temp_dir.h"
@@ -117,6 +118,24 @@ TEST(WiredTigerConnectionTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(connection->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerConnectionTest, StealSessionFromAnotherPartition) {
+    WiredTigerConnectionHarnessHelper harnessHelper("");
+    WiredTigerConnection* connection = harnessHelper.getConnection();
+
+    // Release a session into this thread's cache partition.
+    { UniqueWiredTigerSession session = connection->getUninterruptibleSession(); }
+    ASSERT_EQUALS(connection->getIdleSessionsCount(), 1U);
+
+    // A thread whose home partition is empty must reuse the cached session from the releasing
+    // thread's partition rather than opening a new one.
+    stdx::thread stealer([&] {
+        UniqueWiredTigerSession session = connection->getUninterruptibleSession();
+        ASSERT_EQUALS(connection->getIdleSessionsCount(), 0U);
+    });
+    stealer.join();
+    ASSERT_EQUALS(connection->getIdleSessionsCount(), 1U);
+}
+
 TEST(WiredTigerConnectionTest, ReleaseCursorDuringShutdown) {
     WiredTigerConnectionHarnessHelper harnessHelper("");
     WiredTigerConnection* connection = harnessHelper.getConnection();
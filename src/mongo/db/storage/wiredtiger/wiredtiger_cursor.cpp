@@ -28,6 +28,9 @@
  */
 
 
+#include <array>
+#include <string>
+
 #include <wiredtiger.h>
 
 #include "mongo/base/error_codes.h"
@@ -48,6 +51,40 @@ namespace mongo {
 
 namespace {
 static constexpr StringData kOverwriteFalse = "overwrite=false"_sd;
+
+// Every cursor open option is drawn from a small fixed set, so all possible config strings are
+// rendered once up front and selected by a bitmask instead of being rebuilt with a string builder
+// on each cursor open. The bit order mirrors the order in which the options are appended, with
+// 'overwrite=false' last so that, as the only option, the string has no trailing comma. This
+// enables an optimization in WiredTiger to skip parsing the config string; see SERVER-43232.
+constexpr int kReadOnceBit = 1 << 0;
+constexpr int kRandomBit = 1 << 1;
+constexpr int kCheckpointBit = 1 << 2;
+constexpr int kOverwriteFalseBit = 1 << 3;
+
+const std::string& cursorConfigString(int optionsMask) {
+    static const std::array<std::string, 16> configs = [] {
+        std::array<std::string, 16> strings;
+        for (int mask = 0; mask < static_cast<int>(strings.size()); ++mask) {
+            str::stream builder;
+            if (mask & kReadOnceBit) {
+                builder << "read_once=true,";
+            }
+            if (mask & kRandomBit) {
+                builder << "next_random,";
+            }
+            if (mask & kCheckpointBit) {
+                builder << "checkpoint=WiredTigerCheckpoint,";
+            }
+            if (mask & kOverwriteFalseBit) {
+                builder << kOverwriteFalse;
+            }
+            strings[mask] = builder;
+        }
+        return strings;
+    }();
+    return configs[optionsMask];
+}
 }  // namespace
 
 WiredTigerCursor::WiredTigerCursor(WiredTigerRecoveryUnit& ru,
@@ -63,42 +100,33 @@ WiredTigerCursor::WiredTigerCursor(WiredTigerRecoveryUnit& ru,
     // Passing nullptr is significantly faster for WiredTiger than passing an empty string.
     const char* configStr = nullptr;
 
-    // If we have uncommon cursor options, use a costlier string builder.
-    if (ru.getReadOnce() || _isCheckpoint || random) {
-        str::stream builder;
-        if (ru.getReadOnce()) {
-            builder << "read_once=true,";
-        }
-
-        if (random) {
-            builder << "next_random,";
-        }
+    int optionsMask = 0;
+    if (ru.getReadOnce()) {
+        optionsMask |= kReadOnceBit;
+    }
 
-        if (_isCheckpoint) {
-            // Type can be "lsm" or "file".
-            std::string type, sourceURI;
-            WiredTigerUtil::fetchTypeAndSourceURI(ru, uri, &type, &sourceURI);
-            uassert(ErrorCodes::InvalidOptions,
-                    str::stream() << "LSM does not support opening cursors by checkpoint",
-                    type != "lsm");
+    if (random) {
+        optionsMask |= kRandomBit;
+    }
 
-            builder << "checkpoint=WiredTigerCheckpoint,";
-        }
+    if (_isCheckpoint) {
+        // Type can be "lsm" or "file".
+        std::string type, sourceURI;
+        WiredTigerUtil::fetchTypeAndSourceURI(ru, uri, &type, &sourceURI);
+        uassert(ErrorCodes::InvalidOptions,
+                str::stream() << "LSM does not support opening cursors by checkpoint",
+                type != "lsm");
+
+        optionsMask |= kCheckpointBit;
+    }
 
-        // Add this option last as the string does not have a trailing comma.
-        if (!allowOverwrite) {
-            builder << kOverwriteFalse;
-        }
+    if (!allowOverwrite) {
+        optionsMask |= kOverwriteFalseBit;
+    }
 
-        _config = builder;
+    if (optionsMask) {
+        _config = cursorConfigString(optionsMask);
         configStr = _config.c_str();
-    } else {
-        // Add this option without a trailing comma. This enables an optimization in WiredTiger to
-        // skip parsing the config string if this is the only option. See SERVER-43232 for details.
-        if (!allowOverwrite) {
-            _config = kOverwriteFalse.toString();
-            configStr = kOverwriteFalse.data();
-        }
     }
 
     // Attempt to retrieve a cursor from the cache.
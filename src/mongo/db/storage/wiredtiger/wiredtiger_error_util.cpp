@@ -95,20 +95,44 @@ bool rollbackReasonWasCachePressure(int sub_level_err) {
     return sub_level_err == WT_CACHE_OVERFLOW || sub_level_err == WT_OLDEST_FOR_EVICTION;
 }
 
+Status cachePressureStatusIfAppropriate(bool txnTooLargeEnabled,
+                                        bool temporarilyUnavailableEnabled,
+                                        bool cacheIsInsufficientForTransaction,
+                                        const char* reason,
+                                        StringData prefix,
+                                        int retCode) {
+    if (txnTooLargeEnabled && cacheIsInsufficientForTransaction) {
+        return Status(ErrorCodes::TransactionTooLargeForCache,
+                      generateContextStrStream(
+                          prefix, WT_TXN_ROLLBACK_REASON_TOO_LARGE_FOR_CACHE, retCode)
+                          << " (" << reason << ")");
+    }
+
+    if (temporarilyUnavailableEnabled) {
+        return Status(ErrorCodes::TemporarilyUnavailable,
+                      generateContextStrStream(prefix, reason, retCode));
+    }
+
+    return Status::OK();
+}
+
 void throwCachePressureExceptionIfAppropriate(bool txnTooLargeEnabled,
                                               bool temporarilyUnavailableEnabled,
                                               bool cacheIsInsufficientForTransaction,
                                               const char* reason,
                                               StringData prefix,
                                               int retCode) {
-    if (txnTooLargeEnabled && cacheIsInsufficientForTransaction) {
-        throwTransactionTooLargeForCache(
-            generateContextStrStream(prefix, WT_TXN_ROLLBACK_REASON_TOO_LARGE_FOR_CACHE, retCode)
-            << " (" << reason << ")");
+    auto status = cachePressureStatusIfAppropriate(txnTooLargeEnabled,
+                                                   temporarilyUnavailableEnabled,
+                                                   cacheIsInsufficientForTransaction,
+                                                   reason,
+                                                   prefix,
+                                                   retCode);
+    if (status.code() == ErrorCodes::TransactionTooLargeForCache) {
+        throwTransactionTooLargeForCache(std::string{status.reason()});
     }
-
-    if (temporarilyUnavailableEnabled) {
-        throwTemporarilyUnavailableException(generateContextStrStream(prefix, reason, retCode));
+    if (status.code() == ErrorCodes::TemporarilyUnavailable) {
+        throwTemporarilyUnavailableException(std::string{status.reason()});
     }
 }
 
@@ -134,7 +158,46 @@ void throwAppropriateException(bool txnTooLargeEnabled,
     throwWriteConflictException(prefix);
 }
 
-Status wtRCToStatus_slow(int retCode, WT_SESSION* session, StringData prefix) {
+Status rollbackToStatus(bool txnTooLargeEnabled,
+                        bool temporarilyUnavailableEnabled,
+                        WT_SESSION* session,
+                        double cacheThreshold,
+                        const char* reason,
+                        StringData prefix,
+                        int retCode,
+                        int sub_level_err) {
+    if ((txnTooLargeEnabled || temporarilyUnavailableEnabled) &&
+        rollbackReasonWasCachePressure(sub_level_err)) {
+        auto status = cachePressureStatusIfAppropriate(
+            txnTooLargeEnabled,
+            temporarilyUnavailableEnabled,
+            cacheIsInsufficientForTransaction(session, cacheThreshold),
+            reason,
+            prefix,
+            retCode);
+        if (!status.isOK()) {
+            return status;
+        }
+    }
+
+    using namespace fmt::literals;
+    // Matches the message produced by throwWriteConflictException().
+    return Status(
+        ErrorCodes::WriteConflict,
+        "Caused by :: {} :: Please retry your operation or multi-document transaction."_format(
+            prefix));
+}
+
+namespace {
+
+/**
+ * Common slow path for the `wtRCToStatus` family. When 'rollbackAsStatus' is set, WT_ROLLBACK is
+ * mapped to a conflict Status rather than thrown, for callers propagating conflicts by status.
+ */
+Status wtRCToStatusImpl(int retCode,
+                        WT_SESSION* session,
+                        StringData prefix,
+                        bool rollbackAsStatus) {
     if (retCode == 0)
         return Status::OK();
 
@@ -157,8 +220,8 @@ Status wtRCToStatus_slow(int retCode, WT_SESSION* session, StringData prefix) {
             return Status::OK();
         }
 
-        // We do not convert WT_ROLLBACK error codes into statuses, so we return Status::OK here
-        // and instead handle them differently below.
+        // WT_ROLLBACK error codes are handled separately below (thrown, or mapped to a conflict
+        // status), so we return Status::OK here.
         if (retCode == WT_ROLLBACK) {
             return Status::OK();
         }
@@ -182,6 +245,17 @@ Status wtRCToStatus_slow(int retCode, WT_SESSION* session, StringData prefix) {
         bool txnTooLargeEnabled = cacheThreshold < 1.0;
         bool temporarilyUnavailableEnabled = gEnableTemporarilyUnavailableExceptions.load();
 
+        if (rollbackAsStatus) {
+            return rollbackToStatus(txnTooLargeEnabled,
+                                    temporarilyUnavailableEnabled,
+                                    session,
+                                    cacheThreshold,
+                                    err_msg,
+                                    prefix,
+                                    retCode,
+                                    sub_level_err);
+        }
+
         throwAppropriateException(txnTooLargeEnabled,
                                   temporarilyUnavailableEnabled,
                                   session,
@@ -213,9 +287,27 @@ Status wtRCToStatus_slow(int retCode, WT_SESSION* session, StringData prefix) {
     return Status(ErrorCodes::UnknownError, s);
 }
 
+}  // namespace
+
+Status wtRCToStatus_slow(int retCode, WT_SESSION* session, StringData prefix) {
+    return wtRCToStatusImpl(retCode, session, prefix, false /* rollbackAsStatus */);
+}
+
 Status wtRCToStatus_slow(int retCode, WiredTigerSession& session, StringData prefix) {
     return session.with(
         [retCode, prefix](WT_SESSION* s) { return wtRCToStatus_slow(retCode, s, prefix); });
 }
 
+Status wtRCToStatusIncludingRollback_slow(int retCode, WT_SESSION* session, StringData prefix) {
+    return wtRCToStatusImpl(retCode, session, prefix, true /* rollbackAsStatus */);
+}
+
+Status wtRCToStatusIncludingRollback_slow(int retCode,
+                                          WiredTigerSession& session,
+                                          StringData prefix) {
+    return session.with([retCode, prefix](WT_SESSION* s) {
+        return wtRCToStatusIncludingRollback_slow(retCode, s, prefix);
+    });
+}
+
 }  // namespace mongo
@@ -44,6 +44,12 @@ class WiredTigerSession;
 
 bool txnExceededCacheThreshold(int64_t txnDirtyBytes, int64_t cacheDirtyBytes, double threshold);
 bool rollbackReasonWasCachePressure(int sub_level_err);
+Status cachePressureStatusIfAppropriate(bool txnTooLargeEnabled,
+                                        bool temporarilyUnavailableEnabled,
+                                        bool cacheIsInsufficientForTransaction,
+                                        const char* reason,
+                                        StringData prefix,
+                                        int retCode);
 void throwCachePressureExceptionIfAppropriate(bool txnTooLargeEnabled,
                                               bool temporarilyUnavailableEnabled,
                                               bool cacheIsInsufficientForTransaction,
@@ -58,8 +64,20 @@ void throwAppropriateException(bool txnTooLargeEnabled,
                                StringData prefix,
                                int retCode,
                                int sub_level_err);
+Status rollbackToStatus(bool txnTooLargeEnabled,
+                        bool temporarilyUnavailableEnabled,
+                        WT_SESSION* session,
+                        double cacheThreshold,
+                        const char* reason,
+                        StringData prefix,
+                        int retCode,
+                        int sub_level_err);
 Status wtRCToStatus_slow(int retCode, WT_SESSION* session, StringData prefix);
 Status wtRCToStatus_slow(int retCode, WiredTigerSession& session, StringData prefix);
+Status wtRCToStatusIncludingRollback_slow(int retCode, WT_SESSION* session, StringData prefix);
+Status wtRCToStatusIncludingRollback_slow(int retCode,
+                                          WiredTigerSession& session,
+                                          StringData prefix);
 
 /**
  * converts wiredtiger return codes to mongodb statuses.
@@ -94,6 +112,30 @@ Status wtRCToStatus(int retCode, WiredTigerSession& session, ContextExpr&& conte
     return wtRCToStatus_slow(retCode, session, std::forward<ContextExpr>(contextExpr)());
 }
 
+/**
+ * Converts WiredTiger return codes to statuses like `wtRCToStatus`, but maps WT_ROLLBACK to a
+ * WriteConflict (or cache-pressure) Status instead of throwing. For hot paths that propagate
+ * conflicts by status to avoid per-conflict exception unwinding; see
+ * `writeConflictRetryWithStatus`.
+ */
+inline Status wtRCToStatusIncludingRollback(int retCode,
+                                            WT_SESSION* session,
+                                            const char* prefix = nullptr) {
+    if (MONGO_likely(retCode == 0))
+        return Status::OK();
+
+    return wtRCToStatusIncludingRollback_slow(retCode, session, prefix);
+}
+
+inline Status wtRCToStatusIncludingRollback(int retCode,
+                                            WiredTigerSession& session,
+                                            const char* prefix = nullptr) {
+    if (MONGO_likely(retCode == 0))
+        return Status::OK();
+
+    return wtRCToStatusIncludingRollback_slow(retCode, session, prefix);
+}
+
 inline void uassertWTOK(int ret, WT_SESSION* session) {
     uassertStatusOK(wtRCToStatus(ret, session));
 }
@@ -225,6 +225,33 @@ TEST_F(WiredTigerUtilHelperTest, throwWriteConflictException) {
     }
 }
 
+TEST_F(WiredTigerUtilHelperTest, cachePressureStatusIfAppropriate) {
+    // Mirrors the throwing variant above: TransactionTooLargeForCache takes precedence over
+    // TemporarilyUnavailable, and an OK status is returned when neither applies.
+    ASSERT_EQUALS(ErrorCodes::TransactionTooLargeForCache,
+                  cachePressureStatusIfAppropriate(true, true, true, reason, prefix, retCode));
+    ASSERT_EQUALS(ErrorCodes::TemporarilyUnavailable,
+                  cachePressureStatusIfAppropriate(false, true, false, reason, prefix, retCode));
+    ASSERT_OK(cachePressureStatusIfAppropriate(true, false, false, reason, prefix, retCode));
+}
+
+TEST_F(WiredTigerUtilHelperTest, rollbackToStatusReturnsWriteConflict) {
+    // Rollbacks not caused by cache pressure, or with the cache pressure errors disabled, map to
+    // a WriteConflict status instead of a thrown exception.
+    ASSERT_EQUALS(
+        ErrorCodes::WriteConflict,
+        rollbackToStatus(false, false, session, cacheThreshold, reason, prefix, retCode, WT_NONE));
+    ASSERT_EQUALS(ErrorCodes::WriteConflict,
+                  rollbackToStatus(false,
+                                   false,
+                                   session,
+                                   cacheThreshold,
+                                   reason,
+                                   prefix,
+                                   retCode,
+                                   WT_OLDEST_FOR_EVICTION));
+}
+
 TEST_F(WiredTigerUtilHelperTest, doesNotThrowCachePressureException) {
     std::vector<TestCase> notCachePressureExceptionTestCases = {
         // Does not throw cache pressure exception if cache is sufficient for transaction no matter
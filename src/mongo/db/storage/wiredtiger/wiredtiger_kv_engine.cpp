@@ -577,9 +577,12 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
     if (_ephemeral && !TestingProctor::instance().isEnabled()) {
         // We do not maintain any snapshot history for the ephemeral storage engine in production
         // because replication and sharded transactions do not currently run on the inMemory engine.
-        // It is live in testing, however.
+        // It is live in testing, however. Pinning the maximum alongside the minimum disables the
+        // snapshot window self-tuning.
         minSnapshotHistoryWindowInSeconds.store(0);
+        maxTargetSnapshotHistoryWindowInSeconds.store(0);
     }
+    _targetSnapshotHistoryWindowSeconds.store(minSnapshotHistoryWindowInSeconds.load());
 
     _sizeStorerUri = _uri("sizeStorer");
     WiredTigerSession session(_connection.get());
@@ -643,9 +646,13 @@ void WiredTigerKVEngine::notifyReplStartupRecoveryComplete(RecoveryUnit& ru) {
             9611300, 1, "Excluding oplog table for auto compact", "ident"_attr = oplogIdent);
         excludedIdents.push_back(oplogIdent);
     }
+    boost::optional<int64_t> freeSpaceTargetMB;
+    if (gAutoCompactFreeSpaceTargetMB > 0) {
+        freeSpaceTargetMB = gAutoCompactFreeSpaceTargetMB;
+    }
     AutoCompactOptions options{/*enable=*/true,
                                /*runOnce=*/false,
-                               /*freeSpaceTargetMB=*/boost::none,
+                               freeSpaceTargetMB,
                                std::move(excludedIdents)};
 
     auto status = autoCompact(ru, options);
@@ -2186,13 +2193,9 @@ bool WiredTigerKVEngine::_removeIdentDirectoryIfEmpty(StringData ident, size_t s
 }
 
 void WiredTigerKVEngine::setJournalListener(JournalListener* jl) {
-    stdx::unique_lock<stdx::mutex> lk(_journalListenerMutex);
-
     // A JournalListener can only be set once. Otherwise, accessing a copy of the _journalListener
-    // pointer without a mutex would be unsafe.
-    invariant(!_journalListener);
-
-    _journalListener = jl;
+    // pointer after loading it would be unsafe.
+    invariant(_journalListener.swap(jl) == nullptr);
 }
 
 void WiredTigerKVEngine::setStableTimestamp(Timestamp stableTimestamp, bool force) {
@@ -2317,24 +2320,24 @@ void WiredTigerKVEngine::setOldestTimestamp(Timestamp newOldestTimestamp, bool f
 }
 
 Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp stableTimestamp) {
-    // The oldest_timestamp should lag behind the stable_timestamp by
-    // 'minSnapshotHistoryWindowInSeconds' seconds.
+    // The oldest_timestamp should lag behind the stable_timestamp by the self-tuned snapshot
+    // history window, in seconds.
 
     if (_ephemeral && !TestingProctor::instance().isEnabled()) {
         // No history should be maintained for the inMemory engine because it is not used yet.
         invariant(minSnapshotHistoryWindowInSeconds.load() == 0);
     }
 
-    if (stableTimestamp.getSecs() <
-        static_cast<unsigned>(minSnapshotHistoryWindowInSeconds.load())) {
+    const auto historyWindowSecs = _tunedSnapshotHistoryWindowSeconds();
+
+    if (stableTimestamp.getSecs() < static_cast<unsigned>(historyWindowSecs)) {
         // The history window is larger than the timestamp history thus far. We must wait for
         // the history to reach the window size before moving oldest_timestamp forward. This should
         // only happen in unit tests.
         return Timestamp();
     }
 
-    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() -
-                                            minSnapshotHistoryWindowInSeconds.load(),
+    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() - historyWindowSecs,
                                         stableTimestamp.getInc());
 
     if (calculatedOldestTimestamp.asULL() <= _oldestTimestamp.load()) {
@@ -2351,6 +2354,78 @@ Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp
     return calculatedOldestTimestamp;
 }
 
+int WiredTigerKVEngine::_tunedSnapshotHistoryWindowSeconds() {
+    const int minWindow = minSnapshotHistoryWindowInSeconds.load();
+    const int maxWindow = std::max(maxTargetSnapshotHistoryWindowInSeconds.load(), minWindow);
+
+    int target = std::clamp(_targetSnapshotHistoryWindowSeconds.load(), minWindow, maxWindow);
+    if (minWindow == maxWindow) {
+        // Self-tuning is disabled; behave like a static window.
+        _targetSnapshotHistoryWindowSeconds.store(target);
+        return target;
+    }
+
+    // Evaluate the tuning signals at most once per second; calls in between reuse the current
+    // target.
+    const auto nowMillis = Date_t::now().toMillisSinceEpoch();
+    auto lastEvalMillis = _lastSnapshotWindowEvalMillis.load();
+    if (nowMillis - lastEvalMillis < 1000 ||
+        !_lastSnapshotWindowEvalMillis.compareAndSwap(&lastEvalMillis, nowMillis)) {
+        _targetSnapshotHistoryWindowSeconds.store(target);
+        return target;
+    }
+
+    // Readers that failed with SnapshotTooOld since the last evaluation needed more history
+    // than the window provided.
+    const auto snapshotTooOldErrors = snapshotTooOldErrorCount.load();
+    const bool readersNeededMoreHistory =
+        snapshotTooOldErrors > _lastSnapshotTooOldErrorCount.swap(snapshotTooOldErrors);
+
+    auto session = _connection->getUninterruptibleSession();
+    auto readStatistic = [&](int statisticsKey) -> int64_t {
+        auto value = WiredTigerUtil::getStatisticsValue(
+            *session, "statistics:", "statistics=(fast)", statisticsKey);
+        if (!value.isOK()) {
+            LOGV2_DEBUG(9876535,
+                        1,
+                        "Unable to gather a statistic for snapshot window tuning",
+                        "statisticsKey"_attr = statisticsKey,
+                        "error"_attr = value.getStatus());
+            return 0;
+        }
+        return value.getValue();
+    };
+
+    // Fraction of the cache occupied by history store content.
+    double historyStorePressure = 0.0;
+    if (auto cacheMaxBytes = readStatistic(WT_STAT_CONN_CACHE_BYTES_MAX); cacheMaxBytes > 0) {
+        historyStorePressure =
+            static_cast<double>(readStatistic(WT_STAT_CONN_CACHE_BYTES_HS)) / cacheMaxBytes;
+    }
+
+    // Age of the oldest active read timestamp relative to the newest, in seconds. The
+    // wall-clock seconds of a timestamp live in its upper 32 bits.
+    const auto oldestReaderAgeSecs = static_cast<int64_t>(
+        static_cast<uint64_t>(readStatistic(WT_STAT_CONN_TXN_PINNED_TIMESTAMP_READER)) >> 32);
+
+    if (historyStorePressure >= snapshotHistoryCachePressureThreshold.load()) {
+        // History is crowding out live data in the cache; shrink the window regardless of
+        // reader activity.
+        target = std::max(
+            static_cast<int>(target * snapshotWindowMultiplicativeDecrease.load()), minWindow);
+    } else if (readersNeededMoreHistory) {
+        target = std::min(target + snapshotWindowAdditiveIncreaseSeconds.load(), maxWindow);
+    } else if (oldestReaderAgeSecs + snapshotWindowAdditiveIncreaseSeconds.load() < target) {
+        // No active reader is near the back of the window; decay towards the configured
+        // minimum.
+        target = std::max(
+            static_cast<int>(target * snapshotWindowMultiplicativeDecrease.load()), minWindow);
+    }
+
+    _targetSnapshotHistoryWindowSeconds.store(target);
+    return target;
+}
+
 void WiredTigerKVEngine::setInitialDataTimestamp(Timestamp initialDataTimestamp) {
     LOGV2_DEBUG(22344,
                 2,
@@ -2698,7 +2773,7 @@ Status WiredTigerKVEngine::oplogDiskLocRegister(RecoveryUnit& ru,
 
     // Inserts and updates usually notify waiters on commit, but the oplog collection has special
     // visibility rules and waiters must be notified whenever the oplog read timestamp is forwarded.
-    oplogRecordStore->capped()->notifyWaitersIfNeeded();
+    oplogRecordStore->capped()->notifyWaitersIfNeeded(opTime);
     return Status::OK();
 }
 
@@ -2836,13 +2911,9 @@ void WiredTigerKVEngine::waitUntilDurable(OperationContext* opCtx,
 std::pair<JournalListener*, boost::optional<JournalListener::Token>>
 WiredTigerKVEngine::_getJournalListenerWithToken(OperationContext* opCtx,
                                                  UseJournalListener useListener) {
-    auto journalListener = [&]() -> JournalListener* {
-        // The JournalListener may not be set immediately, so we must check under a mutex so
-        // as not to access the variable while setting a JournalListener. A JournalListener
-        // is only allowed to be set once, so using the pointer outside of a mutex is safe.
-        stdx::unique_lock<stdx::mutex> lk(_journalListenerMutex);
-        return _journalListener;
-    }();
+    // The JournalListener may not be set immediately at startup. It is only allowed to be set
+    // once, so a loaded pointer never dangles and is safe to use without further synchronization.
+    JournalListener* journalListener = _journalListener.load();
     boost::optional<JournalListener::Token> token;
     if (journalListener && useListener == UseJournalListener::kUpdate) {
         // Update a persisted value with the latest write timestamp that is safe across
@@ -2919,6 +2990,20 @@ size_t WiredTigerKVEngine::getCacheSizeMB() const {
     return _cacheSizeMB;
 }
 
+int64_t WiredTigerKVEngine::getCacheDirtyBytes() const {
+    auto session = _connection->getUninterruptibleSession();
+    auto dirtyBytes = WiredTigerUtil::getStatisticsValue(
+        *session, "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_DIRTY_LEAF);
+    if (!dirtyBytes.isOK()) {
+        LOGV2_DEBUG(10470600,
+                    1,
+                    "Unable to gather the WT connection's cache dirty bytes",
+                    "error"_attr = dirtyBytes.getStatus());
+        return 0;
+    }
+    return dirtyBytes.getValue();
+}
+
 BSONObj WiredTigerKVEngine::getSanitizedStorageOptionsForSecondaryReplication(
     const BSONObj& options) const {
 
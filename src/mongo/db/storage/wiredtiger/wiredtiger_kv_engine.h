@@ -536,6 +536,16 @@ public:
 
     size_t getCacheSizeMB() const override;
 
+    int64_t getCacheDirtyBytes() const override;
+
+    /**
+     * Returns the current self-tuned snapshot history window target, in seconds. See
+     * _tunedSnapshotHistoryWindowSeconds().
+     */
+    int getTargetSnapshotHistoryWindowInSeconds() const {
+        return _targetSnapshotHistoryWindowSeconds.load();
+    }
+
     // TODO SERVER-81069: Remove this since it's intrinsically tied to encryption options only.
     BSONObj getSanitizedStorageOptionsForSecondaryReplication(
         const BSONObj& options) const override;
@@ -623,8 +633,8 @@ private:
     std::string _uri(StringData ident) const;
 
     /**
-     * Uses the 'stableTimestamp', the 'minSnapshotHistoryWindowInSeconds' setting and the
-     * current _oldestTimestamp to calculate what the new oldest_timestamp should be, in order to
+     * Uses the 'stableTimestamp', the self-tuned snapshot history window and the current
+     * _oldestTimestamp to calculate what the new oldest_timestamp should be, in order to
      * maintain a window of available snapshots on the storage engine from oldest to stable
      * timestamp.
      *
@@ -632,6 +642,17 @@ private:
      */
     Timestamp _calculateHistoryLagFromStableTimestamp(Timestamp stableTimestamp);
 
+    /**
+     * Returns the snapshot history window target in seconds, re-evaluating the tuning signals
+     * at most once per second. The window grows additively while readers fail with
+     * SnapshotTooOld, holds steady while the oldest active reader is still using the back of
+     * the window, and otherwise decays multiplicatively towards
+     * 'minSnapshotHistoryWindowInSeconds'. History store content crowding the cache forces the
+     * decay regardless of reader activity. The result is clamped between
+     * 'minSnapshotHistoryWindowInSeconds' and 'maxTargetSnapshotHistoryWindowInSeconds'.
+     */
+    int _tunedSnapshotHistoryWindowSeconds();
+
     /**
      * Checks whether rollback to a timestamp can occur, enforcing a contract of use between the
      * storage engine and replication.
@@ -705,6 +726,12 @@ private:
 
     AtomicWord<std::uint64_t> _oplogNeededForCrashRecovery;
 
+    // State for the self-tuning snapshot history window. See
+    // _tunedSnapshotHistoryWindowSeconds().
+    AtomicWord<int> _targetSnapshotHistoryWindowSeconds;
+    AtomicWord<long long> _lastSnapshotWindowEvalMillis{0};
+    AtomicWord<long long> _lastSnapshotTooOldErrorCount{0};
+
     mutable stdx::mutex _oldestTimestampPinRequestsMutex;
     std::map<std::string, Timestamp> _oldestTimestampPinRequests;
 
@@ -728,16 +755,12 @@ private:
     AtomicWord<std::uint64_t> _currentCheckpointIteration{0};
     AtomicWord<std::uint64_t> _finishedCheckpointIteration{0};
 
-    // Protects getting and setting the _journalListener below.
-    stdx::mutex _journalListenerMutex;
-
     // Notified when we commit to the journal.
     //
-    // This variable should be accessed under the _journalListenerMutex above and saved in a local
-    // variable before use. That way, we can avoid holding a mutex across calls on the object. It is
-    // only allowed to be set once, in order to ensure the memory to which a copy of the pointer
-    // points is always valid.
-    JournalListener* _journalListener = nullptr;
+    // The listener is loaded on every journal flush, so it is stored atomically rather than under a
+    // mutex. It is only allowed to be set once, in order to ensure the memory to which a copy of
+    // the pointer points is always valid.
+    AtomicWord<JournalListener*> _journalListener{nullptr};
 
     // Counter and critical section mutex for waitUntilDurable
     AtomicWord<unsigned> _lastSyncTime;
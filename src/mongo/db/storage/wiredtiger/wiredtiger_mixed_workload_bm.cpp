@@ -0,0 +1,332 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * Mixed-workload benchmarks against a real WiredTigerKVEngine, complementing the single-primitive
+ * benchmarks in record_store_bm_cursor.cpp and wiredtiger_begin_transaction_block_bm.cpp. Each
+ * benchmark runs a contention pattern seen in production — batched inserts, point updates racing
+ * with collection scans, and oplog appends racing with tailers — across a configurable number of
+ * threads and with a configurable WiredTiger cache size (the benchmark argument, in MB), and
+ * reports per-thread operation throughput plus p50/p95/p99 operation latency counters.
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <memory>
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/db/concurrency/d_concurrency.h"
+#include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/record_id.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_record_store_test_harness.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/db/transaction_resources.h"
+#include "mongo/logv2/log_domain_global.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/random.h"
+#include "mongo/platform/waitable_atomic.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/util/timer.h"
+
+namespace mongo {
+namespace {
+
+constexpr int64_t kInitialRecords = 10'000;
+constexpr int kInsertBatchSize = 100;
+constexpr int kScanLength = 1'000;
+constexpr size_t kMaxLatencySamples = 1'000'000;
+
+class BM_WiredTigerMixedWorkload : public benchmark::Fixture {
+protected:
+    struct ThreadLocalState {
+        std::unique_ptr<Client, ServiceContext::ClientDeleter> client;
+        std::unique_ptr<OperationContext, ServiceContext::OperationContextDeleter> opCtx;
+        PseudoRandom random{0};
+        std::vector<int64_t> latenciesNanos;
+        int64_t ops = 0;
+        int threadIndex;
+    };
+
+    ThreadLocalState threadLocalSetUp(int threadIndex) {
+        ThreadLocalState tls;
+        tls.threadIndex = threadIndex;
+        tls.random = PseudoRandom(threadIndex);
+        tls.client = _harness->getServiceContext()->getService()->makeClient(
+            fmt::format("thread {}", threadIndex));
+        tls.opCtx = _harness->newOperationContext(tls.client.get());
+        return tls;
+    }
+
+    // Runs 'op' once per benchmark iteration, timing each invocation individually so that tail
+    // latencies remain visible even though google benchmark only reports the mean per iteration.
+    template <typename Op>
+    void runTimed(benchmark::State& state, ThreadLocalState& tls, Op&& op) {
+        for (auto _ : state) {
+            Timer timer;
+            tls.ops += op(tls);
+            if (tls.latenciesNanos.size() < kMaxLatencySamples) {
+                tls.latenciesNanos.push_back(timer.nanos());
+            }
+        }
+        logStats(state, tls);
+    }
+
+    void logStats(benchmark::State& state, ThreadLocalState& tls) {
+        state.counters["ops"] = benchmark::Counter(tls.ops, benchmark::Counter::kIsRate);
+        if (tls.latenciesNanos.empty()) {
+            return;
+        }
+        auto percentile = [&](double p) {
+            auto& samples = tls.latenciesNanos;
+            size_t idx = static_cast<size_t>(p * (samples.size() - 1));
+            std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+            return static_cast<double>(samples[idx]);
+        };
+        // Averaged across threads, so a single slow thread still moves the reported tail.
+        state.counters["p50_ns"] = benchmark::Counter(percentile(.50),
+                                                      benchmark::Counter::kAvgThreads);
+        state.counters["p95_ns"] = benchmark::Counter(percentile(.95),
+                                                      benchmark::Counter::kAvgThreads);
+        state.counters["p99_ns"] = benchmark::Counter(percentile(.99),
+                                                      benchmark::Counter::kAvgThreads);
+    }
+
+    BSONObj makeDocument(ThreadLocalState& tls) {
+        return BSON("tid" << tls.threadIndex << "n" << tls.ops << "padding"
+                          << std::string(200, 'x'));
+    }
+
+    // Inserts one batch of documents in a single transaction. Returns the batch size.
+    int64_t insertBatch(ThreadLocalState& tls) {
+        while (true) {
+            try {
+                Lock::GlobalLock lk(tls.opCtx.get(), MODE_IX);
+                WriteUnitOfWork wuow(tls.opCtx.get());
+                for (int i = 0; i < kInsertBatchSize; ++i) {
+                    auto doc = makeDocument(tls);
+                    ASSERT_OK(_records
+                                  ->insertRecord(
+                                      tls.opCtx.get(), doc.objdata(), doc.objsize(), Timestamp())
+                                  .getStatus());
+                }
+                wuow.commit();
+                return kInsertBatchSize;
+            } catch (const WriteConflictException&) {
+            }
+        }
+    }
+
+    // Updates one randomly chosen preloaded record, retrying on write conflict.
+    int64_t pointUpdate(ThreadLocalState& tls) {
+        RecordId rid(1 + tls.random.nextInt64(kInitialRecords));
+        auto doc = makeDocument(tls);
+        while (true) {
+            try {
+                Lock::GlobalLock lk(tls.opCtx.get(), MODE_IX);
+                WriteUnitOfWork wuow(tls.opCtx.get());
+                ASSERT_OK(
+                    _records->updateRecord(tls.opCtx.get(), rid, doc.objdata(), doc.objsize()));
+                wuow.commit();
+                return 1;
+            } catch (const WriteConflictException&) {
+            }
+        }
+    }
+
+    // Scans a chunk of the collection from a random starting point.
+    int64_t scanChunk(ThreadLocalState& tls) {
+        RecordId start(1 + tls.random.nextInt64(kInitialRecords));
+        Lock::GlobalLock lk(tls.opCtx.get(), MODE_IS);
+        auto cursor = _records->getCursor(tls.opCtx.get(), /*forward=*/true);
+        int64_t seen = 0;
+        for (auto record = cursor->seek(start, SeekableRecordCursor::BoundInclusion::kInclude);
+             record && seen < kScanLength;
+             record = cursor->next()) {
+            benchmark::DoNotOptimize(record->data.data());
+            ++seen;
+        }
+        shard_role_details::getRecoveryUnit(tls.opCtx.get())->abandonSnapshot();
+        return seen;
+    }
+
+    // Appends one entry to the oplog at a globally increasing timestamp.
+    int64_t oplogAppend(ThreadLocalState& tls) {
+        auto n = _nextOplogSlot.fetchAndAdd(1);
+        Timestamp opTime(2 + (n >> 31), 1 + (n & 0x7fffffff));
+        BSONObj entry = BSON("ts" << opTime << "o" << makeDocument(tls));
+        while (true) {
+            try {
+                Lock::GlobalLock lk(tls.opCtx.get(), MODE_IX);
+                WriteUnitOfWork wuow(tls.opCtx.get());
+                ASSERT_OK(_harness->getEngine()->oplogDiskLocRegister(
+                    *shard_role_details::getRecoveryUnit(tls.opCtx.get()),
+                    _oplog.get(),
+                    opTime,
+                    false));
+                ASSERT_OK(
+                    _oplog->insertRecord(tls.opCtx.get(), entry.objdata(), entry.objsize(), opTime)
+                        .getStatus());
+                wuow.commit();
+                return 1;
+            } catch (const WriteConflictException&) {
+            }
+        }
+    }
+
+    // Drains all oplog entries that became visible past the tailer's last seen position,
+    // mimicking one getMore of a tailable oplog cursor.
+    int64_t oplogTail(ThreadLocalState& tls, RecordId* lastSeen) {
+        Lock::GlobalLock lk(tls.opCtx.get(), MODE_IS);
+        auto cursor = _oplog->getCursor(tls.opCtx.get(), /*forward=*/true);
+        int64_t seen = 0;
+        auto record = lastSeen->isNull()
+            ? cursor->next()
+            : cursor->seek(*lastSeen, SeekableRecordCursor::BoundInclusion::kExclude);
+        for (; record; record = cursor->next()) {
+            benchmark::DoNotOptimize(record->data.data());
+            *lastSeen = record->id;
+            ++seen;
+        }
+        shard_role_details::getRecoveryUnit(tls.opCtx.get())->abandonSnapshot();
+        return seen;
+    }
+
+private:
+    void SetUp(benchmark::State& state) override {
+        if (state.thread_index != 0) {
+            _threads.wait(0);
+            return;
+        }
+
+        {
+            auto& lv2Manager = logv2::LogManager::global();
+            logv2::LogDomainGlobal::ConfigurationOptions lv2Config;
+            lv2Config.makeDisabled();
+            uassertStatusOK(lv2Manager.getGlobalDomainInternal().configure(lv2Config));
+        }
+
+        // state.range(0) is the WiredTiger cache size in MB; the extra open option overrides the
+        // harness default.
+        _harness = std::make_unique<WiredTigerHarnessHelper>(
+            StringData(fmt::format("cache_size={}M", state.range(0))));
+        _records = _harness->newRecordStore("test.workload");
+        _oplog = _harness->newOplogRecordStore();
+
+        auto tls = threadLocalSetUp(-1);
+        for (int64_t inserted = 0; inserted < kInitialRecords; inserted += kInsertBatchSize) {
+            insertBatch(tls);
+        }
+        oplogAppend(tls);
+
+        _threads.store(state.threads);
+        _threads.notifyAll();
+    }
+
+    void TearDown(benchmark::State& state) override {
+        if (state.thread_index != 0) {
+            if (_threads.subtractAndFetch(1) == 1) {
+                _threads.notifyAll();
+            }
+            return;
+        }
+
+        for (int count = _threads.load(); count > 1; count = _threads.load()) {
+            _threads.wait(count);
+        }
+
+        _oplog.reset();
+        _records.reset();
+        _harness.reset();
+        _threads.store(0);
+        _nextOplogSlot.store(0);
+    }
+
+    WaitableAtomic<int> _threads{0};
+    AtomicWord<uint64_t> _nextOplogSlot{0};
+    std::unique_ptr<WiredTigerHarnessHelper> _harness;
+    std::unique_ptr<RecordStore> _records;
+    std::unique_ptr<RecordStore> _oplog;
+};
+
+BENCHMARK_DEFINE_F(BM_WiredTigerMixedWorkload, BatchedInserts)(benchmark::State& state) {
+    auto tls = threadLocalSetUp(state.thread_index);
+    runTimed(state, tls, [&](ThreadLocalState& t) { return insertBatch(t); });
+}
+BENCHMARK_REGISTER_F(BM_WiredTigerMixedWorkload, BatchedInserts)
+    ->ArgName("cacheMB")
+    ->Arg(16)
+    ->Arg(256)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16);
+
+BENCHMARK_DEFINE_F(BM_WiredTigerMixedWorkload, PointUpdatesWithConcurrentScans)
+(benchmark::State& state) {
+    auto tls = threadLocalSetUp(state.thread_index);
+    // Every fourth thread scans; the rest do point updates against the same records.
+    if (state.thread_index % 4 == 3) {
+        runTimed(state, tls, [&](ThreadLocalState& t) { return scanChunk(t); });
+    } else {
+        runTimed(state, tls, [&](ThreadLocalState& t) { return pointUpdate(t); });
+    }
+}
+BENCHMARK_REGISTER_F(BM_WiredTigerMixedWorkload, PointUpdatesWithConcurrentScans)
+    ->ArgName("cacheMB")
+    ->Arg(16)
+    ->Arg(256)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(64);
+
+BENCHMARK_DEFINE_F(BM_WiredTigerMixedWorkload, OplogAppendsWithTailers)(benchmark::State& state) {
+    auto tls = threadLocalSetUp(state.thread_index);
+    // Odd threads tail the oplog while even threads append to it.
+    if (state.thread_index % 2 == 1) {
+        RecordId lastSeen;
+        runTimed(state, tls, [&](ThreadLocalState& t) { return oplogTail(t, &lastSeen); });
+    } else {
+        runTimed(state, tls, [&](ThreadLocalState& t) { return oplogAppend(t); });
+    }
+}
+BENCHMARK_REGISTER_F(BM_WiredTigerMixedWorkload, OplogAppendsWithTailers)
+    ->ArgName("cacheMB")
+    ->Arg(16)
+    ->Arg(256)
+    ->Threads(2)
+    ->Threads(8)
+    ->Threads(32);
+
+}  // namespace
+}  // namespace mongo
@@ -44,8 +44,8 @@
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
-#include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
@@ -82,38 +82,40 @@ void WiredTigerOplogManager::initialize(OperationContext* opCtx, RecordStore* op
 
 void WiredTigerOplogManager::triggerOplogVisibilityUpdate(KVEngine* engine,
                                                           Timestamp commitTimestamp) {
-    {
-        stdx::lock_guard<stdx::mutex> lk(_oplogVisibilityStateMutex);
-
-        // Do nothing if the visibility timestamp has already been advanced to the last committed
-        // timestamp.
-        const auto currentVisibleTimestamp = _oplogReadTimestamp.load();
-        if (currentVisibleTimestamp >= commitTimestamp.asULL()) {
-            return;
-        }
-
-        // Fetch the all_durable timestamp from the storage engine, which is guaranteed not to have
-        // any holes behind it in-memory.
-        const uint64_t newTimestamp = engine->getAllDurableTimestamp().asULL();
+    // Do nothing if the visibility timestamp has already been advanced to the last committed
+    // timestamp.
+    auto currentVisibleTimestamp = _oplogReadTimestamp.load();
+    if (currentVisibleTimestamp >= commitTimestamp.asULL()) {
+        return;
+    }
 
-        // The newTimestamp may actually go backward during secondary batch application,
-        // where we commit data file changes separately from oplog changes, so ignore
-        // a non-incrementing timestamp.
-        if (newTimestamp <= currentVisibleTimestamp) {
-            LOGV2_DEBUG(22373,
+    // Fetch the all_durable timestamp from the storage engine, which is guaranteed not to have
+    // any holes behind it in-memory.
+    const uint64_t newTimestamp = engine->getAllDurableTimestamp().asULL();
+
+    // Publish the new timestamp with a CAS loop so that concurrent updates never move the
+    // visibility point backward. The newTimestamp may actually go backward during secondary batch
+    // application, where we commit data file changes separately from oplog changes, so ignore a
+    // non-incrementing timestamp.
+    while (newTimestamp > currentVisibleTimestamp) {
+        if (_oplogReadTimestamp.compareAndSwap(&currentVisibleTimestamp, newTimestamp)) {
+            _oplogReadTimestamp.notifyAll();
+            LOGV2_DEBUG(10470602,
                         2,
-                        "No new oplog entries became visible.",
-                        "aNoHolesOplogTimestamp"_attr = Timestamp(newTimestamp));
+                        "Updating the oplogReadTimestamp.",
+                        "newOplogReadTimestamp"_attr = Timestamp(newTimestamp));
+
+            if (_oplogRecordStore) {
+                _oplogRecordStore->capped()->notifyWaitersIfNeeded(Timestamp(newTimestamp));
+            }
             return;
         }
-
-        // Publish the new timestamp value. Avoid going backward.
-        _setOplogReadTimestamp(lk, newTimestamp);
     }
 
-    if (_oplogRecordStore) {
-        _oplogRecordStore->capped()->notifyWaitersIfNeeded();
-    }
+    LOGV2_DEBUG(22373,
+                2,
+                "No new oplog entries became visible.",
+                "aNoHolesOplogTimestamp"_attr = Timestamp(newTimestamp));
 }
 
 void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
@@ -140,12 +142,15 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     // Close transaction before we wait.
     shard_role_details::getRecoveryUnit(opCtx)->abandonSnapshot();
 
-    stdx::unique_lock<stdx::mutex> lk(_oplogVisibilityStateMutex);
-
     // Out of order writes to the oplog always call triggerOplogVisibilityUpdate() on commit to
     // run and update the oplog visibility. We simply need to wait until all of the writes behind
-    // and including 'waitingFor' commit so there are no oplog holes.
-    opCtx->waitForConditionOrInterrupt(_oplogEntriesBecameVisibleCV, lk, [&] {
+    // and including 'waitingFor' commit so there are no oplog holes. We wait on the published
+    // timestamp itself rather than on a mutex and condition variable so that concurrent waiters
+    // do not serialize with every oplog commit; the wait is chunked to remain responsive to
+    // interrupts.
+    while (true) {
+        opCtx->checkForInterrupt();
+
         auto newLatestVisibleTimestamp = getOplogReadTimestamp();
         if (newLatestVisibleTimestamp < currentLatestVisibleTimestamp) {
             LOGV2_DEBUG(22370,
@@ -157,20 +162,22 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
                         "previouslyFoundLatestVisibleOplogEntryTimestamp"_attr =
                             Timestamp(currentLatestVisibleTimestamp));
             // We cannot wait for a write that no longer exists, so we are finished.
-            return true;
+            return;
         }
         currentLatestVisibleTimestamp = newLatestVisibleTimestamp;
         RecordId newLatestVisible = RecordId(currentLatestVisibleTimestamp);
-        if (newLatestVisible < waitingFor) {
-            LOGV2_DEBUG(22371,
-                        2,
-                        "Operation is waiting for an entry to become visible in the oplog.",
-                        "awaitedOplogEntryTimestamp"_attr = Timestamp(waitingFor.getLong()),
-                        "currentLatestVisibleOplogEntryTimestamp"_attr =
-                            Timestamp(currentLatestVisibleTimestamp));
+        if (newLatestVisible >= waitingFor) {
+            return;
         }
-        return newLatestVisible >= waitingFor;
-    });
+        LOGV2_DEBUG(22371,
+                    2,
+                    "Operation is waiting for an entry to become visible in the oplog.",
+                    "awaitedOplogEntryTimestamp"_attr = Timestamp(waitingFor.getLong()),
+                    "currentLatestVisibleOplogEntryTimestamp"_attr =
+                        Timestamp(currentLatestVisibleTimestamp));
+
+        _oplogReadTimestamp.waitFor(currentLatestVisibleTimestamp, Milliseconds(500));
+    }
 }
 
 std::uint64_t WiredTigerOplogManager::getOplogReadTimestamp() const {
@@ -178,13 +185,12 @@ std::uint64_t WiredTigerOplogManager::getOplogReadTimestamp() const {
 }
 
 void WiredTigerOplogManager::setOplogReadTimestamp(Timestamp ts) {
-    stdx::lock_guard<stdx::mutex> lk(_oplogVisibilityStateMutex);
-    _setOplogReadTimestamp(lk, ts.asULL());
+    _setOplogReadTimestamp(ts.asULL());
 }
 
-void WiredTigerOplogManager::_setOplogReadTimestamp(WithLock, uint64_t newTimestamp) {
+void WiredTigerOplogManager::_setOplogReadTimestamp(uint64_t newTimestamp) {
     _oplogReadTimestamp.store(newTimestamp);
-    _oplogEntriesBecameVisibleCV.notify_all();
+    _oplogReadTimestamp.notifyAll();
     LOGV2_DEBUG(22374,
                 2,
                 "Updating the oplogReadTimestamp.",
@@ -33,10 +33,7 @@
 
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/operation_context.h"
-#include "mongo/platform/atomic_word.h"
-#include "mongo/stdx/condition_variable.h"
-#include "mongo/stdx/mutex.h"
-#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/platform/waitable_atomic.h"
 
 namespace mongo {
 
@@ -107,16 +104,14 @@ public:
     StringData getIdent() const;
 
 private:
-    void _setOplogReadTimestamp(WithLock, uint64_t newTimestamp);
+    void _setOplogReadTimestamp(uint64_t newTimestamp);
 
-    AtomicWord<unsigned long long> _oplogReadTimestamp{0};
+    // The oplog read timestamp is published lock-free: committers advance it with a CAS and
+    // waiters block on the atomic itself. This keeps concurrent oplog commits and the many
+    // tailing cursors waiting on visibility from serializing on a mutex, and notification is
+    // cheap when there are no waiters.
+    WaitableAtomic<unsigned long long> _oplogReadTimestamp{0};
 
     RecordStore* _oplogRecordStore = nullptr;
-
-    // Signaled when oplog visibility has been updated.
-    mutable stdx::condition_variable _oplogEntriesBecameVisibleCV;
-
-    // Protects the state below.
-    mutable stdx::mutex _oplogVisibilityStateMutex;
 };
 }  // namespace mongo
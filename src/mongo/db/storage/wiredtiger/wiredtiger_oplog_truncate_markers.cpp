@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/db/repl/oplog_entry.h"
@@ -203,6 +204,20 @@ bool WiredTigerOplogTruncateMarkers::awaitHasExcessMarkersOrDead(OperationContex
     return !(_isDead || !isWaitConditionSatisfied);
 }
 
+int64_t WiredTigerOplogTruncateMarkers::excessBytes() const {
+    int64_t totalBytes =
+        checkMarkersWith([](const std::deque<CollectionTruncateMarkers::Marker>& markers) {
+            int64_t bytes = 0;
+            for (const auto& marker : markers) {
+                bytes += marker.bytes;
+            }
+            return bytes;
+        });
+
+    int64_t maxSize = checked_cast<WiredTigerRecordStore::Oplog*>(_rs->oplog())->getMaxSize();
+    return std::max<int64_t>(totalBytes - maxSize, 0);
+}
+
 bool WiredTigerOplogTruncateMarkers::_hasExcessMarkers(OperationContext* opCtx) const {
     int64_t totalBytes = 0;
     for (const auto& marker : getMarkers()) {
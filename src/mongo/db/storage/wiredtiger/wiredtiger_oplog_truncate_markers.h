@@ -75,6 +75,11 @@ public:
      */
     bool awaitHasExcessMarkersOrDead(OperationContext* opCtx) override;
 
+    /**
+     * Returns the number of bytes of whole truncate markers beyond the oplog's maximum size.
+     */
+    int64_t excessBytes() const override;
+
     // Clears all the markers of the instance whenever the current WUOW commits.
     void clearMarkersOnCommit(OperationContext* opCtx);
 
@@ -637,24 +637,19 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
     auto nRecords = records->size();
     invariant(nRecords != 0);
 
+    // Some RecordStores, like TemporaryRecordStores, may want to set their own RecordIds.
+    const bool areRecordIdsProvided = !records->front().id.isNull();
+
+    // Non-clustered record stores generate unique int64_t RecordIds from a block reserved up
+    // front if RecordIds are not set; the ids are assigned inline in the insert loop below.
+    long long nextId = 0;
     if (_keyFormat == KeyFormat::Long) {
-        bool areRecordIdsProvided = !records->front().id.isNull();
-        RecordId highestRecordIdProvided;
-
-        long long nextId = areRecordIdsProvided ? 0 : _reserveIdBlock(opCtx, nRecords);
-
-        // Non-clustered record stores will extract the RecordId key for the oplog and generate
-        // unique int64_t RecordIds if RecordIds are not set.
-        for (size_t i = 0; i < nRecords; i++) {
-            auto& record = (*records)[i];
-            // Some RecordStores, like TemporaryRecordStores, may want to set their own RecordIds.
-            if (!areRecordIdsProvided) {
-                // Since a recordId wasn't provided for the first record, the recordId shouldn't
-                // have been provided for any record.
-                invariant(record.id.isNull());
-                record.id = RecordId(nextId++);
-                invariant(record.id.isValid());
-            } else {
+        if (!areRecordIdsProvided) {
+            nextId = _reserveIdBlock(opCtx, nRecords);
+        } else {
+            RecordId highestRecordIdProvided;
+            for (size_t i = 0; i < nRecords; i++) {
+                auto& record = (*records)[i];
                 // Since a recordId was provided for the first record, the recordId should have been
                 // provided for all records.
                 invariant(!record.id.isNull());
@@ -662,13 +657,11 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
                     highestRecordIdProvided = record.id;
                 }
             }
-        }
 
-        // Update the highest recordId we've seen so far on this record store, in case
-        // any of the inserts we are performing has a higher recordId.
-        // We only have to do this when the records we are inserting were accompanied
-        // by caller provided recordIds.
-        if (areRecordIdsProvided) {
+            // Update the highest recordId we've seen so far on this record store, in case
+            // any of the inserts we are performing has a higher recordId. This must happen
+            // before the inserts so that concurrent id reservations do not hand out one of the
+            // provided ids.
             _updateLargestRecordId(opCtx, highestRecordIdProvided.getLong());
         }
     }
@@ -678,6 +671,13 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
     int64_t totalLength = 0;
     for (size_t i = 0; i < nRecords; i++) {
         auto& record = (*records)[i];
+        if (_keyFormat == KeyFormat::Long && !areRecordIdsProvided) {
+            // Since a recordId wasn't provided for the first record, the recordId shouldn't
+            // have been provided for any record.
+            invariant(record.id.isNull());
+            record.id = RecordId(nextId++);
+            invariant(record.id.isValid());
+        }
         totalLength += record.data.size();
         invariant(!record.id.isNull());
         invariant(!record_id_helpers::isReserved(record.id));
@@ -156,9 +156,12 @@ void WiredTigerRecoveryUnit::prepareUnitOfWork() {
                 "preparing transaction at time: {prepareTimestamp}",
                 "prepareTimestamp"_attr = _prepareTimestamp);
 
-    const std::string conf = "prepare_timestamp=" + unsignedHex(_prepareTimestamp.asULL());
-    // Prepare the transaction.
-    invariantWTOK(session->prepare_transaction(conf.c_str()), *session);
+    // Set the prepare timestamp through the integer timestamp API rather than formatting it into a
+    // config string; this keeps string rendering off the prepare path entirely.
+    invariantWTOK(
+        session->timestamp_transaction_uint(WT_TS_TXN_TYPE_PREPARE, _prepareTimestamp.asULL()),
+        *session);
+    invariantWTOK(session->prepare_transaction(nullptr), *session);
 }
 
 void WiredTigerRecoveryUnit::doCommitUnitOfWork() {
@@ -36,6 +36,7 @@
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/storage_engine.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_connection.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_server_status.h"
@@ -53,6 +54,14 @@ bool WiredTigerServerStatusSection::includeByDefault() const {
     return true;
 }
 
+Milliseconds WiredTigerServerStatusSection::cachePeriod() const {
+    // Collecting connection statistics takes milliseconds while holding engine resources, and
+    // every monitoring poller pays it. One second matches the highest poll rate we care about
+    // (FTDC and typical monitoring), so concurrent pollers share a single collection per second,
+    // refreshed off-thread.
+    return Milliseconds{Seconds{1}};
+}
+
 BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                                                        const BSONElement& configElement) const {
     WiredTigerKVEngine* engine = checked_cast<WiredTigerKVEngine*>(
@@ -71,6 +80,8 @@ BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                           Timestamp(engine->getOplogManager()->getOplogReadTimestamp()));
     }
 
+    engine->getConnection().appendSessionCacheStats(bob);
+
     return bob.obj();
 }
 
@@ -45,6 +45,7 @@ class WiredTigerServerStatusSection : public ServerStatusSection {
 public:
     using ServerStatusSection::ServerStatusSection;
     bool includeByDefault() const override;
+    Milliseconds cachePeriod() const override;
     BSONObj generateSection(OperationContext* opCtx,
                             const BSONElement& configElement) const override;
 };
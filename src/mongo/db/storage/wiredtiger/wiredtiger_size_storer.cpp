@@ -30,6 +30,7 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/meta/type_traits.h>
+#include <boost/optional/optional.hpp>
 #include <wiredtiger.h>
 
 #include "mongo/bson/bsonelement.h"
@@ -65,14 +66,19 @@ WiredTigerSizeStorer::WiredTigerSizeStorer(WiredTigerConnection* conn,
     invariantWTOK(session.create(_storageUri.c_str(), config.c_str()), session);
 }
 
+WiredTigerSizeStorer::BufferShard& WiredTigerSizeStorer::_getShard(StringData uri) const {
+    return _bufferShards[StringMapHasher{}(uri) % kBufferShards];
+}
+
 void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeInfo) {
     // If the SizeInfo is still dirty, we're done.
     if (sizeInfo->_dirty.load())
         return;
 
     // Ordering is important: as the entry may be flushed concurrently, set the dirty flag last.
-    stdx::lock_guard<stdx::mutex> lk(_bufferMutex);
-    auto& entry = _buffer[uri];
+    auto& shard = _getShard(uri);
+    stdx::lock_guard<stdx::mutex> lk(shard.mutex);
+    auto& entry = shard.buffer[uri];
     // During rollback it is possible to get a new SizeInfo. In that case clear the dirty flag,
     // so the SizeInfo can be destructed without triggering the dirty check invariant.
     if (entry && entry.get() != sizeInfo.get())
@@ -91,9 +97,10 @@ void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeI
 std::shared_ptr<WiredTigerSizeStorer::SizeInfo> WiredTigerSizeStorer::load(StringData uri) const {
     {
         // Check if we can satisfy the read from the buffer.
-        stdx::lock_guard<stdx::mutex> bufferLock(_bufferMutex);
-        Buffer::const_iterator it = _buffer.find(uri);
-        if (it != _buffer.end())
+        auto& shard = _getShard(uri);
+        stdx::lock_guard<stdx::mutex> bufferLock(shard.mutex);
+        Buffer::const_iterator it = shard.buffer.find(uri);
+        if (it != shard.buffer.end())
             return it->second ? it->second : std::make_shared<SizeInfo>();
     }
 
@@ -120,46 +127,58 @@ std::shared_ptr<WiredTigerSizeStorer::SizeInfo> WiredTigerSizeStorer::load(Strin
 }
 
 void WiredTigerSizeStorer::remove(StringData uri) {
-    stdx::lock_guard<stdx::mutex> bufferLock{_bufferMutex};
+    auto& shard = _getShard(uri);
+    stdx::lock_guard<stdx::mutex> bufferLock{shard.mutex};
 
     // Insert a new nullptr entry into the buffer, or set the existing one to nullptr if there
     // already is one.
-    if (auto& sizeInfo = _buffer[uri]) {
+    if (auto& sizeInfo = shard.buffer[uri]) {
         sizeInfo->_dirty.store(false);
         sizeInfo.reset();
     }
 }
 
 void WiredTigerSizeStorer::flush(bool syncToDisk) {
-    Buffer buffer;
-    {
-        stdx::lock_guard<stdx::mutex> bufferLock(_bufferMutex);
-        _buffer.swap(buffer);
-    }
-
-    if (buffer.empty())
-        return;  // Nothing to do.
-
     Timer t;
+    bool flushedAnything = false;
 
     // We serialize flushing to disk to avoid running into write conflicts from having multiple
     // threads try to flush at the same time.
     stdx::lock_guard<stdx::mutex> flushLock(_flushMutex);
 
+    // The session is created lazily so that flushing is free when no shard has buffered changes.
     // When the session is destructed, it closes any cursors that remain open.
-    WiredTigerSession session(_conn);
-    WT_CURSOR* cursor = session.getNewCursor(_storageUri, "overwrite=true");
+    boost::optional<WiredTigerSession> session;
+    WT_CURSOR* cursor = nullptr;
+
+    for (auto& shard : _bufferShards) {
+        Buffer buffer;
+        {
+            stdx::lock_guard<stdx::mutex> bufferLock(shard.mutex);
+            shard.buffer.swap(buffer);
+        }
 
-    {
-        // On failure, place entries back into the map, unless a newer value already exists.
-        ON_BLOCK_EXIT([this, &buffer]() {
+        if (buffer.empty())
+            continue;  // Nothing to do for this shard.
+        flushedAnything = true;
+
+        if (!session) {
+            session.emplace(_conn);
+            cursor = session->getNewCursor(_storageUri, "overwrite=true");
+        }
+
+        // On failure, place entries back into the shard, unless a newer value already exists.
+        ON_BLOCK_EXIT([&shard, &buffer]() {
             if (!buffer.empty()) {
-                stdx::lock_guard<stdx::mutex> bufferLock(this->_bufferMutex);
+                stdx::lock_guard<stdx::mutex> bufferLock(shard.mutex);
                 for (auto& it : buffer)
-                    this->_buffer.try_emplace(it.first, it.second);
+                    shard.buffer.try_emplace(it.first, it.second);
             }
         });
 
+        // Each dirty shard is written in its own transaction, so a rollback only puts that shard's
+        // entries back into the buffer.
+        //
         // To avoid deadlocks with cache eviction, allow the transaction to time itself out. Once
         // the time limit has been exceeded on an operation in this transaction, WiredTiger returns
         // WT_ROLLBACK for that operation.
@@ -167,7 +186,7 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
         if (syncToDisk) {
             txnConfig += ",sync=true";
         }
-        WiredTigerBeginTxnBlock txnOpen(&session, txnConfig.c_str());
+        WiredTigerBeginTxnBlock txnOpen(&*session, txnConfig.c_str());
 
         for (auto&& [uri, sizeInfo] : buffer) {
             WiredTigerItem key(uri.c_str(), uri.size());
@@ -212,13 +231,15 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
             invariantWTOK(ret, cursor->session);
         }
         txnOpen.done();
-        invariantWTOK(session.commit_transaction(nullptr), session);
+        invariantWTOK(session->commit_transaction(nullptr), *session);
         buffer.clear();
     }
 
-    LOGV2_DEBUG(22426,
-                2,
-                "WiredTigerSizeStorer::flush completed",
-                "duration"_attr = Microseconds{t.micros()});
+    if (flushedAnything) {
+        LOGV2_DEBUG(22426,
+                    2,
+                    "WiredTigerSizeStorer::flush completed",
+                    "duration"_attr = Microseconds{t.micros()});
+    }
 }
 }  // namespace mongo
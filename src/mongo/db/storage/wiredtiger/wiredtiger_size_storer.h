@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -114,7 +115,16 @@ private:
 
     using Buffer = StringMap<std::shared_ptr<SizeInfo>>;
 
-    mutable stdx::mutex _bufferMutex;  // Guards _buffer
-    Buffer _buffer;
+    // The buffer is sharded by uri hash so that concurrent writers to different collections do not
+    // contend on a single mutex. Flushes only visit shards that have buffered changes.
+    struct BufferShard {
+        mutable stdx::mutex mutex;  // Guards buffer
+        Buffer buffer;
+    };
+    static constexpr size_t kBufferShards = 16;
+
+    BufferShard& _getShard(StringData uri) const;
+
+    mutable std::array<BufferShard, kBufferShards> _bufferShards;
 };
 }  // namespace mongo
@@ -157,6 +157,27 @@ TEST_F(WiredTigerSizeStorerTest, RemoveAfterFlush) {
     ASSERT_EQ(loaded->dataSize.load(), 0);
 }
 
+TEST_F(WiredTigerSizeStorerTest, StoreManyUris) {
+    auto sizeStorer = makeSizeStorer();
+
+    // Use enough distinct uris that every buffer shard sees at least one entry with high
+    // probability, so a single flush has to visit multiple shards.
+    constexpr int kNumUris = 100;
+    for (int i = 0; i < kNumUris; ++i) {
+        sizeStorer.store("uri" + std::to_string(i),
+                         std::make_shared<WiredTigerSizeStorer::SizeInfo>(i, 10 * i));
+    }
+
+    sizeStorer.flush(false);
+
+    for (int i = 0; i < kNumUris; ++i) {
+        auto loaded = sizeStorer.load("uri" + std::to_string(i));
+        ASSERT(loaded);
+        ASSERT_EQ(loaded->numRecords.load(), i);
+        ASSERT_EQ(loaded->dataSize.load(), 10 * i);
+    }
+}
+
 TEST_F(WiredTigerSizeStorerTest, RemoveNonexistent) {
     auto sizeStorer = makeSizeStorer();
     auto sizeInfo = std::make_shared<WiredTigerSizeStorer::SizeInfo>(1, 10);
@@ -1146,6 +1146,8 @@ void WiredTigerUtil::appendSnapshotWindowSettings(WiredTigerKVEngine* engine, BS
     settings.append("total number of SnapshotTooOld errors", totalNumberOfSnapshotTooOldErrors);
     settings.append("minimum target snapshot window size in seconds",
                     minSnapshotHistoryWindowInSeconds.load());
+    settings.append("target snapshot window size in seconds",
+                    engine->getTargetSnapshotHistoryWindowInSeconds());
     settings.append("current available snapshot window size in seconds",
                     static_cast<int>(currentAvailableSnapshotWindow));
     settings.append("latest majority snapshot timestamp available",
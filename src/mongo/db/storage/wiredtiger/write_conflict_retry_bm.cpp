@@ -171,6 +171,30 @@ BENCHMARK_REGISTER_F(BM_WriteConflict, WriteConflictRetry)
     ->Threads(64)
     ->Threads(128);
 
+BENCHMARK_DEFINE_F(BM_WriteConflict, WriteConflictRetryWithStatus)(benchmark::State& state) {
+    auto tls = threadLocalSetUp(state.thread_index);
+    for (auto _ : state) {
+        ASSERT_OK(writeConflictRetryWithStatus(
+            tls.opCtx.get(), "test", NamespaceString(), [&]() -> Status {
+                // Catch conflicts at the storage boundary and propagate them by status, so only
+                // one frame is unwound per conflict instead of the whole retry loop.
+                try {
+                    attemptWrite(tls);
+                    return Status::OK();
+                } catch (const StorageUnavailableException& e) {
+                    return e.toStatus();
+                }
+            }));
+    }
+    logStats(state, tls);
+}
+BENCHMARK_REGISTER_F(BM_WriteConflict, WriteConflictRetryWithStatus)
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(16)
+    ->Threads(64)
+    ->Threads(128);
+
 BENCHMARK_DEFINE_F(BM_WriteConflict, NoBackoff)(benchmark::State& state) {
     test(
         state,
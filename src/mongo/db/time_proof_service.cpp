@@ -27,13 +27,13 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <array>
-#include <boost/none.hpp>
 #include <cstdint>
 #include <mutex>
+#include <utility>
 
 #include <boost/move/utility_core.hpp>
-#include <boost/optional/optional.hpp>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status.h"
@@ -61,18 +61,30 @@ TimeProofService::Key TimeProofService::generateRandomKey() {
 TimeProofService::TimeProof TimeProofService::getProof(LogicalTime time, const Key& key) {
     stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
     auto timeCeil = LogicalTime(Timestamp(time.asTimestamp().asULL() | kRangeMask));
-    if (_cache && _cache->hasProof(timeCeil, key)) {
-        return _cache->_proof;
+    for (auto& entry : _cache) {
+        if (entry.hasProof(timeCeil, key)) {
+            entry._lastUsed = ++_cacheUseCounter;
+            return entry._proof;
+        }
     }
 
     auto unsignedTimeArray = timeCeil.toUnsignedArray();
-    // update cache
-    _cache =
-        CacheEntry(SHA1Block::computeHmac(
-                       key.data(), key.size(), unsignedTimeArray.data(), unsignedTimeArray.size()),
-                   timeCeil,
-                   key);
-    return _cache->_proof;
+    auto proof = SHA1Block::computeHmac(
+        key.data(), key.size(), unsignedTimeArray.data(), unsignedTimeArray.size());
+    CacheEntry newEntry(std::move(proof), timeCeil, key);
+    newEntry._lastUsed = ++_cacheUseCounter;
+
+    // Update the cache, evicting the least recently used entry if it is full.
+    if (_cache.size() < kMaxCacheSize) {
+        _cache.push_back(std::move(newEntry));
+        return _cache.back()._proof;
+    }
+
+    auto lruIt = std::min_element(_cache.begin(), _cache.end(), [](auto&& a, auto&& b) {
+        return a._lastUsed < b._lastUsed;
+    });
+    *lruIt = std::move(newEntry);
+    return lruIt->_proof;
 }
 
 Status TimeProofService::checkProof(LogicalTime time, const TimeProof& proof, const Key& key) {
@@ -85,9 +97,7 @@ Status TimeProofService::checkProof(LogicalTime time, const TimeProof& proof, co
 
 void TimeProofService::resetCache() {
     stdx::lock_guard<stdx::mutex> lk(_cacheMutex);
-    if (_cache) {
-        _cache = boost::none;
-    }
+    _cache.clear();
 }
 
 }  // namespace mongo
@@ -30,8 +30,10 @@
 #pragma once
 
 #include <boost/move/utility_core.hpp>
-#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/crypto/hash_block.h"
@@ -76,7 +78,8 @@ public:
 
 private:
     /**
-     * Nested class to cache TimeProof. It holds proof for the greatest time allowed.
+     * Nested class to cache TimeProof. It holds the proof for the ceiling of a time range under a
+     * specific key.
      */
     struct CacheEntry {
         CacheEntry(TimeProof proof, LogicalTime time, const Key& key)
@@ -92,13 +95,22 @@ private:
         TimeProof _proof;
         LogicalTime _time;
         Key _key;
+        uint64_t _lastUsed{0};
     };
 
-    // protects _cache
+    // Bounds the number of cached proofs. Multiple entries are kept so that proofs computed under
+    // several keys at once (e.g. while signing keys overlap during a rotation) or for interleaved
+    // time ranges do not evict each other on every message.
+    static constexpr size_t kMaxCacheSize = 8;
+
+    // protects the fields below
     stdx::mutex _cacheMutex;
 
-    // one-entry cache
-    boost::optional<CacheEntry> _cache;
+    // Cached proofs; the least recently used entry is evicted once the cache is full.
+    std::vector<CacheEntry> _cache;
+
+    // Monotonic counter used to track which cache entry was least recently used.
+    uint64_t _cacheUseCounter{0};
 };
 
 }  // namespace mongo
@@ -27,6 +27,9 @@
  *    it in the license file.
  */
 
+#include <cstdint>
+#include <vector>
+
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/timestamp.h"
@@ -83,5 +86,36 @@ TEST(TimeProofService, VerifyLogicalTimeProofCache) {
     ASSERT_EQUALS(ErrorCodes::TimeProofMismatch, timeProofService.checkProof(time3, proof2, key));
 }
 
+// Proofs computed under several keys at once must not evict each other, and eviction must never
+// surface a proof computed for a different key or time range.
+TEST(TimeProofService, VerifyLogicalTimeProofCacheWithMultipleKeys) {
+    TimeProofService timeProofService;
+
+    const TimeProofService::Key otherKey = {{1}};
+
+    LogicalTime time(Timestamp(0x1111'2222'3333'0001));
+    TimeProof proof = timeProofService.getProof(time, key);
+    TimeProof otherProof = timeProofService.getProof(time, otherKey);
+    ASSERT_NOT_EQUALS(proof, otherProof);
+
+    ASSERT_OK(timeProofService.checkProof(time, proof, key));
+    ASSERT_OK(timeProofService.checkProof(time, otherProof, otherKey));
+    ASSERT_EQUALS(ErrorCodes::TimeProofMismatch,
+                  timeProofService.checkProof(time, proof, otherKey));
+
+    // Cycle through more distinct time ranges than the cache can hold; evicted proofs must still
+    // verify via recomputation.
+    std::vector<TimeProof> proofs;
+    std::vector<LogicalTime> times;
+    for (int i = 0; i < 16; i++) {
+        LogicalTime rangeTime(Timestamp(0x1111'2222'0000'0000ULL + (uint64_t(i) << 16)));
+        times.push_back(rangeTime);
+        proofs.push_back(timeProofService.getProof(rangeTime, key));
+    }
+    for (size_t i = 0; i < proofs.size(); i++) {
+        ASSERT_OK(timeProofService.checkProof(times[i], proofs[i], key));
+    }
+}
+
 }  // unnamed namespace
 }  // namespace mongo
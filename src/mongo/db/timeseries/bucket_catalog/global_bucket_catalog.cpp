@@ -34,7 +34,6 @@
 namespace mongo::timeseries::bucket_catalog {
 namespace {
 const auto getGlobalBucketCatalog = ServiceContext::declareDecoration<GlobalBucketCatalog>();
-static constexpr std::size_t kNumStripes = 32;
 }  // namespace
 
 GlobalBucketCatalog& GlobalBucketCatalog::get(ServiceContext* svcCtx) {
@@ -42,6 +41,7 @@ GlobalBucketCatalog& GlobalBucketCatalog::get(ServiceContext* svcCtx) {
 }
 
 GlobalBucketCatalog::GlobalBucketCatalog()
-    : BucketCatalog(kNumStripes, getTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes) {}
+    : BucketCatalog(static_cast<std::size_t>(gTimeseriesBucketCatalogStripes),
+                    getTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes) {}
 
 }  // namespace mongo::timeseries::bucket_catalog
@@ -35,7 +35,9 @@
 namespace mongo::timeseries::bucket_catalog {
 
 /**
- * The global bucket catalog with a fixed number of stripes, decorated on the service context.
+ * The global bucket catalog decorated on the service context. The number of stripes is fixed for
+ * the lifetime of the catalog and is taken from the 'timeseriesBucketCatalogStripes' startup
+ * parameter.
  */
 class GlobalBucketCatalog : public BucketCatalog {
 public:
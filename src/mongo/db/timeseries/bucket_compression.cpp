@@ -51,6 +51,7 @@
 #include "mongo/bson/timestamp.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
+#include "mongo/db/timeseries/timeseries_gen.h"
 #include "mongo/db/timeseries/timeseries_write_util.h"
 #include "mongo/db/timeseries/write_ops/measurement.h"
 #include "mongo/logv2/log.h"
@@ -60,7 +61,11 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decimal_counter.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/str.h"
+#include "mongo/util/string_map.h"
+#include "mongo/util/time_support.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
@@ -188,6 +193,46 @@ CompressionResult _compressBucket(const BSONObj& bucketDoc,
                   return lhs.timeField.date() < rhs.timeField.date();
               });
 
+    // Optionally compute distinct-value summaries for low-cardinality data fields. The summary
+    // allows bucket-level predicates to exclude buckets that an equality filter cannot match even
+    // when the control min/max range straddles the queried value.
+    std::vector<std::pair<StringData, std::vector<BSONElement>>> distinctSummaries;
+    if (const int maxDistinctValues = gTimeseriesBucketMaxDistinctSummaryValues.load();
+        maxDistinctValues > 0) {
+        for (size_t i = 0; i < columns.size(); ++i) {
+            std::vector<BSONElement> distinctValues;
+            bool eligible = true;
+            for (const auto& measurement : measurements) {
+                auto elem = measurement.dataFields[i];
+                if (!elem) {
+                    // Missing values never match the equality predicates the summary prunes.
+                    continue;
+                }
+                // Objects and arrays are skipped for the same reason bucket-level comparison
+                // predicates do not handle them: the control values use field-order insensitive
+                // comparison semantics.
+                if (elem.type() == BSONType::Object || elem.type() == BSONType::Array) {
+                    eligible = false;
+                    break;
+                }
+                auto seen = std::any_of(
+                    distinctValues.begin(), distinctValues.end(), [&elem](const BSONElement& val) {
+                        return elem.binaryEqualValues(val);
+                    });
+                if (!seen) {
+                    if (distinctValues.size() >= static_cast<size_t>(maxDistinctValues)) {
+                        eligible = false;
+                        break;
+                    }
+                    distinctValues.push_back(elem);
+                }
+            }
+            if (eligible && !distinctValues.empty()) {
+                distinctSummaries.emplace_back(columns[i].first, std::move(distinctValues));
+            }
+        }
+    }
+
     // Write _id unless EOO which it can be in some unittests
     if (!bucketId.eoo()) {
         builder.append(bucketId);
@@ -205,6 +250,9 @@ CompressionResult _compressBucket(const BSONObj& bucketDoc,
                 control.append(kBucketControlVersionFieldName,
                                kTimeseriesControlCompressedSortedVersion);
                 versionSet = true;
+            } else if (controlField.fieldNameStringData() == kBucketControlDistinctFieldName) {
+                // Never copy a pre-existing summary; it is recomputed below when enabled.
+                continue;
             } else {
                 control.append(controlField);
             }
@@ -218,6 +266,18 @@ CompressionResult _compressBucket(const BSONObj& bucketDoc,
 
         // Set count
         control.append(kBucketControlCountFieldName, static_cast<int32_t>(measurements.size()));
+
+        // Set distinct-value summaries if any were computed. The summary is only valid as long as
+        // no measurements are appended; appends to reopened buckets remove it again.
+        if (!distinctSummaries.empty()) {
+            BSONObjBuilder distinct(control.subobjStart(kBucketControlDistinctFieldName));
+            for (const auto& [fieldName, distinctValues] : distinctSummaries) {
+                BSONArrayBuilder values(distinct.subarrayStart(fieldName));
+                for (const auto& value : distinctValues) {
+                    values.append(value);
+                }
+            }
+        }
     }
 
     // Write non control or data elements that are left as-is.
@@ -352,6 +412,50 @@ CompressionResult _compressBucket(const BSONObj& bucketDoc,
 } catch (...) {
     return {};
 }
+
+/**
+ * Merges two control.min or control.max documents elementwise, recursing into sub-objects the same
+ * way the bucket catalog computes min/max over measurements. Fields present on only one side are
+ * kept as-is; the measurements of the other bucket do not contain them. Returns boost::none when a
+ * value is an array, as a whole-value comparison would not produce a per-element bound.
+ */
+boost::optional<BSONObj> mergeControlBound(const BSONObj& lhs,
+                                           const BSONObj& rhs,
+                                           bool takeMax,
+                                           const StringDataComparator* comparator) {
+    BSONObjBuilder builder;
+    StringDataSet lhsFields;
+    for (auto&& lhsElem : lhs) {
+        auto fieldName = lhsElem.fieldNameStringData();
+        lhsFields.insert(fieldName);
+        auto rhsElem = rhs[fieldName];
+        if (lhsElem.type() == BSONType::Array ||
+            (!rhsElem.eoo() && rhsElem.type() == BSONType::Array)) {
+            return boost::none;
+        }
+        if (rhsElem.eoo()) {
+            builder.append(lhsElem);
+        } else if (lhsElem.type() == BSONType::Object && rhsElem.type() == BSONType::Object) {
+            auto sub = mergeControlBound(lhsElem.Obj(), rhsElem.Obj(), takeMax, comparator);
+            if (!sub) {
+                return boost::none;
+            }
+            builder.append(fieldName, *sub);
+        } else {
+            auto cmp = lhsElem.woCompare(rhsElem, 0 /* rules */, comparator);
+            builder.append((cmp >= 0) == takeMax ? lhsElem : rhsElem);
+        }
+    }
+    for (auto&& rhsElem : rhs) {
+        if (!lhsFields.contains(rhsElem.fieldNameStringData())) {
+            if (rhsElem.type() == BSONType::Array) {
+                return boost::none;
+            }
+            builder.append(rhsElem);
+        }
+    }
+    return builder.obj();
+}
 }  // namespace
 
 CompressionResult compressBucket(const BSONObj& bucketDoc,
@@ -412,6 +516,10 @@ boost::optional<BSONObj> decompressBucket(const BSONObj& bucketDoc) try {
                 } else if (e.fieldNameStringData() == kBucketControlCountFieldName) {
                     // Omit the count field when decompressing.
                     continue;
+                } else if (e.fieldNameStringData() == kBucketControlDistinctFieldName) {
+                    // Omit the distinct-value summary: updates to uncompressed buckets do not
+                    // invalidate it, so it must not survive decompression.
+                    continue;
                 } else {
                     // Just copy all the other fields.
                     builder.append(e);
@@ -449,6 +557,169 @@ boost::optional<BSONObj> decompressBucket(const BSONObj& bucketDoc) try {
     return boost::none;
 }
 
+boost::optional<BSONObj> mergeBuckets(const std::vector<BSONObj>& bucketDocs,
+                                      StringData timeFieldName,
+                                      int32_t maxSpanSeconds,
+                                      int32_t maxCount,
+                                      const StringDataComparator* comparator,
+                                      const NamespaceString& nss,
+                                      bool validateDecompression) try {
+    if (bucketDocs.size() < 2) {
+        return boost::none;
+    }
+
+    // Work on the uncompressed representation of every input bucket. Decompression preserves the
+    // index field names of the data columns, so measurements stay aligned with the time column.
+    std::vector<BSONObj> buckets;
+    buckets.reserve(bucketDocs.size());
+    for (const auto& bucketDoc : bucketDocs) {
+        if (isCompressedBucket(bucketDoc)) {
+            auto decompressed = decompressBucket(bucketDoc);
+            if (!decompressed) {
+                return boost::none;
+            }
+            buckets.push_back(std::move(*decompressed));
+        } else {
+            buckets.push_back(bucketDoc);
+        }
+    }
+
+    // All buckets must belong to the same series.
+    auto firstMeta = buckets.front()[kBucketMetaFieldName];
+    for (size_t i = 1; i < buckets.size(); ++i) {
+        auto meta = buckets[i][kBucketMetaFieldName];
+        if (meta.eoo() != firstMeta.eoo() || (!meta.eoo() && !meta.binaryEqualValues(firstMeta))) {
+            return boost::none;
+        }
+    }
+
+    // Merge the control blocks. Merging the stored control.min and control.max documents, rather
+    // than recomputing the bounds from the measurements, keeps the rounded-down minimum timestamp
+    // of the earliest bucket which must stay consistent with the _id we keep.
+    boost::optional<BSONObj> mergedMin;
+    boost::optional<BSONObj> mergedMax;
+    bool closed = false;
+    size_t earliestIndex = 0;
+    Date_t earliestMinTime = Date_t::max();
+    long long totalCount = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        auto control = buckets[i].getObjectField(kBucketControlFieldName);
+        auto min = control[kBucketControlMinFieldName];
+        auto max = control[kBucketControlMaxFieldName];
+        if (min.type() != BSONType::Object || max.type() != BSONType::Object) {
+            return boost::none;
+        }
+        auto minTime = min.Obj()[timeFieldName];
+        if (minTime.type() != BSONType::Date) {
+            return boost::none;
+        }
+        if (minTime.date() < earliestMinTime) {
+            earliestMinTime = minTime.date();
+            earliestIndex = i;
+        }
+        if (!mergedMin) {
+            mergedMin = min.Obj().getOwned();
+            mergedMax = max.Obj().getOwned();
+        } else {
+            mergedMin = mergeControlBound(*mergedMin, min.Obj(), false /* takeMax */, comparator);
+            if (!mergedMin) {
+                return boost::none;
+            }
+            mergedMax = mergeControlBound(*mergedMax, max.Obj(), true /* takeMax */, comparator);
+            if (!mergedMax) {
+                return boost::none;
+            }
+        }
+        closed = closed || control[kBucketControlClosedFieldName].trueValue();
+        totalCount += buckets[i]
+                          .getObjectField(kBucketDataFieldName)
+                          .getObjectField(timeFieldName)
+                          .nFields();
+    }
+
+    if (totalCount > maxCount) {
+        return boost::none;
+    }
+
+    // Queries prune buckets by the minimum timestamp embedded in the _id assuming no bucket spans
+    // more than the collection maximum, so never merge past it.
+    auto maxTime = (*mergedMax)[timeFieldName];
+    if (maxTime.type() != BSONType::Date ||
+        maxTime.date() - earliestMinTime >= Seconds(maxSpanSeconds)) {
+        return boost::none;
+    }
+
+    BSONObjBuilder merged;
+    const auto& earliest = buckets[earliestIndex];
+    if (auto bucketId = earliest["_id"_sd]; !bucketId.eoo()) {
+        merged.append(bucketId);
+    }
+
+    {
+        BSONObjBuilder control(merged.subobjStart(kBucketControlFieldName));
+        control.append(kBucketControlVersionFieldName, kTimeseriesControlUncompressedVersion);
+        control.append(kBucketControlMinFieldName, *mergedMin);
+        control.append(kBucketControlMaxFieldName, *mergedMax);
+        if (closed) {
+            control.append(kBucketControlClosedFieldName, true);
+        }
+    }
+
+    // Copy the remaining top-level fields (typically the meta field) from the earliest bucket.
+    for (auto&& elem : earliest) {
+        auto fieldName = elem.fieldNameStringData();
+        if (fieldName == "_id"_sd || fieldName == kBucketControlFieldName ||
+            fieldName == kBucketDataFieldName) {
+            continue;
+        }
+        merged.append(elem);
+    }
+
+    // Concatenate the data columns, renumbering the measurement indexes of each bucket to follow
+    // those of the preceding buckets. Missing entries keep their gaps so the data columns stay
+    // aligned with the time column. compressBucket below re-sorts the measurements on time.
+    {
+        BSONObjBuilder dataBuilder(merged.subobjStart(kBucketDataFieldName));
+        StringDataMap<BSONObjBuilder> columnBuilders;
+        std::vector<StringData> columnOrder;
+        uint32_t indexBase = 0;
+        for (const auto& bucket : buckets) {
+            bool haveTimeColumn = false;
+            uint32_t nextIndexBase = indexBase;
+            for (auto&& column : bucket.getObjectField(kBucketDataFieldName)) {
+                auto [it, inserted] = columnBuilders.try_emplace(column.fieldNameStringData());
+                if (inserted) {
+                    columnOrder.push_back(column.fieldNameStringData());
+                }
+                auto& columnBuilder = it->second;
+                for (auto&& value : column.Obj()) {
+                    auto index = str::parseUnsignedBase10Integer(value.fieldNameStringData());
+                    if (!index) {
+                        return boost::none;
+                    }
+                    columnBuilder.appendAs(value, std::to_string(indexBase + *index));
+                    nextIndexBase =
+                        std::max(nextIndexBase, indexBase + static_cast<uint32_t>(*index) + 1);
+                }
+                haveTimeColumn = haveTimeColumn || column.fieldNameStringData() == timeFieldName;
+            }
+            if (!haveTimeColumn) {
+                // A bucket without a time column cannot be merged.
+                return boost::none;
+            }
+            indexBase = nextIndexBase;
+        }
+        for (auto&& fieldName : columnOrder) {
+            dataBuilder.append(fieldName, columnBuilders.at(fieldName).obj());
+        }
+    }
+
+    auto result = compressBucket(merged.obj(), timeFieldName, nss, validateDecompression);
+    return result.compressedBucket;
+} catch (...) {
+    return boost::none;
+}
+
 bool isCompressedBucket(const BSONObj& bucketDoc) {
     auto&& controlField = bucketDoc[timeseries::kBucketControlFieldName];
     uassert(6540600,
@@ -33,7 +33,11 @@
 #include <boost/optional.hpp>
 #include <boost/optional/optional.hpp>
 
+#include <cstdint>
+#include <vector>
+
 #include "mongo/base/string_data.h"
+#include "mongo/base/string_data_comparator.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/namespace_string.h"
 
@@ -65,6 +69,27 @@ CompressionResult compressBucket(const BSONObj& bucketDoc,
 
 boost::optional<BSONObj> decompressBucket(const BSONObj& bucketDoc);
 
+/**
+ * Merges multiple buckets belonging to the same series into a single compressed v2 bucket.
+ * Accepts both compressed and uncompressed input buckets. The merged bucket keeps the _id and meta
+ * of the bucket with the earliest control.min time and has its control min/max recomputed over all
+ * inputs, so the rounded-down minimum timestamp embedded in the _id remains valid.
+ *
+ * Returns boost::none when the buckets cannot be merged without changing query results: when the
+ * buckets belong to different series, when the merged time range would exceed 'maxSpanSeconds'
+ * (queries prune buckets by _id assuming the maximum span), when the merged bucket would exceed
+ * 'maxCount' measurements, or when a control bound contains an array value for which no merged
+ * per-element bound can be computed. Also returns boost::none if any input bucket cannot be
+ * decompressed or the merged bucket fails to compress.
+ */
+boost::optional<BSONObj> mergeBuckets(const std::vector<BSONObj>& bucketDocs,
+                                      StringData timeFieldName,
+                                      int32_t maxSpanSeconds,
+                                      int32_t maxCount,
+                                      const StringDataComparator* comparator,
+                                      const NamespaceString& nss,
+                                      bool validateDecompression);
+
 /**
  * Returns whether a timeseries bucket has been compressed to the v2 format.
  */
@@ -29,12 +29,15 @@
 
 #include <boost/optional/optional.hpp>
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/json.h"
 #include "mongo/bson/unordered_fields_bsonobj_comparator.h"
 #include "mongo/db/timeseries/bucket_compression.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 namespace {
@@ -163,6 +166,166 @@ TEST(TimeseriesBucketCompression, RoundtripWithDuplicateIndexFieldNames) {
     }
 }
 
+TEST(TimeseriesBucketCompression, DistinctSummaryDisabledByDefault) {
+    auto compressed = timeseries::compressBucket(
+        sampleBucket, "t"_sd, NamespaceString::createNamespaceString_forTest("test.foo"), false);
+    ASSERT_TRUE(compressed.compressedBucket.has_value());
+    ASSERT_TRUE(compressed.compressedBucket
+                    ->getObjectField(timeseries::kBucketControlFieldName)
+                    .getField(timeseries::kBucketControlDistinctFieldName)
+                    .eoo());
+}
+
+TEST(TimeseriesBucketCompression, DistinctSummaryWrittenForLowCardinalityFields) {
+    RAIIServerParameterControllerForTest controller("timeseriesBucketMaxDistinctSummaryValues", 2);
+
+    const BSONObj bucket = mongo::fromjson(R"({
+            "_id" : {"$oid": "630ea4802093f9983fc394dc"},
+            "control" : {
+                    "version" : 1,
+                    "min" : {"t" : {"$date": "2022-08-31T00:00:00Z"}, "a" : 0, "label" : "x"},
+                    "max" : {"t" : {"$date": "2022-08-31T00:00:04Z"}, "a" : 4, "label" : "y"}
+            },
+            "data" : {
+                    "label" : {"0" : "x", "1" : "x", "2" : "y", "3" : "x", "4" : "y"},
+                    "a" : {"0" : 0, "1" : 1, "2" : 2, "3" : 3, "4" : 4},
+                    "t" : {
+                            "0" : {"$date": "2022-08-31T00:00:00Z"},
+                            "1" : {"$date": "2022-08-31T00:00:01Z"},
+                            "2" : {"$date": "2022-08-31T00:00:02Z"},
+                            "3" : {"$date": "2022-08-31T00:00:03Z"},
+                            "4" : {"$date": "2022-08-31T00:00:04Z"}
+                    }
+            }
+    })");
+
+    auto compressed = timeseries::compressBucket(
+        bucket, "t"_sd, NamespaceString::createNamespaceString_forTest("test.foo"), false);
+    ASSERT_TRUE(compressed.compressedBucket.has_value());
+
+    // "label" has two distinct values and is summarized; "a" exceeds the limit and is not. The
+    // time field is never summarized.
+    ASSERT_BSONOBJ_EQ(compressed.compressedBucket
+                          ->getObjectField(timeseries::kBucketControlFieldName)
+                          .getObjectField(timeseries::kBucketControlDistinctFieldName),
+                      mongo::fromjson(R"({"label" : ["x", "y"]})"));
+
+    // The summary must not survive decompression, as updates to uncompressed buckets would not
+    // invalidate it.
+    auto decompressed = timeseries::decompressBucket(compressed.compressedBucket.value());
+    ASSERT_TRUE(decompressed.has_value());
+    UnorderedFieldsBSONObjComparator comparator;
+    ASSERT_EQ(0, comparator.compare(decompressed.value(), bucket));
+}
+
+const BSONObj laterSampleBucket = mongo::fromjson(R"({
+        "_id" : {"$oid": "630ea4802093f9983fc394dd"},
+        "control" : {
+                "version" : 1,
+                "min" : {
+                        "_id" : {"$oid": "630fabf7c388456f8aea4f37"},
+                        "t" : {"$date": "2022-08-31T00:00:10Z"},
+                        "a" : 10
+                },
+                "max" : {
+                        "_id" : {"$oid": "630fabf7c388456f8aea4f39"},
+                        "t" : {"$date": "2022-08-31T00:00:12Z"},
+                        "a" : 12
+                }
+        },
+        "data" : {
+                "_id" : {
+                        "0" : {"$oid": "630fabf7c388456f8aea4f37"},
+                        "1" : {"$oid": "630fabf7c388456f8aea4f38"},
+                        "2" : {"$oid": "630fabf7c388456f8aea4f39"}
+                },
+                "a" : {
+                        "0" : 10,
+                        "1" : 11,
+                        "2" : 12
+                },
+                "t" : {
+                        "0" : {"$date": "2022-08-31T00:00:10Z"},
+                        "1" : {"$date": "2022-08-31T00:00:11Z"},
+                        "2" : {"$date": "2022-08-31T00:00:12Z"}
+                }
+        }
+})");
+
+TEST(TimeseriesBucketCompression, MergeBucketsCombinesSameSeriesBuckets) {
+    const StringData timeFieldName("t");
+    const auto nss = NamespaceString::createNamespaceString_forTest("test.foo");
+
+    // Pass the later bucket first to check that the merge keeps the _id of the bucket with the
+    // earliest control.min time. One input is pre-compressed to check that both representations
+    // are accepted.
+    auto compressedLater = timeseries::compressBucket(laterSampleBucket, timeFieldName, nss, false);
+    ASSERT_TRUE(compressedLater.compressedBucket.has_value());
+    auto merged = timeseries::mergeBuckets({*compressedLater.compressedBucket, sampleBucket},
+                                           timeFieldName,
+                                           3600 /* maxSpanSeconds */,
+                                           100 /* maxCount */,
+                                           nullptr /* comparator */,
+                                           nss,
+                                           true /* validateDecompression */);
+    ASSERT_TRUE(merged.has_value());
+    ASSERT_TRUE(timeseries::isCompressedBucket(*merged));
+    ASSERT_EQ(merged->getField("_id").OID(), sampleBucket.getField("_id").OID());
+
+    auto control = merged->getObjectField(timeseries::kBucketControlFieldName);
+    ASSERT_EQ(8, control.getIntField(timeseries::kBucketControlCountFieldName));
+    ASSERT_EQ(Date_t::fromMillisSinceEpoch(1661904000000),  // 2022-08-31T00:00:00Z
+              control.getObjectField(timeseries::kBucketControlMinFieldName)["t"].date());
+    ASSERT_EQ(Date_t::fromMillisSinceEpoch(1661904012000),  // 2022-08-31T00:00:12Z
+              control.getObjectField(timeseries::kBucketControlMaxFieldName)["t"].date());
+    ASSERT_EQ(0, control.getObjectField(timeseries::kBucketControlMinFieldName)["a"].numberInt());
+    ASSERT_EQ(12, control.getObjectField(timeseries::kBucketControlMaxFieldName)["a"].numberInt());
+
+    auto decompressed = timeseries::decompressBucket(*merged);
+    ASSERT_TRUE(decompressed.has_value());
+    ASSERT_EQ(8,
+              decompressed->getObjectField(timeseries::kBucketDataFieldName)
+                  .getObjectField(timeFieldName)
+                  .nFields());
+    for (const auto columnIt : decompressed->getObjectField(timeseries::kBucketDataFieldName)) {
+        assertNoDuplicateIndexFieldNames(columnIt.Obj());
+    }
+}
+
+TEST(TimeseriesBucketCompression, MergeBucketsRefusesDifferentSeries) {
+    const auto nss = NamespaceString::createNamespaceString_forTest("test.foo");
+    BSONObjBuilder withMeta;
+    withMeta.appendElements(laterSampleBucket);
+    withMeta.append(timeseries::kBucketMetaFieldName, "sensorA");
+
+    auto merged = timeseries::mergeBuckets(
+        {sampleBucket, withMeta.obj()}, "t"_sd, 3600, 100, nullptr, nss, false);
+    ASSERT_FALSE(merged.has_value());
+}
+
+TEST(TimeseriesBucketCompression, MergeBucketsRefusesWhenMaxSpanWouldBeExceeded) {
+    const auto nss = NamespaceString::createNamespaceString_forTest("test.foo");
+
+    // The merged bucket would span 12 seconds from the rounded-down minimum.
+    auto merged = timeseries::mergeBuckets({sampleBucket, laterSampleBucket},
+                                           "t"_sd,
+                                           10 /* maxSpanSeconds */,
+                                           100,
+                                           nullptr,
+                                           nss,
+                                           false);
+    ASSERT_FALSE(merged.has_value());
+}
+
+TEST(TimeseriesBucketCompression, MergeBucketsRefusesWhenMaxCountWouldBeExceeded) {
+    const auto nss = NamespaceString::createNamespaceString_forTest("test.foo");
+
+    // The merged bucket would hold 8 measurements.
+    auto merged = timeseries::mergeBuckets(
+        {sampleBucket, laterSampleBucket}, "t"_sd, 3600, 7 /* maxCount */, nullptr, nss, false);
+    ASSERT_FALSE(merged.has_value());
+}
+
 TEST(TimeseriesBucketCompression, CannotDecompressUncompressedBucket) {
     auto decompressed = timeseries::decompressBucket(sampleBucket);
     ASSERT_FALSE(decompressed.has_value());
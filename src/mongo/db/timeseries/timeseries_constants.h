@@ -46,8 +46,10 @@ static constexpr StringData kBucketControlVersionFieldName = "version"_sd;
 static constexpr StringData kBucketControlCountFieldName = "count"_sd;
 static constexpr StringData kBucketControlMinFieldName = "min"_sd;
 static constexpr StringData kBucketControlMaxFieldName = "max"_sd;
+static constexpr StringData kBucketControlDistinctFieldName = "distinct"_sd;
 static constexpr StringData kControlMaxFieldNamePrefix = "control.max."_sd;
 static constexpr StringData kControlMinFieldNamePrefix = "control.min."_sd;
+static constexpr StringData kControlDistinctFieldNamePrefix = "control.distinct."_sd;
 static constexpr StringData kDataFieldNamePrefix = "data."_sd;
 static constexpr StringData kControlFieldNamePrefix = "control."_sd;
 
@@ -950,11 +950,15 @@ StatusWith<std::vector<bucket_catalog::BatchedInsertContext>> buildBatchedInsert
         collectionUUID, bucket_catalog::BucketMetadata{trackingContext, metadata, boost::none}};
     auto stripeNumber = bucket_catalog::internal::getStripeNumber(bucketCatalog, bucketKey);
 
-    std::sort(
-        batchedInsertTupleVector.begin(), batchedInsertTupleVector.end(), [](auto& lhs, auto& rhs) {
-            // Sort measurements on their timeField.
-            return std::get<Date_t>(lhs) < std::get<Date_t>(rhs);
-        });
+    // Sort measurements on their timeField. Collector-fed workloads commonly deliver measurements
+    // already sorted on time, so check for that before paying for the sort.
+    auto timeComparator = [](auto& lhs, auto& rhs) {
+        return std::get<Date_t>(lhs) < std::get<Date_t>(rhs);
+    };
+    if (!std::is_sorted(
+            batchedInsertTupleVector.begin(), batchedInsertTupleVector.end(), timeComparator)) {
+        std::sort(batchedInsertTupleVector.begin(), batchedInsertTupleVector.end(), timeComparator);
+    }
 
     return {{bucket_catalog::BatchedInsertContext(
         bucketKey, stripeNumber, timeseriesOptions, stats, batchedInsertTupleVector)}};
@@ -979,7 +983,11 @@ buildBatchedInsertContextsWithMetaField(const bucket_catalog::BucketCatalog& buc
     // Go through the vector of user measurements and create a map from each distinct metaField
     // value to a vector of InsertBatchTuples for that metaField. As part of the InsertBatchTuple
     // struct we store the index of the measurement in the original user batch for error reporting
-    // and retryability purposes.
+    // and retryability purposes. Measurements sorted by series arrive as runs of identical
+    // metaField values, so we remember the vector resolved for the previous measurement and only
+    // stringify and hash the metaField when it changes.
+    std::vector<bucket_catalog::BatchedInsertTuple>* currentRun = nullptr;
+    BSONElement previousMeta;
     for (size_t i = 0; i < userMeasurementsBatch.size(); i++) {
         auto swTimeAndMeta =
             bucket_catalog::extractTimeAndMeta(userMeasurementsBatch[i],
@@ -991,24 +999,32 @@ buildBatchedInsertContextsWithMetaField(const bucket_catalog::BucketCatalog& buc
         auto time = std::get<Date_t>(swTimeAndMeta.getValue());
         auto meta = std::get<BSONElement>(swTimeAndMeta.getValue());
 
-        metaFieldStringToBSONElement.try_emplace(meta.String(), meta);
-        metaFieldToBatchedInsertTuples.try_emplace(
-            meta.String(), std::vector<bucket_catalog::BatchedInsertTuple>{});
+        if (!currentRun || !meta.binaryEqualValues(previousMeta)) {
+            metaFieldStringToBSONElement.try_emplace(meta.String(), meta);
+            // References into the node-based map stay valid across later insertions.
+            currentRun = &metaFieldToBatchedInsertTuples
+                              .try_emplace(meta.String(),
+                                           std::vector<bucket_catalog::BatchedInsertTuple>{})
+                              .first->second;
+            previousMeta = meta;
+        }
 
-        metaFieldToBatchedInsertTuples[meta.String()].emplace_back(
-            userMeasurementsBatch[i], time, i);
+        currentRun->emplace_back(userMeasurementsBatch[i], time, i);
     }
 
     std::vector<bucket_catalog::BatchedInsertContext> batchedInsertContexts;
 
-    // Go through all meta-unique batches, sort by time, and fill result
+    // Go through all meta-unique batches, sort by time, and fill result. As above, skip the sort
+    // for the common case of input that already arrived in time order.
+    auto timeComparator = [](auto& lhs, auto& rhs) {
+        return std::get<Date_t>(lhs) < std::get<Date_t>(rhs);
+    };
     for (auto& [metaFieldString, batchedInsertTupleVector] : metaFieldToBatchedInsertTuples) {
-        std::sort(batchedInsertTupleVector.begin(),
-                  batchedInsertTupleVector.end(),
-                  [](auto& lhs, auto& rhs) {
-                      // Sort measurements on their timeField.
-                      return std::get<Date_t>(lhs) < std::get<Date_t>(rhs);
-                  });
+        if (!std::is_sorted(
+                batchedInsertTupleVector.begin(), batchedInsertTupleVector.end(), timeComparator)) {
+            std::sort(
+                batchedInsertTupleVector.begin(), batchedInsertTupleVector.end(), timeComparator);
+        }
         auto metadata = metaFieldStringToBSONElement[metaFieldString];
         auto bucketKey = bucket_catalog::BucketKey{
             collectionUUID, bucket_catalog::BucketMetadata{trackingContext, metadata, boost::none}};
@@ -139,6 +139,9 @@ buildBatchedInsertContextsWithMetaField(const bucket_catalog::BucketCatalog& buc
  * If the time-series collection has no metaField value, then all of the measurements will be
  * batched into one BatchedInsertContext.
  *
+ * Input that already arrives sorted by (metaField, time) — the common case for collector-fed
+ * workloads — is grouped into per-series runs in a single pass and is not re-sorted.
+ *
  * If any of the inserted measurements are malformed (i.e. missing the proper time field), returns a
  * Status with an error code.
  */
@@ -223,6 +223,74 @@ TEST_F(TimeseriesWriteOpsInternalTest, BuildBatchedInsertContextsMultipleBatches
     }
 }
 
+TEST_F(TimeseriesWriteOpsInternalTest, BuildBatchedInsertContextsPreSortedBySeriesAndTime) {
+    auto opCtx = operationContext();
+    NamespaceString ns = NamespaceString::createNamespaceString_forTest(
+        "db_timeseries_write_ops_internal_test", "ts");
+
+    ASSERT_OK(createCollection(opCtx,
+                               ns.dbName(),
+                               BSON("create" << ns.coll() << "timeseries"
+                                             << BSON("timeField"
+                                                     << "time"
+                                                     << "metaField"
+                                                     << "meta"))));
+    AutoGetCollection bucketsColl(opCtx, ns.makeTimeseriesBucketsNamespace(), LockMode::MODE_IX);
+
+    // Measurements already sorted by (metaField, time), as collectors typically deliver them.
+    // "a" appears in two separate runs to check that a re-encountered metaField value is appended
+    // to its existing batch rather than starting a new one.
+    std::vector<BSONObj> userMeasurementsBatch{
+        mongo::fromjson(R"({"time":{"$date":"2025-01-30T10:01:00.000Z"}, "meta":"a", "x":1})"),
+        mongo::fromjson(R"({"time":{"$date":"2025-01-30T10:02:00.000Z"}, "meta":"a", "x":2})"),
+        mongo::fromjson(R"({"time":{"$date":"2025-01-30T10:03:00.000Z"}, "meta":"a", "x":3})"),
+        mongo::fromjson(R"({"time":{"$date":"2025-01-30T10:01:00.000Z"}, "meta":"b", "x":4})"),
+        mongo::fromjson(R"({"time":{"$date":"2025-01-30T10:02:00.000Z"}, "meta":"b", "x":5})"),
+        mongo::fromjson(R"({"time":{"$date":"2025-01-30T10:04:00.000Z"}, "meta":"a", "x":6})"),
+    };
+
+    auto& bucketCatalog =
+        timeseries::bucket_catalog::GlobalBucketCatalog::get(opCtx->getServiceContext());
+    tracking::Context trackingContext;
+    timeseries::bucket_catalog::ExecutionStatsController stats;
+
+    auto swInsertBatchContextVector =
+        timeseries::write_ops::internal::buildBatchedInsertContextsWithMetaField(
+            bucketCatalog,
+            bucketsColl->uuid(),
+            bucketsColl->getTimeseriesOptions().get(),
+            userMeasurementsBatch,
+            "meta",
+            stats,
+            trackingContext);
+    ASSERT_OK(swInsertBatchContextVector);
+
+    stdx::unordered_map<std::string, std::vector<size_t>> metaFieldValueToCorrectIndexOrderMap;
+    metaFieldValueToCorrectIndexOrderMap.try_emplace("a",
+                                                     std::initializer_list<size_t>{0, 1, 2, 5});
+    metaFieldValueToCorrectIndexOrderMap.try_emplace("b", std::initializer_list<size_t>{3, 4});
+
+    auto insertBatchContextVector = swInsertBatchContextVector.getValue();
+    // There should be two insertBatchContexts for the two distinct meta values.
+    ASSERT_EQ(insertBatchContextVector.size(), 2);
+
+    for (size_t i = 0; i < insertBatchContextVector.size(); i++) {
+        auto insertBatchContext = insertBatchContextVector[i];
+        ASSERT_EQ(insertBatchContext.key.metadata.getMetaField().get(), "meta");
+        auto metaFieldValue = insertBatchContext.key.metadata.element().String();
+        ASSERT_EQ(insertBatchContext.measurementsTimesAndIndices.size(),
+                  metaFieldValueToCorrectIndexOrderMap[metaFieldValue].size());
+
+        for (size_t j = 0; j < insertBatchContext.measurementsTimesAndIndices.size(); j++) {
+            auto tuple = insertBatchContext.measurementsTimesAndIndices[j];
+            auto measurement = std::get<BSONObj>(tuple);
+            auto index = std::get<size_t>(tuple);
+            ASSERT_EQ(index, metaFieldValueToCorrectIndexOrderMap[metaFieldValue][j]);
+            ASSERT_EQ(userMeasurementsBatch[index].woCompare(measurement), 0);
+        }
+    }
+}
+
 TEST_F(TimeseriesWriteOpsInternalTest, BuildBatchedInsertContextsMalformedMeasurements) {
     auto opCtx = operationContext();
     NamespaceString ns = NamespaceString::createNamespaceString_forTest(
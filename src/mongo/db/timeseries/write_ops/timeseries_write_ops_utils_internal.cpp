@@ -643,6 +643,16 @@ mongo::write_ops::UpdateOpEntry makeTimeseriesCompressedDiffEntry(
     {
         // Control builder.
         BSONObjBuilder controlBuilder(updateBuilder.subobjStart(kControlFieldNameDocDiff));
+
+        // A bucket reopened from disk may carry a 'control.distinct' summary written when it was
+        // last compressed. The summary does not account for the measurements being appended, so it
+        // must be removed. Deleting a field that is not present is a no-op when the diff is
+        // applied. The delete section must precede the update section in the diff.
+        if (batch->isReopened) {
+            controlBuilder.append(doc_diff::kDeleteSectionFieldName,
+                                  BSON(kBucketControlDistinctFieldName << false));
+        }
+
         BSONObjBuilder countAndVersionBuilder;
         countAndVersionBuilder.append(kBucketControlCountFieldName,
                                       static_cast<int>((batch->numPreviouslyCommittedMeasurements +
@@ -99,6 +99,7 @@
 #include "mongo/db/session/session_catalog_mongod.h"
 #include "mongo/db/shard_role.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
+#include "mongo/db/storage/damage_vector.h"
 #include "mongo/db/storage/record_data.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/snapshot.h"
@@ -538,8 +539,40 @@ void updateSessionEntry(OperationContext* opCtx,
     // {parentLsid: 1, _id.txnNumber: 1, _id: 1}, and none of the fields are mutable.
     // Use the storage engine API directly to bypass the OpObservers which only apply to replicated
     // collections.
-    uassertStatusOK(collectionPtr->getRecordStore()->updateRecord(
-        opCtx, recordId, doc.objdata(), doc.objsize()));
+    auto* recordStore = collectionPtr->getRecordStore();
+
+    // Between consecutive writes in the same retryable write or transaction only fixed-size
+    // fields of the session record typically change (txnNum, lastWriteOpTime, lastWriteDate), so
+    // the new document usually has the exact same size and layout as the old one. In that case,
+    // hand the storage engine just the changed byte range as a delta, so it journals a
+    // modification rather than a full new version of the record.
+    const auto docSize = static_cast<size_t>(doc.objsize());
+    if (recordStore->updateWithDamagesSupported() &&
+        originalDoc.objsize() == static_cast<int>(docSize)) {
+        const char* oldData = originalDoc.objdata();
+        const char* newData = doc.objdata();
+        size_t first = 0;
+        while (first < docSize && oldData[first] == newData[first]) {
+            ++first;
+        }
+        if (first == docSize) {
+            // The session record is unchanged; there is nothing to write.
+            wuow.commit();
+            return;
+        }
+        size_t last = docSize;
+        while (last > first && oldData[last - 1] == newData[last - 1]) {
+            --last;
+        }
+        const DamageVector damages{DamageEvent(first, last - first, first, last - first)};
+        uassertStatusOK(
+            recordStore
+                ->updateWithDamages(
+                    opCtx, recordId, RecordData(oldData, docSize), newData, damages)
+                .getStatus());
+    } else {
+        uassertStatusOK(recordStore->updateRecord(opCtx, recordId, doc.objdata(), doc.objsize()));
+    }
 
     wuow.commit();
 }
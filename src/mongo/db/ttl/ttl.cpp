@@ -32,6 +32,7 @@
 
 // IWYU pragma: no_include "cxxabi.h"
 #include <absl/container/node_hash_map.h>
+#include <algorithm>
 #include <absl/meta/type_traits.h>
 #include <boost/cstdint.hpp>
 #include <boost/move/utility_core.hpp>
@@ -139,12 +140,59 @@ bool isBatchingEnabled(const CollectionPtr& collectionPtr) {
     return ttlMonitorBatchDeletes.load() && !collectionPtr->isChangeStreamPreAndPostImagesEnabled();
 }
 
+// Returns how far the majority commit point trails this node's last applied operation, as a proxy
+// for how well secondaries are keeping up with the primary's writes. Returns zero when not in a
+// replica set or when the commit point has not been established yet.
+Seconds replicationLag(OperationContext* opCtx) {
+    auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    if (!replCoord->getSettings().isReplSet()) {
+        return Seconds(0);
+    }
+
+    const auto applied = replCoord->getMyLastAppliedOpTimeAndWallTime().wallTime;
+    const auto committed = replCoord->getLastCommittedOpTimeAndWallTime().wallTime;
+    if (committed == Date_t() || applied <= committed) {
+        return Seconds(0);
+    }
+    return duration_cast<Seconds>(applied - committed);
+}
+
+// When the majority commit point trails by more than 'ttlMonitorMaxReplicationLagSecs', shrinks
+// the per-transaction and per-index document targets proportionally so that TTL deletion paces
+// itself to what secondaries can absorb instead of deepening the lag. The time target is left
+// alone - it already bounds how long the index is revisited for, not how much work secondaries
+// receive at once.
+void applyReplicationLagFeedback(OperationContext* opCtx, BatchedDeleteStageParams* params) {
+    const Seconds maxLag{ttlMonitorMaxReplicationLagSecs.load()};
+    if (maxLag <= Seconds(0)) {
+        return;
+    }
+
+    const auto lag = replicationLag(opCtx);
+    if (lag <= maxLag) {
+        return;
+    }
+
+    params->targetBatchDocs =
+        scaleTTLDeleteTargetForReplicationLag(params->targetBatchDocs, lag, maxLag);
+    params->targetPassDocs =
+        scaleTTLDeleteTargetForReplicationLag(params->targetPassDocs, lag, maxLag);
+    LOGV2_DEBUG(9876510,
+                1,
+                "Scaling down TTL batched delete targets due to replication lag",
+                "lag"_attr = lag,
+                "maxLag"_attr = maxLag,
+                "targetBatchDocs"_attr = params->targetBatchDocs,
+                "targetPassDocs"_attr = params->targetPassDocs);
+}
+
 // When batching is enabled, returns BatchedDeleteStageParams that limit the amount of work done in
 // a delete such that it is possible not all expired documents will be removed. Returns nullptr
 // otherwise.
 //
 // When batching is disabled, all expired documents are removed by the delete operation.
-std::unique_ptr<BatchedDeleteStageParams> getBatchedDeleteStageParams(bool batchingEnabled) {
+std::unique_ptr<BatchedDeleteStageParams> getBatchedDeleteStageParams(OperationContext* opCtx,
+                                                                      bool batchingEnabled) {
     if (!batchingEnabled) {
         return nullptr;
     }
@@ -152,6 +200,10 @@ std::unique_ptr<BatchedDeleteStageParams> getBatchedDeleteStageParams(bool batch
     auto batchedDeleteParams = std::make_unique<BatchedDeleteStageParams>();
     batchedDeleteParams->targetPassDocs = ttlIndexDeleteTargetDocs.load();
     batchedDeleteParams->targetPassTimeMS = Milliseconds(ttlIndexDeleteTargetTimeMS.load());
+    if (auto batchDocs = ttlIndexDeleteBatchDocs.load(); batchDocs > 0) {
+        batchedDeleteParams->targetBatchDocs = batchDocs;
+    }
+    applyReplicationLagFeedback(opCtx, batchedDeleteParams.get());
     return batchedDeleteParams;
 }
 
@@ -633,7 +685,8 @@ bool TTLMonitor::_deleteExpiredWithIndex(OperationContext* opCtx,
                                                      BoundInclusion::kIncludeBothStartAndEndKeys,
                                                      PlanYieldPolicy::YieldPolicy::YIELD_AUTO,
                                                      direction,
-                                                     getBatchedDeleteStageParams(batchingEnabled));
+                                                     getBatchedDeleteStageParams(opCtx,
+                                                                                 batchingEnabled));
 
     try {
         const auto numDeleted = exec->executeDelete();
@@ -771,7 +824,7 @@ bool TTLMonitor::_performDeleteExpiredWithCollscan(OperationContext* opCtx,
         startBound,
         endBound,
         CollectionScanParams::ScanBoundInclusion::kIncludeBothStartAndEndRecords,
-        getBatchedDeleteStageParams(batchingEnabled),
+        getBatchedDeleteStageParams(opCtx, batchingEnabled),
         filter);
 
     try {
@@ -805,6 +858,19 @@ bool TTLMonitor::_performDeleteExpiredWithCollscan(OperationContext* opCtx,
     return false;
 }
 
+long long scaleTTLDeleteTargetForReplicationLag(long long target, Seconds lag, Seconds maxLag) {
+    if (target <= 0 || maxLag <= Seconds(0) || lag <= maxLag) {
+        return target;
+    }
+
+    // Scale proportionally to the overshoot, but always leave a minimal amount of work per visit
+    // so deletion keeps progressing and the lag measurement keeps moving.
+    static constexpr long long kMinTarget = 10;
+    const auto scaled = static_cast<long long>(
+        target * (durationCount<Seconds>(maxLag) / static_cast<double>(durationCount<Seconds>(lag))));
+    return std::max(scaled, std::min(target, kMinTarget));
+}
+
 void startTTLMonitor(ServiceContext* serviceContext, bool setupOnly) {
     std::unique_ptr<TTLMonitor> ttlMonitor = std::make_unique<TTLMonitor>();
     if (!setupOnly)
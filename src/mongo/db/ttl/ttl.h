@@ -59,6 +59,14 @@ void startTTLMonitor(ServiceContext* serviceContext, bool setupOnly = false);
  */
 void shutdownTTLMonitor(ServiceContext* serviceContext);
 
+/**
+ * Scales a batched delete document target down in response to replication lag. Returns 'target'
+ * unchanged when lag-based tuning is disabled ('maxLag' is zero), 'target' is unlimited (zero), or
+ * 'lag' is within 'maxLag'. Otherwise the target shrinks proportionally to the overshoot - at
+ * twice the permitted lag the target halves - down to a floor that keeps deletion progressing.
+ */
+long long scaleTTLDeleteTargetForReplicationLag(long long target, Seconds lag, Seconds maxLag);
+
 class TTLMonitor : public BackgroundJob {
 public:
     TTLMonitor();
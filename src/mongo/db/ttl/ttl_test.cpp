@@ -1203,6 +1203,28 @@ TEST_F(SkipInvalidTTLTest, TTLNegNan) {
                          << "expireAfterSeconds" << -std::numeric_limits<double>::quiet_NaN()));
 }
 
+TEST(TTLReplicationLagScaling, TargetUnchangedWhenTuningDisabledOrLagWithinBounds) {
+    // Tuning disabled.
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(50000, Seconds(100), Seconds(0)), 50000);
+    // Unlimited target stays unlimited.
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(0, Seconds(100), Seconds(10)), 0);
+    // Lag within bounds.
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(50000, Seconds(5), Seconds(10)), 50000);
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(50000, Seconds(10), Seconds(10)), 50000);
+}
+
+TEST(TTLReplicationLagScaling, TargetShrinksProportionallyToOvershoot) {
+    // Twice the permitted lag halves the target; four times quarters it.
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(50000, Seconds(20), Seconds(10)), 25000);
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(50000, Seconds(40), Seconds(10)), 12500);
+}
+
+TEST(TTLReplicationLagScaling, TargetNeverScalesBelowFloor) {
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(100, Seconds(100000), Seconds(10)), 10);
+    // A target already below the floor is preserved rather than raised.
+    ASSERT_EQ(scaleTTLDeleteTargetForReplicationLag(5, Seconds(100000), Seconds(10)), 5);
+}
+
 }  // namespace
 }  // namespace mongo
 
@@ -29,7 +29,6 @@
 
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
-#include <mutex>
 
 
 #include "mongo/base/error_codes.h"
@@ -78,6 +77,12 @@ ServiceContext::ConstructorActionRegisterer vectorClockRegisterer(
 
 const LogicalTime VectorClock::kInitialComponentTime{Timestamp{0, 1}};
 
+VectorClock::VectorClock() {
+    for (auto& component : _vectorTime) {
+        component.store(kInitialComponentTime.asTimestamp().asULL());
+    }
+}
+
 VectorClock* VectorClock::get(ServiceContext* service) {
     return vectorClockDecoration(service);
 }
@@ -102,8 +107,22 @@ void VectorClock::registerVectorClockOnServiceContext(ServiceContext* service,
 }
 
 VectorClock::VectorTime VectorClock::getTime() const {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-    return VectorTime(_vectorTime);
+    // Seqlock read: snapshot all components without taking '_mutex', and retry if a writer was
+    // mid-update ('_seq' odd) or completed an update while we were reading ('_seq' changed).
+    // Writers never block while holding the seqlock, so the retry loop is short.
+    while (true) {
+        const auto seqBefore = _seq.load();
+        if (seqBefore % 2 == 0) {
+            LogicalTimeArray time;
+            auto it = time.begin();
+            for (auto vIt = _vectorTime.begin(); vIt != _vectorTime.end(); ++vIt, ++it) {
+                *it = LogicalTime(Timestamp(vIt->load()));
+            }
+            if (_seq.load() == seqBefore) {
+                return VectorTime(std::move(time));
+            }
+        }
+    }
 }
 
 bool VectorClock::_lessThanOrEqualToMaxPossibleTime(LogicalTime time, uint64_t nTicks) {
@@ -138,13 +157,12 @@ void VectorClock::_ensurePassesRateLimiter(ServiceContext* service,
 void VectorClock::_advanceTime(LogicalTimeArray&& newTime) {
     _ensurePassesRateLimiter(_service, newTime);
 
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    TimeWriter writer(this);
 
-    auto it = _vectorTime.begin();
-    auto newIt = newTime.begin();
-    for (; it != _vectorTime.end() && newIt != newTime.end(); ++it, ++newIt) {
-        if (*newIt > *it) {
-            *it = std::move(*newIt);
+    for (auto newIt = newTime.begin(); newIt != newTime.end(); ++newIt) {
+        const auto component = Component(newIt - newTime.begin());
+        if (*newIt > writer[component]) {
+            writer.set(component, *newIt);
         }
     }
 }
@@ -439,11 +457,10 @@ void VectorClock::_disable() {
 }
 
 void VectorClock::resetVectorClock_forTest() {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
-    auto it = _vectorTime.begin();
-    for (; it != _vectorTime.end(); ++it) {
-        *it = VectorClock::kInitialComponentTime;
-    }
+    TimeWriter writer(this);
+    writer.set(Component::ClusterTime, kInitialComponentTime);
+    writer.set(Component::ConfigTime, kInitialComponentTime);
+    writer.set(Component::TopologyTime, kInitialComponentTime);
     _isEnabled.store(true);
 }
 
@@ -46,6 +46,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/vector_clock_document_gen.h"
 #include "mongo/db/vector_clock_gen.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/mutex.h"
 #include "mongo/transport/session.h"
 #include "mongo/util/assert_util.h"
@@ -197,7 +198,7 @@ public:
         LogicalTimeArray _time;
     };
 
-    VectorClock() = default;
+    VectorClock();
     virtual ~VectorClock() = default;
 
     // There is a special logic in the storage engine which fixes up Timestamp(0, 0) to the latest
@@ -350,6 +351,35 @@ protected:
                                                              : ComponentSet{};
     }
 
+    /**
+     * Grants write access to the component times. Construction takes '_mutex' to serialize writers
+     * and marks the seqlock dirty so that concurrent getTime() callers retry their snapshot; the
+     * updated time is published on destruction. All updates made through a single TimeWriter are
+     * therefore observed atomically by readers. Writers must not block while holding one.
+     */
+    class TimeWriter {
+    public:
+        explicit TimeWriter(VectorClock* clock) : _clock(clock), _lock(clock->_mutex) {
+            _clock->_seq.fetchAndAdd(1);
+        }
+
+        ~TimeWriter() {
+            _clock->_seq.fetchAndAdd(1);
+        }
+
+        LogicalTime operator[](Component component) const {
+            return LogicalTime(Timestamp(_clock->_vectorTime[component].load()));
+        }
+
+        void set(Component component, LogicalTime time) {
+            _clock->_vectorTime[component].store(time.asTimestamp().asULL());
+        }
+
+    private:
+        VectorClock* const _clock;
+        stdx::lock_guard<stdx::mutex> _lock;
+    };
+
     /**
      * For each component in the LogicalTimeArray, sets the current time to newTime if the newTime >
      * current time and it passes the rate check.  If any component fails the rate check, then this
@@ -367,7 +397,9 @@ protected:
     // service context
     ServiceContext* _service{nullptr};
 
-    // Protects the fields below
+    // Serializes writers of '_vectorTime'. Readers do not take this mutex: getTime() snapshots the
+    // component times through the '_seq' seqlock instead, so that the per-command gossip-out path
+    // never contends with ticking.
     //
     // Note that ConfigTime is advanced under the ReplicationCoordinator mutex, so to avoid
     // potential deadlocks the ReplicationCoordator mutex should never be acquired whilst the
@@ -376,9 +408,6 @@ protected:
 
     AtomicWord<bool> _isEnabled{true};
 
-    LogicalTimeArray _vectorTime = {
-        kInitialComponentTime, kInitialComponentTime, kInitialComponentTime};
-
 private:
     class PlainComponentFormat;
     class SignedComponentFormat;
@@ -416,6 +445,16 @@ private:
                             Component component);
 
     static const ComponentArray<std::unique_ptr<ComponentFormat>> _gossipFormatters;
+
+    // Implements a seqlock over '_vectorTime': the counter is odd while a TimeWriter is mid-update
+    // and even otherwise. Readers retry their snapshot if the counter is odd or changes across the
+    // read, so they never observe a partially-applied update.
+    AtomicWord<uint64_t> _seq{0};
+
+    // The current time of each component, stored as the unsigned 64-bit representation of its
+    // Timestamp. Written only through TimeWriter; read with plain atomic loads validated against
+    // '_seq'.
+    ComponentArray<AtomicWord<uint64_t>> _vectorTime;
 };
 
 }  // namespace mongo
@@ -28,7 +28,6 @@
  */
 
 
-#include <mutex>
 #include <string>
 #include <utility>
 
@@ -39,7 +38,6 @@
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
-#include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/decorable.h"
@@ -80,9 +78,9 @@ void VectorClockMutable::registerVectorClockOnServiceContext(
 LogicalTime VectorClockMutable::_advanceComponentTimeByTicks(Component component, uint64_t nTicks) {
     invariant(nTicks > 0 && nTicks <= kMaxValue);
 
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    TimeWriter writer(this);
 
-    LogicalTime time = _vectorTime[component];
+    LogicalTime time = writer[component];
 
     const unsigned wallClockSecs =
         durationCount<Seconds>(_service->getFastClockSource()->now().toDurationSinceEpoch());
@@ -115,18 +113,19 @@ LogicalTime VectorClockMutable::_advanceComponentTimeByTicks(Component component
 
     // Save the next time.
     time.addTicks(1);
-    _vectorTime[component] = time;
+    auto reservedTime = time;
 
     // Add the rest of the requested ticks if needed.
     if (nTicks > 1) {
-        _vectorTime[component].addTicks(nTicks - 1);
+        reservedTime.addTicks(nTicks - 1);
     }
+    writer.set(component, reservedTime);
 
     return time;
 }
 
 void VectorClockMutable::_advanceComponentTimeTo(Component component, LogicalTime&& newTime) {
-    stdx::lock_guard<stdx::mutex> lock(_mutex);
+    TimeWriter writer(this);
 
     // Rate limit checks are skipped here so a server with no activity for longer than
     // maxAcceptableLogicalClockDriftSecs seconds can still have its cluster time initialized.
@@ -135,8 +134,8 @@ void VectorClockMutable::_advanceComponentTimeTo(Component component, LogicalTim
                           << " cannot be advanced beyond the maximum logical time value",
             _lessThanOrEqualToMaxPossibleTime(newTime, 0));
 
-    if (newTime > _vectorTime[component]) {
-        _vectorTime[component] = std::move(newTime);
+    if (newTime > writer[component]) {
+        writer.set(component, newTime);
     }
 }
 
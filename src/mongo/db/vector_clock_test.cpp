@@ -31,6 +31,7 @@
 #include <limits>
 #include <memory>
 #include <ratio>
+#include <vector>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
@@ -46,6 +47,8 @@
 #include "mongo/db/vector_clock_gen.h"
 #include "mongo/db/vector_clock_mutable.h"
 #include "mongo/db/vector_clock_test_fixture.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/assert_util.h"
@@ -346,5 +349,35 @@ TEST_F(VectorClockTest, RejectsLogicalTimesGreaterThanMaxTime) {
     ASSERT_EQ(getClusterTime(), VectorClock::kInitialComponentTime);
 }
 
+// Verify that concurrent readers always observe monotonic cluster times while the clock is being
+// ticked, ie. that the lock-free getTime() snapshot never returns a torn or stale value.
+TEST_F(VectorClockTest, ConcurrentReadersObserveMonotonicTime) {
+    auto clock = VectorClockMutable::get(getServiceContext());
+    clock->tickClusterTimeTo(buildLogicalTime(1, 1));
+
+    AtomicWord<bool> done{false};
+    std::vector<stdx::thread> readers;
+    for (int i = 0; i < 2; i++) {
+        readers.emplace_back([&] {
+            auto lastSeen = VectorClock::get(getServiceContext())->getTime().clusterTime();
+            while (!done.load()) {
+                auto seen = VectorClock::get(getServiceContext())->getTime().clusterTime();
+                ASSERT_GTE(seen, lastSeen);
+                lastSeen = seen;
+            }
+        });
+    }
+
+    for (int i = 0; i < 10'000; i++) {
+        clock->tickClusterTime(1);
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_GTE(getClusterTime(), buildLogicalTime(1, 10'001));
+}
+
 }  // unnamed namespace
 }  // namespace mongo
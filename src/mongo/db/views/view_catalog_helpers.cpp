@@ -47,6 +47,7 @@
 #include "mongo/db/basic_types_gen.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/catalog/views_for_database.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/pipeline/aggregate_command_gen.h"
 #include "mongo/db/pipeline/document_source.h"
@@ -180,6 +181,24 @@ StatusWith<ResolvedView> resolveView(OperationContext* opCtx,
                                      std::shared_ptr<const CollectionCatalog> catalog,
                                      const NamespaceString& nss,
                                      boost::optional<BSONObj> timeSeriesCollator) {
+    // Resolution of a chain without time-series views is fully determined by the view definitions,
+    // so repeated queries can reuse the cached result until the views of the database change.
+    // Time-series resolution additionally depends on options of the buckets collection which can
+    // change without a view catalog write, so it is never cached. A selective restore skips option
+    // checks entirely and bypasses the cache as well.
+    std::shared_ptr<ViewsForDatabase::ResolvedViewsCache> resolvedViewsCache;
+    if (!storageGlobalParams.restore && !timeSeriesCollator) {
+        resolvedViewsCache = catalog->getResolvedViewsCache(opCtx, nss.dbName());
+    }
+    if (resolvedViewsCache) {
+        if (auto cached = resolvedViewsCache->lookup(nss)) {
+            CurOp::get(opCtx)->debug().addResolvedViews(cached->dependencyChain, cached->pipeline);
+            return StatusWith<ResolvedView>({std::move(cached->resolvedNss),
+                                             std::move(cached->pipeline),
+                                             std::move(cached->collation)});
+        }
+    }
+
     // Points to the name of the most resolved namespace.
     const NamespaceString* resolvedNss = &nss;
 
@@ -219,6 +238,13 @@ StatusWith<ResolvedView> resolveView(OperationContext* opCtx,
             auto curOp = CurOp::get(opCtx);
             curOp->debug().addResolvedViews(dependencyChain, resolvedPipeline);
 
+            // Cache the result when at least one view was resolved and the chain did not involve
+            // a time-series view.
+            if (resolvedViewsCache && depth > 0 && !tsOptions) {
+                resolvedViewsCache->insert(
+                    nss, {*resolvedNss, resolvedPipeline, collation.value(), dependencyChain});
+            }
+
             return StatusWith<ResolvedView>(
                 {*resolvedNss,
                  std::move(resolvedPipeline),
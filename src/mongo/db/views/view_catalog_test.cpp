@@ -781,6 +781,56 @@ TEST_F(ViewCatalogFixture, ResolveViewCorrectPipeline) {
     }
 }
 
+TEST_F(ViewCatalogFixture, ResolveViewCachedResultInvalidatedOnModify) {
+    const NamespaceString view1 = NamespaceString::createNamespaceString_forTest("db.view1");
+    const NamespaceString view2 = NamespaceString::createNamespaceString_forTest("db.view2");
+    const NamespaceString viewOn = NamespaceString::createNamespaceString_forTest("db.coll");
+    BSONArrayBuilder pipeline1;
+    BSONArrayBuilder pipeline2;
+
+    pipeline1 << BSON("$match" << BSON("foo" << 1));
+    pipeline2 << BSON("$match" << BSON("foo" << 2));
+
+    ASSERT_OK(createView(operationContext(), view1, viewOn, pipeline1.arr(), emptyCollation));
+    ASSERT_OK(createView(operationContext(), view2, view1, pipeline2.arr(), emptyCollation));
+
+    // Resolve twice; the second resolution is served from the resolved views cache and must be
+    // identical to the first.
+    std::vector<BSONObj> expected = {BSON("$match" << BSON("foo" << 1)),
+                                     BSON("$match" << BSON("foo" << 2))};
+    for (int attempt = 0; attempt < 2; attempt++) {
+        Lock::DBLock dbLock(operationContext(), view1.dbName(), MODE_IS);
+        auto resolvedView =
+            view_catalog_helpers::resolveView(operationContext(), getCatalog(), view2, boost::none);
+        ASSERT(resolvedView.isOK());
+        ASSERT_EQ(resolvedView.getValue().getNamespace(), viewOn);
+
+        std::vector<BSONObj> result = resolvedView.getValue().getPipeline();
+        ASSERT_EQ(expected.size(), result.size());
+        for (uint32_t i = 0; i < expected.size(); i++) {
+            ASSERT(SimpleBSONObjComparator::kInstance.evaluate(expected[i] == result[i]));
+        }
+    }
+
+    // Modifying a view in the dependency chain must invalidate the cached resolution.
+    BSONArrayBuilder newPipeline1;
+    newPipeline1 << BSON("$match" << BSON("foo" << 3));
+    ASSERT_OK(modifyView(operationContext(), view1, viewOn, newPipeline1.arr()));
+
+    Lock::DBLock dbLock(operationContext(), view1.dbName(), MODE_IS);
+    auto resolvedView =
+        view_catalog_helpers::resolveView(operationContext(), getCatalog(), view2, boost::none);
+    ASSERT(resolvedView.isOK());
+
+    std::vector<BSONObj> expectedAfterModify = {BSON("$match" << BSON("foo" << 3)),
+                                                BSON("$match" << BSON("foo" << 2))};
+    std::vector<BSONObj> result = resolvedView.getValue().getPipeline();
+    ASSERT_EQ(expectedAfterModify.size(), result.size());
+    for (uint32_t i = 0; i < expectedAfterModify.size(); i++) {
+        ASSERT(SimpleBSONObjComparator::kInstance.evaluate(expectedAfterModify[i] == result[i]));
+    }
+}
+
 TEST_F(ViewCatalogFixture, ResolveViewOnCollectionNamespace) {
     const NamespaceString collectionNamespace =
         NamespaceString::createNamespaceString_forTest("db.coll");
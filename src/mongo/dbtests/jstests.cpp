@@ -1440,6 +1440,33 @@ public:
     }
 };
 
+/**
+ * Scopes retired with a reuse key are handed back only for the matching key, keeping their
+ * compiled-function cache.
+ */
+class ThreadScopeRecycling {
+public:
+    void run() {
+        auto* engine = getGlobalScriptEngine();
+        std::unique_ptr<Scope> scope(engine->newScopeForCurrentThread());
+        ScriptingFunction func = scope->createFunction("return 1;");
+        engine->recycleScopeForCurrentThread("keyA", std::move(scope));
+
+        // A different environment must not see the retired scope, nor discard it.
+        ASSERT(!engine->tryReuseScopeForCurrentThread("keyB"));
+
+        std::unique_ptr<Scope> reused = engine->tryReuseScopeForCurrentThread("keyA");
+        ASSERT(reused);
+        // The compiled-function cache survives recycling.
+        ASSERT_EQUALS(func, reused->createFunction("return 1;"));
+
+        // Only one scope is retained per thread; reuse empties the slot.
+        engine->recycleScopeForCurrentThread("keyA", std::move(reused));
+        ASSERT(engine->tryReuseScopeForCurrentThread("keyA"));
+        ASSERT(!engine->tryReuseScopeForCurrentThread("keyA"));
+    }
+};
+
 class All : public unittest::OldStyleSuiteSpecification {
 public:
     All() : OldStyleSuiteSpecification("js") {}
@@ -1497,6 +1524,8 @@ public:
     void setupTests() override {
         setupTestsWithScopeFactory<&ScriptEngine::newScope>();
         setupTestsWithScopeFactory<&ScriptEngine::newScopeForCurrentThread>();
+
+        add<ThreadScopeRecycling>();
     }
 };
 
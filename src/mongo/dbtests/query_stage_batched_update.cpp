@@ -0,0 +1,300 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * This file tests the BatchedUpdateStage class
+ */
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/none.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/json.h"
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/client.h"
+#include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/curop.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/exec/batched_update_stage.h"
+#include "mongo/db/exec/collection_scan.h"
+#include "mongo/db/exec/collection_scan_common.h"
+#include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/plan_stats.h"
+#include "mongo/db/exec/working_set.h"
+#include "mongo/db/matcher/expression_with_placeholder.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/find_command.h"
+#include "mongo/db/query/plan_executor.h"
+#include "mongo/db/query/write_ops/update_request.h"
+#include "mongo/db/query/write_ops/write_ops_parsers.h"
+#include "mongo/db/record_id.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/shard_role.h"
+#include "mongo/db/update/update_driver.h"
+#include "mongo/dbtests/dbtests.h"  // IWYU pragma: keep
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/intrusive_counter.h"
+
+namespace mongo {
+namespace QueryStageBatchedUpdate {
+
+static const NamespaceString nss =
+    NamespaceString::createNamespaceString_forTest("unittests.QueryStageBatchedUpdate");
+
+// For the following tests, fix the targetBatchDocs to 10 documents.
+static const int targetBatchDocs = 10;
+
+class QueryStageBatchedUpdateTest : public unittest::Test {
+public:
+    QueryStageBatchedUpdateTest() : _client(&_opCtx) {
+        dbtests::WriteContextForTests ctx(&_opCtx, nss.ns_forTest());
+        _client.dropCollection(nss);
+        _client.createCollection(nss);
+    }
+
+    ~QueryStageBatchedUpdateTest() override {
+        _client.dropCollection(nss);
+    }
+
+    // Populates the collection with nDocs of shape {_id: <int i>, a: <int i>}.
+    void prePopulateCollection(int nDocs) {
+        for (int i = 0; i < nDocs; i++) {
+            insert(BSON("_id" << i << "a" << i));
+        }
+    }
+
+    void insert(const BSONObj& obj) {
+        _client.insert(nss, obj);
+    }
+
+    void remove(const BSONObj& obj) {
+        _client.remove(nss, obj);
+    }
+
+    size_t count(const BSONObj& query) {
+        return _client.count(nss, query, 0, 0, 0);
+    }
+
+    void getRecordIds(const CollectionPtr& collection,
+                      CollectionScanParams::Direction direction,
+                      std::vector<RecordId>* out) {
+        WorkingSet ws;
+
+        CollectionScanParams params;
+        params.direction = direction;
+        params.tailable = false;
+
+        std::unique_ptr<CollectionScan> scan(
+            new CollectionScan(_expCtx.get(), &collection, params, &ws, nullptr));
+        while (!scan->isEOF()) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state = scan->work(&id);
+            if (PlanStage::ADVANCED == state) {
+                WorkingSetMember* member = ws.get(id);
+                MONGO_verify(member->hasRecordId());
+                out->push_back(member->recordId);
+            }
+        }
+    }
+
+    std::unique_ptr<CanonicalQuery> canonicalize(const BSONObj& query) {
+        auto findCommand = std::make_unique<FindCommandRequest>(nss);
+        findCommand->setFilter(query);
+        return std::make_unique<CanonicalQuery>(CanonicalQueryParams{
+            .expCtx = ExpressionContextBuilder{}.fromRequest(&_opCtx, *findCommand).build(),
+            .parsedFind = ParsedFindCommandParams{std::move(findCommand)}});
+    }
+
+    // Configures 'request' and 'driver' as a multi-update applying 'updates' to the documents
+    // matching 'query'. Both must outlive the stage built over them.
+    void parseUpdateRequest(UpdateRequest* request,
+                            UpdateDriver* driver,
+                            const BSONObj& query,
+                            const BSONObj& updates) {
+        request->setNamespaceString(nss);
+        request->setMulti();
+        request->setQuery(query);
+        request->setUpdateModification(
+            write_ops::UpdateModification::parseFromClassicUpdate(updates));
+        request->setYieldPolicy(PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY);
+
+        const std::map<StringData, std::unique_ptr<ExpressionWithPlaceholder>> arrayFilters;
+        ASSERT_DOES_NOT_THROW(driver->parse(
+            request->getUpdateModification(), arrayFilters, boost::none, request->isMulti()));
+    }
+
+    // Defaults batch params to the test default for targetBatchDocs, with no time or size limits.
+    std::unique_ptr<BatchedUpdateStage> makeBatchedUpdateStage(WorkingSet* ws,
+                                                               CollectionAcquisition coll,
+                                                               UpdateRequest* request,
+                                                               UpdateDriver* driver,
+                                                               CanonicalQuery* cq) {
+        UpdateStageParams updateParams(request, driver, &CurOp::get(_opCtx)->debug());
+        updateParams.canonicalQuery = cq;
+
+        auto batchedUpdateParams = std::make_unique<BatchedUpdateStageParams>();
+        batchedUpdateParams->targetBatchDocs = targetBatchDocs;
+        batchedUpdateParams->targetBatchTimeMS = Milliseconds(0);
+
+        CollectionScanParams collScanParams;
+        const MatchExpression* filter = cq ? cq->getPrimaryMatchExpression() : nullptr;
+        return std::make_unique<BatchedUpdateStage>(
+            _expCtx.get(),
+            updateParams,
+            std::move(batchedUpdateParams),
+            ws,
+            coll,
+            new CollectionScan(_expCtx.get(), coll, collScanParams, ws, filter));
+    }
+
+protected:
+    const ServiceContext::UniqueOperationContext _opCtxPtr = cc().makeOperationContext();
+    OperationContext& _opCtx = *_opCtxPtr;
+
+    boost::intrusive_ptr<ExpressionContext> _expCtx =
+        ExpressionContextBuilder{}.opCtx(&_opCtx).ns(nss).build();
+
+private:
+    DBDirectClient _client;
+};
+
+// Confirms batched updates wait until a batch meets the targetBatchDocs before applying updates.
+TEST_F(QueryStageBatchedUpdateTest, BatchedUpdateTargetBatchDocsBasic) {
+    auto nDocs = 52;
+    prePopulateCollection(nDocs);
+
+    const auto coll = acquireCollection(
+        &_opCtx,
+        CollectionAcquisitionRequest::fromOpCtx(&_opCtx, nss, AcquisitionPrerequisites::kWrite),
+        MODE_IX);
+    ASSERT(coll.exists());
+
+    UpdateRequest request;
+    UpdateDriver driver(_expCtx);
+    parseUpdateRequest(&request, &driver, BSONObj(), fromjson("{$set: {b: 1}}"));
+    auto cq = canonicalize(BSONObj());
+
+    WorkingSet ws;
+    auto updateStage = makeBatchedUpdateStage(&ws, coll, &request, &driver, cq.get());
+    const UpdateStats* stats = static_cast<const UpdateStats*>(updateStage->getSpecificStats());
+
+    int nIterations = 0;
+    PlanStage::StageState state = PlanStage::NEED_TIME;
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    while ((state = updateStage->work(&id)) != PlanStage::IS_EOF) {
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+
+        // Only update documents once the current batch reaches targetBatchDocs.
+        nIterations++;
+        int batch = nIterations / (int)targetBatchDocs;
+        ASSERT_EQUALS(stats->nModified, static_cast<size_t>(targetBatchDocs * batch));
+    }
+
+    // There should be 2 more docs updated by the time the command returns EOF.
+    ASSERT_EQUALS(state, PlanStage::IS_EOF);
+    ASSERT_EQUALS(stats->nModified, static_cast<size_t>(nDocs));
+    ASSERT_EQUALS(stats->nMatched, static_cast<size_t>(nDocs));
+
+    // Every document should carry the update.
+    ASSERT_EQUALS(count(fromjson("{b: 1}")), static_cast<size_t>(nDocs));
+}
+
+// A staged document is removed while the BatchedUpdateStage is in a savedState. Upon restoring its
+// state, BatchedUpdateStage's snapshot is incremented and it can see the document has been removed
+// and skips over it.
+TEST_F(QueryStageBatchedUpdateTest, BatchedUpdateStagedDocIsDeleted) {
+    auto nDocs = 11;
+    prePopulateCollection(nDocs);
+
+    const auto coll = acquireCollection(
+        &_opCtx,
+        CollectionAcquisitionRequest::fromOpCtx(&_opCtx, nss, AcquisitionPrerequisites::kWrite),
+        MODE_IX);
+    ASSERT(coll.exists());
+
+    // Get the RecordIds that would be returned by an in-order scan.
+    std::vector<RecordId> recordIds;
+    getRecordIds(coll.getCollectionPtr(), CollectionScanParams::FORWARD, &recordIds);
+
+    UpdateRequest request;
+    UpdateDriver driver(_expCtx);
+    parseUpdateRequest(&request, &driver, BSONObj(), fromjson("{$set: {b: 1}}"));
+    auto cq = canonicalize(BSONObj());
+
+    WorkingSet ws;
+    auto updateStage = makeBatchedUpdateStage(&ws, coll, &request, &driver, cq.get());
+    const UpdateStats* stats = static_cast<const UpdateStats*>(updateStage->getSpecificStats());
+
+    // Index to pause at before fetching the remaining documents into the update batch.
+    int pauseBatchingIdx = 6;
+
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    PlanStage::StageState state = PlanStage::NEED_TIME;
+    for (int i = 0; i < pauseBatchingIdx; i++) {
+        updateStage->work(&id);
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+        ASSERT_EQUALS(stats->nModified, 0U);
+    }
+
+    {
+        // Delete a document that has already been added to the update batch.
+        updateStage->saveState();
+        BSONObj targetDoc =
+            coll.getCollectionPtr()->docFor(&_opCtx, recordIds[pauseBatchingIdx - 2]).value();
+        ASSERT(!targetDoc.isEmpty());
+        remove(targetDoc);
+        // Increases the snapshotId.
+        updateStage->restoreState(&coll.getCollectionPtr());
+    }
+
+    while ((state = updateStage->work(&id)) != PlanStage::IS_EOF) {
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+    }
+
+    ASSERT_EQUALS(stats->nModified, static_cast<size_t>(nDocs - 1));
+    ASSERT_EQUALS(count(fromjson("{b: 1}")), static_cast<size_t>(nDocs - 1));
+}
+
+}  // namespace QueryStageBatchedUpdate
+}  // namespace mongo
@@ -374,6 +374,64 @@ TEST_F(QueryStageMultiPlanTest, MPSCollectionScanVsHighlySelectiveIXScan) {
     ASSERT_EQUALS(results, N / 10);
 }
 
+// When progressive pruning is enabled, a candidate which is far less productive than the leader
+// stops receiving works partway through the trial period.
+TEST_F(QueryStageMultiPlanTest, MPSProgressivePruningStopsUnproductiveCandidate) {
+    RAIIServerParameterControllerForTest pruningController(
+        "internalQueryPlanEvaluationProgressivePruning", true);
+    // Keep the trial period length deterministic and long enough for the pruning warm-up period
+    // (a quarter of the trial) to elapse before the index scan reaches EOF.
+    RAIIServerParameterControllerForTest worksController("internalQueryPlanEvaluationWorks", 600);
+    RAIIServerParameterControllerForTest collFractionController(
+        "internalQueryPlanEvaluationCollFraction", 0.3);
+    RAIIServerParameterControllerForTest maxResultsController(
+        "internalQueryPlanEvaluationMaxResults", 1000);
+
+    const int N = 2000;
+    for (int i = 0; i < N; ++i) {
+        insert(BSON("foo" << (i % 10)));
+    }
+    addIndex(BSON("foo" << 1));
+
+    AutoGetCollectionForReadCommand ctx(_opCtx.get(), nss);
+    const CollectionPtr& coll = ctx.getCollection();
+
+    // Plan 0: IXScan over foo == 7, advancing on every work. Plan 1: CollScan with matcher,
+    // advancing on roughly every tenth work.
+    unique_ptr<WorkingSet> sharedWs(new WorkingSet());
+    unique_ptr<PlanStage> ixScanRoot = getIxScanPlan(_expCtx.get(), coll, sharedWs.get(), 7);
+    const auto* ixScanRootPtr = ixScanRoot.get();
+
+    BSONObj filterObj = BSON("foo" << 7);
+    unique_ptr<MatchExpression> filter = makeMatchExpressionFromFilter(_expCtx.get(), filterObj);
+    unique_ptr<PlanStage> collScanRoot =
+        getCollScanPlan(_expCtx.get(), coll, sharedWs.get(), filter.get());
+
+    auto cq = makeCanonicalQuery(_opCtx.get(), nss, filterObj);
+
+    unique_ptr<MultiPlanStage> mps = std::make_unique<MultiPlanStage>(
+        _expCtx.get(),
+        &ctx.getCollection(),
+        cq.get(),
+        plan_cache_util::ClassicPlanCacheWriter{
+            opCtx(), &ctx.getCollection(), false /* executeInSbe */});
+    mps->addPlan(createQuerySolution(), std::move(ixScanRoot), sharedWs.get());
+    mps->addPlan(createQuerySolution(), std::move(collScanRoot), sharedWs.get());
+
+    NoopYieldPolicy yieldPolicy(_opCtx.get(), serviceContext()->getFastClockSource());
+    ASSERT_OK(mps->pickBestPlan(&yieldPolicy));
+    ASSERT_TRUE(mps->bestPlanChosen());
+    ASSERT_EQUALS(getBestPlanRoot(mps.get()), ixScanRootPtr);
+
+    // Without pruning, the round-robin trial gives every candidate the same number of works. The
+    // collection scan must have been cut off well before the index scan finished its trial.
+    auto stats = mps->getStats();
+    ASSERT_EQUALS(stats->children.size(), 2U);
+    const auto ixScanWorks = stats->children[0]->common.works;
+    const auto collScanWorks = stats->children[1]->common.works;
+    ASSERT_LT(collScanWorks + 20, ixScanWorks);
+}
+
 TEST_F(QueryStageMultiPlanTest, MPSDoesNotCreateActiveCacheEntryImmediately) {
     const int N = 100;
     for (int i = 0; i < N; ++i) {
@@ -413,4 +413,51 @@ ExecutorFuture<AsyncRPCResponse<typename CommandType::Reply>> sendCommand(
     return sendCommand(options, opCtx, cstr);
 }
 
+/**
+ * Execute the same command asynchronously against several targets, returning one future per
+ * target in the same order as `targeters`.
+ *
+ * Unlike issuing N separate `sendCommand` calls, the command is serialized to BSON exactly
+ * once and the resulting buffer is shared (by refcount) across all sends, which matters for
+ * wide fan-outs of large commands. Each send otherwise behaves identically to `sendCommand`,
+ * including per-target retries according to the options' retry policy; all sends share the
+ * options' cancellation token and client operation key.
+ */
+template <typename CommandType>
+std::vector<ExecutorFuture<AsyncRPCResponse<typename CommandType::Reply>>> sendBatchedCommand(
+    std::shared_ptr<AsyncRPCOptions<CommandType>> options,
+    OperationContext* opCtx,
+    std::vector<std::unique_ptr<Targeter>> targeters) {
+    auto runner = detail::AsyncRPCRunner::get(opCtx->getServiceContext());
+    createOperationKeyIfNeeded(options->cmd.getGenericArguments());
+    auto cmdBSON = options->cmd.toBSON();
+
+    std::vector<ExecutorFuture<AsyncRPCResponse<typename CommandType::Reply>>> futures;
+    futures.reserve(targeters.size());
+    for (auto& targeter : targeters) {
+        futures.push_back(
+            detail::sendCommandWithRunner(options, opCtx, runner, std::move(targeter), cmdBSON));
+    }
+    return futures;
+}
+
+/**
+ * This overloaded version of 'sendBatchedCommand' uses ShardIds instead of Targeters, for the
+ * common scatter-gather case of fanning one command out to a set of shards.
+ */
+template <typename CommandType>
+std::vector<ExecutorFuture<AsyncRPCResponse<typename CommandType::Reply>>> sendBatchedCommand(
+    std::shared_ptr<AsyncRPCOptions<CommandType>> options,
+    OperationContext* opCtx,
+    const std::vector<ShardId>& shardIds) {
+    ReadPreferenceSetting readPref;
+    std::vector<std::unique_ptr<Targeter>> targeters;
+    targeters.reserve(shardIds.size());
+    for (const auto& shardId : shardIds) {
+        targeters.push_back(
+            std::make_unique<ShardIdTargeter>(options->exec, opCtx, shardId, readPref));
+    }
+    return sendBatchedCommand(options, opCtx, std::move(targeters));
+}
+
 }  // namespace mongo::async_rpc
@@ -211,6 +211,47 @@ TEST_F(AsyncRPCTestFixture, ConnectionStringOverload) {
     ASSERT_EQ(kTestStandaloneHost, res.targetUsed);
 }
 
+/*
+ * Test that 'sendBatchedCommand' fans one command out to several targets, sharing a single
+ * serialization of the command body, and returns a future per target.
+ */
+TEST_F(AsyncRPCTestFixture, BatchedCommand) {
+    HelloCommandReply helloReply = HelloCommandReply(TopologyVersion(OID::gen(), 0));
+    HelloCommand helloCmd;
+    initializeCommand(helloCmd);
+
+    const HostAndPort host1("FakeHost1", 12345);
+    const HostAndPort host2("FakeHost2", 12345);
+    std::vector<std::unique_ptr<Targeter>> targeters;
+    targeters.push_back(std::make_unique<FixedTargeter>(host1));
+    targeters.push_back(std::make_unique<FixedTargeter>(host2));
+
+    auto opCtxHolder = makeOperationContext();
+    auto options = std::make_shared<AsyncRPCOptions<HelloCommand>>(
+        getExecutorPtr(), _cancellationToken, helloCmd);
+    auto futures = sendBatchedCommand(options, opCtxHolder.get(), std::move(targeters));
+    ASSERT_EQ(futures.size(), 2);
+
+    onCommands({[&](const auto& request) {
+                    ASSERT(request.cmdObj["hello"]);
+                    ASSERT_EQ(host1, request.target);
+                    return helloReply.toBSON();
+                },
+                [&](const auto& request) {
+                    ASSERT(request.cmdObj["hello"]);
+                    ASSERT_EQ(host2, request.target);
+                    return helloReply.toBSON();
+                }});
+
+    AsyncRPCResponse res1 = futures[0].get();
+    AsyncRPCResponse res2 = futures[1].get();
+
+    ASSERT_BSONOBJ_EQ(res1.response.toBSON(), helloReply.toBSON());
+    ASSERT_EQ(host1, res1.targetUsed);
+    ASSERT_BSONOBJ_EQ(res2.response.toBSON(), helloReply.toBSON());
+    ASSERT_EQ(host2, res2.targetUsed);
+}
+
 /*
  * Verify that generic command arguments are correctly serialized into the BSON builder of a
  * command, and that generic reply fields are correctly parsed from the network response.
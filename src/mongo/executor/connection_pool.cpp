@@ -167,8 +167,9 @@ std::string ConnectionPool::ConnectionControls::toString() const {
 }
 
 std::string ConnectionPool::HostState::toString() const {
-    return "{{ requests: {}, ready: {}, pending: {}, active: {}, leased: {}, isExpired: {} }}"_format(
-        requests, ready, pending, active, leased, health.isExpired);
+    return "{{ requests: {}, ready: {}, pending: {}, active: {}, leased: {}, forecasted: {}, "
+           "isExpired: {} }}"_format(
+               requests, ready, pending, active, leased, forecastedRequests, health.isExpired);
 }
 
 /**
@@ -192,7 +193,7 @@ public:
         const auto minConns = getPool()->_options.minConnections;
         const auto maxConns = getPool()->_options.maxConnections;
 
-        data.target = stats.requests + stats.active + stats.leased;
+        data.target = stats.requests + stats.forecastedRequests + stats.active + stats.leased;
         if (data.target < minConns) {
             data.target = minConns;
         } else if (data.target > maxConns) {
@@ -258,6 +259,11 @@ class ConnectionPool::SpecificPool final
     : public std::enable_shared_from_this<ConnectionPool::SpecificPool> {
     static constexpr auto kDiagnosticLogLevel = 4;
 
+    // Demand forecasting (see Options::demandForecastWindow) samples concurrent demand at most
+    // this often, and smooths the observed rate of change with this exponential weight.
+    static constexpr auto kDemandSamplePeriod = Milliseconds(100);
+    static constexpr double kDemandTrendSmoothing = 0.3;
+
 public:
     /**
      * Whenever a function enters a specific pool, the function needs to be guarded by the lock.
@@ -516,6 +522,13 @@ private:
 
     OwnedConnection takeFromProcessingPool(WithLock, ConnectionInterface* connection);
 
+    /**
+     * Returns the number of additional requests we predict will arrive within the demand
+     * forecast window, given the current concurrent demand. Samples the demand trend as a side
+     * effect. Returns zero when forecasting is disabled or demand is flat or falling.
+     */
+    size_t forecastedDemand(WithLock, size_t demand);
+
     // Update the health struct and related variables
     void updateHealth();
 
@@ -543,6 +556,12 @@ private:
     stdx::unordered_map<std::uint64_t, Requests::iterator> _requestsById;
     Date_t _lastActiveTime;
 
+    // Smoothed rate of change of concurrent demand, in requests per millisecond, along with the
+    // demand observed at the last sample. Only maintained when demand forecasting is enabled.
+    double _demandTrend = 0.0;
+    size_t _lastDemand = 0;
+    Date_t _lastDemandSample;
+
     std::shared_ptr<TimerInterface> _eventTimer;
     Date_t _eventTimerExpiration;
     Date_t _hostExpiration;
@@ -1444,6 +1463,34 @@ ConnectionPool::SpecificPool::OwnedConnection ConnectionPool::SpecificPool::take
     return takeFromPool(lk, _droppedProcessingPool, connPtr);
 }
 
+size_t ConnectionPool::SpecificPool::forecastedDemand(WithLock, size_t demand) {
+    const auto window = _parent->_options.demandForecastWindow;
+    if (window <= Milliseconds{0}) {
+        return 0;
+    }
+
+    const auto now = _parent->_factory->now();
+    if (_lastDemandSample == Date_t{}) {
+        _lastDemand = demand;
+        _lastDemandSample = now;
+        return 0;
+    }
+
+    if (const auto elapsed = now - _lastDemandSample; elapsed >= kDemandSamplePeriod) {
+        const auto slope = (static_cast<double>(demand) - static_cast<double>(_lastDemand)) /
+            durationCount<Milliseconds>(elapsed);
+        _demandTrend = kDemandTrendSmoothing * slope + (1 - kDemandTrendSmoothing) * _demandTrend;
+        _lastDemand = demand;
+        _lastDemandSample = now;
+    }
+
+    if (_demandTrend <= 0.0) {
+        return 0;
+    }
+
+    return static_cast<size_t>(_demandTrend * durationCount<Milliseconds>(window));
+}
+
 void ConnectionPool::SpecificPool::updateHealth() {
     const auto now = _parent->_factory->now();
 
@@ -1537,6 +1584,7 @@ void ConnectionPool::SpecificPool::updateController(stdx::unique_lock<stdx::mute
         inUseConnections(lk),
         leasedConnections(lk),
     };
+    state.forecastedRequests = forecastedDemand(lk, state.requests + state.active + state.leased);
     LOGV2_DEBUG(22578,
                 kDiagnosticLogLevel,
                 "Updating pool controller",
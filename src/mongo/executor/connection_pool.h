@@ -157,6 +157,15 @@ public:
          */
         Milliseconds hostTimeout = kDefaultHostTimeout;
 
+        /**
+         * Amount of time of demand history to project forward when sizing a host's pool. When
+         * nonzero, each specific pool tracks the trend in its concurrent demand and reports a
+         * forecast to the controller, so that connections for a traffic ramp are established
+         * ahead of the requests that will use them rather than each paying full
+         * connect+handshake latency at checkout. Zero disables forecasting.
+         */
+        Milliseconds demandForecastWindow = Milliseconds{0};
+
         /**
          * An egress tag closer manager which will provide global access to this connection pool.
          * The manager set's tags and potentially drops connections that don't match those tags.
@@ -236,6 +245,13 @@ public:
         size_t active = 0;
         size_t leased = 0;
 
+        /**
+         * Additional requests the pool predicts will arrive within the demand forecast window,
+         * based on the recent trend in concurrent demand. Always zero when forecasting is
+         * disabled. Controllers may fold this into their connection target.
+         */
+        size_t forecastedRequests = 0;
+
         std::string toString() const;
     };
 
@@ -1309,6 +1309,79 @@ TEST_F(ConnectionPoolTest, minPoolRespected) {
     ASSERT(!reachedC);
 }
 
+/**
+ * Verify that a rising demand trend pre-establishes connections beyond the outstanding
+ * requests when demand forecasting is enabled.
+ */
+TEST_F(ConnectionPoolTest, demandForecastSpawnsAheadOfRequests) {
+    ConnectionPool::Options options;
+    options.maxConnections = 10;
+    options.demandForecastWindow = Milliseconds(1000);
+    auto pool = makePool(options);
+
+    auto now = Date_t::now();
+
+    PoolImpl::setNow(now);
+
+    size_t setups = 0;
+    for (size_t i = 0; i < 10; ++i) {
+        ConnectionImpl::pushSetup([&]() {
+            ++setups;
+            return Status::OK();
+        });
+    }
+
+    // One connection at t=0 establishes the demand baseline.
+    ConnectionPool::ConnectionHandle conn1;
+    unittest::threadAssertionMonitoredTest([&](auto& monitor) {
+        pool->get_forTest(HostAndPort(),
+                          Milliseconds(5000),
+                          [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                              monitor.exec([&]() {
+                                  ASSERT(swConn.isOK());
+                                  conn1 = std::move(swConn.getValue());
+                              });
+                          });
+    });
+    ASSERT_EQ(setups, 1u);
+
+    // Demand ramps to three concurrent connections 200ms later. With a 1000ms forecast window,
+    // the pool should spawn for the projected demand as well, not just the requests in hand.
+    PoolImpl::setNow(now + Milliseconds(200));
+
+    ConnectionPool::ConnectionHandle conn2;
+    ConnectionPool::ConnectionHandle conn3;
+    unittest::threadAssertionMonitoredTest([&](auto& monitor) {
+        pool->get_forTest(HostAndPort(),
+                          Milliseconds(5000),
+                          [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                              monitor.exec([&]() {
+                                  ASSERT(swConn.isOK());
+                                  conn2 = std::move(swConn.getValue());
+                              });
+                          });
+    });
+    unittest::threadAssertionMonitoredTest([&](auto& monitor) {
+        pool->get_forTest(HostAndPort(),
+                          Milliseconds(5000),
+                          [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                              monitor.exec([&]() {
+                                  ASSERT(swConn.isOK());
+                                  conn3 = std::move(swConn.getValue());
+                              });
+                          });
+    });
+    ASSERT(conn2);
+    ASSERT(conn3);
+
+    // More connections were established than the three demanded, but nowhere near the maximum.
+    ASSERT_GT(setups, 3u);
+    ASSERT_LT(setups, options.maxConnections);
+
+    doneWith(conn1);
+    doneWith(conn2);
+    doneWith(conn3);
+}
 
 /**
  * Verify that the hostTimeout is respected. This implies that an idle
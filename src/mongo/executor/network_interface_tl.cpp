@@ -129,6 +129,17 @@ auto& numConnectionNetworkTimeouts =
 auto& timeSpentWaitingBeforeConnectionTimeoutMillis =
     *MetricBuilder<Counter64>("operation.totalTimeWaitingBeforeConnectionTimeoutMillis");
 
+/**
+ * Monitoring RPCs are routed over a dedicated per-host channel rather than pooled
+ * connections. Awaitable hello monitoring uses the exhaust path and holds its own
+ * connection, so only the request/response forms are matched here.
+ */
+bool isMonitoringCommand(const BSONObj& cmdObj) {
+    auto name = cmdObj.firstElementFieldNameStringData();
+    return name == "replSetHeartbeat" || name == "hello" || name == "isMaster" ||
+        name == "ismaster";
+}
+
 void appendMetadata(RemoteCommandRequest* request,
                     const std::unique_ptr<rpc::EgressMetadataHook>& hook) {
     if (hook) {
@@ -347,6 +358,12 @@ void NetworkInterfaceTL::shutdown() {
         cmdState->cancel({ErrorCodes::ShutdownInProgress, kShutdownInProgressMsg});
     }
 
+    // Release the leases on any cached monitoring channels before tearing down the factory.
+    {
+        stdx::lock_guard lk(_mutex);
+        _monitoringChannels.clear();
+    }
+
     // This prevents new timers from being set, cancels any ongoing operations on all connections,
     // and destructs all connections for all existing pools.
     _clientFactory->shutdown();
@@ -551,6 +568,10 @@ void NetworkInterfaceTL::CommandStateBase::returnConnection(Status status) {
 
     connToReturn->indicateUsed();
     connToReturn->indicateSuccess();
+
+    if (viaMonitoringChannel) {
+        interface->_releaseMonitoringChannel(request.target, std::move(connToReturn));
+    }
 }
 
 void NetworkInterfaceTL::_unregisterCommand(const TaskExecutor::CallbackHandle& cbHandle) {
@@ -577,6 +598,7 @@ SemiFuture<RemoteCommandResponse> NetworkInterfaceTL::startCommand(
     appendMetadata(&request, _metadataHook);
 
     auto cmdState = std::make_shared<CommandState>(this, request, cbHandle, baton, token);
+    cmdState->viaMonitoringChannel = isMonitoringCommand(cmdState->request.cmdObj);
     _registerCommand(cmdState->cbHandle, cmdState);
 
     return _runCommand(cmdState).semi();
@@ -830,9 +852,51 @@ void NetworkInterfaceTL::dropConnections(const HostAndPort& hostAndPort) {
         return;
     }
 
+    {
+        stdx::lock_guard lk(_mutex);
+        _monitoringChannels.erase(hostAndPort);
+    }
+
     _clientFactory->dropConnections(hostAndPort);
 }
 
+std::shared_ptr<AsyncClientFactory::AsyncClientHandle> NetworkInterfaceTL::_takeMonitoringChannel(
+    const HostAndPort& target) {
+    stdx::lock_guard lk(_mutex);
+    auto it = _monitoringChannels.find(target);
+    if (it == _monitoringChannels.end()) {
+        return nullptr;
+    }
+
+    auto handle = std::move(it->second.handle);
+    _monitoringChannels.erase(it);
+    return handle;
+}
+
+void NetworkInterfaceTL::_releaseMonitoringChannel(
+    const HostAndPort& target, std::shared_ptr<AsyncClientFactory::AsyncClientHandle> handle) {
+    const auto current = now();
+
+    stdx::lock_guard lk(_mutex);
+    if (_inShutdown_inlock(lk)) {
+        return;
+    }
+
+    // Drop channels for hosts that monitoring has stopped contacting; destroying the handle
+    // releases the underlying lease.
+    for (auto it = _monitoringChannels.begin(); it != _monitoringChannels.end();) {
+        if (current - it->second.lastUsed >= _connPoolOpts.hostTimeout) {
+            it = _monitoringChannels.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Keep at most one cached channel per host; a concurrent monitoring RPC that fell back to
+    // a fresh lease may have returned its connection first, in which case this one is dropped.
+    _monitoringChannels.try_emplace(target, MonitoringChannel{std::move(handle), current});
+}
+
 AsyncDBClient* NetworkInterfaceTL::LeasedStream::getClient() {
     return &_clientHandle->getClient();
 }
@@ -881,6 +945,18 @@ NetworkInterfaceTL::CommandStateBase::getClient(AsyncClientFactory& factory) {
     if (!failPointStatus.isOK()) {
         return failPointStatus;
     }
+
+    if (viaMonitoringChannel) {
+        if (auto channel = interface->_takeMonitoringChannel(request.target)) {
+            return SemiFuture<std::shared_ptr<AsyncClientFactory::AsyncClientHandle>>::makeReady(
+                std::move(channel));
+        }
+
+        // No idle channel for this host (first contact, or another monitoring RPC holds it);
+        // lease a fresh connection that will seed the channel when it is returned.
+        return factory.lease(request.target, request.sslMode, request.timeout, cancelSource.token());
+    }
+
     return factory.get(request.target, request.sslMode, request.timeout, cancelSource.token());
 }
 
@@ -219,6 +219,10 @@ private:
 
         std::shared_ptr<AsyncClientFactory::AsyncClientHandle> clientHandle;
 
+        // True when this command is a monitoring RPC that should be carried over the
+        // interface's dedicated per-host monitoring channel instead of a pooled connection.
+        bool viaMonitoringChannel = false;
+
         CancellationSource cancelSource;
 
         stdx::mutex cancelMutex;
@@ -293,6 +297,22 @@ private:
      */
     void _removeAlarm(std::uint64_t id);
 
+    /**
+     * Takes the cached monitoring channel for the given host, if one is available. The caller
+     * owns the returned handle until it is handed back via _releaseMonitoringChannel (or
+     * dropped on failure, which releases the underlying lease).
+     */
+    std::shared_ptr<AsyncClientFactory::AsyncClientHandle> _takeMonitoringChannel(
+        const HostAndPort& target);
+
+    /**
+     * Caches a monitoring connection for reuse by the next monitoring RPC to the same host.
+     * Also drops cached channels that have sat idle past the pool's host timeout, so leases
+     * don't outlive the hosts monitoring has stopped contacting.
+     */
+    void _releaseMonitoringChannel(const HostAndPort& target,
+                                   std::shared_ptr<AsyncClientFactory::AsyncClientHandle> handle);
+
     ExecutorFuture<RemoteCommandResponse> _runCommand(std::shared_ptr<CommandStateBase> cmdState);
 
     std::string _instanceName;
@@ -355,6 +375,20 @@ private:
     AtomicWord<std::uint64_t> nextAlarmId{0};
     stdx::unordered_map<std::uint64_t, std::weak_ptr<AlarmState>> _inProgressAlarms;
 
+    /**
+     * A leased connection dedicated to monitoring RPCs (replSetHeartbeat and non-exhaust
+     * hello) for a single host. Monitoring traffic is small, frequent, and serial per target,
+     * so carrying it over one persistent connection keeps it from churning - and competing
+     * for - the pooled connections used by regular commands.
+     */
+    struct MonitoringChannel {
+        std::shared_ptr<AsyncClientFactory::AsyncClientHandle> handle;
+        Date_t lastUsed;
+    };
+
+    // Guarded by _mutex. Holds at most one idle channel per host.
+    stdx::unordered_map<HostAndPort, MonitoringChannel> _monitoringChannels;
+
     stdx::condition_variable _workReadyCond;
     bool _isExecutorRunnable = false;
 };
@@ -42,6 +42,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/smart_ptr/make_shared_object.hpp>
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <deque>
 #include <exception>
 #include <fmt/format.h>
 #include <fstream>  // IWYU pragma: keep
@@ -61,9 +62,13 @@
 #include "mongo/logv2/log_tag.h"
 #include "mongo/logv2/log_truncation.h"
 #include "mongo/logv2/shared_access_fstream.h"  // IWYU pragma: keep
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/thread_name.h"
 #include "mongo/util/exit_code.h"
+#include "mongo/util/producer_consumer_queue.h"
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/stacktrace.h"
 #include "mongo/util/string_map.h"
@@ -95,17 +100,58 @@ StatusWith<boost::shared_ptr<stream_t>> openFile(const std::string& filename, bo
         file->put('\n');
     return file;
 }
+
+// Bounds on the async queue: enough to ride out transient disk stalls without letting a dead disk
+// consume unbounded memory. Measured in formatted record bytes.
+constexpr size_t kAsyncMaxQueuedBytes = 16 * 1024 * 1024;
+
+// Upper bound on the number of bytes the writer thread takes out of the queue at a time.
+constexpr size_t kAsyncBatchBytes = 1024 * 1024;
+
+// Cost function measuring the queue depth in bytes. The +1 accounts for the newline appended on
+// write and keeps the cost of an empty record non-zero, as the queue requires.
+struct LineCost {
+    size_t operator()(const std::string& line) const {
+        return line.size() + 1;
+    }
+};
 }  // namespace
 
 struct FileRotateSink::Impl {
-    Impl(LogTimestampFormat tsFormat) : timestampFormat(tsFormat) {}
+    Impl(LogTimestampFormat tsFormat, bool async)
+        : timestampFormat(tsFormat), async(async), queue([] {
+              MultiProducerSingleConsumerQueue<std::string, LineCost>::Options options;
+              options.maxQueueDepth = kAsyncMaxQueuedBytes;
+              return options;
+          }()) {}
     StringMap<boost::shared_ptr<stream_t>> files;
     LogTimestampFormat timestampFormat;
+
+    const bool async;
+    MultiProducerSingleConsumerQueue<std::string, LineCost> queue;
+    AtomicWord<long long> droppedRecords{0};
+    long long reportedDroppedRecords{0};  // Only accessed by the writer thread.
+
+    // Serializes the writer thread's stream writes with stream swaps during rotation.
+    stdx::mutex writeMutex;
+    stdx::thread writer;
 };
 
-FileRotateSink::FileRotateSink(LogTimestampFormat timestampFormat)
-    : _impl(std::make_unique<Impl>(timestampFormat)) {}
-FileRotateSink::~FileRotateSink() {}
+FileRotateSink::FileRotateSink(LogTimestampFormat timestampFormat, bool async)
+    : _impl(std::make_unique<Impl>(timestampFormat, async)) {
+    if (async) {
+        _impl->writer = stdx::thread([this] { _asyncWriterLoop(); });
+    }
+}
+
+FileRotateSink::~FileRotateSink() {
+    if (_impl->async) {
+        // Closing the producer end lets the writer thread drain what is already queued before it
+        // sees the close and exits.
+        _impl->queue.closeProducerEnd();
+        _impl->writer.join();
+    }
+}
 
 Status FileRotateSink::addFile(const std::string& filename, bool append) {
     auto statusWithFile = openFile(filename, append);
@@ -127,6 +173,13 @@ void FileRotateSink::removeFile(const std::string& filename) {
 Status FileRotateSink::rotate(bool rename,
                               StringData renameSuffix,
                               std::function<void(Status)> onMinorError) {
+    // In async mode, swap the streams under the same lock the writer thread writes under so
+    // rotation doesn't race with in-flight writes. Records still queued when the rotation happens
+    // are written to the new file.
+    stdx::unique_lock<stdx::mutex> lock(_impl->writeMutex, stdx::defer_lock);
+    if (_impl->async)
+        lock.lock();
+
     for (auto& file : _impl->files) {
         const std::string& filename = file.first;
         if (rename) {
@@ -188,6 +241,24 @@ Status FileRotateSink::rotate(bool rename,
 
 void FileRotateSink::consume(const boost::log::record_view& rec,
                              const string_type& formatted_string) {
+    if (_impl->async) {
+        try {
+            if (!_impl->queue.tryPush(std::string(formatted_string))) {
+                // Queue is full, the disk is not keeping up. Drop the record rather than stall
+                // the producing thread; the writer thread reports the loss when it catches up.
+                _impl->droppedRecords.fetchAndAddRelaxed(1);
+            }
+        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+            // A late record raced with destruction of the sink; nothing to do.
+        }
+        return;
+    }
+
+    _writeAndCheckFailure(rec, formatted_string);
+}
+
+void FileRotateSink::_writeAndCheckFailure(const boost::log::record_view& rec,
+                                           const string_type& formatted_string) {
     auto isFailed = [](const auto& file) {
         return file.second->fail();
     };
@@ -241,4 +312,58 @@ void FileRotateSink::consume(const boost::log::record_view& rec,
     }
 }
 
+void FileRotateSink::_asyncWriterLoop() {
+    setThreadName("logAsyncWriter");
+    while (true) {
+        std::deque<std::string> batch;
+        try {
+            batch = _impl->queue.popManyUpTo(kAsyncBatchBytes).first;
+        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueConsumed>&) {
+            // The producer end closes (after which the queue drains into the loop above) only
+            // when the sink is destroyed.
+            return;
+        }
+
+        stdx::lock_guard<stdx::mutex> lock(_impl->writeMutex);
+        for (const auto& line : batch) {
+            // The text_ostream_backend only looks at the formatted string, so an empty record
+            // view is sufficient here.
+            _writeAndCheckFailure(boost::log::record_view(), line);
+        }
+
+        auto dropped = _impl->droppedRecords.loadRelaxed();
+        if (dropped > _impl->reportedDroppedRecords) {
+            // LOGV2 can't be used from inside the sink, so format the line directly like the
+            // write failure path above.
+            DynamicAttributes attrs;
+            attrs.add("droppedRecords", dropped - _impl->reportedDroppedRecords);
+
+            fmt::memory_buffer buffer;
+            JSONFormatter(nullptr, _impl->timestampFormat)
+                .format(buffer,
+                        LogSeverity::Warning(),
+                        LogComponent::kControl,
+                        Date_t::now(),
+                        9876503,
+                        getLogService(),
+                        getThreadName(),
+                        "Log records were dropped because the async log queue was full",
+                        TypeErasedAttributeStorage(attrs),
+                        LogTag::kNone,
+                        std::string() /* tenantID */,
+                        LogTruncation::Disabled);
+            // Commented out log line below to get validation of the log id with the errorcodes
+            // linter LOGV2_WARNING(9876503, "Log records were dropped because the async log queue
+            // was full");
+            _writeAndCheckFailure(boost::log::record_view(),
+                                  std::string(buffer.data(), buffer.size()));
+            _impl->reportedDroppedRecords = dropped;
+        }
+    }
+}
+
+long long FileRotateSink::asyncDroppedRecords() const {
+    return _impl->droppedRecords.loadRelaxed();
+}
+
 }  // namespace mongo::logv2
@@ -46,7 +46,14 @@ namespace mongo::logv2 {
 // boost file rotation sink does not do.
 class FileRotateSink : public boost::log::sinks::text_ostream_backend {
 public:
-    FileRotateSink(LogTimestampFormat timestampFormat);
+    /**
+     * When `async` is true the sink decouples log I/O from the producing threads: consume()
+     * appends the formatted record to a bounded in-memory queue and returns, and a writer thread
+     * owned by the sink performs the stream writes in batches. If the queue is full (e.g. a
+     * stalled disk) the record is dropped and counted instead of blocking the producer, and the
+     * writer thread emits a line reporting how many records were lost once it catches up.
+     */
+    FileRotateSink(LogTimestampFormat timestampFormat, bool async = false);
     ~FileRotateSink();
 
     Status addFile(const std::string& filename, bool append);
@@ -56,7 +63,16 @@ public:
 
     void consume(const boost::log::record_view& rec, const string_type& formatted_string);
 
+    /**
+     * Total number of records dropped because the async queue was full. Always zero when the sink
+     * is synchronous.
+     */
+    long long asyncDroppedRecords() const;
+
 private:
+    void _writeAndCheckFailure(const boost::log::record_view& rec, const string_type& formatted);
+    void _asyncWriterLoop();
+
     struct Impl;
     std::unique_ptr<Impl> _impl;
 };
@@ -53,6 +53,10 @@ public:
 
         bool consoleEnabled{true};
         bool fileEnabled{false};
+        // When set, log file I/O happens on a dedicated writer thread instead of the logging
+        // threads, with bounded buffering (records are dropped and counted when the writer can't
+        // keep up). See FileRotateSink.
+        bool fileAsyncEnabled{false};
         std::string filePath;
         RotationMode fileRotationMode{RotationMode::kRename};
         OpenMode fileOpenMode{OpenMode::kTruncate};
@@ -206,6 +206,29 @@ OpMsg OpMsg::parse(const Message& message, Client* client) try {
                         !msg.getSequence(name));  // TODO IDL
 
                 msg.sequences.push_back({name.toString()});
+
+                // Count the documents with a cheap length-only scan so a large sequence (bulk
+                // inserts routinely carry thousands of documents) is materialized with a single
+                // vector allocation. The objects themselves stay borrowed views into the
+                // message buffer; ownership is only taken by callers that retain data past the
+                // request (see parseOwned()).
+                size_t numDocs = 0;
+                const size_t seqBytes = seqBuf.remaining();
+                const char* seqStart = static_cast<const char*>(seqBuf.pos());
+                for (size_t offset = 0; offset < seqBytes;) {
+                    uassert(8626400,
+                            "Invalid document size in document sequence",
+                            seqBytes - offset >= sizeof(int32_t));
+                    auto docLen =
+                        ConstDataView(seqStart + offset).read<LittleEndian<int32_t>>();
+                    uassert(8626401,
+                            "Invalid document size in document sequence",
+                            docLen >= BSONObj::kMinBSONLength &&
+                                static_cast<size_t>(docLen) <= seqBytes - offset);
+                    offset += docLen;
+                    ++numDocs;
+                }
+                msg.sequences.back().objs.reserve(numDocs);
                 while (!seqBuf.atEof()) {
                     msg.sequences.back().objs.push_back(seqBuf.read<Validated<BSONObj>>());
                 }
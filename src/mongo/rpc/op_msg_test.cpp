@@ -170,6 +170,40 @@ TEST_F(OpMsgParser, SucceedsWithBodyThenSequence) {
     ASSERT_BSONOBJ_EQ(msg.sequences[0].objs[1], fromjson("{a: 2}"));
 }
 
+TEST_F(OpMsgParser, ParseYieldsBorrowedViewsIntoMessageBuffer) {
+    // parse() must stay zero-copy: the body and every document-sequence object are unowned views
+    // pointing into the Message buffer. Only parseOwned() takes ownership.
+    auto msgBytes = OpMsgBytes{
+        kNoFlags,  //
+        kBodySection,
+        fromjson("{ping: 1}"),
+
+        kDocSequenceSection,
+        Sized{
+            "docs",  //
+            fromjson("{a: 1}"),
+            fromjson("{a: 2}"),
+            fromjson("{a: 3}"),
+        },
+    };
+    Message message = msgBytes.done();
+    auto msg = OpMsg::parse(message);
+
+    const char* bufStart = message.singleData().data();
+    const char* bufEnd = bufStart + message.dataSize();
+
+    ASSERT_FALSE(msg.body.isOwned());
+    ASSERT_GTE(msg.body.objdata(), bufStart);
+    ASSERT_LT(msg.body.objdata(), bufEnd);
+    ASSERT_EQ(msg.sequences.size(), 1u);
+    ASSERT_EQ(msg.sequences[0].objs.size(), 3u);
+    for (auto&& obj : msg.sequences[0].objs) {
+        ASSERT_FALSE(obj.isOwned());
+        ASSERT_GTE(obj.objdata(), bufStart);
+        ASSERT_LT(obj.objdata(), bufEnd);
+    }
+}
+
 TEST_F(OpMsgParser, SucceedsWithSequenceThenBody) {
     auto msg =
         OpMsgBytes{
@@ -631,6 +631,14 @@ void CatalogCache::onStaleDatabaseVersion(const DatabaseName& dbName,
                                   "db"_attr = dbName,
                                   "version"_attr = version);
         _databaseCache.advanceTimeInStore(dbName, version);
+
+        if (gProactiveCatalogCacheRefresh.load()) {
+            // Kick off the refresh in the background so the updated database entry is already
+            // being fetched while the operation that hit the stale version unwinds and retries,
+            // instead of starting the fetch only when the retry first routes to the database.
+            // Concurrent requests for the same database join the in-progress lookup.
+            (void)_databaseCache.acquireAsync(dbName, CacheCausalConsistency::kLatestKnown);
+        }
     } else {
         _databaseCache.invalidateKey(dbName);
     }
@@ -649,6 +657,14 @@ void CatalogCache::onStaleCollectionVersion(const NamespaceString& nss,
         ? ComparableIndexVersion::makeComparableIndexVersion(wantedVersion->indexVersion())
         : ComparableIndexVersion::makeComparableIndexVersionForForcedRefresh();
     _indexCache.advanceTimeInStore(nss, newIndexVersion);
+
+    if (gProactiveCatalogCacheRefresh.load()) {
+        // Kick off the routing table refresh in the background so the incremental fetch of the
+        // changed chunks overlaps with the failed operation unwinding and retrying, instead of
+        // starting only when the retry first routes to the collection. Concurrent requests for
+        // the same collection join the in-progress lookup rather than issuing their own.
+        (void)_collectionCache.acquireAsync(nss, CacheCausalConsistency::kLatestKnown);
+    }
 }
 
 void CatalogCache::advanceCollectionTimeInStore(const NamespaceString& nss,
@@ -394,6 +394,35 @@ TEST_F(CatalogCacheTest, OnStaleShardVersionWithGreaterPlacementVersion) {
     ASSERT(status == ErrorCodes::InternalError);
 }
 
+TEST_F(CatalogCacheTest, OnStaleCollectionVersionTriggersBackgroundRefreshWhenProactive) {
+    RAIIServerParameterControllerForTest proactiveRefresh{"proactiveCatalogCacheRefresh", true};
+
+    const auto dbVersion = DatabaseVersion(UUID::gen(), Timestamp(1, 1));
+    const CollectionGeneration gen(OID::gen(), Timestamp(1, 1));
+    const auto cachedCollVersion = ShardVersionFactory::make(
+        ChunkVersion(gen, {1, 0}), boost::optional<CollectionIndexes>(boost::none));
+    auto wantedCollVersion = cachedCollVersion;
+    wantedCollVersion.placementVersion().incMajor();
+
+    loadDatabases({DatabaseType(kNss.dbName(), kShards[0], dbVersion)});
+    loadCollection(cachedCollVersion);
+
+    // Stage the new metadata in the loader before reporting staleness so the background refresh
+    // kicked off by onStaleCollectionVersion() can complete.
+    _catalogCacheLoader->setCollectionRefreshReturnValue(makeCollectionType(wantedCollVersion));
+    _catalogCacheLoader->setChunkRefreshReturnValue(
+        makeChunks(wantedCollVersion.placementVersion()));
+
+    _catalogCache->onStaleCollectionVersion(kNss, wantedCollVersion);
+
+    // The staleness report alone must eventually bring the new version into the cache, without
+    // any operation accessing the entry.
+    while (_catalogCache->peekCollectionCacheVersion(kNss) !=
+           wantedCollVersion.placementVersion()) {
+        sleepmillis(10);
+    }
+}
+
 TEST_F(CatalogCacheTest, GetCollectionRoutingInfoAllowLocksReturnsImmediately) {
     const auto dbVersion = DatabaseVersion(UUID::gen(), Timestamp(1, 1));
     const CollectionGeneration gen(OID::gen(), Timestamp(1, 1));
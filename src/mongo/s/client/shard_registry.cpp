@@ -246,6 +246,13 @@ ShardRegistry::Cache::LookupResult ShardRegistry::_lookup(OperationContext* opCt
                 "Finished ShardRegistry::_lookup",
                 "returnData"_attr = returnData.toBSON(),
                 "returnTime"_attr = returnTime);
+
+    // Publish the new topology as an immutable snapshot, so that getShard() calls can be served
+    // with a single atomic load for as long as the snapshot stays causally consistent with the
+    // latest known topology time.
+    std::atomic_store(&_snapshot,  // NOLINT
+                      std::make_shared<const Snapshot>(returnData, returnTime));
+
     return Cache::LookupResult{returnData, returnTime};
 }
 
@@ -342,6 +349,12 @@ std::shared_ptr<Shard> ShardRegistry::getConfigShard() const {
 
 StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opCtx,
                                                            const ShardId& shardId) {
+    // Serve the lookup from the latest published snapshot if it is still causally consistent with
+    // the latest known topology time, which avoids taking any mutex.
+    if (auto shard = _findShardInSnapshot(shardId)) {
+        return shard;
+    }
+
     // First check if this is a non config shard lookup
     // This call will may be blocking if there is an ongoing or a need of a cache rebuild
     if (auto shard = _getData(opCtx)->findShard(shardId)) {
@@ -367,6 +380,11 @@ StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opC
 
 SemiFuture<std::shared_ptr<Shard>> ShardRegistry::getShard(ExecutorPtr executor,
                                                            const ShardId& shardId) noexcept {
+    // Serve the lookup from the latest published snapshot if it is still causally consistent with
+    // the latest known topology time, which avoids taking any mutex.
+    if (auto shard = _findShardInSnapshot(shardId)) {
+        return SemiFuture<std::shared_ptr<Shard>>::makeReady(std::move(shard));
+    }
 
     // Fetch the shard registry data associated to the latest known topology time
     return _getDataAsync()
@@ -627,6 +645,23 @@ ShardRegistry::Cache::ValueHandle ShardRegistry::_getData(OperationContext* opCt
     return _getDataAsync().get(opCtx);
 }
 
+std::shared_ptr<Shard> ShardRegistry::_findShardInSnapshot(const ShardId& shardId) const {
+    auto snapshot = std::atomic_load(&_snapshot);  // NOLINT
+    if (!snapshot) {
+        return nullptr;
+    }
+
+    // The snapshot may only be used if it is causally consistent with the latest known topology
+    // time and no force reload has been requested since it was published. This mirrors the
+    // freshness check which the ReadThroughCache performs on the slow path, where the Time's most
+    // significant component is the force reload increment.
+    if (snapshot->time < Time::makeLatestKnown(_service)) {
+        return nullptr;
+    }
+
+    return snapshot->data.findShard(shardId);
+}
+
 bool ShardRegistry::isConfigServer(const HostAndPort& host) const {
     const auto configsvrConnString = getConfigServerConnectionString();
     const auto& configsvrHosts = configsvrConnString.getServers();
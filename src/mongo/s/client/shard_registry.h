@@ -511,6 +511,28 @@ private:
      */
     Cache::ValueHandle _getCachedData() const;
 
+    /**
+     * An immutable snapshot of the ShardRegistryData produced by a lookup, together with the Time
+     * that lookup corresponds to. A new snapshot is published atomically whenever a lookup
+     * completes, so that getShard() can resolve a shard with a single atomic load plus hash probe,
+     * without taking any mutex, for as long as the snapshot remains causally consistent with the
+     * latest known topology time.
+     */
+    struct Snapshot {
+        Snapshot(ShardRegistryData data, Time time)
+            : data(std::move(data)), time(std::move(time)) {}
+
+        const ShardRegistryData data;
+        const Time time;
+    };
+
+    /**
+     * Returns the shard with the given id from the latest published snapshot, or nullptr if there
+     * is no snapshot yet, the snapshot is stale with respect to the latest known topology time, or
+     * the snapshot does not contain the shard. Never blocks and never takes a mutex.
+     */
+    std::shared_ptr<Shard> _findShardInSnapshot(const ShardId& shardId) const;
+
     using LatestConnStrings = stdx::unordered_map<ShardId, ConnectionString, ShardId::Hasher>;
 
     std::vector<LatestConnStrings::value_type> _getLatestConnStrings() const;
@@ -562,6 +584,10 @@ private:
     // The key is replset name (the type is ShardId just to take advantage of its hasher).
     LatestConnStrings _latestConnStrings;
 
+    // The latest snapshot published by '_lookup'. Read and written exclusively through the
+    // std::atomic_load/atomic_store free functions for shared_ptr.
+    std::shared_ptr<const Snapshot> _snapshot;
+
     AtomicWord<bool> _isInitialized{false};
 
     // Set to true in shutdown call to prevent calling it twice.
@@ -160,6 +160,10 @@ protected:
         return ShardRegistry::Time::makeForForcedReload();
     }
 
+    auto findShardInSnapshot(const ShardId& shardId) {
+        return shardRegistry()->_findShardInSnapshot(shardId);
+    }
+
     auto makeTimeLatestKnown() {
         return ShardRegistry::Time::makeLatestKnown(getServiceContext());
     }
@@ -391,5 +395,48 @@ TEST_F(ShardRegistryTest, NewerLookupTimeGreaterThanOlder) {
     ASSERT_GT(newerTime, olderTime);
 }
 
+TEST_F(ShardRegistryTest, SnapshotPublishedOnLookup) {
+    // No lookup has completed yet, so there is no snapshot to serve lookups from.
+    ASSERT_FALSE(findShardInSnapshot({"0"}));
+
+    addShard({"0"}, kAdvanceTopologyTime);
+    reloadAndWait();
+
+    // The completed lookup published a snapshot which can serve lookups without blocking.
+    auto shard = findShardInSnapshot({"0"});
+    ASSERT_TRUE(shard);
+    ASSERT_EQ(shard->getId(), ShardId("0"));
+
+    ASSERT_FALSE(findShardInSnapshot({"nonexistent"}));
+}
+
+TEST_F(ShardRegistryTest, SnapshotNotUsedWithNewerTopologyTime) {
+    addShard({"0"}, kAdvanceTopologyTime);
+    reloadAndWait();
+    ASSERT_TRUE(findShardInSnapshot({"0"}));
+
+    // Once a newer topologyTime becomes known, the snapshot is stale and must not serve lookups
+    // until the next lookup has published a fresh one.
+    addShard({"1"}, kAdvanceTopologyTime);
+    ASSERT_FALSE(findShardInSnapshot({"0"}));
+
+    reloadAndWait();
+    ASSERT_TRUE(findShardInSnapshot({"0"}));
+    ASSERT_TRUE(findShardInSnapshot({"1"}));
+}
+
+TEST_F(ShardRegistryTest, SnapshotNotUsedAfterForceReloadRequested) {
+    addShard({"0"}, kAdvanceTopologyTime);
+    reloadAndWait();
+    ASSERT_TRUE(findShardInSnapshot({"0"}));
+
+    // Requesting a force reload invalidates the snapshot even without a newer topologyTime.
+    makeTimeForForceReload();
+    ASSERT_FALSE(findShardInSnapshot({"0"}));
+
+    reloadAndWait();
+    ASSERT_TRUE(findShardInSnapshot({"0"}));
+}
+
 }  // namespace
 }  // namespace mongo
@@ -295,7 +295,8 @@ std::vector<AsyncRequestsSender::Response> gatherResponsesImpl(
     const ReadPreferenceSetting& readPref,
     Shard::RetryPolicy retryPolicy,
     const std::vector<AsyncRequestsSender::Request>& requests,
-    bool throwOnStaleShardVersionErrors) {
+    bool throwOnStaleShardVersionErrors,
+    const ShardResponseVisitor& onResponse = nullptr) {
 
     // Send the requests.
     MultiStatementTransactionRequestsSender ars(
@@ -354,6 +355,13 @@ std::vector<AsyncRequestsSender::Response> gatherResponsesImpl(
             }
         }
         responses.push_back(std::move(response));
+
+        // Let the caller merge the response while the remaining shards are still in flight, and
+        // stop gathering if it has everything it needs. Destroying the sender cancels the
+        // outstanding requests' pending I/O.
+        if (onResponse && onResponse(responses.back())) {
+            break;
+        }
     }
 
     return responses;
@@ -366,9 +374,15 @@ std::vector<AsyncRequestsSender::Response> gatherResponses(
     const DatabaseName& dbName,
     const ReadPreferenceSetting& readPref,
     Shard::RetryPolicy retryPolicy,
-    const std::vector<AsyncRequestsSender::Request>& requests) {
-    return gatherResponsesImpl(
-        opCtx, dbName, readPref, retryPolicy, requests, true /* throwOnStaleShardVersionErrors */);
+    const std::vector<AsyncRequestsSender::Request>& requests,
+    const ShardResponseVisitor& onResponse) {
+    return gatherResponsesImpl(opCtx,
+                               dbName,
+                               readPref,
+                               retryPolicy,
+                               requests,
+                               true /* throwOnStaleShardVersionErrors */,
+                               onResponse);
 }
 
 std::vector<AsyncRequestsSender::Response> gatherResponsesNoThrowOnStaleShardVersionErrors(
@@ -529,7 +543,8 @@ std::vector<AsyncRequestsSender::Response> scatterGatherVersionedTargetByRouting
     const BSONObj& collation,
     const boost::optional<BSONObj>& letParameters,
     const boost::optional<LegacyRuntimeConstants>& runtimeConstants,
-    bool eligibleForSampling) {
+    bool eligibleForSampling,
+    const ShardResponseVisitor& onResponse) {
     auto expCtx = makeExpressionContextWithDefaultsForTargeter(opCtx,
                                                                nss,
                                                                cri,
@@ -546,7 +561,8 @@ std::vector<AsyncRequestsSender::Response> scatterGatherVersionedTargetByRouting
                                                       retryPolicy,
                                                       query,
                                                       collation,
-                                                      eligibleForSampling);
+                                                      eligibleForSampling,
+                                                      onResponse);
 }
 
 [[nodiscard]] std::vector<AsyncRequestsSender::Response> scatterGatherVersionedTargetByRoutingTable(
@@ -559,10 +575,12 @@ std::vector<AsyncRequestsSender::Response> scatterGatherVersionedTargetByRouting
     Shard::RetryPolicy retryPolicy,
     const BSONObj& query,
     const BSONObj& collation,
-    bool eligibleForSampling) {
+    bool eligibleForSampling,
+    const ShardResponseVisitor& onResponse) {
     const auto requests = buildVersionedRequestsForTargetedShards(
         expCtx, nss, cri, {} /* shardsToSkip */, cmdObj, query, collation, eligibleForSampling);
-    return gatherResponses(expCtx->getOperationContext(), dbName, readPref, retryPolicy, requests);
+    return gatherResponses(
+        expCtx->getOperationContext(), dbName, readPref, retryPolicy, requests, onResponse);
 }
 
 std::vector<AsyncRequestsSender::Response>
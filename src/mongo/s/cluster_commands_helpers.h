@@ -32,6 +32,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
@@ -144,6 +145,16 @@ std::vector<AsyncRequestsSender::Request> buildVersionedRequests(
     const BSONObj& cmdObj,
     bool eligibleForSampling = false);
 
+/**
+ * Invoked by the gather helpers below on each shard response as it arrives, before the next
+ * response is waited on, so per-response merging work overlaps with the outstanding requests.
+ * Returning true stops gathering: outstanding requests are abandoned (their pending I/O is
+ * cancelled) and their responses are not included in the returned vector. Early exit must not be
+ * used within a multi-statement transaction, since the transaction router must observe every
+ * contacted shard's response.
+ */
+using ShardResponseVisitor = std::function<bool(const AsyncRequestsSender::Response&)>;
+
 /**
  * Dispatches all the specified requests in parallel and waits until all complete, returning a
  * vector of the same size and positions as that of 'requests'.
@@ -156,7 +167,8 @@ std::vector<AsyncRequestsSender::Response> gatherResponses(
     const DatabaseName& dbName,
     const ReadPreferenceSetting& readPref,
     Shard::RetryPolicy retryPolicy,
-    const std::vector<AsyncRequestsSender::Request>& requests);
+    const std::vector<AsyncRequestsSender::Request>& requests,
+    const ShardResponseVisitor& onResponse = nullptr);
 
 /**
  * Dispatches all the specified requests in parallel and waits until all complete, returning a
@@ -318,7 +330,8 @@ std::vector<AsyncRequestsSender::Response> scatterGatherUnversionedTargetConfigS
     const BSONObj& collation,
     const boost::optional<BSONObj>& letParameters,
     const boost::optional<LegacyRuntimeConstants>& runtimeConstants,
-    bool eligibleForSampling = false);
+    bool eligibleForSampling = false,
+    const ShardResponseVisitor& onResponse = nullptr);
 
 /**
  * This overload is for callers which already have a fully initialized 'ExpressionContext' (e.g.
@@ -334,7 +347,8 @@ std::vector<AsyncRequestsSender::Response> scatterGatherUnversionedTargetConfigS
     Shard::RetryPolicy retryPolicy,
     const BSONObj& query,
     const BSONObj& collation,
-    bool eligibleForSampling = false);
+    bool eligibleForSampling = false,
+    const ShardResponseVisitor& onResponse = nullptr);
 
 /**
  * Utility for dispatching versioned commands on a namespace, deciding which shards to
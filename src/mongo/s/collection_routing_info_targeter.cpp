@@ -46,6 +46,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
+#include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/feature_flag.h"
 #include "mongo/db/matcher/expression_parser.h"
@@ -752,9 +753,23 @@ StatusWith<std::vector<ShardEndpoint>> CollectionRoutingInfoTargeter::_targetQue
 StatusWith<ShardEndpoint> CollectionRoutingInfoTargeter::_targetShardKey(
     const BSONObj& shardKey, const BSONObj& collation) const {
     try {
+        // Only lookups with the simple collation may consult the cache, since for any other
+        // collation the outcome of targeting depends on the types of the shard key values and not
+        // just on which chunk the key falls into.
+        const bool isSimpleCollation =
+            SimpleBSONObjComparator::kInstance.evaluate(collation == CollationSpec::kSimpleSpec);
+        if (isSimpleCollation && _lastTargetedChunk &&
+            _lastTargetedChunk->range.containsKey(shardKey)) {
+            return _lastTargetedChunk->endpoint;
+        }
+
         auto chunk = _cri.cm.findIntersectingChunk(shardKey, collation);
-        return ShardEndpoint(
+        ShardEndpoint endpoint(
             chunk.getShardId(), _cri.getShardVersion(chunk.getShardId()), boost::none);
+        if (isSimpleCollation) {
+            _lastTargetedChunk.emplace(LastTargetedChunk{chunk.getRange(), endpoint});
+        }
+        return endpoint;
     } catch (const DBException& ex) {
         return ex.toStatus();
     }
@@ -845,11 +860,13 @@ bool CollectionRoutingInfoTargeter::refreshIfNeeded(OperationContext* opCtx) {
     // Get the latest metadata information from the cache if there were issues
     auto lastManager = _cri;
     _cri = _init(opCtx, false);
+    _lastTargetedChunk = boost::none;
     auto metadataChanged = isMetadataDifferent(lastManager, _cri);
 
     if (_lastError.value() == LastErrorType::kCouldNotTarget && !metadataChanged) {
         // If we couldn't target, and we didn't already update the metadata we must force a refresh
         _cri = _init(opCtx, true);
+        _lastTargetedChunk = boost::none;
         metadataChanged = isMetadataDifferent(lastManager, _cri);
     }
 
@@ -264,6 +264,17 @@ private:
 
     // The latest loaded routing cache entry
     CollectionRoutingInfo _cri;
+
+    // The chunk which the last shard key passed to '_targetShardKey' with the simple collation
+    // was found to belong to, along with the endpoint it resolved to. Large write batches
+    // frequently contain runs of documents whose shard keys fall in the same chunk (e.g.
+    // monotonically increasing keys), so checking this chunk first amortizes the cost of the
+    // chunk map lookup across the batch. Must be discarded whenever '_cri' is replaced.
+    struct LastTargetedChunk {
+        ChunkRange range;
+        ShardEndpoint endpoint;
+    };
+    mutable boost::optional<LastTargetedChunk> _lastTargetedChunk;
 };
 
 }  // namespace mongo
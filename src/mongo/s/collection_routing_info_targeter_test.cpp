@@ -174,6 +174,34 @@ TEST_F(CollectionRoutingInfoTargeterTest, TargetInsertWithRangePrefixHashedShard
     testTargetInsertWithRangePrefixHashedShardKey();
 }
 
+TEST_F(CollectionRoutingInfoTargeterTest, RepeatedTargetInsertsAcrossChunkBoundaries) {
+    // Create 4 chunks and 4 shards such that shardId '0' has chunk [MinKey, -100), '1' has chunk
+    // [-100, 0), '2' has chunk [0, 100) and '3' has chunk [100, MaxKey). Repeatedly targeting
+    // through the same targeter exercises the cached last-targeted chunk, both for consecutive
+    // keys in the same chunk and for keys which cross over a chunk boundary.
+    std::vector<BSONObj> splitPoints = {BSON("a" << -100), BSON("a" << 0), BSON("a" << 100)};
+    auto criTargeter = prepare(BSON("a" << 1), splitPoints);
+
+    auto res = criTargeter.targetInsert(operationContext(), BSON("a" << -150));
+    ASSERT_EQUALS(res.shardName, "0");
+
+    // Keys in the same chunk as the previous one.
+    res = criTargeter.targetInsert(operationContext(), BSON("a" << -120));
+    ASSERT_EQUALS(res.shardName, "0");
+    res = criTargeter.targetInsert(operationContext(), BSON("a" << -101));
+    ASSERT_EQUALS(res.shardName, "0");
+
+    // Key in the next chunk, right on the boundary.
+    res = criTargeter.targetInsert(operationContext(), BSON("a" << -100));
+    ASSERT_EQUALS(res.shardName, "1");
+
+    // Key jumping over several chunks, then one going back to a previously targeted chunk.
+    res = criTargeter.targetInsert(operationContext(), BSON("a" << 5000));
+    ASSERT_EQUALS(res.shardName, "3");
+    res = criTargeter.targetInsert(operationContext(), BSON("a" << -50));
+    ASSERT_EQUALS(res.shardName, "1");
+}
+
 void CollectionRoutingInfoTargeterTest::testTargetInsertWithRangePrefixHashedShardKey() {
     // Create 5 chunks and 5 shards such that shardId '0' has chunk [MinKey, null), '1' has chunk
     // [null, -100), '2' has chunk [-100, 0), '3' has chunk ['0', 100) and '4' has chunk
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <cstdlib>
+#include <limits>
 #include <vector>
 
 #include "mongo/bson/util/bson_extract.h"
@@ -197,6 +199,11 @@ public:
                 });
             }
 
+            // Capture the originally requested bounds before the skip is folded into the limit
+            // below; they determine whether gathering can stop early.
+            const auto originalLimit = countRequest.getLimit();
+            const auto originalSkip = countRequest.getSkip();
+
             // We only need to factor in the skip value when sending to the shards if we
             // have a value for limit, otherwise, we apply it only once we have collected all
             // counts.
@@ -221,6 +228,38 @@ public:
             // requestQueryStats here.
             requestQueryStats = query_stats::shouldRequestRemoteMetrics(CurOp::get(opCtx)->debug());
 
+            // With a non-zero limit, the final result becomes insensitive to the shards not yet
+            // heard from once the running total reaches skip + |limit|: any further counts can
+            // only be clamped away by applySkipLimit(). Merge responses as they arrive and stop
+            // gathering at that bound. Disabled in multi-statement transactions (the transaction
+            // router must observe every response) and when remote query stats metrics were
+            // requested (a partial gather cannot yield complete metrics). When we do stop early,
+            // the 'shards' subdocument of the reply only lists the shards heard from.
+            long long runningTotal = 0;
+            boost::optional<long long> shortCircuitBound;
+            if (originalLimit && *originalLimit != 0 &&
+                *originalLimit != std::numeric_limits<long long>::min() &&
+                !opCtx->inMultiDocumentTransaction() && !requestQueryStats) {
+                long long bound = std::abs(*originalLimit);
+                if (!originalSkip || !overflow::add(bound, *originalSkip, &bound)) {
+                    shortCircuitBound = bound;
+                }
+            }
+            ShardResponseVisitor stopWhenLimitResolved;
+            if (shortCircuitBound) {
+                stopWhenLimitResolved = [&](const AsyncRequestsSender::Response& response) {
+                    if (!response.swResponse.getStatus().isOK()) {
+                        return false;
+                    }
+                    const auto& data = response.swResponse.getValue().data;
+                    if (!getStatusFromCommandResult(data).isOK()) {
+                        return false;
+                    }
+                    runningTotal += data["n"].numberLong();
+                    return runningTotal >= *shortCircuitBound;
+                };
+            }
+
             shardResponses = scatterGatherVersionedTargetByRoutingTable(
                 expCtx,
                 dbName,
@@ -234,7 +273,8 @@ public:
                 Shard::RetryPolicy::kIdempotent,
                 countRequest.getQuery(),
                 collation,
-                true /*eligibleForSampling*/);
+                true /*eligibleForSampling*/,
+                stopWhenLimitResolved);
         } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& ex) {
             // Rewrite the count command as an aggregation.
             auto countRequest =
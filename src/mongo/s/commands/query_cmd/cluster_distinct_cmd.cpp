@@ -349,30 +349,6 @@ public:
         const auto cri = uassertStatusOK(std::move(swCri));
         const auto& cm = cri.cm;
 
-        std::vector<AsyncRequestsSender::Response> shardResponses;
-        try {
-            shardResponses = scatterGatherVersionedTargetByRoutingTable(
-                opCtx,
-                nss.dbName(),
-                nss,
-                cri,
-                applyReadWriteConcern(opCtx, this, distinctReadyForPassthrough),
-                ReadPreferenceSetting::get(opCtx),
-                Shard::RetryPolicy::kIdempotent,
-                query,
-                collation,
-                boost::none /*letParameters*/,
-                boost::none /*runtimeConstants*/,
-                true /* eligibleForSampling */);
-        } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& ex) {
-            runDistinctOnView(opCtx,
-                              std::move(canonicalQuery),
-                              *ex.extraInfo<ResolvedView>(),
-                              boost::none /* verbosity */,
-                              result);
-            return true;
-        }
-
         BSONObjComparator bsonCmp(BSONObj(),
                                   BSONObjComparator::FieldNamesMode::kConsider,
                                   !collation.isEmpty()
@@ -380,11 +356,14 @@ public:
                                       : (cm.isSharded() ? cm.getDefaultCollator() : nullptr));
         BSONObjSet all = bsonCmp.makeBSONObjSet();
 
-        for (const auto& response : shardResponses) {
-            auto status = response.swResponse.isOK()
-                ? getStatusFromCommandResult(response.swResponse.getValue().data)
-                : response.swResponse.getStatus();
-            uassertStatusOK(status);
+        // Merge each shard's values into the set as its response arrives, so the merge work
+        // overlaps with the shards still running rather than starting after the slowest one has
+        // answered. Failed responses are skipped here and surfaced by the status loop below.
+        auto mergeShardResponse = [&](const AsyncRequestsSender::Response& response) {
+            if (!response.swResponse.isOK() ||
+                !getStatusFromCommandResult(response.swResponse.getValue().data).isOK()) {
+                return false;
+            }
 
             BSONObj res = response.swResponse.getValue().data;
             auto values = res["values"];
@@ -412,6 +391,39 @@ public:
                     CurOp::get(opCtx)->debug().additiveMetrics.aggregateCursorMetrics(metrics);
                 }
             }
+            return false;
+        };
+
+        std::vector<AsyncRequestsSender::Response> shardResponses;
+        try {
+            shardResponses = scatterGatherVersionedTargetByRoutingTable(
+                opCtx,
+                nss.dbName(),
+                nss,
+                cri,
+                applyReadWriteConcern(opCtx, this, distinctReadyForPassthrough),
+                ReadPreferenceSetting::get(opCtx),
+                Shard::RetryPolicy::kIdempotent,
+                query,
+                collation,
+                boost::none /*letParameters*/,
+                boost::none /*runtimeConstants*/,
+                true /* eligibleForSampling */,
+                mergeShardResponse);
+        } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& ex) {
+            runDistinctOnView(opCtx,
+                              std::move(canonicalQuery),
+                              *ex.extraInfo<ResolvedView>(),
+                              boost::none /* verbosity */,
+                              result);
+            return true;
+        }
+
+        for (const auto& response : shardResponses) {
+            auto status = response.swResponse.isOK()
+                ? getStatusFromCommandResult(response.swResponse.getValue().data)
+                : response.swResponse.getStatus();
+            uassertStatusOK(status);
         }
 
         BSONObjBuilder b(32);
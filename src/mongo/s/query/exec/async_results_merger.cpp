@@ -45,6 +45,7 @@
 #include "mongo/db/query/client_cursor/cursor_response.h"
 #include "mongo/db/query/client_cursor/kill_cursors_gen.h"
 #include "mongo/db/query/getmore_command_gen.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/session/logical_session_id_gen.h"
 #include "mongo/executor/remote_command_request.h"
@@ -524,7 +525,7 @@ void AsyncResultsMerger::_processAdditionalTransactionParticipants(OperationCont
     }
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock lk) {
     // Tailable non-awaitData cursors cannot have a sort.
     invariant(_tailableMode != TailableModeEnum::kTailable);
 
@@ -562,10 +563,12 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
         _highWaterMark = extractSortKey(front, _params.getCompareWholeSortKey()).getOwned();
     }
 
+    _schedulePrefetchIfBelowThreshold(lk, smallestRemote);
+
     return {std::move(front), smallestRemote->shardId};
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock lk) {
     size_t remotesAttempted = 0;
     while (remotesAttempted < _remotes.size()) {
         auto& remote = _remotes[_gettingFromRemote];
@@ -583,6 +586,8 @@ ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
                 _eofNext = true;
             }
 
+            _schedulePrefetchIfBelowThreshold(lk, remote);
+
             return {std::move(front), remote->shardId};
         }
 
@@ -756,6 +761,40 @@ Status AsyncResultsMerger::_scheduleGetMoresForRemotes(
     return Status::OK();
 }
 
+void AsyncResultsMerger::_schedulePrefetchIfBelowThreshold(WithLock lk,
+                                                           const RemoteCursorPtr& remote) {
+    const auto threshold = internalQueryAsyncResultsMergerPrefetchThresholdDocs.load();
+    if (threshold <= 0) {
+        return;
+    }
+
+    // Prefetching only applies to normal cursors. For tailable cursors a getMore may block on the
+    // remote node waiting for new data and batch boundaries are meaningful to the client, so the
+    // next batch must not be requested before the buffered one has been consumed.
+    if (_tailableMode != TailableModeEnum::kNormal) {
+        return;
+    }
+
+    if (!_opCtx || _lifecycleState != kAlive) {
+        return;
+    }
+
+    if (!remote->status.isOK() || remote->exhausted() || remote->cbHandle.isValid() ||
+        static_cast<long long>(remote->docBuffer.size()) >= threshold) {
+        return;
+    }
+
+    // A failure to schedule the prefetch is not fatal. Once the remote's buffer runs dry the
+    // regular scheduling path in nextEvent() will request the next batch and surface the error.
+    if (auto status = _scheduleGetMoresForRemotes(lk, _opCtx, {remote}); !status.isOK()) {
+        LOGV2_DEBUG(9876501,
+                    2,
+                    "Failed to schedule a prefetch getMore",
+                    "shardId"_attr = remote->shardId,
+                    "error"_attr = redact(status));
+    }
+}
+
 /*
  * Note: When nextEvent() is called to do retries, only the remotes with retriable errors will be
  * rescheduled because:
@@ -1031,6 +1070,12 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
             !remote->closed);
 
     _updateRemoteMetadata(lk, remote, response);
+
+    // In sorted mode, a remote with buffered results is already present in the merge queue. That
+    // can happen here when a prefetched batch arrives before the remote's buffer has been fully
+    // consumed, in which case the remote must not be added to the merge queue a second time.
+    const bool alreadyInMergeQueue = !remote->docBuffer.empty();
+
     for (const auto& obj : response.getBatch()) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
         if (_params.getSort()) {
@@ -1059,7 +1104,7 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
 
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
     // queue.
-    if (_params.getSort() && !response.getBatch().empty()) {
+    if (_params.getSort() && !response.getBatch().empty() && !alreadyInMergeQueue) {
         _mergeQueue.push(remote);
     }
     return true;
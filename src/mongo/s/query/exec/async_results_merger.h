@@ -587,6 +587,15 @@ private:
                                        OperationContext* opCtx,
                                        const std::vector<RemoteCursorPtr>& remotes);
 
+    /**
+     * Schedules a getMore on 'remote' if its buffer has dropped below the prefetch threshold
+     * configured through 'internalQueryAsyncResultsMergerPrefetchThresholdDocs', so that the next
+     * batch is fetched while the buffered results are still being consumed. Only applies to
+     * non-tailable cursors. A no-op if prefetching is disabled, a request to the remote is already
+     * outstanding or the remote is exhausted.
+     */
+    void _schedulePrefetchIfBelowThreshold(WithLock lk, const RemoteCursorPtr& remote);
+
     /**
      * Schedules a killCursors command to be run on all remote hosts that have open cursors.
      */
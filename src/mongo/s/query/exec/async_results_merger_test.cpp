@@ -193,6 +193,108 @@ TEST_F(AsyncResultsMergerTest, SingleShardSorted) {
     ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
 }
 
+TEST_F(AsyncResultsMergerTest, SingleShardUnsortedPrefetchBelowThreshold) {
+    RAIIServerParameterControllerForTest prefetchThreshold(
+        "internalQueryAsyncResultsMergerPrefetchThresholdDocs", 2);
+
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    // Schedule requests.
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+
+    // Shard responds with a batch of three results and a still-open cursor.
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch = {fromjson("{_id: 1}"), fromjson("{_id: 2}"), fromjson("{_id: 3}")};
+    responses.emplace_back(kTestNss, CursorId(5), batch);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    // Consuming the first result leaves two results buffered, which is not below the prefetch
+    // threshold, so no getMore is scheduled yet.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 1}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    // Consuming the second result drops the buffer below the threshold, so a getMore is scheduled
+    // immediately even though a result remains buffered.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 2}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(networkHasReadyRequests());
+
+    // The buffered result can be consumed while the prefetched getMore is still in flight.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 3}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_FALSE(arm->ready());
+
+    // Deliver the prefetched batch, which also exhausts the remote cursor.
+    responses.clear();
+    std::vector<BSONObj> prefetchedBatch = {fromjson("{_id: 4}")};
+    responses.emplace_back(kTestNss, CursorId(0), prefetchedBatch);
+    scheduleNetworkResponses(std::move(responses));
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(arm->remotesExhausted());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 4}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+}
+
+TEST_F(AsyncResultsMergerTest, SingleShardSortedPrefetchedBatchArrivesWithResultsStillBuffered) {
+    RAIIServerParameterControllerForTest prefetchThreshold(
+        "internalQueryAsyncResultsMergerPrefetchThresholdDocs", 2);
+
+    BSONObj findCmd = fromjson("{find: 'testcoll', sort: {_id: 1}}");
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    // Schedule requests.
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+
+    // Shard responds with a batch of three results and a still-open cursor.
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch = {
+        fromjson("{$sortKey: [5]}"), fromjson("{$sortKey: [6]}"), fromjson("{$sortKey: [7]}")};
+    responses.emplace_back(kTestNss, CursorId(5), batch);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    // Consuming the second result drops the buffer below the prefetch threshold and schedules a
+    // getMore while one result is still buffered.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{$sortKey: [5]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{$sortKey: [6]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(networkHasReadyRequests());
+
+    // Deliver the prefetched batch while the remote still has a buffered result, then verify that
+    // all results are returned exactly once and in order.
+    responses.clear();
+    std::vector<BSONObj> prefetchedBatch = {fromjson("{$sortKey: [8]}"),
+                                            fromjson("{$sortKey: [9]}")};
+    responses.emplace_back(kTestNss, CursorId(0), prefetchedBatch);
+    scheduleNetworkResponses(std::move(responses));
+
+    ASSERT_TRUE(arm->remotesExhausted());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{$sortKey: [7]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{$sortKey: [8]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{$sortKey: [9]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+}
+
 TEST_F(AsyncResultsMergerTest, MultiShardUnsorted) {
     std::vector<RemoteCursor> cursors;
     cursors.push_back(
@@ -29,6 +29,7 @@
 
 #include "mongo/s/query/exec/establish_cursors.h"
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <tuple>
@@ -64,11 +65,13 @@
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/logv2/log_severity.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/s/async_requests_sender.h"
 #include "mongo/s/client/shard_registry.h"
 #include "mongo/s/grid.h"
 #include "mongo/s/multi_statement_transaction_requests_sender.h"
 #include "mongo/s/transaction_router.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
@@ -86,6 +89,32 @@ namespace {
 
 constexpr StringData kOperationKeyField = "clientOperationKey"_sd;
 
+// Process-wide number of outstanding hedged cursor-establishment attempts. Bounds the extra load
+// hedging can add on top of regular establishment across all operations on this node.
+AtomicWord<int> hedgedAttemptsOutstanding{0};
+
+/**
+ * Reserves up to 'wanted' hedged attempts against the process-wide budget and returns the number
+ * actually granted, possibly zero. The caller must hand the grant back via releaseHedgeBudget().
+ */
+size_t acquireHedgeBudget(size_t wanted) {
+    const auto limit = internalQueryCursorEstablishmentMaxConcurrentHedges.load();
+    auto current = hedgedAttemptsOutstanding.load();
+    size_t granted;
+    do {
+        granted = std::min(wanted, static_cast<size_t>(std::max(limit - current, 0)));
+        if (granted == 0) {
+            return 0;
+        }
+    } while (
+        !hedgedAttemptsOutstanding.compareAndSwap(&current, current + static_cast<int>(granted)));
+    return granted;
+}
+
+void releaseHedgeBudget(size_t granted) {
+    hedgedAttemptsOutstanding.fetchAndSubtract(static_cast<int>(granted));
+}
+
 /**
  * This class wraps logic for establishing cursors using a MultiStatementTransactionRequestsSender.
  */
@@ -105,8 +134,16 @@ public:
           _providedOpKeys(std::move(providedOpKeys)),
           _designatedHostsMap(std::move(designatedHostsMap)) {}
 
+    ~CursorEstablisher() {
+        if (_hedgePermits) {
+            releaseHedgeBudget(_hedgePermits);
+        }
+    }
+
     /**
-     * Make a RequestSender and thus send requests.
+     * Make a RequestSender and thus send requests. When eligible (see '_shouldHedge'), hedged
+     * duplicates of the requests are sent alongside the originals so that cursor establishment
+     * races two nodes of each shard and keeps whichever responds first.
      */
     void sendRequests(const ReadPreferenceSetting& readPref,
                       const std::vector<AsyncRequestsSender::Request>& remotes,
@@ -151,6 +188,31 @@ private:
     bool _canSkipForPartialResults(const AsyncRequestsSender::Response& response,
                                    const Status& status);
 
+    /**
+     * Returns true if cursor establishment may be hedged for this operation. Hedging runs the
+     * command a second time on another eligible node, so it is restricted to reads that already
+     * tolerate staleness by permitting secondary targeting.
+     */
+    bool _shouldHedge(const ReadPreferenceSetting& readPref) const;
+
+    /**
+     * Appends hedged duplicates of eligible requests to 'requests', within the per-operation and
+     * process-wide hedging budgets, and records the hedged shards for response accounting.
+     */
+    void _appendHedgedRequests(std::vector<AsyncRequestsSender::Request>& requests);
+
+    /**
+     * Notes that one attempt for a hedged shard has completed. Returns true if a sibling attempt
+     * already produced this shard's cursors, i.e. this response lost the race.
+     */
+    bool _noteHedgedAttemptCompleted(const AsyncRequestsSender::Response& response);
+
+    /**
+     * Returns true if 'status' came from a hedged attempt whose sibling already produced this
+     * shard's cursors or may still do so, in which case the failure need not fail the operation.
+     */
+    bool _canSkipForHedging(const AsyncRequestsSender::Response& response, const Status& status);
+
     /**
      * Favors interruption/unyield failures > UUID mismatch error with actual ns > UUID mismatch
      * error > other errors > retargeting errors
@@ -175,6 +237,19 @@ private:
     std::vector<RemoteCursor> _remoteCursors;
     std::vector<HostAndPort> _remotesToClean;
     AsyncRequestsSender::ShardHostMap _designatedHostsMap;
+
+    /**
+     * Per-shard accounting for hedged establishment: the number of attempts whose responses are
+     * still outstanding and whether one of them already produced the shard's cursors.
+     */
+    struct HedgeState {
+        int pendingAttempts = 2;
+        bool won = false;
+    };
+    stdx::unordered_map<ShardId, HedgeState> _hedgedShards;
+
+    // Number of hedged attempts this operation reserved from the process-wide budget.
+    size_t _hedgePermits = 0;
 };
 
 void CursorEstablisher::sendRequests(const ReadPreferenceSetting& readPref,
@@ -184,10 +259,6 @@ void CursorEstablisher::sendRequests(const ReadPreferenceSetting& readPref,
     std::vector<AsyncRequestsSender::Request> requests;
     requests.reserve(remotes.size());
 
-    // Make sure there is enough room in '_remotesToClean' so that inserting a cursor into the clean
-    // up list later cannot throw an OOM exception.
-    _remotesToClean.reserve(remotes.size());
-
     // TODO SERVER-47261 management of the opKey should move to the ARS.
     for (const auto& remote : remotes) {
         if (_providedOpKeys.size()) {
@@ -204,9 +275,17 @@ void CursorEstablisher::sendRequests(const ReadPreferenceSetting& readPref,
     tassert(9282602,
             "Invalid number of objects in CursorEstablisher",
             requests.size() == remotes.size());
+
+    if (_shouldHedge(readPref)) {
+        _appendHedgedRequests(requests);
+    }
+
+    // Make sure there is enough room in '_remotesToClean' so that inserting a cursor into the clean
+    // up list later cannot throw an OOM exception.
+    _remotesToClean.reserve(requests.size());
     tassert(9282603,
             "Invalid _remotesToClean capacity in CursorEstablisher",
-            _remotesToClean.capacity() == remotes.size());
+            _remotesToClean.capacity() >= requests.size());
 
     if (shouldLog(MONGO_LOGV2_DEFAULT_COMPONENT, logv2::LogSeverity::Debug(3))) {
         logv2::DynamicAttributes attrs;
@@ -234,6 +313,75 @@ void CursorEstablisher::sendRequests(const ReadPreferenceSetting& readPref,
                  _designatedHostsMap);
 }
 
+bool CursorEstablisher::_shouldHedge(const ReadPreferenceSetting& readPref) const {
+    if (!internalQueryCursorEstablishmentHedgingEnabled.load()) {
+        return false;
+    }
+    // Only reads that already tolerate staleness by permitting secondary targeting may run on a
+    // second, possibly lagged, node.
+    if (!readPref.canRunOnSecondary()) {
+        return false;
+    }
+    // Transactions pin each participant shard to a single host, and callers that provide their
+    // own operation keys manage the lifetime of their requests themselves.
+    if (TransactionRouter::get(_opCtx) || !_providedOpKeys.empty()) {
+        return false;
+    }
+    return true;
+}
+
+void CursorEstablisher::_appendHedgedRequests(
+    std::vector<AsyncRequestsSender::Request>& requests) {
+    // Shards pinned to a designated host offer no alternative node to race, and shards targeted
+    // more than once cannot be accounted for per-shard, so neither is hedged.
+    stdx::unordered_map<ShardId, size_t> attemptsPerShard;
+    for (const auto& request : requests) {
+        ++attemptsPerShard[request.shardId];
+    }
+    size_t eligible = 0;
+    for (const auto& [shardId, attempts] : attemptsPerShard) {
+        if (attempts == 1 && !_designatedHostsMap.count(shardId)) {
+            ++eligible;
+        }
+    }
+
+    const auto perOpLimit =
+        static_cast<size_t>(internalQueryCursorEstablishmentMaxHedgedRemotes.load());
+    _hedgePermits = acquireHedgeBudget(std::min(eligible, perOpLimit));
+    if (_hedgePermits == 0) {
+        return;
+    }
+
+    const size_t numOriginals = requests.size();
+    // Reserve up front so that appending hedged duplicates cannot invalidate the references to
+    // the original requests taken in the loop below.
+    requests.reserve(numOriginals + _hedgePermits);
+    for (size_t i = 0; i < numOriginals && _hedgedShards.size() < _hedgePermits; ++i) {
+        const auto& request = requests[i];
+        if (attemptsPerShard[request.shardId] != 1 || _designatedHostsMap.count(request.shardId)) {
+            continue;
+        }
+        _hedgedShards.emplace(request.shardId, HedgeState{});
+        requests.emplace_back(request.shardId, request.cmdObj);
+    }
+
+    LOGV2_DEBUG(9876536,
+                2,
+                "Hedging cursor establishment",
+                "opId"_attr = _opCtx->getOpID(),
+                "numHedgedRemotes"_attr = _hedgedShards.size());
+}
+
+bool CursorEstablisher::_noteHedgedAttemptCompleted(
+    const AsyncRequestsSender::Response& response) {
+    auto it = _hedgedShards.find(response.shardId);
+    if (it == _hedgedShards.end()) {
+        return false;
+    }
+    --it->second.pendingAttempts;
+    return it->second.won;
+}
+
 void CursorEstablisher::_waitForResponse() {
     boost::optional<AsyncRequestsSender::Response> maybeResponse;
     BSONObj responseData;
@@ -258,10 +406,14 @@ void CursorEstablisher::_waitForResponse() {
         _ars->validateResponse(*maybeResponse, false /* forMergeCursors */);
         responseData = uassertStatusOK(std::move(maybeResponse->swResponse)).data;
     } catch (const DBException& ex) {
+        if (maybeResponse) {
+            _noteHedgedAttemptCompleted(*maybeResponse);
+        }
         _handleFailure(maybeResponse, ex.toStatus(), /* isInterruption */ true);
         return;
     }
     auto response = *maybeResponse;
+    const bool alreadyWon = _noteHedgedAttemptCompleted(response);
     try {
         auto cursors = CursorResponse::parseFromBSONMany(std::move(responseData));
 
@@ -274,6 +426,22 @@ void CursorEstablisher::_waitForResponse() {
 
             hadValidCursor = true;
 
+            if (alreadyWon) {
+                // A sibling hedged attempt already produced this shard's cursors. Kill the late
+                // cursor rather than returning duplicates to the caller.
+                LOGV2_DEBUG(9876537,
+                            3,
+                            "Killing cursor established by losing hedged attempt",
+                            "shardId"_attr = response.shardId);
+                killRemoteCursor(_opCtx,
+                                 _executor.get(),
+                                 RemoteCursor(response.shardId.toString(),
+                                              *response.shardHostAndPort,
+                                              std::move(cursor.getValue())),
+                                 _nss);
+                continue;
+            }
+
             auto& cursorValue = cursor.getValue();
             if (const auto& cursorMetrics = cursorValue.getCursorMetrics()) {
                 CurOp::get(_opCtx)->debug().additiveMetrics.aggregateCursorMetrics(*cursorMetrics);
@@ -283,8 +451,15 @@ void CursorEstablisher::_waitForResponse() {
                 response.shardId.toString(), *response.shardHostAndPort, std::move(cursorValue));
         }
 
-        if (response.shardHostAndPort && !hadValidCursor) {
-            // If we never got a valid cursor, we do not need to clean the host.
+        if (hadValidCursor && !alreadyWon) {
+            if (auto it = _hedgedShards.find(response.shardId); it != _hedgedShards.end()) {
+                it->second.won = true;
+            }
+        }
+
+        if (response.shardHostAndPort && (!hadValidCursor || alreadyWon)) {
+            // If we never got a valid cursor from this response, or killed its late duplicates
+            // right away, we do not need to clean the host.
             _remotesToClean.pop_back();
         }
     } catch (const DBException& ex) {
@@ -399,6 +574,9 @@ void CursorEstablisher::_handleFailure(
     if (_wasInterrupted) {
         return;
     }
+    if (response && _canSkipForHedging(*response, status)) {
+        return;
+    }
     if (_maybeFailure) {
         _prioritizeFailures(std::move(status), isInterruption);
         return;
@@ -413,6 +591,25 @@ void CursorEstablisher::_handleFailure(
     _ars->stopRetrying();
 }
 
+bool CursorEstablisher::_canSkipForHedging(const AsyncRequestsSender::Response& response,
+                                           const Status& status) {
+    auto it = _hedgedShards.find(response.shardId);
+    if (it == _hedgedShards.end()) {
+        return false;
+    }
+    if (it->second.won || it->second.pendingAttempts > 0) {
+        // The sibling attempt for this shard already produced a cursor or may still do so, so
+        // this failure does not have to fail the operation.
+        LOGV2_DEBUG(9876538,
+                    3,
+                    "Ignoring failed hedged cursor-establishment attempt",
+                    "shardId"_attr = response.shardId,
+                    "error"_attr = status);
+        return true;
+    }
+    return false;
+}
+
 bool CursorEstablisher::_canSkipForPartialResults(const AsyncRequestsSender::Response& response,
                                                   const Status& status) {
     // If '_allowPartialResults' is true then swallow retriable errors, maxTimeMSExpired, and
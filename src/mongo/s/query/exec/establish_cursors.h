@@ -63,6 +63,12 @@ namespace mongo {
  * use the provided keys to kill operations on failure. Otherwise a unique operation key is
  * generated and attached to all requests.
  *
+ * When 'internalQueryCursorEstablishmentHedgingEnabled' is set and the read preference permits
+ * secondary targeting, establishment may be hedged: a duplicate attempt is raced against another
+ * eligible node of each shard, within the hedging budget knobs, and whichever cursor arrives
+ * first is kept. The losing cursor is killed. This bounds the latency impact of a single slow
+ * node on reads that already tolerate staleness.
+ *
  * @param allowPartialResults: If true, unreachable hosts are ignored, and only cursors established
  *                             on reachable hosts are returned.
  *
@@ -51,6 +51,7 @@
 #include "mongo/db/query/client_cursor/cursor_response.h"
 #include "mongo/executor/network_test_env.h"
 #include "mongo/executor/remote_command_request.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/catalog/type_shard.h"
 #include "mongo/s/query/exec/establish_cursors.h"
 #include "mongo/s/resource_yielders.h"
@@ -1175,6 +1176,172 @@ TEST_F(EstablishCursorsTest, MultipleRemotesMultipleDifferentErrors) {
     future.default_timed_get();
 }
 
+TEST_F(EstablishCursorsTest, HedgingKeepsFirstCursorAndKillsLoser) {
+    RAIIServerParameterControllerForTest hedgingEnabled(
+        "internalQueryCursorEstablishmentHedgingEnabled", true);
+
+    BSONObj cmdObj = fromjson("{find: 'testcoll'}");
+    std::vector<AsyncRequestsSender::Request> remotes{{kTestShardIds[0], cmdObj}};
+
+    auto future = launchAsync([&] {
+        auto cursors = establishCursors(operationContext(),
+                                        executor(),
+                                        _nss,
+                                        ReadPreferenceSetting{ReadPreference::Nearest},
+                                        remotes,
+                                        false);  // allowPartialResults
+        // Only the winning attempt's cursor is returned.
+        ASSERT_EQUALS(1u, cursors.size());
+        ASSERT_EQUALS(CursorId(123), cursors[0].getCursorResponse().getCursorId());
+    });
+
+    // The original attempt and its hedge both respond with a cursor; the first response wins.
+    onCommand([this](const RemoteCommandRequest& request) {
+        ASSERT_EQ(_nss.coll(), request.cmdObj.firstElement().valueStringData());
+        CursorResponse cursorResponse(_nss, CursorId(123), {});
+        return cursorResponse.toBSON(CursorResponse::ResponseType::InitialResponse);
+    });
+    onCommand([this](const RemoteCommandRequest& request) {
+        ASSERT_EQ(_nss.coll(), request.cmdObj.firstElement().valueStringData());
+        CursorResponse cursorResponse(_nss, CursorId(124), {});
+        return cursorResponse.toBSON(CursorResponse::ResponseType::InitialResponse);
+    });
+
+    // The losing attempt's cursor is killed.
+    onCommand([](const RemoteCommandRequest& request) {
+        ASSERT_TRUE(request.cmdObj.hasField("killCursors")) << request;
+        return BSON("ok" << 1);
+    });
+
+    future.default_timed_get();
+}
+
+TEST_F(EstablishCursorsTest, HedgingSwallowsLosingAttemptError) {
+    RAIIServerParameterControllerForTest hedgingEnabled(
+        "internalQueryCursorEstablishmentHedgingEnabled", true);
+
+    BSONObj cmdObj = fromjson("{find: 'testcoll'}");
+    std::vector<AsyncRequestsSender::Request> remotes{{kTestShardIds[0], cmdObj}};
+
+    auto future = launchAsync([&] {
+        auto cursors = establishCursors(operationContext(),
+                                        executor(),
+                                        _nss,
+                                        ReadPreferenceSetting{ReadPreference::Nearest},
+                                        remotes,
+                                        false);  // allowPartialResults
+        ASSERT_EQUALS(1u, cursors.size());
+    });
+
+    // The first attempt fails with a non-retriable error, but the operation still succeeds
+    // because the hedged attempt establishes a cursor.
+    onCommand([this](const RemoteCommandRequest& request) {
+        ASSERT_EQ(_nss.coll(), request.cmdObj.firstElement().valueStringData());
+        return createErrorCursorResponse(Status(ErrorCodes::FailedToParse, "failed to parse"));
+    });
+    onCommand([this](const RemoteCommandRequest& request) {
+        ASSERT_EQ(_nss.coll(), request.cmdObj.firstElement().valueStringData());
+        CursorResponse cursorResponse(_nss, CursorId(123), {});
+        return cursorResponse.toBSON(CursorResponse::ResponseType::InitialResponse);
+    });
+
+    future.default_timed_get();
+}
+
+TEST_F(EstablishCursorsTest, HedgingRespectsPerOperationLimit) {
+    RAIIServerParameterControllerForTest hedgingEnabled(
+        "internalQueryCursorEstablishmentHedgingEnabled", true);
+    RAIIServerParameterControllerForTest maxHedgedRemotes(
+        "internalQueryCursorEstablishmentMaxHedgedRemotes", 1);
+
+    BSONObj cmdObj = fromjson("{find: 'testcoll'}");
+    std::vector<AsyncRequestsSender::Request> remotes{
+        {kTestShardIds[0], cmdObj}, {kTestShardIds[1], cmdObj}, {kTestShardIds[2], cmdObj}};
+
+    auto future = launchAsync([&] {
+        auto cursors = establishCursors(operationContext(),
+                                        executor(),
+                                        _nss,
+                                        ReadPreferenceSetting{ReadPreference::Nearest},
+                                        remotes,
+                                        false);  // allowPartialResults
+        ASSERT_EQUALS(remotes.size(), cursors.size());
+    });
+
+    // The three original attempts plus exactly one hedged duplicate respond with cursors.
+    for (int i = 0; i < 4; ++i) {
+        onCommand([&](const RemoteCommandRequest& request) {
+            ASSERT_EQ(_nss.coll(), request.cmdObj.firstElement().valueStringData());
+            CursorResponse cursorResponse(_nss, CursorId(123 + i), {});
+            return cursorResponse.toBSON(CursorResponse::ResponseType::InitialResponse);
+        });
+    }
+
+    // The duplicate cursor for the hedged shard is killed.
+    onCommand([](const RemoteCommandRequest& request) {
+        ASSERT_TRUE(request.cmdObj.hasField("killCursors")) << request;
+        return BSON("ok" << 1);
+    });
+
+    future.default_timed_get();
+}
+
+TEST_F(EstablishCursorsTest, HedgingRespectsConcurrentBudget) {
+    RAIIServerParameterControllerForTest hedgingEnabled(
+        "internalQueryCursorEstablishmentHedgingEnabled", true);
+    RAIIServerParameterControllerForTest maxConcurrentHedges(
+        "internalQueryCursorEstablishmentMaxConcurrentHedges", 0);
+
+    BSONObj cmdObj = fromjson("{find: 'testcoll'}");
+    std::vector<AsyncRequestsSender::Request> remotes{{kTestShardIds[0], cmdObj}};
+
+    auto future = launchAsync([&] {
+        auto cursors = establishCursors(operationContext(),
+                                        executor(),
+                                        _nss,
+                                        ReadPreferenceSetting{ReadPreference::Nearest},
+                                        remotes,
+                                        false);  // allowPartialResults
+        ASSERT_EQUALS(1u, cursors.size());
+    });
+
+    // With the process-wide budget exhausted, only the original attempt is sent.
+    onCommand([this](const RemoteCommandRequest& request) {
+        ASSERT_EQ(_nss.coll(), request.cmdObj.firstElement().valueStringData());
+        CursorResponse cursorResponse(_nss, CursorId(123), {});
+        return cursorResponse.toBSON(CursorResponse::ResponseType::InitialResponse);
+    });
+
+    future.default_timed_get();
+}
+
+TEST_F(EstablishCursorsTest, NoHedgingForPrimaryOnlyReadPreference) {
+    RAIIServerParameterControllerForTest hedgingEnabled(
+        "internalQueryCursorEstablishmentHedgingEnabled", true);
+
+    BSONObj cmdObj = fromjson("{find: 'testcoll'}");
+    std::vector<AsyncRequestsSender::Request> remotes{{kTestShardIds[0], cmdObj}};
+
+    auto future = launchAsync([&] {
+        auto cursors = establishCursors(operationContext(),
+                                        executor(),
+                                        _nss,
+                                        ReadPreferenceSetting{ReadPreference::PrimaryOnly},
+                                        remotes,
+                                        false);  // allowPartialResults
+        ASSERT_EQUALS(1u, cursors.size());
+    });
+
+    // Reads that cannot run on a secondary are never hedged, so there is only one request.
+    onCommand([this](const RemoteCommandRequest& request) {
+        ASSERT_EQ(_nss.coll(), request.cmdObj.firstElement().valueStringData());
+        CursorResponse cursorResponse(_nss, CursorId(123), {});
+        return cursorResponse.toBSON(CursorResponse::ResponseType::InitialResponse);
+    });
+
+    future.default_timed_get();
+}
+
 }  // namespace
 
 }  // namespace mongo
@@ -66,6 +66,7 @@
 #include "mongo/s/query_analysis_sample_tracker.h"
 #include "mongo/s/query_analysis_sampler.h"
 #include "mongo/s/refresh_query_analyzer_configuration_cmd_gen.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/duration.h"
@@ -91,6 +92,20 @@ const auto getQueryAnalysisSampler = ServiceContext::declareDecoration<QueryAnal
 
 constexpr auto kActiveCollectionsFieldName = "activeCollections"_sd;
 
+/**
+ * A small per-thread allowance of sample tokens for one collection, reserved in a batch from the
+ * collection's SampleRateLimiter. Consuming a reserved token does not require acquiring the mutex
+ * protecting the rate limiters. A bucket is only valid for the sampler and configuration
+ * generation it was reserved under.
+ */
+struct LocalSampleTokenBucket {
+    const QueryAnalysisSampler* sampler = nullptr;
+    uint64_t generation = 0;
+    double numTokens = 0;
+};
+
+thread_local stdx::unordered_map<NamespaceString, LocalSampleTokenBucket> localSampleTokenBuckets;
+
 bool isApproximatelyEqual(double val0, double val1, double epsilon) {
     return std::fabs(val0 - val1) < (epsilon + std::numeric_limits<double>::epsilon());
 }
@@ -228,25 +243,25 @@ void QueryAnalysisSampler::QueryStats::refreshTotalCount() {
     long long newTotalCount = [&] {
         if (serverGlobalParams.clusterRole.hasExclusively(ClusterRole::RouterServer)) {
             auto& opCountersToUse = serviceOpCounters(ClusterRole::RouterServer);
-            return opCountersToUse.getUpdate()->load() +  //
-                opCountersToUse.getDelete()->load() +     //
-                opCountersToUse.getQuery()->load() +      //
-                _lastFindAndModifyQueriesCount +          //
-                _lastAggregateQueriesCount +              //
-                _lastCountQueriesCount +                  //
+            return opCountersToUse.getUpdate() +  //
+                opCountersToUse.getDelete() +     //
+                opCountersToUse.getQuery() +      //
+                _lastFindAndModifyQueriesCount +  //
+                _lastAggregateQueriesCount +      //
+                _lastCountQueriesCount +          //
                 _lastDistinctQueriesCount;
 
         } else if (serverGlobalParams.clusterRole.has(ClusterRole::None)) {
             auto& opCountersToUse = serviceOpCounters(ClusterRole::ShardServer);
-            return opCountersToUse.getUpdate()->load() +  //
-                opCountersToUse.getDelete()->load() +     //
-                opCountersToUse.getQuery()->load() +      //
-                _lastFindAndModifyQueriesCount +          //
-                _lastAggregateQueriesCount +              //
-                _lastCountQueriesCount +                  //
+            return opCountersToUse.getUpdate() +  //
+                opCountersToUse.getDelete() +     //
+                opCountersToUse.getQuery() +      //
+                _lastFindAndModifyQueriesCount +  //
+                _lastAggregateQueriesCount +      //
+                _lastCountQueriesCount +          //
                 _lastDistinctQueriesCount;
         } else if (serverGlobalParams.clusterRole.has(ClusterRole::ShardServer)) {
-            return serviceOpCounters(ClusterRole::ShardServer).getNestedAggregate()->load();
+            return serviceOpCounters(ClusterRole::ShardServer).getNestedAggregate();
         }
         MONGO_UNREACHABLE;
     }();
@@ -334,6 +349,35 @@ bool QueryAnalysisSampler::SampleRateLimiter::tryConsume() {
     return false;
 }
 
+double QueryAnalysisSampler::SampleRateLimiter::tryConsumeBatch(double maxTokens) {
+    invariant(maxTokens >= 1);
+    _refill(_numTokensPerSecond, _getBurstCapacity(_numTokensPerSecond));
+
+    if (_lastNumTokens < 1 && isApproximatelyEqual(_lastNumTokens, 1, kEpsilon)) {
+        // To avoid skipping queries that could have been sampled, allow one token to be consumed
+        // if there is nearly one.
+        _lastNumTokens = 0;
+        LOGV2_DEBUG(9876524,
+                    3,
+                    "Successfully consumed approximately one token",
+                    logAttrs(_nss),
+                    "collectionUUID"_attr = _collUuid,
+                    "lastNumTokens"_attr = _lastNumTokens);
+        return 1;
+    }
+
+    double numConsumed = std::min(maxTokens, std::floor(_lastNumTokens));
+    _lastNumTokens -= numConsumed;
+    LOGV2_DEBUG(9876525,
+                3,
+                "Consumed a batch of tokens",
+                logAttrs(_nss),
+                "collectionUUID"_attr = _collUuid,
+                "numConsumed"_attr = numConsumed,
+                "lastNumTokens"_attr = _lastNumTokens);
+    return numConsumed;
+}
+
 void QueryAnalysisSampler::SampleRateLimiter::refreshSamplesPerSecond(double numTokensPerSecond) {
     // Fill the bucket with tokens created by the previous rate before setting a new rate.
     _refill(_numTokensPerSecond, _getBurstCapacity(numTokensPerSecond));
@@ -427,6 +471,9 @@ void QueryAnalysisSampler::_refreshConfigurations(OperationContext* opCtx) {
         _srlBloomFilter[i].store(srlBloomFilter[i]);
     }
 
+    // Invalidate the tokens that threads have reserved under the previous configurations.
+    _configurationGeneration.fetchAndAdd(1);
+
     QueryAnalysisSampleTracker::get(opCtx).refreshConfigurations(configurations);
 }
 
@@ -489,15 +536,7 @@ boost::optional<UUID> QueryAnalysisSampler::tryGenerateSampleId(OperationContext
         return boost::none;
     }
 
-    stdx::lock_guard<stdx::mutex> lk(_sampleRateLimitersMutex);
-    auto it = _sampleRateLimiters.find(nss);
-
-    if (it == _sampleRateLimiters.end()) {
-        return boost::none;
-    }
-
-    auto& rateLimiter = it->second;
-    if (rateLimiter.tryConsume()) {
+    auto onSampled = [&] {
         if (serverGlobalParams.clusterRole.hasExclusively(ClusterRole::RouterServer) ||
             serverGlobalParams.clusterRole.has(ClusterRole::ShardServer)) {
             // On a standalone replica set, sample selection is done by the mongod persisting the
@@ -506,7 +545,37 @@ boost::optional<UUID> QueryAnalysisSampler::tryGenerateSampleId(OperationContext
             _incrementCounters(opCtx, nss, cmdName);
         }
         return UUID::gen();
+    };
+
+    // Consume a token that this thread has already reserved, if there is one, without acquiring
+    // '_sampleRateLimitersMutex'.
+    const auto generation = _configurationGeneration.load();
+    auto& localBucket = localSampleTokenBuckets[nss];
+    if (localBucket.sampler == this && localBucket.generation == generation &&
+        localBucket.numTokens >= 1) {
+        localBucket.numTokens -= 1;
+        return onSampled();
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_sampleRateLimitersMutex);
+    auto it = _sampleRateLimiters.find(nss);
+
+    if (it == _sampleRateLimiters.end()) {
+        localSampleTokenBuckets.erase(nss);
+        return boost::none;
+    }
+
+    auto& rateLimiter = it->second;
+
+    // Reserve a batch of tokens for this thread; consume one now and keep the rest in the
+    // thread-local bucket. Tokens reserved under a stale configuration generation are discarded
+    // conservatively rather than spent.
+    auto numTokens = rateLimiter.tryConsumeBatch(kMaxTokensPerLocalBatch);
+    if (numTokens >= 1) {
+        localBucket = {this, generation, numTokens - 1};
+        return onSampled();
     }
+    localBucket = {this, generation, 0};
     return boost::none;
 }
 
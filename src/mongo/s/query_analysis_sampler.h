@@ -158,6 +158,15 @@ public:
          */
         bool tryConsume();
 
+        /**
+         * Requests to consume up to 'maxTokens' whole tokens from the bucket. Causes the bucket to
+         * be refilled with tokens created since last refill time. Does not block if the bucket is
+         * empty. Returns the number of tokens consumed, which may be zero. Used to reserve a small
+         * batch of tokens for a thread-local bucket so that the caller does not have to take the
+         * mutex protecting this rate limiter on every request.
+         */
+        double tryConsumeBatch(double maxTokens);
+
         /**
          * Sets a new rate. Causes the bucket to be refilled with tokens created since last refill
          * time according to the previous rate.
@@ -241,6 +250,12 @@ public:
     }
 
 private:
+    // The maximum number of tokens a thread may reserve from a collection's SampleRateLimiter in
+    // one batch. Reserved tokens are consumed from a thread-local bucket without taking
+    // '_sampleRateLimitersMutex'. Kept small so that tokens reserved by threads that stop issuing
+    // queries against the collection do not noticeably lower the effective sample rate.
+    static constexpr double kMaxTokensPerLocalBatch = 4;
+
     static constexpr size_t srlBloomFilterLg2NumBits = 9u;
     static constexpr size_t srlBloomFilterNumBitsPerBlock = 64u;
 
@@ -265,6 +280,11 @@ private:
     std::shared_ptr<PeriodicJobAnchor> _periodicConfigurationsRefresher;
     std::map<NamespaceString, SampleRateLimiter> _sampleRateLimiters;
     std::array<AtomicWord<uint64_t>, srlBloomFilterNumBlocks> _srlBloomFilter{};
+
+    // Incremented on every configuration refresh. Thread-local token buckets tagged with an older
+    // generation are discarded so that reserved tokens do not outlive the rate they were drawn
+    // from.
+    AtomicWord<uint64_t> _configurationGeneration{0};
 };
 
 }  // namespace analyze_shard_key
@@ -221,6 +221,45 @@ TEST_F(QueryAnalysisSamplerRateLimiterTest, ConsumeEpsilonAbove) {
     ASSERT_FALSE(rateLimiter.tryConsume());
 }
 
+TEST_F(QueryAnalysisSamplerRateLimiterTest, ConsumeBatch) {
+    const RAIIServerParameterControllerForTest burstMultiplierController{
+        "queryAnalysisSamplerBurstMultiplier", 1};
+
+    auto rateLimiter =
+        QueryAnalysisSampler::SampleRateLimiter(getServiceContext(), nss, collUuid, 4);
+    ASSERT_EQ(rateLimiter.getSamplesPerSecond(), 4);
+    ASSERT_EQ(rateLimiter.getBurstCapacity(), 4);
+    // There are no token available in the bucket initially.
+    ASSERT_EQ(rateLimiter.tryConsumeBatch(4), 0);
+
+    advanceTime(Milliseconds(1000));
+    // The number of tokens available in the bucket right after the refill is 0 + 4. The batch is
+    // capped by the number of requested tokens.
+    ASSERT_EQ(rateLimiter.tryConsumeBatch(3), 3);
+    // The batch is capped by the number of whole tokens remaining.
+    ASSERT_EQ(rateLimiter.tryConsumeBatch(3), 1);
+    ASSERT_EQ(rateLimiter.tryConsumeBatch(3), 0);
+    ASSERT_FALSE(rateLimiter.tryConsume());
+}
+
+TEST_F(QueryAnalysisSamplerRateLimiterTest, ConsumeBatchEpsilonAbove) {
+    const RAIIServerParameterControllerForTest burstMultiplierController{
+        "queryAnalysisSamplerBurstMultiplier", 1};
+
+    auto rateLimiter =
+        QueryAnalysisSampler::SampleRateLimiter(getServiceContext(), nss, collUuid, 1);
+    ASSERT_EQ(rateLimiter.getSamplesPerSecond(), 1);
+    ASSERT_EQ(rateLimiter.getBurstCapacity(), 1);
+    // There are no token available in the bucket initially.
+    ASSERT_EQ(rateLimiter.tryConsumeBatch(4), 0);
+
+    advanceTime(Milliseconds(999));
+    // The number of tokens available in the bucket right after the refill is 0 + 0.999, which is
+    // nearly one.
+    ASSERT_EQ(rateLimiter.tryConsumeBatch(4), 1);
+    ASSERT_EQ(rateLimiter.tryConsumeBatch(4), 0);
+}
+
 TEST_F(QueryAnalysisSamplerRateLimiterTest, ConsumeRemainingTokens) {
     const RAIIServerParameterControllerForTest burstMultiplierController{
         "queryAnalysisSamplerBurstMultiplier", 1};
@@ -29,6 +29,9 @@
 
 #include "mongo/s/shard_key_pattern.h"
 
+#include <absl/container/inlined_vector.h>
+
+#include <algorithm>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
@@ -128,11 +131,11 @@ bool isValidShardKeyElement(const BSONElement& element) {
     return !element.eoo() && element.type() != Array;
 }
 
-BSONElement extractKeyElementFromDoc(const BSONObj& obj, StringData pathStr) {
+BSONElement extractKeyElementFromDoc(const BSONObj& obj, const FieldRef& path) {
     // Any arrays found get immediately returned. We are equipped up the call stack to specifically
     // deal with array values.
     size_t idxPath;
-    return getFieldDottedOrArray(obj, FieldRef(pathStr), &idxPath);
+    return getFieldDottedOrArray(obj, path, &idxPath);
 }
 
 /**
@@ -195,11 +198,28 @@ BSONElement ShardKeyPattern::extractHashedField(BSONObj keyPattern) {
     }
     return BSONElement();
 }
+std::vector<ShardKeyPattern::ExtractionField> ShardKeyPattern::_makeExtractionFields(
+    const BSONObj& keyPattern, const std::vector<std::unique_ptr<FieldRef>>& paths) {
+    std::vector<ExtractionField> fields;
+    fields.reserve(paths.size());
+
+    size_t i = 0;
+    for (const auto& patternEl : keyPattern) {
+        const auto* path = paths[i++].get();
+        fields.push_back({patternEl, path, isHashedPatternEl(patternEl), path->numParts() == 1});
+    }
+    return fields;
+}
+
 ShardKeyPattern::ShardKeyPattern(const BSONObj& keyPattern)
     : _keyPattern(keyPattern),
       _keyPatternPaths(parseShardKeyPattern(keyPattern)),
       _hasId(keyPattern.hasField("_id"_sd)),
-      _hashedField(extractHashedField(keyPattern)) {}
+      _hashedField(extractHashedField(keyPattern)),
+      _extractionFields(_makeExtractionFields(_keyPattern.toBSON(), _keyPatternPaths)),
+      _allFieldsTopLevel(std::all_of(_extractionFields.begin(),
+                                     _extractionFields.end(),
+                                     [](const auto& field) { return field.isTopLevel; })) {}
 
 ShardKeyPattern::ShardKeyPattern(const KeyPattern& keyPattern)
     : ShardKeyPattern(keyPattern.toBSON()) {}
@@ -333,9 +353,9 @@ BSONObj ShardKeyPattern::extractShardKeyFromIndexKeyData(
 
 BSONObj ShardKeyPattern::extractShardKeyFromDocumentKey(const BSONObj& documentKey) const {
     BSONObjBuilder keyBuilder;
-    for (auto&& shardKeyField : _keyPattern.toBSON()) {
+    for (const auto& field : _extractionFields) {
         auto matchEl =
-            extractFieldFromDocumentKey(documentKey, shardKeyField.fieldNameStringData());
+            extractFieldFromDocumentKey(documentKey, field.patternEl.fieldNameStringData());
 
         if (matchEl.eoo()) {
             matchEl = kNullObj.firstElement();
@@ -347,12 +367,12 @@ BSONObj ShardKeyPattern::extractShardKeyFromDocumentKey(const BSONObj& documentK
             return BSONObj();
         }
 
-        if (isHashedPatternEl(shardKeyField)) {
+        if (field.isHashed) {
             keyBuilder.append(
-                shardKeyField.fieldNameStringData(),
+                field.patternEl.fieldNameStringData(),
                 BSONElementHasher::hash64(matchEl, BSONElementHasher::DEFAULT_HASH_SEED));
         } else {
-            keyBuilder.appendAs(matchEl, shardKeyField.fieldNameStringData());
+            keyBuilder.appendAs(matchEl, field.patternEl.fieldNameStringData());
         }
     }
     dassert(isShardKey(keyBuilder.asTempObj()));
@@ -369,10 +389,58 @@ BSONObj ShardKeyPattern::extractShardKeyFromDocumentKeyThrows(const BSONObj& doc
     return shardKey;
 }
 
+BSONObj ShardKeyPattern::_extractShardKeyFromDocSinglePass(const BSONObj& doc) const {
+    // Match document fields against the key pattern fields in one scan of the document, rather
+    // than walking the document once per pattern field. Shard key patterns rarely have more than a
+    // handful of fields, so the per-field inner loop stays cheap.
+    absl::InlinedVector<BSONElement, 4> matched(_extractionFields.size());
+
+    auto remaining = _extractionFields.size();
+    for (const auto& docEl : doc) {
+        const auto docFieldName = docEl.fieldNameStringData();
+        for (size_t i = 0; i < _extractionFields.size(); ++i) {
+            if (matched[i].eoo() &&
+                docFieldName == _extractionFields[i].patternEl.fieldNameStringData()) {
+                matched[i] = docEl;
+                --remaining;
+                break;
+            }
+        }
+        if (remaining == 0) {
+            break;
+        }
+    }
+
+    BSONObjBuilder keyBuilder;
+    for (size_t i = 0; i < _extractionFields.size(); ++i) {
+        const auto& field = _extractionFields[i];
+        BSONElement matchEl = matched[i].eoo() ? kNullObj.firstElement() : matched[i];
+
+        if (!isValidShardKeyElementForExtractionFromDocument(matchEl)) {
+            return BSONObj();
+        }
+
+        if (field.isHashed) {
+            keyBuilder.append(
+                field.patternEl.fieldNameStringData(),
+                BSONElementHasher::hash64(matchEl, BSONElementHasher::DEFAULT_HASH_SEED));
+        } else {
+            keyBuilder.appendAs(matchEl, field.patternEl.fieldNameStringData());
+        }
+    }
+
+    dassert(isShardKey(keyBuilder.asTempObj()));
+    return keyBuilder.obj();
+}
+
 BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
+    if (_allFieldsTopLevel) {
+        return _extractShardKeyFromDocSinglePass(doc);
+    }
+
     BSONObjBuilder keyBuilder;
-    for (auto&& patternEl : _keyPattern.toBSON()) {
-        BSONElement matchEl = extractKeyElementFromDoc(doc, patternEl.fieldNameStringData());
+    for (const auto& field : _extractionFields) {
+        BSONElement matchEl = extractKeyElementFromDoc(doc, *field.path);
 
         if (matchEl.eoo()) {
             matchEl = kNullObj.firstElement();
@@ -382,14 +450,14 @@ BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
             return BSONObj();
         }
 
-        if (isHashedPatternEl(patternEl)) {
+        if (field.isHashed) {
             keyBuilder.append(
-                patternEl.fieldName(),
+                field.patternEl.fieldNameStringData(),
                 BSONElementHasher::hash64(matchEl, BSONElementHasher::DEFAULT_HASH_SEED));
         } else {
             // NOTE: The matched element may *not* have the same field name as the path -
             // index keys don't contain field names, for example
-            keyBuilder.appendAs(matchEl, patternEl.fieldName());
+            keyBuilder.appendAs(matchEl, field.patternEl.fieldNameStringData());
         }
     }
 
@@ -409,14 +477,14 @@ BSONObj ShardKeyPattern::extractShardKeyFromDocThrows(const BSONObj& doc) const
 
 BSONObj ShardKeyPattern::emplaceMissingShardKeyValuesForDocument(const BSONObj doc) const {
     BSONObjBuilder fullDocBuilder(doc);
-    for (const auto& skField : _keyPattern.toBSON()) {
+    for (const auto& field : _extractionFields) {
         // Illegal to emplace a null _id.
-        if (skField.fieldNameStringData() == kIdField) {
+        if (field.patternEl.fieldNameStringData() == kIdField) {
             continue;
         }
-        auto matchEl = extractKeyElementFromDoc(doc, skField.fieldNameStringData());
+        auto matchEl = extractKeyElementFromDoc(doc, *field.path);
         if (matchEl.eoo()) {
-            fullDocBuilder << skField.fieldNameStringData() << BSONNULL;
+            fullDocBuilder << field.patternEl.fieldNameStringData() << BSONNULL;
         }
     }
 
@@ -270,6 +270,28 @@ public:
     static bool isValidShardKeyElementForStorage(const BSONElement& element);
 
 private:
+    /**
+     * Extraction metadata for a single key pattern field, precomputed at construction so that
+     * per-document extraction does not have to re-parse the pattern. 'patternEl' references the
+     * buffer owned by '_keyPattern' and 'path' points at the corresponding entry of
+     * '_keyPatternPaths'.
+     */
+    struct ExtractionField {
+        BSONElement patternEl;
+        const FieldRef* path;
+        bool isHashed;
+        bool isTopLevel;
+    };
+
+    static std::vector<ExtractionField> _makeExtractionFields(
+        const BSONObj& keyPattern, const std::vector<std::unique_ptr<FieldRef>>& paths);
+
+    /**
+     * Extracts the shard key from 'doc' with a single scan of its top-level fields. Only valid
+     * when '_allFieldsTopLevel' is true.
+     */
+    BSONObj _extractShardKeyFromDocSinglePass(const BSONObj& doc) const;
+
     KeyPattern _keyPattern;
 
     // Ordered, parsed paths
@@ -277,6 +299,13 @@ private:
 
     bool _hasId;
     BSONElement _hashedField;
+
+    // One entry per key pattern field, in pattern order.
+    std::vector<ExtractionField> _extractionFields;
+
+    // True when every key pattern field is a top-level path, which allows extracting the shard key
+    // from a document in a single pass rather than one dotted-path walk per field.
+    bool _allFieldsTopLevel;
 };
 
 }  // namespace mongo
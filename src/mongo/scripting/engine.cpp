@@ -462,10 +462,69 @@ private:
 };
 
 ScopeCache scopeCache;
+
+/**
+ * Holds the most recently retired scope created via newScopeForCurrentThread(), so that
+ * back-to-back operations on the same thread with an identical environment (as captured by the
+ * caller's reuse key) can skip scope construction. Unlike the ScopeCache above, these scopes are
+ * bound to their creating thread and never marshal calls elsewhere, so a per-thread slot is the
+ * only safe sharing granularity.
+ */
+struct RetiredThreadScope {
+    std::string reuseKey;
+    std::unique_ptr<Scope> scope;
+};
+
+thread_local RetiredThreadScope retiredThreadScope;
+
+// More generous than the pooled scopes' reuse window: thread scopes are reused only for an
+// identical environment, so the main reason to age them out is to bound the growth of per-scope
+// caches (e.g. compiled functions) across many distinct sources.
+constexpr Minutes kMaxThreadScopeReuseTime{10};
 }  // anonymous namespace
 
 void ScriptEngine::dropScopeCache() {
     scopeCache.clear();
+    retiredThreadScope = {};
+}
+
+std::unique_ptr<Scope> ScriptEngine::tryReuseScopeForCurrentThread(const std::string& reuseKey) {
+    auto& slot = retiredThreadScope;
+    if (reuseKey.empty() || !slot.scope || slot.reuseKey != reuseKey) {
+        return nullptr;
+    }
+
+    std::unique_ptr<Scope> scope = std::move(slot.scope);
+    slot.reuseKey.clear();
+
+    if (Date_t::now() - scope->getCreateTime() > kMaxThreadScopeReuseTime) {
+        return nullptr;  // too old to reuse
+    }
+
+    scope->reset();
+    return scope;
+}
+
+void ScriptEngine::recycleScopeForCurrentThread(const std::string& reuseKey,
+                                                std::unique_ptr<Scope> scope) {
+    if (reuseKey.empty() || !scope) {
+        return;
+    }
+
+    if (scope->hasOutOfMemoryException()) {
+        return;  // same policy as ScopeCache::release
+    }
+
+    if (Date_t::now() - scope->getCreateTime() > kMaxThreadScopeReuseTime) {
+        return;  // too old to save
+    }
+
+    if (!scope->getError().empty()) {
+        return;  // not saving errored scopes
+    }
+
+    scope->reset();
+    retiredThreadScope = {reuseKey, std::move(scope)};
 }
 
 class PooledScope : public Scope {
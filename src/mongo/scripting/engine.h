@@ -288,6 +288,22 @@ public:
                                           const DatabaseName& db,
                                           const std::string& scopeType);
 
+    /**
+     * Returns the scope most recently retired on this thread via recycleScopeForCurrentThread(),
+     * reset and ready for use, if its reuse key matches 'reuseKey'; otherwise nullptr. The caller
+     * is responsible for registering the scope with its operation.
+     */
+    std::unique_ptr<Scope> tryReuseScopeForCurrentThread(const std::string& reuseKey);
+
+    /**
+     * Retires a scope created with newScopeForCurrentThread() so that the next
+     * tryReuseScopeForCurrentThread() call on this thread with the same reuse key can skip scope
+     * construction. 'reuseKey' must capture everything that fed the scope's setup (authenticated
+     * users, database, injected variables, heap limit); callers passing an empty key opt out of
+     * reuse. Errored, out-of-memory, and aged-out scopes are discarded rather than saved.
+     */
+    void recycleScopeForCurrentThread(const std::string& reuseKey, std::unique_ptr<Scope> scope);
+
     using ScopeCallback = void (*)(Scope&);
     ScopeCallback getScopeInitCallback() {
         return _scopeInitCallback;
@@ -31,13 +31,18 @@
 
 #ifdef MONGO_CONFIG_OTEL
 
+#include <algorithm>
+
 #include <opentelemetry/exporters/otlp/otlp_file_exporter_factory.h>
 #include <opentelemetry/exporters/otlp/otlp_file_exporter_options.h>
 #include <opentelemetry/exporters/otlp/otlp_http_exporter_factory.h>
 #include <opentelemetry/exporters/otlp/otlp_http_exporter_options.h>
+#include <opentelemetry/sdk/trace/batch_span_processor_factory.h>
 #include <opentelemetry/sdk/trace/batch_span_processor_options.h>
+#include <opentelemetry/sdk/trace/exporter.h>
 #include <opentelemetry/sdk/trace/processor.h>
-#include <opentelemetry/sdk/trace/simple_processor_factory.h>
+#include <opentelemetry/sdk/trace/samplers/parent_factory.h>
+#include <opentelemetry/sdk/trace/samplers/trace_id_ratio_factory.h>
 #include <opentelemetry/sdk/trace/tracer_provider.h>
 #include <opentelemetry/sdk/trace/tracer_provider_factory.h>
 #include <opentelemetry/trace/provider.h>
@@ -56,27 +61,44 @@ namespace otlp = opentelemetry::exporter::otlp;
 namespace trace_api = opentelemetry::trace;
 namespace trace_sdk = opentelemetry::sdk::trace;
 
-Status initializeHttp(std::string name, std::string endpoint) {
-    LOGV2(9859702,
-          "Initializing OpenTelemetry tracing using HTTP exporter",
-          "name"_attr = name,
-          "endpoint"_attr = endpoint);
-
+/**
+ * Installs a provider that batches finished spans off the operation thread and samples traces at
+ * `opentelemetryTraceSampleRatio`. The batch processor enqueues a finished span into a bounded
+ * in-memory buffer and a dedicated thread flushes it to the exporter, so span end never performs
+ * exporter I/O inline; sampling decisions are made at root-span creation and inherited by
+ * children, so a trace is either recorded whole or skipped whole.
+ */
+void installProvider(std::string name, std::unique_ptr<trace_sdk::SpanExporter> exporter) {
     auto pid = ProcessId::getCurrent().toString();
 
-    opentelemetry::exporter::otlp::OtlpHttpExporterOptions opts;
-    opts.url = endpoint;
+    trace_sdk::BatchSpanProcessorOptions batchOpts;
+    batchOpts.max_queue_size = static_cast<size_t>(gOpenTelemetryMaxQueueSize);
+    batchOpts.max_export_batch_size =
+        std::min(batchOpts.max_export_batch_size, batchOpts.max_queue_size);
+    auto processor = trace_sdk::BatchSpanProcessorFactory::Create(std::move(exporter), batchOpts);
 
-    auto exporter = otlp::OtlpHttpExporterFactory::Create(opts);
-    auto processor = trace_sdk::SimpleSpanProcessorFactory::Create(std::move(exporter));
+    auto sampler = trace_sdk::ParentBasedSamplerFactory::Create(
+        trace_sdk::TraceIdRatioBasedSamplerFactory::Create(gOpenTelemetryTraceSampleRatio));
 
     auto resourceAttributes = opentelemetry::sdk::resource::ResourceAttributes{
         {"service.name", name}, {"service.instance.id", pid}};
     auto resource = opentelemetry::sdk::resource::Resource::Create(resourceAttributes);
 
-    std::shared_ptr<trace_api::TracerProvider> provider =
-        trace_sdk::TracerProviderFactory::Create(std::move(processor), resource);
+    std::shared_ptr<trace_api::TracerProvider> provider = trace_sdk::TracerProviderFactory::Create(
+        std::move(processor), resource, std::move(sampler));
     trace_api::Provider::SetTracerProvider(std::move(provider));
+}
+
+Status initializeHttp(std::string name, std::string endpoint) {
+    LOGV2(9859702,
+          "Initializing OpenTelemetry tracing using HTTP exporter",
+          "name"_attr = name,
+          "endpoint"_attr = endpoint);
+
+    opentelemetry::exporter::otlp::OtlpHttpExporterOptions opts;
+    opts.url = endpoint;
+
+    installProvider(std::move(name), otlp::OtlpHttpExporterFactory::Create(opts));
 
     return Status::OK();
 }
@@ -87,23 +109,13 @@ Status initializeFile(std::string name, std::string directory) {
           "name"_attr = name,
           "directory"_attr = directory);
 
-    auto pid = ProcessId::getCurrent().toString();
-
     otlp::OtlpFileExporterOptions opts;
     otlp::OtlpFileClientFileSystemOptions sysOpts;
-    sysOpts.file_pattern = fmt::format("{}/{}-{}-%Y%m%d-trace.jsonl", directory, name, pid);
+    sysOpts.file_pattern = fmt::format(
+        "{}/{}-{}-%Y%m%d-trace.jsonl", directory, name, ProcessId::getCurrent().toString());
     opts.backend_options = sysOpts;
 
-    auto exporter = otlp::OtlpFileExporterFactory::Create(opts);
-    auto processor = trace_sdk::SimpleSpanProcessorFactory::Create(std::move(exporter));
-
-    auto resourceAttributes = opentelemetry::sdk::resource::ResourceAttributes{
-        {"service.name", name}, {"service.instance.id", pid}};
-    auto resource = opentelemetry::sdk::resource::Resource::Create(resourceAttributes);
-
-    std::shared_ptr<trace_api::TracerProvider> provider =
-        trace_sdk::TracerProviderFactory::Create(std::move(processor), resource);
-    trace_api::Provider::SetTracerProvider(std::move(provider));
+    installProvider(std::move(name), otlp::OtlpFileExporterFactory::Create(opts));
 
     return Status::OK();
 }
@@ -48,7 +48,7 @@ inline Status initialize(std::string) {
     return Status::OK();
 }
 
-inline void shutdown();
+inline void shutdown() {}
 
 #endif
 
@@ -48,6 +48,8 @@ public:
             std::make_shared<opentelemetry::trace::NoopTracerProvider>());
         tracing::gOpenTelemetryHttpEndpoint.clear();
         tracing::gOpenTelemetryTraceDirectory.clear();
+        tracing::gOpenTelemetryTraceSampleRatio = 1.0;
+        tracing::gOpenTelemetryMaxQueueSize = 2048;
     }
 
     void tearDown() override {
@@ -88,6 +90,16 @@ TEST_F(TraceInitializationTest, HttpTraceProvider) {
     ASSERT_FALSE(isNoop(provider.get()));
 }
 
+TEST_F(TraceInitializationTest, SampledFileTraceProvider) {
+    tracing::gOpenTelemetryTraceDirectory = "/tmp/";
+    tracing::gOpenTelemetryTraceSampleRatio = 0.25;
+    tracing::gOpenTelemetryMaxQueueSize = 64;
+    ASSERT_OK(tracing::initialize("mongod"));
+
+    auto provider = opentelemetry::trace::Provider::GetTracerProvider();
+    ASSERT_FALSE(isNoop(provider.get()));
+}
+
 TEST_F(TraceInitializationTest, HttpAndDirectory) {
     tracing::gOpenTelemetryHttpEndpoint = "http://localhost:4318/v1/traces";
     tracing::gOpenTelemetryTraceDirectory = "/tmp/";
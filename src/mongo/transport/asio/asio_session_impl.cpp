@@ -30,6 +30,8 @@
 
 #include "mongo/transport/asio/asio_session_impl.h"
 
+#include <algorithm>
+
 #include "mongo/config.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/connection_health_metrics_parameter_gen.h"
@@ -39,6 +41,7 @@
 #include "mongo/transport/asio/asio_utils.h"
 #include "mongo/transport/proxy_protocol_header_parser.h"
 #include "mongo/transport/session_util.h"
+#include "mongo/transport/transport_options_gen.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/future_util.h"
 #include "mongo/util/net/socket_utils.h"
@@ -134,6 +137,16 @@ size_t readFromStream(Stream& stream, MutableBufferSequence buffers, std::error_
         ec);
 }
 
+template <typename Stream, typename MutableBufferSequence>
+size_t readSomeFromStream(Stream& stream, const MutableBufferSequence& buffers,
+                          std::error_code& ec) {
+    size_t size;
+    do {
+        size = stream.read_some(buffers, ec);
+    } while (ec == asio::error::interrupted);
+    return size;
+}
+
 template <typename Stream, typename MutableBufferSequence>
 size_t writeToStream(Stream& stream, MutableBufferSequence buffers, std::error_code& ec) {
     return doOperation(
@@ -256,6 +269,10 @@ Future<Message> CommonAsioSession::asyncSourceMessage(const BatonHandle& baton)
 
 Status CommonAsioSession::waitForData() try {
     ensureSync();
+    if (bufferedBytes() > 0) {
+        // Part of the next message has already been received into the coalescing buffer.
+        return Status::OK();
+    }
     asio::error_code ec;
     getSocket().wait(asio::ip::tcp::socket::wait_read, ec);
     return errorCodeToStatus(ec, "waitForData");
@@ -265,6 +282,10 @@ Status CommonAsioSession::waitForData() try {
 
 Future<void> CommonAsioSession::asyncWaitForData() try {
     ensureAsync();
+    if (bufferedBytes() > 0) {
+        // Part of the next message has already been received into the coalescing buffer.
+        return Future<void>::makeReady();
+    }
     return getSocket().async_wait(asio::ip::tcp::socket::wait_read, UseFuture{});
 } catch (const DBException& ex) {
     return ex.toStatus();
@@ -277,6 +298,65 @@ Status CommonAsioSession::sinkMessage(Message message) try {
     return ex.toStatus();
 }
 
+Status CommonAsioSession::sinkMessages(std::vector<Message> messages) try {
+    ensureSync();
+    _asyncOpState.start();
+    ScopeGuard completionGuard([&] { _asyncOpState.complete(); });
+
+    // Gather the messages into a single buffer sequence so the batch goes out with one
+    // vectored write syscall (modulo socket buffer capacity).
+    std::vector<asio::const_buffer> buffers;
+    buffers.reserve(messages.size());
+    size_t totalSize = 0;
+    for (const auto& message : messages) {
+        buffers.emplace_back(message.buf(), message.size());
+        totalSize += message.size();
+    }
+
+    // The blocking asio::write only returns short on an error such as an interrupted
+    // syscall, in which case the fully written buffers are dropped and the partially
+    // written one is trimmed before retrying.
+    auto writeAll = [&](auto& stream) {
+        std::error_code ec;
+        for (;;) {
+            auto size = asio::write(stream, buffers, ec);
+            if (ec != asio::error::interrupted) {
+                return ec;
+            }
+            while (size > 0 && size >= buffers.front().size()) {
+                size -= buffers.front().size();
+                buffers.erase(buffers.begin());
+            }
+            if (buffers.empty()) {
+                return std::error_code();
+            }
+            buffers.front() += size;
+        }
+    };
+
+    std::error_code ec;
+#ifdef MONGO_CONFIG_SSL
+    _ranHandshake = true;
+    if (_sslSocket) {
+        ec = writeAll(*_sslSocket);
+    } else {
+        ec = writeAll(_socket);
+    }
+#else
+    ec = writeAll(_socket);
+#endif
+
+    auto status = futurize(ec).getNoThrow();
+    if (status.isOK()) {
+        auto connectionType = _isIngressSession ? NetworkCounter::ConnectionType::kIngress
+                                                : NetworkCounter::ConnectionType::kEgress;
+        networkCounter.hitPhysicalOut(connectionType, totalSize);
+    }
+    return status;
+} catch (const DBException& ex) {
+    return ex.toStatus();
+}
+
 Future<void> CommonAsioSession::asyncSinkMessage(Message message, const BatonHandle& baton) try {
     ensureAsync();
     return sinkMessageImpl(std::move(message), baton);
@@ -509,6 +589,17 @@ ExecutorFuture<void> CommonAsioSession::parseProxyProtocolHeader(const ReactorHa
 Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
     static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
 
+    bool coalesce = gCoalescedIngressReads && _isIngressSession;
+#ifdef MONGO_CONFIG_SSL
+    // The first read on an ingress session must be limited to the message header so that
+    // maybeHandshakeSSLForIngress() can inspect it and optionally hand the connection over to the
+    // TLS engine, so coalescing only begins with the second message.
+    coalesce = coalesce && _ranHandshake;
+#endif
+    if (coalesce) {
+        return sourceMessageCoalesced(baton);
+    }
+
     auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
     auto ptr = headerBuffer.get();
     _asyncOpState.start();
@@ -557,6 +648,87 @@ Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
         });
 }
 
+Future<Message> CommonAsioSession::sourceMessageCoalesced(const BatonHandle& baton) {
+    static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
+
+    _asyncOpState.start();
+    return ensureBuffered(kHeaderSize, baton)
+        .then([this, baton] {
+            const auto* header = _coalescedReadBuffer.get() + _coalescedReadBegin;
+            if (checkForHTTPRequest(asio::buffer(header, kHeaderSize))) {
+                return sendHTTPResponse(baton);
+            }
+
+            const auto msgLen = size_t(MSGHEADER::ConstView(header).getMessageLength());
+            if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
+                StringBuilder sb;
+                sb << "recv(): message msgLen " << msgLen << " is invalid. "
+                   << "Min " << kHeaderSize << " Max: " << MaxMessageSizeBytes;
+                const auto str = sb.str();
+                LOGV2(9876502,
+                      "recv(): message mstLen is invalid.",
+                      "msgLen"_attr = msgLen,
+                      "min"_attr = kHeaderSize,
+                      "max"_attr = MaxMessageSizeBytes);
+
+                return Future<Message>::makeReady(Status(ErrorCodes::ProtocolError, str));
+            }
+
+            auto buffer = SharedBuffer::allocate(msgLen);
+            const auto buffered = std::min(msgLen, bufferedBytes());
+            memcpy(buffer.get(), header, buffered);
+            _coalescedReadBegin += buffered;
+            if (_coalescedReadBegin == _coalescedReadEnd) {
+                _coalescedReadBegin = _coalescedReadEnd = 0;
+            }
+
+            if (buffered == msgLen) {
+                networkCounter.hitPhysicalIn(NetworkCounter::ConnectionType::kIngress, msgLen);
+                return Future<Message>::makeReady(Message(std::move(buffer)));
+            }
+
+            // The tail of the message has not been received yet; read it directly into the
+            // message buffer rather than through the coalescing buffer.
+            return read(asio::buffer(buffer.get() + buffered, msgLen - buffered), baton)
+                .then([buffer = std::move(buffer), msgLen]() mutable {
+                    networkCounter.hitPhysicalIn(NetworkCounter::ConnectionType::kIngress, msgLen);
+                    return Message(std::move(buffer));
+                });
+        })
+        .onCompletion([this](StatusWith<Message> swMessage) {
+            _asyncOpState.complete();
+            return swMessage;
+        });
+}
+
+Future<void> CommonAsioSession::ensureBuffered(size_t needed, const BatonHandle& baton) {
+    invariant(needed <= kCoalescedReadBufferSize);
+    if (!_coalescedReadBuffer) {
+        _coalescedReadBuffer = SharedBuffer::allocate(kCoalescedReadBufferSize);
+    }
+    if (bufferedBytes() >= needed) {
+        return Future<void>::makeReady();
+    }
+
+    // Compact the unconsumed bytes to the front of the buffer so that the free space is
+    // contiguous.
+    if (_coalescedReadBegin > 0) {
+        memmove(_coalescedReadBuffer.get(),
+                _coalescedReadBuffer.get() + _coalescedReadBegin,
+                bufferedBytes());
+        _coalescedReadEnd -= _coalescedReadBegin;
+        _coalescedReadBegin = 0;
+    }
+
+    return readSome(asio::buffer(_coalescedReadBuffer.get() + _coalescedReadEnd,
+                                 kCoalescedReadBufferSize - _coalescedReadEnd),
+                    baton)
+        .then([this, needed, baton](size_t bytesRead) {
+            _coalescedReadEnd += bytesRead;
+            return ensureBuffered(needed, baton);
+        });
+}
+
 template <typename MutableBufferSequence>
 Future<void> CommonAsioSession::read(const MutableBufferSequence& buffers,
                                      const BatonHandle& baton) {
@@ -583,6 +755,17 @@ Future<void> CommonAsioSession::read(const MutableBufferSequence& buffers,
     return opportunisticRead(_socket, buffers, baton);
 }
 
+template <typename MutableBufferSequence>
+Future<size_t> CommonAsioSession::readSome(const MutableBufferSequence& buffers,
+                                           const BatonHandle& baton) {
+#ifdef MONGO_CONFIG_SSL
+    if (_sslSocket) {
+        return opportunisticReadSome(*_sslSocket, buffers, baton);
+    }
+#endif
+    return opportunisticReadSome(_socket, buffers, baton);
+}
+
 template <typename ConstBufferSequence>
 Future<void> CommonAsioSession::write(const ConstBufferSequence& buffers,
                                       const BatonHandle& baton) {
@@ -671,6 +854,44 @@ Future<void> CommonAsioSession::opportunisticRead(Stream& stream,
     }
 }
 
+template <typename Stream, typename MutableBufferSequence>
+Future<size_t> CommonAsioSession::opportunisticReadSome(Stream& stream,
+                                                        const MutableBufferSequence& buffers,
+                                                        const BatonHandle& baton) {
+    std::error_code ec;
+    const size_t size = readSomeFromStream(stream, buffers, ec);
+
+    if (((ec == asio::error::would_block) || (ec == asio::error::try_again)) &&
+        (_blockingMode == async)) {
+        // A single read either transfers at least one byte or fails, so unlike opportunisticRead
+        // there is no partial transfer to account for before going asynchronous.
+        stdx::lock_guard lk(_asyncOpMutex);
+        if (_asyncOpState.isCanceled())
+            return Future<size_t>::makeReady(makeCanceledStatus());
+        if (auto networkingBaton = baton ? baton->networking() : nullptr;
+            networkingBaton && networkingBaton->canWait()) {
+            return networkingBaton->addSession(*this, NetworkingBaton::Type::In)
+                .onError([](Status error) {
+                    if (ErrorCodes::isShutdownError(error)) {
+                        // If the baton has detached, it will cancel its polling. We catch that
+                        // error here and return Status::OK so that we invoke
+                        // opportunisticReadSome() again and switch to async_read_some() below.
+                        return Status::OK();
+                    }
+
+                    return error;
+                })
+                .then([&stream, buffers, baton, this] {
+                    return opportunisticReadSome(stream, buffers, baton);
+                });
+        }
+
+        return stream.async_read_some(buffers, UseFuture{});
+    }
+
+    return futurize(ec, size);
+}
+
 template <typename Stream, typename ConstBufferSequence>
 Future<void> CommonAsioSession::opportunisticWrite(Stream& stream,
                                                    const ConstBufferSequence& buffers,
@@ -36,6 +36,7 @@
 #include "mongo/transport/asio/asio_session.h"
 #include "mongo/transport/asio/asio_transport_layer.h"
 #include "mongo/transport/baton.h"
+#include "mongo/util/shared_buffer.h"
 
 #ifdef MONGO_CONFIG_SSL
 #include "mongo/util/net/ssl.hpp"
@@ -117,6 +118,8 @@ public:
 
     Status sinkMessage(Message message) override;
 
+    Status sinkMessages(std::vector<Message> messages) override;
+
     Future<void> asyncSinkMessage(Message message, const BatonHandle& baton = nullptr) override;
 
     void cancelAsyncOperations(const BatonHandle& baton = nullptr) override;
@@ -205,9 +208,38 @@ protected:
     Future<Message> sourceMessageImpl(const BatonHandle& baton = nullptr);
     Future<void> sinkMessageImpl(Message message, const BatonHandle& baton = nullptr);
 
+    /**
+     * Sources a message through '_coalescedReadBuffer', so that the header and body of a small
+     * message are usually obtained with a single syscall, and a message that was fully received
+     * along with its predecessor requires none. Used only when coalescedIngressReads is enabled.
+     */
+    Future<Message> sourceMessageCoalesced(const BatonHandle& baton);
+
+    /**
+     * Completes once at least 'needed' unconsumed bytes are available in '_coalescedReadBuffer',
+     * reading whatever the socket has to offer each pass. 'needed' must not exceed the buffer
+     * size.
+     */
+    Future<void> ensureBuffered(size_t needed, const BatonHandle& baton);
+
+    /**
+     * Returns the number of received-but-unconsumed bytes in '_coalescedReadBuffer'.
+     */
+    size_t bufferedBytes() const {
+        return _coalescedReadEnd - _coalescedReadBegin;
+    }
+
     template <typename MutableBufferSequence>
     Future<void> read(const MutableBufferSequence& buffers, const BatonHandle& baton = nullptr);
 
+    /**
+     * Like read(), but completes after a single successful transfer of at least one byte rather
+     * than once the buffer sequence is full, and yields the number of bytes transferred.
+     */
+    template <typename MutableBufferSequence>
+    Future<size_t> readSome(const MutableBufferSequence& buffers,
+                            const BatonHandle& baton = nullptr);
+
     template <typename ConstBufferSequence>
     Future<void> write(const ConstBufferSequence& buffers, const BatonHandle& baton = nullptr);
 
@@ -216,6 +248,11 @@ protected:
                                    const MutableBufferSequence& buffers,
                                    const BatonHandle& baton = nullptr);
 
+    template <typename Stream, typename MutableBufferSequence>
+    Future<size_t> opportunisticReadSome(Stream& stream,
+                                         const MutableBufferSequence& buffers,
+                                         const BatonHandle& baton = nullptr);
+
     /**
      * moreToSend checks the ssl socket after an opportunisticWrite.  If there are still bytes to
      * send, we manually send them off the underlying socket.  Then we hook that up with a future
@@ -290,6 +327,15 @@ protected:
     boost::optional<Milliseconds> _configuredTimeout;
     boost::optional<Milliseconds> _socketTimeout;
 
+    // Receive buffer used when coalescedIngressReads is enabled, allocated on first use. The
+    // bytes in the range ['_coalescedReadBegin', '_coalescedReadEnd') have been received from the
+    // socket but not yet consumed by sourceMessage; they may span a message boundary when the
+    // peer pipelines requests.
+    static constexpr size_t kCoalescedReadBufferSize = 4 * 1024;
+    SharedBuffer _coalescedReadBuffer;
+    size_t _coalescedReadBegin = 0;
+    size_t _coalescedReadEnd = 0;
+
     GenericSocket _socket;
 #ifdef MONGO_CONFIG_SSL
     boost::optional<asio::ssl::stream<decltype(_socket)>> _sslSocket;
@@ -32,6 +32,7 @@
 #include <exception>
 #include <fstream>
 #include <queue>
+#include <string>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -191,6 +192,12 @@ public:
         return ec;
     }
 
+    std::error_code read(char* buf, size_t bufSize) {
+        std::error_code ec;
+        asio::read(_sock, asio::buffer(buf, bufSize), ec);
+        return ec;
+    }
+
 private:
     asio::io_context _ctx{};
     asio::ip::tcp::socket _sock{_ctx};
@@ -457,6 +464,87 @@ TEST(AsioTransportLayer, SourceSyncTimeoutSucceeds) {
     ASSERT_OK(received.get().getStatus());
 }
 
+/* check that messages arriving back-to-back are sourced intact with coalesced reads enabled */
+TEST(AsioTransportLayer, SourceCoalescedPipelinedMessages) {
+    RAIIServerParameterControllerForTest coalescedReads{"coalescedIngressReads", true};
+
+    Message req = []() {
+        auto omb = OpMsgBuilder{};
+        omb.setBody(BSON("ping" << 1));
+        Message msg = omb.finish();
+        msg.header().setResponseToMsgId(0);
+        msg.header().setId(0);
+        OpMsg::appendChecksum(&msg);
+        return msg;
+    }();
+
+    constexpr size_t kNumMessages = 3;
+
+    TestFixture tf;
+    Notification<std::vector<StatusWith<Message>>> received;
+    tf.sessionManager().setOnStartSession([&](test::SessionThread& st) {
+        st.schedule([&](auto& session) {
+            std::vector<StatusWith<Message>> messages;
+            for (size_t i = 0; i < kNumMessages; ++i) {
+                messages.push_back(session.sourceMessage());
+            }
+            received.set(std::move(messages));
+        });
+    });
+
+    SyncClient conn(tf.tla().listenerPort());
+
+    // Send several identical messages in one write so that the session's reads cross message
+    // boundaries and the later messages are sourced from the coalescing buffer.
+    std::string pipelined;
+    for (size_t i = 0; i < kNumMessages; ++i) {
+        pipelined.append(req.buf(), req.size());
+    }
+    auto ec = conn.write(pipelined.data(), pipelined.size());
+    ASSERT_FALSE(ec) << errorMessage(ec);
+
+    for (auto&& swMsg : received.get()) {
+        ASSERT_OK(swMsg.getStatus());
+        ASSERT_EQ(swMsg.getValue().size(), req.size());
+    }
+}
+
+/* check that a batch of messages sinked together arrives intact and in order */
+TEST(AsioTransportLayer, SinkMessagesBatch) {
+    Message reply = []() {
+        auto omb = OpMsgBuilder{};
+        omb.setBody(BSON("ok" << 1));
+        Message msg = omb.finish();
+        msg.header().setResponseToMsgId(0);
+        msg.header().setId(0);
+        OpMsg::appendChecksum(&msg);
+        return msg;
+    }();
+
+    constexpr size_t kNumMessages = 3;
+
+    TestFixture tf;
+    Notification<Status> sinkResult;
+    tf.sessionManager().setOnStartSession([&](test::SessionThread& st) {
+        st.schedule([&](auto& session) {
+            std::vector<Message> replies(kNumMessages, reply);
+            sinkResult.set(session.sinkMessages(std::move(replies)));
+        });
+    });
+
+    SyncClient conn(tf.tla().listenerPort());
+    ASSERT_OK(sinkResult.get());
+
+    std::string expected;
+    for (size_t i = 0; i < kNumMessages; ++i) {
+        expected.append(reply.buf(), reply.size());
+    }
+    std::string actual(expected.size(), '\0');
+    auto ec = conn.read(actual.data(), actual.size());
+    ASSERT_FALSE(ec) << errorMessage(ec);
+    ASSERT_EQ(actual, expected);
+}
+
 TEST(AsioTransportLayer, IngressPhysicalNetworkMetricsTest) {
     Message req = []() {
         auto omb = OpMsgBuilder{};
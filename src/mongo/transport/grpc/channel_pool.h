@@ -141,19 +141,28 @@ public:
      *   channel should be used to create new stubs.
      * - `channelFactory` is the factory for creating new channels.
      * - `stubFactory` is the factory for creating new stubs.
+     * - `maxChannelsPerTarget` is the number of channels to maintain per remote (and SSL mode).
+     *   Stubs are spread across these channels round-robin, so streams for unrelated operations
+     *   are multiplexed over more than one connection.
      */
     explicit ChannelPool(ClockSource* clockSource,
                          SSLModeResolver sslModeResolver,
                          ChannelFactory channelFactory,
-                         StubFactory stubFactory)
+                         StubFactory stubFactory,
+                         size_t maxChannelsPerTarget = 1)
         : _clockSource(clockSource),
           _sslModeResolver(std::move(sslModeResolver)),
           _channelFactory(std::move(channelFactory)),
-          _stubFactory(std::move(stubFactory)) {}
+          _stubFactory(std::move(stubFactory)),
+          _maxChannelsPerTarget(maxChannelsPerTarget) {
+        invariant(_maxChannelsPerTarget >= 1);
+    }
 
     /**
      * Creates a new stub to `remote` that uses `sslMode`. Internally, an existing channel is used
-     * to create the new stub, if available. Otherwise, a new channel is created.
+     * to create the new stub, if available. Otherwise, a new channel is created. Until the target
+     * has `maxChannelsPerTarget` channels, each call creates a new channel; after that, calls
+     * rotate through the existing ones.
      */
     std::unique_ptr<StubHandle> createStub(HostAndPort remote,
                                            ConnectSSLMode sslMode,
@@ -162,13 +171,16 @@ public:
             const auto useSSL = _sslModeResolver(sslMode);
             ChannelMapKeyType key{remote, useSSL};
             auto lk = stdx::unique_lock(_mutex);
-            if (auto iter = _channels.find(key); iter != _channels.end()) {
-                return iter->second;
+            auto& target = _channels[key];
+            if (target.channels.size() >= _maxChannelsPerTarget) {
+                auto state = target.channels[target.nextIdx];
+                target.nextIdx = (target.nextIdx + 1) % target.channels.size();
+                return state;
             } else {
                 auto pf = makePromiseFuture<Channel>();
                 auto state = std::make_shared<ChannelState>(
                     this->shared_from_this(), remote, useSSL, std::move(pf.future));
-                _channels.insert({key, state});
+                target.channels.push_back(state);
                 _channelsSize.increment();
                 lk.unlock();
                 if (!serverGlobalParams.quiet.load()) {
@@ -245,14 +257,24 @@ private:
         std::vector<std::shared_ptr<ChannelState>> droppedChannels;
         auto lk = stdx::lock_guard(_mutex);
         for (auto iter = _channels.begin(); iter != _channels.end();) {
-            auto prev = iter++;
-            const auto& cs = prev->second;
-            if (shouldKeep(cs))
-                continue;
-            invariant(cs.use_count() == 1, "Attempted to drop a channel with existing stubs");
-            droppedChannels.push_back(std::move(prev->second));
-            _channels.erase(prev);
-            _channelsSize.decrement();
+            auto& target = iter->second;
+            for (auto csIter = target.channels.begin(); csIter != target.channels.end();) {
+                auto& cs = *csIter;
+                if (shouldKeep(cs)) {
+                    ++csIter;
+                    continue;
+                }
+                invariant(cs.use_count() == 1, "Attempted to drop a channel with existing stubs");
+                droppedChannels.push_back(std::move(cs));
+                csIter = target.channels.erase(csIter);
+                _channelsSize.decrement();
+            }
+            target.nextIdx = 0;
+            if (target.channels.empty()) {
+                iter = _channels.erase(iter);
+            } else {
+                ++iter;
+            }
         }
         return droppedChannels;
     }
@@ -261,11 +283,21 @@ private:
     SSLModeResolver _sslModeResolver;
     ChannelFactory _channelFactory;
     StubFactory _stubFactory;
+    const size_t _maxChannelsPerTarget;
 
     mutable stdx::mutex _mutex;
 
+    /**
+     * The channels established to a single remote (and SSL mode), together with the round-robin
+     * cursor used to spread new stubs across them.
+     */
+    struct TargetChannels {
+        std::vector<std::shared_ptr<ChannelState>> channels;
+        size_t nextIdx = 0;
+    };
+
     using ChannelMapKeyType = std::pair<HostAndPort, bool>;
-    stdx::unordered_map<ChannelMapKeyType, std::shared_ptr<ChannelState>> _channels;
+    stdx::unordered_map<ChannelMapKeyType, TargetChannels> _channels;
     Counter64 _channelsSize;
 };
 
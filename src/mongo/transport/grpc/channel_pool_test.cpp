@@ -83,6 +83,15 @@ public:
         return *_pool;
     }
 
+    void setMaxChannelsPerTarget(size_t maxChannelsPerTarget) {
+        _pool = std::make_shared<PoolType>(
+            _clockSource.get(),
+            [this](ConnectSSLMode mode) { return _resolveSSLMode(mode); },
+            [this](const HostAndPort& remote, bool useSSL) { return _makeChannel(remote, useSSL); },
+            [this](DummyChannel& channel, Milliseconds) { return _makeStub(channel); },
+            maxChannelsPerTarget);
+    }
+
 private:
     bool _resolveSSLMode(ConnectSSLMode mode) {
         auto sslMode = _sslMode.load();
@@ -129,6 +138,34 @@ TEST_F(ChannelPoolTest, ConsidersSSLMode) {
     ASSERT_EQ(pool().size(), 2);
 }
 
+TEST_F(ChannelPoolTest, RotatesAcrossChannelsPerTarget) {
+    setMaxChannelsPerTarget(2);
+    HostAndPort remote("FakeHost", 123);
+    auto s1 = pool().createStub(remote, ConnectSSLMode::kDisableSSL, kNoTimeout);
+    ASSERT_EQ(pool().size(), 1);
+    auto s2 = pool().createStub(remote, ConnectSSLMode::kDisableSSL, kNoTimeout);
+    ASSERT_EQ(pool().size(), 2);
+    // The target is fully populated now, so further stubs rotate through existing channels.
+    auto s3 = pool().createStub(remote, ConnectSSLMode::kDisableSSL, kNoTimeout);
+    auto s4 = pool().createStub(remote, ConnectSSLMode::kDisableSSL, kNoTimeout);
+    ASSERT_EQ(pool().size(), 2);
+}
+
+TEST_F(ChannelPoolTest, DropsIdleChannelsOfTargetIndividually) {
+    setMaxChannelsPerTarget(2);
+    HostAndPort remote("FakeHost", 123);
+    auto s1 = pool().createStub(remote, ConnectSSLMode::kDisableSSL, kNoTimeout);
+    {
+        // Create a new stub and immediately discard it. This creates the target's second
+        // channel, which then sits idle.
+        pool().createStub(remote, ConnectSSLMode::kDisableSSL, kNoTimeout);
+    }
+    ASSERT_EQ(pool().size(), 2);
+    clockSource().advance(Minutes{5});
+    ASSERT_EQ(pool().dropIdleChannels(Minutes{5}), 1);
+    ASSERT_EQ(pool().size(), 1);
+}
+
 TEST_F(ChannelPoolTest, DropUnusedChannel) {
     {
         // Create a new stub and immediately discard it. This should internally create a new
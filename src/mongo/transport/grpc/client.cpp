@@ -49,6 +49,7 @@
 #include "mongo/transport/grpc/channel_pool.h"
 #include "mongo/transport/grpc/client_stream.h"
 #include "mongo/transport/grpc/grpc_client_context.h"
+#include "mongo/transport/grpc/grpc_parameters_gen.h"
 #include "mongo/transport/grpc/grpc_client_stream.h"
 #include "mongo/transport/grpc/grpc_session.h"
 #include "mongo/transport/grpc/util.h"
@@ -445,7 +446,8 @@ public:
             },
             [](std::shared_ptr<Channel>& channel, Milliseconds connectTimeout) {
                 return Stub(channel);
-            });
+            },
+            static_cast<size_t>(gGRPCEgressChannelsPerTarget));
     }
 
     void start() {
@@ -60,6 +60,17 @@
 namespace mongo {
 namespace {
 
+// Parameters for adaptive compression. Compression ratios are sampled over windows of
+// kAdaptiveSampleMessages compressed messages spanning at least kAdaptiveMinSampleBytes of
+// uncompressed data. If a window compresses to more than kAdaptiveIncompressibleRatio of its
+// original size, compression is skipped for the next kAdaptiveSkipMessages outgoing messages
+// before sampling resumes. The thresholds are conservative so that compressible workloads are
+// unaffected.
+constexpr std::uint32_t kAdaptiveSampleMessages = 32;
+constexpr std::uint64_t kAdaptiveMinSampleBytes = 64 * 1024;
+constexpr std::uint32_t kAdaptiveSkipMessages = 256;
+constexpr double kAdaptiveIncompressibleRatio = 0.95;
+
 // TODO(JBR): This should be changed so it 's closer to the MSGHEADER View/ConstView classes
 // than this little struct.
 struct CompressionHeader {
@@ -110,6 +121,14 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
         return {msg};
     }
 
+    // If this connection's recent traffic has proven incompressible, skip compression for a
+    // while before sampling again. Sending an uncompressed message is always legal, even when
+    // compression has been negotiated.
+    if (_adaptiveSkipRemaining > 0) {
+        --_adaptiveSkipRemaining;
+        return {msg};
+    }
+
     LOGV2_DEBUG(22925, 3, "Compressing message", "compressor"_attr = compressor->getName());
 
     auto inputHeader = msg.header();
@@ -148,9 +167,36 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
     auto realCompressedSize = sws.getValue();
     outMessage.setLen(realCompressedSize + CompressionHeader::size() + MsgData::MsgDataHeaderSize);
 
+    _recordCompressionResult(static_cast<size_t>(inputHeader.dataLen()), realCompressedSize);
+
     return {Message(outputMessageBuffer)};
 }
 
+void MessageCompressorManager::_recordCompressionResult(std::size_t uncompressedSize,
+                                                        std::size_t compressedSize) {
+    _sampledUncompressedBytes += uncompressedSize;
+    _sampledCompressedBytes += compressedSize;
+    if (++_sampledMessages < kAdaptiveSampleMessages ||
+        _sampledUncompressedBytes < kAdaptiveMinSampleBytes) {
+        return;
+    }
+
+    if (static_cast<double>(_sampledCompressedBytes) >
+        static_cast<double>(_sampledUncompressedBytes) * kAdaptiveIncompressibleRatio) {
+        LOGV2_DEBUG(9876506,
+                    2,
+                    "Recent messages are incompressible, pausing outgoing message compression",
+                    "sampledUncompressedBytes"_attr = _sampledUncompressedBytes,
+                    "sampledCompressedBytes"_attr = _sampledCompressedBytes,
+                    "skipMessages"_attr = kAdaptiveSkipMessages);
+        _adaptiveSkipRemaining = kAdaptiveSkipMessages;
+    }
+
+    _sampledUncompressedBytes = 0;
+    _sampledCompressedBytes = 0;
+    _sampledMessages = 0;
+}
+
 StatusWith<Message> MessageCompressorManager::decompressMessage(const Message& msg,
                                                                 MessageCompressorId* compressorId) {
     auto inputHeader = msg.header();
@@ -30,6 +30,8 @@
 #pragma once
 
 #include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -103,6 +105,11 @@ public:
      * If _negotiated is empty (meaning compression was not negotiated or is not supported), then
      * it will return a ref-count bumped copy of the input message.
      *
+     * The achieved compression ratio is sampled per connection; when recent traffic has proven
+     * incompressible (e.g. already-compressed or encrypted payloads), subsequent messages are
+     * temporarily returned uncompressed before sampling resumes. Sending an uncompressed
+     * message is always legal, even when compression has been negotiated.
+     *
      * If an error occurs in the compressor, it will return a Status error.
      */
     StatusWith<Message> compressMessage(const Message& msg,
@@ -133,8 +140,21 @@ public:
     static MessageCompressorManager& forSession(const std::shared_ptr<transport::Session>& session);
 
 private:
+    /*
+     * Accumulates the compression result of one outgoing message into the current sampling
+     * window, and pauses outgoing compression when the window shows the connection's traffic
+     * to be incompressible. See compressMessage.
+     */
+    void _recordCompressionResult(std::size_t uncompressedSize, std::size_t compressedSize);
+
     std::vector<MessageCompressorBase*> _negotiated;
     MessageCompressorRegistry* _registry;
+
+    // Adaptive compression sampling state; see compressMessage.
+    std::uint64_t _sampledUncompressedBytes = 0;
+    std::uint64_t _sampledCompressedBytes = 0;
+    std::uint32_t _sampledMessages = 0;
+    std::uint32_t _adaptiveSkipRemaining = 0;
 };
 
 }  // namespace mongo
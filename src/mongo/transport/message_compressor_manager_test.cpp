@@ -50,6 +50,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
+#include "mongo/platform/random.h"
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/message_compressor_noop.h"
@@ -189,6 +190,18 @@ void checkOverflow(std::unique_ptr<MessageCompressorBase> compressor) {
         compressor->decompressData(tooSmallRange, DataRange(scratch.data(), scratch.size())));
 }
 
+Message buildMessageWithData(StringData data) {
+    const auto bufferSize = MsgData::MsgDataHeaderSize + data.size();
+    auto buf = SharedBuffer::allocate(bufferSize);
+    MsgData::View testView(buf.get());
+    testView.setId(123456);
+    testView.setResponseToMsgId(654321);
+    testView.setOperation(dbQuery);
+    testView.setLen(bufferSize);
+    memcpy(testView.data(), data.rawData(), data.size());
+    return Message{buf};
+}
+
 Message buildMessage() {
     const auto data = std::string{"Hello, world!"};
     const auto bufferSize = MsgData::MsgDataHeaderSize + data.size();
@@ -424,6 +437,57 @@ TEST(MessageCompressorManager, MessageSizeTooSmall) {
     ASSERT_NOT_OK(status);
 }
 
+TEST(MessageCompressorManager, AdaptivePausesCompressionForIncompressibleTraffic) {
+    MessageCompressorRegistry registry;
+    auto compressor = std::make_unique<ZstdMessageCompressor>();
+    const auto compressorName = compressor->getName();
+    registry.setSupportedCompressors({compressorName});
+    registry.registerImplementation(std::move(compressor));
+    ASSERT_OK(registry.finalizeSupportedCompressors());
+
+    MessageCompressorManager mgr(&registry);
+    BSONObjBuilder negotiatorOut;
+    std::vector<StringData> negotiator({compressorName});
+    mgr.serverNegotiate(negotiator, &negotiatorOut);
+
+    // Incompressible payload: pseudo-random bytes.
+    PseudoRandom prng(1234);
+    std::string data(8 * 1024, '\0');
+    for (auto& c : data) {
+        c = static_cast<char>(prng.nextInt32());
+    }
+
+    // Once enough incompressible messages have been sampled, the manager should start
+    // returning messages uncompressed.
+    bool sawUncompressed = false;
+    for (int i = 0; i < 64 && !sawUncompressed; i++) {
+        auto compressed = assertOk(mgr.compressMessage(buildMessageWithData(data)));
+        sawUncompressed = compressed.operation() != dbCompressed;
+    }
+    ASSERT_TRUE(sawUncompressed);
+}
+
+TEST(MessageCompressorManager, AdaptiveKeepsCompressingCompressibleTraffic) {
+    MessageCompressorRegistry registry;
+    auto compressor = std::make_unique<ZstdMessageCompressor>();
+    const auto compressorName = compressor->getName();
+    registry.setSupportedCompressors({compressorName});
+    registry.registerImplementation(std::move(compressor));
+    ASSERT_OK(registry.finalizeSupportedCompressors());
+
+    MessageCompressorManager mgr(&registry);
+    BSONObjBuilder negotiatorOut;
+    std::vector<StringData> negotiator({compressorName});
+    mgr.serverNegotiate(negotiator, &negotiatorOut);
+
+    // Highly compressible payload; every message should remain compressed.
+    std::string data(8 * 1024, 'a');
+    for (int i = 0; i < 64; i++) {
+        auto compressed = assertOk(mgr.compressMessage(buildMessageWithData(data)));
+        ASSERT_EQ(compressed.operation(), dbCompressed);
+    }
+}
+
 TEST(MessageCompressorManager, RuntMessage) {
     auto registry = buildRegistry();
     MessageCompressorManager compManager(&registry);
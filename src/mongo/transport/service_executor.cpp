@@ -41,6 +41,7 @@
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/service_executor_reserved.h"
 #include "mongo/transport/service_executor_synchronous.h"
+#include "mongo/transport/service_executor_work_stealing.h"
 #include "mongo/transport/session_manager.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/util/assert_util.h"
@@ -99,6 +100,7 @@ void forEachServiceExecutor(ServiceContext* svcCtx, const Func& func) {
     call(std::type_identity<ServiceExecutorSynchronous>{});
     call(std::type_identity<ServiceExecutorReserved>{});
     call(std::type_identity<ServiceExecutorInline>{});
+    call(std::type_identity<ServiceExecutorWorkStealing>{});
 }
 
 }  // namespace
@@ -189,6 +191,12 @@ ServiceExecutor* ServiceExecutorContext::getServiceExecutor() {
             // Once we use the ServiceExecutorSynchronous, we shouldn't use the
             // ServiceExecutorReserved.
             _hasUsedSynchronous = true;
+
+            // When the work-stealing executor is enabled, it takes over the synchronous
+            // executor's role for all non-reserved sessions.
+            if (auto exec = ServiceExecutorWorkStealing::get(_client->getServiceContext())) {
+                return exec;
+            }
             return ServiceExecutorSynchronous::get(_client->getServiceContext());
         }
     }
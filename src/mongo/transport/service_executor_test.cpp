@@ -58,6 +58,7 @@
 #include "mongo/transport/mock_session.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/service_executor_synchronous.h"
+#include "mongo/transport/service_executor_work_stealing.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/transport/transport_layer_mock.h"
 #include "mongo/unittest/assert.h"
@@ -301,5 +302,67 @@ TEST_F(ServiceExecutorInlineTest, TaskPostQueueing) {
     doTestTaskPostQueueing(&executor);
 }
 
+class ServiceExecutorWorkStealingTest : public unittest::Test {
+public:
+    ServiceExecutorWorkStealing executor{2};
+};
+
+TEST_F(ServiceExecutorWorkStealingTest, MakeTaskRunnerFailsBeforeStartup) {
+    ASSERT_THROWS(executor.makeTaskRunner(), DBException);
+}
+
+TEST_F(ServiceExecutorWorkStealingTest, BasicTaskRuns) {
+    auto callerid = stdx::this_thread::get_id();
+    auto taskid = doBasicTaskRunTest(&executor);
+    // Task runs on a pool worker, not the caller's thread.
+    ASSERT(callerid != taskid);
+}
+
+TEST_F(ServiceExecutorWorkStealingTest, TaskQueueing) {
+    doTestTaskQueueing(&executor);
+}
+
+TEST_F(ServiceExecutorWorkStealingTest, TaskPostQueueing) {
+    executor.start();
+    auto runner = executor.makeTaskRunner();
+
+    PromiseAndFuture<void> first;
+    runner->schedule([&](Status st) { first.promise.setFrom(st); });
+    ASSERT_DOES_NOT_THROW(first.future.get());
+
+    // The pool workers persist across tasks, so there is no thread count to wait
+    // down as with the synchronous executor; the runner can be reused directly.
+    PromiseAndFuture<void> second;
+    runner->schedule([&](Status st) { second.promise.setFrom(st); });
+    ASSERT_DOES_NOT_THROW(second.future.get());
+
+    ASSERT_OK(executor.shutdown(kShutdownTime));
+}
+
+TEST(ServiceExecutorWorkStealing, SpawnsSpareWorkerWhenPoolIsBlocked) {
+    ServiceExecutorWorkStealing executor{1};
+    executor.start();
+    auto blockedRunner = executor.makeTaskRunner();
+    auto runner = executor.makeTaskRunner();
+
+    Breakpoint bp;
+    PromiseAndFuture<void> blocked;
+    blockedRunner->schedule([&](Status st) {
+        bp.pause();
+        blocked.promise.setFrom(st);
+    });
+    bp.await();
+
+    // The only base worker is blocked on its breakpoint, so this task can only
+    // complete if a spare worker is spawned to pick it up.
+    PromiseAndFuture<void> pf;
+    runner->schedule([&](Status st) { pf.promise.setFrom(st); });
+    ASSERT_DOES_NOT_THROW(pf.future.get());
+
+    bp.resume();
+    ASSERT_DOES_NOT_THROW(blocked.future.get());
+    ASSERT_OK(executor.shutdown(kShutdownTime));
+}
+
 }  // namespace
 }  // namespace mongo::transport
@@ -0,0 +1,376 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/transport/service_executor_work_stealing.h"
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/transport/service_executor_utils.h"
+#include "mongo/transport/service_executor_work_stealing_gen.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/scopeguard.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kExecutor
+
+namespace mongo {
+namespace transport {
+namespace {
+
+const auto getServiceExecutorWorkStealing =
+    ServiceContext::declareDecoration<std::unique_ptr<ServiceExecutorWorkStealing>>();
+
+const auto serviceExecutorWorkStealingRegisterer = ServiceContext::ConstructorActionRegisterer{
+    "ServiceExecutorWorkStealing", [](ServiceContext* ctx) {
+        if (gWorkStealingServiceExecutorThreads <= 0) {
+            return;
+        }
+        getServiceExecutorWorkStealing(ctx) = std::make_unique<ServiceExecutorWorkStealing>(
+            static_cast<size_t>(gWorkStealingServiceExecutorThreads));
+    }};
+
+}  // namespace
+
+class ServiceExecutorWorkStealing::SharedState
+    : public std::enable_shared_from_this<SharedState> {
+public:
+    /**
+     * A strand of tasks belonging to one TaskRunner. Tasks on a strand run one at a time in
+     * scheduling order, but consecutive tasks may be drained by different workers.
+     */
+    struct Strand {
+        stdx::mutex mutex;
+        std::deque<Task> tasks;
+
+        /** True while a worker is draining this strand. */
+        bool active = false;
+
+        /** True while this strand is sitting on a worker's run queue. */
+        bool queued = false;
+    };
+
+    explicit SharedState(size_t numWorkers) : _workerQueues(numWorkers) {
+        invariant(numWorkers > 0);
+    }
+
+    void start() {
+        _isRunning.store(true);
+        stdx::lock_guard lk(_mutex);
+        for (size_t i = 0; i < _workerQueues.size(); ++i) {
+            uassertStatusOK(_startThread(lk, i));
+        }
+    }
+
+    Status shutdown(Milliseconds timeout) {
+        LOGV2_DEBUG(9876504, 3, "Shutting down work-stealing executor");
+
+        stdx::unique_lock lk(_mutex);
+        _isRunning.store(false);
+        _wakeupCV.notify_all();
+
+        if (!_shutdownCV.wait_for(
+                lk, timeout.toSystemDuration(), [this] { return _numThreads == 0; })) {
+            return Status(ErrorCodes::ExceededTimeLimit,
+                          "work-stealing executor couldn't shutdown "
+                          "all worker threads within time limit.");
+        }
+
+        return Status::OK();
+    }
+
+    bool isRunning() const {
+        return _isRunning.loadRelaxed();
+    }
+
+    size_t threads() const {
+        stdx::lock_guard lk(_mutex);
+        return _numThreads;
+    }
+
+    void appendStats(BSONObjBuilder* bob) const {
+        size_t threads;
+        size_t idle;
+        {
+            stdx::lock_guard lk(_mutex);
+            threads = _numThreads;
+            idle = _numIdleThreads;
+        }
+        BSONObjBuilder{bob->subobjStart("workStealing")}
+            .append("threadsRunning", static_cast<int>(threads))
+            .append("threadsIdle", static_cast<int>(idle))
+            .append("strandsQueued", static_cast<int>(_numQueuedStrands.load()));
+    }
+
+    void schedule(const std::shared_ptr<Strand>& strand, Task task);
+
+private:
+    struct WorkerQueue {
+        stdx::mutex mutex;
+        std::deque<std::shared_ptr<Strand>> strands;
+    };
+
+    Status _startThread(WithLock, boost::optional<size_t> home);
+    void _workerLoop(boost::optional<size_t> home);
+    void _enqueueStrand(std::shared_ptr<Strand> strand);
+    std::shared_ptr<Strand> _nextStrand(boost::optional<size_t> home);
+    void _drainStrand(const std::shared_ptr<Strand>& strand);
+
+    /**
+     * Set while a base worker of this executor is running, so that tasks it schedules are
+     * queued with that worker. Spare workers and external threads leave these unset and
+     * round-robin across the queues instead.
+     */
+    static thread_local SharedState* _currentWorkerState;
+    static thread_local size_t _currentWorkerQueue;
+
+    AtomicWord<bool> _isRunning{false};
+    AtomicWord<size_t> _numQueuedStrands{0};
+    AtomicWord<size_t> _nextQueue{0};
+
+    std::vector<WorkerQueue> _workerQueues;
+
+    mutable stdx::mutex _mutex;
+    stdx::condition_variable _wakeupCV;
+    stdx::condition_variable _shutdownCV;
+    size_t _numThreads = 0;
+    size_t _numIdleThreads = 0;
+};
+
+thread_local ServiceExecutorWorkStealing::SharedState*
+    ServiceExecutorWorkStealing::SharedState::_currentWorkerState = nullptr;
+thread_local size_t ServiceExecutorWorkStealing::SharedState::_currentWorkerQueue = 0;
+
+void ServiceExecutorWorkStealing::SharedState::schedule(const std::shared_ptr<Strand>& strand,
+                                                        Task task) {
+    if (!isRunning()) {
+        task(Status(ErrorCodes::ShutdownInProgress, "Executor is not running"));
+        return;
+    }
+
+    bool mustQueue = false;
+    {
+        stdx::lock_guard lk(strand->mutex);
+        strand->tasks.push_back(std::move(task));
+        if (!strand->active && !strand->queued) {
+            strand->queued = true;
+            mustQueue = true;
+        }
+    }
+
+    // If the strand is already queued or being drained, its new task will be picked up by
+    // whichever worker ends up draining it.
+    if (mustQueue) {
+        _enqueueStrand(strand);
+    }
+}
+
+void ServiceExecutorWorkStealing::SharedState::_enqueueStrand(std::shared_ptr<Strand> strand) {
+    const size_t queueIdx = (_currentWorkerState == this)
+        ? _currentWorkerQueue
+        : _nextQueue.fetchAndAdd(1) % _workerQueues.size();
+    {
+        auto& queue = _workerQueues[queueIdx];
+        stdx::lock_guard lk(queue.mutex);
+        queue.strands.push_back(std::move(strand));
+    }
+    _numQueuedStrands.fetchAndAdd(1);
+
+    stdx::lock_guard lk(_mutex);
+    if (_numIdleThreads > 0) {
+        _wakeupCV.notify_one();
+        return;
+    }
+
+    // Every worker is occupied, typically blocked in a long-running task or waiting on
+    // session data. Spawn a spare worker to pick up the queued work; it exits as soon as it
+    // finds the queues empty.
+    if (auto status = _startThread(lk, boost::none); !status.isOK()) {
+        LOGV2_WARNING(9876505,
+                      "Work-stealing executor failed to spawn spare worker thread",
+                      "error"_attr = status);
+    }
+}
+
+Status ServiceExecutorWorkStealing::SharedState::_startThread(WithLock,
+                                                              boost::optional<size_t> home) {
+    auto status =
+        launchServiceWorkerThread([self = shared_from_this(), home] { self->_workerLoop(home); });
+    if (status.isOK()) {
+        ++_numThreads;
+    }
+    return status;
+}
+
+void ServiceExecutorWorkStealing::SharedState::_workerLoop(boost::optional<size_t> home) {
+    if (home) {
+        _currentWorkerState = this;
+        _currentWorkerQueue = *home;
+    }
+
+    ScopeGuard onExit([&] {
+        _currentWorkerState = nullptr;
+        stdx::lock_guard lk(_mutex);
+        --_numThreads;
+        _shutdownCV.notify_one();
+    });
+
+    while (isRunning()) {
+        if (auto strand = _nextStrand(home)) {
+            _drainStrand(strand);
+            continue;
+        }
+
+        if (!home) {
+            // Spare workers exit once the queues are empty.
+            return;
+        }
+
+        stdx::unique_lock lk(_mutex);
+        if (_numQueuedStrands.load() > 0) {
+            // A strand was queued between our last scan and taking the lock; rescan rather
+            // than risk sleeping through its wakeup.
+            continue;
+        }
+        ++_numIdleThreads;
+        _wakeupCV.wait(lk, [this] { return !isRunning() || _numQueuedStrands.load() > 0; });
+        --_numIdleThreads;
+    }
+}
+
+auto ServiceExecutorWorkStealing::SharedState::_nextStrand(boost::optional<size_t> home)
+    -> std::shared_ptr<Strand> {
+    const size_t nQueues = _workerQueues.size();
+    const size_t first = home.value_or(_nextQueue.loadRelaxed() % nQueues);
+    for (size_t i = 0; i < nQueues; ++i) {
+        auto& queue = _workerQueues[(first + i) % nQueues];
+        stdx::lock_guard lk(queue.mutex);
+        if (queue.strands.empty()) {
+            continue;
+        }
+        std::shared_ptr<Strand> strand;
+        if (i == 0 && home) {
+            // Drain our own queue front-to-back so strands queued with us run in order.
+            strand = std::move(queue.strands.front());
+            queue.strands.pop_front();
+        } else {
+            // Steal from the back of a peer's queue to stay off its cache-hot end.
+            strand = std::move(queue.strands.back());
+            queue.strands.pop_back();
+        }
+        _numQueuedStrands.fetchAndSubtract(1);
+        return strand;
+    }
+    return nullptr;
+}
+
+void ServiceExecutorWorkStealing::SharedState::_drainStrand(
+    const std::shared_ptr<Strand>& strand) {
+    stdx::unique_lock lk(strand->mutex);
+    strand->queued = false;
+    strand->active = true;
+    while (!strand->tasks.empty() && isRunning()) {
+        auto task = std::move(strand->tasks.front());
+        strand->tasks.pop_front();
+        lk.unlock();
+        task(Status::OK());
+        lk.lock();
+    }
+    strand->active = false;
+}
+
+ServiceExecutorWorkStealing::ServiceExecutorWorkStealing(size_t numWorkers)
+    : _sharedState{std::make_shared<SharedState>(numWorkers)} {}
+
+ServiceExecutorWorkStealing::~ServiceExecutorWorkStealing() = default;
+
+ServiceExecutorWorkStealing* ServiceExecutorWorkStealing::get(ServiceContext* ctx) {
+    return getServiceExecutorWorkStealing(ctx).get();
+}
+
+void ServiceExecutorWorkStealing::start() {
+    _sharedState->start();
+}
+
+Status ServiceExecutorWorkStealing::shutdown(Milliseconds timeout) {
+    return _sharedState->shutdown(timeout);
+}
+
+size_t ServiceExecutorWorkStealing::getRunningThreads() const {
+    return _sharedState->threads();
+}
+
+void ServiceExecutorWorkStealing::appendStats(BSONObjBuilder* bob) const {
+    _sharedState->appendStats(bob);
+}
+
+auto ServiceExecutorWorkStealing::makeTaskRunner() -> std::unique_ptr<TaskRunner> {
+    iassert(ErrorCodes::ShutdownInProgress, "Executor is not running", _sharedState->isRunning());
+
+    class ForwardingTaskRunner : public TaskRunner {
+    public:
+        explicit ForwardingTaskRunner(std::shared_ptr<SharedState> state)
+            : _state{std::move(state)}, _strand{std::make_shared<SharedState::Strand>()} {}
+
+        void schedule(Task task) override {
+            _state->schedule(_strand, std::move(task));
+        }
+
+        void runOnDataAvailable(std::shared_ptr<Session> session, Task task) override {
+            invariant(session);
+            // Waiting for data occupies a worker; a session blocked here for long causes a
+            // spare worker to be spawned for any work queued in the meantime.
+            schedule([session = std::move(session), task = std::move(task)](Status status) {
+                if (!status.isOK()) {
+                    task(std::move(status));
+                    return;
+                }
+                task(session->waitForData());
+            });
+        }
+
+    private:
+        std::shared_ptr<SharedState> _state;
+        std::shared_ptr<SharedState::Strand> _strand;
+    };
+
+    return std::make_unique<ForwardingTaskRunner>(_sharedState);
+}
+
+}  // namespace transport
+}  // namespace mongo
@@ -0,0 +1,89 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "mongo/base/status.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context.h"
+#include "mongo/transport/service_executor.h"
+#include "mongo/transport/session.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+namespace transport {
+
+/**
+ * The work-stealing service executor runs session tasks on a small pool of worker threads
+ * instead of dedicating a thread to every session.
+ *
+ * Each TaskRunner forms a strand: tasks scheduled on one runner execute one at a time, in
+ * scheduling order. A strand with ready tasks is placed on one of the per-worker run queues,
+ * and workers whose own queue is empty steal queued strands from their peers, so ready work
+ * is picked up by whichever worker frees up first. When every worker is occupied, typically
+ * blocked in a long-running command or waiting on session data, a spare worker is spawned to
+ * pick up the queued work and exits once the queues drain. In the worst case this degenerates
+ * to roughly one thread per concurrently-blocked task, which is no worse than the synchronous
+ * executor, while bursts of short tasks are absorbed by the base workers.
+ *
+ * The executor is only created when workStealingServiceExecutorThreads is set to a nonzero
+ * value, in which case it takes over the role of ServiceExecutorSynchronous.
+ */
+class ServiceExecutorWorkStealing final : public ServiceExecutor {
+public:
+    explicit ServiceExecutorWorkStealing(size_t numWorkers);
+    ~ServiceExecutorWorkStealing() override;
+
+    /** Returns nullptr when the executor is not enabled. */
+    static ServiceExecutorWorkStealing* get(ServiceContext* ctx);
+
+    void start() override;
+    Status shutdown(Milliseconds timeout) override;
+
+    size_t getRunningThreads() const override;
+
+    void appendStats(BSONObjBuilder* bob) const override;
+
+    std::unique_ptr<TaskRunner> makeTaskRunner() override;
+
+    StringData getName() const override {
+        return "ServiceExecutorWorkStealing"_sd;
+    }
+
+private:
+    class SharedState;
+
+    std::shared_ptr<SharedState> _sharedState;
+};
+
+}  // namespace transport
+}  // namespace mongo
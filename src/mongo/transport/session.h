@@ -34,6 +34,7 @@
 #include <functional>
 #include <memory>
 #include <variant>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/base/status_with.h"
@@ -134,6 +135,20 @@ public:
     virtual Status sinkMessage(Message message) = 0;
     virtual Future<void> asyncSinkMessage(Message message, const BatonHandle& handle = nullptr) = 0;
 
+    /**
+     * Sink several Messages to the remote host, in order. The default implementation sends
+     * them one at a time; transports capable of vectored writes may override this to emit the
+     * whole batch with a single syscall.
+     */
+    virtual Status sinkMessages(std::vector<Message> messages) {
+        for (auto& message : messages) {
+            if (auto status = sinkMessage(std::move(message)); !status.isOK()) {
+                return status;
+            }
+        }
+        return Status::OK();
+    }
+
     /**
      * Cancel any outstanding async operations. There is no way to cancel synchronous calls.
      * Futures will finish with an ErrorCodes::CallbackCancelled error if they haven't already
@@ -29,12 +29,18 @@
 
 #include <algorithm>
 #include <array>
+#include <boost/predef/hardware/simd.h>
 #include <cstdint>
 #include <iterator>
 #include <limits>
 
 #include <fmt/format.h>
 
+#if defined(BOOST_HW_SIMD_X86_AVAILABLE) && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSSE3_VERSION
+#include <tmmintrin.h>
+#define MONGO_BASE64_SSSE3 1
+#endif
+
 #include "mongo/util/assert_util.h"
 #include "mongo/util/base64.h"
 
@@ -47,11 +53,144 @@ bool valid(unsigned char x) {
     return Mode::kDecodeTable[x] != kInvalid;
 }
 
+#ifdef MONGO_BASE64_SSSE3
+
+/**
+ * Alphabet-specific constants for the vector kernels below. Only the last two code points and the
+ * terminator policy differ between the standard and url-safe alphabets, so everything else is
+ * shared.
+ */
+template <typename Mode>
+struct SimdAlphabet;
+
+template <>
+struct SimdAlphabet<Standard> {
+    static constexpr int8_t kEncodeOffset62 = '+' - 62;
+    static constexpr int8_t kEncodeOffset63 = '/' - 63;
+    // '+' is the only valid character with high nibble 2; '/' is handled as the special case.
+    static constexpr char kBoundHi2 = '+';
+    static constexpr int8_t kShiftHi2 = 62 - '+';
+    static constexpr char kSpecial = '/';
+    static constexpr int8_t kSpecialShift = 63 - '/';
+};
+
+template <>
+struct SimdAlphabet<URL> {
+    static constexpr int8_t kEncodeOffset62 = '-' - 62;
+    static constexpr int8_t kEncodeOffset63 = '_' - 63;
+    // '-' is the only valid character with high nibble 2; '_' is handled as the special case.
+    static constexpr char kBoundHi2 = '-';
+    static constexpr int8_t kShiftHi2 = 62 - '-';
+    static constexpr char kSpecial = '_';
+    static constexpr int8_t kSpecialShift = 63 - '_';
+};
+
+/**
+ * Encodes four 3-byte groups into 16 base64 characters using the usual SSSE3 shuffle technique.
+ * Performs a 16-byte load, so the caller must have at least 16 readable bytes at 'src' even though
+ * only 12 are consumed.
+ */
+template <typename Mode>
+void encodeBlockSimd(const char* src, char* dst) {
+    using Alpha = SimdAlphabet<Mode>;
+
+    const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+    // Spread each 3-byte group over a 32-bit lane, bytes ordered so that fixed shifts and masks
+    // can slice out the four sextets per lane.
+    const __m128i t0 =
+        _mm_shuffle_epi8(data, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    const __m128i t1 = _mm_and_si128(t0, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t2 = _mm_mulhi_epu16(t1, _mm_set1_epi32(0x04000040));
+    const __m128i t3 = _mm_and_si128(t0, _mm_set1_epi32(0x003f03f0));
+    const __m128i t4 = _mm_mullo_epi16(t3, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t2, t4);
+
+    // Reduce each sextet to one of 14 ranges (0..25, 26..51, 52..61, 62, 63) and add the range's
+    // distance to its ASCII run.
+    const __m128i reduced = _mm_or_si128(
+        _mm_subs_epu8(indices, _mm_set1_epi8(51)),
+        _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8(71,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          -4,
+                                          Alpha::kEncodeOffset62,
+                                          Alpha::kEncodeOffset63,
+                                          65,
+                                          0,
+                                          0);
+    const __m128i ascii = _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, reduced));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), ascii);
+}
+
+/**
+ * Decodes 16 base64 characters (none of which may be '=') into four 3-byte groups. Performs a
+ * 16-byte store, so the caller must have 16 writable bytes at 'dst' even though only 12 are
+ * produced. Returns false without writing anything if any input character is not in the alphabet,
+ * leaving the scalar path to pinpoint the offender.
+ */
+template <typename Mode>
+bool decodeBlockSimd(const char* src, char* dst) {
+    using Alpha = SimdAlphabet<Mode>;
+
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+    // Validate by range-checking each byte against the bounds for its high nibble. Rows that hold
+    // no alphabet characters use bounds (127, 0) which no byte satisfies; bytes with the top bit
+    // set are negative in the signed compares and fail the same way.
+    const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+    const __m128i lower =
+        _mm_shuffle_epi8(_mm_setr_epi8(
+                             127, 127, Alpha::kBoundHi2, '0', 'A', 'P', 'a', 'p',  //
+                             127, 127, 127, 127, 127, 127, 127, 127),
+                         hiNibbles);
+    const __m128i upper = _mm_shuffle_epi8(
+        _mm_setr_epi8(
+            0, 0, Alpha::kBoundHi2, '9', 'O', 'Z', 'o', 'z', 0, 0, 0, 0, 0, 0, 0, 0),
+        hiNibbles);
+    const __m128i special = _mm_cmpeq_epi8(in, _mm_set1_epi8(Alpha::kSpecial));
+    const __m128i outside = _mm_andnot_si128(
+        special, _mm_or_si128(_mm_cmplt_epi8(in, lower), _mm_cmpgt_epi8(in, upper)));
+    if (_mm_movemask_epi8(outside)) {
+        return false;
+    }
+
+    // Translate ASCII to sextet values by adding a per-range shift, then merge each lane's four
+    // sextets into a 24-bit group and compact the groups to the front of the vector.
+    const __m128i rangeShift = _mm_shuffle_epi8(
+        _mm_setr_epi8(
+            0, 0, Alpha::kShiftHi2, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0),
+        hiNibbles);
+    const __m128i shift =
+        _mm_or_si128(_mm_andnot_si128(special, rangeShift),
+                     _mm_and_si128(special, _mm_set1_epi8(Alpha::kSpecialShift)));
+    const __m128i values = _mm_add_epi8(in, shift);
+    const __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    const __m128i bytes = _mm_shuffle_epi8(
+        packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+    return true;
+}
+
+#endif  // MONGO_BASE64_SSSE3
+
 template <typename Mode, typename Writer>
 void encodeImpl(Writer&& write, StringData in) {
     static_assert(Mode::kEncodeTable.size() == 64, "Invalid encoding table");
     const char* data = in.rawData();
     std::size_t size = in.size();
+    [[maybe_unused]] const char* const dataEnd = data + size;
     auto readOctet = [&data] {
         return static_cast<std::uint8_t>(*data++);
     };
@@ -67,6 +206,16 @@ void encodeImpl(Writer&& write, StringData in) {
         std::size_t chunkGroups = std::min(fullGroups, sizeof(buf) / 4);
         fullGroups -= chunkGroups;
         p = buf.begin();
+#ifdef MONGO_BASE64_SSSE3
+        // Four groups per step. The kernel loads 16 bytes while consuming 12, so it must stay 4
+        // bytes clear of the end of the input; the scalar loop below picks up the rest.
+        while (chunkGroups >= 4 && dataEnd - data >= 16) {
+            encodeBlockSimd<Mode>(data, &*p);
+            data += 12;
+            p += 16;
+            chunkGroups -= 4;
+        }
+#endif
         while (chunkGroups--) {
             accum = 0;
             accum |= readOctet() << (8 * (2 - 0));
@@ -144,6 +293,19 @@ void decodeImpl(const Writer& write, StringData in) {
         std::size_t chunkGroups = std::min(groups, buf.size() / 3);
         groups -= chunkGroups;
         p = buf.begin();
+#ifdef MONGO_BASE64_SSSE3
+        // Four groups per step; all 16 characters read lie within the full groups, but the kernel
+        // stores 16 bytes while producing 12, so it must stay 4 bytes clear of the end of 'buf'.
+        // An invalid character drops to the scalar loop, which throws with the exact culprit.
+        while (chunkGroups >= 4 && buf.end() - p >= 16) {
+            if (!decodeBlockSimd<Mode>(data, &*p)) {
+                break;
+            }
+            data += 16;
+            p += 12;
+            chunkGroups -= 4;
+        }
+#endif
         while (chunkGroups--) {
             accum = 0;
             accum |= decodeSextet(*data++) << (6 * (3 - 0));
@@ -388,6 +388,13 @@ void ThreadPool::Impl::schedule(Task task) {
     if (_numIdleThreads <= _pendingTasks.size()) {
         _lastFullUtilizationDate = Date_t::now();
     }
+
+    // Notify after releasing the mutex. Waking a waiter is a syscall when any thread is
+    // blocked on _workAvailable; doing it inside the critical section extends the lock hold
+    // time and makes the woken worker immediately collide with the still-held mutex. The
+    // wakeup cannot be lost: the task was enqueued under the mutex, and workers check
+    // _pendingTasks under the mutex before waiting.
+    lk.unlock();
     _workAvailable.notify_one();
 }
 
@@ -71,8 +71,9 @@ bool TicketHolder::resize(OperationContext* opCtx, int32_t newSize, Date_t deadl
                 opCtx->checkForInterrupt();
                 // Take tickets one-by-one without releasing.
                 for (auto remaining = -difference; remaining > 0; remaining--) {
-                    // This call bypasses statistics reporting.
-                    auto ticket = _performWaitForTicketUntil(opCtx, &admCtx, deadline, true);
+                    // This call bypasses statistics reporting. Resizes are administrative and must
+                    // not be starved behind the waiter queue, so they wait on the expedited path.
+                    auto ticket = _performWaitForTicketUntil(opCtx, &admCtx, deadline, true, true);
                     if (!ticket) {
                         // We timed out getting a ticket, fail the resize.
                         return false;
@@ -96,21 +97,21 @@ void TicketHolder::setMaxQueueDepth(int32_t size) {
 void TicketHolder::_immediateResize(WithLock, int32_t newSize) {
     auto oldSize = _outof.swap(newSize);
     auto delta = newSize - oldSize;
-    auto oldAvailable = _tickets.fetchAndAdd(delta);
+    auto oldAvailable = _tickets->fetchAndAdd(delta);
     if ((oldAvailable <= 0) && ((oldAvailable + delta) > 0)) {
-        _tickets.notifyMany(oldAvailable + delta);
+        _tickets->notifyMany(oldAvailable + delta);
     }
 }
 
 void TicketHolder::_releaseTicketUpdateStats(Ticket& ticket) {
     if (ticket._priority == AdmissionContext::Priority::kExempt) {
-        _updateQueueStatsOnRelease(_exemptQueueStats, ticket);
+        _updateQueueStatsOnRelease(*_exemptQueueStats, ticket);
         return;
     }
 
     ticket._admissionContext->markTicketReleased();
 
-    _updateQueueStatsOnRelease(_normalPriorityQueueStats, ticket);
+    _updateQueueStatsOnRelease(*_normalPriorityQueueStats, ticket);
     _releaseNormalPriorityTicket(ticket._admissionContext);
 }
 
@@ -139,25 +140,30 @@ boost::optional<Ticket> TicketHolder::_waitForTicketUntilMaybeInterruptible(
     }
 
     auto tickSource = _serviceContext->getTickSource();
-    _normalPriorityQueueStats.totalAddedQueue.fetchAndAddRelaxed(1);
+    _normalPriorityQueueStats->totalAddedQueue.fetchAndAddRelaxed(1);
     ON_BLOCK_EXIT([&, startWaitTime = tickSource->getTicks()] {
         auto waitDelta = tickSource->ticksTo<Microseconds>(tickSource->getTicks() - startWaitTime);
-        _normalPriorityQueueStats.totalTimeQueuedMicros.fetchAndAddRelaxed(waitDelta.count());
-        _normalPriorityQueueStats.totalRemovedQueue.fetchAndAddRelaxed(1);
+        _normalPriorityQueueStats->totalTimeQueuedMicros.fetchAndAddRelaxed(waitDelta.count());
+        _normalPriorityQueueStats->totalRemovedQueue.fetchAndAddRelaxed(1);
     });
 
     ScopeGuard cancelWait([&] {
         // Update statistics.
-        _normalPriorityQueueStats.totalCanceled.fetchAndAddRelaxed(1);
+        _normalPriorityQueueStats->totalCanceled.fetchAndAddRelaxed(1);
     });
 
+    // Operations that are nearly out of time get expedited admission: making them queue behind a
+    // backlog of long-running work would likely just convert them into timeouts. Operations without
+    // a maxTimeMS report an infinite remaining budget and always take the ordinary path.
+    const bool expedited = opCtx->getRemainingMaxTimeMillis() <= kExpeditedDeadlineThreshold;
+
     WaitingForAdmissionGuard waitForAdmission(admCtx, _serviceContext->getTickSource());
-    auto ticket = _performWaitForTicketUntil(opCtx, admCtx, until, interruptible);
+    auto ticket = _performWaitForTicketUntil(opCtx, admCtx, until, interruptible, expedited);
 
     if (ticket) {
         cancelWait.dismiss();
         _updateQueueStatsOnTicketAcquisition(
-            admCtx, _normalPriorityQueueStats, admCtx->getPriority());
+            admCtx, *_normalPriorityQueueStats, admCtx->getPriority());
         _updatePeakUsed();
         return ticket;
     } else {
@@ -168,7 +174,8 @@ boost::optional<Ticket> TicketHolder::_waitForTicketUntilMaybeInterruptible(
 boost::optional<Ticket> TicketHolder::_performWaitForTicketUntil(OperationContext* opCtx,
                                                                  AdmissionContext* admCtx,
                                                                  Date_t until,
-                                                                 bool interruptible) {
+                                                                 bool interruptible,
+                                                                 bool expedited) {
     auto nextDeadline = [&]() {
         // Timed waits can be problematic if we have a large number of waiters, since each time we
         // check for interrupt we risk waking up all waiting threads at the same time. We introduce
@@ -187,12 +194,28 @@ boost::optional<Ticket> TicketHolder::_performWaitForTicketUntil(OperationContex
     // Since uassert throws, we use raii to substract the waiter count
     ON_BLOCK_EXIT([&] {
         if (hasStartedWaiting) {
-            _waiterCount.fetchAndSubtract(1);
+            _waiters->waiterCount.fetchAndSubtract(1);
+        }
+    });
+
+    if (expedited) {
+        _waiters->expeditedWaiterCount.fetchAndAdd(1);
+    }
+    ON_BLOCK_EXIT([&] {
+        // When the last expedited waiter leaves (with or without a ticket), the pool may hold a
+        // ticket that was being reserved for it. Wake an ordinary waiter to reevaluate.
+        if (expedited && _waiters->expeditedWaiterCount.subtractAndFetch(1) == 0) {
+            _tickets->notifyOne();
         }
     });
 
     while (true) {
-        if (boost::optional<Ticket> maybeTicket = _tryAcquireNormalPriorityTicket(admCtx);
+        // Expedited waiters snapshot the wake sequence before trying to acquire, so a release that
+        // lands between a failed attempt and going to sleep is never missed.
+        const uint32_t wakeSeq = expedited ? _waiters->expeditedWakeSeq.load() : 0;
+
+        if (boost::optional<Ticket> maybeTicket =
+                _tryAcquireNormalPriorityTicket(admCtx, expedited);
             maybeTicket) {
             return maybeTicket;
         }
@@ -200,14 +223,24 @@ boost::optional<Ticket> TicketHolder::_performWaitForTicketUntil(OperationContex
         Date_t deadline = nextDeadline();
 
         if (!hasStartedWaiting) {
-            const auto previousWaiterCount = _waiterCount.fetchAndAdd(1);
+            const auto previousWaiterCount = _waiters->waiterCount.fetchAndAdd(1);
             hasStartedWaiting = true;
             uassert(ErrorCodes::AdmissionQueueOverflow,
                     "MongoDB is overloaded and cannot accept new operations. Try again later.",
                     previousWaiterCount < _maxQueueDepth.loadRelaxed());
         }
 
-        _tickets.waitUntil(0, deadline);
+        if (expedited) {
+            _waiters->expeditedWakeSeq.waitUntil(wakeSeq, deadline);
+        } else {
+            // Sleep on the observed count rather than on zero: a positive count may be a ticket
+            // held in reserve for expedited waiters, and waiting on zero would spin in that case.
+            const int32_t reserved = _waiters->expeditedWaiterCount.loadRelaxed() > 0 ? 1 : 0;
+            const int32_t observed = _tickets->load();
+            if (observed <= reserved) {
+                _tickets->waitUntil(observed, deadline);
+            }
+        }
 
         if (interruptible) {
             opCtx->checkForInterrupt();
@@ -223,27 +256,33 @@ boost::optional<Ticket> TicketHolder::_performWaitForTicketUntil(OperationContex
 boost::optional<Ticket> TicketHolder::tryAcquire(AdmissionContext* admCtx) {
     const auto currentPriority = admCtx->getPriority();
     if (currentPriority == AdmissionContext::Priority::kExempt) {
-        _updateQueueStatsOnTicketAcquisition(admCtx, _exemptQueueStats, currentPriority);
+        _updateQueueStatsOnTicketAcquisition(admCtx, *_exemptQueueStats, currentPriority);
         return Ticket{this, admCtx};
     }
 
-    auto ticket = _tryAcquireNormalPriorityTicket(admCtx);
+    auto ticket = _tryAcquireNormalPriorityTicket(admCtx, false /* expedited */);
     if (ticket) {
-        _updateQueueStatsOnTicketAcquisition(admCtx, _normalPriorityQueueStats, currentPriority);
+        _updateQueueStatsOnTicketAcquisition(admCtx, *_normalPriorityQueueStats, currentPriority);
         _updatePeakUsed();
     }
 
     return ticket;
 }
 
-boost::optional<Ticket> TicketHolder::_tryAcquireNormalPriorityTicket(AdmissionContext* admCtx) {
-    int32_t available = _tickets.load();
+boost::optional<Ticket> TicketHolder::_tryAcquireNormalPriorityTicket(AdmissionContext* admCtx,
+                                                                      bool expedited) {
+    int32_t available = _tickets->load();
     while (true) {
-        if (available <= 0) {
+        // While expedited waiters are registered, ordinary acquisitions leave one ticket in
+        // reserve for them. At most one ticket is ever withheld, and only while such a waiter
+        // exists, so ordinary waiters cannot be starved.
+        const int32_t reserved =
+            (!expedited && _waiters->expeditedWaiterCount.loadRelaxed() > 0) ? 1 : 0;
+        if (available <= reserved) {
             return boost::none;
         }
 
-        if (_tickets.compareAndSwap(&available, available - 1)) {
+        if (_tickets->compareAndSwap(&available, available - 1)) {
             return _makeTicket(admCtx);
         }
     }
@@ -272,13 +311,13 @@ void TicketHolder::appendStats(BSONObjBuilder& b) const {
     b.append("totalTickets", outof());
     {
         BSONObjBuilder bb(b.subobjStart("exempt"));
-        _appendQueueStats(bb, _exemptQueueStats);
+        _appendQueueStats(bb, *_exemptQueueStats);
         bb.done();
     }
 
     {
         BSONObjBuilder bb(b.subobjStart("normalPriority"));
-        _appendQueueStats(bb, _normalPriorityQueueStats);
+        _appendQueueStats(bb, *_normalPriorityQueueStats);
         bb.done();
     }
 }
@@ -327,31 +366,38 @@ void TicketHolder::_updateQueueStatsOnTicketAcquisition(AdmissionContext* admCtx
 }
 
 int64_t TicketHolder::numFinishedProcessing() const {
-    return _normalPriorityQueueStats.totalFinishedProcessing.load();
+    return _normalPriorityQueueStats->totalFinishedProcessing.load();
 }
 
 int64_t TicketHolder::queued() const {
-    auto removed = _normalPriorityQueueStats.totalRemovedQueue.loadRelaxed();
-    auto added = _normalPriorityQueueStats.totalAddedQueue.loadRelaxed();
+    auto removed = _normalPriorityQueueStats->totalRemovedQueue.loadRelaxed();
+    auto added = _normalPriorityQueueStats->totalAddedQueue.loadRelaxed();
     return std::max(added - removed, (int64_t)0);
 };
 
 int32_t TicketHolder::available() const {
-    return _tickets.load();
+    return _tickets->load();
 }
 
 void TicketHolder::_releaseNormalPriorityTicket(AdmissionContext* admCtx) {
-    // Notifying a futex costs a syscall. Since queued waiters guarantee that the `_waiterCount` is
+    // Notifying a futex costs a syscall. Since queued waiters guarantee that the waiter count is
     // non-zero while they are waiting, we can avoid the needless cost if there are tickets and no
     // queued waiters.
-    int32_t availableBeforeIncrementing = _tickets.fetchAndAdd(1);
-    if (availableBeforeIncrementing >= 0 && _waiterCount.load() > 0) {
-        _tickets.notifyOne();
+    int32_t availableBeforeIncrementing = _tickets->fetchAndAdd(1);
+    if (availableBeforeIncrementing >= 0 && _waiters->waiterCount.load() > 0) {
+        _tickets->notifyOne();
+    }
+
+    // A notify on '_tickets' may be consumed by an ordinary waiter, so expedited waiters get a
+    // dedicated wake-up whenever a ticket is released while one of them is registered.
+    if (_waiters->expeditedWaiterCount.loadRelaxed() > 0) {
+        _waiters->expeditedWakeSeq.fetchAndAdd(1);
+        _waiters->expeditedWakeSeq.notifyOne();
     }
 }
 
 void TicketHolder::setNumFinishedProcessing_forTest(int32_t numFinishedProcessing) {
-    _normalPriorityQueueStats.totalFinishedProcessing.store(numFinishedProcessing);
+    _normalPriorityQueueStats->totalFinishedProcessing.store(numFinishedProcessing);
 }
 
 void TicketHolder::setPeakUsed_forTest(int32_t used) {
@@ -359,6 +405,10 @@ void TicketHolder::setPeakUsed_forTest(int32_t used) {
 }
 
 int32_t TicketHolder::waiting_forTest() const {
-    return _waiterCount.load();
+    return _waiters->waiterCount.load();
+}
+
+int32_t TicketHolder::expeditedWaiting_forTest() const {
+    return _waiters->expeditedWaiterCount.load();
 }
 }  // namespace mongo
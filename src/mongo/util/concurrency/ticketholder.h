@@ -38,6 +38,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/waitable_atomic.h"
 #include "mongo/stdx/mutex.h"
+#include "mongo/util/aligned.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/admission_context.h"
 #include "mongo/util/concurrency/with_lock.h"
@@ -164,6 +165,11 @@ public:
      */
     int32_t waiting_forTest() const;
 
+    /**
+     * Exposes the amount of waiting threads admitted on the expedited path for testing purpose.
+     */
+    int32_t expeditedWaiting_forTest() const;
+
     /**
      * Instantaneous number of tickets 'available' (not checked out by an operation) in the ticket
      * pool.
@@ -213,7 +219,13 @@ private:
      */
     void _releaseNormalPriorityTicket(AdmissionContext* admCtx);
 
-    boost::optional<Ticket> _tryAcquireNormalPriorityTicket(AdmissionContext* admCtx);
+    /**
+     * When 'expedited' is false, the acquisition leaves one ticket in the pool untouched while any
+     * expedited waiters are registered, so that the next released ticket reaches them instead of
+     * being claimed by a newly arriving operation.
+     */
+    boost::optional<Ticket> _tryAcquireNormalPriorityTicket(AdmissionContext* admCtx,
+                                                            bool expedited);
 
     boost::optional<Ticket> _waitForTicketUntilMaybeInterruptible(OperationContext* opCtx,
                                                                   AdmissionContext* admCtx,
@@ -222,7 +234,8 @@ private:
     boost::optional<Ticket> _performWaitForTicketUntil(OperationContext* opCtx,
                                                        AdmissionContext* admCtx,
                                                        Date_t until,
-                                                       bool interruptible);
+                                                       bool interruptible,
+                                                       bool expedited);
 
     void _updatePeakUsed();
 
@@ -246,17 +259,45 @@ private:
      */
     Ticket _makeTicket(AdmissionContext* admCtx);
 
-    QueueStats _normalPriorityQueueStats;
-    QueueStats _exemptQueueStats;
+    /**
+     * Operations whose remaining maxTimeMS budget is at or below this threshold when they start
+     * queueing are admitted on an expedited path: while any are waiting, one ticket is held in
+     * reserve for them and ticket releases wake them directly. This keeps operations that are about
+     * to run out of time from queueing behind a backlog of long-running work.
+     */
+    static constexpr Milliseconds kExpeditedDeadlineThreshold{100};
+
+    // Each stats block is written on every admission, so the two blocks get a cache line apiece:
+    // combined within, since their members are bumped together, and exclusive of each other and of
+    // everything below.
+    CacheCombinedExclusive<QueueStats> _normalPriorityQueueStats{};
+    CacheCombinedExclusive<QueueStats> _exemptQueueStats{};
     ResizePolicy _resizePolicy;
     ServiceContext* _serviceContext;
 
     // Serializes updates to _outof to ensure only 1 thread can change the size of the ticket pool
     // at a time. Reading _outof does not require holding the lock.
     stdx::mutex _resizeMutex;
-    BasicWaitableAtomic<int32_t> _tickets;
+
+    // Every acquire and release writes '_tickets', so nothing may share its cache line: waiter
+    // bookkeeping or statistics traffic on the same line would force each release to fetch it back
+    // from whichever core (on multi-socket hosts, whichever NUMA node) last touched the neighbor.
+    CacheExclusive<BasicWaitableAtomic<int32_t>> _tickets;
+
+    // Waiter bookkeeping, updated together on the (already slow) wait path; release only reads the
+    // counts and, while expedited waiters are registered, bumps the wake sequence.
+    struct WaiterState {
+        Atomic<int32_t> waiterCount{0};
+        Atomic<int32_t> expeditedWaiterCount{0};
+
+        // Bumped and notified on every ticket release while expedited waiters are registered,
+        // giving them a wake-up channel that cannot be consumed by ordinary waiters parked on
+        // '_tickets'.
+        BasicWaitableAtomic<uint32_t> expeditedWakeSeq{0};
+    };
+    CacheCombinedExclusive<WaiterState> _waiters{};
+
     Atomic<int32_t> _maxQueueDepth;
-    Atomic<int32_t> _waiterCount{0};
     Atomic<int32_t> _outof;
     Atomic<int32_t> _peakUsed;
 };
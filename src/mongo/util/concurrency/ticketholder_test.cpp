@@ -462,6 +462,60 @@ TEST_F(TicketHolderTest, QueuedWaiterGetsTicketWhenMadeAvailable) {
     ASSERT_EQ(holder->outof(), 3);
 }
 
+TEST_F(TicketHolderTest, ExpeditedWaiterAdmittedAheadOfEarlierOrdinaryWaiter) {
+    constexpr int initialNumTickets = 1;
+    auto holder = makeImmediateResizeHolder(initialNumTickets);
+
+    // take the only ticket
+    MockAdmissionContext admCtx{};
+    boost::optional<Ticket> initialTicket = holder->tryAcquire(&admCtx);
+    ASSERT_TRUE(initialTicket);
+
+    // queue an ordinary waiter with no operation deadline
+    MockAdmission ordinaryAdmission{getServiceContext(), AdmissionContext::Priority::kNormal};
+    Future<Ticket> ordinaryFuture = spawn([&]() {
+        return holder->waitForTicket(ordinaryAdmission.opCtx.get(), &ordinaryAdmission.admCtx);
+    });
+    ASSERT_TRUE(ordinaryAdmission.waitUntilQueued(kDefaultTimeout));
+
+    // Queue a second waiter whose maxTimeMS budget is nearly exhausted, so it takes the expedited
+    // path. The uninterruptible wait keeps it registered however long the test machine takes to
+    // get here, despite the short operation deadline.
+    MockAdmission expeditedAdmission{getServiceContext(), AdmissionContext::Priority::kNormal};
+    expeditedAdmission.opCtx->setDeadlineAfterNowBy(Milliseconds{50},
+                                                    ErrorCodes::MaxTimeMSExpired);
+    Future<boost::optional<Ticket>> expeditedFuture = spawn([&]() {
+        return holder->waitForTicketUntilNoInterrupt_DO_NOT_USE(
+            expeditedAdmission.opCtx.get(), &expeditedAdmission.admCtx, Date_t::max());
+    });
+
+    _opCtx->runWithDeadline(getNextDeadline(), ErrorCodes::ExceededTimeLimit, [&] {
+        waitUntilCanceled(*_opCtx, [&] {
+            return holder->expeditedWaiting_forTest() == 1 && holder->waiting_forTest() == 2;
+        });
+    });
+
+    // Return the ticket. It is held in reserve for the expedited waiter, so the ordinary waiter
+    // cannot claim it even though it queued first.
+    initialTicket.reset();
+
+    boost::optional<Ticket> expeditedTicket;
+    _opCtx->runWithDeadline(getNextDeadline(), ErrorCodes::ExceededTimeLimit, [&] {
+        expeditedTicket = std::move(expeditedFuture).get(_opCtx.get());
+    });
+    ASSERT_TRUE(expeditedTicket);
+    ASSERT_FALSE(ordinaryFuture.isReady());
+
+    // With no expedited waiters left, the released ticket goes to the ordinary waiter.
+    expeditedTicket.reset();
+    boost::optional<Ticket> ordinaryTicket;
+    _opCtx->runWithDeadline(getNextDeadline(), ErrorCodes::ExceededTimeLimit, [&] {
+        ordinaryTicket = std::move(ordinaryFuture).get(_opCtx.get());
+    });
+    ASSERT_EQ(holder->used(), 1);
+    ASSERT_EQ(holder->expeditedWaiting_forTest(), 0);
+}
+
 using TicketHolderImmediateResizeTest = TicketHolderTest;
 
 TEST_F(TicketHolderImmediateResizeTest, CanResizePool) {
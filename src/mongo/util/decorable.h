@@ -73,6 +73,7 @@
 #include <typeinfo>
 #include <vector>
 
+#include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/static_immortal.h"
 
@@ -80,6 +81,14 @@ namespace mongo {
 
 namespace decorable_detail {
 
+// Reusing decoration blocks would mask use-after-free errors in decorations under the address
+// sanitizer, so the block cache is disabled there.
+#if __has_feature(address_sanitizer)
+constexpr inline bool kCacheDecorationBlocks = false;
+#else
+constexpr inline bool kCacheDecorationBlocks = true;
+#endif
+
 template <typename T>
 constexpr inline bool pretendTrivialInit = false;
 template <typename T>
@@ -348,9 +357,66 @@ public:
     }
 
 private:
+    /**
+     * A thread-local cache of freed decoration blocks. High-rate Decorables such as
+     * OperationContext allocate and free one block per instance, and reusing recently freed
+     * blocks makes construction allocation-free at steady state. Every block for a DecoratedType
+     * shares one size and alignment, so any cached block can satisfy any later construction; a
+     * block freed on a different thread than the one that allocated it simply joins the freeing
+     * thread's cache.
+     */
+    class BlockCache {
+    public:
+        ~BlockCache() {
+            _invalidate();
+        }
+
+        unsigned char* acquire(std::size_t size, std::align_val_t alignment) {
+            if (kCacheDecorationBlocks && !_blocks.empty() && size == _size &&
+                alignment == _alignment) {
+                auto block = _blocks.back();
+                _blocks.pop_back();
+                return block;
+            }
+            return static_cast<unsigned char*>(::operator new(size, alignment));
+        }
+
+        void release(unsigned char* block, std::size_t size, std::align_val_t alignment) {
+            if (!kCacheDecorationBlocks) {
+                ::operator delete(block, size, alignment);
+                return;
+            }
+            if (size != _size || alignment != _alignment) {
+                // The registry grew since these blocks were cached, which can only happen while
+                // decorations are still being declared. Drop the stale layout.
+                _invalidate();
+                _size = size;
+                _alignment = alignment;
+            }
+            if (_blocks.size() == kMaxBlocks) {
+                ::operator delete(block, size, alignment);
+                return;
+            }
+            _blocks.push_back(block);
+        }
+
+    private:
+        static constexpr std::size_t kMaxBlocks = 4;
+
+        void _invalidate() noexcept {
+            for (auto&& block : _blocks)
+                ::operator delete(block, _size, _alignment);
+            _blocks.clear();
+        }
+
+        std::size_t _size = 0;
+        std::align_val_t _alignment{alignof(void*)};
+        std::vector<unsigned char*> _blocks;
+    };
+
     struct AlignedDeleter {
         void operator()(unsigned char* ptr) const {
-            ::operator delete(ptr, size, alignment);
+            _blockCache().release(ptr, size, alignment);
         }
 
         std::size_t size;
@@ -363,6 +429,11 @@ private:
         return getRegistry<DecoratedType>();
     }
 
+    static BlockCache& _blockCache() {
+        static thread_local BlockCache cache;
+        return cache;
+    }
+
     void _constructorCommon() {
         auto& reg = _reg();
         size_t n = reg.size();
@@ -396,12 +467,11 @@ private:
 
     OwningPointer _makeData() {
         auto& reg = _reg();
-        auto alignment = reg.bufferAlignment();
+        auto alignment = std::align_val_t{reg.bufferAlignment()};
         auto sz = reg.bufferSize();
-        auto rawBuffer =
-            static_cast<unsigned char*>(::operator new(sz, std::align_val_t(alignment)));
+        auto rawBuffer = _blockCache().acquire(sz, alignment);
         std::memset(rawBuffer, 0, sz);
-        return OwningPointer{rawBuffer, AlignedDeleter{sz, std::align_val_t{alignment}}};
+        return OwningPointer{rawBuffer, AlignedDeleter{sz, alignment}};
     }
 
     OwningPointer _dataOwnership{_makeData()};
@@ -320,6 +320,33 @@ TEST_F(DecorableTest, DoNotZeroInitOther) {
     ASSERT_EQ(x[decorator].value, 123);
 }
 
+TEST_F(DecorableTest, DecorationBlockReuse) {
+    struct X : Decorable<X> {};
+    static auto da = X::declareDecoration<A>();
+    static auto di = X::declareDecoration<int>();
+
+    // Warm the thread-local block cache and dirty the decoration memory.
+    const void* firstAddress;
+    {
+        X x1;
+        x1[di] = 123;
+        firstAddress = &x1[da];
+    }
+    ASSERT_EQ(stats.constructed, 1);
+    ASSERT_EQ(stats.destructed, 1);
+
+    if (!decorable_detail::kCacheDecorationBlocks) {
+        return;  // Block reuse is disabled under the address sanitizer.
+    }
+
+    // At steady state the decoration block is reused, and the new instance still runs the
+    // decoration constructors on freshly zeroed memory.
+    X x2;
+    ASSERT_EQ(static_cast<const void*>(&x2[da]), firstAddress);
+    ASSERT_EQ(x2[di], 0);
+    ASSERT_EQ(stats.constructed, 2);
+}
+
 class DecorableZeroInitTest : public DecorableTest {
 public:
     // Test decorated type needs copy assign and constructor removed so that types without copy
@@ -29,9 +29,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -156,6 +158,10 @@ class unique_function;
  * it is incapable of being copied.  Often this happens with C++14 or later lambdas which capture a
  * `std::unique_ptr` by move.  The interface of `unique_function` is nearly identical to
  * `std::function`, except that it is not copyable.
+ *
+ * Small functors are stored in an inline buffer rather than on the heap, so the common case of a
+ * lambda capturing a handful of pointers (e.g. a future continuation) costs no allocation. Functors
+ * that are too large, over-aligned, or not nothrow move constructible fall back to the heap.
  */
 template <typename RetType, typename... Args>
 class unique_function<RetType(Args...)> {
@@ -176,18 +182,30 @@ private:
 public:
     using result_type = RetType;
 
-    ~unique_function() noexcept = default;
+    ~unique_function() noexcept {
+        reset();
+    }
     unique_function() = default;
 
     unique_function(const unique_function&) = delete;
     unique_function& operator=(const unique_function&) = delete;
 
-    unique_function(unique_function&&) noexcept = default;
-    unique_function& operator=(unique_function&&) noexcept = default;
+    unique_function(unique_function&& that) noexcept {
+        moveFrom(std::move(that));
+    }
+
+    unique_function& operator=(unique_function&& that) noexcept {
+        if (this != &that) {
+            reset();
+            moveFrom(std::move(that));
+        }
+        return *this;
+    }
 
     void swap(unique_function& that) noexcept {
-        using std::swap;
-        swap(this->impl, that.impl);
+        unique_function tmp = std::move(that);
+        that = std::move(*this);
+        *this = std::move(tmp);
     }
 
     friend void swap(unique_function& a, unique_function& b) noexcept {
@@ -210,8 +228,9 @@ public:
             makeTag(),
         std::enable_if_t<std::is_move_constructible<Functor>::value, TagType> = makeTag(),
         std::enable_if_t<!std::is_same<std::decay_t<Functor>, unique_function>::value, TagType> =
-            makeTag())
-        : impl(makeImpl(std::forward<Functor>(functor))) {}
+            makeTag()) {
+        makeImpl(std::forward<Functor>(functor));
+    }
 
     unique_function(std::nullptr_t) noexcept {}
 
@@ -248,10 +267,21 @@ private:
     struct Impl {
         virtual ~Impl() noexcept = default;
         virtual RetType call(Args&&... args) = 0;
+
+        /**
+         * Move-constructs a copy of this Impl into 'buffer' and returns it. Only ever invoked on
+         * Impls living in another unique_function's inline buffer, which are restricted to
+         * functors that fit there and are nothrow move constructible.
+         */
+        virtual Impl* relocateTo(void* buffer) noexcept = 0;
     };
 
+    // Functors whose Impl is no larger than this are stored in the inline buffer. Sized so that a
+    // lambda capturing several pointers fits alongside the Impl vtable pointer.
+    static constexpr size_t kInlineSize = 64;
+
     template <typename Functor>
-    static auto makeImpl(Functor&& functor) {
+    void makeImpl(Functor&& functor) {
         struct SpecificImpl : Impl {
             explicit SpecificImpl(Functor&& func) : f(std::forward<Functor>(func)) {}
 
@@ -265,13 +295,56 @@ private:
                 }
             }
 
+            Impl* relocateTo(void* target) noexcept override {
+                return new (target) SpecificImpl(std::move(*this));
+            }
+
             std::decay_t<Functor> f;
         };
 
-        return std::make_unique<SpecificImpl>(std::forward<Functor>(functor));
+        constexpr bool fitsInline = sizeof(SpecificImpl) <= kInlineSize &&
+            alignof(SpecificImpl) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<std::decay_t<Functor>>;
+        if constexpr (fitsInline) {
+            impl = new (&buffer) SpecificImpl(std::forward<Functor>(functor));
+            isInline = true;
+        } else {
+            impl = new SpecificImpl(std::forward<Functor>(functor));
+            isInline = false;
+        }
+    }
+
+    void moveFrom(unique_function&& that) noexcept {
+        if (!that.impl) {
+            return;
+        }
+        if (that.isInline) {
+            impl = that.impl->relocateTo(&buffer);
+            isInline = true;
+            that.reset();
+        } else {
+            impl = std::exchange(that.impl, nullptr);
+            isInline = false;
+        }
+    }
+
+    void reset() noexcept {
+        if (!impl) {
+            return;
+        }
+        if (isInline) {
+            impl->~Impl();
+        } else {
+            delete impl;
+        }
+        impl = nullptr;
+        isInline = false;
     }
 
-    std::unique_ptr<Impl> impl;
+    // Points into 'buffer' when the functor is stored inline, at a heap allocation otherwise.
+    Impl* impl = nullptr;
+    bool isInline = false;
+    std::aligned_storage_t<kInlineSize, alignof(std::max_align_t)> buffer;
 };
 
 /**
@@ -29,6 +29,7 @@
 
 #include "mongo/util/functional.h"
 
+#include <array>
 #include <string>
 
 #include "mongo/base/static_assert.h"
@@ -373,6 +374,50 @@ TEST(UniqueFunctionTest, dtor_releases_functor_object_and_does_not_call_function
     ASSERT_FALSE(runDetection1.itRan);
 }
 
+TEST(UniqueFunctionTest, moves_preserve_functor_for_inline_and_heap_storage) {
+    struct LiveCounter {
+        explicit LiveCounter(int* live) : live(live) {
+            ++*live;
+        }
+        LiveCounter(const LiveCounter& other) : live(other.live) {
+            ++*live;
+        }
+        LiveCounter(LiveCounter&& other) noexcept : live(other.live) {
+            ++*live;
+        }
+        ~LiveCounter() {
+            --*live;
+        }
+        int* live;
+    };
+
+    int live = 0;
+    {
+        // Small capture, stored in the inline buffer; moves must relocate the functor rather than
+        // steal a pointer.
+        mongo::unique_function<int()> uf = [counter = LiveCounter(&live)] {
+            return 42;
+        };
+        auto moved = std::move(uf);
+        mongo::unique_function<int()> assigned;
+        assigned = std::move(moved);
+        ASSERT_EQUALS(assigned(), 42);
+
+        // Large capture, stored on the heap; moves transfer ownership of the allocation.
+        mongo::unique_function<int()> big = [counter = LiveCounter(&live),
+                                             padding = std::array<char, 128>()] {
+            return static_cast<int>(padding.size());
+        };
+        auto bigMoved = std::move(big);
+        ASSERT_EQUALS(bigMoved(), 128);
+
+        assigned.swap(bigMoved);
+        ASSERT_EQUALS(assigned(), 128);
+        ASSERT_EQUALS(bigMoved(), 42);
+    }
+    ASSERT_EQUALS(live, 0);
+}
+
 TEST(UniqueFunctionTest, comparison_checks) {
     mongo::unique_function<void()> uf;
 
@@ -2521,6 +2521,22 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
     }
 #endif
 
+#if defined(__linux__)
+    if (gTLSUseKernelTLS) {
+#ifdef SSL_OP_ENABLE_KTLS
+        // Hand the negotiated record keys to the kernel after the handshake so that record
+        // encryption and decryption happen in the socket layer rather than in userspace.
+        // OpenSSL transparently falls back to userspace TLS when the kernel, cipher, or TLS
+        // version lacks kTLS support.
+        options |= SSL_OP_ENABLE_KTLS;
+#else
+        LOGV2_WARNING(9876507,
+                      "tlsUseKernelTLS was requested, but this build's OpenSSL does not support "
+                      "kernel TLS offload; continuing with userspace TLS");
+#endif
+    }
+#endif
+
     ::SSL_CTX_set_options(context, options);
 
     if (0 == ::SSL_CTX_set_cipher_list(context, cipherConfig.c_str())) {
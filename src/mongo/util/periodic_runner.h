@@ -60,11 +60,16 @@ public:
     using JobAnchor = PeriodicJobAnchor;
 
     struct PeriodicJob {
-        PeriodicJob(std::string name, Job callable, Milliseconds period, bool isKillableByStepdown)
+        PeriodicJob(std::string name,
+                    Job callable,
+                    Milliseconds period,
+                    bool isKillableByStepdown,
+                    Milliseconds tolerance = Milliseconds(0))
             : name(std::move(name)),
               job(std::move(callable)),
               interval(period),
-              isKillableByStepdown(isKillableByStepdown) {}
+              isKillableByStepdown(isKillableByStepdown),
+              tolerance(tolerance) {}
 
         /**
          * name of the job
@@ -82,9 +87,14 @@ public:
         Milliseconds interval;
 
         /**
-         * Whether this job is killable during stepdown.
+         * How far past its deadline a run may be deferred so that it wakes up together with other
+         * jobs. Implementations round each deadline up to the next multiple of the tolerance on
+         * the wall clock, so all jobs sharing a tolerance fire at the same instants instead of
+         * each waking an idle CPU on its own schedule. Zero keeps the exact per-job deadline.
+         * Jobs that can tolerate some jitter should pass a tolerance of a reasonable fraction of
+         * their interval.
          */
-        bool isKillableByStepdown;
+        Milliseconds tolerance;
     };
 
     /**
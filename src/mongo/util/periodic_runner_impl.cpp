@@ -52,6 +52,26 @@
 
 namespace mongo {
 
+namespace {
+
+/**
+ * Rounds 'deadline' up to the next point on the absolute wall-clock grid with spacing 'tolerance'.
+ * Jobs sharing a tolerance thereby wake at the same instants regardless of when each last ran,
+ * coalescing what would otherwise be one CPU wakeup per job. A zero tolerance leaves the deadline
+ * unchanged.
+ */
+Date_t coalesceDeadline(Date_t deadline, Milliseconds tolerance) {
+    if (tolerance <= Milliseconds(0)) {
+        return deadline;
+    }
+    auto toleranceMs = durationCount<Milliseconds>(tolerance);
+    auto deadlineMs = deadline.toMillisSinceEpoch();
+    return Date_t::fromMillisSinceEpoch(((deadlineMs + toleranceMs - 1) / toleranceMs) *
+                                        toleranceMs);
+}
+
+}  // namespace
+
 PeriodicRunnerImpl::PeriodicRunnerImpl(ServiceContext* svc, ClockSource* clockSource)
     : _svc(svc), _clockSource(clockSource) {}
 
@@ -116,7 +136,7 @@ void PeriodicRunnerImpl::PeriodicJobImpl::_run() {
                 lk.lock();
 
                 auto getDeadlineFromInterval = [&] {
-                    return start + _job.interval;
+                    return coalesceDeadline(start + _job.interval, _job.tolerance);
                 };
 
                 do {
@@ -118,6 +118,54 @@ TEST_F(PeriodicRunnerImplTest, OneJobTest) {
     tearDown();
 }
 
+TEST_F(PeriodicRunnerImplTest, JobWithToleranceCoalescesToWallClockGrid) {
+    int count = 0;
+    Milliseconds interval{10};
+    Milliseconds tolerance{25};
+
+    stdx::mutex mutex;
+    stdx::condition_variable cv;
+
+    PeriodicRunner::PeriodicJob job(
+        "job",
+        [&count, &mutex, &cv](Client*) {
+            {
+                stdx::unique_lock<stdx::mutex> lk(mutex);
+                count++;
+            }
+            cv.notify_all();
+        },
+        interval,
+        false,
+        tolerance);
+
+    auto jobAnchor = runner().makeJob(std::move(job));
+    jobAnchor.start();
+
+    // The job runs once on start.
+    {
+        stdx::unique_lock<stdx::mutex> lk(mutex);
+        cv.wait(lk, [&count] { return count >= 1; });
+    }
+
+    // The next raw deadline is now + 10ms, but with a 25ms tolerance it is deferred to the next
+    // multiple of 25ms on the wall clock, so passing the raw deadline must not fire the job.
+    clockSource().advance(interval);
+    {
+        stdx::unique_lock<stdx::mutex> lk(mutex);
+        ASSERT_EQ(count, 1);
+    }
+
+    // Reaching the grid point does fire it.
+    clockSource().advance(Milliseconds{25} - interval);
+    {
+        stdx::unique_lock<stdx::mutex> lk(mutex);
+        cv.wait(lk, [&count] { return count >= 2; });
+    }
+
+    tearDown();
+}
+
 TEST_F(PeriodicRunnerImplTest, OnePausableJobDoesNotRunWithoutStart) {
     int count = 0;
     Milliseconds interval{5};
@@ -480,16 +480,16 @@ public:
     //
     // Leaves T unchanged if an interrupt exception is thrown while waiting for space
     void push(T&& t, Interruptible* interruptible = Interruptible::notInterruptible()) {
-        _pushRunner([&](stdx::unique_lock<stdx::mutex>& lk) {
-            auto cost = _invokeCostFunc(t, lk);
-            uassert(ErrorCodes::ProducerConsumerQueueBatchTooLarge,
-                    str::stream() << "cost of item (" << cost
-                                  << ") larger than maximum queue size (" << _options.maxQueueDepth
-                                  << ")",
-                    cost <= _options.maxQueueDepth);
+        // The cost function is arbitrary user code, so invoke it before taking the lock
+        const auto cost = _invokeCostFunc(t);
+        uassert(ErrorCodes::ProducerConsumerQueueBatchTooLarge,
+                str::stream() << "cost of item (" << cost << ") larger than maximum queue size ("
+                              << _options.maxQueueDepth << ")",
+                cost <= _options.maxQueueDepth);
 
+        _pushRunner([&](stdx::unique_lock<stdx::mutex>& lk) {
             _waitForSpace(lk, cost, interruptible);
-            _push(lk, std::move(t));
+            _push(lk, std::move(t), cost);
         });
     }
 
@@ -508,22 +508,27 @@ public:
     void pushMany(StartIterator start,
                   EndIterator last,
                   Interruptible* interruptible = Interruptible::notInterruptible()) {
-        return _pushRunner([&](stdx::unique_lock<stdx::mutex>& lk) {
-            size_t cost = 0;
-            for (auto iter = start; iter != last; ++iter) {
-                cost += _invokeCostFunc(*iter, lk);
-            }
+        // The cost function is arbitrary user code, so invoke it for the whole batch before
+        // taking the lock
+        std::vector<size_t> costs;
+        size_t cost = 0;
+        for (auto iter = start; iter != last; ++iter) {
+            costs.push_back(_invokeCostFunc(*iter));
+            cost += costs.back();
+        }
 
-            uassert(ErrorCodes::ProducerConsumerQueueBatchTooLarge,
-                    str::stream() << "cost of items in batch (" << cost
-                                  << ") larger than maximum queue size (" << _options.maxQueueDepth
-                                  << ")",
-                    cost <= _options.maxQueueDepth);
+        uassert(ErrorCodes::ProducerConsumerQueueBatchTooLarge,
+                str::stream() << "cost of items in batch (" << cost
+                              << ") larger than maximum queue size (" << _options.maxQueueDepth
+                              << ")",
+                cost <= _options.maxQueueDepth);
 
+        return _pushRunner([&](stdx::unique_lock<stdx::mutex>& lk) {
             _waitForSpace(lk, cost, interruptible);
 
+            size_t i = 0;
             for (auto iter = start; iter != last; ++iter) {
-                _push(lk, std::move(*iter));
+                _push(lk, std::move(*iter), costs[i++]);
             }
         });
     }
@@ -532,8 +537,9 @@ public:
     //
     // Leaves T unchanged if it fails
     bool tryPush(T&& t) {
+        const auto cost = _invokeCostFunc(t);
         return _pushRunner(
-            [&](stdx::unique_lock<stdx::mutex>& lk) { return _tryPush(lk, std::move(t)); });
+            [&](stdx::unique_lock<stdx::mutex>& lk) { return _tryPush(lk, std::move(t), cost); });
     }
 
     // Pops one T out of the queue
@@ -552,6 +558,7 @@ public:
         Interruptible* interruptible = Interruptible::notInterruptible()) {
         return _popRunner([&](stdx::unique_lock<stdx::mutex>& lk) {
             _waitForNonEmpty(lk, interruptible);
+            _costs.clear();
             return std::make_pair(std::exchange(_queue, {}), std::exchange(_current, 0));
         });
     }
@@ -570,6 +577,7 @@ public:
             _waitForNonEmpty(lk, interruptible);
 
             if (_current <= budget) {
+                _costs.clear();
                 return std::make_pair(std::exchange(_queue, {}), std::exchange(_current, 0));
             }
 
@@ -577,7 +585,7 @@ public:
             size_t cost = 0;
 
             while (_queue.size()) {
-                auto potentialCost = _invokeCostFunc(_queue.front(), lk);
+                auto potentialCost = _costs.front();
 
                 if (cost + potentialCost > budget) {
                     break;
@@ -587,6 +595,7 @@ public:
 
                 queue.emplace_back(std::move(_queue.front()));
                 _queue.pop_front();
+                _costs.pop_front();
                 _current -= potentialCost;
             }
 
@@ -779,7 +788,7 @@ private:
     using Consumers = ConsumerState<consumerKind>;
     using Producers = ProducerState<producerKind, Options>;
 
-    size_t _invokeCostFunc(const T& t, WithLock) {
+    size_t _invokeCostFunc(const T& t) {
         auto cost = _options.costFunc(t);
         invariant(cost);
         return cost;
@@ -854,10 +863,10 @@ private:
         return cb(lk);
     }
 
-    bool _tryPush(WithLock wl, T&& t) {
-        size_t cost = _invokeCostFunc(t, wl);
+    bool _tryPush(WithLock, T&& t, size_t cost) {
         if (_current + cost <= _options.maxQueueDepth) {
             _queue.emplace_back(std::move(t));
+            _costs.push_back(cost);
             _current += cost;
             return true;
         }
@@ -865,33 +874,35 @@ private:
         return false;
     }
 
-    void _push(WithLock wl, T&& t) {
-        size_t cost = _invokeCostFunc(t, wl);
+    void _push(WithLock, T&& t, size_t cost) {
         invariant(_current + cost <= _options.maxQueueDepth);
 
         _queue.emplace_back(std::move(t));
+        _costs.push_back(cost);
         _current += cost;
     }
 
-    boost::optional<T> _tryPop(WithLock wl) {
+    boost::optional<T> _tryPop(WithLock) {
         boost::optional<T> out;
 
         if (!_queue.empty()) {
             out.emplace(std::move(_queue.front()));
             _queue.pop_front();
-            _current -= _invokeCostFunc(*out, wl);
+            _current -= _costs.front();
+            _costs.pop_front();
         }
 
         return out;
     }
 
-    T _pop(WithLock wl) {
+    T _pop(WithLock) {
         invariant(_queue.size());
 
         auto t = std::move(_queue.front());
         _queue.pop_front();
 
-        _current -= _invokeCostFunc(t, wl);
+        _current -= _costs.front();
+        _costs.pop_front();
 
         return t;
     }
@@ -933,6 +944,11 @@ private:
 
     std::deque<T> _queue;
 
+    // Cost of each item in _queue, in queue order. Costs are computed once, by the pushing
+    // thread before it takes the lock, so that pops never have to run the user-provided cost
+    // function inside the critical section (or at all).
+    std::deque<size_t> _costs;
+
     // State for waiting consumers and producers
     Consumers _consumers;
     Producers _producers;
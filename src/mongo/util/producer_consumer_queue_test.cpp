@@ -1046,6 +1046,39 @@ PRODUCER_CONSUMER_QUEUE_TEST(tryPushWithSpecialStatefulCost, runPermutations<fal
     ASSERT_EQUALS(pcq.getStats().queueDepth, 0ul);
 }
 
+PRODUCER_CONSUMER_QUEUE_TEST(costFuncInvokedOncePerItemOnPush, runPermutations<false, false>) {
+    struct CountingCostFunc {
+        size_t operator()(const MoveOnly&) const {
+            ++(*invocations);
+            return 1;
+        }
+
+        std::shared_ptr<size_t> invocations = std::make_shared<size_t>(0);
+    };
+
+    using PCQ = typename Helper::template ProducerConsumerQueue<MoveOnly, CountingCostFunc>;
+    typename PCQ::Options options;
+    auto invocations = options.costFunc.invocations;
+    PCQ pcq(std::move(options));
+
+    pcq.push(MoveOnly(1));
+    ASSERT_EQUALS(*invocations, 1ul);
+
+    std::vector<MoveOnly> vec;
+    vec.emplace_back(2);
+    vec.emplace_back(3);
+    pcq.pushMany(vec.begin(), vec.end());
+    ASSERT_EQUALS(*invocations, 3ul);
+
+    // Costs are remembered from push time; pops never re-invoke the cost function
+    ASSERT_EQUALS(pcq.pop(), MoveOnly(1));
+    ASSERT_TRUE(pcq.tryPop());
+    pcq.popMany();
+    ASSERT_EQUALS(*invocations, 3ul);
+
+    ASSERT_EQUALS(pcq.getStats().queueDepth, 0ul);
+}
+
 }  // namespace
 
 }  // namespace mongo
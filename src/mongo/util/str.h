@@ -382,8 +382,12 @@ void joinStringDelim(const std::vector<std::string>& strs, std::string* res, cha
 
 inline std::string toLower(StringData input) {
     std::string r{input};
-    for (char& c : r)
-        c = ctype::toLower(c);
+    // Branchless equivalent of ctype::toLower: the table lookup defeats auto-vectorization, while
+    // this form compiles to a handful of SIMD instructions per register-width of characters.
+    for (char& c : r) {
+        auto uc = static_cast<unsigned char>(c);
+        c = static_cast<char>(uc + ((uc >= 'A' && uc <= 'Z') << 5));
+    }
     return r;
 }
 
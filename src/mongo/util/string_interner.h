@@ -0,0 +1,141 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "mongo/base/string_data.h"
+#include "mongo/platform/rwmutex.h"
+#include "mongo/util/static_immortal.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+/**
+ * A handle to a string interned by StringInterner. Copying is an 8-byte pointer copy, and
+ * equality between two interned strings is a pointer compare. The underlying storage is
+ * process-wide and immortal, so handles never dangle.
+ */
+class InternedString {
+public:
+    InternedString() = default;
+
+    StringData view() const {
+        return _str ? StringData(*_str) : StringData();
+    }
+
+    operator StringData() const {
+        return view();
+    }
+
+    bool empty() const {
+        return !_str;
+    }
+
+    /**
+     * Pointer equality: two handles obtained from the same interner for equal strings compare
+     * equal without touching the character data.
+     */
+    bool operator==(const InternedString& other) const {
+        return _str == other._str;
+    }
+    bool operator!=(const InternedString& other) const {
+        return !(*this == other);
+    }
+
+private:
+    friend class StringInterner;
+    explicit InternedString(const std::string* str) : _str(str) {}
+
+    const std::string* _str = nullptr;
+};
+
+/**
+ * Process-wide dictionary of interned strings, intended for high-duplication identifiers such as
+ * field names that repeat across billions of documents. Lookups of already-interned strings take
+ * a shared lock on the read-mostly index (the same snapshot pattern the collection catalog uses);
+ * only first-time inserts take the exclusive lock. Interned storage is append-only and never
+ * freed, so this should only be used for bounded sets of names, not arbitrary user data.
+ */
+class StringInterner {
+public:
+    static StringInterner& global() {
+        static StaticImmortal<StringInterner> interner;
+        return *interner;
+    }
+
+    StringInterner() = default;
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    /**
+     * Returns the canonical handle for 'str', interning it on first use.
+     */
+    InternedString intern(StringData str) {
+        {
+            auto lock = _mutex.readLock();
+            if (auto it = _index.find(str); it != _index.end())
+                return InternedString(it->second);
+        }
+
+        auto lock = _mutex.writeLock();
+        if (auto it = _index.find(str); it != _index.end())
+            return InternedString(it->second);
+        const std::string& stored = _storage.emplace_back(std::string{str});
+        _index.emplace(stored, &stored);
+        return InternedString(&stored);
+    }
+
+    /**
+     * Returns the handle for 'str' if already interned, or an empty handle otherwise. Never
+     * takes the exclusive lock.
+     */
+    InternedString lookup(StringData str) const {
+        auto lock = _mutex.readLock();
+        if (auto it = _index.find(str); it != _index.end())
+            return InternedString(it->second);
+        return InternedString();
+    }
+
+    size_t size() const {
+        auto lock = _mutex.readLock();
+        return _index.size();
+    }
+
+private:
+    mutable WriteRarelyRWMutex _mutex;
+    // Deque gives stable addresses for stored strings as the dictionary grows.
+    std::deque<std::string> _storage;
+    StringMap<const std::string*> _index;
+};
+
+}  // namespace mongo
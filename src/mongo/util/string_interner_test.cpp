@@ -0,0 +1,77 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/util/string_interner.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(StringInterner, InternReturnsStableCanonicalHandle) {
+    StringInterner interner;
+    auto a = interner.intern("timestamp");
+    auto b = interner.intern("timestamp");
+    ASSERT_TRUE(a == b);
+    ASSERT_EQ(a.view(), "timestamp");
+    ASSERT_EQ(interner.size(), 1u);
+
+    auto c = interner.intern("deviceId");
+    ASSERT_TRUE(a != c);
+    ASSERT_EQ(interner.size(), 2u);
+}
+
+TEST(StringInterner, LookupDoesNotIntern) {
+    StringInterner interner;
+    ASSERT_TRUE(interner.lookup("missing").empty());
+    ASSERT_EQ(interner.size(), 0u);
+
+    auto a = interner.intern("present");
+    ASSERT_TRUE(interner.lookup("present") == a);
+}
+
+TEST(StringInterner, HandlesRemainValidAfterGrowth) {
+    StringInterner interner;
+    auto first = interner.intern("field0");
+    for (int i = 1; i < 1000; ++i)
+        interner.intern("field" + std::to_string(i));
+    ASSERT_EQ(first.view(), "field0");
+    ASSERT_TRUE(interner.intern("field0") == first);
+}
+
+TEST(StringInterner, EmptyHandle) {
+    InternedString empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.view(), "");
+    ASSERT_TRUE(empty == InternedString());
+}
+
+}  // namespace
+}  // namespace mongo
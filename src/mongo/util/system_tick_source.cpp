@@ -33,10 +33,14 @@
 #include <memory>
 
 #include "mongo/util/tick_source.h"
+#include "mongo/util/tsc_tick_source.h"
 
 namespace mongo {
 
 std::unique_ptr<TickSource> makeSystemTickSource() {
+    if (auto tscTickSource = makeTscTickSource()) {
+        return tscTickSource;
+    }
     class Steady : public TickSource {
         using C = std::chrono::steady_clock;  // NOLINT
         Tick getTicksPerSecond() override {
@@ -35,7 +35,12 @@
 
 namespace mongo {
 
-/** Tick source based on `std:::chrono::steady_clock`. Monotonic, cheap, and high-precision. */
+/**
+ * Makes the best monotonic, cheap, high-precision tick source available: the CPU's invariant
+ * timestamp counter when the hardware has one (see `makeTscTickSource`), otherwise
+ * `std::chrono::steady_clock`. The tick frequency varies accordingly; callers must go through
+ * `getTicksPerSecond`.
+ */
 std::unique_ptr<TickSource> makeSystemTickSource();
 
 /** Accesses a singleton instance made by `makeSystemTickSource`. Safe to call at any time. */
@@ -0,0 +1,112 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/thread_allocation_tracking.h"
+
+#include "mongo/config.h"
+
+#ifdef MONGO_CONFIG_TCMALLOC_GPERF
+#include <gperftools/malloc_extension.h>
+#include <gperftools/malloc_hook.h>
+
+#include "mongo/platform/atomic_word.h"
+#endif
+
+namespace mongo {
+
+#ifdef MONGO_CONFIG_TCMALLOC_GPERF
+
+namespace {
+
+// The hooks run inside the allocator on every thread, including ones created before installation,
+// so the counters must be plain thread_locals with no lazily constructed state.
+thread_local ThreadAllocationStats threadStats;
+
+void newHook(const void* ptr, size_t size) {
+    if (ptr) {
+        threadStats.allocatedBytes += size;
+    }
+}
+
+void deleteHook(const void* ptr) {
+    if (ptr) {
+        // The delete hook only receives the pointer; recover the allocation's actual size from its
+        // size class so allocated and deallocated totals are measured on the same basis.
+        threadStats.deallocatedBytes += MallocExtension::instance()->GetAllocatedSize(ptr);
+    }
+}
+
+AtomicWord<bool> installed{false};
+
+}  // namespace
+
+bool installThreadAllocationTracking() {
+    if (installed.load()) {
+        return true;
+    }
+    if (!MallocHook::AddNewHook(&newHook)) {
+        return false;
+    }
+    if (!MallocHook::AddDeleteHook(&deleteHook)) {
+        MallocHook::RemoveNewHook(&newHook);
+        return false;
+    }
+    installed.store(true);
+    return true;
+}
+
+bool threadAllocationTrackingAvailable() {
+    return installed.load();
+}
+
+ThreadAllocationStats threadAllocationStats() {
+    return threadStats;
+}
+
+#else
+
+// The google build of tcmalloc has neither allocation hooks nor a per-thread byte counter in its
+// MallocExtension, and the system allocator has no introspection at all, so tracking is
+// unavailable and callers fall back to self-reported accounting.
+
+bool installThreadAllocationTracking() {
+    return false;
+}
+
+bool threadAllocationTrackingAvailable() {
+    return false;
+}
+
+ThreadAllocationStats threadAllocationStats() {
+    return {};
+}
+
+#endif
+
+}  // namespace mongo
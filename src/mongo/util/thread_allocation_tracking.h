@@ -0,0 +1,79 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace mongo {
+
+/**
+ * Allocator-observed per-thread allocation totals.
+ *
+ * Where the active allocator can report them, these counters attribute every allocation and
+ * deallocation a thread performs, including ones the owning code never self-reports to a
+ * MemoryUsageTracker. Capturing `threadAllocationStats()` when a task starts running on a thread
+ * and again when it yields the thread, and accumulating the deltas on a per-operation tracker,
+ * yields memory attribution that cannot drift from what the allocator actually handed out.
+ *
+ * The counters are maintained by allocator hooks, so they are only populated after
+ * `installThreadAllocationTracking()` has been called and only when the allocator supports hooks
+ * (currently the gperftools build of tcmalloc; the google build exposes no per-thread hook or
+ * counter API). Callers must treat `threadAllocationTrackingAvailable()` as the feature gate and
+ * fall back to self-reported accounting otherwise.
+ */
+struct ThreadAllocationStats {
+    /** Bytes this thread has allocated since tracking was installed. Monotonic. */
+    uint64_t allocatedBytes = 0;
+
+    /** Bytes this thread has freed since tracking was installed. Monotonic. */
+    uint64_t deallocatedBytes = 0;
+};
+
+/**
+ * Installs the allocator hooks that maintain the per-thread counters. Idempotent. Returns true if
+ * tracking is (now) active, false if the active allocator cannot support it. Installation is
+ * process-wide; every allocation afterwards pays two thread-local additions, plus a size-class
+ * lookup per deallocation.
+ */
+bool installThreadAllocationTracking();
+
+/**
+ * Returns true if `installThreadAllocationTracking()` has run successfully, i.e. the counters
+ * returned by `threadAllocationStats()` are live.
+ */
+bool threadAllocationTrackingAvailable();
+
+/**
+ * Returns the calling thread's allocation counters. Both counters read as zero until tracking is
+ * installed.
+ */
+ThreadAllocationStats threadAllocationStats();
+
+}  // namespace mongo
@@ -0,0 +1,166 @@
+/**
+ *    Copyright (C) 2025-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/tsc_tick_source.h"
+
+#include <chrono>  // NOLINT
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define MONGO_HAVE_CYCLE_COUNTER_TICK_SOURCE 1
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define MONGO_HAVE_CYCLE_COUNTER_TICK_SOURCE 1
+#endif
+
+namespace mongo {
+namespace {
+
+#ifdef MONGO_HAVE_CYCLE_COUNTER_TICK_SOURCE
+
+#if defined(__x86_64__)
+
+uint64_t readCycleCounter() {
+    return __rdtsc();
+}
+
+bool hasInvariantCycleCounter() {
+    // CPUID leaf 0x80000007 (Advanced Power Management Information), EDX bit 8 advertises an
+    // invariant TSC: one that ticks at a constant rate regardless of frequency scaling and deep
+    // power states, and that is synchronized across cores. Without it the counter is useless
+    // for timekeeping.
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) {
+        return false;
+    }
+    __cpuid(0x80000007u, eax, ebx, ecx, edx);
+    return edx & (1u << 8);
+}
+
+/**
+ * The TSC frequency is not directly readable from userspace, so measure it against the steady
+ * clock. Two independent measurement windows must agree closely; disagreement means the counter
+ * is not ticking at a stable rate (e.g. a live-migrating VM) and we should not trust it.
+ */
+int64_t calibrateCycleCounterFrequency() {
+    using SteadyClock = std::chrono::steady_clock;  // NOLINT
+
+    auto measure = [] {
+        constexpr auto kWindow = std::chrono::milliseconds(10);
+        const auto steadyStart = SteadyClock::now();
+        const auto counterStart = readCycleCounter();
+        while (SteadyClock::now() - steadyStart < kWindow) {
+        }
+        const auto counterEnd = readCycleCounter();
+        const auto steadyEnd = SteadyClock::now();
+
+        const auto elapsedNanos =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(steadyEnd - steadyStart)
+                .count();
+        if (elapsedNanos <= 0 || counterEnd <= counterStart) {
+            return 0.0;
+        }
+        return static_cast<double>(counterEnd - counterStart) * 1'000'000'000.0 / elapsedNanos;
+    };
+
+    const auto first = measure();
+    const auto second = measure();
+    if (first <= 0.0 || second <= 0.0 || std::abs(first - second) / first > 0.001) {
+        return 0;
+    }
+    return static_cast<int64_t>(std::llround((first + second) / 2));
+}
+
+#elif defined(__aarch64__)
+
+uint64_t readCycleCounter() {
+    uint64_t count;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(count));
+    return count;
+}
+
+bool hasInvariantCycleCounter() {
+    // The generic timer's virtual count is architecturally required to tick at a constant
+    // frequency and to be consistent across cores.
+    return true;
+}
+
+int64_t calibrateCycleCounterFrequency() {
+    // Unlike x86, the counter frequency is directly readable from userspace.
+    uint64_t frequency;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+    return static_cast<int64_t>(frequency);
+}
+
+#endif
+
+class TscTickSource final : public TickSource {
+public:
+    explicit TscTickSource(Tick ticksPerSecond) : _ticksPerSecond(ticksPerSecond) {}
+
+    Tick getTicksPerSecond() override {
+        return _ticksPerSecond;
+    }
+
+    Tick getTicks() override {
+        return static_cast<Tick>(readCycleCounter());
+    }
+
+private:
+    const Tick _ticksPerSecond;
+};
+
+#endif  // MONGO_HAVE_CYCLE_COUNTER_TICK_SOURCE
+
+}  // namespace
+
+std::unique_ptr<TickSource> makeTscTickSource() {
+#ifdef MONGO_HAVE_CYCLE_COUNTER_TICK_SOURCE
+    if (!hasInvariantCycleCounter()) {
+        return nullptr;
+    }
+
+    // Counters coarser than this would lose resolution relative to the steady clock without
+    // buying anything; some ARM generic timers tick in the low megahertz.
+    constexpr int64_t kMinTicksPerSecond = 10'000'000;
+
+    auto ticksPerSecond = calibrateCycleCounterFrequency();
+    if (ticksPerSecond < kMinTicksPerSecond) {
+        return nullptr;
+    }
+    return std::make_unique<TscTickSource>(ticksPerSecond);
+#else
+    return nullptr;
+#endif
+}
+
+}  // namespace mongo
@@ -41,8 +41,6 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/ctype.h"
 #include "mongo/util/hex.h"
-#include "mongo/util/static_immortal.h"
-#include "mongo/util/synchronized_value.h"
 #include "mongo/util/uuid.h"
 
 namespace mongo {
@@ -51,9 +49,14 @@ namespace {
 
 using namespace fmt::literals;
 
-synchronized_value<SecureRandom>& uuidGen() {
-    static StaticImmortal<synchronized_value<SecureRandom>> uuidGen;
-    return uuidGen.value();
+SecureRandom& uuidGen() {
+    // UUID generation is hot on session-heavy workloads, and a process-wide generator would
+    // serialize every draw on one mutex. Each thread instead draws from its own generator, whose
+    // entropy buffer is refilled in bulk from the system CSPRNG, so the common case is a short
+    // lock-free buffer copy. The underlying urandom descriptor remains a process-wide static, so
+    // this doesn't multiply open file descriptors.
+    thread_local SecureRandom uuidGen;
+    return uuidGen;
 }
 
 }  // namespace
@@ -107,7 +110,7 @@ bool UUID::isRFC4122v4() const {
 
 UUID UUID::gen() {
     UUIDStorage randomBytes;
-    uuidGen()->fill(&randomBytes, sizeof(randomBytes));
+    uuidGen().fill(&randomBytes, sizeof(randomBytes));
 
     // Set version in high 4 bits of byte 6 and variant in high 2 bits of byte 8, see RFC 4122,
     // section 4.1.1, 4.1.2 and 4.1.3.